@@ -144,10 +144,11 @@ set(CLANG_FLAGS_ENABLE_SSE2 "-msse2")
 set(CLANG_FLAGS_ENABLE_SSE4 "-msse4.1")
 set(CLANG_FLAGS_ENABLE_AVX "-mavx")
 set(CLANG_FLAGS_ENABLE_FMA4 "-mfma4")
-set(CLANG_FLAGS_ENABLE_AVX2 "-mavx2;-mfma")
-set(CLANG_FLAGS_ENABLE_AVX2128 "-mavx2;-mfma")
+set(CLANG_FLAGS_ENABLE_AVX2 "-mavx2;-mfma;-mf16c")
+set(CLANG_FLAGS_ENABLE_AVX2128 "-mavx2;-mfma;-mf16c")
 set(CLANG_FLAGS_ENABLE_AVX512F "-mavx512f")
 set(CLANG_FLAGS_ENABLE_AVX512FNOFMA "-mavx512f")
+set(CLANG_FLAGS_ENABLE_AVX512VL256 "-mavx512f;-mavx512vl;-mfma;-mf16c")
 set(CLANG_FLAGS_ENABLE_NEON32 "--target=arm-linux-gnueabihf;-mcpu=cortex-a8")
 set(CLANG_FLAGS_ENABLE_NEON32VFPV4 "-march=armv7-a;-mfpu=neon-vfpv4")
 # Arm AArch64 vector extensions.
@@ -238,10 +239,11 @@ elseif(MSVC)
   endif()
   set(FLAGS_ENABLE_AVX  /D__SSE2__ /D__SSE3__ /D__SSE4_1__ /D__AVX__ /arch:AVX)
   set(FLAGS_ENABLE_FMA4 /D__SSE2__ /D__SSE3__ /D__SSE4_1__ /D__AVX__ /D__AVX2__ /D__FMA4__ /arch:AVX2)
-  set(FLAGS_ENABLE_AVX2 /D__SSE2__ /D__SSE3__ /D__SSE4_1__ /D__AVX__ /D__AVX2__ /arch:AVX2)
-  set(FLAGS_ENABLE_AVX2128 /D__SSE2__ /D__SSE3__ /D__SSE4_1__ /D__AVX__ /D__AVX2__ /arch:AVX2)
+  set(FLAGS_ENABLE_AVX2 /D__SSE2__ /D__SSE3__ /D__SSE4_1__ /D__AVX__ /D__AVX2__ /D__F16C__ /arch:AVX2)
+  set(FLAGS_ENABLE_AVX2128 /D__SSE2__ /D__SSE3__ /D__SSE4_1__ /D__AVX__ /D__AVX2__ /D__F16C__ /arch:AVX2)
   set(FLAGS_ENABLE_AVX512F /D__SSE2__ /D__SSE3__ /D__SSE4_1__ /D__AVX__ /D__AVX2__ /D__AVX512F__ /arch:AVX2)
   set(FLAGS_ENABLE_AVX512FNOFMA /D__SSE2__ /D__SSE3__ /D__SSE4_1__ /D__AVX__ /D__AVX2__ /D__AVX512F__ /arch:AVX2)
+  set(FLAGS_ENABLE_AVX512VL256 /D__SSE2__ /D__SSE3__ /D__SSE4_1__ /D__AVX__ /D__AVX2__ /D__AVX512F__ /D__AVX512VL__ /D__F16C__ /arch:AVX512)
   set(FLAGS_ENABLE_PURECFMA_SCALAR /D__SSE2__ /D__SSE3__ /D__SSE4_1__ /D__AVX__ /D__AVX2__ /arch:AVX2)
   set(FLAGS_WALL "/D_CRT_SECURE_NO_WARNINGS /D_CRT_NONSTDC_NO_DEPRECATE")
 
@@ -259,6 +261,7 @@ elseif(CMAKE_C_COMPILER_ID MATCHES "Intel")
   set(FLAGS_ENABLE_AVX2128 "-march=core-avx2")
   set(FLAGS_ENABLE_AVX512F "-xCOMMON-AVX512")
   set(FLAGS_ENABLE_AVX512FNOFMA "-xCOMMON-AVX512")
+  set(FLAGS_ENABLE_AVX512VL256 "-xCORE-AVX512")
   set(FLAGS_ENABLE_PURECFMA_SCALAR "-march=core-avx2;-fno-strict-aliasing")
   set(FLAGS_ENABLE_FMA4 "-msse2")  # This is a dummy flag
   set(FLAGS_STRICTMATH "-fp-model strict -Qoption,cpp,--extended_float_type")
@@ -492,6 +495,30 @@ if (ENFORCE_AVX512F AND NOT COMPILER_SUPPORTS_AVX512F)
   message(FATAL_ERROR "ENFORCE_AVX512F is specified and that feature is disabled or not supported by the compiler")
 endif()
 
+# AVX512VL256
+
+option(DISABLE_AVX512VL256 "Disable AVX512VL256" OFF)
+option(ENFORCE_AVX512VL256 "Build fails if AVX512VL256 is not supported by the compiler" OFF)
+
+if(SLEEF_ARCH_X86 AND NOT DISABLE_AVX512VL256)
+  string (REPLACE ";" " " CMAKE_REQUIRED_FLAGS "${FLAGS_ENABLE_AVX512VL256}")
+  CHECK_C_SOURCE_COMPILES("
+  #if defined(_MSC_VER)
+  #include <intrin.h>
+  #else
+  #include <x86intrin.h>
+  #endif
+  int main() {
+    __m256d a = _mm256_set1_pd(1);
+    __mmask8 m = _mm256_cmp_pd_mask(a, a, _CMP_EQ_OQ);
+    __m256d r = _mm256_mask_blend_pd(m, a, _mm256_getexp_pd(a)); }"
+    COMPILER_SUPPORTS_AVX512VL256)
+endif()
+
+if (ENFORCE_AVX512VL256 AND NOT COMPILER_SUPPORTS_AVX512VL256)
+  message(FATAL_ERROR "ENFORCE_AVX512VL256 is specified and that feature is disabled or not supported by the compiler")
+endif()
+
 # SVE
 
 option(DISABLE_SVE "Disable SVE" OFF)
@@ -692,6 +719,17 @@ if (COMPILER_SUPPORTS_WEAK_ALIASES AND
   set(ENABLE_GNUABI ${COMPILER_SUPPORTS_WEAK_ALIASES})
 endif()
 
+# GNU indirect functions
+
+CHECK_C_SOURCE_COMPILES("
+  static int f0(int a) { return a + 1; }
+  static int (*resolve(void))(int) { return f0; }
+  int f(int a) __attribute__((ifunc(\"resolve\")));
+  int main(void) {
+    return f(2);
+  }"
+  COMPILER_SUPPORTS_IFUNC)
+
 # Built-in math functions
 
 CHECK_C_SOURCE_COMPILES("
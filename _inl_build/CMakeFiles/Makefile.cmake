@@ -0,0 +1,281 @@
+# CMAKE generated file: DO NOT EDIT!
+# Generated by "Unix Makefiles" Generator, CMake Version 3.25
+
+# The generator used is:
+set(CMAKE_DEPENDS_GENERATOR "Unix Makefiles")
+
+# The top level Makefile was generated from the following files:
+set(CMAKE_MAKEFILE_DEPENDS
+  "CMakeCache.txt"
+  "/root/repo/CMakeLists.txt"
+  "/root/repo/Configure.cmake"
+  "CMakeFiles/3.25.1/CMakeCCompiler.cmake"
+  "CMakeFiles/3.25.1/CMakeSystem.cmake"
+  "/root/repo/sleef-config.h.in"
+  "/root/repo/src/CMakeLists.txt"
+  "/root/repo/src/common/CMakeLists.txt"
+  "/root/repo/src/libm-tester/CMakeLists.txt"
+  "/root/repo/src/libm/CMakeLists.txt"
+  "/root/repo/src/libm/sleef.pc.in"
+  "/root/repo/src/libm/sleeflibm_header.h.org.in"
+  "/usr/share/cmake-3.25/Modules/BasicConfigVersion-SameMajorVersion.cmake.in"
+  "/usr/share/cmake-3.25/Modules/CMakeCCompiler.cmake.in"
+  "/usr/share/cmake-3.25/Modules/CMakeCCompilerABI.c"
+  "/usr/share/cmake-3.25/Modules/CMakeCInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeCheckCompilerFlagCommonPatterns.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeCommonLanguageInclude.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeCompilerIdDetection.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeDetermineCCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeDetermineCompileFeatures.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeDetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeDetermineCompilerABI.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeDetermineCompilerId.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeDetermineSystem.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeFindBinUtils.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeGenericSystem.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeInitializeConfigs.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeLanguageInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakePackageConfigHelpers.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeParseImplicitIncludeInfo.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeParseImplicitLinkInfo.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeParseLibraryArchitecture.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeSystem.cmake.in"
+  "/usr/share/cmake-3.25/Modules/CMakeSystemSpecificInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeSystemSpecificInitialize.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeTestCCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeTestCompilerCommon.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeUnixFindMake.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckCCompilerFlag.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckCSourceCompiles.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckIncludeFile.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckIncludeFileCXX.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckLanguage.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckTypeSize.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/ADSP-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/ARMCC-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/ARMClang-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/AppleClang-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/Borland-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/Bruce-C-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/CMakeCommonCompilerMacros.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/Clang-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/Clang-DetermineCompilerInternal.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/Compaq-C-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/Cray-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/Embarcadero-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/Fujitsu-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/FujitsuClang-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GHS-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU-C-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU-C.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU-FindBinUtils.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/HP-C-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/IAR-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/IBMCPP-C-DetermineVersionInternal.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/IBMClang-C-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/Intel-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/IntelLLVM-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/LCC-C-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/MSVC-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/NVHPC-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/NVIDIA-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/OpenWatcom-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/PGI-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/PathScale-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/SCO-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/SDCC-C-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/SunPro-C-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/TI-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/Tasking-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/TinyCC-C-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/VisualAge-C-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/Watcom-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/XL-C-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/XLClang-C-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/zOS-C-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/FindOpenMP.cmake"
+  "/usr/share/cmake-3.25/Modules/FindOpenSSL.cmake"
+  "/usr/share/cmake-3.25/Modules/FindPackageHandleStandardArgs.cmake"
+  "/usr/share/cmake-3.25/Modules/FindPackageMessage.cmake"
+  "/usr/share/cmake-3.25/Modules/FindPkgConfig.cmake"
+  "/usr/share/cmake-3.25/Modules/GNUInstallDirs.cmake"
+  "/usr/share/cmake-3.25/Modules/Internal/CheckCompilerFlag.cmake"
+  "/usr/share/cmake-3.25/Modules/Internal/CheckFlagCommonConfig.cmake"
+  "/usr/share/cmake-3.25/Modules/Internal/CheckSourceCompiles.cmake"
+  "/usr/share/cmake-3.25/Modules/Internal/FeatureTesting.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU-C.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/UnixPaths.cmake"
+  "/usr/share/cmake-3.25/Modules/WriteBasicConfigVersionFile.cmake"
+  )
+
+# The corresponding makefile is:
+set(CMAKE_MAKEFILE_OUTPUTS
+  "Makefile"
+  "CMakeFiles/cmake.check_cache"
+  )
+
+# Byproducts of CMake generate step:
+set(CMAKE_MAKEFILE_PRODUCTS
+  "CMakeFiles/3.25.1/CMakeSystem.cmake"
+  "CMakeFiles/3.25.1/CMakeCCompiler.cmake"
+  "CMakeFiles/3.25.1/CMakeCCompiler.cmake"
+  "include/sleef-config.h"
+  "sleefConfigVersion.cmake"
+  "CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/libm/sleeflibm_header.h.org"
+  "src/libm/sleef.pc"
+  "src/libm/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/libm-tester/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/common/CMakeFiles/CMakeDirectoryInformation.cmake"
+  )
+
+# Dependency information for all targets:
+set(CMAKE_DEPEND_INFO_FILES
+  "src/libm/CMakeFiles/mkrename.dir/DependInfo.cmake"
+  "src/libm/CMakeFiles/renameAVX512FNOFMA.h_generated.dir/DependInfo.cmake"
+  "src/libm/CMakeFiles/renameAVX512F.h_generated.dir/DependInfo.cmake"
+  "src/libm/CMakeFiles/renameAVX512VL256.h_generated.dir/DependInfo.cmake"
+  "src/libm/CMakeFiles/renameAVX2.h_generated.dir/DependInfo.cmake"
+  "src/libm/CMakeFiles/renameAVX2128.h_generated.dir/DependInfo.cmake"
+  "src/libm/CMakeFiles/renameFMA4.h_generated.dir/DependInfo.cmake"
+  "src/libm/CMakeFiles/renameAVX.h_generated.dir/DependInfo.cmake"
+  "src/libm/CMakeFiles/renameSSE4.h_generated.dir/DependInfo.cmake"
+  "src/libm/CMakeFiles/renameSSE2.h_generated.dir/DependInfo.cmake"
+  "src/libm/CMakeFiles/renamePUREC_SCALAR.h_generated.dir/DependInfo.cmake"
+  "src/libm/CMakeFiles/renamePURECFMA_SCALAR.h_generated.dir/DependInfo.cmake"
+  "src/libm/CMakeFiles/renameCUDA.h_generated.dir/DependInfo.cmake"
+  "src/libm/CMakeFiles/mkrename_gnuabi.dir/DependInfo.cmake"
+  "src/libm/CMakeFiles/mkmasked_gnuabi.dir/DependInfo.cmake"
+  "src/libm/CMakeFiles/maskedSSE2_generated.dir/DependInfo.cmake"
+  "src/libm/CMakeFiles/maskedAVX_generated.dir/DependInfo.cmake"
+  "src/libm/CMakeFiles/maskedAVX2_generated.dir/DependInfo.cmake"
+  "src/libm/CMakeFiles/maskedAVX512VL256_generated.dir/DependInfo.cmake"
+  "src/libm/CMakeFiles/maskedAVX512F_generated.dir/DependInfo.cmake"
+  "src/libm/CMakeFiles/headers.dir/DependInfo.cmake"
+  "src/libm/CMakeFiles/mkalias.dir/DependInfo.cmake"
+  "src/libm/CMakeFiles/mkdisp.dir/DependInfo.cmake"
+  "src/libm/CMakeFiles/mkarray.dir/DependInfo.cmake"
+  "src/libm/CMakeFiles/sleef.dir/DependInfo.cmake"
+  "src/libm/CMakeFiles/sleefavx512fnofma.dir/DependInfo.cmake"
+  "src/libm/CMakeFiles/sleefdetavx512fnofma.dir/DependInfo.cmake"
+  "src/libm/CMakeFiles/sleefavx512f.dir/DependInfo.cmake"
+  "src/libm/CMakeFiles/sleefdetavx512f.dir/DependInfo.cmake"
+  "src/libm/CMakeFiles/alias_avx512f.h_generated.dir/DependInfo.cmake"
+  "src/libm/CMakeFiles/sleefavx512vl256.dir/DependInfo.cmake"
+  "src/libm/CMakeFiles/sleefdetavx512vl256.dir/DependInfo.cmake"
+  "src/libm/CMakeFiles/sleefavx2.dir/DependInfo.cmake"
+  "src/libm/CMakeFiles/sleefdetavx2.dir/DependInfo.cmake"
+  "src/libm/CMakeFiles/sleefavx2128.dir/DependInfo.cmake"
+  "src/libm/CMakeFiles/sleefdetavx2128.dir/DependInfo.cmake"
+  "src/libm/CMakeFiles/sleeffma4.dir/DependInfo.cmake"
+  "src/libm/CMakeFiles/sleefdetfma4.dir/DependInfo.cmake"
+  "src/libm/CMakeFiles/sleefavx.dir/DependInfo.cmake"
+  "src/libm/CMakeFiles/sleefdetavx.dir/DependInfo.cmake"
+  "src/libm/CMakeFiles/sleefsse4.dir/DependInfo.cmake"
+  "src/libm/CMakeFiles/sleefdetsse4.dir/DependInfo.cmake"
+  "src/libm/CMakeFiles/sleefsse2.dir/DependInfo.cmake"
+  "src/libm/CMakeFiles/sleefdetsse2.dir/DependInfo.cmake"
+  "src/libm/CMakeFiles/sleefpurec_scalar.dir/DependInfo.cmake"
+  "src/libm/CMakeFiles/sleefdetpurec_scalar.dir/DependInfo.cmake"
+  "src/libm/CMakeFiles/sleefpurecfma_scalar.dir/DependInfo.cmake"
+  "src/libm/CMakeFiles/sleefdetpurecfma_scalar.dir/DependInfo.cmake"
+  "src/libm/CMakeFiles/inline_headers_util.dir/DependInfo.cmake"
+  "src/libm/CMakeFiles/dispscalar.c_generated.dir/DependInfo.cmake"
+  "src/libm/CMakeFiles/renamedspscalar.h_generated.dir/DependInfo.cmake"
+  "src/libm/CMakeFiles/dispscalar_obj.dir/DependInfo.cmake"
+  "src/libm/CMakeFiles/dispsse.c_generated.dir/DependInfo.cmake"
+  "src/libm/CMakeFiles/renamedsp128.h_generated.dir/DependInfo.cmake"
+  "src/libm/CMakeFiles/dispavx.c_generated.dir/DependInfo.cmake"
+  "src/libm/CMakeFiles/renamedsp256.h_generated.dir/DependInfo.cmake"
+  "src/libm/CMakeFiles/dispsse_obj.dir/DependInfo.cmake"
+  "src/libm/CMakeFiles/dispavx_obj.dir/DependInfo.cmake"
+  "src/libm/CMakeFiles/disparray.c_generated.dir/DependInfo.cmake"
+  "src/libm/CMakeFiles/disparray_obj.dir/DependInfo.cmake"
+  "src/libm/CMakeFiles/sleefgnuabisse2dp.dir/DependInfo.cmake"
+  "src/libm/CMakeFiles/sleefgnuabisse2sp.dir/DependInfo.cmake"
+  "src/libm/CMakeFiles/sleefgnuabiavxdp.dir/DependInfo.cmake"
+  "src/libm/CMakeFiles/sleefgnuabiavxsp.dir/DependInfo.cmake"
+  "src/libm/CMakeFiles/sleefgnuabiavx2dp.dir/DependInfo.cmake"
+  "src/libm/CMakeFiles/sleefgnuabiavx2sp.dir/DependInfo.cmake"
+  "src/libm/CMakeFiles/sleefgnuabiavx512vl256dp.dir/DependInfo.cmake"
+  "src/libm/CMakeFiles/sleefgnuabiavx512vl256sp.dir/DependInfo.cmake"
+  "src/libm/CMakeFiles/sleefgnuabiavx512fdp.dir/DependInfo.cmake"
+  "src/libm/CMakeFiles/sleefgnuabiavx512fsp.dir/DependInfo.cmake"
+  "src/libm/CMakeFiles/sleefgnuabi.dir/DependInfo.cmake"
+  "src/libm/CMakeFiles/sleefscalar.dir/DependInfo.cmake"
+  "src/libm-tester/CMakeFiles/iut.dir/DependInfo.cmake"
+  "src/libm-tester/CMakeFiles/testerarray.dir/DependInfo.cmake"
+  "src/libm-tester/CMakeFiles/testeractivation.dir/DependInfo.cmake"
+  "src/libm-tester/CMakeFiles/testerfast.dir/DependInfo.cmake"
+  "src/libm-tester/CMakeFiles/testertrigr.dir/DependInfo.cmake"
+  "src/libm-tester/CMakeFiles/testerhalf.dir/DependInfo.cmake"
+  "src/libm-tester/CMakeFiles/testerdispatch.dir/DependInfo.cmake"
+  "src/libm-tester/CMakeFiles/iutavx512fnofma.dir/DependInfo.cmake"
+  "src/libm-tester/CMakeFiles/iutyavx512fnofma.dir/DependInfo.cmake"
+  "src/libm-tester/CMakeFiles/iutiavx512fnofma.dir/DependInfo.cmake"
+  "src/libm-tester/CMakeFiles/tester3avx512fnofma.dir/DependInfo.cmake"
+  "src/libm-tester/CMakeFiles/iutavx512f.dir/DependInfo.cmake"
+  "src/libm-tester/CMakeFiles/iutyavx512f.dir/DependInfo.cmake"
+  "src/libm-tester/CMakeFiles/iutiavx512f.dir/DependInfo.cmake"
+  "src/libm-tester/CMakeFiles/tester3avx512f.dir/DependInfo.cmake"
+  "src/libm-tester/CMakeFiles/iutavx512vl256.dir/DependInfo.cmake"
+  "src/libm-tester/CMakeFiles/iutyavx512vl256.dir/DependInfo.cmake"
+  "src/libm-tester/CMakeFiles/iutiavx512vl256.dir/DependInfo.cmake"
+  "src/libm-tester/CMakeFiles/tester3avx512vl256.dir/DependInfo.cmake"
+  "src/libm-tester/CMakeFiles/iutavx2.dir/DependInfo.cmake"
+  "src/libm-tester/CMakeFiles/iutyavx2.dir/DependInfo.cmake"
+  "src/libm-tester/CMakeFiles/iutiavx2.dir/DependInfo.cmake"
+  "src/libm-tester/CMakeFiles/tester3avx2.dir/DependInfo.cmake"
+  "src/libm-tester/CMakeFiles/iutavx2128.dir/DependInfo.cmake"
+  "src/libm-tester/CMakeFiles/iutyavx2128.dir/DependInfo.cmake"
+  "src/libm-tester/CMakeFiles/iutiavx2128.dir/DependInfo.cmake"
+  "src/libm-tester/CMakeFiles/tester3avx2128.dir/DependInfo.cmake"
+  "src/libm-tester/CMakeFiles/iutfma4.dir/DependInfo.cmake"
+  "src/libm-tester/CMakeFiles/iutyfma4.dir/DependInfo.cmake"
+  "src/libm-tester/CMakeFiles/iutifma4.dir/DependInfo.cmake"
+  "src/libm-tester/CMakeFiles/tester3fma4.dir/DependInfo.cmake"
+  "src/libm-tester/CMakeFiles/iutavx.dir/DependInfo.cmake"
+  "src/libm-tester/CMakeFiles/iutyavx.dir/DependInfo.cmake"
+  "src/libm-tester/CMakeFiles/iutiavx.dir/DependInfo.cmake"
+  "src/libm-tester/CMakeFiles/tester3avx.dir/DependInfo.cmake"
+  "src/libm-tester/CMakeFiles/iutsse4.dir/DependInfo.cmake"
+  "src/libm-tester/CMakeFiles/iutysse4.dir/DependInfo.cmake"
+  "src/libm-tester/CMakeFiles/iutisse4.dir/DependInfo.cmake"
+  "src/libm-tester/CMakeFiles/tester3sse4.dir/DependInfo.cmake"
+  "src/libm-tester/CMakeFiles/iutsse2.dir/DependInfo.cmake"
+  "src/libm-tester/CMakeFiles/iutysse2.dir/DependInfo.cmake"
+  "src/libm-tester/CMakeFiles/iutisse2.dir/DependInfo.cmake"
+  "src/libm-tester/CMakeFiles/tester3sse2.dir/DependInfo.cmake"
+  "src/libm-tester/CMakeFiles/iutpurec_scalar.dir/DependInfo.cmake"
+  "src/libm-tester/CMakeFiles/iutypurec_scalar.dir/DependInfo.cmake"
+  "src/libm-tester/CMakeFiles/iutipurec_scalar.dir/DependInfo.cmake"
+  "src/libm-tester/CMakeFiles/tester3purec_scalar.dir/DependInfo.cmake"
+  "src/libm-tester/CMakeFiles/iutpurecfma_scalar.dir/DependInfo.cmake"
+  "src/libm-tester/CMakeFiles/iutypurecfma_scalar.dir/DependInfo.cmake"
+  "src/libm-tester/CMakeFiles/iutipurecfma_scalar.dir/DependInfo.cmake"
+  "src/libm-tester/CMakeFiles/tester3purecfma_scalar.dir/DependInfo.cmake"
+  "src/libm-tester/CMakeFiles/gnuabi_compatibility_SSE2.dir/DependInfo.cmake"
+  "src/libm-tester/CMakeFiles/gnuabi_compatibility_SSE2_masked.dir/DependInfo.cmake"
+  "src/libm-tester/CMakeFiles/gnuabi_compatibility_AVX.dir/DependInfo.cmake"
+  "src/libm-tester/CMakeFiles/gnuabi_compatibility_AVX_masked.dir/DependInfo.cmake"
+  "src/libm-tester/CMakeFiles/gnuabi_compatibility_AVX2.dir/DependInfo.cmake"
+  "src/libm-tester/CMakeFiles/gnuabi_compatibility_AVX2_masked.dir/DependInfo.cmake"
+  "src/libm-tester/CMakeFiles/gnuabi_compatibility_AVX512VL256.dir/DependInfo.cmake"
+  "src/libm-tester/CMakeFiles/gnuabi_compatibility_AVX512VL256_masked.dir/DependInfo.cmake"
+  "src/libm-tester/CMakeFiles/gnuabi_compatibility_AVX512F.dir/DependInfo.cmake"
+  "src/libm-tester/CMakeFiles/gnuabi_compatibility_AVX512F_masked.dir/DependInfo.cmake"
+  "src/libm-tester/CMakeFiles/iutdsp128.dir/DependInfo.cmake"
+  "src/libm-tester/CMakeFiles/iutdsp256.dir/DependInfo.cmake"
+  "src/libm-tester/CMakeFiles/testervecabi.dir/DependInfo.cmake"
+  "src/libm-tester/CMakeFiles/mveclibtest-sse2.dir/DependInfo.cmake"
+  "src/libm-tester/CMakeFiles/mveclibtest-avx.dir/DependInfo.cmake"
+  "src/libm-tester/CMakeFiles/mveclibtest-avx2.dir/DependInfo.cmake"
+  "src/libm-tester/CMakeFiles/mveclibtest-avx512f.dir/DependInfo.cmake"
+  "src/common/CMakeFiles/common.dir/DependInfo.cmake"
+  "src/common/CMakeFiles/arraymap.dir/DependInfo.cmake"
+  "src/common/CMakeFiles/addSuffix.dir/DependInfo.cmake"
+  )
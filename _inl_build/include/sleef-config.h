@@ -0,0 +1,11 @@
+// Configuration of SLEEF /////////////////////////////////////////////
+
+#ifndef SLEEF_CONFIG_H
+#define SLEEF_CONFIG_H
+
+#define SLEEF_VERSION_MAJOR 3
+#define SLEEF_VERSION_MINOR 6
+
+/* #undef SLEEF_STATIC_LIBS */
+
+#endif // SLEEF_CONFIG_H
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../bin/addSuffix"
+  "../../bin/addSuffix.pdb"
+  "CMakeFiles/addSuffix.dir/addSuffix.c.o"
+  "CMakeFiles/addSuffix.dir/addSuffix.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/addSuffix.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,9 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/arraymap.dir/arraymap.c.o"
+  "CMakeFiles/arraymap.dir/arraymap.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/arraymap.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
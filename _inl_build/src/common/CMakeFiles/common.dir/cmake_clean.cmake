@@ -0,0 +1,9 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/common.dir/common.c.o"
+  "CMakeFiles/common.dir/common.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/common.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
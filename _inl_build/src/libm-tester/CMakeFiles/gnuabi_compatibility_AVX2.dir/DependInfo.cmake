@@ -0,0 +1,21 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/common/main_checkfeature.c" "src/libm-tester/CMakeFiles/gnuabi_compatibility_AVX2.dir/__/common/main_checkfeature.c.o" "gcc" "src/libm-tester/CMakeFiles/gnuabi_compatibility_AVX2.dir/__/common/main_checkfeature.c.o.d"
+  "/root/repo/src/libm-tester/gnuabi_compatibility.c" "src/libm-tester/CMakeFiles/gnuabi_compatibility_AVX2.dir/gnuabi_compatibility.c.o" "gcc" "src/libm-tester/CMakeFiles/gnuabi_compatibility_AVX2.dir/gnuabi_compatibility.c.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_inl_build/src/libm/CMakeFiles/sleefgnuabi.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
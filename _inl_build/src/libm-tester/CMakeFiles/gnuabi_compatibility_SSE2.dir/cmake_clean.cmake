@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "../../bin/gnuabi_compatibility_SSE2"
+  "../../bin/gnuabi_compatibility_SSE2.pdb"
+  "CMakeFiles/gnuabi_compatibility_SSE2.dir/__/common/main_checkfeature.c.o"
+  "CMakeFiles/gnuabi_compatibility_SSE2.dir/__/common/main_checkfeature.c.o.d"
+  "CMakeFiles/gnuabi_compatibility_SSE2.dir/gnuabi_compatibility.c.o"
+  "CMakeFiles/gnuabi_compatibility_SSE2.dir/gnuabi_compatibility.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/gnuabi_compatibility_SSE2.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "../../bin/iut"
+  "../../bin/iut.pdb"
+  "CMakeFiles/iut.dir/iut.c.o"
+  "CMakeFiles/iut.dir/iut.c.o.d"
+  "CMakeFiles/iut.dir/testerutil.c.o"
+  "CMakeFiles/iut.dir/testerutil.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/iut.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
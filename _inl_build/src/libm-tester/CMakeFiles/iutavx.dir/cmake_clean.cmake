@@ -0,0 +1,15 @@
+file(REMOVE_RECURSE
+  "../../bin/iutavx"
+  "../../bin/iutavx.pdb"
+  "CMakeFiles/iutavx.dir/__/common/main_checkfeature.c.o"
+  "CMakeFiles/iutavx.dir/__/common/main_checkfeature.c.o.d"
+  "CMakeFiles/iutavx.dir/iutsimd.c.o"
+  "CMakeFiles/iutavx.dir/iutsimd.c.o.d"
+  "CMakeFiles/iutavx.dir/testerutil.c.o"
+  "CMakeFiles/iutavx.dir/testerutil.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/iutavx.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
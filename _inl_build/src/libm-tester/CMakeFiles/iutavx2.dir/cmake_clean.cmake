@@ -0,0 +1,15 @@
+file(REMOVE_RECURSE
+  "../../bin/iutavx2"
+  "../../bin/iutavx2.pdb"
+  "CMakeFiles/iutavx2.dir/__/common/main_checkfeature.c.o"
+  "CMakeFiles/iutavx2.dir/__/common/main_checkfeature.c.o.d"
+  "CMakeFiles/iutavx2.dir/iutsimd.c.o"
+  "CMakeFiles/iutavx2.dir/iutsimd.c.o.d"
+  "CMakeFiles/iutavx2.dir/testerutil.c.o"
+  "CMakeFiles/iutavx2.dir/testerutil.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/iutavx2.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,15 @@
+file(REMOVE_RECURSE
+  "../../bin/iutavx2128"
+  "../../bin/iutavx2128.pdb"
+  "CMakeFiles/iutavx2128.dir/__/common/main_checkfeature.c.o"
+  "CMakeFiles/iutavx2128.dir/__/common/main_checkfeature.c.o.d"
+  "CMakeFiles/iutavx2128.dir/iutsimd.c.o"
+  "CMakeFiles/iutavx2128.dir/iutsimd.c.o.d"
+  "CMakeFiles/iutavx2128.dir/testerutil.c.o"
+  "CMakeFiles/iutavx2128.dir/testerutil.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/iutavx2128.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
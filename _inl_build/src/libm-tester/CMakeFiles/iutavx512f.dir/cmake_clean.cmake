@@ -0,0 +1,15 @@
+file(REMOVE_RECURSE
+  "../../bin/iutavx512f"
+  "../../bin/iutavx512f.pdb"
+  "CMakeFiles/iutavx512f.dir/__/common/main_checkfeature.c.o"
+  "CMakeFiles/iutavx512f.dir/__/common/main_checkfeature.c.o.d"
+  "CMakeFiles/iutavx512f.dir/iutsimd.c.o"
+  "CMakeFiles/iutavx512f.dir/iutsimd.c.o.d"
+  "CMakeFiles/iutavx512f.dir/testerutil.c.o"
+  "CMakeFiles/iutavx512f.dir/testerutil.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/iutavx512f.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,15 @@
+file(REMOVE_RECURSE
+  "../../bin/iutavx512fnofma"
+  "../../bin/iutavx512fnofma.pdb"
+  "CMakeFiles/iutavx512fnofma.dir/__/common/main_checkfeature.c.o"
+  "CMakeFiles/iutavx512fnofma.dir/__/common/main_checkfeature.c.o.d"
+  "CMakeFiles/iutavx512fnofma.dir/iutsimd.c.o"
+  "CMakeFiles/iutavx512fnofma.dir/iutsimd.c.o.d"
+  "CMakeFiles/iutavx512fnofma.dir/testerutil.c.o"
+  "CMakeFiles/iutavx512fnofma.dir/testerutil.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/iutavx512fnofma.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
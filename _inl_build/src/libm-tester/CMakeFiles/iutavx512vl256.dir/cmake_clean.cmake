@@ -0,0 +1,15 @@
+file(REMOVE_RECURSE
+  "../../bin/iutavx512vl256"
+  "../../bin/iutavx512vl256.pdb"
+  "CMakeFiles/iutavx512vl256.dir/__/common/main_checkfeature.c.o"
+  "CMakeFiles/iutavx512vl256.dir/__/common/main_checkfeature.c.o.d"
+  "CMakeFiles/iutavx512vl256.dir/iutsimd.c.o"
+  "CMakeFiles/iutavx512vl256.dir/iutsimd.c.o.d"
+  "CMakeFiles/iutavx512vl256.dir/testerutil.c.o"
+  "CMakeFiles/iutavx512vl256.dir/testerutil.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/iutavx512vl256.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,15 @@
+file(REMOVE_RECURSE
+  "../../bin/iutdsp128"
+  "../../bin/iutdsp128.pdb"
+  "CMakeFiles/iutdsp128.dir/__/common/main_checkfeature.c.o"
+  "CMakeFiles/iutdsp128.dir/__/common/main_checkfeature.c.o.d"
+  "CMakeFiles/iutdsp128.dir/iutsimd.c.o"
+  "CMakeFiles/iutdsp128.dir/iutsimd.c.o.d"
+  "CMakeFiles/iutdsp128.dir/testerutil.c.o"
+  "CMakeFiles/iutdsp128.dir/testerutil.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/iutdsp128.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
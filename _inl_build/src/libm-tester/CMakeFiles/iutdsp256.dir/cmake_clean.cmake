@@ -0,0 +1,15 @@
+file(REMOVE_RECURSE
+  "../../bin/iutdsp256"
+  "../../bin/iutdsp256.pdb"
+  "CMakeFiles/iutdsp256.dir/__/common/main_checkfeature.c.o"
+  "CMakeFiles/iutdsp256.dir/__/common/main_checkfeature.c.o.d"
+  "CMakeFiles/iutdsp256.dir/iutsimd.c.o"
+  "CMakeFiles/iutdsp256.dir/iutsimd.c.o.d"
+  "CMakeFiles/iutdsp256.dir/testerutil.c.o"
+  "CMakeFiles/iutdsp256.dir/testerutil.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/iutdsp256.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
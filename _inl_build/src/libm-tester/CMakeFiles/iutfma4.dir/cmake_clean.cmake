@@ -0,0 +1,15 @@
+file(REMOVE_RECURSE
+  "../../bin/iutfma4"
+  "../../bin/iutfma4.pdb"
+  "CMakeFiles/iutfma4.dir/__/common/main_checkfeature.c.o"
+  "CMakeFiles/iutfma4.dir/__/common/main_checkfeature.c.o.d"
+  "CMakeFiles/iutfma4.dir/iutsimd.c.o"
+  "CMakeFiles/iutfma4.dir/iutsimd.c.o.d"
+  "CMakeFiles/iutfma4.dir/testerutil.c.o"
+  "CMakeFiles/iutfma4.dir/testerutil.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/iutfma4.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
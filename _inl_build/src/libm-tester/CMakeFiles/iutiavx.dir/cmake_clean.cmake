@@ -0,0 +1,15 @@
+file(REMOVE_RECURSE
+  "../../bin/iutiavx"
+  "../../bin/iutiavx.pdb"
+  "CMakeFiles/iutiavx.dir/__/common/main_checkfeature.c.o"
+  "CMakeFiles/iutiavx.dir/__/common/main_checkfeature.c.o.d"
+  "CMakeFiles/iutiavx.dir/iutsimd.c.o"
+  "CMakeFiles/iutiavx.dir/iutsimd.c.o.d"
+  "CMakeFiles/iutiavx.dir/testerutil.c.o"
+  "CMakeFiles/iutiavx.dir/testerutil.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/iutiavx.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
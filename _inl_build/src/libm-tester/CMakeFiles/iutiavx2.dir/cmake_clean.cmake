@@ -0,0 +1,15 @@
+file(REMOVE_RECURSE
+  "../../bin/iutiavx2"
+  "../../bin/iutiavx2.pdb"
+  "CMakeFiles/iutiavx2.dir/__/common/main_checkfeature.c.o"
+  "CMakeFiles/iutiavx2.dir/__/common/main_checkfeature.c.o.d"
+  "CMakeFiles/iutiavx2.dir/iutsimd.c.o"
+  "CMakeFiles/iutiavx2.dir/iutsimd.c.o.d"
+  "CMakeFiles/iutiavx2.dir/testerutil.c.o"
+  "CMakeFiles/iutiavx2.dir/testerutil.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/iutiavx2.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
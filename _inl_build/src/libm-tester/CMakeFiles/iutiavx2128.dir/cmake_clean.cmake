@@ -0,0 +1,15 @@
+file(REMOVE_RECURSE
+  "../../bin/iutiavx2128"
+  "../../bin/iutiavx2128.pdb"
+  "CMakeFiles/iutiavx2128.dir/__/common/main_checkfeature.c.o"
+  "CMakeFiles/iutiavx2128.dir/__/common/main_checkfeature.c.o.d"
+  "CMakeFiles/iutiavx2128.dir/iutsimd.c.o"
+  "CMakeFiles/iutiavx2128.dir/iutsimd.c.o.d"
+  "CMakeFiles/iutiavx2128.dir/testerutil.c.o"
+  "CMakeFiles/iutiavx2128.dir/testerutil.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/iutiavx2128.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,15 @@
+file(REMOVE_RECURSE
+  "../../bin/iutiavx512f"
+  "../../bin/iutiavx512f.pdb"
+  "CMakeFiles/iutiavx512f.dir/__/common/main_checkfeature.c.o"
+  "CMakeFiles/iutiavx512f.dir/__/common/main_checkfeature.c.o.d"
+  "CMakeFiles/iutiavx512f.dir/iutsimd.c.o"
+  "CMakeFiles/iutiavx512f.dir/iutsimd.c.o.d"
+  "CMakeFiles/iutiavx512f.dir/testerutil.c.o"
+  "CMakeFiles/iutiavx512f.dir/testerutil.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/iutiavx512f.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,15 @@
+file(REMOVE_RECURSE
+  "../../bin/iutiavx512fnofma"
+  "../../bin/iutiavx512fnofma.pdb"
+  "CMakeFiles/iutiavx512fnofma.dir/__/common/main_checkfeature.c.o"
+  "CMakeFiles/iutiavx512fnofma.dir/__/common/main_checkfeature.c.o.d"
+  "CMakeFiles/iutiavx512fnofma.dir/iutsimd.c.o"
+  "CMakeFiles/iutiavx512fnofma.dir/iutsimd.c.o.d"
+  "CMakeFiles/iutiavx512fnofma.dir/testerutil.c.o"
+  "CMakeFiles/iutiavx512fnofma.dir/testerutil.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/iutiavx512fnofma.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,15 @@
+file(REMOVE_RECURSE
+  "../../bin/iutiavx512vl256"
+  "../../bin/iutiavx512vl256.pdb"
+  "CMakeFiles/iutiavx512vl256.dir/__/common/main_checkfeature.c.o"
+  "CMakeFiles/iutiavx512vl256.dir/__/common/main_checkfeature.c.o.d"
+  "CMakeFiles/iutiavx512vl256.dir/iutsimd.c.o"
+  "CMakeFiles/iutiavx512vl256.dir/iutsimd.c.o.d"
+  "CMakeFiles/iutiavx512vl256.dir/testerutil.c.o"
+  "CMakeFiles/iutiavx512vl256.dir/testerutil.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/iutiavx512vl256.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,15 @@
+file(REMOVE_RECURSE
+  "../../bin/iutifma4"
+  "../../bin/iutifma4.pdb"
+  "CMakeFiles/iutifma4.dir/__/common/main_checkfeature.c.o"
+  "CMakeFiles/iutifma4.dir/__/common/main_checkfeature.c.o.d"
+  "CMakeFiles/iutifma4.dir/iutsimd.c.o"
+  "CMakeFiles/iutifma4.dir/iutsimd.c.o.d"
+  "CMakeFiles/iutifma4.dir/testerutil.c.o"
+  "CMakeFiles/iutifma4.dir/testerutil.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/iutifma4.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
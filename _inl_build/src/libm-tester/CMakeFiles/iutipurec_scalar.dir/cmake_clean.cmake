@@ -0,0 +1,15 @@
+file(REMOVE_RECURSE
+  "../../bin/iutipurec_scalar"
+  "../../bin/iutipurec_scalar.pdb"
+  "CMakeFiles/iutipurec_scalar.dir/__/common/main_checkfeature.c.o"
+  "CMakeFiles/iutipurec_scalar.dir/__/common/main_checkfeature.c.o.d"
+  "CMakeFiles/iutipurec_scalar.dir/iutsimd.c.o"
+  "CMakeFiles/iutipurec_scalar.dir/iutsimd.c.o.d"
+  "CMakeFiles/iutipurec_scalar.dir/testerutil.c.o"
+  "CMakeFiles/iutipurec_scalar.dir/testerutil.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/iutipurec_scalar.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
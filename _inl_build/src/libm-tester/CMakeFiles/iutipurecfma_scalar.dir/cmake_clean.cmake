@@ -0,0 +1,15 @@
+file(REMOVE_RECURSE
+  "../../bin/iutipurecfma_scalar"
+  "../../bin/iutipurecfma_scalar.pdb"
+  "CMakeFiles/iutipurecfma_scalar.dir/__/common/main_checkfeature.c.o"
+  "CMakeFiles/iutipurecfma_scalar.dir/__/common/main_checkfeature.c.o.d"
+  "CMakeFiles/iutipurecfma_scalar.dir/iutsimd.c.o"
+  "CMakeFiles/iutipurecfma_scalar.dir/iutsimd.c.o.d"
+  "CMakeFiles/iutipurecfma_scalar.dir/testerutil.c.o"
+  "CMakeFiles/iutipurecfma_scalar.dir/testerutil.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/iutipurecfma_scalar.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
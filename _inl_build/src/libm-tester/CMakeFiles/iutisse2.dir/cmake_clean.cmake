@@ -0,0 +1,15 @@
+file(REMOVE_RECURSE
+  "../../bin/iutisse2"
+  "../../bin/iutisse2.pdb"
+  "CMakeFiles/iutisse2.dir/__/common/main_checkfeature.c.o"
+  "CMakeFiles/iutisse2.dir/__/common/main_checkfeature.c.o.d"
+  "CMakeFiles/iutisse2.dir/iutsimd.c.o"
+  "CMakeFiles/iutisse2.dir/iutsimd.c.o.d"
+  "CMakeFiles/iutisse2.dir/testerutil.c.o"
+  "CMakeFiles/iutisse2.dir/testerutil.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/iutisse2.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,15 @@
+file(REMOVE_RECURSE
+  "../../bin/iutisse4"
+  "../../bin/iutisse4.pdb"
+  "CMakeFiles/iutisse4.dir/__/common/main_checkfeature.c.o"
+  "CMakeFiles/iutisse4.dir/__/common/main_checkfeature.c.o.d"
+  "CMakeFiles/iutisse4.dir/iutsimd.c.o"
+  "CMakeFiles/iutisse4.dir/iutsimd.c.o.d"
+  "CMakeFiles/iutisse4.dir/testerutil.c.o"
+  "CMakeFiles/iutisse4.dir/testerutil.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/iutisse4.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,15 @@
+file(REMOVE_RECURSE
+  "../../bin/iutpurec_scalar"
+  "../../bin/iutpurec_scalar.pdb"
+  "CMakeFiles/iutpurec_scalar.dir/__/common/main_checkfeature.c.o"
+  "CMakeFiles/iutpurec_scalar.dir/__/common/main_checkfeature.c.o.d"
+  "CMakeFiles/iutpurec_scalar.dir/iutsimd.c.o"
+  "CMakeFiles/iutpurec_scalar.dir/iutsimd.c.o.d"
+  "CMakeFiles/iutpurec_scalar.dir/testerutil.c.o"
+  "CMakeFiles/iutpurec_scalar.dir/testerutil.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/iutpurec_scalar.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,15 @@
+file(REMOVE_RECURSE
+  "../../bin/iutpurecfma_scalar"
+  "../../bin/iutpurecfma_scalar.pdb"
+  "CMakeFiles/iutpurecfma_scalar.dir/__/common/main_checkfeature.c.o"
+  "CMakeFiles/iutpurecfma_scalar.dir/__/common/main_checkfeature.c.o.d"
+  "CMakeFiles/iutpurecfma_scalar.dir/iutsimd.c.o"
+  "CMakeFiles/iutpurecfma_scalar.dir/iutsimd.c.o.d"
+  "CMakeFiles/iutpurecfma_scalar.dir/testerutil.c.o"
+  "CMakeFiles/iutpurecfma_scalar.dir/testerutil.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/iutpurecfma_scalar.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
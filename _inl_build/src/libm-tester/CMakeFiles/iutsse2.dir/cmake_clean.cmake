@@ -0,0 +1,15 @@
+file(REMOVE_RECURSE
+  "../../bin/iutsse2"
+  "../../bin/iutsse2.pdb"
+  "CMakeFiles/iutsse2.dir/__/common/main_checkfeature.c.o"
+  "CMakeFiles/iutsse2.dir/__/common/main_checkfeature.c.o.d"
+  "CMakeFiles/iutsse2.dir/iutsimd.c.o"
+  "CMakeFiles/iutsse2.dir/iutsimd.c.o.d"
+  "CMakeFiles/iutsse2.dir/testerutil.c.o"
+  "CMakeFiles/iutsse2.dir/testerutil.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/iutsse2.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
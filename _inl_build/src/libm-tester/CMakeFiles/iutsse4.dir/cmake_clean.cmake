@@ -0,0 +1,15 @@
+file(REMOVE_RECURSE
+  "../../bin/iutsse4"
+  "../../bin/iutsse4.pdb"
+  "CMakeFiles/iutsse4.dir/__/common/main_checkfeature.c.o"
+  "CMakeFiles/iutsse4.dir/__/common/main_checkfeature.c.o.d"
+  "CMakeFiles/iutsse4.dir/iutsimd.c.o"
+  "CMakeFiles/iutsse4.dir/iutsimd.c.o.d"
+  "CMakeFiles/iutsse4.dir/testerutil.c.o"
+  "CMakeFiles/iutsse4.dir/testerutil.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/iutsse4.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
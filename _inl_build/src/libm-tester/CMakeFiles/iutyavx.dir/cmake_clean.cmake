@@ -0,0 +1,15 @@
+file(REMOVE_RECURSE
+  "../../bin/iutyavx"
+  "../../bin/iutyavx.pdb"
+  "CMakeFiles/iutyavx.dir/__/common/main_checkfeature.c.o"
+  "CMakeFiles/iutyavx.dir/__/common/main_checkfeature.c.o.d"
+  "CMakeFiles/iutyavx.dir/iutsimd.c.o"
+  "CMakeFiles/iutyavx.dir/iutsimd.c.o.d"
+  "CMakeFiles/iutyavx.dir/testerutil.c.o"
+  "CMakeFiles/iutyavx.dir/testerutil.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/iutyavx.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
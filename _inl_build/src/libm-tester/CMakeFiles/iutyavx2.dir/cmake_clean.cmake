@@ -0,0 +1,15 @@
+file(REMOVE_RECURSE
+  "../../bin/iutyavx2"
+  "../../bin/iutyavx2.pdb"
+  "CMakeFiles/iutyavx2.dir/__/common/main_checkfeature.c.o"
+  "CMakeFiles/iutyavx2.dir/__/common/main_checkfeature.c.o.d"
+  "CMakeFiles/iutyavx2.dir/iutsimd.c.o"
+  "CMakeFiles/iutyavx2.dir/iutsimd.c.o.d"
+  "CMakeFiles/iutyavx2.dir/testerutil.c.o"
+  "CMakeFiles/iutyavx2.dir/testerutil.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/iutyavx2.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
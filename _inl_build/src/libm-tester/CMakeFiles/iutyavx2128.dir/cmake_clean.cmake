@@ -0,0 +1,15 @@
+file(REMOVE_RECURSE
+  "../../bin/iutyavx2128"
+  "../../bin/iutyavx2128.pdb"
+  "CMakeFiles/iutyavx2128.dir/__/common/main_checkfeature.c.o"
+  "CMakeFiles/iutyavx2128.dir/__/common/main_checkfeature.c.o.d"
+  "CMakeFiles/iutyavx2128.dir/iutsimd.c.o"
+  "CMakeFiles/iutyavx2128.dir/iutsimd.c.o.d"
+  "CMakeFiles/iutyavx2128.dir/testerutil.c.o"
+  "CMakeFiles/iutyavx2128.dir/testerutil.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/iutyavx2128.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,15 @@
+file(REMOVE_RECURSE
+  "../../bin/iutyavx512f"
+  "../../bin/iutyavx512f.pdb"
+  "CMakeFiles/iutyavx512f.dir/__/common/main_checkfeature.c.o"
+  "CMakeFiles/iutyavx512f.dir/__/common/main_checkfeature.c.o.d"
+  "CMakeFiles/iutyavx512f.dir/iutsimd.c.o"
+  "CMakeFiles/iutyavx512f.dir/iutsimd.c.o.d"
+  "CMakeFiles/iutyavx512f.dir/testerutil.c.o"
+  "CMakeFiles/iutyavx512f.dir/testerutil.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/iutyavx512f.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,15 @@
+file(REMOVE_RECURSE
+  "../../bin/iutyavx512fnofma"
+  "../../bin/iutyavx512fnofma.pdb"
+  "CMakeFiles/iutyavx512fnofma.dir/__/common/main_checkfeature.c.o"
+  "CMakeFiles/iutyavx512fnofma.dir/__/common/main_checkfeature.c.o.d"
+  "CMakeFiles/iutyavx512fnofma.dir/iutsimd.c.o"
+  "CMakeFiles/iutyavx512fnofma.dir/iutsimd.c.o.d"
+  "CMakeFiles/iutyavx512fnofma.dir/testerutil.c.o"
+  "CMakeFiles/iutyavx512fnofma.dir/testerutil.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/iutyavx512fnofma.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
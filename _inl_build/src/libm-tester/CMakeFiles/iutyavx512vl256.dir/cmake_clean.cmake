@@ -0,0 +1,15 @@
+file(REMOVE_RECURSE
+  "../../bin/iutyavx512vl256"
+  "../../bin/iutyavx512vl256.pdb"
+  "CMakeFiles/iutyavx512vl256.dir/__/common/main_checkfeature.c.o"
+  "CMakeFiles/iutyavx512vl256.dir/__/common/main_checkfeature.c.o.d"
+  "CMakeFiles/iutyavx512vl256.dir/iutsimd.c.o"
+  "CMakeFiles/iutyavx512vl256.dir/iutsimd.c.o.d"
+  "CMakeFiles/iutyavx512vl256.dir/testerutil.c.o"
+  "CMakeFiles/iutyavx512vl256.dir/testerutil.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/iutyavx512vl256.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
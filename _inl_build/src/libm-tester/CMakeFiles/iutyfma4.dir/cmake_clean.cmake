@@ -0,0 +1,15 @@
+file(REMOVE_RECURSE
+  "../../bin/iutyfma4"
+  "../../bin/iutyfma4.pdb"
+  "CMakeFiles/iutyfma4.dir/__/common/main_checkfeature.c.o"
+  "CMakeFiles/iutyfma4.dir/__/common/main_checkfeature.c.o.d"
+  "CMakeFiles/iutyfma4.dir/iutsimd.c.o"
+  "CMakeFiles/iutyfma4.dir/iutsimd.c.o.d"
+  "CMakeFiles/iutyfma4.dir/testerutil.c.o"
+  "CMakeFiles/iutyfma4.dir/testerutil.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/iutyfma4.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,15 @@
+file(REMOVE_RECURSE
+  "../../bin/iutypurec_scalar"
+  "../../bin/iutypurec_scalar.pdb"
+  "CMakeFiles/iutypurec_scalar.dir/__/common/main_checkfeature.c.o"
+  "CMakeFiles/iutypurec_scalar.dir/__/common/main_checkfeature.c.o.d"
+  "CMakeFiles/iutypurec_scalar.dir/iutsimd.c.o"
+  "CMakeFiles/iutypurec_scalar.dir/iutsimd.c.o.d"
+  "CMakeFiles/iutypurec_scalar.dir/testerutil.c.o"
+  "CMakeFiles/iutypurec_scalar.dir/testerutil.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/iutypurec_scalar.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
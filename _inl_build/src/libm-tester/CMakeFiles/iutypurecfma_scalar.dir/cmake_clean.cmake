@@ -0,0 +1,15 @@
+file(REMOVE_RECURSE
+  "../../bin/iutypurecfma_scalar"
+  "../../bin/iutypurecfma_scalar.pdb"
+  "CMakeFiles/iutypurecfma_scalar.dir/__/common/main_checkfeature.c.o"
+  "CMakeFiles/iutypurecfma_scalar.dir/__/common/main_checkfeature.c.o.d"
+  "CMakeFiles/iutypurecfma_scalar.dir/iutsimd.c.o"
+  "CMakeFiles/iutypurecfma_scalar.dir/iutsimd.c.o.d"
+  "CMakeFiles/iutypurecfma_scalar.dir/testerutil.c.o"
+  "CMakeFiles/iutypurecfma_scalar.dir/testerutil.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/iutypurecfma_scalar.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
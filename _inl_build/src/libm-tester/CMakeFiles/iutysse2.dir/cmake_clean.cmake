@@ -0,0 +1,15 @@
+file(REMOVE_RECURSE
+  "../../bin/iutysse2"
+  "../../bin/iutysse2.pdb"
+  "CMakeFiles/iutysse2.dir/__/common/main_checkfeature.c.o"
+  "CMakeFiles/iutysse2.dir/__/common/main_checkfeature.c.o.d"
+  "CMakeFiles/iutysse2.dir/iutsimd.c.o"
+  "CMakeFiles/iutysse2.dir/iutsimd.c.o.d"
+  "CMakeFiles/iutysse2.dir/testerutil.c.o"
+  "CMakeFiles/iutysse2.dir/testerutil.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/iutysse2.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,15 @@
+file(REMOVE_RECURSE
+  "../../bin/iutysse4"
+  "../../bin/iutysse4.pdb"
+  "CMakeFiles/iutysse4.dir/__/common/main_checkfeature.c.o"
+  "CMakeFiles/iutysse4.dir/__/common/main_checkfeature.c.o.d"
+  "CMakeFiles/iutysse4.dir/iutsimd.c.o"
+  "CMakeFiles/iutysse4.dir/iutsimd.c.o.d"
+  "CMakeFiles/iutysse4.dir/testerutil.c.o"
+  "CMakeFiles/iutysse4.dir/testerutil.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/iutysse4.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
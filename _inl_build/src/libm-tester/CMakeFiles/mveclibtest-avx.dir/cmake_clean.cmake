@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "../../bin/mveclibtest-avx"
+  "../../bin/mveclibtest-avx.pdb"
+  "CMakeFiles/mveclibtest-avx.dir/__/common/main_checkfeature.c.o"
+  "CMakeFiles/mveclibtest-avx.dir/__/common/main_checkfeature.c.o.d"
+  "CMakeFiles/mveclibtest-avx.dir/mveclibtest.c.o"
+  "CMakeFiles/mveclibtest-avx.dir/mveclibtest.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/mveclibtest-avx.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
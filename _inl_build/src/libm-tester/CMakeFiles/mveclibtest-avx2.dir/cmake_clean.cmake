@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "../../bin/mveclibtest-avx2"
+  "../../bin/mveclibtest-avx2.pdb"
+  "CMakeFiles/mveclibtest-avx2.dir/__/common/main_checkfeature.c.o"
+  "CMakeFiles/mveclibtest-avx2.dir/__/common/main_checkfeature.c.o.d"
+  "CMakeFiles/mveclibtest-avx2.dir/mveclibtest.c.o"
+  "CMakeFiles/mveclibtest-avx2.dir/mveclibtest.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/mveclibtest-avx2.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
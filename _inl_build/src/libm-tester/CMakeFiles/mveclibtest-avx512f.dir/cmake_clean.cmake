@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "../../bin/mveclibtest-avx512f"
+  "../../bin/mveclibtest-avx512f.pdb"
+  "CMakeFiles/mveclibtest-avx512f.dir/__/common/main_checkfeature.c.o"
+  "CMakeFiles/mveclibtest-avx512f.dir/__/common/main_checkfeature.c.o.d"
+  "CMakeFiles/mveclibtest-avx512f.dir/mveclibtest.c.o"
+  "CMakeFiles/mveclibtest-avx512f.dir/mveclibtest.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/mveclibtest-avx512f.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
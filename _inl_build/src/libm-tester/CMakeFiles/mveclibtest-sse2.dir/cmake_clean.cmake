@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "../../bin/mveclibtest-sse2"
+  "../../bin/mveclibtest-sse2.pdb"
+  "CMakeFiles/mveclibtest-sse2.dir/__/common/main_checkfeature.c.o"
+  "CMakeFiles/mveclibtest-sse2.dir/__/common/main_checkfeature.c.o.d"
+  "CMakeFiles/mveclibtest-sse2.dir/mveclibtest.c.o"
+  "CMakeFiles/mveclibtest-sse2.dir/mveclibtest.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/mveclibtest-sse2.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,15 @@
+file(REMOVE_RECURSE
+  "../../bin/tester3avx"
+  "../../bin/tester3avx.pdb"
+  "CMakeFiles/tester3avx.dir/__/common/main_checkfeature.c.o"
+  "CMakeFiles/tester3avx.dir/__/common/main_checkfeature.c.o.d"
+  "CMakeFiles/tester3avx.dir/tester3.c.o"
+  "CMakeFiles/tester3avx.dir/tester3.c.o.d"
+  "CMakeFiles/tester3avx.dir/testerutil.c.o"
+  "CMakeFiles/tester3avx.dir/testerutil.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/tester3avx.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,22 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/common/main_checkfeature.c" "src/libm-tester/CMakeFiles/tester3avx512f.dir/__/common/main_checkfeature.c.o" "gcc" "src/libm-tester/CMakeFiles/tester3avx512f.dir/__/common/main_checkfeature.c.o.d"
+  "/root/repo/src/libm-tester/tester3.c" "src/libm-tester/CMakeFiles/tester3avx512f.dir/tester3.c.o" "gcc" "src/libm-tester/CMakeFiles/tester3avx512f.dir/tester3.c.o.d"
+  "/root/repo/src/libm-tester/testerutil.c" "src/libm-tester/CMakeFiles/tester3avx512f.dir/testerutil.c.o" "gcc" "src/libm-tester/CMakeFiles/tester3avx512f.dir/testerutil.c.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_inl_build/src/libm/CMakeFiles/sleef.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,15 @@
+file(REMOVE_RECURSE
+  "../../bin/tester3purecfma_scalar"
+  "../../bin/tester3purecfma_scalar.pdb"
+  "CMakeFiles/tester3purecfma_scalar.dir/__/common/main_checkfeature.c.o"
+  "CMakeFiles/tester3purecfma_scalar.dir/__/common/main_checkfeature.c.o.d"
+  "CMakeFiles/tester3purecfma_scalar.dir/tester3.c.o"
+  "CMakeFiles/tester3purecfma_scalar.dir/tester3.c.o.d"
+  "CMakeFiles/tester3purecfma_scalar.dir/testerutil.c.o"
+  "CMakeFiles/tester3purecfma_scalar.dir/testerutil.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/tester3purecfma_scalar.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
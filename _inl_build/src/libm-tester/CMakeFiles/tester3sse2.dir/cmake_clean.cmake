@@ -0,0 +1,15 @@
+file(REMOVE_RECURSE
+  "../../bin/tester3sse2"
+  "../../bin/tester3sse2.pdb"
+  "CMakeFiles/tester3sse2.dir/__/common/main_checkfeature.c.o"
+  "CMakeFiles/tester3sse2.dir/__/common/main_checkfeature.c.o.d"
+  "CMakeFiles/tester3sse2.dir/tester3.c.o"
+  "CMakeFiles/tester3sse2.dir/tester3.c.o.d"
+  "CMakeFiles/tester3sse2.dir/testerutil.c.o"
+  "CMakeFiles/tester3sse2.dir/testerutil.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/tester3sse2.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
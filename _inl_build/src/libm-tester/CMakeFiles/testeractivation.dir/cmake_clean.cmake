@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../bin/testeractivation"
+  "../../bin/testeractivation.pdb"
+  "CMakeFiles/testeractivation.dir/testeractivation.c.o"
+  "CMakeFiles/testeractivation.dir/testeractivation.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/testeractivation.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
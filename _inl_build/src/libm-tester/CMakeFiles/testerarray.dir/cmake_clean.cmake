@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../bin/testerarray"
+  "../../bin/testerarray.pdb"
+  "CMakeFiles/testerarray.dir/testerarray.c.o"
+  "CMakeFiles/testerarray.dir/testerarray.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/testerarray.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
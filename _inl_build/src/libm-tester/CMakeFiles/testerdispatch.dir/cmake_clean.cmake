@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../bin/testerdispatch"
+  "../../bin/testerdispatch.pdb"
+  "CMakeFiles/testerdispatch.dir/testerdispatch.c.o"
+  "CMakeFiles/testerdispatch.dir/testerdispatch.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/testerdispatch.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
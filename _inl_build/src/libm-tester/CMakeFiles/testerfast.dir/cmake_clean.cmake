@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../bin/testerfast"
+  "../../bin/testerfast.pdb"
+  "CMakeFiles/testerfast.dir/testerfast.c.o"
+  "CMakeFiles/testerfast.dir/testerfast.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/testerfast.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "../../bin/testerhalf"
+  "../../bin/testerhalf.pdb"
+  "CMakeFiles/testerhalf.dir/__/common/main_checkfeature.c.o"
+  "CMakeFiles/testerhalf.dir/__/common/main_checkfeature.c.o.d"
+  "CMakeFiles/testerhalf.dir/testerhalf.c.o"
+  "CMakeFiles/testerhalf.dir/testerhalf.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/testerhalf.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
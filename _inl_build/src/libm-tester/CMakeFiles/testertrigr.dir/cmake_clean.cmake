@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../bin/testertrigr"
+  "../../bin/testertrigr.pdb"
+  "CMakeFiles/testertrigr.dir/testertrigr.c.o"
+  "CMakeFiles/testertrigr.dir/testertrigr.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/testertrigr.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
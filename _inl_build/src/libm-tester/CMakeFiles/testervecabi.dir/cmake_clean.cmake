@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../bin/testervecabi"
+  "../../bin/testervecabi.pdb"
+  "CMakeFiles/testervecabi.dir/testervecabi.c.o"
+  "CMakeFiles/testervecabi.dir/testervecabi.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/testervecabi.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
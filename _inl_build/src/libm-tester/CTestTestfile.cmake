@@ -0,0 +1,70 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/src/libm-tester
+# Build directory: /root/repo/_inl_build/src/libm-tester
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(testerarray "/root/repo/_inl_build/bin/testerarray")
+set_tests_properties(testerarray PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/src/libm-tester/CMakeLists.txt;140;add_test;/root/repo/src/libm-tester/CMakeLists.txt;0;")
+add_test(testeractivation "/root/repo/_inl_build/bin/testeractivation")
+set_tests_properties(testeractivation PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/src/libm-tester/CMakeLists.txt;152;add_test;/root/repo/src/libm-tester/CMakeLists.txt;0;")
+add_test(testerfast "/root/repo/_inl_build/bin/testerfast")
+set_tests_properties(testerfast PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/src/libm-tester/CMakeLists.txt;164;add_test;/root/repo/src/libm-tester/CMakeLists.txt;0;")
+add_test(testertrigr "/root/repo/_inl_build/bin/testertrigr")
+set_tests_properties(testertrigr PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/src/libm-tester/CMakeLists.txt;176;add_test;/root/repo/src/libm-tester/CMakeLists.txt;0;")
+add_test(testerhalf "/root/repo/_inl_build/bin/testerhalf")
+set_tests_properties(testerhalf PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/src/libm-tester/CMakeLists.txt;192;add_test;/root/repo/src/libm-tester/CMakeLists.txt;0;")
+add_test(testerdispatch "/root/repo/_inl_build/bin/testerdispatch")
+set_tests_properties(testerdispatch PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/src/libm-tester/CMakeLists.txt;206;add_test;/root/repo/src/libm-tester/CMakeLists.txt;0;")
+add_test(testerdispatch_env "/root/repo/_inl_build/bin/testerdispatch" "purec")
+set_tests_properties(testerdispatch_env PROPERTIES  ENVIRONMENT "SLEEF_DISPATCH=purec;LD_BIND_NOW=1" _BACKTRACE_TRIPLES "/root/repo/src/libm-tester/CMakeLists.txt;207;add_test;/root/repo/src/libm-tester/CMakeLists.txt;0;")
+add_test(tester3avx512fnofma "/root/repo/_inl_build/bin/tester3avx512fnofma" "/root/repo/src/libm-tester/hash_cinz.txt")
+set_tests_properties(tester3avx512fnofma PROPERTIES  COST "10" _BACKTRACE_TRIPLES "/root/repo/src/libm-tester/CMakeLists.txt;362;add_test;/root/repo/src/libm-tester/CMakeLists.txt;391;test_extension;/root/repo/src/libm-tester/CMakeLists.txt;0;")
+add_test(tester3avx512f "/root/repo/_inl_build/bin/tester3avx512f" "/root/repo/src/libm-tester/hash_finz.txt")
+set_tests_properties(tester3avx512f PROPERTIES  COST "10" _BACKTRACE_TRIPLES "/root/repo/src/libm-tester/CMakeLists.txt;378;add_test;/root/repo/src/libm-tester/CMakeLists.txt;391;test_extension;/root/repo/src/libm-tester/CMakeLists.txt;0;")
+add_test(tester3avx512vl256 "/root/repo/_inl_build/bin/tester3avx512vl256" "/root/repo/src/libm-tester/hash_finz.txt")
+set_tests_properties(tester3avx512vl256 PROPERTIES  COST "0.5" _BACKTRACE_TRIPLES "/root/repo/src/libm-tester/CMakeLists.txt;378;add_test;/root/repo/src/libm-tester/CMakeLists.txt;391;test_extension;/root/repo/src/libm-tester/CMakeLists.txt;0;")
+add_test(tester3avx2 "/root/repo/_inl_build/bin/tester3avx2" "/root/repo/src/libm-tester/hash_finz.txt")
+set_tests_properties(tester3avx2 PROPERTIES  COST "2" _BACKTRACE_TRIPLES "/root/repo/src/libm-tester/CMakeLists.txt;378;add_test;/root/repo/src/libm-tester/CMakeLists.txt;391;test_extension;/root/repo/src/libm-tester/CMakeLists.txt;0;")
+add_test(tester3avx2128 "/root/repo/_inl_build/bin/tester3avx2128" "/root/repo/src/libm-tester/hash_finz.txt")
+set_tests_properties(tester3avx2128 PROPERTIES  COST "0.5" _BACKTRACE_TRIPLES "/root/repo/src/libm-tester/CMakeLists.txt;378;add_test;/root/repo/src/libm-tester/CMakeLists.txt;391;test_extension;/root/repo/src/libm-tester/CMakeLists.txt;0;")
+add_test(tester3avx "/root/repo/_inl_build/bin/tester3avx" "/root/repo/src/libm-tester/hash_cinz.txt")
+set_tests_properties(tester3avx PROPERTIES  COST "2" _BACKTRACE_TRIPLES "/root/repo/src/libm-tester/CMakeLists.txt;362;add_test;/root/repo/src/libm-tester/CMakeLists.txt;391;test_extension;/root/repo/src/libm-tester/CMakeLists.txt;0;")
+add_test(tester3sse4 "/root/repo/_inl_build/bin/tester3sse4" "/root/repo/src/libm-tester/hash_cinz.txt")
+set_tests_properties(tester3sse4 PROPERTIES  COST "0.5" _BACKTRACE_TRIPLES "/root/repo/src/libm-tester/CMakeLists.txt;362;add_test;/root/repo/src/libm-tester/CMakeLists.txt;391;test_extension;/root/repo/src/libm-tester/CMakeLists.txt;0;")
+add_test(tester3sse2 "/root/repo/_inl_build/bin/tester3sse2" "/root/repo/src/libm-tester/hash_cinz.txt")
+set_tests_properties(tester3sse2 PROPERTIES  COST "0.5" _BACKTRACE_TRIPLES "/root/repo/src/libm-tester/CMakeLists.txt;362;add_test;/root/repo/src/libm-tester/CMakeLists.txt;391;test_extension;/root/repo/src/libm-tester/CMakeLists.txt;0;")
+add_test(tester3purec_scalar "/root/repo/_inl_build/bin/tester3purec_scalar" "/root/repo/src/libm-tester/hash_cinz.txt")
+set_tests_properties(tester3purec_scalar PROPERTIES  COST "0.5" _BACKTRACE_TRIPLES "/root/repo/src/libm-tester/CMakeLists.txt;362;add_test;/root/repo/src/libm-tester/CMakeLists.txt;391;test_extension;/root/repo/src/libm-tester/CMakeLists.txt;0;")
+add_test(tester3purecfma_scalar "/root/repo/_inl_build/bin/tester3purecfma_scalar" "/root/repo/src/libm-tester/hash_finz.txt")
+set_tests_properties(tester3purecfma_scalar PROPERTIES  COST "0.5" _BACKTRACE_TRIPLES "/root/repo/src/libm-tester/CMakeLists.txt;378;add_test;/root/repo/src/libm-tester/CMakeLists.txt;391;test_extension;/root/repo/src/libm-tester/CMakeLists.txt;0;")
+add_test(gnuabi_compatibility_SSE2 "/root/repo/_inl_build/bin/gnuabi_compatibility_SSE2")
+set_tests_properties(gnuabi_compatibility_SSE2 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/src/libm-tester/CMakeLists.txt;426;add_test;/root/repo/src/libm-tester/CMakeLists.txt;435;add_gnuabi_compatibility_test;/root/repo/src/libm-tester/CMakeLists.txt;0;")
+add_test(gnuabi_compatibility_SSE2_masked "/root/repo/_inl_build/bin/gnuabi_compatibility_SSE2_masked")
+set_tests_properties(gnuabi_compatibility_SSE2_masked PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/src/libm-tester/CMakeLists.txt;426;add_test;/root/repo/src/libm-tester/CMakeLists.txt;438;add_gnuabi_compatibility_test;/root/repo/src/libm-tester/CMakeLists.txt;0;")
+add_test(gnuabi_compatibility_AVX "/root/repo/_inl_build/bin/gnuabi_compatibility_AVX")
+set_tests_properties(gnuabi_compatibility_AVX PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/src/libm-tester/CMakeLists.txt;426;add_test;/root/repo/src/libm-tester/CMakeLists.txt;435;add_gnuabi_compatibility_test;/root/repo/src/libm-tester/CMakeLists.txt;0;")
+add_test(gnuabi_compatibility_AVX_masked "/root/repo/_inl_build/bin/gnuabi_compatibility_AVX_masked")
+set_tests_properties(gnuabi_compatibility_AVX_masked PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/src/libm-tester/CMakeLists.txt;426;add_test;/root/repo/src/libm-tester/CMakeLists.txt;438;add_gnuabi_compatibility_test;/root/repo/src/libm-tester/CMakeLists.txt;0;")
+add_test(gnuabi_compatibility_AVX2 "/root/repo/_inl_build/bin/gnuabi_compatibility_AVX2")
+set_tests_properties(gnuabi_compatibility_AVX2 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/src/libm-tester/CMakeLists.txt;426;add_test;/root/repo/src/libm-tester/CMakeLists.txt;435;add_gnuabi_compatibility_test;/root/repo/src/libm-tester/CMakeLists.txt;0;")
+add_test(gnuabi_compatibility_AVX2_masked "/root/repo/_inl_build/bin/gnuabi_compatibility_AVX2_masked")
+set_tests_properties(gnuabi_compatibility_AVX2_masked PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/src/libm-tester/CMakeLists.txt;426;add_test;/root/repo/src/libm-tester/CMakeLists.txt;438;add_gnuabi_compatibility_test;/root/repo/src/libm-tester/CMakeLists.txt;0;")
+add_test(gnuabi_compatibility_AVX512VL256 "/root/repo/_inl_build/bin/gnuabi_compatibility_AVX512VL256")
+set_tests_properties(gnuabi_compatibility_AVX512VL256 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/src/libm-tester/CMakeLists.txt;426;add_test;/root/repo/src/libm-tester/CMakeLists.txt;435;add_gnuabi_compatibility_test;/root/repo/src/libm-tester/CMakeLists.txt;0;")
+add_test(gnuabi_compatibility_AVX512VL256_masked "/root/repo/_inl_build/bin/gnuabi_compatibility_AVX512VL256_masked")
+set_tests_properties(gnuabi_compatibility_AVX512VL256_masked PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/src/libm-tester/CMakeLists.txt;426;add_test;/root/repo/src/libm-tester/CMakeLists.txt;438;add_gnuabi_compatibility_test;/root/repo/src/libm-tester/CMakeLists.txt;0;")
+add_test(gnuabi_compatibility_AVX512F "/root/repo/_inl_build/bin/gnuabi_compatibility_AVX512F")
+set_tests_properties(gnuabi_compatibility_AVX512F PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/src/libm-tester/CMakeLists.txt;426;add_test;/root/repo/src/libm-tester/CMakeLists.txt;435;add_gnuabi_compatibility_test;/root/repo/src/libm-tester/CMakeLists.txt;0;")
+add_test(gnuabi_compatibility_AVX512F_masked "/root/repo/_inl_build/bin/gnuabi_compatibility_AVX512F_masked")
+set_tests_properties(gnuabi_compatibility_AVX512F_masked PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/src/libm-tester/CMakeLists.txt;426;add_test;/root/repo/src/libm-tester/CMakeLists.txt;438;add_gnuabi_compatibility_test;/root/repo/src/libm-tester/CMakeLists.txt;0;")
+add_test(testervecabi "/root/repo/_inl_build/bin/testervecabi")
+set_tests_properties(testervecabi PROPERTIES  WORKING_DIRECTORY "/root/repo/_inl_build/bin" _BACKTRACE_TRIPLES "/root/repo/src/libm-tester/CMakeLists.txt;539;add_test;/root/repo/src/libm-tester/CMakeLists.txt;0;")
+add_test(mveclibtest-sse2 "/root/repo/_inl_build/bin/mveclibtest-sse2")
+set_tests_properties(mveclibtest-sse2 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/src/libm-tester/CMakeLists.txt;551;add_test;/root/repo/src/libm-tester/CMakeLists.txt;0;")
+add_test(mveclibtest-avx "/root/repo/_inl_build/bin/mveclibtest-avx")
+set_tests_properties(mveclibtest-avx PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/src/libm-tester/CMakeLists.txt;558;add_test;/root/repo/src/libm-tester/CMakeLists.txt;0;")
+add_test(mveclibtest-avx2 "/root/repo/_inl_build/bin/mveclibtest-avx2")
+set_tests_properties(mveclibtest-avx2 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/src/libm-tester/CMakeLists.txt;565;add_test;/root/repo/src/libm-tester/CMakeLists.txt;0;")
+add_test(mveclibtest-avx512f "/root/repo/_inl_build/bin/mveclibtest-avx512f")
+set_tests_properties(mveclibtest-avx512f PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/src/libm-tester/CMakeLists.txt;572;add_test;/root/repo/src/libm-tester/CMakeLists.txt;0;")
@@ -0,0 +1,8 @@
+file(REMOVE_RECURSE
+  "include/alias_avx512f.h"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/alias_avx512f.h_generated.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,8 @@
+file(REMOVE_RECURSE
+  "disparray.c"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/disparray.c_generated.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,10 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/disparray_obj.dir/disparray.c.o"
+  "CMakeFiles/disparray_obj.dir/disparray.c.o.d"
+  "disparray.c"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/disparray_obj.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,10 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/dispavx_obj.dir/dispavx.c.o"
+  "CMakeFiles/dispavx_obj.dir/dispavx.c.o.d"
+  "dispavx.c"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/dispavx_obj.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,8 @@
+file(REMOVE_RECURSE
+  "dispscalar.c"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/dispscalar.c_generated.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
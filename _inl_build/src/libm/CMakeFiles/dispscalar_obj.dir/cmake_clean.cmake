@@ -0,0 +1,10 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/dispscalar_obj.dir/dispscalar.c.o"
+  "CMakeFiles/dispscalar_obj.dir/dispscalar.c.o.d"
+  "dispscalar.c"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/dispscalar_obj.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,10 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/dispsse_obj.dir/dispsse.c.o"
+  "CMakeFiles/dispsse_obj.dir/dispsse.c.o.d"
+  "dispsse.c"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/dispsse_obj.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
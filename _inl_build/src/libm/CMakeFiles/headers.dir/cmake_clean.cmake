@@ -0,0 +1,26 @@
+file(REMOVE_RECURSE
+  "../../include/sleef.h"
+  "CMakeFiles/headers"
+  "include/renameavx.h"
+  "include/renameavx2.h"
+  "include/renameavx2128.h"
+  "include/renameavx2_gnuabi.h"
+  "include/renameavx512f.h"
+  "include/renameavx512f_gnuabi.h"
+  "include/renameavx512fnofma.h"
+  "include/renameavx512vl256.h"
+  "include/renameavx512vl256_gnuabi.h"
+  "include/renameavx_gnuabi.h"
+  "include/renamecuda.h"
+  "include/renamefma4.h"
+  "include/renamepurec_scalar.h"
+  "include/renamepurecfma_scalar.h"
+  "include/renamesse2.h"
+  "include/renamesse2_gnuabi.h"
+  "include/renamesse4.h"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/headers.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,32 @@
+file(REMOVE_RECURSE
+  "../../include/sleefinline_avx.h"
+  "../../include/sleefinline_avx2.h"
+  "../../include/sleefinline_avx2128.h"
+  "../../include/sleefinline_avx512f.h"
+  "../../include/sleefinline_avx512fnofma.h"
+  "../../include/sleefinline_avx512vl256.h"
+  "../../include/sleefinline_cuda.h"
+  "../../include/sleefinline_fma4.h"
+  "../../include/sleefinline_purec_scalar.h"
+  "../../include/sleefinline_purecfma_scalar.h"
+  "../../include/sleefinline_sse2.h"
+  "../../include/sleefinline_sse4.h"
+  "CMakeFiles/inline_headers_util"
+  "include/renameavx.h"
+  "include/renameavx2.h"
+  "include/renameavx2128.h"
+  "include/renameavx512f.h"
+  "include/renameavx512fnofma.h"
+  "include/renameavx512vl256.h"
+  "include/renamecuda.h"
+  "include/renamefma4.h"
+  "include/renamepurec_scalar.h"
+  "include/renamepurecfma_scalar.h"
+  "include/renamesse2.h"
+  "include/renamesse4.h"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/inline_headers_util.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,10 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/maskedAVX512VL256_generated"
+  "include/masked_avx512vl256_dp_gnuabi.h"
+  "include/masked_avx512vl256_sp_gnuabi.h"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/maskedAVX512VL256_generated.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,10 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/maskedAVX_generated"
+  "include/masked_avx_dp_gnuabi.h"
+  "include/masked_avx_sp_gnuabi.h"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/maskedAVX_generated.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,10 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/maskedSSE2_generated"
+  "include/masked_sse2_dp_gnuabi.h"
+  "include/masked_sse2_sp_gnuabi.h"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/maskedSSE2_generated.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../bin/mkalias"
+  "../../bin/mkalias.pdb"
+  "CMakeFiles/mkalias.dir/mkalias.c.o"
+  "CMakeFiles/mkalias.dir/mkalias.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/mkalias.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
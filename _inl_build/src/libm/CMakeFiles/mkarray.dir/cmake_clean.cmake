@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../bin/mkarray"
+  "../../bin/mkarray.pdb"
+  "CMakeFiles/mkarray.dir/mkarray.c.o"
+  "CMakeFiles/mkarray.dir/mkarray.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/mkarray.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../bin/mkdisp"
+  "../../bin/mkdisp.pdb"
+  "CMakeFiles/mkdisp.dir/mkdisp.c.o"
+  "CMakeFiles/mkdisp.dir/mkdisp.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/mkdisp.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../bin/mkmasked_gnuabi"
+  "../../bin/mkmasked_gnuabi.pdb"
+  "CMakeFiles/mkmasked_gnuabi.dir/mkmasked_gnuabi.c.o"
+  "CMakeFiles/mkmasked_gnuabi.dir/mkmasked_gnuabi.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/mkmasked_gnuabi.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../bin/mkrename"
+  "../../bin/mkrename.pdb"
+  "CMakeFiles/mkrename.dir/mkrename.c.o"
+  "CMakeFiles/mkrename.dir/mkrename.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/mkrename.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../bin/mkrename_gnuabi"
+  "../../bin/mkrename_gnuabi.pdb"
+  "CMakeFiles/mkrename_gnuabi.dir/mkrename_gnuabi.c.o"
+  "CMakeFiles/mkrename_gnuabi.dir/mkrename_gnuabi.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/mkrename_gnuabi.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
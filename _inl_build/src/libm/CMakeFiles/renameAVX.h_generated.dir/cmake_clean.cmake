@@ -0,0 +1,9 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/renameAVX.h_generated"
+  "include/renameavx.h"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/renameAVX.h_generated.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
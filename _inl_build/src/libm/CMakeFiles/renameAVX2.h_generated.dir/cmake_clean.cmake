@@ -0,0 +1,9 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/renameAVX2.h_generated"
+  "include/renameavx2.h"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/renameAVX2.h_generated.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
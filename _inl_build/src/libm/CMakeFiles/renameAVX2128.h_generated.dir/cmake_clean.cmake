@@ -0,0 +1,9 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/renameAVX2128.h_generated"
+  "include/renameavx2128.h"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/renameAVX2128.h_generated.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
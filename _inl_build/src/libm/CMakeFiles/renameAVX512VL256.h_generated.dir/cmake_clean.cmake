@@ -0,0 +1,9 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/renameAVX512VL256.h_generated"
+  "include/renameavx512vl256.h"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/renameAVX512VL256.h_generated.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
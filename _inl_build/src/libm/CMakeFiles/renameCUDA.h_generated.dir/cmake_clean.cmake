@@ -0,0 +1,9 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/renameCUDA.h_generated"
+  "include/renamecuda.h"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/renameCUDA.h_generated.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
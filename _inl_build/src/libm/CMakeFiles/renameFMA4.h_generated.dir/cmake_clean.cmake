@@ -0,0 +1,9 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/renameFMA4.h_generated"
+  "include/renamefma4.h"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/renameFMA4.h_generated.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,9 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/renamePURECFMA_SCALAR.h_generated"
+  "include/renamepurecfma_scalar.h"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/renamePURECFMA_SCALAR.h_generated.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,9 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/renamePUREC_SCALAR.h_generated"
+  "include/renamepurec_scalar.h"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/renamePUREC_SCALAR.h_generated.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
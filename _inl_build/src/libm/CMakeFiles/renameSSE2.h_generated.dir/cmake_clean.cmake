@@ -0,0 +1,9 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/renameSSE2.h_generated"
+  "include/renamesse2.h"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/renameSSE2.h_generated.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
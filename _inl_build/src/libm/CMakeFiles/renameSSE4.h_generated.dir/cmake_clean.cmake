@@ -0,0 +1,9 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/renameSSE4.h_generated"
+  "include/renamesse4.h"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/renameSSE4.h_generated.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
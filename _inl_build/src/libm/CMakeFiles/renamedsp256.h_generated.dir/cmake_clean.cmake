@@ -0,0 +1,8 @@
+file(REMOVE_RECURSE
+  "include/renamedsp256.h"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/renamedsp256.h_generated.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
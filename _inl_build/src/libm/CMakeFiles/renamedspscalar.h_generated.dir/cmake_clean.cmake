@@ -0,0 +1,8 @@
+file(REMOVE_RECURSE
+  "include/renamedspscalar.h"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/renamedspscalar.h_generated.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "../../lib/libsleef.pdb"
+  "../../lib/libsleef.so"
+  "../../lib/libsleef.so.3"
+  "../../lib/libsleef.so.3.6.0"
+  "CMakeFiles/sleef.dir/rempitab.c.o"
+  "CMakeFiles/sleef.dir/rempitab.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/sleef.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
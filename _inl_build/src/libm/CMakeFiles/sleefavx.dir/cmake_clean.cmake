@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "../../include/sleefinline_avx.h"
+  "CMakeFiles/sleefavx.dir/sleefsimddp.c.o"
+  "CMakeFiles/sleefavx.dir/sleefsimddp.c.o.d"
+  "CMakeFiles/sleefavx.dir/sleefsimdsp.c.o"
+  "CMakeFiles/sleefavx.dir/sleefsimdsp.c.o.d"
+  "include/renameavx.h"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/sleefavx.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "../../include/sleefinline_avx2.h"
+  "CMakeFiles/sleefavx2.dir/sleefsimddp.c.o"
+  "CMakeFiles/sleefavx2.dir/sleefsimddp.c.o.d"
+  "CMakeFiles/sleefavx2.dir/sleefsimdsp.c.o"
+  "CMakeFiles/sleefavx2.dir/sleefsimdsp.c.o.d"
+  "include/renameavx2.h"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/sleefavx2.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "../../include/sleefinline_avx2128.h"
+  "CMakeFiles/sleefavx2128.dir/sleefsimddp.c.o"
+  "CMakeFiles/sleefavx2128.dir/sleefsimddp.c.o.d"
+  "CMakeFiles/sleefavx2128.dir/sleefsimdsp.c.o"
+  "CMakeFiles/sleefavx2128.dir/sleefsimdsp.c.o.d"
+  "include/renameavx2128.h"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/sleefavx2128.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
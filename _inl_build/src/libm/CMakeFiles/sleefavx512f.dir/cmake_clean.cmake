@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "../../include/sleefinline_avx512f.h"
+  "CMakeFiles/sleefavx512f.dir/sleefsimddp.c.o"
+  "CMakeFiles/sleefavx512f.dir/sleefsimddp.c.o.d"
+  "CMakeFiles/sleefavx512f.dir/sleefsimdsp.c.o"
+  "CMakeFiles/sleefavx512f.dir/sleefsimdsp.c.o.d"
+  "include/renameavx512f.h"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/sleefavx512f.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "../../include/sleefinline_avx512fnofma.h"
+  "CMakeFiles/sleefavx512fnofma.dir/sleefsimddp.c.o"
+  "CMakeFiles/sleefavx512fnofma.dir/sleefsimddp.c.o.d"
+  "CMakeFiles/sleefavx512fnofma.dir/sleefsimdsp.c.o"
+  "CMakeFiles/sleefavx512fnofma.dir/sleefsimdsp.c.o.d"
+  "include/renameavx512fnofma.h"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/sleefavx512fnofma.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
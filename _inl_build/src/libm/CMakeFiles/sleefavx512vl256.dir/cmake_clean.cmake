@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "../../include/sleefinline_avx512vl256.h"
+  "CMakeFiles/sleefavx512vl256.dir/sleefsimddp.c.o"
+  "CMakeFiles/sleefavx512vl256.dir/sleefsimddp.c.o.d"
+  "CMakeFiles/sleefavx512vl256.dir/sleefsimdsp.c.o"
+  "CMakeFiles/sleefavx512vl256.dir/sleefsimdsp.c.o.d"
+  "include/renameavx512vl256.h"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/sleefavx512vl256.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
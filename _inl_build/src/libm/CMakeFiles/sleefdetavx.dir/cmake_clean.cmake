@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "../../include/sleefinline_avx.h"
+  "CMakeFiles/sleefdetavx.dir/sleefsimddp.c.o"
+  "CMakeFiles/sleefdetavx.dir/sleefsimddp.c.o.d"
+  "CMakeFiles/sleefdetavx.dir/sleefsimdsp.c.o"
+  "CMakeFiles/sleefdetavx.dir/sleefsimdsp.c.o.d"
+  "include/renameavx.h"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/sleefdetavx.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
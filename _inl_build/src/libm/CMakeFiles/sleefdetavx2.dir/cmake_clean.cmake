@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "../../include/sleefinline_avx2.h"
+  "CMakeFiles/sleefdetavx2.dir/sleefsimddp.c.o"
+  "CMakeFiles/sleefdetavx2.dir/sleefsimddp.c.o.d"
+  "CMakeFiles/sleefdetavx2.dir/sleefsimdsp.c.o"
+  "CMakeFiles/sleefdetavx2.dir/sleefsimdsp.c.o.d"
+  "include/renameavx2.h"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/sleefdetavx2.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
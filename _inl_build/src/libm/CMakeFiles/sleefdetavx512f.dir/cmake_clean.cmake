@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "../../include/sleefinline_avx512f.h"
+  "CMakeFiles/sleefdetavx512f.dir/sleefsimddp.c.o"
+  "CMakeFiles/sleefdetavx512f.dir/sleefsimddp.c.o.d"
+  "CMakeFiles/sleefdetavx512f.dir/sleefsimdsp.c.o"
+  "CMakeFiles/sleefdetavx512f.dir/sleefsimdsp.c.o.d"
+  "include/renameavx512f.h"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/sleefdetavx512f.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
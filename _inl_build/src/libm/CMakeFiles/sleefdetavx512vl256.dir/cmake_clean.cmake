@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "../../include/sleefinline_avx512vl256.h"
+  "CMakeFiles/sleefdetavx512vl256.dir/sleefsimddp.c.o"
+  "CMakeFiles/sleefdetavx512vl256.dir/sleefsimddp.c.o.d"
+  "CMakeFiles/sleefdetavx512vl256.dir/sleefsimdsp.c.o"
+  "CMakeFiles/sleefdetavx512vl256.dir/sleefsimdsp.c.o.d"
+  "include/renameavx512vl256.h"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/sleefdetavx512vl256.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "../../include/sleefinline_purecfma_scalar.h"
+  "CMakeFiles/sleefdetpurecfma_scalar.dir/sleefsimddp.c.o"
+  "CMakeFiles/sleefdetpurecfma_scalar.dir/sleefsimddp.c.o.d"
+  "CMakeFiles/sleefdetpurecfma_scalar.dir/sleefsimdsp.c.o"
+  "CMakeFiles/sleefdetpurecfma_scalar.dir/sleefsimdsp.c.o.d"
+  "include/renamepurecfma_scalar.h"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/sleefdetpurecfma_scalar.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
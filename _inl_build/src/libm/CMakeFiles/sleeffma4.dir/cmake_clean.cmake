@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "../../include/sleefinline_fma4.h"
+  "CMakeFiles/sleeffma4.dir/sleefsimddp.c.o"
+  "CMakeFiles/sleeffma4.dir/sleefsimddp.c.o.d"
+  "CMakeFiles/sleeffma4.dir/sleefsimdsp.c.o"
+  "CMakeFiles/sleeffma4.dir/sleefsimdsp.c.o.d"
+  "include/renamefma4.h"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/sleeffma4.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,26 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/libm/rempitab.c" "src/libm/CMakeFiles/sleefgnuabi.dir/rempitab.c.o" "gcc" "src/libm/CMakeFiles/sleefgnuabi.dir/rempitab.c.o.d"
+  )
+
+# Pairs of files generated by the same build rule.
+set(CMAKE_MULTIPLE_OUTPUT_PAIRS
+  "/root/repo/_inl_build/lib/libsleefgnuabi.so" "/root/repo/_inl_build/lib/libsleefgnuabi.so.3.6"
+  "/root/repo/_inl_build/lib/libsleefgnuabi.so.3" "/root/repo/_inl_build/lib/libsleefgnuabi.so.3.6"
+  )
+
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "../../lib/libsleefgnuabi.pdb"
+  "../../lib/libsleefgnuabi.so"
+  "../../lib/libsleefgnuabi.so.3"
+  "../../lib/libsleefgnuabi.so.3.6"
+  "CMakeFiles/sleefgnuabi.dir/rempitab.c.o"
+  "CMakeFiles/sleefgnuabi.dir/rempitab.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/sleefgnuabi.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
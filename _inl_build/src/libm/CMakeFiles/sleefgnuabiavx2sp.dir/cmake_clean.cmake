@@ -0,0 +1,10 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/sleefgnuabiavx2sp.dir/sleefsimdsp.c.o"
+  "CMakeFiles/sleefgnuabiavx2sp.dir/sleefsimdsp.c.o.d"
+  "include/renameavx2_gnuabi.h"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/sleefgnuabiavx2sp.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,10 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/sleefgnuabiavx512fdp.dir/sleefsimddp.c.o"
+  "CMakeFiles/sleefgnuabiavx512fdp.dir/sleefsimddp.c.o.d"
+  "include/renameavx512f_gnuabi.h"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/sleefgnuabiavx512fdp.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,10 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/sleefgnuabiavx512fsp.dir/sleefsimdsp.c.o"
+  "CMakeFiles/sleefgnuabiavx512fsp.dir/sleefsimdsp.c.o.d"
+  "include/renameavx512f_gnuabi.h"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/sleefgnuabiavx512fsp.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
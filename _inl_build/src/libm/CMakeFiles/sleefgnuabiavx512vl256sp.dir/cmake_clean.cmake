@@ -0,0 +1,10 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/sleefgnuabiavx512vl256sp.dir/sleefsimdsp.c.o"
+  "CMakeFiles/sleefgnuabiavx512vl256sp.dir/sleefsimdsp.c.o.d"
+  "include/renameavx512vl256_gnuabi.h"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/sleefgnuabiavx512vl256sp.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
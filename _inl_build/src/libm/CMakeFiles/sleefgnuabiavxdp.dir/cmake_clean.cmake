@@ -0,0 +1,10 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/sleefgnuabiavxdp.dir/sleefsimddp.c.o"
+  "CMakeFiles/sleefgnuabiavxdp.dir/sleefsimddp.c.o.d"
+  "include/renameavx_gnuabi.h"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/sleefgnuabiavxdp.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,10 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/sleefgnuabiavxsp.dir/sleefsimdsp.c.o"
+  "CMakeFiles/sleefgnuabiavxsp.dir/sleefsimdsp.c.o.d"
+  "include/renameavx_gnuabi.h"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/sleefgnuabiavxsp.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
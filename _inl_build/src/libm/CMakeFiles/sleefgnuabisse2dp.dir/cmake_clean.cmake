@@ -0,0 +1,10 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/sleefgnuabisse2dp.dir/sleefsimddp.c.o"
+  "CMakeFiles/sleefgnuabisse2dp.dir/sleefsimddp.c.o.d"
+  "include/renamesse2_gnuabi.h"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/sleefgnuabisse2dp.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
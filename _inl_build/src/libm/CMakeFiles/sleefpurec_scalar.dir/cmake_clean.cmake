@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "../../include/sleefinline_purec_scalar.h"
+  "CMakeFiles/sleefpurec_scalar.dir/sleefsimddp.c.o"
+  "CMakeFiles/sleefpurec_scalar.dir/sleefsimddp.c.o.d"
+  "CMakeFiles/sleefpurec_scalar.dir/sleefsimdsp.c.o"
+  "CMakeFiles/sleefpurec_scalar.dir/sleefsimdsp.c.o.d"
+  "include/renamepurec_scalar.h"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/sleefpurec_scalar.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "../../include/sleefinline_purecfma_scalar.h"
+  "CMakeFiles/sleefpurecfma_scalar.dir/sleefsimddp.c.o"
+  "CMakeFiles/sleefpurecfma_scalar.dir/sleefsimddp.c.o.d"
+  "CMakeFiles/sleefpurecfma_scalar.dir/sleefsimdsp.c.o"
+  "CMakeFiles/sleefpurecfma_scalar.dir/sleefsimdsp.c.o.d"
+  "include/renamepurecfma_scalar.h"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/sleefpurecfma_scalar.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
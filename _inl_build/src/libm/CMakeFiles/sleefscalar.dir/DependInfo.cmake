@@ -0,0 +1,28 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/libm/rempitab.c" "src/libm/CMakeFiles/sleefscalar.dir/rempitab.c.o" "gcc" "src/libm/CMakeFiles/sleefscalar.dir/rempitab.c.o.d"
+  "/root/repo/src/libm/sleefdp.c" "src/libm/CMakeFiles/sleefscalar.dir/sleefdp.c.o" "gcc" "src/libm/CMakeFiles/sleefscalar.dir/sleefdp.c.o.d"
+  "/root/repo/src/libm/sleefsp.c" "src/libm/CMakeFiles/sleefscalar.dir/sleefsp.c.o" "gcc" "src/libm/CMakeFiles/sleefscalar.dir/sleefsp.c.o.d"
+  )
+
+# Pairs of files generated by the same build rule.
+set(CMAKE_MULTIPLE_OUTPUT_PAIRS
+  "/root/repo/_inl_build/lib/libsleefscalar.so" "/root/repo/_inl_build/lib/libsleefscalar.so.3.6.0"
+  "/root/repo/_inl_build/lib/libsleefscalar.so.3" "/root/repo/_inl_build/lib/libsleefscalar.so.3.6.0"
+  )
+
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,17 @@
+file(REMOVE_RECURSE
+  "../../lib/libsleefscalar.pdb"
+  "../../lib/libsleefscalar.so"
+  "../../lib/libsleefscalar.so.3"
+  "../../lib/libsleefscalar.so.3.6.0"
+  "CMakeFiles/sleefscalar.dir/rempitab.c.o"
+  "CMakeFiles/sleefscalar.dir/rempitab.c.o.d"
+  "CMakeFiles/sleefscalar.dir/sleefdp.c.o"
+  "CMakeFiles/sleefscalar.dir/sleefdp.c.o.d"
+  "CMakeFiles/sleefscalar.dir/sleefsp.c.o"
+  "CMakeFiles/sleefscalar.dir/sleefsp.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/sleefscalar.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "../../include/sleefinline_sse2.h"
+  "CMakeFiles/sleefsse2.dir/sleefsimddp.c.o"
+  "CMakeFiles/sleefsse2.dir/sleefsimddp.c.o.d"
+  "CMakeFiles/sleefsse2.dir/sleefsimdsp.c.o"
+  "CMakeFiles/sleefsse2.dir/sleefsimdsp.c.o.d"
+  "include/renamesse2.h"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/sleefsse2.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "../../include/sleefinline_sse4.h"
+  "CMakeFiles/sleefsse4.dir/sleefsimddp.c.o"
+  "CMakeFiles/sleefsse4.dir/sleefsimddp.c.o.d"
+  "CMakeFiles/sleefsse4.dir/sleefsimdsp.c.o"
+  "CMakeFiles/sleefsse4.dir/sleefsimdsp.c.o.d"
+  "include/renamesse4.h"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/sleefsse4.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,726 @@
+//   Copyright Naoki Shibata and contributors 2010 - 2021.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <assert.h>
+#include <signal.h>
+#include <setjmp.h>
+
+#include "misc.h"
+
+#define SLEEF_IMPORT_IS_EXPORT
+#include "sleef.h"
+
+#include "dispatcher.h"
+
+/*
+ * The array functions call the array kernel of the widest dispatcher
+ * that the CPU can run and that the mask of the extensions allows, as
+ * described below. Kernel 0 is that of the scalar dispatcher.
+ * Kernel 1 is that of the 128-bit dispatcher, whose base extension is
+ * assumed to be available as in the 128-bit dispatcher itself. Kernel
+ * 2 is that of the 256-bit dispatcher on x86, which is used if AVX
+ * instructions can be executed. The strided and indexed array
+ * functions call the strided kernels chosen in the same way.
+ */
+
+#define DISPATCH_128 (DISPATCH_SSE2 | DISPATCH_SSE4 | DISPATCH_AVX2128 | DISPATCH_VSX | DISPATCH_VSX3 | DISPATCH_VXE | DISPATCH_VXE2)
+#define DISPATCH_256 (DISPATCH_AVX | DISPATCH_FMA4 | DISPATCH_AVX2 | DISPATCH_AVX512VL256)
+
+#if defined(ENABLE_DISPSSE) || defined(ENABLE_DISP128)
+#define SUBST_IF_EXT1(funcExt1) if (DISPATCH_ALLOWS(DISPATCH_128)) p = funcExt1;
+#else
+#define SUBST_IF_EXT1(funcExt1)
+#endif
+
+#ifdef ENABLE_DISPAVX
+#define SUBST_IF_EXT2(funcExt2) if (DISPATCH_ALLOWS(DISPATCH_256) && cpuSupportsX86(X86_AVX)) p = funcExt2;
+#else
+#define SUBST_IF_EXT2(funcExt2)
+#endif
+
+/*
+ * The extensions that the dispatchers may use are given as a list of
+ * extension names separated by commas. A name prefixed with "-"
+ * excludes the extension. If no extension is named without "-", all
+ * the extensions that are not excluded are allowed. The list is taken
+ * from the SLEEF_DISPATCH environment variable when the mask is needed
+ * for the first time, and can be replaced with
+ * Sleef_setDispatchExtensions.
+ */
+
+static const struct {
+  const char *name;
+  uint32_t ext;
+} dispatchExtensions[] = {
+  { "purec", DISPATCH_PUREC }, { "purecfma", DISPATCH_PURECFMA },
+  { "sse2", DISPATCH_SSE2 }, { "sse4", DISPATCH_SSE4 }, { "avx2128", DISPATCH_AVX2128 },
+  { "avx", DISPATCH_AVX }, { "fma4", DISPATCH_FMA4 }, { "avx2", DISPATCH_AVX2 },
+  { "avx512vl256", DISPATCH_AVX512VL256 },
+  { "vsx", DISPATCH_VSX }, { "vsx3", DISPATCH_VSX3 },
+  { "vxe", DISPATCH_VXE }, { "vxe2", DISPATCH_VXE2 },
+  { NULL, 0 },
+};
+
+static int parseDispatchExtensions(const char *spec, uint32_t *mask) {
+  uint32_t allowed = 0, excluded = 0;
+
+  while(*spec != '\0') {
+    size_t len = 0;
+    while(spec[len] != '\0' && spec[len] != ',') len++;
+
+    if (len > 0) {
+      const int neg = spec[0] == '-';
+      int i;
+      for(i=0;dispatchExtensions[i].name != NULL;i++) {
+	const char *e = dispatchExtensions[i].name;
+	size_t j = 0;
+	while(j < len - neg && e[j] == spec[neg + j]) j++;
+	if (j == len - neg && e[j] == '\0') break;
+      }
+      if (dispatchExtensions[i].name == NULL) return -1;
+      if (neg) excluded |= dispatchExtensions[i].ext; else allowed |= dispatchExtensions[i].ext;
+    }
+
+    spec += len;
+    if (*spec == ',') spec++;
+  }
+
+  *mask = (allowed == 0 ? DISPATCH_ALL : allowed) & ~excluded;
+  return 0;
+}
+
+#if defined(__GLIBC__) && defined(__linux__)
+extern char **environ;
+extern void *__libc_stack_end;
+#endif
+
+static const char *dispatchEnv() {
+#if defined(__GLIBC__) && defined(__linux__)
+  // If the IFUNC resolvers run at load time, the C library has not set
+  // environ yet. The environment then follows argc and argv, to which
+  // __libc_stack_end points.
+  if (environ == NULL && __libc_stack_end != NULL) {
+    const intptr_t *sp = (const intptr_t *)__libc_stack_end;
+    for(char **envp = (char **)(sp + 1) + sp[0] + 1;*envp != NULL;envp++) {
+      if (strncmp(*envp, "SLEEF_DISPATCH=", 15) == 0) return *envp + 15;
+    }
+    return NULL;
+  }
+#endif
+  return getenv("SLEEF_DISPATCH");
+}
+
+// The top bit tells that the mask has been set
+static uint32_t dispatchMask = 0;
+
+NOEXPORT uint32_t Sleef_dispatchMask() {
+  if (dispatchMask == 0) {
+    uint32_t mask = DISPATCH_ALL;
+    const char *spec = dispatchEnv();
+    if (spec != NULL) parseDispatchExtensions(spec, &mask);
+    dispatchMask = mask | (1U << 31);
+  }
+  return dispatchMask;
+}
+
+NOEXPORT const char *Sleef_queryDispatcherd1(const char *name);
+#if defined(ENABLE_DISPSSE) || defined(ENABLE_DISP128)
+NOEXPORT const char *Sleef_queryDispatcherd2(const char *name);
+#endif
+#ifdef ENABLE_DISPAVX
+NOEXPORT const char *Sleef_queryDispatcherd4(const char *name);
+#endif
+
+// Dispatchers that are GNU indirect functions and have been bound keep
+// their choices
+
+EXPORT int Sleef_setDispatchExtensions(const char *spec) {
+  uint32_t mask;
+  if (parseDispatchExtensions(spec == NULL ? "" : spec, &mask) != 0) return -1;
+  dispatchMask = mask | (1U << 31);
+
+  Sleef_queryDispatcherd1(NULL);
+#if defined(ENABLE_DISPSSE) || defined(ENABLE_DISP128)
+  Sleef_queryDispatcherd2(NULL);
+#endif
+#ifdef ENABLE_DISPAVX
+  Sleef_queryDispatcherd4(NULL);
+#endif
+  return 0;
+}
+
+EXPORT const char *Sleef_getDispatchedFunction(const char *name) {
+  const char *r = Sleef_queryDispatcherd1(name);
+#if defined(ENABLE_DISPSSE) || defined(ENABLE_DISP128)
+  if (r == NULL) r = Sleef_queryDispatcherd2(name);
+#endif
+#ifdef ENABLE_DISPAVX
+  if (r == NULL) r = Sleef_queryDispatcherd4(name);
+#endif
+  return r;
+}
+
+/*
+ * The parallel array functions split the arrays into chunks of
+ * ARRAY_CHUNK elements, which fit in the L2 cache, and process the
+ * chunks with the parallel-for given to Sleef_setArrayParallelFor, or
+ * with OpenMP if the library is built with it. Arrays shorter than the
+ * threshold are processed by the calling thread.
+ */
+
+#define ARRAY_CHUNK 8192
+#define ARRAY_THRESHOLD 65536
+
+typedef struct {
+  void (*p)(void);
+  const void *a0, *a1, *a2;
+  void *r0, *r1;
+  size_t n;
+} arrayArgs;
+
+static void (*arrayParallelFor)(void (*body)(void *, size_t), void *arg, size_t nChunks, void *ctx) = NULL;
+static void *arrayParallelForCtx = NULL;
+static size_t arrayThreshold = ARRAY_THRESHOLD;
+
+EXPORT void Sleef_setArrayParallelFor(void (*parallelFor)(void (*body)(void *, size_t), void *arg, size_t nChunks, void *ctx),
+				      void *ctx, size_t threshold) {
+  arrayParallelFor = parallelFor;
+  arrayParallelForCtx = ctx;
+  arrayThreshold = threshold == 0 ? ARRAY_THRESHOLD : threshold;
+}
+
+static void runChunks(void (*body)(void *, size_t), arrayArgs *args) {
+  const size_t nChunks = (args->n + ARRAY_CHUNK - 1) / ARRAY_CHUNK;
+
+  if (arrayParallelFor != NULL) {
+    (*arrayParallelFor)(body, args, nChunks, arrayParallelForCtx);
+    return;
+  }
+
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+  for(int64_t c=0;c<(int64_t)nChunks;c++) (*body)(args, (size_t)c);
+#else
+  for(size_t c=0;c<nChunks;c++) (*body)(args, c);
+#endif
+}
+
+#define CHUNK_BEGIN(c) ((c) * ARRAY_CHUNK)
+#define CHUNK_SIZE(q, c) ((q)->n - CHUNK_BEGIN(c) < ARRAY_CHUNK ? (q)->n - CHUNK_BEGIN(c) : ARRAY_CHUNK)
+
+#define ARRAY_vf_vf(stype, funcName, funcExt0, funcExt1, funcExt2)	\
+  NOEXPORT void funcExt0(const stype *, stype *, size_t);		\
+  NOEXPORT void funcExt1(const stype *, stype *, size_t);		\
+  NOEXPORT void funcExt2(const stype *, stype *, size_t);		\
+  NOEXPORT void funcExt0 ## _strided(const stype *, ptrdiff_t, stype *, ptrdiff_t, size_t, const int *); \
+  NOEXPORT void funcExt1 ## _strided(const stype *, ptrdiff_t, stype *, ptrdiff_t, size_t, const int *); \
+  NOEXPORT void funcExt2 ## _strided(const stype *, ptrdiff_t, stype *, ptrdiff_t, size_t, const int *); \
+  EXPORT void funcName(const stype *a0, stype *r, size_t n) {		\
+    void (*p)(const stype *, stype *, size_t) = funcExt0;		\
+    SUBST_IF_EXT1(funcExt1);						\
+    SUBST_IF_EXT2(funcExt2);						\
+    (*p)(a0, r, n);							\
+  }									\
+  static void funcName ## _chunk(void *arg, size_t c) {			\
+    arrayArgs *q = (arrayArgs *)arg;					\
+    ((void (*)(const stype *, stype *, size_t))q->p)			\
+      ((const stype *)q->a0 + CHUNK_BEGIN(c), (stype *)q->r0 + CHUNK_BEGIN(c), CHUNK_SIZE(q, c)); \
+  }									\
+  EXPORT void funcName ## _mt(const stype *a0, stype *r, size_t n) {	\
+    void (*p)(const stype *, stype *, size_t) = funcExt0;		\
+    SUBST_IF_EXT1(funcExt1);						\
+    SUBST_IF_EXT2(funcExt2);						\
+    if (n < arrayThreshold) { (*p)(a0, r, n); return; }		\
+    arrayArgs args = { (void (*)(void))p, a0, NULL, NULL, r, NULL, n }; \
+    runChunks(funcName ## _chunk, &args);				\
+  }									\
+  EXPORT void funcName ## _strided(const stype *a0, ptrdiff_t istride, stype *r, ptrdiff_t ostride, size_t n) { \
+    void (*p)(const stype *, ptrdiff_t, stype *, ptrdiff_t, size_t, const int *) = funcExt0 ## _strided; \
+    SUBST_IF_EXT1(funcExt1 ## _strided);				\
+    SUBST_IF_EXT2(funcExt2 ## _strided);				\
+    (*p)(a0, istride, r, ostride, n, NULL);				\
+  }									\
+  EXPORT void funcName ## _indexed(const stype *a0, stype *r, const int *idx, size_t n) { \
+    void (*p)(const stype *, ptrdiff_t, stype *, ptrdiff_t, size_t, const int *) = funcExt0 ## _strided; \
+    SUBST_IF_EXT1(funcExt1 ## _strided);				\
+    SUBST_IF_EXT2(funcExt2 ## _strided);				\
+    (*p)(a0, sizeof(stype), r, sizeof(stype), n, idx);			\
+  }
+
+#define ARRAY_vf_vf_vf(stype, funcName, funcExt0, funcExt1, funcExt2)	\
+  NOEXPORT void funcExt0(const stype *, const stype *, stype *, size_t); \
+  NOEXPORT void funcExt1(const stype *, const stype *, stype *, size_t); \
+  NOEXPORT void funcExt2(const stype *, const stype *, stype *, size_t); \
+  NOEXPORT void funcExt0 ## _strided(const stype *, const stype *, ptrdiff_t, stype *, ptrdiff_t, size_t, const int *); \
+  NOEXPORT void funcExt1 ## _strided(const stype *, const stype *, ptrdiff_t, stype *, ptrdiff_t, size_t, const int *); \
+  NOEXPORT void funcExt2 ## _strided(const stype *, const stype *, ptrdiff_t, stype *, ptrdiff_t, size_t, const int *); \
+  EXPORT void funcName(const stype *a0, const stype *a1, stype *r, size_t n) { \
+    void (*p)(const stype *, const stype *, stype *, size_t) = funcExt0; \
+    SUBST_IF_EXT1(funcExt1);						\
+    SUBST_IF_EXT2(funcExt2);						\
+    (*p)(a0, a1, r, n);							\
+  }									\
+  static void funcName ## _chunk(void *arg, size_t c) {			\
+    arrayArgs *q = (arrayArgs *)arg;					\
+    ((void (*)(const stype *, const stype *, stype *, size_t))q->p)	\
+      ((const stype *)q->a0 + CHUNK_BEGIN(c), (const stype *)q->a1 + CHUNK_BEGIN(c), \
+       (stype *)q->r0 + CHUNK_BEGIN(c), CHUNK_SIZE(q, c));		\
+  }									\
+  EXPORT void funcName ## _mt(const stype *a0, const stype *a1, stype *r, size_t n) { \
+    void (*p)(const stype *, const stype *, stype *, size_t) = funcExt0; \
+    SUBST_IF_EXT1(funcExt1);						\
+    SUBST_IF_EXT2(funcExt2);						\
+    if (n < arrayThreshold) { (*p)(a0, a1, r, n); return; }		\
+    arrayArgs args = { (void (*)(void))p, a0, a1, NULL, r, NULL, n };	\
+    runChunks(funcName ## _chunk, &args);				\
+  }									\
+  EXPORT void funcName ## _strided(const stype *a0, const stype *a1, ptrdiff_t istride, stype *r, ptrdiff_t ostride, size_t n) { \
+    void (*p)(const stype *, const stype *, ptrdiff_t, stype *, ptrdiff_t, size_t, const int *) = funcExt0 ## _strided; \
+    SUBST_IF_EXT1(funcExt1 ## _strided);				\
+    SUBST_IF_EXT2(funcExt2 ## _strided);				\
+    (*p)(a0, a1, istride, r, ostride, n, NULL);				\
+  }									\
+  EXPORT void funcName ## _indexed(const stype *a0, const stype *a1, stype *r, const int *idx, size_t n) { \
+    void (*p)(const stype *, const stype *, ptrdiff_t, stype *, ptrdiff_t, size_t, const int *) = funcExt0 ## _strided; \
+    SUBST_IF_EXT1(funcExt1 ## _strided);				\
+    SUBST_IF_EXT2(funcExt2 ## _strided);				\
+    (*p)(a0, a1, sizeof(stype), r, sizeof(stype), n, idx);		\
+  }
+
+#define ARRAY_vf_vf_vf_vf(stype, funcName, funcExt0, funcExt1, funcExt2) \
+  NOEXPORT void funcExt0(const stype *, const stype *, const stype *, stype *, size_t); \
+  NOEXPORT void funcExt1(const stype *, const stype *, const stype *, stype *, size_t); \
+  NOEXPORT void funcExt2(const stype *, const stype *, const stype *, stype *, size_t); \
+  NOEXPORT void funcExt0 ## _strided(const stype *, const stype *, const stype *, ptrdiff_t, stype *, ptrdiff_t, size_t, const int *); \
+  NOEXPORT void funcExt1 ## _strided(const stype *, const stype *, const stype *, ptrdiff_t, stype *, ptrdiff_t, size_t, const int *); \
+  NOEXPORT void funcExt2 ## _strided(const stype *, const stype *, const stype *, ptrdiff_t, stype *, ptrdiff_t, size_t, const int *); \
+  EXPORT void funcName(const stype *a0, const stype *a1, const stype *a2, stype *r, size_t n) { \
+    void (*p)(const stype *, const stype *, const stype *, stype *, size_t) = funcExt0; \
+    SUBST_IF_EXT1(funcExt1);						\
+    SUBST_IF_EXT2(funcExt2);						\
+    (*p)(a0, a1, a2, r, n);						\
+  }									\
+  static void funcName ## _chunk(void *arg, size_t c) {			\
+    arrayArgs *q = (arrayArgs *)arg;					\
+    ((void (*)(const stype *, const stype *, const stype *, stype *, size_t))q->p) \
+      ((const stype *)q->a0 + CHUNK_BEGIN(c), (const stype *)q->a1 + CHUNK_BEGIN(c), \
+       (const stype *)q->a2 + CHUNK_BEGIN(c), (stype *)q->r0 + CHUNK_BEGIN(c), CHUNK_SIZE(q, c)); \
+  }									\
+  EXPORT void funcName ## _mt(const stype *a0, const stype *a1, const stype *a2, stype *r, size_t n) { \
+    void (*p)(const stype *, const stype *, const stype *, stype *, size_t) = funcExt0; \
+    SUBST_IF_EXT1(funcExt1);						\
+    SUBST_IF_EXT2(funcExt2);						\
+    if (n < arrayThreshold) { (*p)(a0, a1, a2, r, n); return; }	\
+    arrayArgs args = { (void (*)(void))p, a0, a1, a2, r, NULL, n };	\
+    runChunks(funcName ## _chunk, &args);				\
+  }									\
+  EXPORT void funcName ## _strided(const stype *a0, const stype *a1, const stype *a2, ptrdiff_t istride, stype *r, ptrdiff_t ostride, size_t n) { \
+    void (*p)(const stype *, const stype *, const stype *, ptrdiff_t, stype *, ptrdiff_t, size_t, const int *) = funcExt0 ## _strided; \
+    SUBST_IF_EXT1(funcExt1 ## _strided);				\
+    SUBST_IF_EXT2(funcExt2 ## _strided);				\
+    (*p)(a0, a1, a2, istride, r, ostride, n, NULL);			\
+  }									\
+  EXPORT void funcName ## _indexed(const stype *a0, const stype *a1, const stype *a2, stype *r, const int *idx, size_t n) { \
+    void (*p)(const stype *, const stype *, const stype *, ptrdiff_t, stype *, ptrdiff_t, size_t, const int *) = funcExt0 ## _strided; \
+    SUBST_IF_EXT1(funcExt1 ## _strided);				\
+    SUBST_IF_EXT2(funcExt2 ## _strided);				\
+    (*p)(a0, a1, a2, sizeof(stype), r, sizeof(stype), n, idx);		\
+  }
+
+#define ARRAY_vf2_vf(stype, funcName, funcExt0, funcExt1, funcExt2)	\
+  NOEXPORT void funcExt0(const stype *, stype *, stype *, size_t);	\
+  NOEXPORT void funcExt1(const stype *, stype *, stype *, size_t);	\
+  NOEXPORT void funcExt2(const stype *, stype *, stype *, size_t);	\
+  NOEXPORT void funcExt0 ## _strided(const stype *, ptrdiff_t, stype *, stype *, ptrdiff_t, size_t, const int *); \
+  NOEXPORT void funcExt1 ## _strided(const stype *, ptrdiff_t, stype *, stype *, ptrdiff_t, size_t, const int *); \
+  NOEXPORT void funcExt2 ## _strided(const stype *, ptrdiff_t, stype *, stype *, ptrdiff_t, size_t, const int *); \
+  EXPORT void funcName(const stype *a0, stype *r0, stype *r1, size_t n) { \
+    void (*p)(const stype *, stype *, stype *, size_t) = funcExt0;	\
+    SUBST_IF_EXT1(funcExt1);						\
+    SUBST_IF_EXT2(funcExt2);						\
+    (*p)(a0, r0, r1, n);						\
+  }									\
+  static void funcName ## _chunk(void *arg, size_t c) {			\
+    arrayArgs *q = (arrayArgs *)arg;					\
+    ((void (*)(const stype *, stype *, stype *, size_t))q->p)		\
+      ((const stype *)q->a0 + CHUNK_BEGIN(c), (stype *)q->r0 + CHUNK_BEGIN(c), \
+       (stype *)q->r1 + CHUNK_BEGIN(c), CHUNK_SIZE(q, c));		\
+  }									\
+  EXPORT void funcName ## _mt(const stype *a0, stype *r0, stype *r1, size_t n) { \
+    void (*p)(const stype *, stype *, stype *, size_t) = funcExt0;	\
+    SUBST_IF_EXT1(funcExt1);						\
+    SUBST_IF_EXT2(funcExt2);						\
+    if (n < arrayThreshold) { (*p)(a0, r0, r1, n); return; }		\
+    arrayArgs args = { (void (*)(void))p, a0, NULL, NULL, r0, r1, n };	\
+    runChunks(funcName ## _chunk, &args);				\
+  }									\
+  EXPORT void funcName ## _strided(const stype *a0, ptrdiff_t istride, stype *r0, stype *r1, ptrdiff_t ostride, size_t n) { \
+    void (*p)(const stype *, ptrdiff_t, stype *, stype *, ptrdiff_t, size_t, const int *) = funcExt0 ## _strided; \
+    SUBST_IF_EXT1(funcExt1 ## _strided);				\
+    SUBST_IF_EXT2(funcExt2 ## _strided);				\
+    (*p)(a0, istride, r0, r1, ostride, n, NULL);			\
+  }									\
+  EXPORT void funcName ## _indexed(const stype *a0, stype *r0, stype *r1, const int *idx, size_t n) { \
+    void (*p)(const stype *, ptrdiff_t, stype *, stype *, ptrdiff_t, size_t, const int *) = funcExt0 ## _strided; \
+    SUBST_IF_EXT1(funcExt1 ## _strided);				\
+    SUBST_IF_EXT2(funcExt2 ## _strided);				\
+    (*p)(a0, sizeof(stype), r0, r1, sizeof(stype), n, idx);		\
+  }
+
+#define ARRAY_vf_vf_vi(stype, funcName, funcExt0, funcExt1, funcExt2)	\
+  NOEXPORT void funcExt0(const stype *, const int *, stype *, size_t);	\
+  NOEXPORT void funcExt1(const stype *, const int *, stype *, size_t);	\
+  NOEXPORT void funcExt2(const stype *, const int *, stype *, size_t);	\
+  NOEXPORT void funcExt0 ## _strided(const stype *, const int *, ptrdiff_t, stype *, ptrdiff_t, size_t, const int *); \
+  NOEXPORT void funcExt1 ## _strided(const stype *, const int *, ptrdiff_t, stype *, ptrdiff_t, size_t, const int *); \
+  NOEXPORT void funcExt2 ## _strided(const stype *, const int *, ptrdiff_t, stype *, ptrdiff_t, size_t, const int *); \
+  EXPORT void funcName(const stype *a0, const int *a1, stype *r, size_t n) { \
+    void (*p)(const stype *, const int *, stype *, size_t) = funcExt0;	\
+    SUBST_IF_EXT1(funcExt1);						\
+    SUBST_IF_EXT2(funcExt2);						\
+    (*p)(a0, a1, r, n);							\
+  }									\
+  static void funcName ## _chunk(void *arg, size_t c) {			\
+    arrayArgs *q = (arrayArgs *)arg;					\
+    ((void (*)(const stype *, const int *, stype *, size_t))q->p)	\
+      ((const stype *)q->a0 + CHUNK_BEGIN(c), (const int *)q->a1 + CHUNK_BEGIN(c), \
+       (stype *)q->r0 + CHUNK_BEGIN(c), CHUNK_SIZE(q, c));		\
+  }									\
+  EXPORT void funcName ## _mt(const stype *a0, const int *a1, stype *r, size_t n) { \
+    void (*p)(const stype *, const int *, stype *, size_t) = funcExt0;	\
+    SUBST_IF_EXT1(funcExt1);						\
+    SUBST_IF_EXT2(funcExt2);						\
+    if (n < arrayThreshold) { (*p)(a0, a1, r, n); return; }		\
+    arrayArgs args = { (void (*)(void))p, a0, a1, NULL, r, NULL, n };	\
+    runChunks(funcName ## _chunk, &args);				\
+  }									\
+  EXPORT void funcName ## _strided(const stype *a0, const int *a1, ptrdiff_t istride, stype *r, ptrdiff_t ostride, size_t n) { \
+    void (*p)(const stype *, const int *, ptrdiff_t, stype *, ptrdiff_t, size_t, const int *) = funcExt0 ## _strided; \
+    SUBST_IF_EXT1(funcExt1 ## _strided);				\
+    SUBST_IF_EXT2(funcExt2 ## _strided);				\
+    (*p)(a0, a1, istride, r, ostride, n, NULL);				\
+  }									\
+  EXPORT void funcName ## _indexed(const stype *a0, const int *a1, stype *r, const int *idx, size_t n) { \
+    void (*p)(const stype *, const int *, ptrdiff_t, stype *, ptrdiff_t, size_t, const int *) = funcExt0 ## _strided; \
+    SUBST_IF_EXT1(funcExt1 ## _strided);				\
+    SUBST_IF_EXT2(funcExt2 ## _strided);				\
+    (*p)(a0, a1, 0, r, 0, n, idx);					\
+  }
+
+#define ARRAY_vi_vf(stype, funcName, funcExt0, funcExt1, funcExt2)	\
+  NOEXPORT void funcExt0(const stype *, int *, size_t);			\
+  NOEXPORT void funcExt1(const stype *, int *, size_t);			\
+  NOEXPORT void funcExt2(const stype *, int *, size_t);			\
+  NOEXPORT void funcExt0 ## _strided(const stype *, ptrdiff_t, int *, ptrdiff_t, size_t, const int *); \
+  NOEXPORT void funcExt1 ## _strided(const stype *, ptrdiff_t, int *, ptrdiff_t, size_t, const int *); \
+  NOEXPORT void funcExt2 ## _strided(const stype *, ptrdiff_t, int *, ptrdiff_t, size_t, const int *); \
+  EXPORT void funcName(const stype *a0, int *r, size_t n) {		\
+    void (*p)(const stype *, int *, size_t) = funcExt0;			\
+    SUBST_IF_EXT1(funcExt1);						\
+    SUBST_IF_EXT2(funcExt2);						\
+    (*p)(a0, r, n);							\
+  }									\
+  static void funcName ## _chunk(void *arg, size_t c) {			\
+    arrayArgs *q = (arrayArgs *)arg;					\
+    ((void (*)(const stype *, int *, size_t))q->p)			\
+      ((const stype *)q->a0 + CHUNK_BEGIN(c), (int *)q->r0 + CHUNK_BEGIN(c), CHUNK_SIZE(q, c)); \
+  }									\
+  EXPORT void funcName ## _mt(const stype *a0, int *r, size_t n) {	\
+    void (*p)(const stype *, int *, size_t) = funcExt0;			\
+    SUBST_IF_EXT1(funcExt1);						\
+    SUBST_IF_EXT2(funcExt2);						\
+    if (n < arrayThreshold) { (*p)(a0, r, n); return; }		\
+    arrayArgs args = { (void (*)(void))p, a0, NULL, NULL, r, NULL, n }; \
+    runChunks(funcName ## _chunk, &args);				\
+  }									\
+  EXPORT void funcName ## _strided(const stype *a0, ptrdiff_t istride, int *r, ptrdiff_t ostride, size_t n) { \
+    void (*p)(const stype *, ptrdiff_t, int *, ptrdiff_t, size_t, const int *) = funcExt0 ## _strided; \
+    SUBST_IF_EXT1(funcExt1 ## _strided);				\
+    SUBST_IF_EXT2(funcExt2 ## _strided);				\
+    (*p)(a0, istride, r, ostride, n, NULL);				\
+  }									\
+  EXPORT void funcName ## _indexed(const stype *a0, int *r, const int *idx, size_t n) { \
+    void (*p)(const stype *, ptrdiff_t, int *, ptrdiff_t, size_t, const int *) = funcExt0 ## _strided; \
+    SUBST_IF_EXT1(funcExt1 ## _strided);				\
+    SUBST_IF_EXT2(funcExt2 ## _strided);				\
+    (*p)(a0, 0, r, 0, n, idx);						\
+  }
+
+/*
+ * The bfloat16 array functions widen blocks of BF16_BLOCK elements to
+ * single precision on the stack, call the single-precision array
+ * function on them, and round the results to nearest even. The blocks
+ * stay in the L1 cache, so the conversions cost no memory traffic.
+ */
+
+#define BF16_BLOCK 512
+
+static void bf16ToFloat(const uint16_t *a, float *r, size_t n) {
+  for(size_t i=0;i<n;i++) {
+    uint32_t u = (uint32_t)a[i] << 16;
+    memcpy(&r[i], &u, sizeof(u));
+  }
+}
+
+static void floatToBf16(const float *a, uint16_t *r, size_t n) {
+  for(size_t i=0;i<n;i++) {
+    uint32_t u;
+    memcpy(&u, &a[i], sizeof(u));
+    r[i] = (u & 0x7fffffff) > 0x7f800000 ? (u | 0x400000) >> 16 : (u + 0x7fff + ((u >> 16) & 1)) >> 16;
+  }
+}
+
+#define ARRAY_bf16_vf(funcName, funcf)					\
+  EXPORT void funcName(const uint16_t *a0, uint16_t *r, size_t n) {	\
+    float x[BF16_BLOCK];						\
+    for(size_t i=0;i<n;i+=BF16_BLOCK) {					\
+      const size_t m = n - i < BF16_BLOCK ? n - i : BF16_BLOCK;		\
+      bf16ToFloat(a0 + i, x, m);					\
+      funcf(x, x, m);							\
+      floatToBf16(x, r + i, m);						\
+    }									\
+  }									\
+  static void funcName ## _chunk(void *arg, size_t c) {			\
+    arrayArgs *q = (arrayArgs *)arg;					\
+    funcName((const uint16_t *)q->a0 + CHUNK_BEGIN(c), (uint16_t *)q->r0 + CHUNK_BEGIN(c), CHUNK_SIZE(q, c)); \
+  }									\
+  EXPORT void funcName ## _mt(const uint16_t *a0, uint16_t *r, size_t n) { \
+    if (n < arrayThreshold) { funcName(a0, r, n); return; }		\
+    arrayArgs args = { NULL, a0, NULL, NULL, r, NULL, n };		\
+    runChunks(funcName ## _chunk, &args);				\
+  }
+
+#define ARRAY_bf16_vf_vf(funcName, funcf)				\
+  EXPORT void funcName(const uint16_t *a0, const uint16_t *a1, uint16_t *r, size_t n) { \
+    float x[BF16_BLOCK], y[BF16_BLOCK];					\
+    for(size_t i=0;i<n;i+=BF16_BLOCK) {					\
+      const size_t m = n - i < BF16_BLOCK ? n - i : BF16_BLOCK;		\
+      bf16ToFloat(a0 + i, x, m);					\
+      bf16ToFloat(a1 + i, y, m);					\
+      funcf(x, y, x, m);						\
+      floatToBf16(x, r + i, m);						\
+    }									\
+  }									\
+  static void funcName ## _chunk(void *arg, size_t c) {			\
+    arrayArgs *q = (arrayArgs *)arg;					\
+    funcName((const uint16_t *)q->a0 + CHUNK_BEGIN(c), (const uint16_t *)q->a1 + CHUNK_BEGIN(c), \
+	     (uint16_t *)q->r0 + CHUNK_BEGIN(c), CHUNK_SIZE(q, c));	\
+  }									\
+  EXPORT void funcName ## _mt(const uint16_t *a0, const uint16_t *a1, uint16_t *r, size_t n) { \
+    if (n < arrayThreshold) { funcName(a0, a1, r, n); return; }	\
+    arrayArgs args = { NULL, a0, a1, NULL, r, NULL, n };		\
+    runChunks(funcName ## _chunk, &args);				\
+  }
+
+//
+ARRAY_vf_vf(double, Sleef_sin_u35_array, Sleef_sind1_u35_array, Sleef_sind2_u35_array, Sleef_sind4_u35_array)
+ARRAY_vf_vf(float, Sleef_sinf_u35_array, Sleef_sinf1_u35_array, Sleef_sinf4_u35_array, Sleef_sinf8_u35_array)
+ARRAY_vf_vf(double, Sleef_cos_u35_array, Sleef_cosd1_u35_array, Sleef_cosd2_u35_array, Sleef_cosd4_u35_array)
+ARRAY_vf_vf(float, Sleef_cosf_u35_array, Sleef_cosf1_u35_array, Sleef_cosf4_u35_array, Sleef_cosf8_u35_array)
+ARRAY_vf2_vf(double, Sleef_sincos_u35_array, Sleef_sincosd1_u35_array, Sleef_sincosd2_u35_array, Sleef_sincosd4_u35_array)
+ARRAY_vf2_vf(float, Sleef_sincosf_u35_array, Sleef_sincosf1_u35_array, Sleef_sincosf4_u35_array, Sleef_sincosf8_u35_array)
+ARRAY_vf_vf(double, Sleef_tan_u35_array, Sleef_tand1_u35_array, Sleef_tand2_u35_array, Sleef_tand4_u35_array)
+ARRAY_vf_vf(float, Sleef_tanf_u35_array, Sleef_tanf1_u35_array, Sleef_tanf4_u35_array, Sleef_tanf8_u35_array)
+ARRAY_vf_vf(double, Sleef_asin_u35_array, Sleef_asind1_u35_array, Sleef_asind2_u35_array, Sleef_asind4_u35_array)
+ARRAY_vf_vf(float, Sleef_asinf_u35_array, Sleef_asinf1_u35_array, Sleef_asinf4_u35_array, Sleef_asinf8_u35_array)
+ARRAY_vf_vf(double, Sleef_acos_u35_array, Sleef_acosd1_u35_array, Sleef_acosd2_u35_array, Sleef_acosd4_u35_array)
+ARRAY_vf_vf(float, Sleef_acosf_u35_array, Sleef_acosf1_u35_array, Sleef_acosf4_u35_array, Sleef_acosf8_u35_array)
+ARRAY_vf_vf(double, Sleef_atan_u35_array, Sleef_atand1_u35_array, Sleef_atand2_u35_array, Sleef_atand4_u35_array)
+ARRAY_vf_vf(float, Sleef_atanf_u35_array, Sleef_atanf1_u35_array, Sleef_atanf4_u35_array, Sleef_atanf8_u35_array)
+ARRAY_vf_vf_vf(double, Sleef_atan2_u35_array, Sleef_atan2d1_u35_array, Sleef_atan2d2_u35_array, Sleef_atan2d4_u35_array)
+ARRAY_vf_vf_vf(float, Sleef_atan2f_u35_array, Sleef_atan2f1_u35_array, Sleef_atan2f4_u35_array, Sleef_atan2f8_u35_array)
+ARRAY_vf_vf(double, Sleef_log_u35_array, Sleef_logd1_u35_array, Sleef_logd2_u35_array, Sleef_logd4_u35_array)
+ARRAY_vf_vf(float, Sleef_logf_u35_array, Sleef_logf1_u35_array, Sleef_logf4_u35_array, Sleef_logf8_u35_array)
+ARRAY_vf_vf(double, Sleef_cbrt_u35_array, Sleef_cbrtd1_u35_array, Sleef_cbrtd2_u35_array, Sleef_cbrtd4_u35_array)
+ARRAY_vf_vf(float, Sleef_cbrtf_u35_array, Sleef_cbrtf1_u35_array, Sleef_cbrtf4_u35_array, Sleef_cbrtf8_u35_array)
+ARRAY_vf_vf(double, Sleef_sin_u10_array, Sleef_sind1_u10_array, Sleef_sind2_u10_array, Sleef_sind4_u10_array)
+ARRAY_vf_vf(float, Sleef_sinf_u10_array, Sleef_sinf1_u10_array, Sleef_sinf4_u10_array, Sleef_sinf8_u10_array)
+ARRAY_bf16_vf(Sleef_sinbf16_u10_array, Sleef_sinf_u10_array)
+ARRAY_vf_vf(double, Sleef_cos_u10_array, Sleef_cosd1_u10_array, Sleef_cosd2_u10_array, Sleef_cosd4_u10_array)
+ARRAY_vf_vf(float, Sleef_cosf_u10_array, Sleef_cosf1_u10_array, Sleef_cosf4_u10_array, Sleef_cosf8_u10_array)
+ARRAY_bf16_vf(Sleef_cosbf16_u10_array, Sleef_cosf_u10_array)
+ARRAY_vf2_vf(double, Sleef_sincos_u10_array, Sleef_sincosd1_u10_array, Sleef_sincosd2_u10_array, Sleef_sincosd4_u10_array)
+ARRAY_vf2_vf(float, Sleef_sincosf_u10_array, Sleef_sincosf1_u10_array, Sleef_sincosf4_u10_array, Sleef_sincosf8_u10_array)
+ARRAY_vf_vf(double, Sleef_tan_u10_array, Sleef_tand1_u10_array, Sleef_tand2_u10_array, Sleef_tand4_u10_array)
+ARRAY_vf_vf(float, Sleef_tanf_u10_array, Sleef_tanf1_u10_array, Sleef_tanf4_u10_array, Sleef_tanf8_u10_array)
+ARRAY_vf_vf(double, Sleef_asin_u10_array, Sleef_asind1_u10_array, Sleef_asind2_u10_array, Sleef_asind4_u10_array)
+ARRAY_vf_vf(float, Sleef_asinf_u10_array, Sleef_asinf1_u10_array, Sleef_asinf4_u10_array, Sleef_asinf8_u10_array)
+ARRAY_vf_vf(double, Sleef_acos_u10_array, Sleef_acosd1_u10_array, Sleef_acosd2_u10_array, Sleef_acosd4_u10_array)
+ARRAY_vf_vf(float, Sleef_acosf_u10_array, Sleef_acosf1_u10_array, Sleef_acosf4_u10_array, Sleef_acosf8_u10_array)
+ARRAY_vf_vf(double, Sleef_atan_u10_array, Sleef_atand1_u10_array, Sleef_atand2_u10_array, Sleef_atand4_u10_array)
+ARRAY_vf_vf(float, Sleef_atanf_u10_array, Sleef_atanf1_u10_array, Sleef_atanf4_u10_array, Sleef_atanf8_u10_array)
+ARRAY_vf_vf_vf(double, Sleef_atan2_u10_array, Sleef_atan2d1_u10_array, Sleef_atan2d2_u10_array, Sleef_atan2d4_u10_array)
+ARRAY_vf_vf_vf(float, Sleef_atan2f_u10_array, Sleef_atan2f1_u10_array, Sleef_atan2f4_u10_array, Sleef_atan2f8_u10_array)
+ARRAY_vf_vf(double, Sleef_log_u10_array, Sleef_logd1_u10_array, Sleef_logd2_u10_array, Sleef_logd4_u10_array)
+ARRAY_vf_vf(float, Sleef_logf_u10_array, Sleef_logf1_u10_array, Sleef_logf4_u10_array, Sleef_logf8_u10_array)
+ARRAY_bf16_vf(Sleef_logbf16_u10_array, Sleef_logf_u10_array)
+ARRAY_vf_vf(double, Sleef_cbrt_u10_array, Sleef_cbrtd1_u10_array, Sleef_cbrtd2_u10_array, Sleef_cbrtd4_u10_array)
+ARRAY_vf_vf(float, Sleef_cbrtf_u10_array, Sleef_cbrtf1_u10_array, Sleef_cbrtf4_u10_array, Sleef_cbrtf8_u10_array)
+ARRAY_vf_vf(double, Sleef_exp_u10_array, Sleef_expd1_u10_array, Sleef_expd2_u10_array, Sleef_expd4_u10_array)
+ARRAY_vf_vf(float, Sleef_expf_u10_array, Sleef_expf1_u10_array, Sleef_expf4_u10_array, Sleef_expf8_u10_array)
+ARRAY_bf16_vf(Sleef_expbf16_u10_array, Sleef_expf_u10_array)
+ARRAY_vf_vf_vf(double, Sleef_pow_u10_array, Sleef_powd1_u10_array, Sleef_powd2_u10_array, Sleef_powd4_u10_array)
+ARRAY_vf_vf_vf(float, Sleef_powf_u10_array, Sleef_powf1_u10_array, Sleef_powf4_u10_array, Sleef_powf8_u10_array)
+ARRAY_bf16_vf_vf(Sleef_powbf16_u10_array, Sleef_powf_u10_array)
+ARRAY_vf_vf(double, Sleef_sinh_u10_array, Sleef_sinhd1_u10_array, Sleef_sinhd2_u10_array, Sleef_sinhd4_u10_array)
+ARRAY_vf_vf(float, Sleef_sinhf_u10_array, Sleef_sinhf1_u10_array, Sleef_sinhf4_u10_array, Sleef_sinhf8_u10_array)
+ARRAY_vf_vf(double, Sleef_cosh_u10_array, Sleef_coshd1_u10_array, Sleef_coshd2_u10_array, Sleef_coshd4_u10_array)
+ARRAY_vf_vf(float, Sleef_coshf_u10_array, Sleef_coshf1_u10_array, Sleef_coshf4_u10_array, Sleef_coshf8_u10_array)
+ARRAY_vf_vf(double, Sleef_tanh_u10_array, Sleef_tanhd1_u10_array, Sleef_tanhd2_u10_array, Sleef_tanhd4_u10_array)
+ARRAY_vf_vf(float, Sleef_tanhf_u10_array, Sleef_tanhf1_u10_array, Sleef_tanhf4_u10_array, Sleef_tanhf8_u10_array)
+ARRAY_bf16_vf(Sleef_tanhbf16_u10_array, Sleef_tanhf_u10_array)
+ARRAY_vf_vf(double, Sleef_sinh_u35_array, Sleef_sinhd1_u35_array, Sleef_sinhd2_u35_array, Sleef_sinhd4_u35_array)
+ARRAY_vf_vf(float, Sleef_sinhf_u35_array, Sleef_sinhf1_u35_array, Sleef_sinhf4_u35_array, Sleef_sinhf8_u35_array)
+ARRAY_vf_vf(double, Sleef_cosh_u35_array, Sleef_coshd1_u35_array, Sleef_coshd2_u35_array, Sleef_coshd4_u35_array)
+ARRAY_vf_vf(float, Sleef_coshf_u35_array, Sleef_coshf1_u35_array, Sleef_coshf4_u35_array, Sleef_coshf8_u35_array)
+ARRAY_vf_vf(double, Sleef_tanh_u35_array, Sleef_tanhd1_u35_array, Sleef_tanhd2_u35_array, Sleef_tanhd4_u35_array)
+ARRAY_vf_vf(float, Sleef_tanhf_u35_array, Sleef_tanhf1_u35_array, Sleef_tanhf4_u35_array, Sleef_tanhf8_u35_array)
+ARRAY_vf_vf(float, Sleef_fastsinf_u3500_array, Sleef_fastsinf1_u3500_array, Sleef_fastsinf4_u3500_array, Sleef_fastsinf8_u3500_array)
+ARRAY_vf_vf(float, Sleef_fastcosf_u3500_array, Sleef_fastcosf1_u3500_array, Sleef_fastcosf4_u3500_array, Sleef_fastcosf8_u3500_array)
+ARRAY_vf_vf_vf(float, Sleef_fastpowf_u3500_array, Sleef_fastpowf1_u3500_array, Sleef_fastpowf4_u3500_array, Sleef_fastpowf8_u3500_array)
+ARRAY_vf_vf(double, Sleef_fastexp_u3500_array, Sleef_fastexpd1_u3500_array, Sleef_fastexpd2_u3500_array, Sleef_fastexpd4_u3500_array)
+ARRAY_vf_vf(float, Sleef_fastexpf_u3500_array, Sleef_fastexpf1_u3500_array, Sleef_fastexpf4_u3500_array, Sleef_fastexpf8_u3500_array)
+ARRAY_vf_vf(double, Sleef_fastexp2_u3500_array, Sleef_fastexp2d1_u3500_array, Sleef_fastexp2d2_u3500_array, Sleef_fastexp2d4_u3500_array)
+ARRAY_vf_vf(float, Sleef_fastexp2f_u3500_array, Sleef_fastexp2f1_u3500_array, Sleef_fastexp2f4_u3500_array, Sleef_fastexp2f8_u3500_array)
+ARRAY_vf_vf(double, Sleef_fastlog_u3500_array, Sleef_fastlogd1_u3500_array, Sleef_fastlogd2_u3500_array, Sleef_fastlogd4_u3500_array)
+ARRAY_vf_vf(float, Sleef_fastlogf_u3500_array, Sleef_fastlogf1_u3500_array, Sleef_fastlogf4_u3500_array, Sleef_fastlogf8_u3500_array)
+ARRAY_vf_vf(double, Sleef_fastlog2_u3500_array, Sleef_fastlog2d1_u3500_array, Sleef_fastlog2d2_u3500_array, Sleef_fastlog2d4_u3500_array)
+ARRAY_vf_vf(float, Sleef_fastlog2f_u3500_array, Sleef_fastlog2f1_u3500_array, Sleef_fastlog2f4_u3500_array, Sleef_fastlog2f8_u3500_array)
+ARRAY_vf_vf(double, Sleef_fasttanh_u3500_array, Sleef_fasttanhd1_u3500_array, Sleef_fasttanhd2_u3500_array, Sleef_fasttanhd4_u3500_array)
+ARRAY_vf_vf(float, Sleef_fasttanhf_u3500_array, Sleef_fasttanhf1_u3500_array, Sleef_fasttanhf4_u3500_array, Sleef_fasttanhf8_u3500_array)
+ARRAY_vf_vf_vf(double, Sleef_fastatan2_u3500_array, Sleef_fastatan2d1_u3500_array, Sleef_fastatan2d2_u3500_array, Sleef_fastatan2d4_u3500_array)
+ARRAY_vf_vf_vf(float, Sleef_fastatan2f_u3500_array, Sleef_fastatan2f1_u3500_array, Sleef_fastatan2f4_u3500_array, Sleef_fastatan2f8_u3500_array)
+ARRAY_vf_vf(double, Sleef_fastrsqrt_u3500_array, Sleef_fastrsqrtd1_u3500_array, Sleef_fastrsqrtd2_u3500_array, Sleef_fastrsqrtd4_u3500_array)
+ARRAY_vf_vf(float, Sleef_fastrsqrtf_u3500_array, Sleef_fastrsqrtf1_u3500_array, Sleef_fastrsqrtf4_u3500_array, Sleef_fastrsqrtf8_u3500_array)
+ARRAY_vf_vf(double, Sleef_fastrcp_u3500_array, Sleef_fastrcpd1_u3500_array, Sleef_fastrcpd2_u3500_array, Sleef_fastrcpd4_u3500_array)
+ARRAY_vf_vf(float, Sleef_fastrcpf_u3500_array, Sleef_fastrcpf1_u3500_array, Sleef_fastrcpf4_u3500_array, Sleef_fastrcpf8_u3500_array)
+ARRAY_vf_vf(double, Sleef_sinr_u35_array, Sleef_sinrd1_u35_array, Sleef_sinrd2_u35_array, Sleef_sinrd4_u35_array)
+ARRAY_vf_vf(float, Sleef_sinrf_u35_array, Sleef_sinrf1_u35_array, Sleef_sinrf4_u35_array, Sleef_sinrf8_u35_array)
+ARRAY_vf_vf(double, Sleef_cosr_u35_array, Sleef_cosrd1_u35_array, Sleef_cosrd2_u35_array, Sleef_cosrd4_u35_array)
+ARRAY_vf_vf(float, Sleef_cosrf_u35_array, Sleef_cosrf1_u35_array, Sleef_cosrf4_u35_array, Sleef_cosrf8_u35_array)
+ARRAY_vf2_vf(double, Sleef_sincosr_u35_array, Sleef_sincosrd1_u35_array, Sleef_sincosrd2_u35_array, Sleef_sincosrd4_u35_array)
+ARRAY_vf2_vf(float, Sleef_sincosrf_u35_array, Sleef_sincosrf1_u35_array, Sleef_sincosrf4_u35_array, Sleef_sincosrf8_u35_array)
+ARRAY_vf_vf(double, Sleef_tanr_u35_array, Sleef_tanrd1_u35_array, Sleef_tanrd2_u35_array, Sleef_tanrd4_u35_array)
+ARRAY_vf_vf(float, Sleef_tanrf_u35_array, Sleef_tanrf1_u35_array, Sleef_tanrf4_u35_array, Sleef_tanrf8_u35_array)
+ARRAY_vf_vf(double, Sleef_asinh_u10_array, Sleef_asinhd1_u10_array, Sleef_asinhd2_u10_array, Sleef_asinhd4_u10_array)
+ARRAY_vf_vf(float, Sleef_asinhf_u10_array, Sleef_asinhf1_u10_array, Sleef_asinhf4_u10_array, Sleef_asinhf8_u10_array)
+ARRAY_vf_vf(double, Sleef_acosh_u10_array, Sleef_acoshd1_u10_array, Sleef_acoshd2_u10_array, Sleef_acoshd4_u10_array)
+ARRAY_vf_vf(float, Sleef_acoshf_u10_array, Sleef_acoshf1_u10_array, Sleef_acoshf4_u10_array, Sleef_acoshf8_u10_array)
+ARRAY_vf_vf(double, Sleef_atanh_u10_array, Sleef_atanhd1_u10_array, Sleef_atanhd2_u10_array, Sleef_atanhd4_u10_array)
+ARRAY_vf_vf(float, Sleef_atanhf_u10_array, Sleef_atanhf1_u10_array, Sleef_atanhf4_u10_array, Sleef_atanhf8_u10_array)
+ARRAY_vf_vf(double, Sleef_exp2_u10_array, Sleef_exp2d1_u10_array, Sleef_exp2d2_u10_array, Sleef_exp2d4_u10_array)
+ARRAY_vf_vf(float, Sleef_exp2f_u10_array, Sleef_exp2f1_u10_array, Sleef_exp2f4_u10_array, Sleef_exp2f8_u10_array)
+ARRAY_bf16_vf(Sleef_exp2bf16_u10_array, Sleef_exp2f_u10_array)
+ARRAY_vf_vf(double, Sleef_exp2_u35_array, Sleef_exp2d1_u35_array, Sleef_exp2d2_u35_array, Sleef_exp2d4_u35_array)
+ARRAY_vf_vf(float, Sleef_exp2f_u35_array, Sleef_exp2f1_u35_array, Sleef_exp2f4_u35_array, Sleef_exp2f8_u35_array)
+ARRAY_vf_vf(double, Sleef_exp10_u10_array, Sleef_exp10d1_u10_array, Sleef_exp10d2_u10_array, Sleef_exp10d4_u10_array)
+ARRAY_vf_vf(float, Sleef_exp10f_u10_array, Sleef_exp10f1_u10_array, Sleef_exp10f4_u10_array, Sleef_exp10f8_u10_array)
+ARRAY_bf16_vf(Sleef_exp10bf16_u10_array, Sleef_exp10f_u10_array)
+ARRAY_vf_vf(double, Sleef_exp10_u35_array, Sleef_exp10d1_u35_array, Sleef_exp10d2_u35_array, Sleef_exp10d4_u35_array)
+ARRAY_vf_vf(float, Sleef_exp10f_u35_array, Sleef_exp10f1_u35_array, Sleef_exp10f4_u35_array, Sleef_exp10f8_u35_array)
+ARRAY_vf_vf(double, Sleef_expm1_u10_array, Sleef_expm1d1_u10_array, Sleef_expm1d2_u10_array, Sleef_expm1d4_u10_array)
+ARRAY_vf_vf(float, Sleef_expm1f_u10_array, Sleef_expm1f1_u10_array, Sleef_expm1f4_u10_array, Sleef_expm1f8_u10_array)
+ARRAY_bf16_vf(Sleef_expm1bf16_u10_array, Sleef_expm1f_u10_array)
+ARRAY_vf_vf(double, Sleef_log10_u10_array, Sleef_log10d1_u10_array, Sleef_log10d2_u10_array, Sleef_log10d4_u10_array)
+ARRAY_vf_vf(float, Sleef_log10f_u10_array, Sleef_log10f1_u10_array, Sleef_log10f4_u10_array, Sleef_log10f8_u10_array)
+ARRAY_bf16_vf(Sleef_log10bf16_u10_array, Sleef_log10f_u10_array)
+ARRAY_vf_vf(double, Sleef_log2_u10_array, Sleef_log2d1_u10_array, Sleef_log2d2_u10_array, Sleef_log2d4_u10_array)
+ARRAY_vf_vf(float, Sleef_log2f_u10_array, Sleef_log2f1_u10_array, Sleef_log2f4_u10_array, Sleef_log2f8_u10_array)
+ARRAY_bf16_vf(Sleef_log2bf16_u10_array, Sleef_log2f_u10_array)
+ARRAY_vf_vf(double, Sleef_log2_u35_array, Sleef_log2d1_u35_array, Sleef_log2d2_u35_array, Sleef_log2d4_u35_array)
+ARRAY_vf_vf(float, Sleef_log2f_u35_array, Sleef_log2f1_u35_array, Sleef_log2f4_u35_array, Sleef_log2f8_u35_array)
+ARRAY_vf_vf(double, Sleef_log1p_u10_array, Sleef_log1pd1_u10_array, Sleef_log1pd2_u10_array, Sleef_log1pd4_u10_array)
+ARRAY_vf_vf(float, Sleef_log1pf_u10_array, Sleef_log1pf1_u10_array, Sleef_log1pf4_u10_array, Sleef_log1pf8_u10_array)
+ARRAY_bf16_vf(Sleef_log1pbf16_u10_array, Sleef_log1pf_u10_array)
+ARRAY_vf2_vf(double, Sleef_sincospi_u05_array, Sleef_sincospid1_u05_array, Sleef_sincospid2_u05_array, Sleef_sincospid4_u05_array)
+ARRAY_vf2_vf(float, Sleef_sincospif_u05_array, Sleef_sincospif1_u05_array, Sleef_sincospif4_u05_array, Sleef_sincospif8_u05_array)
+ARRAY_vf2_vf(double, Sleef_sincospi_u35_array, Sleef_sincospid1_u35_array, Sleef_sincospid2_u35_array, Sleef_sincospid4_u35_array)
+ARRAY_vf2_vf(float, Sleef_sincospif_u35_array, Sleef_sincospif1_u35_array, Sleef_sincospif4_u35_array, Sleef_sincospif8_u35_array)
+ARRAY_vf_vf(double, Sleef_sinpi_u05_array, Sleef_sinpid1_u05_array, Sleef_sinpid2_u05_array, Sleef_sinpid4_u05_array)
+ARRAY_vf_vf(float, Sleef_sinpif_u05_array, Sleef_sinpif1_u05_array, Sleef_sinpif4_u05_array, Sleef_sinpif8_u05_array)
+ARRAY_vf_vf(double, Sleef_cospi_u05_array, Sleef_cospid1_u05_array, Sleef_cospid2_u05_array, Sleef_cospid4_u05_array)
+ARRAY_vf_vf(float, Sleef_cospif_u05_array, Sleef_cospif1_u05_array, Sleef_cospif4_u05_array, Sleef_cospif8_u05_array)
+ARRAY_vf_vf_vi(double, Sleef_ldexp_array, Sleef_ldexpd1_array, Sleef_ldexpd2_array, Sleef_ldexpd4_array)
+ARRAY_vi_vf(double, Sleef_ilogb_array, Sleef_ilogbd1_array, Sleef_ilogbd2_array, Sleef_ilogbd4_array)
+ARRAY_vf_vf_vf_vf(double, Sleef_fma_array, Sleef_fmad1_array, Sleef_fmad2_array, Sleef_fmad4_array)
+ARRAY_vf_vf_vf_vf(float, Sleef_fmaf_array, Sleef_fmaf1_array, Sleef_fmaf4_array, Sleef_fmaf8_array)
+ARRAY_vf_vf(double, Sleef_sqrt_array, Sleef_sqrtd1_array, Sleef_sqrtd2_array, Sleef_sqrtd4_array)
+ARRAY_vf_vf(float, Sleef_sqrtf_array, Sleef_sqrtf1_array, Sleef_sqrtf4_array, Sleef_sqrtf8_array)
+ARRAY_bf16_vf(Sleef_sqrtbf16_array, Sleef_sqrtf_array)
+ARRAY_vf_vf(double, Sleef_sqrt_u05_array, Sleef_sqrtd1_u05_array, Sleef_sqrtd2_u05_array, Sleef_sqrtd4_u05_array)
+ARRAY_vf_vf(float, Sleef_sqrtf_u05_array, Sleef_sqrtf1_u05_array, Sleef_sqrtf4_u05_array, Sleef_sqrtf8_u05_array)
+ARRAY_vf_vf(double, Sleef_sqrt_u35_array, Sleef_sqrtd1_u35_array, Sleef_sqrtd2_u35_array, Sleef_sqrtd4_u35_array)
+ARRAY_vf_vf(float, Sleef_sqrtf_u35_array, Sleef_sqrtf1_u35_array, Sleef_sqrtf4_u35_array, Sleef_sqrtf8_u35_array)
+ARRAY_vf_vf_vf(double, Sleef_hypot_u05_array, Sleef_hypotd1_u05_array, Sleef_hypotd2_u05_array, Sleef_hypotd4_u05_array)
+ARRAY_vf_vf_vf(float, Sleef_hypotf_u05_array, Sleef_hypotf1_u05_array, Sleef_hypotf4_u05_array, Sleef_hypotf8_u05_array)
+ARRAY_vf_vf_vf(double, Sleef_hypot_u35_array, Sleef_hypotd1_u35_array, Sleef_hypotd2_u35_array, Sleef_hypotd4_u35_array)
+ARRAY_vf_vf_vf(float, Sleef_hypotf_u35_array, Sleef_hypotf1_u35_array, Sleef_hypotf4_u35_array, Sleef_hypotf8_u35_array)
+ARRAY_vf_vf(double, Sleef_fabs_array, Sleef_fabsd1_array, Sleef_fabsd2_array, Sleef_fabsd4_array)
+ARRAY_vf_vf(float, Sleef_fabsf_array, Sleef_fabsf1_array, Sleef_fabsf4_array, Sleef_fabsf8_array)
+ARRAY_vf_vf_vf(double, Sleef_copysign_array, Sleef_copysignd1_array, Sleef_copysignd2_array, Sleef_copysignd4_array)
+ARRAY_vf_vf_vf(float, Sleef_copysignf_array, Sleef_copysignf1_array, Sleef_copysignf4_array, Sleef_copysignf8_array)
+ARRAY_vf_vf_vf(double, Sleef_fmax_array, Sleef_fmaxd1_array, Sleef_fmaxd2_array, Sleef_fmaxd4_array)
+ARRAY_vf_vf_vf(float, Sleef_fmaxf_array, Sleef_fmaxf1_array, Sleef_fmaxf4_array, Sleef_fmaxf8_array)
+ARRAY_vf_vf_vf(double, Sleef_fmin_array, Sleef_fmind1_array, Sleef_fmind2_array, Sleef_fmind4_array)
+ARRAY_vf_vf_vf(float, Sleef_fminf_array, Sleef_fminf1_array, Sleef_fminf4_array, Sleef_fminf8_array)
+ARRAY_vf_vf_vf(double, Sleef_fdim_array, Sleef_fdimd1_array, Sleef_fdimd2_array, Sleef_fdimd4_array)
+ARRAY_vf_vf_vf(float, Sleef_fdimf_array, Sleef_fdimf1_array, Sleef_fdimf4_array, Sleef_fdimf8_array)
+ARRAY_vf_vf(double, Sleef_trunc_array, Sleef_truncd1_array, Sleef_truncd2_array, Sleef_truncd4_array)
+ARRAY_vf_vf(float, Sleef_truncf_array, Sleef_truncf1_array, Sleef_truncf4_array, Sleef_truncf8_array)
+ARRAY_vf_vf(double, Sleef_floor_array, Sleef_floord1_array, Sleef_floord2_array, Sleef_floord4_array)
+ARRAY_vf_vf(float, Sleef_floorf_array, Sleef_floorf1_array, Sleef_floorf4_array, Sleef_floorf8_array)
+ARRAY_vf_vf(double, Sleef_ceil_array, Sleef_ceild1_array, Sleef_ceild2_array, Sleef_ceild4_array)
+ARRAY_vf_vf(float, Sleef_ceilf_array, Sleef_ceilf1_array, Sleef_ceilf4_array, Sleef_ceilf8_array)
+ARRAY_vf_vf(double, Sleef_round_array, Sleef_roundd1_array, Sleef_roundd2_array, Sleef_roundd4_array)
+ARRAY_vf_vf(float, Sleef_roundf_array, Sleef_roundf1_array, Sleef_roundf4_array, Sleef_roundf8_array)
+ARRAY_vf_vf(double, Sleef_rint_array, Sleef_rintd1_array, Sleef_rintd2_array, Sleef_rintd4_array)
+ARRAY_vf_vf(float, Sleef_rintf_array, Sleef_rintf1_array, Sleef_rintf4_array, Sleef_rintf8_array)
+ARRAY_vf_vf_vf(double, Sleef_nextafter_array, Sleef_nextafterd1_array, Sleef_nextafterd2_array, Sleef_nextafterd4_array)
+ARRAY_vf_vf_vf(float, Sleef_nextafterf_array, Sleef_nextafterf1_array, Sleef_nextafterf4_array, Sleef_nextafterf8_array)
+ARRAY_vf_vf(double, Sleef_frfrexp_array, Sleef_frfrexpd1_array, Sleef_frfrexpd2_array, Sleef_frfrexpd4_array)
+ARRAY_vf_vf(float, Sleef_frfrexpf_array, Sleef_frfrexpf1_array, Sleef_frfrexpf4_array, Sleef_frfrexpf8_array)
+ARRAY_vi_vf(double, Sleef_expfrexp_array, Sleef_expfrexpd1_array, Sleef_expfrexpd2_array, Sleef_expfrexpd4_array)
+ARRAY_vf_vf_vf(double, Sleef_fmod_array, Sleef_fmodd1_array, Sleef_fmodd2_array, Sleef_fmodd4_array)
+ARRAY_vf_vf_vf(float, Sleef_fmodf_array, Sleef_fmodf1_array, Sleef_fmodf4_array, Sleef_fmodf8_array)
+ARRAY_vf_vf_vf(double, Sleef_remainder_array, Sleef_remainderd1_array, Sleef_remainderd2_array, Sleef_remainderd4_array)
+ARRAY_vf_vf_vf(float, Sleef_remainderf_array, Sleef_remainderf1_array, Sleef_remainderf4_array, Sleef_remainderf8_array)
+ARRAY_vf2_vf(double, Sleef_modf_array, Sleef_modfd1_array, Sleef_modfd2_array, Sleef_modfd4_array)
+ARRAY_vf2_vf(float, Sleef_modff_array, Sleef_modff1_array, Sleef_modff4_array, Sleef_modff8_array)
+ARRAY_vf_vf(double, Sleef_lgamma_u10_array, Sleef_lgammad1_u10_array, Sleef_lgammad2_u10_array, Sleef_lgammad4_u10_array)
+ARRAY_vf_vf(float, Sleef_lgammaf_u10_array, Sleef_lgammaf1_u10_array, Sleef_lgammaf4_u10_array, Sleef_lgammaf8_u10_array)
+ARRAY_vf_vf(double, Sleef_tgamma_u10_array, Sleef_tgammad1_u10_array, Sleef_tgammad2_u10_array, Sleef_tgammad4_u10_array)
+ARRAY_vf_vf(float, Sleef_tgammaf_u10_array, Sleef_tgammaf1_u10_array, Sleef_tgammaf4_u10_array, Sleef_tgammaf8_u10_array)
+ARRAY_vf_vf(double, Sleef_erf_u10_array, Sleef_erfd1_u10_array, Sleef_erfd2_u10_array, Sleef_erfd4_u10_array)
+ARRAY_vf_vf(float, Sleef_erff_u10_array, Sleef_erff1_u10_array, Sleef_erff4_u10_array, Sleef_erff8_u10_array)
+ARRAY_bf16_vf(Sleef_erfbf16_u10_array, Sleef_erff_u10_array)
+ARRAY_vf_vf(double, Sleef_erfc_u15_array, Sleef_erfcd1_u15_array, Sleef_erfcd2_u15_array, Sleef_erfcd4_u15_array)
+ARRAY_vf_vf(float, Sleef_erfcf_u15_array, Sleef_erfcf1_u15_array, Sleef_erfcf4_u15_array, Sleef_erfcf8_u15_array)
+ARRAY_bf16_vf(Sleef_erfcbf16_u15_array, Sleef_erfcf_u15_array)
+ARRAY_vf_vf(double, Sleef_sigmoid_u10_array, Sleef_sigmoidd1_u10_array, Sleef_sigmoidd2_u10_array, Sleef_sigmoidd4_u10_array)
+ARRAY_vf_vf(float, Sleef_sigmoidf_u10_array, Sleef_sigmoidf1_u10_array, Sleef_sigmoidf4_u10_array, Sleef_sigmoidf8_u10_array)
+ARRAY_bf16_vf(Sleef_sigmoidbf16_u10_array, Sleef_sigmoidf_u10_array)
+ARRAY_vf_vf(double, Sleef_sigmoid_u35_array, Sleef_sigmoidd1_u35_array, Sleef_sigmoidd2_u35_array, Sleef_sigmoidd4_u35_array)
+ARRAY_vf_vf(float, Sleef_sigmoidf_u35_array, Sleef_sigmoidf1_u35_array, Sleef_sigmoidf4_u35_array, Sleef_sigmoidf8_u35_array)
+ARRAY_vf_vf(double, Sleef_softplus_u10_array, Sleef_softplusd1_u10_array, Sleef_softplusd2_u10_array, Sleef_softplusd4_u10_array)
+ARRAY_vf_vf(float, Sleef_softplusf_u10_array, Sleef_softplusf1_u10_array, Sleef_softplusf4_u10_array, Sleef_softplusf8_u10_array)
+ARRAY_bf16_vf(Sleef_softplusbf16_u10_array, Sleef_softplusf_u10_array)
+ARRAY_vf_vf(double, Sleef_softplus_u35_array, Sleef_softplusd1_u35_array, Sleef_softplusd2_u35_array, Sleef_softplusd4_u35_array)
+ARRAY_vf_vf(float, Sleef_softplusf_u35_array, Sleef_softplusf1_u35_array, Sleef_softplusf4_u35_array, Sleef_softplusf8_u35_array)
+ARRAY_vf_vf(double, Sleef_silu_u10_array, Sleef_silud1_u10_array, Sleef_silud2_u10_array, Sleef_silud4_u10_array)
+ARRAY_vf_vf(float, Sleef_siluf_u10_array, Sleef_siluf1_u10_array, Sleef_siluf4_u10_array, Sleef_siluf8_u10_array)
+ARRAY_bf16_vf(Sleef_silubf16_u10_array, Sleef_siluf_u10_array)
+ARRAY_vf_vf(double, Sleef_silu_u35_array, Sleef_silud1_u35_array, Sleef_silud2_u35_array, Sleef_silud4_u35_array)
+ARRAY_vf_vf(float, Sleef_siluf_u35_array, Sleef_siluf1_u35_array, Sleef_siluf4_u35_array, Sleef_siluf8_u35_array)
+ARRAY_vf_vf(double, Sleef_gelutanh_u10_array, Sleef_gelutanhd1_u10_array, Sleef_gelutanhd2_u10_array, Sleef_gelutanhd4_u10_array)
+ARRAY_vf_vf(float, Sleef_gelutanhf_u10_array, Sleef_gelutanhf1_u10_array, Sleef_gelutanhf4_u10_array, Sleef_gelutanhf8_u10_array)
+ARRAY_bf16_vf(Sleef_gelutanhbf16_u10_array, Sleef_gelutanhf_u10_array)
+ARRAY_vf_vf(double, Sleef_gelutanh_u35_array, Sleef_gelutanhd1_u35_array, Sleef_gelutanhd2_u35_array, Sleef_gelutanhd4_u35_array)
+ARRAY_vf_vf(float, Sleef_gelutanhf_u35_array, Sleef_gelutanhf1_u35_array, Sleef_gelutanhf4_u35_array, Sleef_gelutanhf8_u35_array)
+ARRAY_vf_vf(double, Sleef_gelu_u15_array, Sleef_gelud1_u15_array, Sleef_gelud2_u15_array, Sleef_gelud4_u15_array)
+ARRAY_vf_vf(float, Sleef_geluf_u15_array, Sleef_geluf1_u15_array, Sleef_geluf4_u15_array, Sleef_geluf8_u15_array)
+ARRAY_bf16_vf(Sleef_gelubf16_u15_array, Sleef_geluf_u15_array)
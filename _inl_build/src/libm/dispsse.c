@@ -0,0 +1,606 @@
+//   Copyright Naoki Shibata and contributors 2010 - 2021.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#include <stdint.h>
+#include <assert.h>
+#include <signal.h>
+#include <setjmp.h>
+
+#include "misc.h"
+
+#define SLEEF_IMPORT_IS_EXPORT
+#include "sleef.h"
+
+#define SUBST_IF_EXT1(funcsse4) if (DISPATCH_ALLOWS(DISPATCH_SSE4) && cpuSupportsX86(X86_SSE4_1)) p = funcsse4;
+
+#ifdef ENABLE_AVX2
+#define SUBST_IF_EXT2(funcavx2) if (DISPATCH_ALLOWS(DISPATCH_AVX2128) && cpuSupportsX86(X86_AVX2 | X86_FMA)) p = funcavx2;
+#else
+#define SUBST_IF_EXT2(funcavx2)
+#endif
+
+#define SUBST_IF_EXT3(funcExt3)
+
+#ifdef ENABLE_ALIAS
+#define VECALIAS_vf_vf(fptype, funcNameS, funcName, veclen)		\
+  EXPORT CONST VECTOR_CC fptype _ZGVbN ## veclen ## v_ ## funcNameS(fptype) __attribute__((alias(stringify(funcName))));
+#define VECALIAS_vf_vf_vf(fptype, funcNameS, funcName, veclen)		\
+  EXPORT CONST VECTOR_CC fptype _ZGVbN ## veclen ## vv_ ## funcNameS(fptype, fptype) __attribute__((alias(stringify(funcName))));
+#define VECALIAS_vf_vf_vf_vf(fptype, funcNameS, funcName, veclen)	\
+  EXPORT CONST VECTOR_CC fptype _ZGVbN ## veclen ## vvv_ ## funcNameS(fptype, fptype, fptype) __attribute__((alias(stringify(funcName))));
+#endif
+
+#include "dispatcher.h"
+
+//
+
+DISPATCH_vf_vf(__m128d, 2, Sleef_sin_u35, Sleef_sind1_u35, Sleef_sind2_u35, pnt_sind2_u35, disp_sind2_u35, Sleef_sind2_u35sse2, Sleef_sind2_u35sse4, Sleef_sind2_u35avx2128, Sleef_sind2_u35x)
+DISPATCH_ARRAY_vf_vf(__m128d, double, 2, Sleef_sind2_u35_array, Sleef_sind2_u35sse2, Sleef_sind2_u35sse4, Sleef_sind2_u35avx2128, Sleef_sind2_u35x)
+DISPATCH_vf_vf(__m128, 4, Sleef_sinf_u35, Sleef_sinf1_u35, Sleef_sinf4_u35, pnt_sinf4_u35, disp_sinf4_u35, Sleef_sinf4_u35sse2, Sleef_sinf4_u35sse4, Sleef_sinf4_u35avx2128, Sleef_sinf4_u35x)
+DISPATCH_ARRAY_vf_vf(__m128, float, 4, Sleef_sinf4_u35_array, Sleef_sinf4_u35sse2, Sleef_sinf4_u35sse4, Sleef_sinf4_u35avx2128, Sleef_sinf4_u35x)
+DISPATCH_vf_vf(__m128d, 2, Sleef_cos_u35, Sleef_cosd1_u35, Sleef_cosd2_u35, pnt_cosd2_u35, disp_cosd2_u35, Sleef_cosd2_u35sse2, Sleef_cosd2_u35sse4, Sleef_cosd2_u35avx2128, Sleef_cosd2_u35x)
+DISPATCH_ARRAY_vf_vf(__m128d, double, 2, Sleef_cosd2_u35_array, Sleef_cosd2_u35sse2, Sleef_cosd2_u35sse4, Sleef_cosd2_u35avx2128, Sleef_cosd2_u35x)
+DISPATCH_vf_vf(__m128, 4, Sleef_cosf_u35, Sleef_cosf1_u35, Sleef_cosf4_u35, pnt_cosf4_u35, disp_cosf4_u35, Sleef_cosf4_u35sse2, Sleef_cosf4_u35sse4, Sleef_cosf4_u35avx2128, Sleef_cosf4_u35x)
+DISPATCH_ARRAY_vf_vf(__m128, float, 4, Sleef_cosf4_u35_array, Sleef_cosf4_u35sse2, Sleef_cosf4_u35sse4, Sleef_cosf4_u35avx2128, Sleef_cosf4_u35x)
+DISPATCH_vf2_vf(__m128d, Sleef___m128d_2, 2, Sleef_sincos_u35, Sleef_sincosd1_u35, Sleef_sincosd2_u35, pnt_sincosd2_u35, disp_sincosd2_u35, Sleef_sincosd2_u35sse2, Sleef_sincosd2_u35sse4, Sleef_sincosd2_u35avx2128, Sleef_sincosd2_u35x)
+DISPATCH_ARRAY_vf2_vf(__m128d, Sleef___m128d_2, double, 2, Sleef_sincosd2_u35_array, Sleef_sincosd2_u35sse2, Sleef_sincosd2_u35sse4, Sleef_sincosd2_u35avx2128, Sleef_sincosd2_u35x)
+DISPATCH_vf2_vf(__m128, Sleef___m128_2, 4, Sleef_sincosf_u35, Sleef_sincosf1_u35, Sleef_sincosf4_u35, pnt_sincosf4_u35, disp_sincosf4_u35, Sleef_sincosf4_u35sse2, Sleef_sincosf4_u35sse4, Sleef_sincosf4_u35avx2128, Sleef_sincosf4_u35x)
+DISPATCH_ARRAY_vf2_vf(__m128, Sleef___m128_2, float, 4, Sleef_sincosf4_u35_array, Sleef_sincosf4_u35sse2, Sleef_sincosf4_u35sse4, Sleef_sincosf4_u35avx2128, Sleef_sincosf4_u35x)
+DISPATCH_vf_vf(__m128d, 2, Sleef_tan_u35, Sleef_tand1_u35, Sleef_tand2_u35, pnt_tand2_u35, disp_tand2_u35, Sleef_tand2_u35sse2, Sleef_tand2_u35sse4, Sleef_tand2_u35avx2128, Sleef_tand2_u35x)
+DISPATCH_ARRAY_vf_vf(__m128d, double, 2, Sleef_tand2_u35_array, Sleef_tand2_u35sse2, Sleef_tand2_u35sse4, Sleef_tand2_u35avx2128, Sleef_tand2_u35x)
+DISPATCH_vf_vf(__m128, 4, Sleef_tanf_u35, Sleef_tanf1_u35, Sleef_tanf4_u35, pnt_tanf4_u35, disp_tanf4_u35, Sleef_tanf4_u35sse2, Sleef_tanf4_u35sse4, Sleef_tanf4_u35avx2128, Sleef_tanf4_u35x)
+DISPATCH_ARRAY_vf_vf(__m128, float, 4, Sleef_tanf4_u35_array, Sleef_tanf4_u35sse2, Sleef_tanf4_u35sse4, Sleef_tanf4_u35avx2128, Sleef_tanf4_u35x)
+DISPATCH_vf_vf(__m128d, 2, Sleef_asin_u35, Sleef_asind1_u35, Sleef_asind2_u35, pnt_asind2_u35, disp_asind2_u35, Sleef_asind2_u35sse2, Sleef_asind2_u35sse4, Sleef_asind2_u35avx2128, Sleef_asind2_u35x)
+DISPATCH_ARRAY_vf_vf(__m128d, double, 2, Sleef_asind2_u35_array, Sleef_asind2_u35sse2, Sleef_asind2_u35sse4, Sleef_asind2_u35avx2128, Sleef_asind2_u35x)
+DISPATCH_vf_vf(__m128, 4, Sleef_asinf_u35, Sleef_asinf1_u35, Sleef_asinf4_u35, pnt_asinf4_u35, disp_asinf4_u35, Sleef_asinf4_u35sse2, Sleef_asinf4_u35sse4, Sleef_asinf4_u35avx2128, Sleef_asinf4_u35x)
+DISPATCH_ARRAY_vf_vf(__m128, float, 4, Sleef_asinf4_u35_array, Sleef_asinf4_u35sse2, Sleef_asinf4_u35sse4, Sleef_asinf4_u35avx2128, Sleef_asinf4_u35x)
+DISPATCH_vf_vf(__m128d, 2, Sleef_acos_u35, Sleef_acosd1_u35, Sleef_acosd2_u35, pnt_acosd2_u35, disp_acosd2_u35, Sleef_acosd2_u35sse2, Sleef_acosd2_u35sse4, Sleef_acosd2_u35avx2128, Sleef_acosd2_u35x)
+DISPATCH_ARRAY_vf_vf(__m128d, double, 2, Sleef_acosd2_u35_array, Sleef_acosd2_u35sse2, Sleef_acosd2_u35sse4, Sleef_acosd2_u35avx2128, Sleef_acosd2_u35x)
+DISPATCH_vf_vf(__m128, 4, Sleef_acosf_u35, Sleef_acosf1_u35, Sleef_acosf4_u35, pnt_acosf4_u35, disp_acosf4_u35, Sleef_acosf4_u35sse2, Sleef_acosf4_u35sse4, Sleef_acosf4_u35avx2128, Sleef_acosf4_u35x)
+DISPATCH_ARRAY_vf_vf(__m128, float, 4, Sleef_acosf4_u35_array, Sleef_acosf4_u35sse2, Sleef_acosf4_u35sse4, Sleef_acosf4_u35avx2128, Sleef_acosf4_u35x)
+DISPATCH_vf_vf(__m128d, 2, Sleef_atan_u35, Sleef_atand1_u35, Sleef_atand2_u35, pnt_atand2_u35, disp_atand2_u35, Sleef_atand2_u35sse2, Sleef_atand2_u35sse4, Sleef_atand2_u35avx2128, Sleef_atand2_u35x)
+DISPATCH_ARRAY_vf_vf(__m128d, double, 2, Sleef_atand2_u35_array, Sleef_atand2_u35sse2, Sleef_atand2_u35sse4, Sleef_atand2_u35avx2128, Sleef_atand2_u35x)
+DISPATCH_vf_vf(__m128, 4, Sleef_atanf_u35, Sleef_atanf1_u35, Sleef_atanf4_u35, pnt_atanf4_u35, disp_atanf4_u35, Sleef_atanf4_u35sse2, Sleef_atanf4_u35sse4, Sleef_atanf4_u35avx2128, Sleef_atanf4_u35x)
+DISPATCH_ARRAY_vf_vf(__m128, float, 4, Sleef_atanf4_u35_array, Sleef_atanf4_u35sse2, Sleef_atanf4_u35sse4, Sleef_atanf4_u35avx2128, Sleef_atanf4_u35x)
+DISPATCH_vf_vf_vf(__m128d, 2, Sleef_atan2_u35, Sleef_atan2d1_u35, Sleef_atan2d2_u35, pnt_atan2d2_u35, disp_atan2d2_u35, Sleef_atan2d2_u35sse2, Sleef_atan2d2_u35sse4, Sleef_atan2d2_u35avx2128, Sleef_atan2d2_u35x)
+DISPATCH_ARRAY_vf_vf_vf(__m128d, double, 2, Sleef_atan2d2_u35_array, Sleef_atan2d2_u35sse2, Sleef_atan2d2_u35sse4, Sleef_atan2d2_u35avx2128, Sleef_atan2d2_u35x)
+DISPATCH_vf_vf_vf(__m128, 4, Sleef_atan2f_u35, Sleef_atan2f1_u35, Sleef_atan2f4_u35, pnt_atan2f4_u35, disp_atan2f4_u35, Sleef_atan2f4_u35sse2, Sleef_atan2f4_u35sse4, Sleef_atan2f4_u35avx2128, Sleef_atan2f4_u35x)
+DISPATCH_ARRAY_vf_vf_vf(__m128, float, 4, Sleef_atan2f4_u35_array, Sleef_atan2f4_u35sse2, Sleef_atan2f4_u35sse4, Sleef_atan2f4_u35avx2128, Sleef_atan2f4_u35x)
+DISPATCH_vf_vf(__m128d, 2, Sleef_log_u35, Sleef_logd1_u35, Sleef_logd2_u35, pnt_logd2_u35, disp_logd2_u35, Sleef_logd2_u35sse2, Sleef_logd2_u35sse4, Sleef_logd2_u35avx2128, Sleef_logd2_u35x)
+DISPATCH_ARRAY_vf_vf(__m128d, double, 2, Sleef_logd2_u35_array, Sleef_logd2_u35sse2, Sleef_logd2_u35sse4, Sleef_logd2_u35avx2128, Sleef_logd2_u35x)
+DISPATCH_vf_vf(__m128, 4, Sleef_logf_u35, Sleef_logf1_u35, Sleef_logf4_u35, pnt_logf4_u35, disp_logf4_u35, Sleef_logf4_u35sse2, Sleef_logf4_u35sse4, Sleef_logf4_u35avx2128, Sleef_logf4_u35x)
+DISPATCH_ARRAY_vf_vf(__m128, float, 4, Sleef_logf4_u35_array, Sleef_logf4_u35sse2, Sleef_logf4_u35sse4, Sleef_logf4_u35avx2128, Sleef_logf4_u35x)
+DISPATCH_vf_vf(__m128d, 2, Sleef_cbrt_u35, Sleef_cbrtd1_u35, Sleef_cbrtd2_u35, pnt_cbrtd2_u35, disp_cbrtd2_u35, Sleef_cbrtd2_u35sse2, Sleef_cbrtd2_u35sse4, Sleef_cbrtd2_u35avx2128, Sleef_cbrtd2_u35x)
+DISPATCH_ARRAY_vf_vf(__m128d, double, 2, Sleef_cbrtd2_u35_array, Sleef_cbrtd2_u35sse2, Sleef_cbrtd2_u35sse4, Sleef_cbrtd2_u35avx2128, Sleef_cbrtd2_u35x)
+DISPATCH_vf_vf(__m128, 4, Sleef_cbrtf_u35, Sleef_cbrtf1_u35, Sleef_cbrtf4_u35, pnt_cbrtf4_u35, disp_cbrtf4_u35, Sleef_cbrtf4_u35sse2, Sleef_cbrtf4_u35sse4, Sleef_cbrtf4_u35avx2128, Sleef_cbrtf4_u35x)
+DISPATCH_ARRAY_vf_vf(__m128, float, 4, Sleef_cbrtf4_u35_array, Sleef_cbrtf4_u35sse2, Sleef_cbrtf4_u35sse4, Sleef_cbrtf4_u35avx2128, Sleef_cbrtf4_u35x)
+DISPATCH_vf_vf(__m128d, 2, Sleef_sin_u10, Sleef_sind1_u10, Sleef_sind2_u10, pnt_sind2_u10, disp_sind2_u10, Sleef_sind2_u10sse2, Sleef_sind2_u10sse4, Sleef_sind2_u10avx2128, Sleef_sind2_u10x)
+DISPATCH_ARRAY_vf_vf(__m128d, double, 2, Sleef_sind2_u10_array, Sleef_sind2_u10sse2, Sleef_sind2_u10sse4, Sleef_sind2_u10avx2128, Sleef_sind2_u10x)
+DISPATCH_vf_vf(__m128, 4, Sleef_sinf_u10, Sleef_sinf1_u10, Sleef_sinf4_u10, pnt_sinf4_u10, disp_sinf4_u10, Sleef_sinf4_u10sse2, Sleef_sinf4_u10sse4, Sleef_sinf4_u10avx2128, Sleef_sinf4_u10x)
+DISPATCH_ARRAY_vf_vf(__m128, float, 4, Sleef_sinf4_u10_array, Sleef_sinf4_u10sse2, Sleef_sinf4_u10sse4, Sleef_sinf4_u10avx2128, Sleef_sinf4_u10x)
+DISPATCH_vf_vf(__m128d, 2, Sleef_cos_u10, Sleef_cosd1_u10, Sleef_cosd2_u10, pnt_cosd2_u10, disp_cosd2_u10, Sleef_cosd2_u10sse2, Sleef_cosd2_u10sse4, Sleef_cosd2_u10avx2128, Sleef_cosd2_u10x)
+DISPATCH_ARRAY_vf_vf(__m128d, double, 2, Sleef_cosd2_u10_array, Sleef_cosd2_u10sse2, Sleef_cosd2_u10sse4, Sleef_cosd2_u10avx2128, Sleef_cosd2_u10x)
+DISPATCH_vf_vf(__m128, 4, Sleef_cosf_u10, Sleef_cosf1_u10, Sleef_cosf4_u10, pnt_cosf4_u10, disp_cosf4_u10, Sleef_cosf4_u10sse2, Sleef_cosf4_u10sse4, Sleef_cosf4_u10avx2128, Sleef_cosf4_u10x)
+DISPATCH_ARRAY_vf_vf(__m128, float, 4, Sleef_cosf4_u10_array, Sleef_cosf4_u10sse2, Sleef_cosf4_u10sse4, Sleef_cosf4_u10avx2128, Sleef_cosf4_u10x)
+DISPATCH_vf2_vf(__m128d, Sleef___m128d_2, 2, Sleef_sincos_u10, Sleef_sincosd1_u10, Sleef_sincosd2_u10, pnt_sincosd2_u10, disp_sincosd2_u10, Sleef_sincosd2_u10sse2, Sleef_sincosd2_u10sse4, Sleef_sincosd2_u10avx2128, Sleef_sincosd2_u10x)
+DISPATCH_ARRAY_vf2_vf(__m128d, Sleef___m128d_2, double, 2, Sleef_sincosd2_u10_array, Sleef_sincosd2_u10sse2, Sleef_sincosd2_u10sse4, Sleef_sincosd2_u10avx2128, Sleef_sincosd2_u10x)
+DISPATCH_vf2_vf(__m128, Sleef___m128_2, 4, Sleef_sincosf_u10, Sleef_sincosf1_u10, Sleef_sincosf4_u10, pnt_sincosf4_u10, disp_sincosf4_u10, Sleef_sincosf4_u10sse2, Sleef_sincosf4_u10sse4, Sleef_sincosf4_u10avx2128, Sleef_sincosf4_u10x)
+DISPATCH_ARRAY_vf2_vf(__m128, Sleef___m128_2, float, 4, Sleef_sincosf4_u10_array, Sleef_sincosf4_u10sse2, Sleef_sincosf4_u10sse4, Sleef_sincosf4_u10avx2128, Sleef_sincosf4_u10x)
+DISPATCH_vf_vf(__m128d, 2, Sleef_tan_u10, Sleef_tand1_u10, Sleef_tand2_u10, pnt_tand2_u10, disp_tand2_u10, Sleef_tand2_u10sse2, Sleef_tand2_u10sse4, Sleef_tand2_u10avx2128, Sleef_tand2_u10x)
+DISPATCH_ARRAY_vf_vf(__m128d, double, 2, Sleef_tand2_u10_array, Sleef_tand2_u10sse2, Sleef_tand2_u10sse4, Sleef_tand2_u10avx2128, Sleef_tand2_u10x)
+DISPATCH_vf_vf(__m128, 4, Sleef_tanf_u10, Sleef_tanf1_u10, Sleef_tanf4_u10, pnt_tanf4_u10, disp_tanf4_u10, Sleef_tanf4_u10sse2, Sleef_tanf4_u10sse4, Sleef_tanf4_u10avx2128, Sleef_tanf4_u10x)
+DISPATCH_ARRAY_vf_vf(__m128, float, 4, Sleef_tanf4_u10_array, Sleef_tanf4_u10sse2, Sleef_tanf4_u10sse4, Sleef_tanf4_u10avx2128, Sleef_tanf4_u10x)
+DISPATCH_vf_vf(__m128d, 2, Sleef_asin_u10, Sleef_asind1_u10, Sleef_asind2_u10, pnt_asind2_u10, disp_asind2_u10, Sleef_asind2_u10sse2, Sleef_asind2_u10sse4, Sleef_asind2_u10avx2128, Sleef_asind2_u10x)
+DISPATCH_ARRAY_vf_vf(__m128d, double, 2, Sleef_asind2_u10_array, Sleef_asind2_u10sse2, Sleef_asind2_u10sse4, Sleef_asind2_u10avx2128, Sleef_asind2_u10x)
+DISPATCH_vf_vf(__m128, 4, Sleef_asinf_u10, Sleef_asinf1_u10, Sleef_asinf4_u10, pnt_asinf4_u10, disp_asinf4_u10, Sleef_asinf4_u10sse2, Sleef_asinf4_u10sse4, Sleef_asinf4_u10avx2128, Sleef_asinf4_u10x)
+DISPATCH_ARRAY_vf_vf(__m128, float, 4, Sleef_asinf4_u10_array, Sleef_asinf4_u10sse2, Sleef_asinf4_u10sse4, Sleef_asinf4_u10avx2128, Sleef_asinf4_u10x)
+DISPATCH_vf_vf(__m128d, 2, Sleef_acos_u10, Sleef_acosd1_u10, Sleef_acosd2_u10, pnt_acosd2_u10, disp_acosd2_u10, Sleef_acosd2_u10sse2, Sleef_acosd2_u10sse4, Sleef_acosd2_u10avx2128, Sleef_acosd2_u10x)
+DISPATCH_ARRAY_vf_vf(__m128d, double, 2, Sleef_acosd2_u10_array, Sleef_acosd2_u10sse2, Sleef_acosd2_u10sse4, Sleef_acosd2_u10avx2128, Sleef_acosd2_u10x)
+DISPATCH_vf_vf(__m128, 4, Sleef_acosf_u10, Sleef_acosf1_u10, Sleef_acosf4_u10, pnt_acosf4_u10, disp_acosf4_u10, Sleef_acosf4_u10sse2, Sleef_acosf4_u10sse4, Sleef_acosf4_u10avx2128, Sleef_acosf4_u10x)
+DISPATCH_ARRAY_vf_vf(__m128, float, 4, Sleef_acosf4_u10_array, Sleef_acosf4_u10sse2, Sleef_acosf4_u10sse4, Sleef_acosf4_u10avx2128, Sleef_acosf4_u10x)
+DISPATCH_vf_vf(__m128d, 2, Sleef_atan_u10, Sleef_atand1_u10, Sleef_atand2_u10, pnt_atand2_u10, disp_atand2_u10, Sleef_atand2_u10sse2, Sleef_atand2_u10sse4, Sleef_atand2_u10avx2128, Sleef_atand2_u10x)
+DISPATCH_ARRAY_vf_vf(__m128d, double, 2, Sleef_atand2_u10_array, Sleef_atand2_u10sse2, Sleef_atand2_u10sse4, Sleef_atand2_u10avx2128, Sleef_atand2_u10x)
+DISPATCH_vf_vf(__m128, 4, Sleef_atanf_u10, Sleef_atanf1_u10, Sleef_atanf4_u10, pnt_atanf4_u10, disp_atanf4_u10, Sleef_atanf4_u10sse2, Sleef_atanf4_u10sse4, Sleef_atanf4_u10avx2128, Sleef_atanf4_u10x)
+DISPATCH_ARRAY_vf_vf(__m128, float, 4, Sleef_atanf4_u10_array, Sleef_atanf4_u10sse2, Sleef_atanf4_u10sse4, Sleef_atanf4_u10avx2128, Sleef_atanf4_u10x)
+DISPATCH_vf_vf_vf(__m128d, 2, Sleef_atan2_u10, Sleef_atan2d1_u10, Sleef_atan2d2_u10, pnt_atan2d2_u10, disp_atan2d2_u10, Sleef_atan2d2_u10sse2, Sleef_atan2d2_u10sse4, Sleef_atan2d2_u10avx2128, Sleef_atan2d2_u10x)
+DISPATCH_ARRAY_vf_vf_vf(__m128d, double, 2, Sleef_atan2d2_u10_array, Sleef_atan2d2_u10sse2, Sleef_atan2d2_u10sse4, Sleef_atan2d2_u10avx2128, Sleef_atan2d2_u10x)
+DISPATCH_vf_vf_vf(__m128, 4, Sleef_atan2f_u10, Sleef_atan2f1_u10, Sleef_atan2f4_u10, pnt_atan2f4_u10, disp_atan2f4_u10, Sleef_atan2f4_u10sse2, Sleef_atan2f4_u10sse4, Sleef_atan2f4_u10avx2128, Sleef_atan2f4_u10x)
+DISPATCH_ARRAY_vf_vf_vf(__m128, float, 4, Sleef_atan2f4_u10_array, Sleef_atan2f4_u10sse2, Sleef_atan2f4_u10sse4, Sleef_atan2f4_u10avx2128, Sleef_atan2f4_u10x)
+DISPATCH_vf_vf(__m128d, 2, Sleef_log_u10, Sleef_logd1_u10, Sleef_logd2_u10, pnt_logd2_u10, disp_logd2_u10, Sleef_logd2_u10sse2, Sleef_logd2_u10sse4, Sleef_logd2_u10avx2128, Sleef_logd2_u10x)
+DISPATCH_ARRAY_vf_vf(__m128d, double, 2, Sleef_logd2_u10_array, Sleef_logd2_u10sse2, Sleef_logd2_u10sse4, Sleef_logd2_u10avx2128, Sleef_logd2_u10x)
+DISPATCH_vf_vf(__m128, 4, Sleef_logf_u10, Sleef_logf1_u10, Sleef_logf4_u10, pnt_logf4_u10, disp_logf4_u10, Sleef_logf4_u10sse2, Sleef_logf4_u10sse4, Sleef_logf4_u10avx2128, Sleef_logf4_u10x)
+DISPATCH_ARRAY_vf_vf(__m128, float, 4, Sleef_logf4_u10_array, Sleef_logf4_u10sse2, Sleef_logf4_u10sse4, Sleef_logf4_u10avx2128, Sleef_logf4_u10x)
+DISPATCH_vf_vf(__m128d, 2, Sleef_cbrt_u10, Sleef_cbrtd1_u10, Sleef_cbrtd2_u10, pnt_cbrtd2_u10, disp_cbrtd2_u10, Sleef_cbrtd2_u10sse2, Sleef_cbrtd2_u10sse4, Sleef_cbrtd2_u10avx2128, Sleef_cbrtd2_u10x)
+DISPATCH_ARRAY_vf_vf(__m128d, double, 2, Sleef_cbrtd2_u10_array, Sleef_cbrtd2_u10sse2, Sleef_cbrtd2_u10sse4, Sleef_cbrtd2_u10avx2128, Sleef_cbrtd2_u10x)
+DISPATCH_vf_vf(__m128, 4, Sleef_cbrtf_u10, Sleef_cbrtf1_u10, Sleef_cbrtf4_u10, pnt_cbrtf4_u10, disp_cbrtf4_u10, Sleef_cbrtf4_u10sse2, Sleef_cbrtf4_u10sse4, Sleef_cbrtf4_u10avx2128, Sleef_cbrtf4_u10x)
+DISPATCH_ARRAY_vf_vf(__m128, float, 4, Sleef_cbrtf4_u10_array, Sleef_cbrtf4_u10sse2, Sleef_cbrtf4_u10sse4, Sleef_cbrtf4_u10avx2128, Sleef_cbrtf4_u10x)
+DISPATCH_vf_vf(__m128d, 2, Sleef_exp_u10, Sleef_expd1_u10, Sleef_expd2_u10, pnt_expd2_u10, disp_expd2_u10, Sleef_expd2_u10sse2, Sleef_expd2_u10sse4, Sleef_expd2_u10avx2128, Sleef_expd2_u10x)
+DISPATCH_ARRAY_vf_vf(__m128d, double, 2, Sleef_expd2_u10_array, Sleef_expd2_u10sse2, Sleef_expd2_u10sse4, Sleef_expd2_u10avx2128, Sleef_expd2_u10x)
+DISPATCH_vf_vf(__m128, 4, Sleef_expf_u10, Sleef_expf1_u10, Sleef_expf4_u10, pnt_expf4_u10, disp_expf4_u10, Sleef_expf4_u10sse2, Sleef_expf4_u10sse4, Sleef_expf4_u10avx2128, Sleef_expf4_u10x)
+DISPATCH_ARRAY_vf_vf(__m128, float, 4, Sleef_expf4_u10_array, Sleef_expf4_u10sse2, Sleef_expf4_u10sse4, Sleef_expf4_u10avx2128, Sleef_expf4_u10x)
+DISPATCH_vf_vf_vf(__m128d, 2, Sleef_pow_u10, Sleef_powd1_u10, Sleef_powd2_u10, pnt_powd2_u10, disp_powd2_u10, Sleef_powd2_u10sse2, Sleef_powd2_u10sse4, Sleef_powd2_u10avx2128, Sleef_powd2_u10x)
+DISPATCH_ARRAY_vf_vf_vf(__m128d, double, 2, Sleef_powd2_u10_array, Sleef_powd2_u10sse2, Sleef_powd2_u10sse4, Sleef_powd2_u10avx2128, Sleef_powd2_u10x)
+DISPATCH_vf_vf_vf(__m128, 4, Sleef_powf_u10, Sleef_powf1_u10, Sleef_powf4_u10, pnt_powf4_u10, disp_powf4_u10, Sleef_powf4_u10sse2, Sleef_powf4_u10sse4, Sleef_powf4_u10avx2128, Sleef_powf4_u10x)
+DISPATCH_ARRAY_vf_vf_vf(__m128, float, 4, Sleef_powf4_u10_array, Sleef_powf4_u10sse2, Sleef_powf4_u10sse4, Sleef_powf4_u10avx2128, Sleef_powf4_u10x)
+DISPATCH_vf_vf(__m128d, 2, Sleef_sinh_u10, Sleef_sinhd1_u10, Sleef_sinhd2_u10, pnt_sinhd2_u10, disp_sinhd2_u10, Sleef_sinhd2_u10sse2, Sleef_sinhd2_u10sse4, Sleef_sinhd2_u10avx2128, Sleef_sinhd2_u10x)
+DISPATCH_ARRAY_vf_vf(__m128d, double, 2, Sleef_sinhd2_u10_array, Sleef_sinhd2_u10sse2, Sleef_sinhd2_u10sse4, Sleef_sinhd2_u10avx2128, Sleef_sinhd2_u10x)
+DISPATCH_vf_vf(__m128, 4, Sleef_sinhf_u10, Sleef_sinhf1_u10, Sleef_sinhf4_u10, pnt_sinhf4_u10, disp_sinhf4_u10, Sleef_sinhf4_u10sse2, Sleef_sinhf4_u10sse4, Sleef_sinhf4_u10avx2128, Sleef_sinhf4_u10x)
+DISPATCH_ARRAY_vf_vf(__m128, float, 4, Sleef_sinhf4_u10_array, Sleef_sinhf4_u10sse2, Sleef_sinhf4_u10sse4, Sleef_sinhf4_u10avx2128, Sleef_sinhf4_u10x)
+DISPATCH_vf_vf(__m128d, 2, Sleef_cosh_u10, Sleef_coshd1_u10, Sleef_coshd2_u10, pnt_coshd2_u10, disp_coshd2_u10, Sleef_coshd2_u10sse2, Sleef_coshd2_u10sse4, Sleef_coshd2_u10avx2128, Sleef_coshd2_u10x)
+DISPATCH_ARRAY_vf_vf(__m128d, double, 2, Sleef_coshd2_u10_array, Sleef_coshd2_u10sse2, Sleef_coshd2_u10sse4, Sleef_coshd2_u10avx2128, Sleef_coshd2_u10x)
+DISPATCH_vf_vf(__m128, 4, Sleef_coshf_u10, Sleef_coshf1_u10, Sleef_coshf4_u10, pnt_coshf4_u10, disp_coshf4_u10, Sleef_coshf4_u10sse2, Sleef_coshf4_u10sse4, Sleef_coshf4_u10avx2128, Sleef_coshf4_u10x)
+DISPATCH_ARRAY_vf_vf(__m128, float, 4, Sleef_coshf4_u10_array, Sleef_coshf4_u10sse2, Sleef_coshf4_u10sse4, Sleef_coshf4_u10avx2128, Sleef_coshf4_u10x)
+DISPATCH_vf_vf(__m128d, 2, Sleef_tanh_u10, Sleef_tanhd1_u10, Sleef_tanhd2_u10, pnt_tanhd2_u10, disp_tanhd2_u10, Sleef_tanhd2_u10sse2, Sleef_tanhd2_u10sse4, Sleef_tanhd2_u10avx2128, Sleef_tanhd2_u10x)
+DISPATCH_ARRAY_vf_vf(__m128d, double, 2, Sleef_tanhd2_u10_array, Sleef_tanhd2_u10sse2, Sleef_tanhd2_u10sse4, Sleef_tanhd2_u10avx2128, Sleef_tanhd2_u10x)
+DISPATCH_vf_vf(__m128, 4, Sleef_tanhf_u10, Sleef_tanhf1_u10, Sleef_tanhf4_u10, pnt_tanhf4_u10, disp_tanhf4_u10, Sleef_tanhf4_u10sse2, Sleef_tanhf4_u10sse4, Sleef_tanhf4_u10avx2128, Sleef_tanhf4_u10x)
+DISPATCH_ARRAY_vf_vf(__m128, float, 4, Sleef_tanhf4_u10_array, Sleef_tanhf4_u10sse2, Sleef_tanhf4_u10sse4, Sleef_tanhf4_u10avx2128, Sleef_tanhf4_u10x)
+DISPATCH_vf_vf(__m128d, 2, Sleef_sinh_u35, Sleef_sinhd1_u35, Sleef_sinhd2_u35, pnt_sinhd2_u35, disp_sinhd2_u35, Sleef_sinhd2_u35sse2, Sleef_sinhd2_u35sse4, Sleef_sinhd2_u35avx2128, Sleef_sinhd2_u35x)
+DISPATCH_ARRAY_vf_vf(__m128d, double, 2, Sleef_sinhd2_u35_array, Sleef_sinhd2_u35sse2, Sleef_sinhd2_u35sse4, Sleef_sinhd2_u35avx2128, Sleef_sinhd2_u35x)
+DISPATCH_vf_vf(__m128, 4, Sleef_sinhf_u35, Sleef_sinhf1_u35, Sleef_sinhf4_u35, pnt_sinhf4_u35, disp_sinhf4_u35, Sleef_sinhf4_u35sse2, Sleef_sinhf4_u35sse4, Sleef_sinhf4_u35avx2128, Sleef_sinhf4_u35x)
+DISPATCH_ARRAY_vf_vf(__m128, float, 4, Sleef_sinhf4_u35_array, Sleef_sinhf4_u35sse2, Sleef_sinhf4_u35sse4, Sleef_sinhf4_u35avx2128, Sleef_sinhf4_u35x)
+DISPATCH_vf_vf(__m128d, 2, Sleef_cosh_u35, Sleef_coshd1_u35, Sleef_coshd2_u35, pnt_coshd2_u35, disp_coshd2_u35, Sleef_coshd2_u35sse2, Sleef_coshd2_u35sse4, Sleef_coshd2_u35avx2128, Sleef_coshd2_u35x)
+DISPATCH_ARRAY_vf_vf(__m128d, double, 2, Sleef_coshd2_u35_array, Sleef_coshd2_u35sse2, Sleef_coshd2_u35sse4, Sleef_coshd2_u35avx2128, Sleef_coshd2_u35x)
+DISPATCH_vf_vf(__m128, 4, Sleef_coshf_u35, Sleef_coshf1_u35, Sleef_coshf4_u35, pnt_coshf4_u35, disp_coshf4_u35, Sleef_coshf4_u35sse2, Sleef_coshf4_u35sse4, Sleef_coshf4_u35avx2128, Sleef_coshf4_u35x)
+DISPATCH_ARRAY_vf_vf(__m128, float, 4, Sleef_coshf4_u35_array, Sleef_coshf4_u35sse2, Sleef_coshf4_u35sse4, Sleef_coshf4_u35avx2128, Sleef_coshf4_u35x)
+DISPATCH_vf_vf(__m128d, 2, Sleef_tanh_u35, Sleef_tanhd1_u35, Sleef_tanhd2_u35, pnt_tanhd2_u35, disp_tanhd2_u35, Sleef_tanhd2_u35sse2, Sleef_tanhd2_u35sse4, Sleef_tanhd2_u35avx2128, Sleef_tanhd2_u35x)
+DISPATCH_ARRAY_vf_vf(__m128d, double, 2, Sleef_tanhd2_u35_array, Sleef_tanhd2_u35sse2, Sleef_tanhd2_u35sse4, Sleef_tanhd2_u35avx2128, Sleef_tanhd2_u35x)
+DISPATCH_vf_vf(__m128, 4, Sleef_tanhf_u35, Sleef_tanhf1_u35, Sleef_tanhf4_u35, pnt_tanhf4_u35, disp_tanhf4_u35, Sleef_tanhf4_u35sse2, Sleef_tanhf4_u35sse4, Sleef_tanhf4_u35avx2128, Sleef_tanhf4_u35x)
+DISPATCH_ARRAY_vf_vf(__m128, float, 4, Sleef_tanhf4_u35_array, Sleef_tanhf4_u35sse2, Sleef_tanhf4_u35sse4, Sleef_tanhf4_u35avx2128, Sleef_tanhf4_u35x)
+DISPATCH_vf_vf(__m128, 4, Sleef_fastsinf_u3500, Sleef_fastsinf1_u3500, Sleef_fastsinf4_u3500, pnt_fastsinf4_u3500, disp_fastsinf4_u3500, Sleef_fastsinf4_u3500sse2, Sleef_fastsinf4_u3500sse4, Sleef_fastsinf4_u3500avx2128, Sleef_fastsinf4_u3500x)
+DISPATCH_ARRAY_vf_vf(__m128, float, 4, Sleef_fastsinf4_u3500_array, Sleef_fastsinf4_u3500sse2, Sleef_fastsinf4_u3500sse4, Sleef_fastsinf4_u3500avx2128, Sleef_fastsinf4_u3500x)
+DISPATCH_vf_vf(__m128, 4, Sleef_fastcosf_u3500, Sleef_fastcosf1_u3500, Sleef_fastcosf4_u3500, pnt_fastcosf4_u3500, disp_fastcosf4_u3500, Sleef_fastcosf4_u3500sse2, Sleef_fastcosf4_u3500sse4, Sleef_fastcosf4_u3500avx2128, Sleef_fastcosf4_u3500x)
+DISPATCH_ARRAY_vf_vf(__m128, float, 4, Sleef_fastcosf4_u3500_array, Sleef_fastcosf4_u3500sse2, Sleef_fastcosf4_u3500sse4, Sleef_fastcosf4_u3500avx2128, Sleef_fastcosf4_u3500x)
+DISPATCH_vf_vf_vf(__m128, 4, Sleef_fastpowf_u3500, Sleef_fastpowf1_u3500, Sleef_fastpowf4_u3500, pnt_fastpowf4_u3500, disp_fastpowf4_u3500, Sleef_fastpowf4_u3500sse2, Sleef_fastpowf4_u3500sse4, Sleef_fastpowf4_u3500avx2128, Sleef_fastpowf4_u3500x)
+DISPATCH_ARRAY_vf_vf_vf(__m128, float, 4, Sleef_fastpowf4_u3500_array, Sleef_fastpowf4_u3500sse2, Sleef_fastpowf4_u3500sse4, Sleef_fastpowf4_u3500avx2128, Sleef_fastpowf4_u3500x)
+DISPATCH_vf_vf(__m128d, 2, Sleef_fastexp_u3500, Sleef_fastexpd1_u3500, Sleef_fastexpd2_u3500, pnt_fastexpd2_u3500, disp_fastexpd2_u3500, Sleef_fastexpd2_u3500sse2, Sleef_fastexpd2_u3500sse4, Sleef_fastexpd2_u3500avx2128, Sleef_fastexpd2_u3500x)
+DISPATCH_ARRAY_vf_vf(__m128d, double, 2, Sleef_fastexpd2_u3500_array, Sleef_fastexpd2_u3500sse2, Sleef_fastexpd2_u3500sse4, Sleef_fastexpd2_u3500avx2128, Sleef_fastexpd2_u3500x)
+DISPATCH_vf_vf(__m128, 4, Sleef_fastexpf_u3500, Sleef_fastexpf1_u3500, Sleef_fastexpf4_u3500, pnt_fastexpf4_u3500, disp_fastexpf4_u3500, Sleef_fastexpf4_u3500sse2, Sleef_fastexpf4_u3500sse4, Sleef_fastexpf4_u3500avx2128, Sleef_fastexpf4_u3500x)
+DISPATCH_ARRAY_vf_vf(__m128, float, 4, Sleef_fastexpf4_u3500_array, Sleef_fastexpf4_u3500sse2, Sleef_fastexpf4_u3500sse4, Sleef_fastexpf4_u3500avx2128, Sleef_fastexpf4_u3500x)
+DISPATCH_vf_vf(__m128d, 2, Sleef_fastexp2_u3500, Sleef_fastexp2d1_u3500, Sleef_fastexp2d2_u3500, pnt_fastexp2d2_u3500, disp_fastexp2d2_u3500, Sleef_fastexp2d2_u3500sse2, Sleef_fastexp2d2_u3500sse4, Sleef_fastexp2d2_u3500avx2128, Sleef_fastexp2d2_u3500x)
+DISPATCH_ARRAY_vf_vf(__m128d, double, 2, Sleef_fastexp2d2_u3500_array, Sleef_fastexp2d2_u3500sse2, Sleef_fastexp2d2_u3500sse4, Sleef_fastexp2d2_u3500avx2128, Sleef_fastexp2d2_u3500x)
+DISPATCH_vf_vf(__m128, 4, Sleef_fastexp2f_u3500, Sleef_fastexp2f1_u3500, Sleef_fastexp2f4_u3500, pnt_fastexp2f4_u3500, disp_fastexp2f4_u3500, Sleef_fastexp2f4_u3500sse2, Sleef_fastexp2f4_u3500sse4, Sleef_fastexp2f4_u3500avx2128, Sleef_fastexp2f4_u3500x)
+DISPATCH_ARRAY_vf_vf(__m128, float, 4, Sleef_fastexp2f4_u3500_array, Sleef_fastexp2f4_u3500sse2, Sleef_fastexp2f4_u3500sse4, Sleef_fastexp2f4_u3500avx2128, Sleef_fastexp2f4_u3500x)
+DISPATCH_vf_vf(__m128d, 2, Sleef_fastlog_u3500, Sleef_fastlogd1_u3500, Sleef_fastlogd2_u3500, pnt_fastlogd2_u3500, disp_fastlogd2_u3500, Sleef_fastlogd2_u3500sse2, Sleef_fastlogd2_u3500sse4, Sleef_fastlogd2_u3500avx2128, Sleef_fastlogd2_u3500x)
+DISPATCH_ARRAY_vf_vf(__m128d, double, 2, Sleef_fastlogd2_u3500_array, Sleef_fastlogd2_u3500sse2, Sleef_fastlogd2_u3500sse4, Sleef_fastlogd2_u3500avx2128, Sleef_fastlogd2_u3500x)
+DISPATCH_vf_vf(__m128, 4, Sleef_fastlogf_u3500, Sleef_fastlogf1_u3500, Sleef_fastlogf4_u3500, pnt_fastlogf4_u3500, disp_fastlogf4_u3500, Sleef_fastlogf4_u3500sse2, Sleef_fastlogf4_u3500sse4, Sleef_fastlogf4_u3500avx2128, Sleef_fastlogf4_u3500x)
+DISPATCH_ARRAY_vf_vf(__m128, float, 4, Sleef_fastlogf4_u3500_array, Sleef_fastlogf4_u3500sse2, Sleef_fastlogf4_u3500sse4, Sleef_fastlogf4_u3500avx2128, Sleef_fastlogf4_u3500x)
+DISPATCH_vf_vf(__m128d, 2, Sleef_fastlog2_u3500, Sleef_fastlog2d1_u3500, Sleef_fastlog2d2_u3500, pnt_fastlog2d2_u3500, disp_fastlog2d2_u3500, Sleef_fastlog2d2_u3500sse2, Sleef_fastlog2d2_u3500sse4, Sleef_fastlog2d2_u3500avx2128, Sleef_fastlog2d2_u3500x)
+DISPATCH_ARRAY_vf_vf(__m128d, double, 2, Sleef_fastlog2d2_u3500_array, Sleef_fastlog2d2_u3500sse2, Sleef_fastlog2d2_u3500sse4, Sleef_fastlog2d2_u3500avx2128, Sleef_fastlog2d2_u3500x)
+DISPATCH_vf_vf(__m128, 4, Sleef_fastlog2f_u3500, Sleef_fastlog2f1_u3500, Sleef_fastlog2f4_u3500, pnt_fastlog2f4_u3500, disp_fastlog2f4_u3500, Sleef_fastlog2f4_u3500sse2, Sleef_fastlog2f4_u3500sse4, Sleef_fastlog2f4_u3500avx2128, Sleef_fastlog2f4_u3500x)
+DISPATCH_ARRAY_vf_vf(__m128, float, 4, Sleef_fastlog2f4_u3500_array, Sleef_fastlog2f4_u3500sse2, Sleef_fastlog2f4_u3500sse4, Sleef_fastlog2f4_u3500avx2128, Sleef_fastlog2f4_u3500x)
+DISPATCH_vf_vf(__m128d, 2, Sleef_fasttanh_u3500, Sleef_fasttanhd1_u3500, Sleef_fasttanhd2_u3500, pnt_fasttanhd2_u3500, disp_fasttanhd2_u3500, Sleef_fasttanhd2_u3500sse2, Sleef_fasttanhd2_u3500sse4, Sleef_fasttanhd2_u3500avx2128, Sleef_fasttanhd2_u3500x)
+DISPATCH_ARRAY_vf_vf(__m128d, double, 2, Sleef_fasttanhd2_u3500_array, Sleef_fasttanhd2_u3500sse2, Sleef_fasttanhd2_u3500sse4, Sleef_fasttanhd2_u3500avx2128, Sleef_fasttanhd2_u3500x)
+DISPATCH_vf_vf(__m128, 4, Sleef_fasttanhf_u3500, Sleef_fasttanhf1_u3500, Sleef_fasttanhf4_u3500, pnt_fasttanhf4_u3500, disp_fasttanhf4_u3500, Sleef_fasttanhf4_u3500sse2, Sleef_fasttanhf4_u3500sse4, Sleef_fasttanhf4_u3500avx2128, Sleef_fasttanhf4_u3500x)
+DISPATCH_ARRAY_vf_vf(__m128, float, 4, Sleef_fasttanhf4_u3500_array, Sleef_fasttanhf4_u3500sse2, Sleef_fasttanhf4_u3500sse4, Sleef_fasttanhf4_u3500avx2128, Sleef_fasttanhf4_u3500x)
+DISPATCH_vf_vf_vf(__m128d, 2, Sleef_fastatan2_u3500, Sleef_fastatan2d1_u3500, Sleef_fastatan2d2_u3500, pnt_fastatan2d2_u3500, disp_fastatan2d2_u3500, Sleef_fastatan2d2_u3500sse2, Sleef_fastatan2d2_u3500sse4, Sleef_fastatan2d2_u3500avx2128, Sleef_fastatan2d2_u3500x)
+DISPATCH_ARRAY_vf_vf_vf(__m128d, double, 2, Sleef_fastatan2d2_u3500_array, Sleef_fastatan2d2_u3500sse2, Sleef_fastatan2d2_u3500sse4, Sleef_fastatan2d2_u3500avx2128, Sleef_fastatan2d2_u3500x)
+DISPATCH_vf_vf_vf(__m128, 4, Sleef_fastatan2f_u3500, Sleef_fastatan2f1_u3500, Sleef_fastatan2f4_u3500, pnt_fastatan2f4_u3500, disp_fastatan2f4_u3500, Sleef_fastatan2f4_u3500sse2, Sleef_fastatan2f4_u3500sse4, Sleef_fastatan2f4_u3500avx2128, Sleef_fastatan2f4_u3500x)
+DISPATCH_ARRAY_vf_vf_vf(__m128, float, 4, Sleef_fastatan2f4_u3500_array, Sleef_fastatan2f4_u3500sse2, Sleef_fastatan2f4_u3500sse4, Sleef_fastatan2f4_u3500avx2128, Sleef_fastatan2f4_u3500x)
+DISPATCH_vf_vf(__m128d, 2, Sleef_fastrsqrt_u3500, Sleef_fastrsqrtd1_u3500, Sleef_fastrsqrtd2_u3500, pnt_fastrsqrtd2_u3500, disp_fastrsqrtd2_u3500, Sleef_fastrsqrtd2_u3500sse2, Sleef_fastrsqrtd2_u3500sse4, Sleef_fastrsqrtd2_u3500avx2128, Sleef_fastrsqrtd2_u3500x)
+DISPATCH_ARRAY_vf_vf(__m128d, double, 2, Sleef_fastrsqrtd2_u3500_array, Sleef_fastrsqrtd2_u3500sse2, Sleef_fastrsqrtd2_u3500sse4, Sleef_fastrsqrtd2_u3500avx2128, Sleef_fastrsqrtd2_u3500x)
+DISPATCH_vf_vf(__m128, 4, Sleef_fastrsqrtf_u3500, Sleef_fastrsqrtf1_u3500, Sleef_fastrsqrtf4_u3500, pnt_fastrsqrtf4_u3500, disp_fastrsqrtf4_u3500, Sleef_fastrsqrtf4_u3500sse2, Sleef_fastrsqrtf4_u3500sse4, Sleef_fastrsqrtf4_u3500avx2128, Sleef_fastrsqrtf4_u3500x)
+DISPATCH_ARRAY_vf_vf(__m128, float, 4, Sleef_fastrsqrtf4_u3500_array, Sleef_fastrsqrtf4_u3500sse2, Sleef_fastrsqrtf4_u3500sse4, Sleef_fastrsqrtf4_u3500avx2128, Sleef_fastrsqrtf4_u3500x)
+DISPATCH_vf_vf(__m128d, 2, Sleef_fastrcp_u3500, Sleef_fastrcpd1_u3500, Sleef_fastrcpd2_u3500, pnt_fastrcpd2_u3500, disp_fastrcpd2_u3500, Sleef_fastrcpd2_u3500sse2, Sleef_fastrcpd2_u3500sse4, Sleef_fastrcpd2_u3500avx2128, Sleef_fastrcpd2_u3500x)
+DISPATCH_ARRAY_vf_vf(__m128d, double, 2, Sleef_fastrcpd2_u3500_array, Sleef_fastrcpd2_u3500sse2, Sleef_fastrcpd2_u3500sse4, Sleef_fastrcpd2_u3500avx2128, Sleef_fastrcpd2_u3500x)
+DISPATCH_vf_vf(__m128, 4, Sleef_fastrcpf_u3500, Sleef_fastrcpf1_u3500, Sleef_fastrcpf4_u3500, pnt_fastrcpf4_u3500, disp_fastrcpf4_u3500, Sleef_fastrcpf4_u3500sse2, Sleef_fastrcpf4_u3500sse4, Sleef_fastrcpf4_u3500avx2128, Sleef_fastrcpf4_u3500x)
+DISPATCH_ARRAY_vf_vf(__m128, float, 4, Sleef_fastrcpf4_u3500_array, Sleef_fastrcpf4_u3500sse2, Sleef_fastrcpf4_u3500sse4, Sleef_fastrcpf4_u3500avx2128, Sleef_fastrcpf4_u3500x)
+DISPATCH_vf_vf(__m128d, 2, Sleef_sinr_u35, Sleef_sinrd1_u35, Sleef_sinrd2_u35, pnt_sinrd2_u35, disp_sinrd2_u35, Sleef_sinrd2_u35sse2, Sleef_sinrd2_u35sse4, Sleef_sinrd2_u35avx2128, Sleef_sinrd2_u35x)
+DISPATCH_ARRAY_vf_vf(__m128d, double, 2, Sleef_sinrd2_u35_array, Sleef_sinrd2_u35sse2, Sleef_sinrd2_u35sse4, Sleef_sinrd2_u35avx2128, Sleef_sinrd2_u35x)
+DISPATCH_vf_vf(__m128, 4, Sleef_sinrf_u35, Sleef_sinrf1_u35, Sleef_sinrf4_u35, pnt_sinrf4_u35, disp_sinrf4_u35, Sleef_sinrf4_u35sse2, Sleef_sinrf4_u35sse4, Sleef_sinrf4_u35avx2128, Sleef_sinrf4_u35x)
+DISPATCH_ARRAY_vf_vf(__m128, float, 4, Sleef_sinrf4_u35_array, Sleef_sinrf4_u35sse2, Sleef_sinrf4_u35sse4, Sleef_sinrf4_u35avx2128, Sleef_sinrf4_u35x)
+DISPATCH_vf_vf(__m128d, 2, Sleef_cosr_u35, Sleef_cosrd1_u35, Sleef_cosrd2_u35, pnt_cosrd2_u35, disp_cosrd2_u35, Sleef_cosrd2_u35sse2, Sleef_cosrd2_u35sse4, Sleef_cosrd2_u35avx2128, Sleef_cosrd2_u35x)
+DISPATCH_ARRAY_vf_vf(__m128d, double, 2, Sleef_cosrd2_u35_array, Sleef_cosrd2_u35sse2, Sleef_cosrd2_u35sse4, Sleef_cosrd2_u35avx2128, Sleef_cosrd2_u35x)
+DISPATCH_vf_vf(__m128, 4, Sleef_cosrf_u35, Sleef_cosrf1_u35, Sleef_cosrf4_u35, pnt_cosrf4_u35, disp_cosrf4_u35, Sleef_cosrf4_u35sse2, Sleef_cosrf4_u35sse4, Sleef_cosrf4_u35avx2128, Sleef_cosrf4_u35x)
+DISPATCH_ARRAY_vf_vf(__m128, float, 4, Sleef_cosrf4_u35_array, Sleef_cosrf4_u35sse2, Sleef_cosrf4_u35sse4, Sleef_cosrf4_u35avx2128, Sleef_cosrf4_u35x)
+DISPATCH_vf2_vf(__m128d, Sleef___m128d_2, 2, Sleef_sincosr_u35, Sleef_sincosrd1_u35, Sleef_sincosrd2_u35, pnt_sincosrd2_u35, disp_sincosrd2_u35, Sleef_sincosrd2_u35sse2, Sleef_sincosrd2_u35sse4, Sleef_sincosrd2_u35avx2128, Sleef_sincosrd2_u35x)
+DISPATCH_ARRAY_vf2_vf(__m128d, Sleef___m128d_2, double, 2, Sleef_sincosrd2_u35_array, Sleef_sincosrd2_u35sse2, Sleef_sincosrd2_u35sse4, Sleef_sincosrd2_u35avx2128, Sleef_sincosrd2_u35x)
+DISPATCH_vf2_vf(__m128, Sleef___m128_2, 4, Sleef_sincosrf_u35, Sleef_sincosrf1_u35, Sleef_sincosrf4_u35, pnt_sincosrf4_u35, disp_sincosrf4_u35, Sleef_sincosrf4_u35sse2, Sleef_sincosrf4_u35sse4, Sleef_sincosrf4_u35avx2128, Sleef_sincosrf4_u35x)
+DISPATCH_ARRAY_vf2_vf(__m128, Sleef___m128_2, float, 4, Sleef_sincosrf4_u35_array, Sleef_sincosrf4_u35sse2, Sleef_sincosrf4_u35sse4, Sleef_sincosrf4_u35avx2128, Sleef_sincosrf4_u35x)
+DISPATCH_vf_vf(__m128d, 2, Sleef_tanr_u35, Sleef_tanrd1_u35, Sleef_tanrd2_u35, pnt_tanrd2_u35, disp_tanrd2_u35, Sleef_tanrd2_u35sse2, Sleef_tanrd2_u35sse4, Sleef_tanrd2_u35avx2128, Sleef_tanrd2_u35x)
+DISPATCH_ARRAY_vf_vf(__m128d, double, 2, Sleef_tanrd2_u35_array, Sleef_tanrd2_u35sse2, Sleef_tanrd2_u35sse4, Sleef_tanrd2_u35avx2128, Sleef_tanrd2_u35x)
+DISPATCH_vf_vf(__m128, 4, Sleef_tanrf_u35, Sleef_tanrf1_u35, Sleef_tanrf4_u35, pnt_tanrf4_u35, disp_tanrf4_u35, Sleef_tanrf4_u35sse2, Sleef_tanrf4_u35sse4, Sleef_tanrf4_u35avx2128, Sleef_tanrf4_u35x)
+DISPATCH_ARRAY_vf_vf(__m128, float, 4, Sleef_tanrf4_u35_array, Sleef_tanrf4_u35sse2, Sleef_tanrf4_u35sse4, Sleef_tanrf4_u35avx2128, Sleef_tanrf4_u35x)
+DISPATCH_vf_vf(__m128d, 2, Sleef_asinh_u10, Sleef_asinhd1_u10, Sleef_asinhd2_u10, pnt_asinhd2_u10, disp_asinhd2_u10, Sleef_asinhd2_u10sse2, Sleef_asinhd2_u10sse4, Sleef_asinhd2_u10avx2128, Sleef_asinhd2_u10x)
+DISPATCH_ARRAY_vf_vf(__m128d, double, 2, Sleef_asinhd2_u10_array, Sleef_asinhd2_u10sse2, Sleef_asinhd2_u10sse4, Sleef_asinhd2_u10avx2128, Sleef_asinhd2_u10x)
+DISPATCH_vf_vf(__m128, 4, Sleef_asinhf_u10, Sleef_asinhf1_u10, Sleef_asinhf4_u10, pnt_asinhf4_u10, disp_asinhf4_u10, Sleef_asinhf4_u10sse2, Sleef_asinhf4_u10sse4, Sleef_asinhf4_u10avx2128, Sleef_asinhf4_u10x)
+DISPATCH_ARRAY_vf_vf(__m128, float, 4, Sleef_asinhf4_u10_array, Sleef_asinhf4_u10sse2, Sleef_asinhf4_u10sse4, Sleef_asinhf4_u10avx2128, Sleef_asinhf4_u10x)
+DISPATCH_vf_vf(__m128d, 2, Sleef_acosh_u10, Sleef_acoshd1_u10, Sleef_acoshd2_u10, pnt_acoshd2_u10, disp_acoshd2_u10, Sleef_acoshd2_u10sse2, Sleef_acoshd2_u10sse4, Sleef_acoshd2_u10avx2128, Sleef_acoshd2_u10x)
+DISPATCH_ARRAY_vf_vf(__m128d, double, 2, Sleef_acoshd2_u10_array, Sleef_acoshd2_u10sse2, Sleef_acoshd2_u10sse4, Sleef_acoshd2_u10avx2128, Sleef_acoshd2_u10x)
+DISPATCH_vf_vf(__m128, 4, Sleef_acoshf_u10, Sleef_acoshf1_u10, Sleef_acoshf4_u10, pnt_acoshf4_u10, disp_acoshf4_u10, Sleef_acoshf4_u10sse2, Sleef_acoshf4_u10sse4, Sleef_acoshf4_u10avx2128, Sleef_acoshf4_u10x)
+DISPATCH_ARRAY_vf_vf(__m128, float, 4, Sleef_acoshf4_u10_array, Sleef_acoshf4_u10sse2, Sleef_acoshf4_u10sse4, Sleef_acoshf4_u10avx2128, Sleef_acoshf4_u10x)
+DISPATCH_vf_vf(__m128d, 2, Sleef_atanh_u10, Sleef_atanhd1_u10, Sleef_atanhd2_u10, pnt_atanhd2_u10, disp_atanhd2_u10, Sleef_atanhd2_u10sse2, Sleef_atanhd2_u10sse4, Sleef_atanhd2_u10avx2128, Sleef_atanhd2_u10x)
+DISPATCH_ARRAY_vf_vf(__m128d, double, 2, Sleef_atanhd2_u10_array, Sleef_atanhd2_u10sse2, Sleef_atanhd2_u10sse4, Sleef_atanhd2_u10avx2128, Sleef_atanhd2_u10x)
+DISPATCH_vf_vf(__m128, 4, Sleef_atanhf_u10, Sleef_atanhf1_u10, Sleef_atanhf4_u10, pnt_atanhf4_u10, disp_atanhf4_u10, Sleef_atanhf4_u10sse2, Sleef_atanhf4_u10sse4, Sleef_atanhf4_u10avx2128, Sleef_atanhf4_u10x)
+DISPATCH_ARRAY_vf_vf(__m128, float, 4, Sleef_atanhf4_u10_array, Sleef_atanhf4_u10sse2, Sleef_atanhf4_u10sse4, Sleef_atanhf4_u10avx2128, Sleef_atanhf4_u10x)
+DISPATCH_vf_vf(__m128d, 2, Sleef_exp2_u10, Sleef_exp2d1_u10, Sleef_exp2d2_u10, pnt_exp2d2_u10, disp_exp2d2_u10, Sleef_exp2d2_u10sse2, Sleef_exp2d2_u10sse4, Sleef_exp2d2_u10avx2128, Sleef_exp2d2_u10x)
+DISPATCH_ARRAY_vf_vf(__m128d, double, 2, Sleef_exp2d2_u10_array, Sleef_exp2d2_u10sse2, Sleef_exp2d2_u10sse4, Sleef_exp2d2_u10avx2128, Sleef_exp2d2_u10x)
+DISPATCH_vf_vf(__m128, 4, Sleef_exp2f_u10, Sleef_exp2f1_u10, Sleef_exp2f4_u10, pnt_exp2f4_u10, disp_exp2f4_u10, Sleef_exp2f4_u10sse2, Sleef_exp2f4_u10sse4, Sleef_exp2f4_u10avx2128, Sleef_exp2f4_u10x)
+DISPATCH_ARRAY_vf_vf(__m128, float, 4, Sleef_exp2f4_u10_array, Sleef_exp2f4_u10sse2, Sleef_exp2f4_u10sse4, Sleef_exp2f4_u10avx2128, Sleef_exp2f4_u10x)
+DISPATCH_vf_vf(__m128d, 2, Sleef_exp2_u35, Sleef_exp2d1_u35, Sleef_exp2d2_u35, pnt_exp2d2_u35, disp_exp2d2_u35, Sleef_exp2d2_u35sse2, Sleef_exp2d2_u35sse4, Sleef_exp2d2_u35avx2128, Sleef_exp2d2_u35x)
+DISPATCH_ARRAY_vf_vf(__m128d, double, 2, Sleef_exp2d2_u35_array, Sleef_exp2d2_u35sse2, Sleef_exp2d2_u35sse4, Sleef_exp2d2_u35avx2128, Sleef_exp2d2_u35x)
+DISPATCH_vf_vf(__m128, 4, Sleef_exp2f_u35, Sleef_exp2f1_u35, Sleef_exp2f4_u35, pnt_exp2f4_u35, disp_exp2f4_u35, Sleef_exp2f4_u35sse2, Sleef_exp2f4_u35sse4, Sleef_exp2f4_u35avx2128, Sleef_exp2f4_u35x)
+DISPATCH_ARRAY_vf_vf(__m128, float, 4, Sleef_exp2f4_u35_array, Sleef_exp2f4_u35sse2, Sleef_exp2f4_u35sse4, Sleef_exp2f4_u35avx2128, Sleef_exp2f4_u35x)
+DISPATCH_vf_vf(__m128d, 2, Sleef_exp10_u10, Sleef_exp10d1_u10, Sleef_exp10d2_u10, pnt_exp10d2_u10, disp_exp10d2_u10, Sleef_exp10d2_u10sse2, Sleef_exp10d2_u10sse4, Sleef_exp10d2_u10avx2128, Sleef_exp10d2_u10x)
+DISPATCH_ARRAY_vf_vf(__m128d, double, 2, Sleef_exp10d2_u10_array, Sleef_exp10d2_u10sse2, Sleef_exp10d2_u10sse4, Sleef_exp10d2_u10avx2128, Sleef_exp10d2_u10x)
+DISPATCH_vf_vf(__m128, 4, Sleef_exp10f_u10, Sleef_exp10f1_u10, Sleef_exp10f4_u10, pnt_exp10f4_u10, disp_exp10f4_u10, Sleef_exp10f4_u10sse2, Sleef_exp10f4_u10sse4, Sleef_exp10f4_u10avx2128, Sleef_exp10f4_u10x)
+DISPATCH_ARRAY_vf_vf(__m128, float, 4, Sleef_exp10f4_u10_array, Sleef_exp10f4_u10sse2, Sleef_exp10f4_u10sse4, Sleef_exp10f4_u10avx2128, Sleef_exp10f4_u10x)
+DISPATCH_vf_vf(__m128d, 2, Sleef_exp10_u35, Sleef_exp10d1_u35, Sleef_exp10d2_u35, pnt_exp10d2_u35, disp_exp10d2_u35, Sleef_exp10d2_u35sse2, Sleef_exp10d2_u35sse4, Sleef_exp10d2_u35avx2128, Sleef_exp10d2_u35x)
+DISPATCH_ARRAY_vf_vf(__m128d, double, 2, Sleef_exp10d2_u35_array, Sleef_exp10d2_u35sse2, Sleef_exp10d2_u35sse4, Sleef_exp10d2_u35avx2128, Sleef_exp10d2_u35x)
+DISPATCH_vf_vf(__m128, 4, Sleef_exp10f_u35, Sleef_exp10f1_u35, Sleef_exp10f4_u35, pnt_exp10f4_u35, disp_exp10f4_u35, Sleef_exp10f4_u35sse2, Sleef_exp10f4_u35sse4, Sleef_exp10f4_u35avx2128, Sleef_exp10f4_u35x)
+DISPATCH_ARRAY_vf_vf(__m128, float, 4, Sleef_exp10f4_u35_array, Sleef_exp10f4_u35sse2, Sleef_exp10f4_u35sse4, Sleef_exp10f4_u35avx2128, Sleef_exp10f4_u35x)
+DISPATCH_vf_vf(__m128d, 2, Sleef_expm1_u10, Sleef_expm1d1_u10, Sleef_expm1d2_u10, pnt_expm1d2_u10, disp_expm1d2_u10, Sleef_expm1d2_u10sse2, Sleef_expm1d2_u10sse4, Sleef_expm1d2_u10avx2128, Sleef_expm1d2_u10x)
+DISPATCH_ARRAY_vf_vf(__m128d, double, 2, Sleef_expm1d2_u10_array, Sleef_expm1d2_u10sse2, Sleef_expm1d2_u10sse4, Sleef_expm1d2_u10avx2128, Sleef_expm1d2_u10x)
+DISPATCH_vf_vf(__m128, 4, Sleef_expm1f_u10, Sleef_expm1f1_u10, Sleef_expm1f4_u10, pnt_expm1f4_u10, disp_expm1f4_u10, Sleef_expm1f4_u10sse2, Sleef_expm1f4_u10sse4, Sleef_expm1f4_u10avx2128, Sleef_expm1f4_u10x)
+DISPATCH_ARRAY_vf_vf(__m128, float, 4, Sleef_expm1f4_u10_array, Sleef_expm1f4_u10sse2, Sleef_expm1f4_u10sse4, Sleef_expm1f4_u10avx2128, Sleef_expm1f4_u10x)
+DISPATCH_vf_vf(__m128d, 2, Sleef_log10_u10, Sleef_log10d1_u10, Sleef_log10d2_u10, pnt_log10d2_u10, disp_log10d2_u10, Sleef_log10d2_u10sse2, Sleef_log10d2_u10sse4, Sleef_log10d2_u10avx2128, Sleef_log10d2_u10x)
+DISPATCH_ARRAY_vf_vf(__m128d, double, 2, Sleef_log10d2_u10_array, Sleef_log10d2_u10sse2, Sleef_log10d2_u10sse4, Sleef_log10d2_u10avx2128, Sleef_log10d2_u10x)
+DISPATCH_vf_vf(__m128, 4, Sleef_log10f_u10, Sleef_log10f1_u10, Sleef_log10f4_u10, pnt_log10f4_u10, disp_log10f4_u10, Sleef_log10f4_u10sse2, Sleef_log10f4_u10sse4, Sleef_log10f4_u10avx2128, Sleef_log10f4_u10x)
+DISPATCH_ARRAY_vf_vf(__m128, float, 4, Sleef_log10f4_u10_array, Sleef_log10f4_u10sse2, Sleef_log10f4_u10sse4, Sleef_log10f4_u10avx2128, Sleef_log10f4_u10x)
+DISPATCH_vf_vf(__m128d, 2, Sleef_log2_u10, Sleef_log2d1_u10, Sleef_log2d2_u10, pnt_log2d2_u10, disp_log2d2_u10, Sleef_log2d2_u10sse2, Sleef_log2d2_u10sse4, Sleef_log2d2_u10avx2128, Sleef_log2d2_u10x)
+DISPATCH_ARRAY_vf_vf(__m128d, double, 2, Sleef_log2d2_u10_array, Sleef_log2d2_u10sse2, Sleef_log2d2_u10sse4, Sleef_log2d2_u10avx2128, Sleef_log2d2_u10x)
+DISPATCH_vf_vf(__m128, 4, Sleef_log2f_u10, Sleef_log2f1_u10, Sleef_log2f4_u10, pnt_log2f4_u10, disp_log2f4_u10, Sleef_log2f4_u10sse2, Sleef_log2f4_u10sse4, Sleef_log2f4_u10avx2128, Sleef_log2f4_u10x)
+DISPATCH_ARRAY_vf_vf(__m128, float, 4, Sleef_log2f4_u10_array, Sleef_log2f4_u10sse2, Sleef_log2f4_u10sse4, Sleef_log2f4_u10avx2128, Sleef_log2f4_u10x)
+DISPATCH_vf_vf(__m128d, 2, Sleef_log2_u35, Sleef_log2d1_u35, Sleef_log2d2_u35, pnt_log2d2_u35, disp_log2d2_u35, Sleef_log2d2_u35sse2, Sleef_log2d2_u35sse4, Sleef_log2d2_u35avx2128, Sleef_log2d2_u35x)
+DISPATCH_ARRAY_vf_vf(__m128d, double, 2, Sleef_log2d2_u35_array, Sleef_log2d2_u35sse2, Sleef_log2d2_u35sse4, Sleef_log2d2_u35avx2128, Sleef_log2d2_u35x)
+DISPATCH_vf_vf(__m128, 4, Sleef_log2f_u35, Sleef_log2f1_u35, Sleef_log2f4_u35, pnt_log2f4_u35, disp_log2f4_u35, Sleef_log2f4_u35sse2, Sleef_log2f4_u35sse4, Sleef_log2f4_u35avx2128, Sleef_log2f4_u35x)
+DISPATCH_ARRAY_vf_vf(__m128, float, 4, Sleef_log2f4_u35_array, Sleef_log2f4_u35sse2, Sleef_log2f4_u35sse4, Sleef_log2f4_u35avx2128, Sleef_log2f4_u35x)
+DISPATCH_vf_vf(__m128d, 2, Sleef_log1p_u10, Sleef_log1pd1_u10, Sleef_log1pd2_u10, pnt_log1pd2_u10, disp_log1pd2_u10, Sleef_log1pd2_u10sse2, Sleef_log1pd2_u10sse4, Sleef_log1pd2_u10avx2128, Sleef_log1pd2_u10x)
+DISPATCH_ARRAY_vf_vf(__m128d, double, 2, Sleef_log1pd2_u10_array, Sleef_log1pd2_u10sse2, Sleef_log1pd2_u10sse4, Sleef_log1pd2_u10avx2128, Sleef_log1pd2_u10x)
+DISPATCH_vf_vf(__m128, 4, Sleef_log1pf_u10, Sleef_log1pf1_u10, Sleef_log1pf4_u10, pnt_log1pf4_u10, disp_log1pf4_u10, Sleef_log1pf4_u10sse2, Sleef_log1pf4_u10sse4, Sleef_log1pf4_u10avx2128, Sleef_log1pf4_u10x)
+DISPATCH_ARRAY_vf_vf(__m128, float, 4, Sleef_log1pf4_u10_array, Sleef_log1pf4_u10sse2, Sleef_log1pf4_u10sse4, Sleef_log1pf4_u10avx2128, Sleef_log1pf4_u10x)
+DISPATCH_vf2_vf(__m128d, Sleef___m128d_2, 2, Sleef_sincospi_u05, Sleef_sincospid1_u05, Sleef_sincospid2_u05, pnt_sincospid2_u05, disp_sincospid2_u05, Sleef_sincospid2_u05sse2, Sleef_sincospid2_u05sse4, Sleef_sincospid2_u05avx2128, Sleef_sincospid2_u05x)
+DISPATCH_ARRAY_vf2_vf(__m128d, Sleef___m128d_2, double, 2, Sleef_sincospid2_u05_array, Sleef_sincospid2_u05sse2, Sleef_sincospid2_u05sse4, Sleef_sincospid2_u05avx2128, Sleef_sincospid2_u05x)
+DISPATCH_vf2_vf(__m128, Sleef___m128_2, 4, Sleef_sincospif_u05, Sleef_sincospif1_u05, Sleef_sincospif4_u05, pnt_sincospif4_u05, disp_sincospif4_u05, Sleef_sincospif4_u05sse2, Sleef_sincospif4_u05sse4, Sleef_sincospif4_u05avx2128, Sleef_sincospif4_u05x)
+DISPATCH_ARRAY_vf2_vf(__m128, Sleef___m128_2, float, 4, Sleef_sincospif4_u05_array, Sleef_sincospif4_u05sse2, Sleef_sincospif4_u05sse4, Sleef_sincospif4_u05avx2128, Sleef_sincospif4_u05x)
+DISPATCH_vf2_vf(__m128d, Sleef___m128d_2, 2, Sleef_sincospi_u35, Sleef_sincospid1_u35, Sleef_sincospid2_u35, pnt_sincospid2_u35, disp_sincospid2_u35, Sleef_sincospid2_u35sse2, Sleef_sincospid2_u35sse4, Sleef_sincospid2_u35avx2128, Sleef_sincospid2_u35x)
+DISPATCH_ARRAY_vf2_vf(__m128d, Sleef___m128d_2, double, 2, Sleef_sincospid2_u35_array, Sleef_sincospid2_u35sse2, Sleef_sincospid2_u35sse4, Sleef_sincospid2_u35avx2128, Sleef_sincospid2_u35x)
+DISPATCH_vf2_vf(__m128, Sleef___m128_2, 4, Sleef_sincospif_u35, Sleef_sincospif1_u35, Sleef_sincospif4_u35, pnt_sincospif4_u35, disp_sincospif4_u35, Sleef_sincospif4_u35sse2, Sleef_sincospif4_u35sse4, Sleef_sincospif4_u35avx2128, Sleef_sincospif4_u35x)
+DISPATCH_ARRAY_vf2_vf(__m128, Sleef___m128_2, float, 4, Sleef_sincospif4_u35_array, Sleef_sincospif4_u35sse2, Sleef_sincospif4_u35sse4, Sleef_sincospif4_u35avx2128, Sleef_sincospif4_u35x)
+DISPATCH_vf_vf(__m128d, 2, Sleef_sinpi_u05, Sleef_sinpid1_u05, Sleef_sinpid2_u05, pnt_sinpid2_u05, disp_sinpid2_u05, Sleef_sinpid2_u05sse2, Sleef_sinpid2_u05sse4, Sleef_sinpid2_u05avx2128, Sleef_sinpid2_u05x)
+DISPATCH_ARRAY_vf_vf(__m128d, double, 2, Sleef_sinpid2_u05_array, Sleef_sinpid2_u05sse2, Sleef_sinpid2_u05sse4, Sleef_sinpid2_u05avx2128, Sleef_sinpid2_u05x)
+DISPATCH_vf_vf(__m128, 4, Sleef_sinpif_u05, Sleef_sinpif1_u05, Sleef_sinpif4_u05, pnt_sinpif4_u05, disp_sinpif4_u05, Sleef_sinpif4_u05sse2, Sleef_sinpif4_u05sse4, Sleef_sinpif4_u05avx2128, Sleef_sinpif4_u05x)
+DISPATCH_ARRAY_vf_vf(__m128, float, 4, Sleef_sinpif4_u05_array, Sleef_sinpif4_u05sse2, Sleef_sinpif4_u05sse4, Sleef_sinpif4_u05avx2128, Sleef_sinpif4_u05x)
+DISPATCH_vf_vf(__m128d, 2, Sleef_cospi_u05, Sleef_cospid1_u05, Sleef_cospid2_u05, pnt_cospid2_u05, disp_cospid2_u05, Sleef_cospid2_u05sse2, Sleef_cospid2_u05sse4, Sleef_cospid2_u05avx2128, Sleef_cospid2_u05x)
+DISPATCH_ARRAY_vf_vf(__m128d, double, 2, Sleef_cospid2_u05_array, Sleef_cospid2_u05sse2, Sleef_cospid2_u05sse4, Sleef_cospid2_u05avx2128, Sleef_cospid2_u05x)
+DISPATCH_vf_vf(__m128, 4, Sleef_cospif_u05, Sleef_cospif1_u05, Sleef_cospif4_u05, pnt_cospif4_u05, disp_cospif4_u05, Sleef_cospif4_u05sse2, Sleef_cospif4_u05sse4, Sleef_cospif4_u05avx2128, Sleef_cospif4_u05x)
+DISPATCH_ARRAY_vf_vf(__m128, float, 4, Sleef_cospif4_u05_array, Sleef_cospif4_u05sse2, Sleef_cospif4_u05sse4, Sleef_cospif4_u05avx2128, Sleef_cospif4_u05x)
+DISPATCH_vf_vf_vi(__m128d, __m128i, 2, Sleef_ldexp, Sleef_ldexpd1, Sleef_ldexpd2, pnt_ldexpd2, disp_ldexpd2, Sleef_ldexpd2_sse2, Sleef_ldexpd2_sse4, Sleef_ldexpd2_avx2128, Sleef_ldexpd2_x)
+DISPATCH_ARRAY_vf_vf_vi(__m128d, __m128i, double, 2, Sleef_ldexpd2_array, Sleef_ldexpd2_sse2, Sleef_ldexpd2_sse4, Sleef_ldexpd2_avx2128, Sleef_ldexpd2_x)
+DISPATCH_vi_vf(__m128d, __m128i, 4, Sleef_ilogb, Sleef_ilogbd1, Sleef_ilogbd2, pnt_ilogbd2, disp_ilogbd2, Sleef_ilogbd2_sse2, Sleef_ilogbd2_sse4, Sleef_ilogbd2_avx2128, Sleef_ilogbd2_x)
+DISPATCH_ARRAY_vi_vf(__m128d, __m128i, double, 2, Sleef_ilogbd2_array, Sleef_ilogbd2_sse2, Sleef_ilogbd2_sse4, Sleef_ilogbd2_avx2128, Sleef_ilogbd2_x)
+DISPATCH_vf_vf_vf_vf(__m128d, 2, Sleef_fma, Sleef_fmad1, Sleef_fmad2, pnt_fmad2, disp_fmad2, Sleef_fmad2_sse2, Sleef_fmad2_sse4, Sleef_fmad2_avx2128, Sleef_fmad2_x)
+DISPATCH_ARRAY_vf_vf_vf_vf(__m128d, double, 2, Sleef_fmad2_array, Sleef_fmad2_sse2, Sleef_fmad2_sse4, Sleef_fmad2_avx2128, Sleef_fmad2_x)
+DISPATCH_vf_vf_vf_vf(__m128, 4, Sleef_fmaf, Sleef_fmaf1, Sleef_fmaf4, pnt_fmaf4, disp_fmaf4, Sleef_fmaf4_sse2, Sleef_fmaf4_sse4, Sleef_fmaf4_avx2128, Sleef_fmaf4_x)
+DISPATCH_ARRAY_vf_vf_vf_vf(__m128, float, 4, Sleef_fmaf4_array, Sleef_fmaf4_sse2, Sleef_fmaf4_sse4, Sleef_fmaf4_avx2128, Sleef_fmaf4_x)
+DISPATCH_vf_vf(__m128d, 2, Sleef_sqrt, Sleef_sqrtd1, Sleef_sqrtd2, pnt_sqrtd2, disp_sqrtd2, Sleef_sqrtd2_sse2, Sleef_sqrtd2_sse4, Sleef_sqrtd2_avx2128, Sleef_sqrtd2_x)
+DISPATCH_ARRAY_vf_vf(__m128d, double, 2, Sleef_sqrtd2_array, Sleef_sqrtd2_sse2, Sleef_sqrtd2_sse4, Sleef_sqrtd2_avx2128, Sleef_sqrtd2_x)
+DISPATCH_vf_vf(__m128, 4, Sleef_sqrtf, Sleef_sqrtf1, Sleef_sqrtf4, pnt_sqrtf4, disp_sqrtf4, Sleef_sqrtf4_sse2, Sleef_sqrtf4_sse4, Sleef_sqrtf4_avx2128, Sleef_sqrtf4_x)
+DISPATCH_ARRAY_vf_vf(__m128, float, 4, Sleef_sqrtf4_array, Sleef_sqrtf4_sse2, Sleef_sqrtf4_sse4, Sleef_sqrtf4_avx2128, Sleef_sqrtf4_x)
+DISPATCH_vf_vf(__m128d, 2, Sleef_sqrt_u05, Sleef_sqrtd1_u05, Sleef_sqrtd2_u05, pnt_sqrtd2_u05, disp_sqrtd2_u05, Sleef_sqrtd2_u05sse2, Sleef_sqrtd2_u05sse4, Sleef_sqrtd2_u05avx2128, Sleef_sqrtd2_u05x)
+DISPATCH_ARRAY_vf_vf(__m128d, double, 2, Sleef_sqrtd2_u05_array, Sleef_sqrtd2_u05sse2, Sleef_sqrtd2_u05sse4, Sleef_sqrtd2_u05avx2128, Sleef_sqrtd2_u05x)
+DISPATCH_vf_vf(__m128, 4, Sleef_sqrtf_u05, Sleef_sqrtf1_u05, Sleef_sqrtf4_u05, pnt_sqrtf4_u05, disp_sqrtf4_u05, Sleef_sqrtf4_u05sse2, Sleef_sqrtf4_u05sse4, Sleef_sqrtf4_u05avx2128, Sleef_sqrtf4_u05x)
+DISPATCH_ARRAY_vf_vf(__m128, float, 4, Sleef_sqrtf4_u05_array, Sleef_sqrtf4_u05sse2, Sleef_sqrtf4_u05sse4, Sleef_sqrtf4_u05avx2128, Sleef_sqrtf4_u05x)
+DISPATCH_vf_vf(__m128d, 2, Sleef_sqrt_u35, Sleef_sqrtd1_u35, Sleef_sqrtd2_u35, pnt_sqrtd2_u35, disp_sqrtd2_u35, Sleef_sqrtd2_u35sse2, Sleef_sqrtd2_u35sse4, Sleef_sqrtd2_u35avx2128, Sleef_sqrtd2_u35x)
+DISPATCH_ARRAY_vf_vf(__m128d, double, 2, Sleef_sqrtd2_u35_array, Sleef_sqrtd2_u35sse2, Sleef_sqrtd2_u35sse4, Sleef_sqrtd2_u35avx2128, Sleef_sqrtd2_u35x)
+DISPATCH_vf_vf(__m128, 4, Sleef_sqrtf_u35, Sleef_sqrtf1_u35, Sleef_sqrtf4_u35, pnt_sqrtf4_u35, disp_sqrtf4_u35, Sleef_sqrtf4_u35sse2, Sleef_sqrtf4_u35sse4, Sleef_sqrtf4_u35avx2128, Sleef_sqrtf4_u35x)
+DISPATCH_ARRAY_vf_vf(__m128, float, 4, Sleef_sqrtf4_u35_array, Sleef_sqrtf4_u35sse2, Sleef_sqrtf4_u35sse4, Sleef_sqrtf4_u35avx2128, Sleef_sqrtf4_u35x)
+DISPATCH_vf_vf_vf(__m128d, 2, Sleef_hypot_u05, Sleef_hypotd1_u05, Sleef_hypotd2_u05, pnt_hypotd2_u05, disp_hypotd2_u05, Sleef_hypotd2_u05sse2, Sleef_hypotd2_u05sse4, Sleef_hypotd2_u05avx2128, Sleef_hypotd2_u05x)
+DISPATCH_ARRAY_vf_vf_vf(__m128d, double, 2, Sleef_hypotd2_u05_array, Sleef_hypotd2_u05sse2, Sleef_hypotd2_u05sse4, Sleef_hypotd2_u05avx2128, Sleef_hypotd2_u05x)
+DISPATCH_vf_vf_vf(__m128, 4, Sleef_hypotf_u05, Sleef_hypotf1_u05, Sleef_hypotf4_u05, pnt_hypotf4_u05, disp_hypotf4_u05, Sleef_hypotf4_u05sse2, Sleef_hypotf4_u05sse4, Sleef_hypotf4_u05avx2128, Sleef_hypotf4_u05x)
+DISPATCH_ARRAY_vf_vf_vf(__m128, float, 4, Sleef_hypotf4_u05_array, Sleef_hypotf4_u05sse2, Sleef_hypotf4_u05sse4, Sleef_hypotf4_u05avx2128, Sleef_hypotf4_u05x)
+DISPATCH_vf_vf_vf(__m128d, 2, Sleef_hypot_u35, Sleef_hypotd1_u35, Sleef_hypotd2_u35, pnt_hypotd2_u35, disp_hypotd2_u35, Sleef_hypotd2_u35sse2, Sleef_hypotd2_u35sse4, Sleef_hypotd2_u35avx2128, Sleef_hypotd2_u35x)
+DISPATCH_ARRAY_vf_vf_vf(__m128d, double, 2, Sleef_hypotd2_u35_array, Sleef_hypotd2_u35sse2, Sleef_hypotd2_u35sse4, Sleef_hypotd2_u35avx2128, Sleef_hypotd2_u35x)
+DISPATCH_vf_vf_vf(__m128, 4, Sleef_hypotf_u35, Sleef_hypotf1_u35, Sleef_hypotf4_u35, pnt_hypotf4_u35, disp_hypotf4_u35, Sleef_hypotf4_u35sse2, Sleef_hypotf4_u35sse4, Sleef_hypotf4_u35avx2128, Sleef_hypotf4_u35x)
+DISPATCH_ARRAY_vf_vf_vf(__m128, float, 4, Sleef_hypotf4_u35_array, Sleef_hypotf4_u35sse2, Sleef_hypotf4_u35sse4, Sleef_hypotf4_u35avx2128, Sleef_hypotf4_u35x)
+DISPATCH_vf_vf(__m128d, 2, Sleef_fabs, Sleef_fabsd1, Sleef_fabsd2, pnt_fabsd2, disp_fabsd2, Sleef_fabsd2_sse2, Sleef_fabsd2_sse4, Sleef_fabsd2_avx2128, Sleef_fabsd2_x)
+DISPATCH_ARRAY_vf_vf(__m128d, double, 2, Sleef_fabsd2_array, Sleef_fabsd2_sse2, Sleef_fabsd2_sse4, Sleef_fabsd2_avx2128, Sleef_fabsd2_x)
+DISPATCH_vf_vf(__m128, 4, Sleef_fabsf, Sleef_fabsf1, Sleef_fabsf4, pnt_fabsf4, disp_fabsf4, Sleef_fabsf4_sse2, Sleef_fabsf4_sse4, Sleef_fabsf4_avx2128, Sleef_fabsf4_x)
+DISPATCH_ARRAY_vf_vf(__m128, float, 4, Sleef_fabsf4_array, Sleef_fabsf4_sse2, Sleef_fabsf4_sse4, Sleef_fabsf4_avx2128, Sleef_fabsf4_x)
+DISPATCH_vf_vf_vf(__m128d, 2, Sleef_copysign, Sleef_copysignd1, Sleef_copysignd2, pnt_copysignd2, disp_copysignd2, Sleef_copysignd2_sse2, Sleef_copysignd2_sse4, Sleef_copysignd2_avx2128, Sleef_copysignd2_x)
+DISPATCH_ARRAY_vf_vf_vf(__m128d, double, 2, Sleef_copysignd2_array, Sleef_copysignd2_sse2, Sleef_copysignd2_sse4, Sleef_copysignd2_avx2128, Sleef_copysignd2_x)
+DISPATCH_vf_vf_vf(__m128, 4, Sleef_copysignf, Sleef_copysignf1, Sleef_copysignf4, pnt_copysignf4, disp_copysignf4, Sleef_copysignf4_sse2, Sleef_copysignf4_sse4, Sleef_copysignf4_avx2128, Sleef_copysignf4_x)
+DISPATCH_ARRAY_vf_vf_vf(__m128, float, 4, Sleef_copysignf4_array, Sleef_copysignf4_sse2, Sleef_copysignf4_sse4, Sleef_copysignf4_avx2128, Sleef_copysignf4_x)
+DISPATCH_vf_vf_vf(__m128d, 2, Sleef_fmax, Sleef_fmaxd1, Sleef_fmaxd2, pnt_fmaxd2, disp_fmaxd2, Sleef_fmaxd2_sse2, Sleef_fmaxd2_sse4, Sleef_fmaxd2_avx2128, Sleef_fmaxd2_x)
+DISPATCH_ARRAY_vf_vf_vf(__m128d, double, 2, Sleef_fmaxd2_array, Sleef_fmaxd2_sse2, Sleef_fmaxd2_sse4, Sleef_fmaxd2_avx2128, Sleef_fmaxd2_x)
+DISPATCH_vf_vf_vf(__m128, 4, Sleef_fmaxf, Sleef_fmaxf1, Sleef_fmaxf4, pnt_fmaxf4, disp_fmaxf4, Sleef_fmaxf4_sse2, Sleef_fmaxf4_sse4, Sleef_fmaxf4_avx2128, Sleef_fmaxf4_x)
+DISPATCH_ARRAY_vf_vf_vf(__m128, float, 4, Sleef_fmaxf4_array, Sleef_fmaxf4_sse2, Sleef_fmaxf4_sse4, Sleef_fmaxf4_avx2128, Sleef_fmaxf4_x)
+DISPATCH_vf_vf_vf(__m128d, 2, Sleef_fmin, Sleef_fmind1, Sleef_fmind2, pnt_fmind2, disp_fmind2, Sleef_fmind2_sse2, Sleef_fmind2_sse4, Sleef_fmind2_avx2128, Sleef_fmind2_x)
+DISPATCH_ARRAY_vf_vf_vf(__m128d, double, 2, Sleef_fmind2_array, Sleef_fmind2_sse2, Sleef_fmind2_sse4, Sleef_fmind2_avx2128, Sleef_fmind2_x)
+DISPATCH_vf_vf_vf(__m128, 4, Sleef_fminf, Sleef_fminf1, Sleef_fminf4, pnt_fminf4, disp_fminf4, Sleef_fminf4_sse2, Sleef_fminf4_sse4, Sleef_fminf4_avx2128, Sleef_fminf4_x)
+DISPATCH_ARRAY_vf_vf_vf(__m128, float, 4, Sleef_fminf4_array, Sleef_fminf4_sse2, Sleef_fminf4_sse4, Sleef_fminf4_avx2128, Sleef_fminf4_x)
+DISPATCH_vf_vf_vf(__m128d, 2, Sleef_fdim, Sleef_fdimd1, Sleef_fdimd2, pnt_fdimd2, disp_fdimd2, Sleef_fdimd2_sse2, Sleef_fdimd2_sse4, Sleef_fdimd2_avx2128, Sleef_fdimd2_x)
+DISPATCH_ARRAY_vf_vf_vf(__m128d, double, 2, Sleef_fdimd2_array, Sleef_fdimd2_sse2, Sleef_fdimd2_sse4, Sleef_fdimd2_avx2128, Sleef_fdimd2_x)
+DISPATCH_vf_vf_vf(__m128, 4, Sleef_fdimf, Sleef_fdimf1, Sleef_fdimf4, pnt_fdimf4, disp_fdimf4, Sleef_fdimf4_sse2, Sleef_fdimf4_sse4, Sleef_fdimf4_avx2128, Sleef_fdimf4_x)
+DISPATCH_ARRAY_vf_vf_vf(__m128, float, 4, Sleef_fdimf4_array, Sleef_fdimf4_sse2, Sleef_fdimf4_sse4, Sleef_fdimf4_avx2128, Sleef_fdimf4_x)
+DISPATCH_vf_vf(__m128d, 2, Sleef_trunc, Sleef_truncd1, Sleef_truncd2, pnt_truncd2, disp_truncd2, Sleef_truncd2_sse2, Sleef_truncd2_sse4, Sleef_truncd2_avx2128, Sleef_truncd2_x)
+DISPATCH_ARRAY_vf_vf(__m128d, double, 2, Sleef_truncd2_array, Sleef_truncd2_sse2, Sleef_truncd2_sse4, Sleef_truncd2_avx2128, Sleef_truncd2_x)
+DISPATCH_vf_vf(__m128, 4, Sleef_truncf, Sleef_truncf1, Sleef_truncf4, pnt_truncf4, disp_truncf4, Sleef_truncf4_sse2, Sleef_truncf4_sse4, Sleef_truncf4_avx2128, Sleef_truncf4_x)
+DISPATCH_ARRAY_vf_vf(__m128, float, 4, Sleef_truncf4_array, Sleef_truncf4_sse2, Sleef_truncf4_sse4, Sleef_truncf4_avx2128, Sleef_truncf4_x)
+DISPATCH_vf_vf(__m128d, 2, Sleef_floor, Sleef_floord1, Sleef_floord2, pnt_floord2, disp_floord2, Sleef_floord2_sse2, Sleef_floord2_sse4, Sleef_floord2_avx2128, Sleef_floord2_x)
+DISPATCH_ARRAY_vf_vf(__m128d, double, 2, Sleef_floord2_array, Sleef_floord2_sse2, Sleef_floord2_sse4, Sleef_floord2_avx2128, Sleef_floord2_x)
+DISPATCH_vf_vf(__m128, 4, Sleef_floorf, Sleef_floorf1, Sleef_floorf4, pnt_floorf4, disp_floorf4, Sleef_floorf4_sse2, Sleef_floorf4_sse4, Sleef_floorf4_avx2128, Sleef_floorf4_x)
+DISPATCH_ARRAY_vf_vf(__m128, float, 4, Sleef_floorf4_array, Sleef_floorf4_sse2, Sleef_floorf4_sse4, Sleef_floorf4_avx2128, Sleef_floorf4_x)
+DISPATCH_vf_vf(__m128d, 2, Sleef_ceil, Sleef_ceild1, Sleef_ceild2, pnt_ceild2, disp_ceild2, Sleef_ceild2_sse2, Sleef_ceild2_sse4, Sleef_ceild2_avx2128, Sleef_ceild2_x)
+DISPATCH_ARRAY_vf_vf(__m128d, double, 2, Sleef_ceild2_array, Sleef_ceild2_sse2, Sleef_ceild2_sse4, Sleef_ceild2_avx2128, Sleef_ceild2_x)
+DISPATCH_vf_vf(__m128, 4, Sleef_ceilf, Sleef_ceilf1, Sleef_ceilf4, pnt_ceilf4, disp_ceilf4, Sleef_ceilf4_sse2, Sleef_ceilf4_sse4, Sleef_ceilf4_avx2128, Sleef_ceilf4_x)
+DISPATCH_ARRAY_vf_vf(__m128, float, 4, Sleef_ceilf4_array, Sleef_ceilf4_sse2, Sleef_ceilf4_sse4, Sleef_ceilf4_avx2128, Sleef_ceilf4_x)
+DISPATCH_vf_vf(__m128d, 2, Sleef_round, Sleef_roundd1, Sleef_roundd2, pnt_roundd2, disp_roundd2, Sleef_roundd2_sse2, Sleef_roundd2_sse4, Sleef_roundd2_avx2128, Sleef_roundd2_x)
+DISPATCH_ARRAY_vf_vf(__m128d, double, 2, Sleef_roundd2_array, Sleef_roundd2_sse2, Sleef_roundd2_sse4, Sleef_roundd2_avx2128, Sleef_roundd2_x)
+DISPATCH_vf_vf(__m128, 4, Sleef_roundf, Sleef_roundf1, Sleef_roundf4, pnt_roundf4, disp_roundf4, Sleef_roundf4_sse2, Sleef_roundf4_sse4, Sleef_roundf4_avx2128, Sleef_roundf4_x)
+DISPATCH_ARRAY_vf_vf(__m128, float, 4, Sleef_roundf4_array, Sleef_roundf4_sse2, Sleef_roundf4_sse4, Sleef_roundf4_avx2128, Sleef_roundf4_x)
+DISPATCH_vf_vf(__m128d, 2, Sleef_rint, Sleef_rintd1, Sleef_rintd2, pnt_rintd2, disp_rintd2, Sleef_rintd2_sse2, Sleef_rintd2_sse4, Sleef_rintd2_avx2128, Sleef_rintd2_x)
+DISPATCH_ARRAY_vf_vf(__m128d, double, 2, Sleef_rintd2_array, Sleef_rintd2_sse2, Sleef_rintd2_sse4, Sleef_rintd2_avx2128, Sleef_rintd2_x)
+DISPATCH_vf_vf(__m128, 4, Sleef_rintf, Sleef_rintf1, Sleef_rintf4, pnt_rintf4, disp_rintf4, Sleef_rintf4_sse2, Sleef_rintf4_sse4, Sleef_rintf4_avx2128, Sleef_rintf4_x)
+DISPATCH_ARRAY_vf_vf(__m128, float, 4, Sleef_rintf4_array, Sleef_rintf4_sse2, Sleef_rintf4_sse4, Sleef_rintf4_avx2128, Sleef_rintf4_x)
+DISPATCH_vf_vf_vf(__m128d, 2, Sleef_nextafter, Sleef_nextafterd1, Sleef_nextafterd2, pnt_nextafterd2, disp_nextafterd2, Sleef_nextafterd2_sse2, Sleef_nextafterd2_sse4, Sleef_nextafterd2_avx2128, Sleef_nextafterd2_x)
+DISPATCH_ARRAY_vf_vf_vf(__m128d, double, 2, Sleef_nextafterd2_array, Sleef_nextafterd2_sse2, Sleef_nextafterd2_sse4, Sleef_nextafterd2_avx2128, Sleef_nextafterd2_x)
+DISPATCH_vf_vf_vf(__m128, 4, Sleef_nextafterf, Sleef_nextafterf1, Sleef_nextafterf4, pnt_nextafterf4, disp_nextafterf4, Sleef_nextafterf4_sse2, Sleef_nextafterf4_sse4, Sleef_nextafterf4_avx2128, Sleef_nextafterf4_x)
+DISPATCH_ARRAY_vf_vf_vf(__m128, float, 4, Sleef_nextafterf4_array, Sleef_nextafterf4_sse2, Sleef_nextafterf4_sse4, Sleef_nextafterf4_avx2128, Sleef_nextafterf4_x)
+DISPATCH_vf_vf(__m128d, 2, Sleef_frfrexp, Sleef_frfrexpd1, Sleef_frfrexpd2, pnt_frfrexpd2, disp_frfrexpd2, Sleef_frfrexpd2_sse2, Sleef_frfrexpd2_sse4, Sleef_frfrexpd2_avx2128, Sleef_frfrexpd2_x)
+DISPATCH_ARRAY_vf_vf(__m128d, double, 2, Sleef_frfrexpd2_array, Sleef_frfrexpd2_sse2, Sleef_frfrexpd2_sse4, Sleef_frfrexpd2_avx2128, Sleef_frfrexpd2_x)
+DISPATCH_vf_vf(__m128, 4, Sleef_frfrexpf, Sleef_frfrexpf1, Sleef_frfrexpf4, pnt_frfrexpf4, disp_frfrexpf4, Sleef_frfrexpf4_sse2, Sleef_frfrexpf4_sse4, Sleef_frfrexpf4_avx2128, Sleef_frfrexpf4_x)
+DISPATCH_ARRAY_vf_vf(__m128, float, 4, Sleef_frfrexpf4_array, Sleef_frfrexpf4_sse2, Sleef_frfrexpf4_sse4, Sleef_frfrexpf4_avx2128, Sleef_frfrexpf4_x)
+DISPATCH_vi_vf(__m128d, __m128i, 4, Sleef_expfrexp, Sleef_expfrexpd1, Sleef_expfrexpd2, pnt_expfrexpd2, disp_expfrexpd2, Sleef_expfrexpd2_sse2, Sleef_expfrexpd2_sse4, Sleef_expfrexpd2_avx2128, Sleef_expfrexpd2_x)
+DISPATCH_ARRAY_vi_vf(__m128d, __m128i, double, 2, Sleef_expfrexpd2_array, Sleef_expfrexpd2_sse2, Sleef_expfrexpd2_sse4, Sleef_expfrexpd2_avx2128, Sleef_expfrexpd2_x)
+DISPATCH_vf_vf_vf(__m128d, 2, Sleef_fmod, Sleef_fmodd1, Sleef_fmodd2, pnt_fmodd2, disp_fmodd2, Sleef_fmodd2_sse2, Sleef_fmodd2_sse4, Sleef_fmodd2_avx2128, Sleef_fmodd2_x)
+DISPATCH_ARRAY_vf_vf_vf(__m128d, double, 2, Sleef_fmodd2_array, Sleef_fmodd2_sse2, Sleef_fmodd2_sse4, Sleef_fmodd2_avx2128, Sleef_fmodd2_x)
+DISPATCH_vf_vf_vf(__m128, 4, Sleef_fmodf, Sleef_fmodf1, Sleef_fmodf4, pnt_fmodf4, disp_fmodf4, Sleef_fmodf4_sse2, Sleef_fmodf4_sse4, Sleef_fmodf4_avx2128, Sleef_fmodf4_x)
+DISPATCH_ARRAY_vf_vf_vf(__m128, float, 4, Sleef_fmodf4_array, Sleef_fmodf4_sse2, Sleef_fmodf4_sse4, Sleef_fmodf4_avx2128, Sleef_fmodf4_x)
+DISPATCH_vf_vf_vf(__m128d, 2, Sleef_remainder, Sleef_remainderd1, Sleef_remainderd2, pnt_remainderd2, disp_remainderd2, Sleef_remainderd2_sse2, Sleef_remainderd2_sse4, Sleef_remainderd2_avx2128, Sleef_remainderd2_x)
+DISPATCH_ARRAY_vf_vf_vf(__m128d, double, 2, Sleef_remainderd2_array, Sleef_remainderd2_sse2, Sleef_remainderd2_sse4, Sleef_remainderd2_avx2128, Sleef_remainderd2_x)
+DISPATCH_vf_vf_vf(__m128, 4, Sleef_remainderf, Sleef_remainderf1, Sleef_remainderf4, pnt_remainderf4, disp_remainderf4, Sleef_remainderf4_sse2, Sleef_remainderf4_sse4, Sleef_remainderf4_avx2128, Sleef_remainderf4_x)
+DISPATCH_ARRAY_vf_vf_vf(__m128, float, 4, Sleef_remainderf4_array, Sleef_remainderf4_sse2, Sleef_remainderf4_sse4, Sleef_remainderf4_avx2128, Sleef_remainderf4_x)
+DISPATCH_vf2_vf(__m128d, Sleef___m128d_2, 2, Sleef_modf, Sleef_modfd1, Sleef_modfd2, pnt_modfd2, disp_modfd2, Sleef_modfd2_sse2, Sleef_modfd2_sse4, Sleef_modfd2_avx2128, Sleef_modfd2_x)
+DISPATCH_ARRAY_vf2_vf(__m128d, Sleef___m128d_2, double, 2, Sleef_modfd2_array, Sleef_modfd2_sse2, Sleef_modfd2_sse4, Sleef_modfd2_avx2128, Sleef_modfd2_x)
+DISPATCH_vf2_vf(__m128, Sleef___m128_2, 4, Sleef_modff, Sleef_modff1, Sleef_modff4, pnt_modff4, disp_modff4, Sleef_modff4_sse2, Sleef_modff4_sse4, Sleef_modff4_avx2128, Sleef_modff4_x)
+DISPATCH_ARRAY_vf2_vf(__m128, Sleef___m128_2, float, 4, Sleef_modff4_array, Sleef_modff4_sse2, Sleef_modff4_sse4, Sleef_modff4_avx2128, Sleef_modff4_x)
+DISPATCH_vf_vf(__m128d, 2, Sleef_lgamma_u10, Sleef_lgammad1_u10, Sleef_lgammad2_u10, pnt_lgammad2_u10, disp_lgammad2_u10, Sleef_lgammad2_u10sse2, Sleef_lgammad2_u10sse4, Sleef_lgammad2_u10avx2128, Sleef_lgammad2_u10x)
+DISPATCH_ARRAY_vf_vf(__m128d, double, 2, Sleef_lgammad2_u10_array, Sleef_lgammad2_u10sse2, Sleef_lgammad2_u10sse4, Sleef_lgammad2_u10avx2128, Sleef_lgammad2_u10x)
+DISPATCH_vf_vf(__m128, 4, Sleef_lgammaf_u10, Sleef_lgammaf1_u10, Sleef_lgammaf4_u10, pnt_lgammaf4_u10, disp_lgammaf4_u10, Sleef_lgammaf4_u10sse2, Sleef_lgammaf4_u10sse4, Sleef_lgammaf4_u10avx2128, Sleef_lgammaf4_u10x)
+DISPATCH_ARRAY_vf_vf(__m128, float, 4, Sleef_lgammaf4_u10_array, Sleef_lgammaf4_u10sse2, Sleef_lgammaf4_u10sse4, Sleef_lgammaf4_u10avx2128, Sleef_lgammaf4_u10x)
+DISPATCH_vf_vf(__m128d, 2, Sleef_tgamma_u10, Sleef_tgammad1_u10, Sleef_tgammad2_u10, pnt_tgammad2_u10, disp_tgammad2_u10, Sleef_tgammad2_u10sse2, Sleef_tgammad2_u10sse4, Sleef_tgammad2_u10avx2128, Sleef_tgammad2_u10x)
+DISPATCH_ARRAY_vf_vf(__m128d, double, 2, Sleef_tgammad2_u10_array, Sleef_tgammad2_u10sse2, Sleef_tgammad2_u10sse4, Sleef_tgammad2_u10avx2128, Sleef_tgammad2_u10x)
+DISPATCH_vf_vf(__m128, 4, Sleef_tgammaf_u10, Sleef_tgammaf1_u10, Sleef_tgammaf4_u10, pnt_tgammaf4_u10, disp_tgammaf4_u10, Sleef_tgammaf4_u10sse2, Sleef_tgammaf4_u10sse4, Sleef_tgammaf4_u10avx2128, Sleef_tgammaf4_u10x)
+DISPATCH_ARRAY_vf_vf(__m128, float, 4, Sleef_tgammaf4_u10_array, Sleef_tgammaf4_u10sse2, Sleef_tgammaf4_u10sse4, Sleef_tgammaf4_u10avx2128, Sleef_tgammaf4_u10x)
+DISPATCH_vf_vf(__m128d, 2, Sleef_erf_u10, Sleef_erfd1_u10, Sleef_erfd2_u10, pnt_erfd2_u10, disp_erfd2_u10, Sleef_erfd2_u10sse2, Sleef_erfd2_u10sse4, Sleef_erfd2_u10avx2128, Sleef_erfd2_u10x)
+DISPATCH_ARRAY_vf_vf(__m128d, double, 2, Sleef_erfd2_u10_array, Sleef_erfd2_u10sse2, Sleef_erfd2_u10sse4, Sleef_erfd2_u10avx2128, Sleef_erfd2_u10x)
+DISPATCH_vf_vf(__m128, 4, Sleef_erff_u10, Sleef_erff1_u10, Sleef_erff4_u10, pnt_erff4_u10, disp_erff4_u10, Sleef_erff4_u10sse2, Sleef_erff4_u10sse4, Sleef_erff4_u10avx2128, Sleef_erff4_u10x)
+DISPATCH_ARRAY_vf_vf(__m128, float, 4, Sleef_erff4_u10_array, Sleef_erff4_u10sse2, Sleef_erff4_u10sse4, Sleef_erff4_u10avx2128, Sleef_erff4_u10x)
+DISPATCH_vf_vf(__m128d, 2, Sleef_erfc_u15, Sleef_erfcd1_u15, Sleef_erfcd2_u15, pnt_erfcd2_u15, disp_erfcd2_u15, Sleef_erfcd2_u15sse2, Sleef_erfcd2_u15sse4, Sleef_erfcd2_u15avx2128, Sleef_erfcd2_u15x)
+DISPATCH_ARRAY_vf_vf(__m128d, double, 2, Sleef_erfcd2_u15_array, Sleef_erfcd2_u15sse2, Sleef_erfcd2_u15sse4, Sleef_erfcd2_u15avx2128, Sleef_erfcd2_u15x)
+DISPATCH_vf_vf(__m128, 4, Sleef_erfcf_u15, Sleef_erfcf1_u15, Sleef_erfcf4_u15, pnt_erfcf4_u15, disp_erfcf4_u15, Sleef_erfcf4_u15sse2, Sleef_erfcf4_u15sse4, Sleef_erfcf4_u15avx2128, Sleef_erfcf4_u15x)
+DISPATCH_ARRAY_vf_vf(__m128, float, 4, Sleef_erfcf4_u15_array, Sleef_erfcf4_u15sse2, Sleef_erfcf4_u15sse4, Sleef_erfcf4_u15avx2128, Sleef_erfcf4_u15x)
+DISPATCH_vf_vf(__m128d, 2, Sleef_sigmoid_u10, Sleef_sigmoidd1_u10, Sleef_sigmoidd2_u10, pnt_sigmoidd2_u10, disp_sigmoidd2_u10, Sleef_sigmoidd2_u10sse2, Sleef_sigmoidd2_u10sse4, Sleef_sigmoidd2_u10avx2128, Sleef_sigmoidd2_u10x)
+DISPATCH_ARRAY_vf_vf(__m128d, double, 2, Sleef_sigmoidd2_u10_array, Sleef_sigmoidd2_u10sse2, Sleef_sigmoidd2_u10sse4, Sleef_sigmoidd2_u10avx2128, Sleef_sigmoidd2_u10x)
+DISPATCH_vf_vf(__m128, 4, Sleef_sigmoidf_u10, Sleef_sigmoidf1_u10, Sleef_sigmoidf4_u10, pnt_sigmoidf4_u10, disp_sigmoidf4_u10, Sleef_sigmoidf4_u10sse2, Sleef_sigmoidf4_u10sse4, Sleef_sigmoidf4_u10avx2128, Sleef_sigmoidf4_u10x)
+DISPATCH_ARRAY_vf_vf(__m128, float, 4, Sleef_sigmoidf4_u10_array, Sleef_sigmoidf4_u10sse2, Sleef_sigmoidf4_u10sse4, Sleef_sigmoidf4_u10avx2128, Sleef_sigmoidf4_u10x)
+DISPATCH_vf_vf(__m128d, 2, Sleef_sigmoid_u35, Sleef_sigmoidd1_u35, Sleef_sigmoidd2_u35, pnt_sigmoidd2_u35, disp_sigmoidd2_u35, Sleef_sigmoidd2_u35sse2, Sleef_sigmoidd2_u35sse4, Sleef_sigmoidd2_u35avx2128, Sleef_sigmoidd2_u35x)
+DISPATCH_ARRAY_vf_vf(__m128d, double, 2, Sleef_sigmoidd2_u35_array, Sleef_sigmoidd2_u35sse2, Sleef_sigmoidd2_u35sse4, Sleef_sigmoidd2_u35avx2128, Sleef_sigmoidd2_u35x)
+DISPATCH_vf_vf(__m128, 4, Sleef_sigmoidf_u35, Sleef_sigmoidf1_u35, Sleef_sigmoidf4_u35, pnt_sigmoidf4_u35, disp_sigmoidf4_u35, Sleef_sigmoidf4_u35sse2, Sleef_sigmoidf4_u35sse4, Sleef_sigmoidf4_u35avx2128, Sleef_sigmoidf4_u35x)
+DISPATCH_ARRAY_vf_vf(__m128, float, 4, Sleef_sigmoidf4_u35_array, Sleef_sigmoidf4_u35sse2, Sleef_sigmoidf4_u35sse4, Sleef_sigmoidf4_u35avx2128, Sleef_sigmoidf4_u35x)
+DISPATCH_vf_vf(__m128d, 2, Sleef_softplus_u10, Sleef_softplusd1_u10, Sleef_softplusd2_u10, pnt_softplusd2_u10, disp_softplusd2_u10, Sleef_softplusd2_u10sse2, Sleef_softplusd2_u10sse4, Sleef_softplusd2_u10avx2128, Sleef_softplusd2_u10x)
+DISPATCH_ARRAY_vf_vf(__m128d, double, 2, Sleef_softplusd2_u10_array, Sleef_softplusd2_u10sse2, Sleef_softplusd2_u10sse4, Sleef_softplusd2_u10avx2128, Sleef_softplusd2_u10x)
+DISPATCH_vf_vf(__m128, 4, Sleef_softplusf_u10, Sleef_softplusf1_u10, Sleef_softplusf4_u10, pnt_softplusf4_u10, disp_softplusf4_u10, Sleef_softplusf4_u10sse2, Sleef_softplusf4_u10sse4, Sleef_softplusf4_u10avx2128, Sleef_softplusf4_u10x)
+DISPATCH_ARRAY_vf_vf(__m128, float, 4, Sleef_softplusf4_u10_array, Sleef_softplusf4_u10sse2, Sleef_softplusf4_u10sse4, Sleef_softplusf4_u10avx2128, Sleef_softplusf4_u10x)
+DISPATCH_vf_vf(__m128d, 2, Sleef_softplus_u35, Sleef_softplusd1_u35, Sleef_softplusd2_u35, pnt_softplusd2_u35, disp_softplusd2_u35, Sleef_softplusd2_u35sse2, Sleef_softplusd2_u35sse4, Sleef_softplusd2_u35avx2128, Sleef_softplusd2_u35x)
+DISPATCH_ARRAY_vf_vf(__m128d, double, 2, Sleef_softplusd2_u35_array, Sleef_softplusd2_u35sse2, Sleef_softplusd2_u35sse4, Sleef_softplusd2_u35avx2128, Sleef_softplusd2_u35x)
+DISPATCH_vf_vf(__m128, 4, Sleef_softplusf_u35, Sleef_softplusf1_u35, Sleef_softplusf4_u35, pnt_softplusf4_u35, disp_softplusf4_u35, Sleef_softplusf4_u35sse2, Sleef_softplusf4_u35sse4, Sleef_softplusf4_u35avx2128, Sleef_softplusf4_u35x)
+DISPATCH_ARRAY_vf_vf(__m128, float, 4, Sleef_softplusf4_u35_array, Sleef_softplusf4_u35sse2, Sleef_softplusf4_u35sse4, Sleef_softplusf4_u35avx2128, Sleef_softplusf4_u35x)
+DISPATCH_vf_vf(__m128d, 2, Sleef_silu_u10, Sleef_silud1_u10, Sleef_silud2_u10, pnt_silud2_u10, disp_silud2_u10, Sleef_silud2_u10sse2, Sleef_silud2_u10sse4, Sleef_silud2_u10avx2128, Sleef_silud2_u10x)
+DISPATCH_ARRAY_vf_vf(__m128d, double, 2, Sleef_silud2_u10_array, Sleef_silud2_u10sse2, Sleef_silud2_u10sse4, Sleef_silud2_u10avx2128, Sleef_silud2_u10x)
+DISPATCH_vf_vf(__m128, 4, Sleef_siluf_u10, Sleef_siluf1_u10, Sleef_siluf4_u10, pnt_siluf4_u10, disp_siluf4_u10, Sleef_siluf4_u10sse2, Sleef_siluf4_u10sse4, Sleef_siluf4_u10avx2128, Sleef_siluf4_u10x)
+DISPATCH_ARRAY_vf_vf(__m128, float, 4, Sleef_siluf4_u10_array, Sleef_siluf4_u10sse2, Sleef_siluf4_u10sse4, Sleef_siluf4_u10avx2128, Sleef_siluf4_u10x)
+DISPATCH_vf_vf(__m128d, 2, Sleef_silu_u35, Sleef_silud1_u35, Sleef_silud2_u35, pnt_silud2_u35, disp_silud2_u35, Sleef_silud2_u35sse2, Sleef_silud2_u35sse4, Sleef_silud2_u35avx2128, Sleef_silud2_u35x)
+DISPATCH_ARRAY_vf_vf(__m128d, double, 2, Sleef_silud2_u35_array, Sleef_silud2_u35sse2, Sleef_silud2_u35sse4, Sleef_silud2_u35avx2128, Sleef_silud2_u35x)
+DISPATCH_vf_vf(__m128, 4, Sleef_siluf_u35, Sleef_siluf1_u35, Sleef_siluf4_u35, pnt_siluf4_u35, disp_siluf4_u35, Sleef_siluf4_u35sse2, Sleef_siluf4_u35sse4, Sleef_siluf4_u35avx2128, Sleef_siluf4_u35x)
+DISPATCH_ARRAY_vf_vf(__m128, float, 4, Sleef_siluf4_u35_array, Sleef_siluf4_u35sse2, Sleef_siluf4_u35sse4, Sleef_siluf4_u35avx2128, Sleef_siluf4_u35x)
+DISPATCH_vf_vf(__m128d, 2, Sleef_gelutanh_u10, Sleef_gelutanhd1_u10, Sleef_gelutanhd2_u10, pnt_gelutanhd2_u10, disp_gelutanhd2_u10, Sleef_gelutanhd2_u10sse2, Sleef_gelutanhd2_u10sse4, Sleef_gelutanhd2_u10avx2128, Sleef_gelutanhd2_u10x)
+DISPATCH_ARRAY_vf_vf(__m128d, double, 2, Sleef_gelutanhd2_u10_array, Sleef_gelutanhd2_u10sse2, Sleef_gelutanhd2_u10sse4, Sleef_gelutanhd2_u10avx2128, Sleef_gelutanhd2_u10x)
+DISPATCH_vf_vf(__m128, 4, Sleef_gelutanhf_u10, Sleef_gelutanhf1_u10, Sleef_gelutanhf4_u10, pnt_gelutanhf4_u10, disp_gelutanhf4_u10, Sleef_gelutanhf4_u10sse2, Sleef_gelutanhf4_u10sse4, Sleef_gelutanhf4_u10avx2128, Sleef_gelutanhf4_u10x)
+DISPATCH_ARRAY_vf_vf(__m128, float, 4, Sleef_gelutanhf4_u10_array, Sleef_gelutanhf4_u10sse2, Sleef_gelutanhf4_u10sse4, Sleef_gelutanhf4_u10avx2128, Sleef_gelutanhf4_u10x)
+DISPATCH_vf_vf(__m128d, 2, Sleef_gelutanh_u35, Sleef_gelutanhd1_u35, Sleef_gelutanhd2_u35, pnt_gelutanhd2_u35, disp_gelutanhd2_u35, Sleef_gelutanhd2_u35sse2, Sleef_gelutanhd2_u35sse4, Sleef_gelutanhd2_u35avx2128, Sleef_gelutanhd2_u35x)
+DISPATCH_ARRAY_vf_vf(__m128d, double, 2, Sleef_gelutanhd2_u35_array, Sleef_gelutanhd2_u35sse2, Sleef_gelutanhd2_u35sse4, Sleef_gelutanhd2_u35avx2128, Sleef_gelutanhd2_u35x)
+DISPATCH_vf_vf(__m128, 4, Sleef_gelutanhf_u35, Sleef_gelutanhf1_u35, Sleef_gelutanhf4_u35, pnt_gelutanhf4_u35, disp_gelutanhf4_u35, Sleef_gelutanhf4_u35sse2, Sleef_gelutanhf4_u35sse4, Sleef_gelutanhf4_u35avx2128, Sleef_gelutanhf4_u35x)
+DISPATCH_ARRAY_vf_vf(__m128, float, 4, Sleef_gelutanhf4_u35_array, Sleef_gelutanhf4_u35sse2, Sleef_gelutanhf4_u35sse4, Sleef_gelutanhf4_u35avx2128, Sleef_gelutanhf4_u35x)
+DISPATCH_vf_vf(__m128d, 2, Sleef_gelu_u15, Sleef_gelud1_u15, Sleef_gelud2_u15, pnt_gelud2_u15, disp_gelud2_u15, Sleef_gelud2_u15sse2, Sleef_gelud2_u15sse4, Sleef_gelud2_u15avx2128, Sleef_gelud2_u15x)
+DISPATCH_ARRAY_vf_vf(__m128d, double, 2, Sleef_gelud2_u15_array, Sleef_gelud2_u15sse2, Sleef_gelud2_u15sse4, Sleef_gelud2_u15avx2128, Sleef_gelud2_u15x)
+DISPATCH_vf_vf(__m128, 4, Sleef_geluf_u15, Sleef_geluf1_u15, Sleef_geluf4_u15, pnt_geluf4_u15, disp_geluf4_u15, Sleef_geluf4_u15sse2, Sleef_geluf4_u15sse4, Sleef_geluf4_u15avx2128, Sleef_geluf4_u15x)
+DISPATCH_ARRAY_vf_vf(__m128, float, 4, Sleef_geluf4_u15_array, Sleef_geluf4_u15sse2, Sleef_geluf4_u15sse4, Sleef_geluf4_u15avx2128, Sleef_geluf4_u15x)
+DISPATCH_i_i(4, Sleef_getIntf, Sleef_getIntf1, Sleef_getIntf4, pnt_getIntf4, disp_getIntf4, Sleef_getIntf4_sse2, Sleef_getIntf4_sse4, Sleef_getIntf4_avx2128, Sleef_getIntf4_x)
+DISPATCH_i_i(2, Sleef_getInt, Sleef_getIntd1, Sleef_getIntd2, pnt_getIntd2, disp_getIntd2, Sleef_getIntd2_sse2, Sleef_getIntd2_sse4, Sleef_getIntd2_avx2128, Sleef_getIntd2_x)
+DISPATCH_p_i(4, Sleef_getPtrf, Sleef_getPtrf1, Sleef_getPtrf4, pnt_getPtrf4, disp_getPtrf4, Sleef_getPtrf4_sse2, Sleef_getPtrf4_sse4, Sleef_getPtrf4_avx2128, Sleef_getPtrf4_x)
+DISPATCH_p_i(2, Sleef_getPtr, Sleef_getPtrd1, Sleef_getPtrd2, pnt_getPtrd2, disp_getPtrd2, Sleef_getPtrd2_sse2, Sleef_getPtrd2_sse4, Sleef_getPtrd2_avx2128, Sleef_getPtrd2_x)
+DISPATCH_TABLE
+DISPATCH_ENTRY(Sleef_sind2_u35, disp_sind2_u35)
+DISPATCH_ENTRY(Sleef_sinf4_u35, disp_sinf4_u35)
+DISPATCH_ENTRY(Sleef_cosd2_u35, disp_cosd2_u35)
+DISPATCH_ENTRY(Sleef_cosf4_u35, disp_cosf4_u35)
+DISPATCH_ENTRY(Sleef_sincosd2_u35, disp_sincosd2_u35)
+DISPATCH_ENTRY(Sleef_sincosf4_u35, disp_sincosf4_u35)
+DISPATCH_ENTRY(Sleef_tand2_u35, disp_tand2_u35)
+DISPATCH_ENTRY(Sleef_tanf4_u35, disp_tanf4_u35)
+DISPATCH_ENTRY(Sleef_asind2_u35, disp_asind2_u35)
+DISPATCH_ENTRY(Sleef_asinf4_u35, disp_asinf4_u35)
+DISPATCH_ENTRY(Sleef_acosd2_u35, disp_acosd2_u35)
+DISPATCH_ENTRY(Sleef_acosf4_u35, disp_acosf4_u35)
+DISPATCH_ENTRY(Sleef_atand2_u35, disp_atand2_u35)
+DISPATCH_ENTRY(Sleef_atanf4_u35, disp_atanf4_u35)
+DISPATCH_ENTRY(Sleef_atan2d2_u35, disp_atan2d2_u35)
+DISPATCH_ENTRY(Sleef_atan2f4_u35, disp_atan2f4_u35)
+DISPATCH_ENTRY(Sleef_logd2_u35, disp_logd2_u35)
+DISPATCH_ENTRY(Sleef_logf4_u35, disp_logf4_u35)
+DISPATCH_ENTRY(Sleef_cbrtd2_u35, disp_cbrtd2_u35)
+DISPATCH_ENTRY(Sleef_cbrtf4_u35, disp_cbrtf4_u35)
+DISPATCH_ENTRY(Sleef_sind2_u10, disp_sind2_u10)
+DISPATCH_ENTRY(Sleef_sinf4_u10, disp_sinf4_u10)
+DISPATCH_ENTRY(Sleef_cosd2_u10, disp_cosd2_u10)
+DISPATCH_ENTRY(Sleef_cosf4_u10, disp_cosf4_u10)
+DISPATCH_ENTRY(Sleef_sincosd2_u10, disp_sincosd2_u10)
+DISPATCH_ENTRY(Sleef_sincosf4_u10, disp_sincosf4_u10)
+DISPATCH_ENTRY(Sleef_tand2_u10, disp_tand2_u10)
+DISPATCH_ENTRY(Sleef_tanf4_u10, disp_tanf4_u10)
+DISPATCH_ENTRY(Sleef_asind2_u10, disp_asind2_u10)
+DISPATCH_ENTRY(Sleef_asinf4_u10, disp_asinf4_u10)
+DISPATCH_ENTRY(Sleef_acosd2_u10, disp_acosd2_u10)
+DISPATCH_ENTRY(Sleef_acosf4_u10, disp_acosf4_u10)
+DISPATCH_ENTRY(Sleef_atand2_u10, disp_atand2_u10)
+DISPATCH_ENTRY(Sleef_atanf4_u10, disp_atanf4_u10)
+DISPATCH_ENTRY(Sleef_atan2d2_u10, disp_atan2d2_u10)
+DISPATCH_ENTRY(Sleef_atan2f4_u10, disp_atan2f4_u10)
+DISPATCH_ENTRY(Sleef_logd2_u10, disp_logd2_u10)
+DISPATCH_ENTRY(Sleef_logf4_u10, disp_logf4_u10)
+DISPATCH_ENTRY(Sleef_cbrtd2_u10, disp_cbrtd2_u10)
+DISPATCH_ENTRY(Sleef_cbrtf4_u10, disp_cbrtf4_u10)
+DISPATCH_ENTRY(Sleef_expd2_u10, disp_expd2_u10)
+DISPATCH_ENTRY(Sleef_expf4_u10, disp_expf4_u10)
+DISPATCH_ENTRY(Sleef_powd2_u10, disp_powd2_u10)
+DISPATCH_ENTRY(Sleef_powf4_u10, disp_powf4_u10)
+DISPATCH_ENTRY(Sleef_sinhd2_u10, disp_sinhd2_u10)
+DISPATCH_ENTRY(Sleef_sinhf4_u10, disp_sinhf4_u10)
+DISPATCH_ENTRY(Sleef_coshd2_u10, disp_coshd2_u10)
+DISPATCH_ENTRY(Sleef_coshf4_u10, disp_coshf4_u10)
+DISPATCH_ENTRY(Sleef_tanhd2_u10, disp_tanhd2_u10)
+DISPATCH_ENTRY(Sleef_tanhf4_u10, disp_tanhf4_u10)
+DISPATCH_ENTRY(Sleef_sinhd2_u35, disp_sinhd2_u35)
+DISPATCH_ENTRY(Sleef_sinhf4_u35, disp_sinhf4_u35)
+DISPATCH_ENTRY(Sleef_coshd2_u35, disp_coshd2_u35)
+DISPATCH_ENTRY(Sleef_coshf4_u35, disp_coshf4_u35)
+DISPATCH_ENTRY(Sleef_tanhd2_u35, disp_tanhd2_u35)
+DISPATCH_ENTRY(Sleef_tanhf4_u35, disp_tanhf4_u35)
+DISPATCH_ENTRY(Sleef_fastsinf4_u3500, disp_fastsinf4_u3500)
+DISPATCH_ENTRY(Sleef_fastcosf4_u3500, disp_fastcosf4_u3500)
+DISPATCH_ENTRY(Sleef_fastpowf4_u3500, disp_fastpowf4_u3500)
+DISPATCH_ENTRY(Sleef_fastexpd2_u3500, disp_fastexpd2_u3500)
+DISPATCH_ENTRY(Sleef_fastexpf4_u3500, disp_fastexpf4_u3500)
+DISPATCH_ENTRY(Sleef_fastexp2d2_u3500, disp_fastexp2d2_u3500)
+DISPATCH_ENTRY(Sleef_fastexp2f4_u3500, disp_fastexp2f4_u3500)
+DISPATCH_ENTRY(Sleef_fastlogd2_u3500, disp_fastlogd2_u3500)
+DISPATCH_ENTRY(Sleef_fastlogf4_u3500, disp_fastlogf4_u3500)
+DISPATCH_ENTRY(Sleef_fastlog2d2_u3500, disp_fastlog2d2_u3500)
+DISPATCH_ENTRY(Sleef_fastlog2f4_u3500, disp_fastlog2f4_u3500)
+DISPATCH_ENTRY(Sleef_fasttanhd2_u3500, disp_fasttanhd2_u3500)
+DISPATCH_ENTRY(Sleef_fasttanhf4_u3500, disp_fasttanhf4_u3500)
+DISPATCH_ENTRY(Sleef_fastatan2d2_u3500, disp_fastatan2d2_u3500)
+DISPATCH_ENTRY(Sleef_fastatan2f4_u3500, disp_fastatan2f4_u3500)
+DISPATCH_ENTRY(Sleef_fastrsqrtd2_u3500, disp_fastrsqrtd2_u3500)
+DISPATCH_ENTRY(Sleef_fastrsqrtf4_u3500, disp_fastrsqrtf4_u3500)
+DISPATCH_ENTRY(Sleef_fastrcpd2_u3500, disp_fastrcpd2_u3500)
+DISPATCH_ENTRY(Sleef_fastrcpf4_u3500, disp_fastrcpf4_u3500)
+DISPATCH_ENTRY(Sleef_sinrd2_u35, disp_sinrd2_u35)
+DISPATCH_ENTRY(Sleef_sinrf4_u35, disp_sinrf4_u35)
+DISPATCH_ENTRY(Sleef_cosrd2_u35, disp_cosrd2_u35)
+DISPATCH_ENTRY(Sleef_cosrf4_u35, disp_cosrf4_u35)
+DISPATCH_ENTRY(Sleef_sincosrd2_u35, disp_sincosrd2_u35)
+DISPATCH_ENTRY(Sleef_sincosrf4_u35, disp_sincosrf4_u35)
+DISPATCH_ENTRY(Sleef_tanrd2_u35, disp_tanrd2_u35)
+DISPATCH_ENTRY(Sleef_tanrf4_u35, disp_tanrf4_u35)
+DISPATCH_ENTRY(Sleef_asinhd2_u10, disp_asinhd2_u10)
+DISPATCH_ENTRY(Sleef_asinhf4_u10, disp_asinhf4_u10)
+DISPATCH_ENTRY(Sleef_acoshd2_u10, disp_acoshd2_u10)
+DISPATCH_ENTRY(Sleef_acoshf4_u10, disp_acoshf4_u10)
+DISPATCH_ENTRY(Sleef_atanhd2_u10, disp_atanhd2_u10)
+DISPATCH_ENTRY(Sleef_atanhf4_u10, disp_atanhf4_u10)
+DISPATCH_ENTRY(Sleef_exp2d2_u10, disp_exp2d2_u10)
+DISPATCH_ENTRY(Sleef_exp2f4_u10, disp_exp2f4_u10)
+DISPATCH_ENTRY(Sleef_exp2d2_u35, disp_exp2d2_u35)
+DISPATCH_ENTRY(Sleef_exp2f4_u35, disp_exp2f4_u35)
+DISPATCH_ENTRY(Sleef_exp10d2_u10, disp_exp10d2_u10)
+DISPATCH_ENTRY(Sleef_exp10f4_u10, disp_exp10f4_u10)
+DISPATCH_ENTRY(Sleef_exp10d2_u35, disp_exp10d2_u35)
+DISPATCH_ENTRY(Sleef_exp10f4_u35, disp_exp10f4_u35)
+DISPATCH_ENTRY(Sleef_expm1d2_u10, disp_expm1d2_u10)
+DISPATCH_ENTRY(Sleef_expm1f4_u10, disp_expm1f4_u10)
+DISPATCH_ENTRY(Sleef_log10d2_u10, disp_log10d2_u10)
+DISPATCH_ENTRY(Sleef_log10f4_u10, disp_log10f4_u10)
+DISPATCH_ENTRY(Sleef_log2d2_u10, disp_log2d2_u10)
+DISPATCH_ENTRY(Sleef_log2f4_u10, disp_log2f4_u10)
+DISPATCH_ENTRY(Sleef_log2d2_u35, disp_log2d2_u35)
+DISPATCH_ENTRY(Sleef_log2f4_u35, disp_log2f4_u35)
+DISPATCH_ENTRY(Sleef_log1pd2_u10, disp_log1pd2_u10)
+DISPATCH_ENTRY(Sleef_log1pf4_u10, disp_log1pf4_u10)
+DISPATCH_ENTRY(Sleef_sincospid2_u05, disp_sincospid2_u05)
+DISPATCH_ENTRY(Sleef_sincospif4_u05, disp_sincospif4_u05)
+DISPATCH_ENTRY(Sleef_sincospid2_u35, disp_sincospid2_u35)
+DISPATCH_ENTRY(Sleef_sincospif4_u35, disp_sincospif4_u35)
+DISPATCH_ENTRY(Sleef_sinpid2_u05, disp_sinpid2_u05)
+DISPATCH_ENTRY(Sleef_sinpif4_u05, disp_sinpif4_u05)
+DISPATCH_ENTRY(Sleef_cospid2_u05, disp_cospid2_u05)
+DISPATCH_ENTRY(Sleef_cospif4_u05, disp_cospif4_u05)
+DISPATCH_ENTRY(Sleef_ldexpd2, disp_ldexpd2)
+DISPATCH_ENTRY(Sleef_ilogbd2, disp_ilogbd2)
+DISPATCH_ENTRY(Sleef_fmad2, disp_fmad2)
+DISPATCH_ENTRY(Sleef_fmaf4, disp_fmaf4)
+DISPATCH_ENTRY(Sleef_sqrtd2, disp_sqrtd2)
+DISPATCH_ENTRY(Sleef_sqrtf4, disp_sqrtf4)
+DISPATCH_ENTRY(Sleef_sqrtd2_u05, disp_sqrtd2_u05)
+DISPATCH_ENTRY(Sleef_sqrtf4_u05, disp_sqrtf4_u05)
+DISPATCH_ENTRY(Sleef_sqrtd2_u35, disp_sqrtd2_u35)
+DISPATCH_ENTRY(Sleef_sqrtf4_u35, disp_sqrtf4_u35)
+DISPATCH_ENTRY(Sleef_hypotd2_u05, disp_hypotd2_u05)
+DISPATCH_ENTRY(Sleef_hypotf4_u05, disp_hypotf4_u05)
+DISPATCH_ENTRY(Sleef_hypotd2_u35, disp_hypotd2_u35)
+DISPATCH_ENTRY(Sleef_hypotf4_u35, disp_hypotf4_u35)
+DISPATCH_ENTRY(Sleef_fabsd2, disp_fabsd2)
+DISPATCH_ENTRY(Sleef_fabsf4, disp_fabsf4)
+DISPATCH_ENTRY(Sleef_copysignd2, disp_copysignd2)
+DISPATCH_ENTRY(Sleef_copysignf4, disp_copysignf4)
+DISPATCH_ENTRY(Sleef_fmaxd2, disp_fmaxd2)
+DISPATCH_ENTRY(Sleef_fmaxf4, disp_fmaxf4)
+DISPATCH_ENTRY(Sleef_fmind2, disp_fmind2)
+DISPATCH_ENTRY(Sleef_fminf4, disp_fminf4)
+DISPATCH_ENTRY(Sleef_fdimd2, disp_fdimd2)
+DISPATCH_ENTRY(Sleef_fdimf4, disp_fdimf4)
+DISPATCH_ENTRY(Sleef_truncd2, disp_truncd2)
+DISPATCH_ENTRY(Sleef_truncf4, disp_truncf4)
+DISPATCH_ENTRY(Sleef_floord2, disp_floord2)
+DISPATCH_ENTRY(Sleef_floorf4, disp_floorf4)
+DISPATCH_ENTRY(Sleef_ceild2, disp_ceild2)
+DISPATCH_ENTRY(Sleef_ceilf4, disp_ceilf4)
+DISPATCH_ENTRY(Sleef_roundd2, disp_roundd2)
+DISPATCH_ENTRY(Sleef_roundf4, disp_roundf4)
+DISPATCH_ENTRY(Sleef_rintd2, disp_rintd2)
+DISPATCH_ENTRY(Sleef_rintf4, disp_rintf4)
+DISPATCH_ENTRY(Sleef_nextafterd2, disp_nextafterd2)
+DISPATCH_ENTRY(Sleef_nextafterf4, disp_nextafterf4)
+DISPATCH_ENTRY(Sleef_frfrexpd2, disp_frfrexpd2)
+DISPATCH_ENTRY(Sleef_frfrexpf4, disp_frfrexpf4)
+DISPATCH_ENTRY(Sleef_expfrexpd2, disp_expfrexpd2)
+DISPATCH_ENTRY(Sleef_fmodd2, disp_fmodd2)
+DISPATCH_ENTRY(Sleef_fmodf4, disp_fmodf4)
+DISPATCH_ENTRY(Sleef_remainderd2, disp_remainderd2)
+DISPATCH_ENTRY(Sleef_remainderf4, disp_remainderf4)
+DISPATCH_ENTRY(Sleef_modfd2, disp_modfd2)
+DISPATCH_ENTRY(Sleef_modff4, disp_modff4)
+DISPATCH_ENTRY(Sleef_lgammad2_u10, disp_lgammad2_u10)
+DISPATCH_ENTRY(Sleef_lgammaf4_u10, disp_lgammaf4_u10)
+DISPATCH_ENTRY(Sleef_tgammad2_u10, disp_tgammad2_u10)
+DISPATCH_ENTRY(Sleef_tgammaf4_u10, disp_tgammaf4_u10)
+DISPATCH_ENTRY(Sleef_erfd2_u10, disp_erfd2_u10)
+DISPATCH_ENTRY(Sleef_erff4_u10, disp_erff4_u10)
+DISPATCH_ENTRY(Sleef_erfcd2_u15, disp_erfcd2_u15)
+DISPATCH_ENTRY(Sleef_erfcf4_u15, disp_erfcf4_u15)
+DISPATCH_ENTRY(Sleef_sigmoidd2_u10, disp_sigmoidd2_u10)
+DISPATCH_ENTRY(Sleef_sigmoidf4_u10, disp_sigmoidf4_u10)
+DISPATCH_ENTRY(Sleef_sigmoidd2_u35, disp_sigmoidd2_u35)
+DISPATCH_ENTRY(Sleef_sigmoidf4_u35, disp_sigmoidf4_u35)
+DISPATCH_ENTRY(Sleef_softplusd2_u10, disp_softplusd2_u10)
+DISPATCH_ENTRY(Sleef_softplusf4_u10, disp_softplusf4_u10)
+DISPATCH_ENTRY(Sleef_softplusd2_u35, disp_softplusd2_u35)
+DISPATCH_ENTRY(Sleef_softplusf4_u35, disp_softplusf4_u35)
+DISPATCH_ENTRY(Sleef_silud2_u10, disp_silud2_u10)
+DISPATCH_ENTRY(Sleef_siluf4_u10, disp_siluf4_u10)
+DISPATCH_ENTRY(Sleef_silud2_u35, disp_silud2_u35)
+DISPATCH_ENTRY(Sleef_siluf4_u35, disp_siluf4_u35)
+DISPATCH_ENTRY(Sleef_gelutanhd2_u10, disp_gelutanhd2_u10)
+DISPATCH_ENTRY(Sleef_gelutanhf4_u10, disp_gelutanhf4_u10)
+DISPATCH_ENTRY(Sleef_gelutanhd2_u35, disp_gelutanhd2_u35)
+DISPATCH_ENTRY(Sleef_gelutanhf4_u35, disp_gelutanhf4_u35)
+DISPATCH_ENTRY(Sleef_gelud2_u15, disp_gelud2_u15)
+DISPATCH_ENTRY(Sleef_geluf4_u15, disp_geluf4_u15)
+DISPATCH_ENTRY(Sleef_getIntd2, disp_getIntd2)
+DISPATCH_ENTRY(Sleef_getIntf4, disp_getIntf4)
+DISPATCH_ENTRY(Sleef_getPtrd2, disp_getPtrd2)
+DISPATCH_ENTRY(Sleef_getPtrf4, disp_getPtrf4)
+DISPATCH_TABLE_END(Sleef_queryDispatcherd2)
@@ -0,0 +1,593 @@
+#ifdef __SLEEFSIMDSP_C__
+#ifdef ENABLE_ALIAS
+EXPORT CONST __m512 Sleef_sinf16_u35(__m512) __attribute__((alias("Sleef_sinf16_u35avx512f"))) ;
+EXPORT CONST VECTOR_CC __m512 _ZGVeN16v_Sleef_sinf_u35(__m512) __attribute__((alias("Sleef_sinf16_u35avx512f")));
+EXPORT CONST __m512 Sleef_cosf16_u35(__m512) __attribute__((alias("Sleef_cosf16_u35avx512f"))) ;
+EXPORT CONST VECTOR_CC __m512 _ZGVeN16v_Sleef_cosf_u35(__m512) __attribute__((alias("Sleef_cosf16_u35avx512f")));
+EXPORT CONST vfloat2 Sleef_sincosf16_u35(__m512) __attribute__((alias("Sleef_sincosf16_u35avx512f"))) ;
+EXPORT CONST VECTOR_CC vfloat2 _ZGVeN16_Sleef_sincosf_u35(__m512) __attribute__((alias("Sleef_sincosf16_u35avx512f")));
+EXPORT CONST __m512 Sleef_tanf16_u35(__m512) __attribute__((alias("Sleef_tanf16_u35avx512f"))) ;
+EXPORT CONST VECTOR_CC __m512 _ZGVeN16v_Sleef_tanf_u35(__m512) __attribute__((alias("Sleef_tanf16_u35avx512f")));
+EXPORT CONST __m512 Sleef_asinf16_u35(__m512) __attribute__((alias("Sleef_asinf16_u35avx512f"))) ;
+EXPORT CONST VECTOR_CC __m512 _ZGVeN16v_Sleef_asinf_u35(__m512) __attribute__((alias("Sleef_asinf16_u35avx512f")));
+EXPORT CONST __m512 Sleef_acosf16_u35(__m512) __attribute__((alias("Sleef_acosf16_u35avx512f"))) ;
+EXPORT CONST VECTOR_CC __m512 _ZGVeN16v_Sleef_acosf_u35(__m512) __attribute__((alias("Sleef_acosf16_u35avx512f")));
+EXPORT CONST __m512 Sleef_atanf16_u35(__m512) __attribute__((alias("Sleef_atanf16_u35avx512f"))) ;
+EXPORT CONST VECTOR_CC __m512 _ZGVeN16v_Sleef_atanf_u35(__m512) __attribute__((alias("Sleef_atanf16_u35avx512f")));
+EXPORT CONST __m512 Sleef_atan2f16_u35(__m512, __m512) __attribute__((alias("Sleef_atan2f16_u35avx512f"))) ;
+EXPORT CONST VECTOR_CC __m512 _ZGVeN16vv_Sleef_atan2f_u35(__m512, __m512) __attribute__((alias("Sleef_atan2f16_u35avx512f")));
+EXPORT CONST __m512 Sleef_logf16_u35(__m512) __attribute__((alias("Sleef_logf16_u35avx512f"))) ;
+EXPORT CONST VECTOR_CC __m512 _ZGVeN16v_Sleef_logf_u35(__m512) __attribute__((alias("Sleef_logf16_u35avx512f")));
+EXPORT CONST __m512 Sleef_cbrtf16_u35(__m512) __attribute__((alias("Sleef_cbrtf16_u35avx512f"))) ;
+EXPORT CONST VECTOR_CC __m512 _ZGVeN16v_Sleef_cbrtf_u35(__m512) __attribute__((alias("Sleef_cbrtf16_u35avx512f")));
+EXPORT CONST __m512 Sleef_sinf16_u10(__m512) __attribute__((alias("Sleef_sinf16_u10avx512f"))) ;
+EXPORT CONST VECTOR_CC __m512 _ZGVeN16v_Sleef_sinf_u10(__m512) __attribute__((alias("Sleef_sinf16_u10avx512f")));
+EXPORT CONST __m512 Sleef_cosf16_u10(__m512) __attribute__((alias("Sleef_cosf16_u10avx512f"))) ;
+EXPORT CONST VECTOR_CC __m512 _ZGVeN16v_Sleef_cosf_u10(__m512) __attribute__((alias("Sleef_cosf16_u10avx512f")));
+EXPORT CONST vfloat2 Sleef_sincosf16_u10(__m512) __attribute__((alias("Sleef_sincosf16_u10avx512f"))) ;
+EXPORT CONST VECTOR_CC vfloat2 _ZGVeN16_Sleef_sincosf_u10(__m512) __attribute__((alias("Sleef_sincosf16_u10avx512f")));
+EXPORT CONST __m512 Sleef_tanf16_u10(__m512) __attribute__((alias("Sleef_tanf16_u10avx512f"))) ;
+EXPORT CONST VECTOR_CC __m512 _ZGVeN16v_Sleef_tanf_u10(__m512) __attribute__((alias("Sleef_tanf16_u10avx512f")));
+EXPORT CONST __m512 Sleef_asinf16_u10(__m512) __attribute__((alias("Sleef_asinf16_u10avx512f"))) ;
+EXPORT CONST VECTOR_CC __m512 _ZGVeN16v_Sleef_asinf_u10(__m512) __attribute__((alias("Sleef_asinf16_u10avx512f")));
+EXPORT CONST __m512 Sleef_acosf16_u10(__m512) __attribute__((alias("Sleef_acosf16_u10avx512f"))) ;
+EXPORT CONST VECTOR_CC __m512 _ZGVeN16v_Sleef_acosf_u10(__m512) __attribute__((alias("Sleef_acosf16_u10avx512f")));
+EXPORT CONST __m512 Sleef_atanf16_u10(__m512) __attribute__((alias("Sleef_atanf16_u10avx512f"))) ;
+EXPORT CONST VECTOR_CC __m512 _ZGVeN16v_Sleef_atanf_u10(__m512) __attribute__((alias("Sleef_atanf16_u10avx512f")));
+EXPORT CONST __m512 Sleef_atan2f16_u10(__m512, __m512) __attribute__((alias("Sleef_atan2f16_u10avx512f"))) ;
+EXPORT CONST VECTOR_CC __m512 _ZGVeN16vv_Sleef_atan2f_u10(__m512, __m512) __attribute__((alias("Sleef_atan2f16_u10avx512f")));
+EXPORT CONST __m512 Sleef_logf16_u10(__m512) __attribute__((alias("Sleef_logf16_u10avx512f"))) ;
+EXPORT CONST VECTOR_CC __m512 _ZGVeN16v_Sleef_logf_u10(__m512) __attribute__((alias("Sleef_logf16_u10avx512f")));
+EXPORT CONST __m512 Sleef_cbrtf16_u10(__m512) __attribute__((alias("Sleef_cbrtf16_u10avx512f"))) ;
+EXPORT CONST VECTOR_CC __m512 _ZGVeN16v_Sleef_cbrtf_u10(__m512) __attribute__((alias("Sleef_cbrtf16_u10avx512f")));
+EXPORT CONST __m512 Sleef_expf16_u10(__m512) __attribute__((alias("Sleef_expf16_u10avx512f"))) ;
+EXPORT CONST VECTOR_CC __m512 _ZGVeN16v_Sleef_expf_u10(__m512) __attribute__((alias("Sleef_expf16_u10avx512f")));
+EXPORT CONST __m512 Sleef_powf16_u10(__m512, __m512) __attribute__((alias("Sleef_powf16_u10avx512f"))) ;
+EXPORT CONST VECTOR_CC __m512 _ZGVeN16vv_Sleef_powf_u10(__m512, __m512) __attribute__((alias("Sleef_powf16_u10avx512f")));
+EXPORT CONST __m512 Sleef_sinhf16_u10(__m512) __attribute__((alias("Sleef_sinhf16_u10avx512f"))) ;
+EXPORT CONST VECTOR_CC __m512 _ZGVeN16v_Sleef_sinhf_u10(__m512) __attribute__((alias("Sleef_sinhf16_u10avx512f")));
+EXPORT CONST __m512 Sleef_coshf16_u10(__m512) __attribute__((alias("Sleef_coshf16_u10avx512f"))) ;
+EXPORT CONST VECTOR_CC __m512 _ZGVeN16v_Sleef_coshf_u10(__m512) __attribute__((alias("Sleef_coshf16_u10avx512f")));
+EXPORT CONST __m512 Sleef_tanhf16_u10(__m512) __attribute__((alias("Sleef_tanhf16_u10avx512f"))) ;
+EXPORT CONST VECTOR_CC __m512 _ZGVeN16v_Sleef_tanhf_u10(__m512) __attribute__((alias("Sleef_tanhf16_u10avx512f")));
+EXPORT CONST __m512 Sleef_sinhf16_u35(__m512) __attribute__((alias("Sleef_sinhf16_u35avx512f"))) ;
+EXPORT CONST VECTOR_CC __m512 _ZGVeN16v_Sleef_sinhf_u35(__m512) __attribute__((alias("Sleef_sinhf16_u35avx512f")));
+EXPORT CONST __m512 Sleef_coshf16_u35(__m512) __attribute__((alias("Sleef_coshf16_u35avx512f"))) ;
+EXPORT CONST VECTOR_CC __m512 _ZGVeN16v_Sleef_coshf_u35(__m512) __attribute__((alias("Sleef_coshf16_u35avx512f")));
+EXPORT CONST __m512 Sleef_tanhf16_u35(__m512) __attribute__((alias("Sleef_tanhf16_u35avx512f"))) ;
+EXPORT CONST VECTOR_CC __m512 _ZGVeN16v_Sleef_tanhf_u35(__m512) __attribute__((alias("Sleef_tanhf16_u35avx512f")));
+EXPORT CONST __m512 Sleef_fastsinf16_u3500(__m512) __attribute__((alias("Sleef_fastsinf16_u3500avx512f"))) ;
+EXPORT CONST VECTOR_CC __m512 _ZGVeN16v_Sleef_fastsinf_u3500(__m512) __attribute__((alias("Sleef_fastsinf16_u3500avx512f")));
+EXPORT CONST __m512 Sleef_fastcosf16_u3500(__m512) __attribute__((alias("Sleef_fastcosf16_u3500avx512f"))) ;
+EXPORT CONST VECTOR_CC __m512 _ZGVeN16v_Sleef_fastcosf_u3500(__m512) __attribute__((alias("Sleef_fastcosf16_u3500avx512f")));
+EXPORT CONST __m512 Sleef_fastpowf16_u3500(__m512, __m512) __attribute__((alias("Sleef_fastpowf16_u3500avx512f"))) ;
+EXPORT CONST VECTOR_CC __m512 _ZGVeN16vv_Sleef_fastpowf_u3500(__m512, __m512) __attribute__((alias("Sleef_fastpowf16_u3500avx512f")));
+EXPORT CONST __m512 Sleef_fastexpf16_u3500(__m512) __attribute__((alias("Sleef_fastexpf16_u3500avx512f"))) ;
+EXPORT CONST VECTOR_CC __m512 _ZGVeN16v_Sleef_fastexpf_u3500(__m512) __attribute__((alias("Sleef_fastexpf16_u3500avx512f")));
+EXPORT CONST __m512 Sleef_fastexp2f16_u3500(__m512) __attribute__((alias("Sleef_fastexp2f16_u3500avx512f"))) ;
+EXPORT CONST VECTOR_CC __m512 _ZGVeN16v_Sleef_fastexp2f_u3500(__m512) __attribute__((alias("Sleef_fastexp2f16_u3500avx512f")));
+EXPORT CONST __m512 Sleef_fastlogf16_u3500(__m512) __attribute__((alias("Sleef_fastlogf16_u3500avx512f"))) ;
+EXPORT CONST VECTOR_CC __m512 _ZGVeN16v_Sleef_fastlogf_u3500(__m512) __attribute__((alias("Sleef_fastlogf16_u3500avx512f")));
+EXPORT CONST __m512 Sleef_fastlog2f16_u3500(__m512) __attribute__((alias("Sleef_fastlog2f16_u3500avx512f"))) ;
+EXPORT CONST VECTOR_CC __m512 _ZGVeN16v_Sleef_fastlog2f_u3500(__m512) __attribute__((alias("Sleef_fastlog2f16_u3500avx512f")));
+EXPORT CONST __m512 Sleef_fasttanhf16_u3500(__m512) __attribute__((alias("Sleef_fasttanhf16_u3500avx512f"))) ;
+EXPORT CONST VECTOR_CC __m512 _ZGVeN16v_Sleef_fasttanhf_u3500(__m512) __attribute__((alias("Sleef_fasttanhf16_u3500avx512f")));
+EXPORT CONST __m512 Sleef_fastatan2f16_u3500(__m512, __m512) __attribute__((alias("Sleef_fastatan2f16_u3500avx512f"))) ;
+EXPORT CONST VECTOR_CC __m512 _ZGVeN16vv_Sleef_fastatan2f_u3500(__m512, __m512) __attribute__((alias("Sleef_fastatan2f16_u3500avx512f")));
+EXPORT CONST __m512 Sleef_fastrsqrtf16_u3500(__m512) __attribute__((alias("Sleef_fastrsqrtf16_u3500avx512f"))) ;
+EXPORT CONST VECTOR_CC __m512 _ZGVeN16v_Sleef_fastrsqrtf_u3500(__m512) __attribute__((alias("Sleef_fastrsqrtf16_u3500avx512f")));
+EXPORT CONST __m512 Sleef_fastrcpf16_u3500(__m512) __attribute__((alias("Sleef_fastrcpf16_u3500avx512f"))) ;
+EXPORT CONST VECTOR_CC __m512 _ZGVeN16v_Sleef_fastrcpf_u3500(__m512) __attribute__((alias("Sleef_fastrcpf16_u3500avx512f")));
+EXPORT CONST __m512 Sleef_sinrf16_u35(__m512) __attribute__((alias("Sleef_sinrf16_u35avx512f"))) ;
+EXPORT CONST VECTOR_CC __m512 _ZGVeN16v_Sleef_sinrf_u35(__m512) __attribute__((alias("Sleef_sinrf16_u35avx512f")));
+EXPORT CONST __m512 Sleef_cosrf16_u35(__m512) __attribute__((alias("Sleef_cosrf16_u35avx512f"))) ;
+EXPORT CONST VECTOR_CC __m512 _ZGVeN16v_Sleef_cosrf_u35(__m512) __attribute__((alias("Sleef_cosrf16_u35avx512f")));
+EXPORT CONST vfloat2 Sleef_sincosrf16_u35(__m512) __attribute__((alias("Sleef_sincosrf16_u35avx512f"))) ;
+EXPORT CONST VECTOR_CC vfloat2 _ZGVeN16_Sleef_sincosrf_u35(__m512) __attribute__((alias("Sleef_sincosrf16_u35avx512f")));
+EXPORT CONST __m512 Sleef_tanrf16_u35(__m512) __attribute__((alias("Sleef_tanrf16_u35avx512f"))) ;
+EXPORT CONST VECTOR_CC __m512 _ZGVeN16v_Sleef_tanrf_u35(__m512) __attribute__((alias("Sleef_tanrf16_u35avx512f")));
+EXPORT CONST __m512 Sleef_asinhf16_u10(__m512) __attribute__((alias("Sleef_asinhf16_u10avx512f"))) ;
+EXPORT CONST VECTOR_CC __m512 _ZGVeN16v_Sleef_asinhf_u10(__m512) __attribute__((alias("Sleef_asinhf16_u10avx512f")));
+EXPORT CONST __m512 Sleef_acoshf16_u10(__m512) __attribute__((alias("Sleef_acoshf16_u10avx512f"))) ;
+EXPORT CONST VECTOR_CC __m512 _ZGVeN16v_Sleef_acoshf_u10(__m512) __attribute__((alias("Sleef_acoshf16_u10avx512f")));
+EXPORT CONST __m512 Sleef_atanhf16_u10(__m512) __attribute__((alias("Sleef_atanhf16_u10avx512f"))) ;
+EXPORT CONST VECTOR_CC __m512 _ZGVeN16v_Sleef_atanhf_u10(__m512) __attribute__((alias("Sleef_atanhf16_u10avx512f")));
+EXPORT CONST __m512 Sleef_exp2f16_u10(__m512) __attribute__((alias("Sleef_exp2f16_u10avx512f"))) ;
+EXPORT CONST VECTOR_CC __m512 _ZGVeN16v_Sleef_exp2f_u10(__m512) __attribute__((alias("Sleef_exp2f16_u10avx512f")));
+EXPORT CONST __m512 Sleef_exp2f16_u35(__m512) __attribute__((alias("Sleef_exp2f16_u35avx512f"))) ;
+EXPORT CONST VECTOR_CC __m512 _ZGVeN16v_Sleef_exp2f_u35(__m512) __attribute__((alias("Sleef_exp2f16_u35avx512f")));
+EXPORT CONST __m512 Sleef_exp10f16_u10(__m512) __attribute__((alias("Sleef_exp10f16_u10avx512f"))) ;
+EXPORT CONST VECTOR_CC __m512 _ZGVeN16v_Sleef_exp10f_u10(__m512) __attribute__((alias("Sleef_exp10f16_u10avx512f")));
+EXPORT CONST __m512 Sleef_exp10f16_u35(__m512) __attribute__((alias("Sleef_exp10f16_u35avx512f"))) ;
+EXPORT CONST VECTOR_CC __m512 _ZGVeN16v_Sleef_exp10f_u35(__m512) __attribute__((alias("Sleef_exp10f16_u35avx512f")));
+EXPORT CONST __m512 Sleef_expm1f16_u10(__m512) __attribute__((alias("Sleef_expm1f16_u10avx512f"))) ;
+EXPORT CONST VECTOR_CC __m512 _ZGVeN16v_Sleef_expm1f_u10(__m512) __attribute__((alias("Sleef_expm1f16_u10avx512f")));
+EXPORT CONST __m512 Sleef_log10f16_u10(__m512) __attribute__((alias("Sleef_log10f16_u10avx512f"))) ;
+EXPORT CONST VECTOR_CC __m512 _ZGVeN16v_Sleef_log10f_u10(__m512) __attribute__((alias("Sleef_log10f16_u10avx512f")));
+EXPORT CONST __m512 Sleef_log2f16_u10(__m512) __attribute__((alias("Sleef_log2f16_u10avx512f"))) ;
+EXPORT CONST VECTOR_CC __m512 _ZGVeN16v_Sleef_log2f_u10(__m512) __attribute__((alias("Sleef_log2f16_u10avx512f")));
+EXPORT CONST __m512 Sleef_log2f16_u35(__m512) __attribute__((alias("Sleef_log2f16_u35avx512f"))) ;
+EXPORT CONST VECTOR_CC __m512 _ZGVeN16v_Sleef_log2f_u35(__m512) __attribute__((alias("Sleef_log2f16_u35avx512f")));
+EXPORT CONST __m512 Sleef_log1pf16_u10(__m512) __attribute__((alias("Sleef_log1pf16_u10avx512f"))) ;
+EXPORT CONST VECTOR_CC __m512 _ZGVeN16v_Sleef_log1pf_u10(__m512) __attribute__((alias("Sleef_log1pf16_u10avx512f")));
+EXPORT CONST vfloat2 Sleef_sincospif16_u05(__m512) __attribute__((alias("Sleef_sincospif16_u05avx512f"))) ;
+EXPORT CONST VECTOR_CC vfloat2 _ZGVeN16_Sleef_sincospif_u05(__m512) __attribute__((alias("Sleef_sincospif16_u05avx512f")));
+EXPORT CONST vfloat2 Sleef_sincospif16_u35(__m512) __attribute__((alias("Sleef_sincospif16_u35avx512f"))) ;
+EXPORT CONST VECTOR_CC vfloat2 _ZGVeN16_Sleef_sincospif_u35(__m512) __attribute__((alias("Sleef_sincospif16_u35avx512f")));
+EXPORT CONST __m512 Sleef_sinpif16_u05(__m512) __attribute__((alias("Sleef_sinpif16_u05avx512f"))) ;
+EXPORT CONST VECTOR_CC __m512 _ZGVeN16v_Sleef_sinpif_u05(__m512) __attribute__((alias("Sleef_sinpif16_u05avx512f")));
+EXPORT CONST __m512 Sleef_cospif16_u05(__m512) __attribute__((alias("Sleef_cospif16_u05avx512f"))) ;
+EXPORT CONST VECTOR_CC __m512 _ZGVeN16v_Sleef_cospif_u05(__m512) __attribute__((alias("Sleef_cospif16_u05avx512f")));
+EXPORT CONST __m512 Sleef_ldexpf16(__m512, __m512i) __attribute__((alias("Sleef_ldexpf16_avx512f"))) ;
+EXPORT CONST VECTOR_CC __m512 _ZGVeN16vv_Sleef_ldexpf(__m512, __m512i) __attribute__((alias("Sleef_ldexpf16_avx512f")));
+EXPORT CONST __m512i Sleef_ilogbf16(__m512) __attribute__((alias("Sleef_ilogbf16_avx512f"))) ;
+EXPORT CONST VECTOR_CC __m512i _ZGVeN16v_Sleef_ilogbf(__m512) __attribute__((alias("Sleef_ilogbf16_avx512f")));
+EXPORT CONST __m512 Sleef_fmaf16(__m512, __m512, __m512) __attribute__((alias("Sleef_fmaf16_avx512f"))) ;
+EXPORT CONST VECTOR_CC __m512 _ZGVeN16vvv_Sleef_fmaf(__m512, __m512, __m512) __attribute__((alias("Sleef_fmaf16_avx512f")));
+EXPORT CONST __m512 Sleef_sqrtf16(__m512) __attribute__((alias("Sleef_sqrtf16_avx512f"))) ;
+EXPORT CONST VECTOR_CC __m512 _ZGVeN16v_Sleef_sqrtf(__m512) __attribute__((alias("Sleef_sqrtf16_avx512f")));
+EXPORT CONST __m512 Sleef_sqrtf16_u05(__m512) __attribute__((alias("Sleef_sqrtf16_u05avx512f"))) ;
+EXPORT CONST VECTOR_CC __m512 _ZGVeN16v_Sleef_sqrtf_u05(__m512) __attribute__((alias("Sleef_sqrtf16_u05avx512f")));
+EXPORT CONST __m512 Sleef_sqrtf16_u35(__m512) __attribute__((alias("Sleef_sqrtf16_u35avx512f"))) ;
+EXPORT CONST VECTOR_CC __m512 _ZGVeN16v_Sleef_sqrtf_u35(__m512) __attribute__((alias("Sleef_sqrtf16_u35avx512f")));
+EXPORT CONST __m512 Sleef_hypotf16_u05(__m512, __m512) __attribute__((alias("Sleef_hypotf16_u05avx512f"))) ;
+EXPORT CONST VECTOR_CC __m512 _ZGVeN16vv_Sleef_hypotf_u05(__m512, __m512) __attribute__((alias("Sleef_hypotf16_u05avx512f")));
+EXPORT CONST __m512 Sleef_hypotf16_u35(__m512, __m512) __attribute__((alias("Sleef_hypotf16_u35avx512f"))) ;
+EXPORT CONST VECTOR_CC __m512 _ZGVeN16vv_Sleef_hypotf_u35(__m512, __m512) __attribute__((alias("Sleef_hypotf16_u35avx512f")));
+EXPORT CONST __m512 Sleef_fabsf16(__m512) __attribute__((alias("Sleef_fabsf16_avx512f"))) ;
+EXPORT CONST VECTOR_CC __m512 _ZGVeN16v_Sleef_fabsf(__m512) __attribute__((alias("Sleef_fabsf16_avx512f")));
+EXPORT CONST __m512 Sleef_copysignf16(__m512, __m512) __attribute__((alias("Sleef_copysignf16_avx512f"))) ;
+EXPORT CONST VECTOR_CC __m512 _ZGVeN16vv_Sleef_copysignf(__m512, __m512) __attribute__((alias("Sleef_copysignf16_avx512f")));
+EXPORT CONST __m512 Sleef_fmaxf16(__m512, __m512) __attribute__((alias("Sleef_fmaxf16_avx512f"))) ;
+EXPORT CONST VECTOR_CC __m512 _ZGVeN16vv_Sleef_fmaxf(__m512, __m512) __attribute__((alias("Sleef_fmaxf16_avx512f")));
+EXPORT CONST __m512 Sleef_fminf16(__m512, __m512) __attribute__((alias("Sleef_fminf16_avx512f"))) ;
+EXPORT CONST VECTOR_CC __m512 _ZGVeN16vv_Sleef_fminf(__m512, __m512) __attribute__((alias("Sleef_fminf16_avx512f")));
+EXPORT CONST __m512 Sleef_fdimf16(__m512, __m512) __attribute__((alias("Sleef_fdimf16_avx512f"))) ;
+EXPORT CONST VECTOR_CC __m512 _ZGVeN16vv_Sleef_fdimf(__m512, __m512) __attribute__((alias("Sleef_fdimf16_avx512f")));
+EXPORT CONST __m512 Sleef_truncf16(__m512) __attribute__((alias("Sleef_truncf16_avx512f"))) ;
+EXPORT CONST VECTOR_CC __m512 _ZGVeN16v_Sleef_truncf(__m512) __attribute__((alias("Sleef_truncf16_avx512f")));
+EXPORT CONST __m512 Sleef_floorf16(__m512) __attribute__((alias("Sleef_floorf16_avx512f"))) ;
+EXPORT CONST VECTOR_CC __m512 _ZGVeN16v_Sleef_floorf(__m512) __attribute__((alias("Sleef_floorf16_avx512f")));
+EXPORT CONST __m512 Sleef_ceilf16(__m512) __attribute__((alias("Sleef_ceilf16_avx512f"))) ;
+EXPORT CONST VECTOR_CC __m512 _ZGVeN16v_Sleef_ceilf(__m512) __attribute__((alias("Sleef_ceilf16_avx512f")));
+EXPORT CONST __m512 Sleef_roundf16(__m512) __attribute__((alias("Sleef_roundf16_avx512f"))) ;
+EXPORT CONST VECTOR_CC __m512 _ZGVeN16v_Sleef_roundf(__m512) __attribute__((alias("Sleef_roundf16_avx512f")));
+EXPORT CONST __m512 Sleef_rintf16(__m512) __attribute__((alias("Sleef_rintf16_avx512f"))) ;
+EXPORT CONST VECTOR_CC __m512 _ZGVeN16v_Sleef_rintf(__m512) __attribute__((alias("Sleef_rintf16_avx512f")));
+EXPORT CONST __m512 Sleef_nextafterf16(__m512, __m512) __attribute__((alias("Sleef_nextafterf16_avx512f"))) ;
+EXPORT CONST VECTOR_CC __m512 _ZGVeN16vv_Sleef_nextafterf(__m512, __m512) __attribute__((alias("Sleef_nextafterf16_avx512f")));
+EXPORT CONST __m512 Sleef_frfrexpf16(__m512) __attribute__((alias("Sleef_frfrexpf16_avx512f"))) ;
+EXPORT CONST VECTOR_CC __m512 _ZGVeN16v_Sleef_frfrexpf(__m512) __attribute__((alias("Sleef_frfrexpf16_avx512f")));
+EXPORT CONST __m512i Sleef_expfrexpf16(__m512) __attribute__((alias("Sleef_expfrexpf16_avx512f"))) ;
+EXPORT CONST VECTOR_CC __m512i _ZGVeN16v_Sleef_expfrexpf(__m512) __attribute__((alias("Sleef_expfrexpf16_avx512f")));
+EXPORT CONST __m512 Sleef_fmodf16(__m512, __m512) __attribute__((alias("Sleef_fmodf16_avx512f"))) ;
+EXPORT CONST VECTOR_CC __m512 _ZGVeN16vv_Sleef_fmodf(__m512, __m512) __attribute__((alias("Sleef_fmodf16_avx512f")));
+EXPORT CONST __m512 Sleef_remainderf16(__m512, __m512) __attribute__((alias("Sleef_remainderf16_avx512f"))) ;
+EXPORT CONST VECTOR_CC __m512 _ZGVeN16vv_Sleef_remainderf(__m512, __m512) __attribute__((alias("Sleef_remainderf16_avx512f")));
+EXPORT CONST vfloat2 Sleef_modff16(__m512) __attribute__((alias("Sleef_modff16_avx512f"))) ;
+EXPORT CONST VECTOR_CC vfloat2 _ZGVeN16_Sleef_modff(__m512) __attribute__((alias("Sleef_modff16_avx512f")));
+EXPORT CONST __m512 Sleef_lgammaf16_u10(__m512) __attribute__((alias("Sleef_lgammaf16_u10avx512f"))) ;
+EXPORT CONST VECTOR_CC __m512 _ZGVeN16v_Sleef_lgammaf_u10(__m512) __attribute__((alias("Sleef_lgammaf16_u10avx512f")));
+EXPORT CONST __m512 Sleef_tgammaf16_u10(__m512) __attribute__((alias("Sleef_tgammaf16_u10avx512f"))) ;
+EXPORT CONST VECTOR_CC __m512 _ZGVeN16v_Sleef_tgammaf_u10(__m512) __attribute__((alias("Sleef_tgammaf16_u10avx512f")));
+EXPORT CONST __m512 Sleef_erff16_u10(__m512) __attribute__((alias("Sleef_erff16_u10avx512f"))) ;
+EXPORT CONST VECTOR_CC __m512 _ZGVeN16v_Sleef_erff_u10(__m512) __attribute__((alias("Sleef_erff16_u10avx512f")));
+EXPORT CONST __m512 Sleef_erfcf16_u15(__m512) __attribute__((alias("Sleef_erfcf16_u15avx512f"))) ;
+EXPORT CONST VECTOR_CC __m512 _ZGVeN16v_Sleef_erfcf_u15(__m512) __attribute__((alias("Sleef_erfcf16_u15avx512f")));
+EXPORT CONST __m512 Sleef_sigmoidf16_u10(__m512) __attribute__((alias("Sleef_sigmoidf16_u10avx512f"))) ;
+EXPORT CONST VECTOR_CC __m512 _ZGVeN16v_Sleef_sigmoidf_u10(__m512) __attribute__((alias("Sleef_sigmoidf16_u10avx512f")));
+EXPORT CONST __m512 Sleef_sigmoidf16_u35(__m512) __attribute__((alias("Sleef_sigmoidf16_u35avx512f"))) ;
+EXPORT CONST VECTOR_CC __m512 _ZGVeN16v_Sleef_sigmoidf_u35(__m512) __attribute__((alias("Sleef_sigmoidf16_u35avx512f")));
+EXPORT CONST __m512 Sleef_softplusf16_u10(__m512) __attribute__((alias("Sleef_softplusf16_u10avx512f"))) ;
+EXPORT CONST VECTOR_CC __m512 _ZGVeN16v_Sleef_softplusf_u10(__m512) __attribute__((alias("Sleef_softplusf16_u10avx512f")));
+EXPORT CONST __m512 Sleef_softplusf16_u35(__m512) __attribute__((alias("Sleef_softplusf16_u35avx512f"))) ;
+EXPORT CONST VECTOR_CC __m512 _ZGVeN16v_Sleef_softplusf_u35(__m512) __attribute__((alias("Sleef_softplusf16_u35avx512f")));
+EXPORT CONST __m512 Sleef_siluf16_u10(__m512) __attribute__((alias("Sleef_siluf16_u10avx512f"))) ;
+EXPORT CONST VECTOR_CC __m512 _ZGVeN16v_Sleef_siluf_u10(__m512) __attribute__((alias("Sleef_siluf16_u10avx512f")));
+EXPORT CONST __m512 Sleef_siluf16_u35(__m512) __attribute__((alias("Sleef_siluf16_u35avx512f"))) ;
+EXPORT CONST VECTOR_CC __m512 _ZGVeN16v_Sleef_siluf_u35(__m512) __attribute__((alias("Sleef_siluf16_u35avx512f")));
+EXPORT CONST __m512 Sleef_gelutanhf16_u10(__m512) __attribute__((alias("Sleef_gelutanhf16_u10avx512f"))) ;
+EXPORT CONST VECTOR_CC __m512 _ZGVeN16v_Sleef_gelutanhf_u10(__m512) __attribute__((alias("Sleef_gelutanhf16_u10avx512f")));
+EXPORT CONST __m512 Sleef_gelutanhf16_u35(__m512) __attribute__((alias("Sleef_gelutanhf16_u35avx512f"))) ;
+EXPORT CONST VECTOR_CC __m512 _ZGVeN16v_Sleef_gelutanhf_u35(__m512) __attribute__((alias("Sleef_gelutanhf16_u35avx512f")));
+EXPORT CONST __m512 Sleef_geluf16_u15(__m512) __attribute__((alias("Sleef_geluf16_u15avx512f"))) ;
+EXPORT CONST VECTOR_CC __m512 _ZGVeN16v_Sleef_geluf_u15(__m512) __attribute__((alias("Sleef_geluf16_u15avx512f")));
+EXPORT CONST int Sleef_getIntf16(int) __attribute__((alias("Sleef_getIntf16_avx512f"))) ;
+EXPORT CONST VECTOR_CC int _ZGVeN16_Sleef_getIntf(int) __attribute__((alias("Sleef_getIntf16_avx512f")));
+EXPORT CONST void * Sleef_getPtrf16(int) __attribute__((alias("Sleef_getPtrf16_avx512f"))) ;
+EXPORT CONST VECTOR_CC void * _ZGVeN16_Sleef_getPtrf(int) __attribute__((alias("Sleef_getPtrf16_avx512f")));
+
+#else // #ifdef ENABLE_ALIAS
+EXPORT CONST __m512  Sleef_sinf16_u35(__m512 a0) { return Sleef_sinf16_u35avx512f(a0); }
+EXPORT CONST __m512  Sleef_cosf16_u35(__m512 a0) { return Sleef_cosf16_u35avx512f(a0); }
+EXPORT CONST vfloat2  Sleef_sincosf16_u35(__m512 a0) { return Sleef_sincosf16_u35avx512f(a0); }
+EXPORT CONST __m512  Sleef_tanf16_u35(__m512 a0) { return Sleef_tanf16_u35avx512f(a0); }
+EXPORT CONST __m512  Sleef_asinf16_u35(__m512 a0) { return Sleef_asinf16_u35avx512f(a0); }
+EXPORT CONST __m512  Sleef_acosf16_u35(__m512 a0) { return Sleef_acosf16_u35avx512f(a0); }
+EXPORT CONST __m512  Sleef_atanf16_u35(__m512 a0) { return Sleef_atanf16_u35avx512f(a0); }
+EXPORT CONST __m512  Sleef_atan2f16_u35(__m512 a0, __m512 a1) { return Sleef_atan2f16_u35avx512f(a0, a1); }
+EXPORT CONST __m512  Sleef_logf16_u35(__m512 a0) { return Sleef_logf16_u35avx512f(a0); }
+EXPORT CONST __m512  Sleef_cbrtf16_u35(__m512 a0) { return Sleef_cbrtf16_u35avx512f(a0); }
+EXPORT CONST __m512  Sleef_sinf16_u10(__m512 a0) { return Sleef_sinf16_u10avx512f(a0); }
+EXPORT CONST __m512  Sleef_cosf16_u10(__m512 a0) { return Sleef_cosf16_u10avx512f(a0); }
+EXPORT CONST vfloat2  Sleef_sincosf16_u10(__m512 a0) { return Sleef_sincosf16_u10avx512f(a0); }
+EXPORT CONST __m512  Sleef_tanf16_u10(__m512 a0) { return Sleef_tanf16_u10avx512f(a0); }
+EXPORT CONST __m512  Sleef_asinf16_u10(__m512 a0) { return Sleef_asinf16_u10avx512f(a0); }
+EXPORT CONST __m512  Sleef_acosf16_u10(__m512 a0) { return Sleef_acosf16_u10avx512f(a0); }
+EXPORT CONST __m512  Sleef_atanf16_u10(__m512 a0) { return Sleef_atanf16_u10avx512f(a0); }
+EXPORT CONST __m512  Sleef_atan2f16_u10(__m512 a0, __m512 a1) { return Sleef_atan2f16_u10avx512f(a0, a1); }
+EXPORT CONST __m512  Sleef_logf16_u10(__m512 a0) { return Sleef_logf16_u10avx512f(a0); }
+EXPORT CONST __m512  Sleef_cbrtf16_u10(__m512 a0) { return Sleef_cbrtf16_u10avx512f(a0); }
+EXPORT CONST __m512  Sleef_expf16_u10(__m512 a0) { return Sleef_expf16_u10avx512f(a0); }
+EXPORT CONST __m512  Sleef_powf16_u10(__m512 a0, __m512 a1) { return Sleef_powf16_u10avx512f(a0, a1); }
+EXPORT CONST __m512  Sleef_sinhf16_u10(__m512 a0) { return Sleef_sinhf16_u10avx512f(a0); }
+EXPORT CONST __m512  Sleef_coshf16_u10(__m512 a0) { return Sleef_coshf16_u10avx512f(a0); }
+EXPORT CONST __m512  Sleef_tanhf16_u10(__m512 a0) { return Sleef_tanhf16_u10avx512f(a0); }
+EXPORT CONST __m512  Sleef_sinhf16_u35(__m512 a0) { return Sleef_sinhf16_u35avx512f(a0); }
+EXPORT CONST __m512  Sleef_coshf16_u35(__m512 a0) { return Sleef_coshf16_u35avx512f(a0); }
+EXPORT CONST __m512  Sleef_tanhf16_u35(__m512 a0) { return Sleef_tanhf16_u35avx512f(a0); }
+EXPORT CONST __m512  Sleef_fastsinf16_u3500(__m512 a0) { return Sleef_fastsinf16_u3500avx512f(a0); }
+EXPORT CONST __m512  Sleef_fastcosf16_u3500(__m512 a0) { return Sleef_fastcosf16_u3500avx512f(a0); }
+EXPORT CONST __m512  Sleef_fastpowf16_u3500(__m512 a0, __m512 a1) { return Sleef_fastpowf16_u3500avx512f(a0, a1); }
+EXPORT CONST __m512  Sleef_fastexpf16_u3500(__m512 a0) { return Sleef_fastexpf16_u3500avx512f(a0); }
+EXPORT CONST __m512  Sleef_fastexp2f16_u3500(__m512 a0) { return Sleef_fastexp2f16_u3500avx512f(a0); }
+EXPORT CONST __m512  Sleef_fastlogf16_u3500(__m512 a0) { return Sleef_fastlogf16_u3500avx512f(a0); }
+EXPORT CONST __m512  Sleef_fastlog2f16_u3500(__m512 a0) { return Sleef_fastlog2f16_u3500avx512f(a0); }
+EXPORT CONST __m512  Sleef_fasttanhf16_u3500(__m512 a0) { return Sleef_fasttanhf16_u3500avx512f(a0); }
+EXPORT CONST __m512  Sleef_fastatan2f16_u3500(__m512 a0, __m512 a1) { return Sleef_fastatan2f16_u3500avx512f(a0, a1); }
+EXPORT CONST __m512  Sleef_fastrsqrtf16_u3500(__m512 a0) { return Sleef_fastrsqrtf16_u3500avx512f(a0); }
+EXPORT CONST __m512  Sleef_fastrcpf16_u3500(__m512 a0) { return Sleef_fastrcpf16_u3500avx512f(a0); }
+EXPORT CONST __m512  Sleef_sinrf16_u35(__m512 a0) { return Sleef_sinrf16_u35avx512f(a0); }
+EXPORT CONST __m512  Sleef_cosrf16_u35(__m512 a0) { return Sleef_cosrf16_u35avx512f(a0); }
+EXPORT CONST vfloat2  Sleef_sincosrf16_u35(__m512 a0) { return Sleef_sincosrf16_u35avx512f(a0); }
+EXPORT CONST __m512  Sleef_tanrf16_u35(__m512 a0) { return Sleef_tanrf16_u35avx512f(a0); }
+EXPORT CONST __m512  Sleef_asinhf16_u10(__m512 a0) { return Sleef_asinhf16_u10avx512f(a0); }
+EXPORT CONST __m512  Sleef_acoshf16_u10(__m512 a0) { return Sleef_acoshf16_u10avx512f(a0); }
+EXPORT CONST __m512  Sleef_atanhf16_u10(__m512 a0) { return Sleef_atanhf16_u10avx512f(a0); }
+EXPORT CONST __m512  Sleef_exp2f16_u10(__m512 a0) { return Sleef_exp2f16_u10avx512f(a0); }
+EXPORT CONST __m512  Sleef_exp2f16_u35(__m512 a0) { return Sleef_exp2f16_u35avx512f(a0); }
+EXPORT CONST __m512  Sleef_exp10f16_u10(__m512 a0) { return Sleef_exp10f16_u10avx512f(a0); }
+EXPORT CONST __m512  Sleef_exp10f16_u35(__m512 a0) { return Sleef_exp10f16_u35avx512f(a0); }
+EXPORT CONST __m512  Sleef_expm1f16_u10(__m512 a0) { return Sleef_expm1f16_u10avx512f(a0); }
+EXPORT CONST __m512  Sleef_log10f16_u10(__m512 a0) { return Sleef_log10f16_u10avx512f(a0); }
+EXPORT CONST __m512  Sleef_log2f16_u10(__m512 a0) { return Sleef_log2f16_u10avx512f(a0); }
+EXPORT CONST __m512  Sleef_log2f16_u35(__m512 a0) { return Sleef_log2f16_u35avx512f(a0); }
+EXPORT CONST __m512  Sleef_log1pf16_u10(__m512 a0) { return Sleef_log1pf16_u10avx512f(a0); }
+EXPORT CONST vfloat2  Sleef_sincospif16_u05(__m512 a0) { return Sleef_sincospif16_u05avx512f(a0); }
+EXPORT CONST vfloat2  Sleef_sincospif16_u35(__m512 a0) { return Sleef_sincospif16_u35avx512f(a0); }
+EXPORT CONST __m512  Sleef_sinpif16_u05(__m512 a0) { return Sleef_sinpif16_u05avx512f(a0); }
+EXPORT CONST __m512  Sleef_cospif16_u05(__m512 a0) { return Sleef_cospif16_u05avx512f(a0); }
+EXPORT CONST __m512  Sleef_ldexpf16(__m512 a0, __m512i a1) { return Sleef_ldexpf16_avx512f(a0, a1); }
+EXPORT CONST __m512i  Sleef_ilogbf16(__m512 a0) { return Sleef_ilogbf16_avx512f(a0); }
+EXPORT CONST __m512  Sleef_fmaf16(__m512 a0, __m512 a1, __m512 a2) { return Sleef_fmaf16_avx512f(a0, a1, a2); }
+EXPORT CONST __m512  Sleef_sqrtf16(__m512 a0) { return Sleef_sqrtf16_avx512f(a0); }
+EXPORT CONST __m512  Sleef_sqrtf16_u05(__m512 a0) { return Sleef_sqrtf16_u05avx512f(a0); }
+EXPORT CONST __m512  Sleef_sqrtf16_u35(__m512 a0) { return Sleef_sqrtf16_u35avx512f(a0); }
+EXPORT CONST __m512  Sleef_hypotf16_u05(__m512 a0, __m512 a1) { return Sleef_hypotf16_u05avx512f(a0, a1); }
+EXPORT CONST __m512  Sleef_hypotf16_u35(__m512 a0, __m512 a1) { return Sleef_hypotf16_u35avx512f(a0, a1); }
+EXPORT CONST __m512  Sleef_fabsf16(__m512 a0) { return Sleef_fabsf16_avx512f(a0); }
+EXPORT CONST __m512  Sleef_copysignf16(__m512 a0, __m512 a1) { return Sleef_copysignf16_avx512f(a0, a1); }
+EXPORT CONST __m512  Sleef_fmaxf16(__m512 a0, __m512 a1) { return Sleef_fmaxf16_avx512f(a0, a1); }
+EXPORT CONST __m512  Sleef_fminf16(__m512 a0, __m512 a1) { return Sleef_fminf16_avx512f(a0, a1); }
+EXPORT CONST __m512  Sleef_fdimf16(__m512 a0, __m512 a1) { return Sleef_fdimf16_avx512f(a0, a1); }
+EXPORT CONST __m512  Sleef_truncf16(__m512 a0) { return Sleef_truncf16_avx512f(a0); }
+EXPORT CONST __m512  Sleef_floorf16(__m512 a0) { return Sleef_floorf16_avx512f(a0); }
+EXPORT CONST __m512  Sleef_ceilf16(__m512 a0) { return Sleef_ceilf16_avx512f(a0); }
+EXPORT CONST __m512  Sleef_roundf16(__m512 a0) { return Sleef_roundf16_avx512f(a0); }
+EXPORT CONST __m512  Sleef_rintf16(__m512 a0) { return Sleef_rintf16_avx512f(a0); }
+EXPORT CONST __m512  Sleef_nextafterf16(__m512 a0, __m512 a1) { return Sleef_nextafterf16_avx512f(a0, a1); }
+EXPORT CONST __m512  Sleef_frfrexpf16(__m512 a0) { return Sleef_frfrexpf16_avx512f(a0); }
+EXPORT CONST __m512i  Sleef_expfrexpf16(__m512 a0) { return Sleef_expfrexpf16_avx512f(a0); }
+EXPORT CONST __m512  Sleef_fmodf16(__m512 a0, __m512 a1) { return Sleef_fmodf16_avx512f(a0, a1); }
+EXPORT CONST __m512  Sleef_remainderf16(__m512 a0, __m512 a1) { return Sleef_remainderf16_avx512f(a0, a1); }
+EXPORT CONST vfloat2  Sleef_modff16(__m512 a0) { return Sleef_modff16_avx512f(a0); }
+EXPORT CONST __m512  Sleef_lgammaf16_u10(__m512 a0) { return Sleef_lgammaf16_u10avx512f(a0); }
+EXPORT CONST __m512  Sleef_tgammaf16_u10(__m512 a0) { return Sleef_tgammaf16_u10avx512f(a0); }
+EXPORT CONST __m512  Sleef_erff16_u10(__m512 a0) { return Sleef_erff16_u10avx512f(a0); }
+EXPORT CONST __m512  Sleef_erfcf16_u15(__m512 a0) { return Sleef_erfcf16_u15avx512f(a0); }
+EXPORT CONST __m512  Sleef_sigmoidf16_u10(__m512 a0) { return Sleef_sigmoidf16_u10avx512f(a0); }
+EXPORT CONST __m512  Sleef_sigmoidf16_u35(__m512 a0) { return Sleef_sigmoidf16_u35avx512f(a0); }
+EXPORT CONST __m512  Sleef_softplusf16_u10(__m512 a0) { return Sleef_softplusf16_u10avx512f(a0); }
+EXPORT CONST __m512  Sleef_softplusf16_u35(__m512 a0) { return Sleef_softplusf16_u35avx512f(a0); }
+EXPORT CONST __m512  Sleef_siluf16_u10(__m512 a0) { return Sleef_siluf16_u10avx512f(a0); }
+EXPORT CONST __m512  Sleef_siluf16_u35(__m512 a0) { return Sleef_siluf16_u35avx512f(a0); }
+EXPORT CONST __m512  Sleef_gelutanhf16_u10(__m512 a0) { return Sleef_gelutanhf16_u10avx512f(a0); }
+EXPORT CONST __m512  Sleef_gelutanhf16_u35(__m512 a0) { return Sleef_gelutanhf16_u35avx512f(a0); }
+EXPORT CONST __m512  Sleef_geluf16_u15(__m512 a0) { return Sleef_geluf16_u15avx512f(a0); }
+EXPORT CONST int  Sleef_getIntf16(int a0) { return Sleef_getIntf16_avx512f(a0); }
+EXPORT CONST void *  Sleef_getPtrf16(int a0) { return Sleef_getPtrf16_avx512f(a0); }
+
+#endif // #ifdef ENABLE_ALIAS
+#endif // #ifdef __SLEEFSIMDSP_C__
+#ifdef __SLEEFSIMDDP_C__
+#ifdef ENABLE_ALIAS
+EXPORT CONST __m512d Sleef_sind8_u35(__m512d) __attribute__((alias("Sleef_sind8_u35avx512f"))) ;
+EXPORT CONST VECTOR_CC __m512d _ZGVeN8v_Sleef_sin_u35(__m512d) __attribute__((alias("Sleef_sind8_u35avx512f")));
+EXPORT CONST __m512d Sleef_cosd8_u35(__m512d) __attribute__((alias("Sleef_cosd8_u35avx512f"))) ;
+EXPORT CONST VECTOR_CC __m512d _ZGVeN8v_Sleef_cos_u35(__m512d) __attribute__((alias("Sleef_cosd8_u35avx512f")));
+EXPORT CONST vdouble2 Sleef_sincosd8_u35(__m512d) __attribute__((alias("Sleef_sincosd8_u35avx512f"))) ;
+EXPORT CONST VECTOR_CC vdouble2 _ZGVeN8_Sleef_sincos_u35(__m512d) __attribute__((alias("Sleef_sincosd8_u35avx512f")));
+EXPORT CONST __m512d Sleef_tand8_u35(__m512d) __attribute__((alias("Sleef_tand8_u35avx512f"))) ;
+EXPORT CONST VECTOR_CC __m512d _ZGVeN8v_Sleef_tan_u35(__m512d) __attribute__((alias("Sleef_tand8_u35avx512f")));
+EXPORT CONST __m512d Sleef_asind8_u35(__m512d) __attribute__((alias("Sleef_asind8_u35avx512f"))) ;
+EXPORT CONST VECTOR_CC __m512d _ZGVeN8v_Sleef_asin_u35(__m512d) __attribute__((alias("Sleef_asind8_u35avx512f")));
+EXPORT CONST __m512d Sleef_acosd8_u35(__m512d) __attribute__((alias("Sleef_acosd8_u35avx512f"))) ;
+EXPORT CONST VECTOR_CC __m512d _ZGVeN8v_Sleef_acos_u35(__m512d) __attribute__((alias("Sleef_acosd8_u35avx512f")));
+EXPORT CONST __m512d Sleef_atand8_u35(__m512d) __attribute__((alias("Sleef_atand8_u35avx512f"))) ;
+EXPORT CONST VECTOR_CC __m512d _ZGVeN8v_Sleef_atan_u35(__m512d) __attribute__((alias("Sleef_atand8_u35avx512f")));
+EXPORT CONST __m512d Sleef_atan2d8_u35(__m512d, __m512d) __attribute__((alias("Sleef_atan2d8_u35avx512f"))) ;
+EXPORT CONST VECTOR_CC __m512d _ZGVeN8vv_Sleef_atan2_u35(__m512d, __m512d) __attribute__((alias("Sleef_atan2d8_u35avx512f")));
+EXPORT CONST __m512d Sleef_logd8_u35(__m512d) __attribute__((alias("Sleef_logd8_u35avx512f"))) ;
+EXPORT CONST VECTOR_CC __m512d _ZGVeN8v_Sleef_log_u35(__m512d) __attribute__((alias("Sleef_logd8_u35avx512f")));
+EXPORT CONST __m512d Sleef_cbrtd8_u35(__m512d) __attribute__((alias("Sleef_cbrtd8_u35avx512f"))) ;
+EXPORT CONST VECTOR_CC __m512d _ZGVeN8v_Sleef_cbrt_u35(__m512d) __attribute__((alias("Sleef_cbrtd8_u35avx512f")));
+EXPORT CONST __m512d Sleef_sind8_u10(__m512d) __attribute__((alias("Sleef_sind8_u10avx512f"))) ;
+EXPORT CONST VECTOR_CC __m512d _ZGVeN8v_Sleef_sin_u10(__m512d) __attribute__((alias("Sleef_sind8_u10avx512f")));
+EXPORT CONST __m512d Sleef_cosd8_u10(__m512d) __attribute__((alias("Sleef_cosd8_u10avx512f"))) ;
+EXPORT CONST VECTOR_CC __m512d _ZGVeN8v_Sleef_cos_u10(__m512d) __attribute__((alias("Sleef_cosd8_u10avx512f")));
+EXPORT CONST vdouble2 Sleef_sincosd8_u10(__m512d) __attribute__((alias("Sleef_sincosd8_u10avx512f"))) ;
+EXPORT CONST VECTOR_CC vdouble2 _ZGVeN8_Sleef_sincos_u10(__m512d) __attribute__((alias("Sleef_sincosd8_u10avx512f")));
+EXPORT CONST __m512d Sleef_tand8_u10(__m512d) __attribute__((alias("Sleef_tand8_u10avx512f"))) ;
+EXPORT CONST VECTOR_CC __m512d _ZGVeN8v_Sleef_tan_u10(__m512d) __attribute__((alias("Sleef_tand8_u10avx512f")));
+EXPORT CONST __m512d Sleef_asind8_u10(__m512d) __attribute__((alias("Sleef_asind8_u10avx512f"))) ;
+EXPORT CONST VECTOR_CC __m512d _ZGVeN8v_Sleef_asin_u10(__m512d) __attribute__((alias("Sleef_asind8_u10avx512f")));
+EXPORT CONST __m512d Sleef_acosd8_u10(__m512d) __attribute__((alias("Sleef_acosd8_u10avx512f"))) ;
+EXPORT CONST VECTOR_CC __m512d _ZGVeN8v_Sleef_acos_u10(__m512d) __attribute__((alias("Sleef_acosd8_u10avx512f")));
+EXPORT CONST __m512d Sleef_atand8_u10(__m512d) __attribute__((alias("Sleef_atand8_u10avx512f"))) ;
+EXPORT CONST VECTOR_CC __m512d _ZGVeN8v_Sleef_atan_u10(__m512d) __attribute__((alias("Sleef_atand8_u10avx512f")));
+EXPORT CONST __m512d Sleef_atan2d8_u10(__m512d, __m512d) __attribute__((alias("Sleef_atan2d8_u10avx512f"))) ;
+EXPORT CONST VECTOR_CC __m512d _ZGVeN8vv_Sleef_atan2_u10(__m512d, __m512d) __attribute__((alias("Sleef_atan2d8_u10avx512f")));
+EXPORT CONST __m512d Sleef_logd8_u10(__m512d) __attribute__((alias("Sleef_logd8_u10avx512f"))) ;
+EXPORT CONST VECTOR_CC __m512d _ZGVeN8v_Sleef_log_u10(__m512d) __attribute__((alias("Sleef_logd8_u10avx512f")));
+EXPORT CONST __m512d Sleef_cbrtd8_u10(__m512d) __attribute__((alias("Sleef_cbrtd8_u10avx512f"))) ;
+EXPORT CONST VECTOR_CC __m512d _ZGVeN8v_Sleef_cbrt_u10(__m512d) __attribute__((alias("Sleef_cbrtd8_u10avx512f")));
+EXPORT CONST __m512d Sleef_expd8_u10(__m512d) __attribute__((alias("Sleef_expd8_u10avx512f"))) ;
+EXPORT CONST VECTOR_CC __m512d _ZGVeN8v_Sleef_exp_u10(__m512d) __attribute__((alias("Sleef_expd8_u10avx512f")));
+EXPORT CONST __m512d Sleef_powd8_u10(__m512d, __m512d) __attribute__((alias("Sleef_powd8_u10avx512f"))) ;
+EXPORT CONST VECTOR_CC __m512d _ZGVeN8vv_Sleef_pow_u10(__m512d, __m512d) __attribute__((alias("Sleef_powd8_u10avx512f")));
+EXPORT CONST __m512d Sleef_sinhd8_u10(__m512d) __attribute__((alias("Sleef_sinhd8_u10avx512f"))) ;
+EXPORT CONST VECTOR_CC __m512d _ZGVeN8v_Sleef_sinh_u10(__m512d) __attribute__((alias("Sleef_sinhd8_u10avx512f")));
+EXPORT CONST __m512d Sleef_coshd8_u10(__m512d) __attribute__((alias("Sleef_coshd8_u10avx512f"))) ;
+EXPORT CONST VECTOR_CC __m512d _ZGVeN8v_Sleef_cosh_u10(__m512d) __attribute__((alias("Sleef_coshd8_u10avx512f")));
+EXPORT CONST __m512d Sleef_tanhd8_u10(__m512d) __attribute__((alias("Sleef_tanhd8_u10avx512f"))) ;
+EXPORT CONST VECTOR_CC __m512d _ZGVeN8v_Sleef_tanh_u10(__m512d) __attribute__((alias("Sleef_tanhd8_u10avx512f")));
+EXPORT CONST __m512d Sleef_sinhd8_u35(__m512d) __attribute__((alias("Sleef_sinhd8_u35avx512f"))) ;
+EXPORT CONST VECTOR_CC __m512d _ZGVeN8v_Sleef_sinh_u35(__m512d) __attribute__((alias("Sleef_sinhd8_u35avx512f")));
+EXPORT CONST __m512d Sleef_coshd8_u35(__m512d) __attribute__((alias("Sleef_coshd8_u35avx512f"))) ;
+EXPORT CONST VECTOR_CC __m512d _ZGVeN8v_Sleef_cosh_u35(__m512d) __attribute__((alias("Sleef_coshd8_u35avx512f")));
+EXPORT CONST __m512d Sleef_tanhd8_u35(__m512d) __attribute__((alias("Sleef_tanhd8_u35avx512f"))) ;
+EXPORT CONST VECTOR_CC __m512d _ZGVeN8v_Sleef_tanh_u35(__m512d) __attribute__((alias("Sleef_tanhd8_u35avx512f")));
+EXPORT CONST __m512d Sleef_fastexpd8_u3500(__m512d) __attribute__((alias("Sleef_fastexpd8_u3500avx512f"))) ;
+EXPORT CONST VECTOR_CC __m512d _ZGVeN8v_Sleef_fastexp_u3500(__m512d) __attribute__((alias("Sleef_fastexpd8_u3500avx512f")));
+EXPORT CONST __m512d Sleef_fastexp2d8_u3500(__m512d) __attribute__((alias("Sleef_fastexp2d8_u3500avx512f"))) ;
+EXPORT CONST VECTOR_CC __m512d _ZGVeN8v_Sleef_fastexp2_u3500(__m512d) __attribute__((alias("Sleef_fastexp2d8_u3500avx512f")));
+EXPORT CONST __m512d Sleef_fastlogd8_u3500(__m512d) __attribute__((alias("Sleef_fastlogd8_u3500avx512f"))) ;
+EXPORT CONST VECTOR_CC __m512d _ZGVeN8v_Sleef_fastlog_u3500(__m512d) __attribute__((alias("Sleef_fastlogd8_u3500avx512f")));
+EXPORT CONST __m512d Sleef_fastlog2d8_u3500(__m512d) __attribute__((alias("Sleef_fastlog2d8_u3500avx512f"))) ;
+EXPORT CONST VECTOR_CC __m512d _ZGVeN8v_Sleef_fastlog2_u3500(__m512d) __attribute__((alias("Sleef_fastlog2d8_u3500avx512f")));
+EXPORT CONST __m512d Sleef_fasttanhd8_u3500(__m512d) __attribute__((alias("Sleef_fasttanhd8_u3500avx512f"))) ;
+EXPORT CONST VECTOR_CC __m512d _ZGVeN8v_Sleef_fasttanh_u3500(__m512d) __attribute__((alias("Sleef_fasttanhd8_u3500avx512f")));
+EXPORT CONST __m512d Sleef_fastatan2d8_u3500(__m512d, __m512d) __attribute__((alias("Sleef_fastatan2d8_u3500avx512f"))) ;
+EXPORT CONST VECTOR_CC __m512d _ZGVeN8vv_Sleef_fastatan2_u3500(__m512d, __m512d) __attribute__((alias("Sleef_fastatan2d8_u3500avx512f")));
+EXPORT CONST __m512d Sleef_fastrsqrtd8_u3500(__m512d) __attribute__((alias("Sleef_fastrsqrtd8_u3500avx512f"))) ;
+EXPORT CONST VECTOR_CC __m512d _ZGVeN8v_Sleef_fastrsqrt_u3500(__m512d) __attribute__((alias("Sleef_fastrsqrtd8_u3500avx512f")));
+EXPORT CONST __m512d Sleef_fastrcpd8_u3500(__m512d) __attribute__((alias("Sleef_fastrcpd8_u3500avx512f"))) ;
+EXPORT CONST VECTOR_CC __m512d _ZGVeN8v_Sleef_fastrcp_u3500(__m512d) __attribute__((alias("Sleef_fastrcpd8_u3500avx512f")));
+EXPORT CONST __m512d Sleef_sinrd8_u35(__m512d) __attribute__((alias("Sleef_sinrd8_u35avx512f"))) ;
+EXPORT CONST VECTOR_CC __m512d _ZGVeN8v_Sleef_sinr_u35(__m512d) __attribute__((alias("Sleef_sinrd8_u35avx512f")));
+EXPORT CONST __m512d Sleef_cosrd8_u35(__m512d) __attribute__((alias("Sleef_cosrd8_u35avx512f"))) ;
+EXPORT CONST VECTOR_CC __m512d _ZGVeN8v_Sleef_cosr_u35(__m512d) __attribute__((alias("Sleef_cosrd8_u35avx512f")));
+EXPORT CONST vdouble2 Sleef_sincosrd8_u35(__m512d) __attribute__((alias("Sleef_sincosrd8_u35avx512f"))) ;
+EXPORT CONST VECTOR_CC vdouble2 _ZGVeN8_Sleef_sincosr_u35(__m512d) __attribute__((alias("Sleef_sincosrd8_u35avx512f")));
+EXPORT CONST __m512d Sleef_tanrd8_u35(__m512d) __attribute__((alias("Sleef_tanrd8_u35avx512f"))) ;
+EXPORT CONST VECTOR_CC __m512d _ZGVeN8v_Sleef_tanr_u35(__m512d) __attribute__((alias("Sleef_tanrd8_u35avx512f")));
+EXPORT CONST __m512d Sleef_asinhd8_u10(__m512d) __attribute__((alias("Sleef_asinhd8_u10avx512f"))) ;
+EXPORT CONST VECTOR_CC __m512d _ZGVeN8v_Sleef_asinh_u10(__m512d) __attribute__((alias("Sleef_asinhd8_u10avx512f")));
+EXPORT CONST __m512d Sleef_acoshd8_u10(__m512d) __attribute__((alias("Sleef_acoshd8_u10avx512f"))) ;
+EXPORT CONST VECTOR_CC __m512d _ZGVeN8v_Sleef_acosh_u10(__m512d) __attribute__((alias("Sleef_acoshd8_u10avx512f")));
+EXPORT CONST __m512d Sleef_atanhd8_u10(__m512d) __attribute__((alias("Sleef_atanhd8_u10avx512f"))) ;
+EXPORT CONST VECTOR_CC __m512d _ZGVeN8v_Sleef_atanh_u10(__m512d) __attribute__((alias("Sleef_atanhd8_u10avx512f")));
+EXPORT CONST __m512d Sleef_exp2d8_u10(__m512d) __attribute__((alias("Sleef_exp2d8_u10avx512f"))) ;
+EXPORT CONST VECTOR_CC __m512d _ZGVeN8v_Sleef_exp2_u10(__m512d) __attribute__((alias("Sleef_exp2d8_u10avx512f")));
+EXPORT CONST __m512d Sleef_exp2d8_u35(__m512d) __attribute__((alias("Sleef_exp2d8_u35avx512f"))) ;
+EXPORT CONST VECTOR_CC __m512d _ZGVeN8v_Sleef_exp2_u35(__m512d) __attribute__((alias("Sleef_exp2d8_u35avx512f")));
+EXPORT CONST __m512d Sleef_exp10d8_u10(__m512d) __attribute__((alias("Sleef_exp10d8_u10avx512f"))) ;
+EXPORT CONST VECTOR_CC __m512d _ZGVeN8v_Sleef_exp10_u10(__m512d) __attribute__((alias("Sleef_exp10d8_u10avx512f")));
+EXPORT CONST __m512d Sleef_exp10d8_u35(__m512d) __attribute__((alias("Sleef_exp10d8_u35avx512f"))) ;
+EXPORT CONST VECTOR_CC __m512d _ZGVeN8v_Sleef_exp10_u35(__m512d) __attribute__((alias("Sleef_exp10d8_u35avx512f")));
+EXPORT CONST __m512d Sleef_expm1d8_u10(__m512d) __attribute__((alias("Sleef_expm1d8_u10avx512f"))) ;
+EXPORT CONST VECTOR_CC __m512d _ZGVeN8v_Sleef_expm1_u10(__m512d) __attribute__((alias("Sleef_expm1d8_u10avx512f")));
+EXPORT CONST __m512d Sleef_log10d8_u10(__m512d) __attribute__((alias("Sleef_log10d8_u10avx512f"))) ;
+EXPORT CONST VECTOR_CC __m512d _ZGVeN8v_Sleef_log10_u10(__m512d) __attribute__((alias("Sleef_log10d8_u10avx512f")));
+EXPORT CONST __m512d Sleef_log2d8_u10(__m512d) __attribute__((alias("Sleef_log2d8_u10avx512f"))) ;
+EXPORT CONST VECTOR_CC __m512d _ZGVeN8v_Sleef_log2_u10(__m512d) __attribute__((alias("Sleef_log2d8_u10avx512f")));
+EXPORT CONST __m512d Sleef_log2d8_u35(__m512d) __attribute__((alias("Sleef_log2d8_u35avx512f"))) ;
+EXPORT CONST VECTOR_CC __m512d _ZGVeN8v_Sleef_log2_u35(__m512d) __attribute__((alias("Sleef_log2d8_u35avx512f")));
+EXPORT CONST __m512d Sleef_log1pd8_u10(__m512d) __attribute__((alias("Sleef_log1pd8_u10avx512f"))) ;
+EXPORT CONST VECTOR_CC __m512d _ZGVeN8v_Sleef_log1p_u10(__m512d) __attribute__((alias("Sleef_log1pd8_u10avx512f")));
+EXPORT CONST vdouble2 Sleef_sincospid8_u05(__m512d) __attribute__((alias("Sleef_sincospid8_u05avx512f"))) ;
+EXPORT CONST VECTOR_CC vdouble2 _ZGVeN8_Sleef_sincospi_u05(__m512d) __attribute__((alias("Sleef_sincospid8_u05avx512f")));
+EXPORT CONST vdouble2 Sleef_sincospid8_u35(__m512d) __attribute__((alias("Sleef_sincospid8_u35avx512f"))) ;
+EXPORT CONST VECTOR_CC vdouble2 _ZGVeN8_Sleef_sincospi_u35(__m512d) __attribute__((alias("Sleef_sincospid8_u35avx512f")));
+EXPORT CONST __m512d Sleef_sinpid8_u05(__m512d) __attribute__((alias("Sleef_sinpid8_u05avx512f"))) ;
+EXPORT CONST VECTOR_CC __m512d _ZGVeN8v_Sleef_sinpi_u05(__m512d) __attribute__((alias("Sleef_sinpid8_u05avx512f")));
+EXPORT CONST __m512d Sleef_cospid8_u05(__m512d) __attribute__((alias("Sleef_cospid8_u05avx512f"))) ;
+EXPORT CONST VECTOR_CC __m512d _ZGVeN8v_Sleef_cospi_u05(__m512d) __attribute__((alias("Sleef_cospid8_u05avx512f")));
+EXPORT CONST __m512d Sleef_ldexpd8(__m512d, __m256i) __attribute__((alias("Sleef_ldexpd8_avx512f"))) ;
+EXPORT CONST VECTOR_CC __m512d _ZGVeN8vv_Sleef_ldexp(__m512d, __m256i) __attribute__((alias("Sleef_ldexpd8_avx512f")));
+EXPORT CONST __m256i Sleef_ilogbd8(__m512d) __attribute__((alias("Sleef_ilogbd8_avx512f"))) ;
+EXPORT CONST VECTOR_CC __m256i _ZGVeN8v_Sleef_ilogb(__m512d) __attribute__((alias("Sleef_ilogbd8_avx512f")));
+EXPORT CONST __m512d Sleef_fmad8(__m512d, __m512d, __m512d) __attribute__((alias("Sleef_fmad8_avx512f"))) ;
+EXPORT CONST VECTOR_CC __m512d _ZGVeN8vvv_Sleef_fma(__m512d, __m512d, __m512d) __attribute__((alias("Sleef_fmad8_avx512f")));
+EXPORT CONST __m512d Sleef_sqrtd8(__m512d) __attribute__((alias("Sleef_sqrtd8_avx512f"))) ;
+EXPORT CONST VECTOR_CC __m512d _ZGVeN8v_Sleef_sqrt(__m512d) __attribute__((alias("Sleef_sqrtd8_avx512f")));
+EXPORT CONST __m512d Sleef_sqrtd8_u05(__m512d) __attribute__((alias("Sleef_sqrtd8_u05avx512f"))) ;
+EXPORT CONST VECTOR_CC __m512d _ZGVeN8v_Sleef_sqrt_u05(__m512d) __attribute__((alias("Sleef_sqrtd8_u05avx512f")));
+EXPORT CONST __m512d Sleef_sqrtd8_u35(__m512d) __attribute__((alias("Sleef_sqrtd8_u35avx512f"))) ;
+EXPORT CONST VECTOR_CC __m512d _ZGVeN8v_Sleef_sqrt_u35(__m512d) __attribute__((alias("Sleef_sqrtd8_u35avx512f")));
+EXPORT CONST __m512d Sleef_hypotd8_u05(__m512d, __m512d) __attribute__((alias("Sleef_hypotd8_u05avx512f"))) ;
+EXPORT CONST VECTOR_CC __m512d _ZGVeN8vv_Sleef_hypot_u05(__m512d, __m512d) __attribute__((alias("Sleef_hypotd8_u05avx512f")));
+EXPORT CONST __m512d Sleef_hypotd8_u35(__m512d, __m512d) __attribute__((alias("Sleef_hypotd8_u35avx512f"))) ;
+EXPORT CONST VECTOR_CC __m512d _ZGVeN8vv_Sleef_hypot_u35(__m512d, __m512d) __attribute__((alias("Sleef_hypotd8_u35avx512f")));
+EXPORT CONST __m512d Sleef_fabsd8(__m512d) __attribute__((alias("Sleef_fabsd8_avx512f"))) ;
+EXPORT CONST VECTOR_CC __m512d _ZGVeN8v_Sleef_fabs(__m512d) __attribute__((alias("Sleef_fabsd8_avx512f")));
+EXPORT CONST __m512d Sleef_copysignd8(__m512d, __m512d) __attribute__((alias("Sleef_copysignd8_avx512f"))) ;
+EXPORT CONST VECTOR_CC __m512d _ZGVeN8vv_Sleef_copysign(__m512d, __m512d) __attribute__((alias("Sleef_copysignd8_avx512f")));
+EXPORT CONST __m512d Sleef_fmaxd8(__m512d, __m512d) __attribute__((alias("Sleef_fmaxd8_avx512f"))) ;
+EXPORT CONST VECTOR_CC __m512d _ZGVeN8vv_Sleef_fmax(__m512d, __m512d) __attribute__((alias("Sleef_fmaxd8_avx512f")));
+EXPORT CONST __m512d Sleef_fmind8(__m512d, __m512d) __attribute__((alias("Sleef_fmind8_avx512f"))) ;
+EXPORT CONST VECTOR_CC __m512d _ZGVeN8vv_Sleef_fmin(__m512d, __m512d) __attribute__((alias("Sleef_fmind8_avx512f")));
+EXPORT CONST __m512d Sleef_fdimd8(__m512d, __m512d) __attribute__((alias("Sleef_fdimd8_avx512f"))) ;
+EXPORT CONST VECTOR_CC __m512d _ZGVeN8vv_Sleef_fdim(__m512d, __m512d) __attribute__((alias("Sleef_fdimd8_avx512f")));
+EXPORT CONST __m512d Sleef_truncd8(__m512d) __attribute__((alias("Sleef_truncd8_avx512f"))) ;
+EXPORT CONST VECTOR_CC __m512d _ZGVeN8v_Sleef_trunc(__m512d) __attribute__((alias("Sleef_truncd8_avx512f")));
+EXPORT CONST __m512d Sleef_floord8(__m512d) __attribute__((alias("Sleef_floord8_avx512f"))) ;
+EXPORT CONST VECTOR_CC __m512d _ZGVeN8v_Sleef_floor(__m512d) __attribute__((alias("Sleef_floord8_avx512f")));
+EXPORT CONST __m512d Sleef_ceild8(__m512d) __attribute__((alias("Sleef_ceild8_avx512f"))) ;
+EXPORT CONST VECTOR_CC __m512d _ZGVeN8v_Sleef_ceil(__m512d) __attribute__((alias("Sleef_ceild8_avx512f")));
+EXPORT CONST __m512d Sleef_roundd8(__m512d) __attribute__((alias("Sleef_roundd8_avx512f"))) ;
+EXPORT CONST VECTOR_CC __m512d _ZGVeN8v_Sleef_round(__m512d) __attribute__((alias("Sleef_roundd8_avx512f")));
+EXPORT CONST __m512d Sleef_rintd8(__m512d) __attribute__((alias("Sleef_rintd8_avx512f"))) ;
+EXPORT CONST VECTOR_CC __m512d _ZGVeN8v_Sleef_rint(__m512d) __attribute__((alias("Sleef_rintd8_avx512f")));
+EXPORT CONST __m512d Sleef_nextafterd8(__m512d, __m512d) __attribute__((alias("Sleef_nextafterd8_avx512f"))) ;
+EXPORT CONST VECTOR_CC __m512d _ZGVeN8vv_Sleef_nextafter(__m512d, __m512d) __attribute__((alias("Sleef_nextafterd8_avx512f")));
+EXPORT CONST __m512d Sleef_frfrexpd8(__m512d) __attribute__((alias("Sleef_frfrexpd8_avx512f"))) ;
+EXPORT CONST VECTOR_CC __m512d _ZGVeN8v_Sleef_frfrexp(__m512d) __attribute__((alias("Sleef_frfrexpd8_avx512f")));
+EXPORT CONST __m256i Sleef_expfrexpd8(__m512d) __attribute__((alias("Sleef_expfrexpd8_avx512f"))) ;
+EXPORT CONST VECTOR_CC __m256i _ZGVeN8v_Sleef_expfrexp(__m512d) __attribute__((alias("Sleef_expfrexpd8_avx512f")));
+EXPORT CONST __m512d Sleef_fmodd8(__m512d, __m512d) __attribute__((alias("Sleef_fmodd8_avx512f"))) ;
+EXPORT CONST VECTOR_CC __m512d _ZGVeN8vv_Sleef_fmod(__m512d, __m512d) __attribute__((alias("Sleef_fmodd8_avx512f")));
+EXPORT CONST __m512d Sleef_remainderd8(__m512d, __m512d) __attribute__((alias("Sleef_remainderd8_avx512f"))) ;
+EXPORT CONST VECTOR_CC __m512d _ZGVeN8vv_Sleef_remainder(__m512d, __m512d) __attribute__((alias("Sleef_remainderd8_avx512f")));
+EXPORT CONST vdouble2 Sleef_modfd8(__m512d) __attribute__((alias("Sleef_modfd8_avx512f"))) ;
+EXPORT CONST VECTOR_CC vdouble2 _ZGVeN8_Sleef_modf(__m512d) __attribute__((alias("Sleef_modfd8_avx512f")));
+EXPORT CONST __m512d Sleef_lgammad8_u10(__m512d) __attribute__((alias("Sleef_lgammad8_u10avx512f"))) ;
+EXPORT CONST VECTOR_CC __m512d _ZGVeN8v_Sleef_lgamma_u10(__m512d) __attribute__((alias("Sleef_lgammad8_u10avx512f")));
+EXPORT CONST __m512d Sleef_tgammad8_u10(__m512d) __attribute__((alias("Sleef_tgammad8_u10avx512f"))) ;
+EXPORT CONST VECTOR_CC __m512d _ZGVeN8v_Sleef_tgamma_u10(__m512d) __attribute__((alias("Sleef_tgammad8_u10avx512f")));
+EXPORT CONST __m512d Sleef_erfd8_u10(__m512d) __attribute__((alias("Sleef_erfd8_u10avx512f"))) ;
+EXPORT CONST VECTOR_CC __m512d _ZGVeN8v_Sleef_erf_u10(__m512d) __attribute__((alias("Sleef_erfd8_u10avx512f")));
+EXPORT CONST __m512d Sleef_erfcd8_u15(__m512d) __attribute__((alias("Sleef_erfcd8_u15avx512f"))) ;
+EXPORT CONST VECTOR_CC __m512d _ZGVeN8v_Sleef_erfc_u15(__m512d) __attribute__((alias("Sleef_erfcd8_u15avx512f")));
+EXPORT CONST __m512d Sleef_sigmoidd8_u10(__m512d) __attribute__((alias("Sleef_sigmoidd8_u10avx512f"))) ;
+EXPORT CONST VECTOR_CC __m512d _ZGVeN8v_Sleef_sigmoid_u10(__m512d) __attribute__((alias("Sleef_sigmoidd8_u10avx512f")));
+EXPORT CONST __m512d Sleef_sigmoidd8_u35(__m512d) __attribute__((alias("Sleef_sigmoidd8_u35avx512f"))) ;
+EXPORT CONST VECTOR_CC __m512d _ZGVeN8v_Sleef_sigmoid_u35(__m512d) __attribute__((alias("Sleef_sigmoidd8_u35avx512f")));
+EXPORT CONST __m512d Sleef_softplusd8_u10(__m512d) __attribute__((alias("Sleef_softplusd8_u10avx512f"))) ;
+EXPORT CONST VECTOR_CC __m512d _ZGVeN8v_Sleef_softplus_u10(__m512d) __attribute__((alias("Sleef_softplusd8_u10avx512f")));
+EXPORT CONST __m512d Sleef_softplusd8_u35(__m512d) __attribute__((alias("Sleef_softplusd8_u35avx512f"))) ;
+EXPORT CONST VECTOR_CC __m512d _ZGVeN8v_Sleef_softplus_u35(__m512d) __attribute__((alias("Sleef_softplusd8_u35avx512f")));
+EXPORT CONST __m512d Sleef_silud8_u10(__m512d) __attribute__((alias("Sleef_silud8_u10avx512f"))) ;
+EXPORT CONST VECTOR_CC __m512d _ZGVeN8v_Sleef_silu_u10(__m512d) __attribute__((alias("Sleef_silud8_u10avx512f")));
+EXPORT CONST __m512d Sleef_silud8_u35(__m512d) __attribute__((alias("Sleef_silud8_u35avx512f"))) ;
+EXPORT CONST VECTOR_CC __m512d _ZGVeN8v_Sleef_silu_u35(__m512d) __attribute__((alias("Sleef_silud8_u35avx512f")));
+EXPORT CONST __m512d Sleef_gelutanhd8_u10(__m512d) __attribute__((alias("Sleef_gelutanhd8_u10avx512f"))) ;
+EXPORT CONST VECTOR_CC __m512d _ZGVeN8v_Sleef_gelutanh_u10(__m512d) __attribute__((alias("Sleef_gelutanhd8_u10avx512f")));
+EXPORT CONST __m512d Sleef_gelutanhd8_u35(__m512d) __attribute__((alias("Sleef_gelutanhd8_u35avx512f"))) ;
+EXPORT CONST VECTOR_CC __m512d _ZGVeN8v_Sleef_gelutanh_u35(__m512d) __attribute__((alias("Sleef_gelutanhd8_u35avx512f")));
+EXPORT CONST __m512d Sleef_gelud8_u15(__m512d) __attribute__((alias("Sleef_gelud8_u15avx512f"))) ;
+EXPORT CONST VECTOR_CC __m512d _ZGVeN8v_Sleef_gelu_u15(__m512d) __attribute__((alias("Sleef_gelud8_u15avx512f")));
+EXPORT CONST int Sleef_getIntd8(int) __attribute__((alias("Sleef_getIntd8_avx512f"))) ;
+EXPORT CONST VECTOR_CC int _ZGVeN8_Sleef_getInt(int) __attribute__((alias("Sleef_getIntd8_avx512f")));
+EXPORT CONST void * Sleef_getPtrd8(int) __attribute__((alias("Sleef_getPtrd8_avx512f"))) ;
+EXPORT CONST VECTOR_CC void * _ZGVeN8_Sleef_getPtr(int) __attribute__((alias("Sleef_getPtrd8_avx512f")));
+
+#else // #ifdef ENABLE_ALIAS
+EXPORT CONST __m512d  Sleef_sind8_u35(__m512d a0) { return Sleef_sind8_u35avx512f(a0); }
+EXPORT CONST __m512d  Sleef_cosd8_u35(__m512d a0) { return Sleef_cosd8_u35avx512f(a0); }
+EXPORT CONST vdouble2  Sleef_sincosd8_u35(__m512d a0) { return Sleef_sincosd8_u35avx512f(a0); }
+EXPORT CONST __m512d  Sleef_tand8_u35(__m512d a0) { return Sleef_tand8_u35avx512f(a0); }
+EXPORT CONST __m512d  Sleef_asind8_u35(__m512d a0) { return Sleef_asind8_u35avx512f(a0); }
+EXPORT CONST __m512d  Sleef_acosd8_u35(__m512d a0) { return Sleef_acosd8_u35avx512f(a0); }
+EXPORT CONST __m512d  Sleef_atand8_u35(__m512d a0) { return Sleef_atand8_u35avx512f(a0); }
+EXPORT CONST __m512d  Sleef_atan2d8_u35(__m512d a0, __m512d a1) { return Sleef_atan2d8_u35avx512f(a0, a1); }
+EXPORT CONST __m512d  Sleef_logd8_u35(__m512d a0) { return Sleef_logd8_u35avx512f(a0); }
+EXPORT CONST __m512d  Sleef_cbrtd8_u35(__m512d a0) { return Sleef_cbrtd8_u35avx512f(a0); }
+EXPORT CONST __m512d  Sleef_sind8_u10(__m512d a0) { return Sleef_sind8_u10avx512f(a0); }
+EXPORT CONST __m512d  Sleef_cosd8_u10(__m512d a0) { return Sleef_cosd8_u10avx512f(a0); }
+EXPORT CONST vdouble2  Sleef_sincosd8_u10(__m512d a0) { return Sleef_sincosd8_u10avx512f(a0); }
+EXPORT CONST __m512d  Sleef_tand8_u10(__m512d a0) { return Sleef_tand8_u10avx512f(a0); }
+EXPORT CONST __m512d  Sleef_asind8_u10(__m512d a0) { return Sleef_asind8_u10avx512f(a0); }
+EXPORT CONST __m512d  Sleef_acosd8_u10(__m512d a0) { return Sleef_acosd8_u10avx512f(a0); }
+EXPORT CONST __m512d  Sleef_atand8_u10(__m512d a0) { return Sleef_atand8_u10avx512f(a0); }
+EXPORT CONST __m512d  Sleef_atan2d8_u10(__m512d a0, __m512d a1) { return Sleef_atan2d8_u10avx512f(a0, a1); }
+EXPORT CONST __m512d  Sleef_logd8_u10(__m512d a0) { return Sleef_logd8_u10avx512f(a0); }
+EXPORT CONST __m512d  Sleef_cbrtd8_u10(__m512d a0) { return Sleef_cbrtd8_u10avx512f(a0); }
+EXPORT CONST __m512d  Sleef_expd8_u10(__m512d a0) { return Sleef_expd8_u10avx512f(a0); }
+EXPORT CONST __m512d  Sleef_powd8_u10(__m512d a0, __m512d a1) { return Sleef_powd8_u10avx512f(a0, a1); }
+EXPORT CONST __m512d  Sleef_sinhd8_u10(__m512d a0) { return Sleef_sinhd8_u10avx512f(a0); }
+EXPORT CONST __m512d  Sleef_coshd8_u10(__m512d a0) { return Sleef_coshd8_u10avx512f(a0); }
+EXPORT CONST __m512d  Sleef_tanhd8_u10(__m512d a0) { return Sleef_tanhd8_u10avx512f(a0); }
+EXPORT CONST __m512d  Sleef_sinhd8_u35(__m512d a0) { return Sleef_sinhd8_u35avx512f(a0); }
+EXPORT CONST __m512d  Sleef_coshd8_u35(__m512d a0) { return Sleef_coshd8_u35avx512f(a0); }
+EXPORT CONST __m512d  Sleef_tanhd8_u35(__m512d a0) { return Sleef_tanhd8_u35avx512f(a0); }
+EXPORT CONST __m512d  Sleef_fastexpd8_u3500(__m512d a0) { return Sleef_fastexpd8_u3500avx512f(a0); }
+EXPORT CONST __m512d  Sleef_fastexp2d8_u3500(__m512d a0) { return Sleef_fastexp2d8_u3500avx512f(a0); }
+EXPORT CONST __m512d  Sleef_fastlogd8_u3500(__m512d a0) { return Sleef_fastlogd8_u3500avx512f(a0); }
+EXPORT CONST __m512d  Sleef_fastlog2d8_u3500(__m512d a0) { return Sleef_fastlog2d8_u3500avx512f(a0); }
+EXPORT CONST __m512d  Sleef_fasttanhd8_u3500(__m512d a0) { return Sleef_fasttanhd8_u3500avx512f(a0); }
+EXPORT CONST __m512d  Sleef_fastatan2d8_u3500(__m512d a0, __m512d a1) { return Sleef_fastatan2d8_u3500avx512f(a0, a1); }
+EXPORT CONST __m512d  Sleef_fastrsqrtd8_u3500(__m512d a0) { return Sleef_fastrsqrtd8_u3500avx512f(a0); }
+EXPORT CONST __m512d  Sleef_fastrcpd8_u3500(__m512d a0) { return Sleef_fastrcpd8_u3500avx512f(a0); }
+EXPORT CONST __m512d  Sleef_sinrd8_u35(__m512d a0) { return Sleef_sinrd8_u35avx512f(a0); }
+EXPORT CONST __m512d  Sleef_cosrd8_u35(__m512d a0) { return Sleef_cosrd8_u35avx512f(a0); }
+EXPORT CONST vdouble2  Sleef_sincosrd8_u35(__m512d a0) { return Sleef_sincosrd8_u35avx512f(a0); }
+EXPORT CONST __m512d  Sleef_tanrd8_u35(__m512d a0) { return Sleef_tanrd8_u35avx512f(a0); }
+EXPORT CONST __m512d  Sleef_asinhd8_u10(__m512d a0) { return Sleef_asinhd8_u10avx512f(a0); }
+EXPORT CONST __m512d  Sleef_acoshd8_u10(__m512d a0) { return Sleef_acoshd8_u10avx512f(a0); }
+EXPORT CONST __m512d  Sleef_atanhd8_u10(__m512d a0) { return Sleef_atanhd8_u10avx512f(a0); }
+EXPORT CONST __m512d  Sleef_exp2d8_u10(__m512d a0) { return Sleef_exp2d8_u10avx512f(a0); }
+EXPORT CONST __m512d  Sleef_exp2d8_u35(__m512d a0) { return Sleef_exp2d8_u35avx512f(a0); }
+EXPORT CONST __m512d  Sleef_exp10d8_u10(__m512d a0) { return Sleef_exp10d8_u10avx512f(a0); }
+EXPORT CONST __m512d  Sleef_exp10d8_u35(__m512d a0) { return Sleef_exp10d8_u35avx512f(a0); }
+EXPORT CONST __m512d  Sleef_expm1d8_u10(__m512d a0) { return Sleef_expm1d8_u10avx512f(a0); }
+EXPORT CONST __m512d  Sleef_log10d8_u10(__m512d a0) { return Sleef_log10d8_u10avx512f(a0); }
+EXPORT CONST __m512d  Sleef_log2d8_u10(__m512d a0) { return Sleef_log2d8_u10avx512f(a0); }
+EXPORT CONST __m512d  Sleef_log2d8_u35(__m512d a0) { return Sleef_log2d8_u35avx512f(a0); }
+EXPORT CONST __m512d  Sleef_log1pd8_u10(__m512d a0) { return Sleef_log1pd8_u10avx512f(a0); }
+EXPORT CONST vdouble2  Sleef_sincospid8_u05(__m512d a0) { return Sleef_sincospid8_u05avx512f(a0); }
+EXPORT CONST vdouble2  Sleef_sincospid8_u35(__m512d a0) { return Sleef_sincospid8_u35avx512f(a0); }
+EXPORT CONST __m512d  Sleef_sinpid8_u05(__m512d a0) { return Sleef_sinpid8_u05avx512f(a0); }
+EXPORT CONST __m512d  Sleef_cospid8_u05(__m512d a0) { return Sleef_cospid8_u05avx512f(a0); }
+EXPORT CONST __m512d  Sleef_ldexpd8(__m512d a0, __m256i a1) { return Sleef_ldexpd8_avx512f(a0, a1); }
+EXPORT CONST __m256i  Sleef_ilogbd8(__m512d a0) { return Sleef_ilogbd8_avx512f(a0); }
+EXPORT CONST __m512d  Sleef_fmad8(__m512d a0, __m512d a1, __m512d a2) { return Sleef_fmad8_avx512f(a0, a1, a2); }
+EXPORT CONST __m512d  Sleef_sqrtd8(__m512d a0) { return Sleef_sqrtd8_avx512f(a0); }
+EXPORT CONST __m512d  Sleef_sqrtd8_u05(__m512d a0) { return Sleef_sqrtd8_u05avx512f(a0); }
+EXPORT CONST __m512d  Sleef_sqrtd8_u35(__m512d a0) { return Sleef_sqrtd8_u35avx512f(a0); }
+EXPORT CONST __m512d  Sleef_hypotd8_u05(__m512d a0, __m512d a1) { return Sleef_hypotd8_u05avx512f(a0, a1); }
+EXPORT CONST __m512d  Sleef_hypotd8_u35(__m512d a0, __m512d a1) { return Sleef_hypotd8_u35avx512f(a0, a1); }
+EXPORT CONST __m512d  Sleef_fabsd8(__m512d a0) { return Sleef_fabsd8_avx512f(a0); }
+EXPORT CONST __m512d  Sleef_copysignd8(__m512d a0, __m512d a1) { return Sleef_copysignd8_avx512f(a0, a1); }
+EXPORT CONST __m512d  Sleef_fmaxd8(__m512d a0, __m512d a1) { return Sleef_fmaxd8_avx512f(a0, a1); }
+EXPORT CONST __m512d  Sleef_fmind8(__m512d a0, __m512d a1) { return Sleef_fmind8_avx512f(a0, a1); }
+EXPORT CONST __m512d  Sleef_fdimd8(__m512d a0, __m512d a1) { return Sleef_fdimd8_avx512f(a0, a1); }
+EXPORT CONST __m512d  Sleef_truncd8(__m512d a0) { return Sleef_truncd8_avx512f(a0); }
+EXPORT CONST __m512d  Sleef_floord8(__m512d a0) { return Sleef_floord8_avx512f(a0); }
+EXPORT CONST __m512d  Sleef_ceild8(__m512d a0) { return Sleef_ceild8_avx512f(a0); }
+EXPORT CONST __m512d  Sleef_roundd8(__m512d a0) { return Sleef_roundd8_avx512f(a0); }
+EXPORT CONST __m512d  Sleef_rintd8(__m512d a0) { return Sleef_rintd8_avx512f(a0); }
+EXPORT CONST __m512d  Sleef_nextafterd8(__m512d a0, __m512d a1) { return Sleef_nextafterd8_avx512f(a0, a1); }
+EXPORT CONST __m512d  Sleef_frfrexpd8(__m512d a0) { return Sleef_frfrexpd8_avx512f(a0); }
+EXPORT CONST __m256i  Sleef_expfrexpd8(__m512d a0) { return Sleef_expfrexpd8_avx512f(a0); }
+EXPORT CONST __m512d  Sleef_fmodd8(__m512d a0, __m512d a1) { return Sleef_fmodd8_avx512f(a0, a1); }
+EXPORT CONST __m512d  Sleef_remainderd8(__m512d a0, __m512d a1) { return Sleef_remainderd8_avx512f(a0, a1); }
+EXPORT CONST vdouble2  Sleef_modfd8(__m512d a0) { return Sleef_modfd8_avx512f(a0); }
+EXPORT CONST __m512d  Sleef_lgammad8_u10(__m512d a0) { return Sleef_lgammad8_u10avx512f(a0); }
+EXPORT CONST __m512d  Sleef_tgammad8_u10(__m512d a0) { return Sleef_tgammad8_u10avx512f(a0); }
+EXPORT CONST __m512d  Sleef_erfd8_u10(__m512d a0) { return Sleef_erfd8_u10avx512f(a0); }
+EXPORT CONST __m512d  Sleef_erfcd8_u15(__m512d a0) { return Sleef_erfcd8_u15avx512f(a0); }
+EXPORT CONST __m512d  Sleef_sigmoidd8_u10(__m512d a0) { return Sleef_sigmoidd8_u10avx512f(a0); }
+EXPORT CONST __m512d  Sleef_sigmoidd8_u35(__m512d a0) { return Sleef_sigmoidd8_u35avx512f(a0); }
+EXPORT CONST __m512d  Sleef_softplusd8_u10(__m512d a0) { return Sleef_softplusd8_u10avx512f(a0); }
+EXPORT CONST __m512d  Sleef_softplusd8_u35(__m512d a0) { return Sleef_softplusd8_u35avx512f(a0); }
+EXPORT CONST __m512d  Sleef_silud8_u10(__m512d a0) { return Sleef_silud8_u10avx512f(a0); }
+EXPORT CONST __m512d  Sleef_silud8_u35(__m512d a0) { return Sleef_silud8_u35avx512f(a0); }
+EXPORT CONST __m512d  Sleef_gelutanhd8_u10(__m512d a0) { return Sleef_gelutanhd8_u10avx512f(a0); }
+EXPORT CONST __m512d  Sleef_gelutanhd8_u35(__m512d a0) { return Sleef_gelutanhd8_u35avx512f(a0); }
+EXPORT CONST __m512d  Sleef_gelud8_u15(__m512d a0) { return Sleef_gelud8_u15avx512f(a0); }
+EXPORT CONST int  Sleef_getIntd8(int a0) { return Sleef_getIntd8_avx512f(a0); }
+EXPORT CONST void *  Sleef_getPtrd8(int a0) { return Sleef_getPtrd8_avx512f(a0); }
+
+#endif // #ifdef ENABLE_ALIAS
+#endif // #ifdef __SLEEFSIMDDP_C__
@@ -0,0 +1,12 @@
+#define ENABLE_DP
+#define LOG2VECTLENDP 2
+#define VECTLENDP (1 << LOG2VECTLENDP)
+#define ENABLE_FMA_DP
+#define ENABLE_SP
+#define LOG2VECTLENSP (LOG2VECTLENDP+1)
+#define VECTLENSP (1 << LOG2VECTLENSP)
+#define ENABLE_FMA_SP
+#define FULL_FP_ROUNDING
+#define ACCURATE_SQRT
+#define vsll64_vm_vm_i(x, c) _mm256_slli_epi64(x, c)
+#define vsrl64_vm_vm_i(x, c) _mm256_srli_epi64(x, c)
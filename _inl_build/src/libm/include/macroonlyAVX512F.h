@@ -0,0 +1,20 @@
+#define ENABLE_DP
+#define LOG2VECTLENDP 3
+#define VECTLENDP (1 << LOG2VECTLENDP)
+#define ENABLE_SP
+#define LOG2VECTLENSP (LOG2VECTLENDP+1)
+#define VECTLENSP (1 << LOG2VECTLENSP)
+#define ENABLE_FMA_DP
+#define ENABLE_FMA_SP
+#define FULL_FP_ROUNDING
+#define ACCURATE_SQRT
+#define vsll_vi_vi_i(x, c) _mm256_slli_epi32(x, c)
+#define vsrl_vi_vi_i(x, c) _mm256_srli_epi32(x, c)
+#define vsra_vi_vi_i(x, c) _mm256_srai_epi32(x, c)
+#define vfixup_vd_vd_vd_vi2_i(a, b, c, imm) _mm512_fixupimm_pd((a), (b), (c), (imm))
+#define vfixup_vf_vf_vf_vi2_i(a, b, c, imm) _mm512_fixupimm_ps((a), (b), (c), (imm))
+#define vsll_vi2_vi2_i(x, c) _mm512_slli_epi32(x, c)
+#define vsrl_vi2_vi2_i(x, c) _mm512_srli_epi32(x, c)
+#define vsra_vi2_vi2_i(x, c) _mm512_srai_epi32(x, c)
+#define vsll64_vm_vm_i(x, c) _mm512_slli_epi64(x, c)
+#define vsrl64_vm_vm_i(x, c) _mm512_srli_epi64(x, c)
@@ -0,0 +1,18 @@
+#define ENABLE_DP
+#define ENABLE_SP
+#define ENABLE_FMA_DP
+#define ENABLE_FMA_SP
+#ifndef FP_FAST_FMA
+#define FP_FAST_FMA
+#endif
+#ifndef FP_FAST_FMAF
+#define FP_FAST_FMAF
+#endif
+#define LOG2VECTLENDP 0
+#define VECTLENDP (1 << LOG2VECTLENDP)
+#define LOG2VECTLENSP 0
+#define VECTLENSP (1 << LOG2VECTLENSP)
+#define ACCURATE_SQRT
+#define FULL_FP_ROUNDING
+#define vsll64_vm_vm_i(x, c) ((uint64_t)(x) << (c))
+#define vsrl64_vm_vm_i(x, c) ((uint64_t)(x) >> (c))
@@ -0,0 +1,9 @@
+#define ENABLE_DP
+#define ENABLE_SP
+#define LOG2VECTLENDP 0
+#define VECTLENDP (1 << LOG2VECTLENDP)
+#define LOG2VECTLENSP 0
+#define VECTLENSP (1 << LOG2VECTLENSP)
+#define ACCURATE_SQRT
+#define vsll64_vm_vm_i(x, c) ((uint64_t)(x) << (c))
+#define vsrl64_vm_vm_i(x, c) ((uint64_t)(x) >> (c))
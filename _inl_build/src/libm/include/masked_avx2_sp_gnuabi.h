@@ -0,0 +1,437 @@
+static INLINE CONST VECTOR_CC vopmask vinactive_vo_vo(vopmask m) {
+  return veq_vo_vi2_vi2(vcast_vi2_vm(vand_vm_vo32_vm(m, vcast_vm_i_i(-1, -1))), vcast_vi2_i(0));
+}
+
+EXPORT CONST VECTOR_CC vfloat _ZGVdM8v_sinf_u35(vfloat a0, vopmask m) {
+  vopmask o = vinactive_vo_vo(m);
+  return _ZGVdN8v_sinf_u35(vsel_vf_vo_vf_vf(o, vcast_vf_f(1), a0));
+}
+EXPORT CONST VECTOR_CC vfloat _ZGVdM8v___sinf_finite_u35(vfloat, vopmask) __attribute__((weak, alias("_ZGVdM8v_sinf_u35")));
+EXPORT CONST VECTOR_CC vfloat _ZGVdM8v_cosf_u35(vfloat a0, vopmask m) {
+  vopmask o = vinactive_vo_vo(m);
+  return _ZGVdN8v_cosf_u35(vsel_vf_vo_vf_vf(o, vcast_vf_f(1), a0));
+}
+EXPORT CONST VECTOR_CC vfloat _ZGVdM8v___cosf_finite_u35(vfloat, vopmask) __attribute__((weak, alias("_ZGVdM8v_cosf_u35")));
+EXPORT VECTOR_CC void _ZGVdM8vl4l4_sincosf_u35(vfloat a0, float *a1, float *a2, vopmask m) {
+  vopmask o = vinactive_vo_vo(m);
+  float s[VECTLENSP], c[VECTLENSP];
+  int32_t mbuf[VECTLENSP];
+  _ZGVdN8vl4l4_sincosf_u35(vsel_vf_vo_vf_vf(o, vcast_vf_f(1), a0), s, c);
+  vstoreu_v_p_vi2(mbuf, vcast_vi2_vm(vand_vm_vo32_vm(o, vcast_vm_i_i(-1, -1))));
+  for(int i=0;i<VECTLENSP;i++) {
+    if (!mbuf[i*1]) { a1[i] = s[i]; a2[i] = c[i]; }
+  }
+}
+EXPORT CONST VECTOR_CC vfloat _ZGVdM8v_tanf_u35(vfloat a0, vopmask m) {
+  vopmask o = vinactive_vo_vo(m);
+  return _ZGVdN8v_tanf_u35(vsel_vf_vo_vf_vf(o, vcast_vf_f(1), a0));
+}
+EXPORT CONST VECTOR_CC vfloat _ZGVdM8v___tanf_finite_u35(vfloat, vopmask) __attribute__((weak, alias("_ZGVdM8v_tanf_u35")));
+EXPORT CONST VECTOR_CC vfloat _ZGVdM8v_asinf_u35(vfloat a0, vopmask m) {
+  vopmask o = vinactive_vo_vo(m);
+  return _ZGVdN8v_asinf_u35(vsel_vf_vo_vf_vf(o, vcast_vf_f(1), a0));
+}
+EXPORT CONST VECTOR_CC vfloat _ZGVdM8v___asinf_finite_u35(vfloat, vopmask) __attribute__((weak, alias("_ZGVdM8v_asinf_u35")));
+EXPORT CONST VECTOR_CC vfloat _ZGVdM8v_acosf_u35(vfloat a0, vopmask m) {
+  vopmask o = vinactive_vo_vo(m);
+  return _ZGVdN8v_acosf_u35(vsel_vf_vo_vf_vf(o, vcast_vf_f(1), a0));
+}
+EXPORT CONST VECTOR_CC vfloat _ZGVdM8v___acosf_finite_u35(vfloat, vopmask) __attribute__((weak, alias("_ZGVdM8v_acosf_u35")));
+EXPORT CONST VECTOR_CC vfloat _ZGVdM8v_atanf_u35(vfloat a0, vopmask m) {
+  vopmask o = vinactive_vo_vo(m);
+  return _ZGVdN8v_atanf_u35(vsel_vf_vo_vf_vf(o, vcast_vf_f(1), a0));
+}
+EXPORT CONST VECTOR_CC vfloat _ZGVdM8v___atanf_finite_u35(vfloat, vopmask) __attribute__((weak, alias("_ZGVdM8v_atanf_u35")));
+EXPORT CONST VECTOR_CC vfloat _ZGVdM8vv_atan2f_u35(vfloat a0, vfloat a1, vopmask m) {
+  vopmask o = vinactive_vo_vo(m);
+  return _ZGVdN8vv_atan2f_u35(vsel_vf_vo_vf_vf(o, vcast_vf_f(1), a0), vsel_vf_vo_vf_vf(o, vcast_vf_f(1), a1));
+}
+EXPORT CONST VECTOR_CC vfloat _ZGVdM8vv___atan2f_finite_u35(vfloat, vfloat, vopmask) __attribute__((weak, alias("_ZGVdM8vv_atan2f_u35")));
+EXPORT CONST VECTOR_CC vfloat _ZGVdM8v_logf_u35(vfloat a0, vopmask m) {
+  vopmask o = vinactive_vo_vo(m);
+  return _ZGVdN8v_logf_u35(vsel_vf_vo_vf_vf(o, vcast_vf_f(1), a0));
+}
+EXPORT CONST VECTOR_CC vfloat _ZGVdM8v___logf_finite_u35(vfloat, vopmask) __attribute__((weak, alias("_ZGVdM8v_logf_u35")));
+EXPORT CONST VECTOR_CC vfloat _ZGVdM8v_cbrtf_u35(vfloat a0, vopmask m) {
+  vopmask o = vinactive_vo_vo(m);
+  return _ZGVdN8v_cbrtf_u35(vsel_vf_vo_vf_vf(o, vcast_vf_f(1), a0));
+}
+EXPORT CONST VECTOR_CC vfloat _ZGVdM8v___cbrtf_finite_u35(vfloat, vopmask) __attribute__((weak, alias("_ZGVdM8v_cbrtf_u35")));
+EXPORT CONST VECTOR_CC vfloat _ZGVdM8v_sinf(vfloat a0, vopmask m) {
+  vopmask o = vinactive_vo_vo(m);
+  return _ZGVdN8v_sinf(vsel_vf_vo_vf_vf(o, vcast_vf_f(1), a0));
+}
+EXPORT CONST VECTOR_CC vfloat _ZGVdM8v___sinf_finite(vfloat, vopmask) __attribute__((weak, alias("_ZGVdM8v_sinf")));
+EXPORT CONST VECTOR_CC vfloat _ZGVdM8v_cosf(vfloat a0, vopmask m) {
+  vopmask o = vinactive_vo_vo(m);
+  return _ZGVdN8v_cosf(vsel_vf_vo_vf_vf(o, vcast_vf_f(1), a0));
+}
+EXPORT CONST VECTOR_CC vfloat _ZGVdM8v___cosf_finite(vfloat, vopmask) __attribute__((weak, alias("_ZGVdM8v_cosf")));
+EXPORT VECTOR_CC void _ZGVdM8vl4l4_sincosf(vfloat a0, float *a1, float *a2, vopmask m) {
+  vopmask o = vinactive_vo_vo(m);
+  float s[VECTLENSP], c[VECTLENSP];
+  int32_t mbuf[VECTLENSP];
+  _ZGVdN8vl4l4_sincosf(vsel_vf_vo_vf_vf(o, vcast_vf_f(1), a0), s, c);
+  vstoreu_v_p_vi2(mbuf, vcast_vi2_vm(vand_vm_vo32_vm(o, vcast_vm_i_i(-1, -1))));
+  for(int i=0;i<VECTLENSP;i++) {
+    if (!mbuf[i*1]) { a1[i] = s[i]; a2[i] = c[i]; }
+  }
+}
+EXPORT CONST VECTOR_CC vfloat _ZGVdM8v_tanf(vfloat a0, vopmask m) {
+  vopmask o = vinactive_vo_vo(m);
+  return _ZGVdN8v_tanf(vsel_vf_vo_vf_vf(o, vcast_vf_f(1), a0));
+}
+EXPORT CONST VECTOR_CC vfloat _ZGVdM8v___tanf_finite(vfloat, vopmask) __attribute__((weak, alias("_ZGVdM8v_tanf")));
+EXPORT CONST VECTOR_CC vfloat _ZGVdM8v_asinf(vfloat a0, vopmask m) {
+  vopmask o = vinactive_vo_vo(m);
+  return _ZGVdN8v_asinf(vsel_vf_vo_vf_vf(o, vcast_vf_f(1), a0));
+}
+EXPORT CONST VECTOR_CC vfloat _ZGVdM8v___asinf_finite(vfloat, vopmask) __attribute__((weak, alias("_ZGVdM8v_asinf")));
+EXPORT CONST VECTOR_CC vfloat _ZGVdM8v_acosf(vfloat a0, vopmask m) {
+  vopmask o = vinactive_vo_vo(m);
+  return _ZGVdN8v_acosf(vsel_vf_vo_vf_vf(o, vcast_vf_f(1), a0));
+}
+EXPORT CONST VECTOR_CC vfloat _ZGVdM8v___acosf_finite(vfloat, vopmask) __attribute__((weak, alias("_ZGVdM8v_acosf")));
+EXPORT CONST VECTOR_CC vfloat _ZGVdM8v_atanf(vfloat a0, vopmask m) {
+  vopmask o = vinactive_vo_vo(m);
+  return _ZGVdN8v_atanf(vsel_vf_vo_vf_vf(o, vcast_vf_f(1), a0));
+}
+EXPORT CONST VECTOR_CC vfloat _ZGVdM8v___atanf_finite(vfloat, vopmask) __attribute__((weak, alias("_ZGVdM8v_atanf")));
+EXPORT CONST VECTOR_CC vfloat _ZGVdM8vv_atan2f(vfloat a0, vfloat a1, vopmask m) {
+  vopmask o = vinactive_vo_vo(m);
+  return _ZGVdN8vv_atan2f(vsel_vf_vo_vf_vf(o, vcast_vf_f(1), a0), vsel_vf_vo_vf_vf(o, vcast_vf_f(1), a1));
+}
+EXPORT CONST VECTOR_CC vfloat _ZGVdM8vv___atan2f_finite(vfloat, vfloat, vopmask) __attribute__((weak, alias("_ZGVdM8vv_atan2f")));
+EXPORT CONST VECTOR_CC vfloat _ZGVdM8v_logf(vfloat a0, vopmask m) {
+  vopmask o = vinactive_vo_vo(m);
+  return _ZGVdN8v_logf(vsel_vf_vo_vf_vf(o, vcast_vf_f(1), a0));
+}
+EXPORT CONST VECTOR_CC vfloat _ZGVdM8v___logf_finite(vfloat, vopmask) __attribute__((weak, alias("_ZGVdM8v_logf")));
+EXPORT CONST VECTOR_CC vfloat _ZGVdM8v_cbrtf(vfloat a0, vopmask m) {
+  vopmask o = vinactive_vo_vo(m);
+  return _ZGVdN8v_cbrtf(vsel_vf_vo_vf_vf(o, vcast_vf_f(1), a0));
+}
+EXPORT CONST VECTOR_CC vfloat _ZGVdM8v___cbrtf_finite(vfloat, vopmask) __attribute__((weak, alias("_ZGVdM8v_cbrtf")));
+EXPORT CONST VECTOR_CC vfloat _ZGVdM8v_expf(vfloat a0, vopmask m) {
+  vopmask o = vinactive_vo_vo(m);
+  return _ZGVdN8v_expf(vsel_vf_vo_vf_vf(o, vcast_vf_f(1), a0));
+}
+EXPORT CONST VECTOR_CC vfloat _ZGVdM8v___expf_finite(vfloat, vopmask) __attribute__((weak, alias("_ZGVdM8v_expf")));
+EXPORT CONST VECTOR_CC vfloat _ZGVdM8vv_powf(vfloat a0, vfloat a1, vopmask m) {
+  vopmask o = vinactive_vo_vo(m);
+  return _ZGVdN8vv_powf(vsel_vf_vo_vf_vf(o, vcast_vf_f(1), a0), vsel_vf_vo_vf_vf(o, vcast_vf_f(1), a1));
+}
+EXPORT CONST VECTOR_CC vfloat _ZGVdM8vv___powf_finite(vfloat, vfloat, vopmask) __attribute__((weak, alias("_ZGVdM8vv_powf")));
+EXPORT CONST VECTOR_CC vfloat _ZGVdM8v_sinhf(vfloat a0, vopmask m) {
+  vopmask o = vinactive_vo_vo(m);
+  return _ZGVdN8v_sinhf(vsel_vf_vo_vf_vf(o, vcast_vf_f(1), a0));
+}
+EXPORT CONST VECTOR_CC vfloat _ZGVdM8v___sinhf_finite(vfloat, vopmask) __attribute__((weak, alias("_ZGVdM8v_sinhf")));
+EXPORT CONST VECTOR_CC vfloat _ZGVdM8v_coshf(vfloat a0, vopmask m) {
+  vopmask o = vinactive_vo_vo(m);
+  return _ZGVdN8v_coshf(vsel_vf_vo_vf_vf(o, vcast_vf_f(1), a0));
+}
+EXPORT CONST VECTOR_CC vfloat _ZGVdM8v___coshf_finite(vfloat, vopmask) __attribute__((weak, alias("_ZGVdM8v_coshf")));
+EXPORT CONST VECTOR_CC vfloat _ZGVdM8v_tanhf(vfloat a0, vopmask m) {
+  vopmask o = vinactive_vo_vo(m);
+  return _ZGVdN8v_tanhf(vsel_vf_vo_vf_vf(o, vcast_vf_f(1), a0));
+}
+EXPORT CONST VECTOR_CC vfloat _ZGVdM8v___tanhf_finite(vfloat, vopmask) __attribute__((weak, alias("_ZGVdM8v_tanhf")));
+EXPORT CONST VECTOR_CC vfloat _ZGVdM8v_sinhf_u35(vfloat a0, vopmask m) {
+  vopmask o = vinactive_vo_vo(m);
+  return _ZGVdN8v_sinhf_u35(vsel_vf_vo_vf_vf(o, vcast_vf_f(1), a0));
+}
+EXPORT CONST VECTOR_CC vfloat _ZGVdM8v___sinhf_finite_u35(vfloat, vopmask) __attribute__((weak, alias("_ZGVdM8v_sinhf_u35")));
+EXPORT CONST VECTOR_CC vfloat _ZGVdM8v_coshf_u35(vfloat a0, vopmask m) {
+  vopmask o = vinactive_vo_vo(m);
+  return _ZGVdN8v_coshf_u35(vsel_vf_vo_vf_vf(o, vcast_vf_f(1), a0));
+}
+EXPORT CONST VECTOR_CC vfloat _ZGVdM8v___coshf_finite_u35(vfloat, vopmask) __attribute__((weak, alias("_ZGVdM8v_coshf_u35")));
+EXPORT CONST VECTOR_CC vfloat _ZGVdM8v_tanhf_u35(vfloat a0, vopmask m) {
+  vopmask o = vinactive_vo_vo(m);
+  return _ZGVdN8v_tanhf_u35(vsel_vf_vo_vf_vf(o, vcast_vf_f(1), a0));
+}
+EXPORT CONST VECTOR_CC vfloat _ZGVdM8v___tanhf_finite_u35(vfloat, vopmask) __attribute__((weak, alias("_ZGVdM8v_tanhf_u35")));
+EXPORT CONST VECTOR_CC vfloat _ZGVdM8v_fastsinf_u3500(vfloat a0, vopmask m) {
+  vopmask o = vinactive_vo_vo(m);
+  return _ZGVdN8v_fastsinf_u3500(vsel_vf_vo_vf_vf(o, vcast_vf_f(1), a0));
+}
+EXPORT CONST VECTOR_CC vfloat _ZGVdM8v___fastsinf_finite_u3500(vfloat, vopmask) __attribute__((weak, alias("_ZGVdM8v_fastsinf_u3500")));
+EXPORT CONST VECTOR_CC vfloat _ZGVdM8v_fastcosf_u3500(vfloat a0, vopmask m) {
+  vopmask o = vinactive_vo_vo(m);
+  return _ZGVdN8v_fastcosf_u3500(vsel_vf_vo_vf_vf(o, vcast_vf_f(1), a0));
+}
+EXPORT CONST VECTOR_CC vfloat _ZGVdM8v___fastcosf_finite_u3500(vfloat, vopmask) __attribute__((weak, alias("_ZGVdM8v_fastcosf_u3500")));
+EXPORT CONST VECTOR_CC vfloat _ZGVdM8vv_fastpowf_u3500(vfloat a0, vfloat a1, vopmask m) {
+  vopmask o = vinactive_vo_vo(m);
+  return _ZGVdN8vv_fastpowf_u3500(vsel_vf_vo_vf_vf(o, vcast_vf_f(1), a0), vsel_vf_vo_vf_vf(o, vcast_vf_f(1), a1));
+}
+EXPORT CONST VECTOR_CC vfloat _ZGVdM8vv___fastpowf_finite_u3500(vfloat, vfloat, vopmask) __attribute__((weak, alias("_ZGVdM8vv_fastpowf_u3500")));
+EXPORT CONST VECTOR_CC vfloat _ZGVdM8v_fastexpf_u3500(vfloat a0, vopmask m) {
+  vopmask o = vinactive_vo_vo(m);
+  return _ZGVdN8v_fastexpf_u3500(vsel_vf_vo_vf_vf(o, vcast_vf_f(1), a0));
+}
+EXPORT CONST VECTOR_CC vfloat _ZGVdM8v___fastexpf_finite_u3500(vfloat, vopmask) __attribute__((weak, alias("_ZGVdM8v_fastexpf_u3500")));
+EXPORT CONST VECTOR_CC vfloat _ZGVdM8v_fastexp2f_u3500(vfloat a0, vopmask m) {
+  vopmask o = vinactive_vo_vo(m);
+  return _ZGVdN8v_fastexp2f_u3500(vsel_vf_vo_vf_vf(o, vcast_vf_f(1), a0));
+}
+EXPORT CONST VECTOR_CC vfloat _ZGVdM8v___fastexp2f_finite_u3500(vfloat, vopmask) __attribute__((weak, alias("_ZGVdM8v_fastexp2f_u3500")));
+EXPORT CONST VECTOR_CC vfloat _ZGVdM8v_fastlogf_u3500(vfloat a0, vopmask m) {
+  vopmask o = vinactive_vo_vo(m);
+  return _ZGVdN8v_fastlogf_u3500(vsel_vf_vo_vf_vf(o, vcast_vf_f(1), a0));
+}
+EXPORT CONST VECTOR_CC vfloat _ZGVdM8v___fastlogf_finite_u3500(vfloat, vopmask) __attribute__((weak, alias("_ZGVdM8v_fastlogf_u3500")));
+EXPORT CONST VECTOR_CC vfloat _ZGVdM8v_fastlog2f_u3500(vfloat a0, vopmask m) {
+  vopmask o = vinactive_vo_vo(m);
+  return _ZGVdN8v_fastlog2f_u3500(vsel_vf_vo_vf_vf(o, vcast_vf_f(1), a0));
+}
+EXPORT CONST VECTOR_CC vfloat _ZGVdM8v___fastlog2f_finite_u3500(vfloat, vopmask) __attribute__((weak, alias("_ZGVdM8v_fastlog2f_u3500")));
+EXPORT CONST VECTOR_CC vfloat _ZGVdM8v_fasttanhf_u3500(vfloat a0, vopmask m) {
+  vopmask o = vinactive_vo_vo(m);
+  return _ZGVdN8v_fasttanhf_u3500(vsel_vf_vo_vf_vf(o, vcast_vf_f(1), a0));
+}
+EXPORT CONST VECTOR_CC vfloat _ZGVdM8v___fasttanhf_finite_u3500(vfloat, vopmask) __attribute__((weak, alias("_ZGVdM8v_fasttanhf_u3500")));
+EXPORT CONST VECTOR_CC vfloat _ZGVdM8vv_fastatan2f_u3500(vfloat a0, vfloat a1, vopmask m) {
+  vopmask o = vinactive_vo_vo(m);
+  return _ZGVdN8vv_fastatan2f_u3500(vsel_vf_vo_vf_vf(o, vcast_vf_f(1), a0), vsel_vf_vo_vf_vf(o, vcast_vf_f(1), a1));
+}
+EXPORT CONST VECTOR_CC vfloat _ZGVdM8vv___fastatan2f_finite_u3500(vfloat, vfloat, vopmask) __attribute__((weak, alias("_ZGVdM8vv_fastatan2f_u3500")));
+EXPORT CONST VECTOR_CC vfloat _ZGVdM8v_fastrsqrtf_u3500(vfloat a0, vopmask m) {
+  vopmask o = vinactive_vo_vo(m);
+  return _ZGVdN8v_fastrsqrtf_u3500(vsel_vf_vo_vf_vf(o, vcast_vf_f(1), a0));
+}
+EXPORT CONST VECTOR_CC vfloat _ZGVdM8v___fastrsqrtf_finite_u3500(vfloat, vopmask) __attribute__((weak, alias("_ZGVdM8v_fastrsqrtf_u3500")));
+EXPORT CONST VECTOR_CC vfloat _ZGVdM8v_fastrcpf_u3500(vfloat a0, vopmask m) {
+  vopmask o = vinactive_vo_vo(m);
+  return _ZGVdN8v_fastrcpf_u3500(vsel_vf_vo_vf_vf(o, vcast_vf_f(1), a0));
+}
+EXPORT CONST VECTOR_CC vfloat _ZGVdM8v___fastrcpf_finite_u3500(vfloat, vopmask) __attribute__((weak, alias("_ZGVdM8v_fastrcpf_u3500")));
+EXPORT CONST VECTOR_CC vfloat _ZGVdM8v_asinhf(vfloat a0, vopmask m) {
+  vopmask o = vinactive_vo_vo(m);
+  return _ZGVdN8v_asinhf(vsel_vf_vo_vf_vf(o, vcast_vf_f(1), a0));
+}
+EXPORT CONST VECTOR_CC vfloat _ZGVdM8v___asinhf_finite(vfloat, vopmask) __attribute__((weak, alias("_ZGVdM8v_asinhf")));
+EXPORT CONST VECTOR_CC vfloat _ZGVdM8v_acoshf(vfloat a0, vopmask m) {
+  vopmask o = vinactive_vo_vo(m);
+  return _ZGVdN8v_acoshf(vsel_vf_vo_vf_vf(o, vcast_vf_f(1), a0));
+}
+EXPORT CONST VECTOR_CC vfloat _ZGVdM8v___acoshf_finite(vfloat, vopmask) __attribute__((weak, alias("_ZGVdM8v_acoshf")));
+EXPORT CONST VECTOR_CC vfloat _ZGVdM8v_atanhf(vfloat a0, vopmask m) {
+  vopmask o = vinactive_vo_vo(m);
+  return _ZGVdN8v_atanhf(vsel_vf_vo_vf_vf(o, vcast_vf_f(1), a0));
+}
+EXPORT CONST VECTOR_CC vfloat _ZGVdM8v___atanhf_finite(vfloat, vopmask) __attribute__((weak, alias("_ZGVdM8v_atanhf")));
+EXPORT CONST VECTOR_CC vfloat _ZGVdM8v_exp2f(vfloat a0, vopmask m) {
+  vopmask o = vinactive_vo_vo(m);
+  return _ZGVdN8v_exp2f(vsel_vf_vo_vf_vf(o, vcast_vf_f(1), a0));
+}
+EXPORT CONST VECTOR_CC vfloat _ZGVdM8v___exp2f_finite(vfloat, vopmask) __attribute__((weak, alias("_ZGVdM8v_exp2f")));
+EXPORT CONST VECTOR_CC vfloat _ZGVdM8v_exp2f_u35(vfloat a0, vopmask m) {
+  vopmask o = vinactive_vo_vo(m);
+  return _ZGVdN8v_exp2f_u35(vsel_vf_vo_vf_vf(o, vcast_vf_f(1), a0));
+}
+EXPORT CONST VECTOR_CC vfloat _ZGVdM8v___exp2f_finite_u35(vfloat, vopmask) __attribute__((weak, alias("_ZGVdM8v_exp2f_u35")));
+EXPORT CONST VECTOR_CC vfloat _ZGVdM8v_exp10f(vfloat a0, vopmask m) {
+  vopmask o = vinactive_vo_vo(m);
+  return _ZGVdN8v_exp10f(vsel_vf_vo_vf_vf(o, vcast_vf_f(1), a0));
+}
+EXPORT CONST VECTOR_CC vfloat _ZGVdM8v___exp10f_finite(vfloat, vopmask) __attribute__((weak, alias("_ZGVdM8v_exp10f")));
+EXPORT CONST VECTOR_CC vfloat _ZGVdM8v_exp10f_u35(vfloat a0, vopmask m) {
+  vopmask o = vinactive_vo_vo(m);
+  return _ZGVdN8v_exp10f_u35(vsel_vf_vo_vf_vf(o, vcast_vf_f(1), a0));
+}
+EXPORT CONST VECTOR_CC vfloat _ZGVdM8v___exp10f_finite_u35(vfloat, vopmask) __attribute__((weak, alias("_ZGVdM8v_exp10f_u35")));
+EXPORT CONST VECTOR_CC vfloat _ZGVdM8v_expm1f(vfloat a0, vopmask m) {
+  vopmask o = vinactive_vo_vo(m);
+  return _ZGVdN8v_expm1f(vsel_vf_vo_vf_vf(o, vcast_vf_f(1), a0));
+}
+EXPORT CONST VECTOR_CC vfloat _ZGVdM8v___expm1f_finite(vfloat, vopmask) __attribute__((weak, alias("_ZGVdM8v_expm1f")));
+EXPORT CONST VECTOR_CC vfloat _ZGVdM8v_log10f(vfloat a0, vopmask m) {
+  vopmask o = vinactive_vo_vo(m);
+  return _ZGVdN8v_log10f(vsel_vf_vo_vf_vf(o, vcast_vf_f(1), a0));
+}
+EXPORT CONST VECTOR_CC vfloat _ZGVdM8v___log10f_finite(vfloat, vopmask) __attribute__((weak, alias("_ZGVdM8v_log10f")));
+EXPORT CONST VECTOR_CC vfloat _ZGVdM8v_log2f(vfloat a0, vopmask m) {
+  vopmask o = vinactive_vo_vo(m);
+  return _ZGVdN8v_log2f(vsel_vf_vo_vf_vf(o, vcast_vf_f(1), a0));
+}
+EXPORT CONST VECTOR_CC vfloat _ZGVdM8v___log2f_finite(vfloat, vopmask) __attribute__((weak, alias("_ZGVdM8v_log2f")));
+EXPORT CONST VECTOR_CC vfloat _ZGVdM8v_log2f_u35(vfloat a0, vopmask m) {
+  vopmask o = vinactive_vo_vo(m);
+  return _ZGVdN8v_log2f_u35(vsel_vf_vo_vf_vf(o, vcast_vf_f(1), a0));
+}
+EXPORT CONST VECTOR_CC vfloat _ZGVdM8v___log2f_finite_u35(vfloat, vopmask) __attribute__((weak, alias("_ZGVdM8v_log2f_u35")));
+EXPORT CONST VECTOR_CC vfloat _ZGVdM8v_log1pf(vfloat a0, vopmask m) {
+  vopmask o = vinactive_vo_vo(m);
+  return _ZGVdN8v_log1pf(vsel_vf_vo_vf_vf(o, vcast_vf_f(1), a0));
+}
+EXPORT CONST VECTOR_CC vfloat _ZGVdM8v___log1pf_finite(vfloat, vopmask) __attribute__((weak, alias("_ZGVdM8v_log1pf")));
+EXPORT VECTOR_CC void _ZGVdM8vl4l4_sincospif(vfloat a0, float *a1, float *a2, vopmask m) {
+  vopmask o = vinactive_vo_vo(m);
+  float s[VECTLENSP], c[VECTLENSP];
+  int32_t mbuf[VECTLENSP];
+  _ZGVdN8vl4l4_sincospif(vsel_vf_vo_vf_vf(o, vcast_vf_f(1), a0), s, c);
+  vstoreu_v_p_vi2(mbuf, vcast_vi2_vm(vand_vm_vo32_vm(o, vcast_vm_i_i(-1, -1))));
+  for(int i=0;i<VECTLENSP;i++) {
+    if (!mbuf[i*1]) { a1[i] = s[i]; a2[i] = c[i]; }
+  }
+}
+EXPORT VECTOR_CC void _ZGVdM8vl4l4_sincospif_u35(vfloat a0, float *a1, float *a2, vopmask m) {
+  vopmask o = vinactive_vo_vo(m);
+  float s[VECTLENSP], c[VECTLENSP];
+  int32_t mbuf[VECTLENSP];
+  _ZGVdN8vl4l4_sincospif_u35(vsel_vf_vo_vf_vf(o, vcast_vf_f(1), a0), s, c);
+  vstoreu_v_p_vi2(mbuf, vcast_vi2_vm(vand_vm_vo32_vm(o, vcast_vm_i_i(-1, -1))));
+  for(int i=0;i<VECTLENSP;i++) {
+    if (!mbuf[i*1]) { a1[i] = s[i]; a2[i] = c[i]; }
+  }
+}
+EXPORT CONST VECTOR_CC vfloat _ZGVdM8v_sinpif(vfloat a0, vopmask m) {
+  vopmask o = vinactive_vo_vo(m);
+  return _ZGVdN8v_sinpif(vsel_vf_vo_vf_vf(o, vcast_vf_f(1), a0));
+}
+EXPORT CONST VECTOR_CC vfloat _ZGVdM8v___sinpif_finite(vfloat, vopmask) __attribute__((weak, alias("_ZGVdM8v_sinpif")));
+EXPORT CONST VECTOR_CC vfloat _ZGVdM8v_cospif(vfloat a0, vopmask m) {
+  vopmask o = vinactive_vo_vo(m);
+  return _ZGVdN8v_cospif(vsel_vf_vo_vf_vf(o, vcast_vf_f(1), a0));
+}
+EXPORT CONST VECTOR_CC vfloat _ZGVdM8v___cospif_finite(vfloat, vopmask) __attribute__((weak, alias("_ZGVdM8v_cospif")));
+EXPORT CONST VECTOR_CC vfloat _ZGVdM8vv_ldexpf(vfloat a0, vint2 a1, vopmask m) {
+  vopmask o = vinactive_vo_vo(m);
+  return _ZGVdN8vv_ldexpf(vsel_vf_vo_vf_vf(o, vcast_vf_f(1), a0), a1);
+}
+EXPORT CONST VECTOR_CC vint2 _ZGVdM8v_ilogbf(vfloat a0, vopmask m) {
+  vopmask o = vinactive_vo_vo(m);
+  return _ZGVdN8v_ilogbf(vsel_vf_vo_vf_vf(o, vcast_vf_f(1), a0));
+}
+EXPORT CONST VECTOR_CC vfloat _ZGVdM8vvv_fmaf(vfloat a0, vfloat a1, vfloat a2, vopmask m) {
+  vopmask o = vinactive_vo_vo(m);
+  return _ZGVdN8vvv_fmaf(vsel_vf_vo_vf_vf(o, vcast_vf_f(1), a0), vsel_vf_vo_vf_vf(o, vcast_vf_f(1), a1), vsel_vf_vo_vf_vf(o, vcast_vf_f(1), a2));
+}
+EXPORT CONST VECTOR_CC vfloat _ZGVdM8v_sqrtf(vfloat a0, vopmask m) {
+  vopmask o = vinactive_vo_vo(m);
+  return _ZGVdN8v_sqrtf(vsel_vf_vo_vf_vf(o, vcast_vf_f(1), a0));
+}
+EXPORT CONST VECTOR_CC vfloat _ZGVdM8v___sqrtf_finite(vfloat, vopmask) __attribute__((weak, alias("_ZGVdM8v_sqrtf")));
+EXPORT CONST VECTOR_CC vfloat _ZGVdM8v_sqrtf_u35(vfloat a0, vopmask m) {
+  vopmask o = vinactive_vo_vo(m);
+  return _ZGVdN8v_sqrtf_u35(vsel_vf_vo_vf_vf(o, vcast_vf_f(1), a0));
+}
+EXPORT CONST VECTOR_CC vfloat _ZGVdM8v___sqrtf_finite_u35(vfloat, vopmask) __attribute__((weak, alias("_ZGVdM8v_sqrtf_u35")));
+EXPORT CONST VECTOR_CC vfloat _ZGVdM8vv_hypotf(vfloat a0, vfloat a1, vopmask m) {
+  vopmask o = vinactive_vo_vo(m);
+  return _ZGVdN8vv_hypotf(vsel_vf_vo_vf_vf(o, vcast_vf_f(1), a0), vsel_vf_vo_vf_vf(o, vcast_vf_f(1), a1));
+}
+EXPORT CONST VECTOR_CC vfloat _ZGVdM8vv___hypotf_finite(vfloat, vfloat, vopmask) __attribute__((weak, alias("_ZGVdM8vv_hypotf")));
+EXPORT CONST VECTOR_CC vfloat _ZGVdM8vv_hypotf_u35(vfloat a0, vfloat a1, vopmask m) {
+  vopmask o = vinactive_vo_vo(m);
+  return _ZGVdN8vv_hypotf_u35(vsel_vf_vo_vf_vf(o, vcast_vf_f(1), a0), vsel_vf_vo_vf_vf(o, vcast_vf_f(1), a1));
+}
+EXPORT CONST VECTOR_CC vfloat _ZGVdM8vv___hypotf_finite_u35(vfloat, vfloat, vopmask) __attribute__((weak, alias("_ZGVdM8vv_hypotf_u35")));
+EXPORT CONST VECTOR_CC vfloat _ZGVdM8v_fabsf(vfloat a0, vopmask m) {
+  vopmask o = vinactive_vo_vo(m);
+  return _ZGVdN8v_fabsf(vsel_vf_vo_vf_vf(o, vcast_vf_f(1), a0));
+}
+EXPORT CONST VECTOR_CC vfloat _ZGVdM8v___fabsf_finite(vfloat, vopmask) __attribute__((weak, alias("_ZGVdM8v_fabsf")));
+EXPORT CONST VECTOR_CC vfloat _ZGVdM8vv_copysignf(vfloat a0, vfloat a1, vopmask m) {
+  vopmask o = vinactive_vo_vo(m);
+  return _ZGVdN8vv_copysignf(vsel_vf_vo_vf_vf(o, vcast_vf_f(1), a0), vsel_vf_vo_vf_vf(o, vcast_vf_f(1), a1));
+}
+EXPORT CONST VECTOR_CC vfloat _ZGVdM8vv___copysignf_finite(vfloat, vfloat, vopmask) __attribute__((weak, alias("_ZGVdM8vv_copysignf")));
+EXPORT CONST VECTOR_CC vfloat _ZGVdM8vv_fmaxf(vfloat a0, vfloat a1, vopmask m) {
+  vopmask o = vinactive_vo_vo(m);
+  return _ZGVdN8vv_fmaxf(vsel_vf_vo_vf_vf(o, vcast_vf_f(1), a0), vsel_vf_vo_vf_vf(o, vcast_vf_f(1), a1));
+}
+EXPORT CONST VECTOR_CC vfloat _ZGVdM8vv___fmaxf_finite(vfloat, vfloat, vopmask) __attribute__((weak, alias("_ZGVdM8vv_fmaxf")));
+EXPORT CONST VECTOR_CC vfloat _ZGVdM8vv_fminf(vfloat a0, vfloat a1, vopmask m) {
+  vopmask o = vinactive_vo_vo(m);
+  return _ZGVdN8vv_fminf(vsel_vf_vo_vf_vf(o, vcast_vf_f(1), a0), vsel_vf_vo_vf_vf(o, vcast_vf_f(1), a1));
+}
+EXPORT CONST VECTOR_CC vfloat _ZGVdM8vv___fminf_finite(vfloat, vfloat, vopmask) __attribute__((weak, alias("_ZGVdM8vv_fminf")));
+EXPORT CONST VECTOR_CC vfloat _ZGVdM8vv_fdimf(vfloat a0, vfloat a1, vopmask m) {
+  vopmask o = vinactive_vo_vo(m);
+  return _ZGVdN8vv_fdimf(vsel_vf_vo_vf_vf(o, vcast_vf_f(1), a0), vsel_vf_vo_vf_vf(o, vcast_vf_f(1), a1));
+}
+EXPORT CONST VECTOR_CC vfloat _ZGVdM8vv___fdimf_finite(vfloat, vfloat, vopmask) __attribute__((weak, alias("_ZGVdM8vv_fdimf")));
+EXPORT CONST VECTOR_CC vfloat _ZGVdM8v_truncf(vfloat a0, vopmask m) {
+  vopmask o = vinactive_vo_vo(m);
+  return _ZGVdN8v_truncf(vsel_vf_vo_vf_vf(o, vcast_vf_f(1), a0));
+}
+EXPORT CONST VECTOR_CC vfloat _ZGVdM8v___truncf_finite(vfloat, vopmask) __attribute__((weak, alias("_ZGVdM8v_truncf")));
+EXPORT CONST VECTOR_CC vfloat _ZGVdM8v_floorf(vfloat a0, vopmask m) {
+  vopmask o = vinactive_vo_vo(m);
+  return _ZGVdN8v_floorf(vsel_vf_vo_vf_vf(o, vcast_vf_f(1), a0));
+}
+EXPORT CONST VECTOR_CC vfloat _ZGVdM8v___floorf_finite(vfloat, vopmask) __attribute__((weak, alias("_ZGVdM8v_floorf")));
+EXPORT CONST VECTOR_CC vfloat _ZGVdM8v_ceilf(vfloat a0, vopmask m) {
+  vopmask o = vinactive_vo_vo(m);
+  return _ZGVdN8v_ceilf(vsel_vf_vo_vf_vf(o, vcast_vf_f(1), a0));
+}
+EXPORT CONST VECTOR_CC vfloat _ZGVdM8v___ceilf_finite(vfloat, vopmask) __attribute__((weak, alias("_ZGVdM8v_ceilf")));
+EXPORT CONST VECTOR_CC vfloat _ZGVdM8v_roundf(vfloat a0, vopmask m) {
+  vopmask o = vinactive_vo_vo(m);
+  return _ZGVdN8v_roundf(vsel_vf_vo_vf_vf(o, vcast_vf_f(1), a0));
+}
+EXPORT CONST VECTOR_CC vfloat _ZGVdM8v___roundf_finite(vfloat, vopmask) __attribute__((weak, alias("_ZGVdM8v_roundf")));
+EXPORT CONST VECTOR_CC vfloat _ZGVdM8v_rintf(vfloat a0, vopmask m) {
+  vopmask o = vinactive_vo_vo(m);
+  return _ZGVdN8v_rintf(vsel_vf_vo_vf_vf(o, vcast_vf_f(1), a0));
+}
+EXPORT CONST VECTOR_CC vfloat _ZGVdM8v___rintf_finite(vfloat, vopmask) __attribute__((weak, alias("_ZGVdM8v_rintf")));
+EXPORT CONST VECTOR_CC vfloat _ZGVdM8vv_nextafterf(vfloat a0, vfloat a1, vopmask m) {
+  vopmask o = vinactive_vo_vo(m);
+  return _ZGVdN8vv_nextafterf(vsel_vf_vo_vf_vf(o, vcast_vf_f(1), a0), vsel_vf_vo_vf_vf(o, vcast_vf_f(1), a1));
+}
+EXPORT CONST VECTOR_CC vfloat _ZGVdM8vv___nextafterf_finite(vfloat, vfloat, vopmask) __attribute__((weak, alias("_ZGVdM8vv_nextafterf")));
+EXPORT CONST VECTOR_CC vfloat _ZGVdM8v_frfrexpf(vfloat a0, vopmask m) {
+  vopmask o = vinactive_vo_vo(m);
+  return _ZGVdN8v_frfrexpf(vsel_vf_vo_vf_vf(o, vcast_vf_f(1), a0));
+}
+EXPORT CONST VECTOR_CC vfloat _ZGVdM8v___frfrexpf_finite(vfloat, vopmask) __attribute__((weak, alias("_ZGVdM8v_frfrexpf")));
+EXPORT CONST VECTOR_CC vint2 _ZGVdM8v_expfrexpf(vfloat a0, vopmask m) {
+  vopmask o = vinactive_vo_vo(m);
+  return _ZGVdN8v_expfrexpf(vsel_vf_vo_vf_vf(o, vcast_vf_f(1), a0));
+}
+EXPORT CONST VECTOR_CC vfloat _ZGVdM8vv_fmodf(vfloat a0, vfloat a1, vopmask m) {
+  vopmask o = vinactive_vo_vo(m);
+  return _ZGVdN8vv_fmodf(vsel_vf_vo_vf_vf(o, vcast_vf_f(1), a0), vsel_vf_vo_vf_vf(o, vcast_vf_f(1), a1));
+}
+EXPORT CONST VECTOR_CC vfloat _ZGVdM8vv___fmodf_finite(vfloat, vfloat, vopmask) __attribute__((weak, alias("_ZGVdM8vv_fmodf")));
+EXPORT CONST VECTOR_CC vfloat _ZGVdM8vv_remainderf(vfloat a0, vfloat a1, vopmask m) {
+  vopmask o = vinactive_vo_vo(m);
+  return _ZGVdN8vv_remainderf(vsel_vf_vo_vf_vf(o, vcast_vf_f(1), a0), vsel_vf_vo_vf_vf(o, vcast_vf_f(1), a1));
+}
+EXPORT CONST VECTOR_CC vfloat _ZGVdM8vv___remainderf_finite(vfloat, vfloat, vopmask) __attribute__((weak, alias("_ZGVdM8vv_remainderf")));
+EXPORT VECTOR_CC vfloat _ZGVdM8vl4_modff(vfloat a0, float *a1, vopmask m) {
+  vopmask o = vinactive_vo_vo(m);
+  float t[VECTLENSP];
+  int32_t mbuf[VECTLENSP];
+  vfloat r = _ZGVdN8vl4_modff(vsel_vf_vo_vf_vf(o, vcast_vf_f(1), a0), t);
+  vstoreu_v_p_vi2(mbuf, vcast_vi2_vm(vand_vm_vo32_vm(o, vcast_vm_i_i(-1, -1))));
+  for(int i=0;i<VECTLENSP;i++) {
+    if (!mbuf[i*1]) a1[i] = t[i];
+  }
+  return r;
+}
+EXPORT VECTOR_CC vfloat _ZGVdM8vl4___modff_finite(vfloat, float *, vopmask) __attribute__((weak, alias("_ZGVdM8vl4_modff")));
+EXPORT CONST VECTOR_CC vfloat _ZGVdM8v_lgammaf(vfloat a0, vopmask m) {
+  vopmask o = vinactive_vo_vo(m);
+  return _ZGVdN8v_lgammaf(vsel_vf_vo_vf_vf(o, vcast_vf_f(1), a0));
+}
+EXPORT CONST VECTOR_CC vfloat _ZGVdM8v___lgammaf_finite(vfloat, vopmask) __attribute__((weak, alias("_ZGVdM8v_lgammaf")));
+EXPORT CONST VECTOR_CC vfloat _ZGVdM8v_tgammaf(vfloat a0, vopmask m) {
+  vopmask o = vinactive_vo_vo(m);
+  return _ZGVdN8v_tgammaf(vsel_vf_vo_vf_vf(o, vcast_vf_f(1), a0));
+}
+EXPORT CONST VECTOR_CC vfloat _ZGVdM8v___tgammaf_finite(vfloat, vopmask) __attribute__((weak, alias("_ZGVdM8v_tgammaf")));
+EXPORT CONST VECTOR_CC vfloat _ZGVdM8v_erff(vfloat a0, vopmask m) {
+  vopmask o = vinactive_vo_vo(m);
+  return _ZGVdN8v_erff(vsel_vf_vo_vf_vf(o, vcast_vf_f(1), a0));
+}
+EXPORT CONST VECTOR_CC vfloat _ZGVdM8v___erff_finite(vfloat, vopmask) __attribute__((weak, alias("_ZGVdM8v_erff")));
+EXPORT CONST VECTOR_CC vfloat _ZGVdM8v_erfcf(vfloat a0, vopmask m) {
+  vopmask o = vinactive_vo_vo(m);
+  return _ZGVdN8v_erfcf(vsel_vf_vo_vf_vf(o, vcast_vf_f(1), a0));
+}
+EXPORT CONST VECTOR_CC vfloat _ZGVdM8v___erfcf_finite(vfloat, vopmask) __attribute__((weak, alias("_ZGVdM8v_erfcf")));
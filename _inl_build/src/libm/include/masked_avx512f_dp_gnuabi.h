@@ -0,0 +1,422 @@
+static INLINE CONST VECTOR_CC vopmask vinactive_vo_vo(vopmask m) {
+  return veq64_vo_vm_vm(vand_vm_vo64_vm(m, vcast_vm_i_i(-1, -1)), vcast_vm_i_i(0, 0));
+}
+
+EXPORT CONST VECTOR_CC vdouble _ZGVeM8v_sin_u35(vdouble a0, vopmask m) {
+  vopmask o = vinactive_vo_vo(m);
+  return _ZGVeN8v_sin_u35(vsel_vd_vo_vd_vd(o, vcast_vd_d(1), a0));
+}
+EXPORT CONST VECTOR_CC vdouble _ZGVeM8v___sin_finite_u35(vdouble, vopmask) __attribute__((weak, alias("_ZGVeM8v_sin_u35")));
+EXPORT CONST VECTOR_CC vdouble _ZGVeM8v_cos_u35(vdouble a0, vopmask m) {
+  vopmask o = vinactive_vo_vo(m);
+  return _ZGVeN8v_cos_u35(vsel_vd_vo_vd_vd(o, vcast_vd_d(1), a0));
+}
+EXPORT CONST VECTOR_CC vdouble _ZGVeM8v___cos_finite_u35(vdouble, vopmask) __attribute__((weak, alias("_ZGVeM8v_cos_u35")));
+EXPORT VECTOR_CC void _ZGVeM8vl8l8_sincos_u35(vdouble a0, double *a1, double *a2, vopmask m) {
+  vopmask o = vinactive_vo_vo(m);
+  double s[VECTLENDP], c[VECTLENDP];
+  int32_t mbuf[VECTLENSP];
+  _ZGVeN8vl8l8_sincos_u35(vsel_vd_vo_vd_vd(o, vcast_vd_d(1), a0), s, c);
+  vstoreu_v_p_vi2(mbuf, vcast_vi2_vm(vand_vm_vo64_vm(o, vcast_vm_i_i(-1, -1))));
+  for(int i=0;i<VECTLENDP;i++) {
+    if (!mbuf[i*2]) { a1[i] = s[i]; a2[i] = c[i]; }
+  }
+}
+EXPORT CONST VECTOR_CC vdouble _ZGVeM8v_tan_u35(vdouble a0, vopmask m) {
+  vopmask o = vinactive_vo_vo(m);
+  return _ZGVeN8v_tan_u35(vsel_vd_vo_vd_vd(o, vcast_vd_d(1), a0));
+}
+EXPORT CONST VECTOR_CC vdouble _ZGVeM8v___tan_finite_u35(vdouble, vopmask) __attribute__((weak, alias("_ZGVeM8v_tan_u35")));
+EXPORT CONST VECTOR_CC vdouble _ZGVeM8v_asin_u35(vdouble a0, vopmask m) {
+  vopmask o = vinactive_vo_vo(m);
+  return _ZGVeN8v_asin_u35(vsel_vd_vo_vd_vd(o, vcast_vd_d(1), a0));
+}
+EXPORT CONST VECTOR_CC vdouble _ZGVeM8v___asin_finite_u35(vdouble, vopmask) __attribute__((weak, alias("_ZGVeM8v_asin_u35")));
+EXPORT CONST VECTOR_CC vdouble _ZGVeM8v_acos_u35(vdouble a0, vopmask m) {
+  vopmask o = vinactive_vo_vo(m);
+  return _ZGVeN8v_acos_u35(vsel_vd_vo_vd_vd(o, vcast_vd_d(1), a0));
+}
+EXPORT CONST VECTOR_CC vdouble _ZGVeM8v___acos_finite_u35(vdouble, vopmask) __attribute__((weak, alias("_ZGVeM8v_acos_u35")));
+EXPORT CONST VECTOR_CC vdouble _ZGVeM8v_atan_u35(vdouble a0, vopmask m) {
+  vopmask o = vinactive_vo_vo(m);
+  return _ZGVeN8v_atan_u35(vsel_vd_vo_vd_vd(o, vcast_vd_d(1), a0));
+}
+EXPORT CONST VECTOR_CC vdouble _ZGVeM8v___atan_finite_u35(vdouble, vopmask) __attribute__((weak, alias("_ZGVeM8v_atan_u35")));
+EXPORT CONST VECTOR_CC vdouble _ZGVeM8vv_atan2_u35(vdouble a0, vdouble a1, vopmask m) {
+  vopmask o = vinactive_vo_vo(m);
+  return _ZGVeN8vv_atan2_u35(vsel_vd_vo_vd_vd(o, vcast_vd_d(1), a0), vsel_vd_vo_vd_vd(o, vcast_vd_d(1), a1));
+}
+EXPORT CONST VECTOR_CC vdouble _ZGVeM8vv___atan2_finite_u35(vdouble, vdouble, vopmask) __attribute__((weak, alias("_ZGVeM8vv_atan2_u35")));
+EXPORT CONST VECTOR_CC vdouble _ZGVeM8v_log_u35(vdouble a0, vopmask m) {
+  vopmask o = vinactive_vo_vo(m);
+  return _ZGVeN8v_log_u35(vsel_vd_vo_vd_vd(o, vcast_vd_d(1), a0));
+}
+EXPORT CONST VECTOR_CC vdouble _ZGVeM8v___log_finite_u35(vdouble, vopmask) __attribute__((weak, alias("_ZGVeM8v_log_u35")));
+EXPORT CONST VECTOR_CC vdouble _ZGVeM8v_cbrt_u35(vdouble a0, vopmask m) {
+  vopmask o = vinactive_vo_vo(m);
+  return _ZGVeN8v_cbrt_u35(vsel_vd_vo_vd_vd(o, vcast_vd_d(1), a0));
+}
+EXPORT CONST VECTOR_CC vdouble _ZGVeM8v___cbrt_finite_u35(vdouble, vopmask) __attribute__((weak, alias("_ZGVeM8v_cbrt_u35")));
+EXPORT CONST VECTOR_CC vdouble _ZGVeM8v_sin(vdouble a0, vopmask m) {
+  vopmask o = vinactive_vo_vo(m);
+  return _ZGVeN8v_sin(vsel_vd_vo_vd_vd(o, vcast_vd_d(1), a0));
+}
+EXPORT CONST VECTOR_CC vdouble _ZGVeM8v___sin_finite(vdouble, vopmask) __attribute__((weak, alias("_ZGVeM8v_sin")));
+EXPORT CONST VECTOR_CC vdouble _ZGVeM8v_cos(vdouble a0, vopmask m) {
+  vopmask o = vinactive_vo_vo(m);
+  return _ZGVeN8v_cos(vsel_vd_vo_vd_vd(o, vcast_vd_d(1), a0));
+}
+EXPORT CONST VECTOR_CC vdouble _ZGVeM8v___cos_finite(vdouble, vopmask) __attribute__((weak, alias("_ZGVeM8v_cos")));
+EXPORT VECTOR_CC void _ZGVeM8vl8l8_sincos(vdouble a0, double *a1, double *a2, vopmask m) {
+  vopmask o = vinactive_vo_vo(m);
+  double s[VECTLENDP], c[VECTLENDP];
+  int32_t mbuf[VECTLENSP];
+  _ZGVeN8vl8l8_sincos(vsel_vd_vo_vd_vd(o, vcast_vd_d(1), a0), s, c);
+  vstoreu_v_p_vi2(mbuf, vcast_vi2_vm(vand_vm_vo64_vm(o, vcast_vm_i_i(-1, -1))));
+  for(int i=0;i<VECTLENDP;i++) {
+    if (!mbuf[i*2]) { a1[i] = s[i]; a2[i] = c[i]; }
+  }
+}
+EXPORT CONST VECTOR_CC vdouble _ZGVeM8v_tan(vdouble a0, vopmask m) {
+  vopmask o = vinactive_vo_vo(m);
+  return _ZGVeN8v_tan(vsel_vd_vo_vd_vd(o, vcast_vd_d(1), a0));
+}
+EXPORT CONST VECTOR_CC vdouble _ZGVeM8v___tan_finite(vdouble, vopmask) __attribute__((weak, alias("_ZGVeM8v_tan")));
+EXPORT CONST VECTOR_CC vdouble _ZGVeM8v_asin(vdouble a0, vopmask m) {
+  vopmask o = vinactive_vo_vo(m);
+  return _ZGVeN8v_asin(vsel_vd_vo_vd_vd(o, vcast_vd_d(1), a0));
+}
+EXPORT CONST VECTOR_CC vdouble _ZGVeM8v___asin_finite(vdouble, vopmask) __attribute__((weak, alias("_ZGVeM8v_asin")));
+EXPORT CONST VECTOR_CC vdouble _ZGVeM8v_acos(vdouble a0, vopmask m) {
+  vopmask o = vinactive_vo_vo(m);
+  return _ZGVeN8v_acos(vsel_vd_vo_vd_vd(o, vcast_vd_d(1), a0));
+}
+EXPORT CONST VECTOR_CC vdouble _ZGVeM8v___acos_finite(vdouble, vopmask) __attribute__((weak, alias("_ZGVeM8v_acos")));
+EXPORT CONST VECTOR_CC vdouble _ZGVeM8v_atan(vdouble a0, vopmask m) {
+  vopmask o = vinactive_vo_vo(m);
+  return _ZGVeN8v_atan(vsel_vd_vo_vd_vd(o, vcast_vd_d(1), a0));
+}
+EXPORT CONST VECTOR_CC vdouble _ZGVeM8v___atan_finite(vdouble, vopmask) __attribute__((weak, alias("_ZGVeM8v_atan")));
+EXPORT CONST VECTOR_CC vdouble _ZGVeM8vv_atan2(vdouble a0, vdouble a1, vopmask m) {
+  vopmask o = vinactive_vo_vo(m);
+  return _ZGVeN8vv_atan2(vsel_vd_vo_vd_vd(o, vcast_vd_d(1), a0), vsel_vd_vo_vd_vd(o, vcast_vd_d(1), a1));
+}
+EXPORT CONST VECTOR_CC vdouble _ZGVeM8vv___atan2_finite(vdouble, vdouble, vopmask) __attribute__((weak, alias("_ZGVeM8vv_atan2")));
+EXPORT CONST VECTOR_CC vdouble _ZGVeM8v_log(vdouble a0, vopmask m) {
+  vopmask o = vinactive_vo_vo(m);
+  return _ZGVeN8v_log(vsel_vd_vo_vd_vd(o, vcast_vd_d(1), a0));
+}
+EXPORT CONST VECTOR_CC vdouble _ZGVeM8v___log_finite(vdouble, vopmask) __attribute__((weak, alias("_ZGVeM8v_log")));
+EXPORT CONST VECTOR_CC vdouble _ZGVeM8v_cbrt(vdouble a0, vopmask m) {
+  vopmask o = vinactive_vo_vo(m);
+  return _ZGVeN8v_cbrt(vsel_vd_vo_vd_vd(o, vcast_vd_d(1), a0));
+}
+EXPORT CONST VECTOR_CC vdouble _ZGVeM8v___cbrt_finite(vdouble, vopmask) __attribute__((weak, alias("_ZGVeM8v_cbrt")));
+EXPORT CONST VECTOR_CC vdouble _ZGVeM8v_exp(vdouble a0, vopmask m) {
+  vopmask o = vinactive_vo_vo(m);
+  return _ZGVeN8v_exp(vsel_vd_vo_vd_vd(o, vcast_vd_d(1), a0));
+}
+EXPORT CONST VECTOR_CC vdouble _ZGVeM8v___exp_finite(vdouble, vopmask) __attribute__((weak, alias("_ZGVeM8v_exp")));
+EXPORT CONST VECTOR_CC vdouble _ZGVeM8vv_pow(vdouble a0, vdouble a1, vopmask m) {
+  vopmask o = vinactive_vo_vo(m);
+  return _ZGVeN8vv_pow(vsel_vd_vo_vd_vd(o, vcast_vd_d(1), a0), vsel_vd_vo_vd_vd(o, vcast_vd_d(1), a1));
+}
+EXPORT CONST VECTOR_CC vdouble _ZGVeM8vv___pow_finite(vdouble, vdouble, vopmask) __attribute__((weak, alias("_ZGVeM8vv_pow")));
+EXPORT CONST VECTOR_CC vdouble _ZGVeM8v_sinh(vdouble a0, vopmask m) {
+  vopmask o = vinactive_vo_vo(m);
+  return _ZGVeN8v_sinh(vsel_vd_vo_vd_vd(o, vcast_vd_d(1), a0));
+}
+EXPORT CONST VECTOR_CC vdouble _ZGVeM8v___sinh_finite(vdouble, vopmask) __attribute__((weak, alias("_ZGVeM8v_sinh")));
+EXPORT CONST VECTOR_CC vdouble _ZGVeM8v_cosh(vdouble a0, vopmask m) {
+  vopmask o = vinactive_vo_vo(m);
+  return _ZGVeN8v_cosh(vsel_vd_vo_vd_vd(o, vcast_vd_d(1), a0));
+}
+EXPORT CONST VECTOR_CC vdouble _ZGVeM8v___cosh_finite(vdouble, vopmask) __attribute__((weak, alias("_ZGVeM8v_cosh")));
+EXPORT CONST VECTOR_CC vdouble _ZGVeM8v_tanh(vdouble a0, vopmask m) {
+  vopmask o = vinactive_vo_vo(m);
+  return _ZGVeN8v_tanh(vsel_vd_vo_vd_vd(o, vcast_vd_d(1), a0));
+}
+EXPORT CONST VECTOR_CC vdouble _ZGVeM8v___tanh_finite(vdouble, vopmask) __attribute__((weak, alias("_ZGVeM8v_tanh")));
+EXPORT CONST VECTOR_CC vdouble _ZGVeM8v_sinh_u35(vdouble a0, vopmask m) {
+  vopmask o = vinactive_vo_vo(m);
+  return _ZGVeN8v_sinh_u35(vsel_vd_vo_vd_vd(o, vcast_vd_d(1), a0));
+}
+EXPORT CONST VECTOR_CC vdouble _ZGVeM8v___sinh_finite_u35(vdouble, vopmask) __attribute__((weak, alias("_ZGVeM8v_sinh_u35")));
+EXPORT CONST VECTOR_CC vdouble _ZGVeM8v_cosh_u35(vdouble a0, vopmask m) {
+  vopmask o = vinactive_vo_vo(m);
+  return _ZGVeN8v_cosh_u35(vsel_vd_vo_vd_vd(o, vcast_vd_d(1), a0));
+}
+EXPORT CONST VECTOR_CC vdouble _ZGVeM8v___cosh_finite_u35(vdouble, vopmask) __attribute__((weak, alias("_ZGVeM8v_cosh_u35")));
+EXPORT CONST VECTOR_CC vdouble _ZGVeM8v_tanh_u35(vdouble a0, vopmask m) {
+  vopmask o = vinactive_vo_vo(m);
+  return _ZGVeN8v_tanh_u35(vsel_vd_vo_vd_vd(o, vcast_vd_d(1), a0));
+}
+EXPORT CONST VECTOR_CC vdouble _ZGVeM8v___tanh_finite_u35(vdouble, vopmask) __attribute__((weak, alias("_ZGVeM8v_tanh_u35")));
+EXPORT CONST VECTOR_CC vdouble _ZGVeM8v_fastexp_u3500(vdouble a0, vopmask m) {
+  vopmask o = vinactive_vo_vo(m);
+  return _ZGVeN8v_fastexp_u3500(vsel_vd_vo_vd_vd(o, vcast_vd_d(1), a0));
+}
+EXPORT CONST VECTOR_CC vdouble _ZGVeM8v___fastexp_finite_u3500(vdouble, vopmask) __attribute__((weak, alias("_ZGVeM8v_fastexp_u3500")));
+EXPORT CONST VECTOR_CC vdouble _ZGVeM8v_fastexp2_u3500(vdouble a0, vopmask m) {
+  vopmask o = vinactive_vo_vo(m);
+  return _ZGVeN8v_fastexp2_u3500(vsel_vd_vo_vd_vd(o, vcast_vd_d(1), a0));
+}
+EXPORT CONST VECTOR_CC vdouble _ZGVeM8v___fastexp2_finite_u3500(vdouble, vopmask) __attribute__((weak, alias("_ZGVeM8v_fastexp2_u3500")));
+EXPORT CONST VECTOR_CC vdouble _ZGVeM8v_fastlog_u3500(vdouble a0, vopmask m) {
+  vopmask o = vinactive_vo_vo(m);
+  return _ZGVeN8v_fastlog_u3500(vsel_vd_vo_vd_vd(o, vcast_vd_d(1), a0));
+}
+EXPORT CONST VECTOR_CC vdouble _ZGVeM8v___fastlog_finite_u3500(vdouble, vopmask) __attribute__((weak, alias("_ZGVeM8v_fastlog_u3500")));
+EXPORT CONST VECTOR_CC vdouble _ZGVeM8v_fastlog2_u3500(vdouble a0, vopmask m) {
+  vopmask o = vinactive_vo_vo(m);
+  return _ZGVeN8v_fastlog2_u3500(vsel_vd_vo_vd_vd(o, vcast_vd_d(1), a0));
+}
+EXPORT CONST VECTOR_CC vdouble _ZGVeM8v___fastlog2_finite_u3500(vdouble, vopmask) __attribute__((weak, alias("_ZGVeM8v_fastlog2_u3500")));
+EXPORT CONST VECTOR_CC vdouble _ZGVeM8v_fasttanh_u3500(vdouble a0, vopmask m) {
+  vopmask o = vinactive_vo_vo(m);
+  return _ZGVeN8v_fasttanh_u3500(vsel_vd_vo_vd_vd(o, vcast_vd_d(1), a0));
+}
+EXPORT CONST VECTOR_CC vdouble _ZGVeM8v___fasttanh_finite_u3500(vdouble, vopmask) __attribute__((weak, alias("_ZGVeM8v_fasttanh_u3500")));
+EXPORT CONST VECTOR_CC vdouble _ZGVeM8vv_fastatan2_u3500(vdouble a0, vdouble a1, vopmask m) {
+  vopmask o = vinactive_vo_vo(m);
+  return _ZGVeN8vv_fastatan2_u3500(vsel_vd_vo_vd_vd(o, vcast_vd_d(1), a0), vsel_vd_vo_vd_vd(o, vcast_vd_d(1), a1));
+}
+EXPORT CONST VECTOR_CC vdouble _ZGVeM8vv___fastatan2_finite_u3500(vdouble, vdouble, vopmask) __attribute__((weak, alias("_ZGVeM8vv_fastatan2_u3500")));
+EXPORT CONST VECTOR_CC vdouble _ZGVeM8v_fastrsqrt_u3500(vdouble a0, vopmask m) {
+  vopmask o = vinactive_vo_vo(m);
+  return _ZGVeN8v_fastrsqrt_u3500(vsel_vd_vo_vd_vd(o, vcast_vd_d(1), a0));
+}
+EXPORT CONST VECTOR_CC vdouble _ZGVeM8v___fastrsqrt_finite_u3500(vdouble, vopmask) __attribute__((weak, alias("_ZGVeM8v_fastrsqrt_u3500")));
+EXPORT CONST VECTOR_CC vdouble _ZGVeM8v_fastrcp_u3500(vdouble a0, vopmask m) {
+  vopmask o = vinactive_vo_vo(m);
+  return _ZGVeN8v_fastrcp_u3500(vsel_vd_vo_vd_vd(o, vcast_vd_d(1), a0));
+}
+EXPORT CONST VECTOR_CC vdouble _ZGVeM8v___fastrcp_finite_u3500(vdouble, vopmask) __attribute__((weak, alias("_ZGVeM8v_fastrcp_u3500")));
+EXPORT CONST VECTOR_CC vdouble _ZGVeM8v_asinh(vdouble a0, vopmask m) {
+  vopmask o = vinactive_vo_vo(m);
+  return _ZGVeN8v_asinh(vsel_vd_vo_vd_vd(o, vcast_vd_d(1), a0));
+}
+EXPORT CONST VECTOR_CC vdouble _ZGVeM8v___asinh_finite(vdouble, vopmask) __attribute__((weak, alias("_ZGVeM8v_asinh")));
+EXPORT CONST VECTOR_CC vdouble _ZGVeM8v_acosh(vdouble a0, vopmask m) {
+  vopmask o = vinactive_vo_vo(m);
+  return _ZGVeN8v_acosh(vsel_vd_vo_vd_vd(o, vcast_vd_d(1), a0));
+}
+EXPORT CONST VECTOR_CC vdouble _ZGVeM8v___acosh_finite(vdouble, vopmask) __attribute__((weak, alias("_ZGVeM8v_acosh")));
+EXPORT CONST VECTOR_CC vdouble _ZGVeM8v_atanh(vdouble a0, vopmask m) {
+  vopmask o = vinactive_vo_vo(m);
+  return _ZGVeN8v_atanh(vsel_vd_vo_vd_vd(o, vcast_vd_d(1), a0));
+}
+EXPORT CONST VECTOR_CC vdouble _ZGVeM8v___atanh_finite(vdouble, vopmask) __attribute__((weak, alias("_ZGVeM8v_atanh")));
+EXPORT CONST VECTOR_CC vdouble _ZGVeM8v_exp2(vdouble a0, vopmask m) {
+  vopmask o = vinactive_vo_vo(m);
+  return _ZGVeN8v_exp2(vsel_vd_vo_vd_vd(o, vcast_vd_d(1), a0));
+}
+EXPORT CONST VECTOR_CC vdouble _ZGVeM8v___exp2_finite(vdouble, vopmask) __attribute__((weak, alias("_ZGVeM8v_exp2")));
+EXPORT CONST VECTOR_CC vdouble _ZGVeM8v_exp2_u35(vdouble a0, vopmask m) {
+  vopmask o = vinactive_vo_vo(m);
+  return _ZGVeN8v_exp2_u35(vsel_vd_vo_vd_vd(o, vcast_vd_d(1), a0));
+}
+EXPORT CONST VECTOR_CC vdouble _ZGVeM8v___exp2_finite_u35(vdouble, vopmask) __attribute__((weak, alias("_ZGVeM8v_exp2_u35")));
+EXPORT CONST VECTOR_CC vdouble _ZGVeM8v_exp10(vdouble a0, vopmask m) {
+  vopmask o = vinactive_vo_vo(m);
+  return _ZGVeN8v_exp10(vsel_vd_vo_vd_vd(o, vcast_vd_d(1), a0));
+}
+EXPORT CONST VECTOR_CC vdouble _ZGVeM8v___exp10_finite(vdouble, vopmask) __attribute__((weak, alias("_ZGVeM8v_exp10")));
+EXPORT CONST VECTOR_CC vdouble _ZGVeM8v_exp10_u35(vdouble a0, vopmask m) {
+  vopmask o = vinactive_vo_vo(m);
+  return _ZGVeN8v_exp10_u35(vsel_vd_vo_vd_vd(o, vcast_vd_d(1), a0));
+}
+EXPORT CONST VECTOR_CC vdouble _ZGVeM8v___exp10_finite_u35(vdouble, vopmask) __attribute__((weak, alias("_ZGVeM8v_exp10_u35")));
+EXPORT CONST VECTOR_CC vdouble _ZGVeM8v_expm1(vdouble a0, vopmask m) {
+  vopmask o = vinactive_vo_vo(m);
+  return _ZGVeN8v_expm1(vsel_vd_vo_vd_vd(o, vcast_vd_d(1), a0));
+}
+EXPORT CONST VECTOR_CC vdouble _ZGVeM8v___expm1_finite(vdouble, vopmask) __attribute__((weak, alias("_ZGVeM8v_expm1")));
+EXPORT CONST VECTOR_CC vdouble _ZGVeM8v_log10(vdouble a0, vopmask m) {
+  vopmask o = vinactive_vo_vo(m);
+  return _ZGVeN8v_log10(vsel_vd_vo_vd_vd(o, vcast_vd_d(1), a0));
+}
+EXPORT CONST VECTOR_CC vdouble _ZGVeM8v___log10_finite(vdouble, vopmask) __attribute__((weak, alias("_ZGVeM8v_log10")));
+EXPORT CONST VECTOR_CC vdouble _ZGVeM8v_log2(vdouble a0, vopmask m) {
+  vopmask o = vinactive_vo_vo(m);
+  return _ZGVeN8v_log2(vsel_vd_vo_vd_vd(o, vcast_vd_d(1), a0));
+}
+EXPORT CONST VECTOR_CC vdouble _ZGVeM8v___log2_finite(vdouble, vopmask) __attribute__((weak, alias("_ZGVeM8v_log2")));
+EXPORT CONST VECTOR_CC vdouble _ZGVeM8v_log2_u35(vdouble a0, vopmask m) {
+  vopmask o = vinactive_vo_vo(m);
+  return _ZGVeN8v_log2_u35(vsel_vd_vo_vd_vd(o, vcast_vd_d(1), a0));
+}
+EXPORT CONST VECTOR_CC vdouble _ZGVeM8v___log2_finite_u35(vdouble, vopmask) __attribute__((weak, alias("_ZGVeM8v_log2_u35")));
+EXPORT CONST VECTOR_CC vdouble _ZGVeM8v_log1p(vdouble a0, vopmask m) {
+  vopmask o = vinactive_vo_vo(m);
+  return _ZGVeN8v_log1p(vsel_vd_vo_vd_vd(o, vcast_vd_d(1), a0));
+}
+EXPORT CONST VECTOR_CC vdouble _ZGVeM8v___log1p_finite(vdouble, vopmask) __attribute__((weak, alias("_ZGVeM8v_log1p")));
+EXPORT VECTOR_CC void _ZGVeM8vl8l8_sincospi(vdouble a0, double *a1, double *a2, vopmask m) {
+  vopmask o = vinactive_vo_vo(m);
+  double s[VECTLENDP], c[VECTLENDP];
+  int32_t mbuf[VECTLENSP];
+  _ZGVeN8vl8l8_sincospi(vsel_vd_vo_vd_vd(o, vcast_vd_d(1), a0), s, c);
+  vstoreu_v_p_vi2(mbuf, vcast_vi2_vm(vand_vm_vo64_vm(o, vcast_vm_i_i(-1, -1))));
+  for(int i=0;i<VECTLENDP;i++) {
+    if (!mbuf[i*2]) { a1[i] = s[i]; a2[i] = c[i]; }
+  }
+}
+EXPORT VECTOR_CC void _ZGVeM8vl8l8_sincospi_u35(vdouble a0, double *a1, double *a2, vopmask m) {
+  vopmask o = vinactive_vo_vo(m);
+  double s[VECTLENDP], c[VECTLENDP];
+  int32_t mbuf[VECTLENSP];
+  _ZGVeN8vl8l8_sincospi_u35(vsel_vd_vo_vd_vd(o, vcast_vd_d(1), a0), s, c);
+  vstoreu_v_p_vi2(mbuf, vcast_vi2_vm(vand_vm_vo64_vm(o, vcast_vm_i_i(-1, -1))));
+  for(int i=0;i<VECTLENDP;i++) {
+    if (!mbuf[i*2]) { a1[i] = s[i]; a2[i] = c[i]; }
+  }
+}
+EXPORT CONST VECTOR_CC vdouble _ZGVeM8v_sinpi(vdouble a0, vopmask m) {
+  vopmask o = vinactive_vo_vo(m);
+  return _ZGVeN8v_sinpi(vsel_vd_vo_vd_vd(o, vcast_vd_d(1), a0));
+}
+EXPORT CONST VECTOR_CC vdouble _ZGVeM8v___sinpi_finite(vdouble, vopmask) __attribute__((weak, alias("_ZGVeM8v_sinpi")));
+EXPORT CONST VECTOR_CC vdouble _ZGVeM8v_cospi(vdouble a0, vopmask m) {
+  vopmask o = vinactive_vo_vo(m);
+  return _ZGVeN8v_cospi(vsel_vd_vo_vd_vd(o, vcast_vd_d(1), a0));
+}
+EXPORT CONST VECTOR_CC vdouble _ZGVeM8v___cospi_finite(vdouble, vopmask) __attribute__((weak, alias("_ZGVeM8v_cospi")));
+EXPORT CONST VECTOR_CC vdouble _ZGVeM8vv_ldexp(vdouble a0, vint a1, vopmask m) {
+  vopmask o = vinactive_vo_vo(m);
+  return _ZGVeN8vv_ldexp(vsel_vd_vo_vd_vd(o, vcast_vd_d(1), a0), a1);
+}
+EXPORT CONST VECTOR_CC vint _ZGVeM8v_ilogb(vdouble a0, vopmask m) {
+  vopmask o = vinactive_vo_vo(m);
+  return _ZGVeN8v_ilogb(vsel_vd_vo_vd_vd(o, vcast_vd_d(1), a0));
+}
+EXPORT CONST VECTOR_CC vdouble _ZGVeM8vvv_fma(vdouble a0, vdouble a1, vdouble a2, vopmask m) {
+  vopmask o = vinactive_vo_vo(m);
+  return _ZGVeN8vvv_fma(vsel_vd_vo_vd_vd(o, vcast_vd_d(1), a0), vsel_vd_vo_vd_vd(o, vcast_vd_d(1), a1), vsel_vd_vo_vd_vd(o, vcast_vd_d(1), a2));
+}
+EXPORT CONST VECTOR_CC vdouble _ZGVeM8v_sqrt(vdouble a0, vopmask m) {
+  vopmask o = vinactive_vo_vo(m);
+  return _ZGVeN8v_sqrt(vsel_vd_vo_vd_vd(o, vcast_vd_d(1), a0));
+}
+EXPORT CONST VECTOR_CC vdouble _ZGVeM8v___sqrt_finite(vdouble, vopmask) __attribute__((weak, alias("_ZGVeM8v_sqrt")));
+EXPORT CONST VECTOR_CC vdouble _ZGVeM8v_sqrt_u35(vdouble a0, vopmask m) {
+  vopmask o = vinactive_vo_vo(m);
+  return _ZGVeN8v_sqrt_u35(vsel_vd_vo_vd_vd(o, vcast_vd_d(1), a0));
+}
+EXPORT CONST VECTOR_CC vdouble _ZGVeM8v___sqrt_finite_u35(vdouble, vopmask) __attribute__((weak, alias("_ZGVeM8v_sqrt_u35")));
+EXPORT CONST VECTOR_CC vdouble _ZGVeM8vv_hypot(vdouble a0, vdouble a1, vopmask m) {
+  vopmask o = vinactive_vo_vo(m);
+  return _ZGVeN8vv_hypot(vsel_vd_vo_vd_vd(o, vcast_vd_d(1), a0), vsel_vd_vo_vd_vd(o, vcast_vd_d(1), a1));
+}
+EXPORT CONST VECTOR_CC vdouble _ZGVeM8vv___hypot_finite(vdouble, vdouble, vopmask) __attribute__((weak, alias("_ZGVeM8vv_hypot")));
+EXPORT CONST VECTOR_CC vdouble _ZGVeM8vv_hypot_u35(vdouble a0, vdouble a1, vopmask m) {
+  vopmask o = vinactive_vo_vo(m);
+  return _ZGVeN8vv_hypot_u35(vsel_vd_vo_vd_vd(o, vcast_vd_d(1), a0), vsel_vd_vo_vd_vd(o, vcast_vd_d(1), a1));
+}
+EXPORT CONST VECTOR_CC vdouble _ZGVeM8vv___hypot_finite_u35(vdouble, vdouble, vopmask) __attribute__((weak, alias("_ZGVeM8vv_hypot_u35")));
+EXPORT CONST VECTOR_CC vdouble _ZGVeM8v_fabs(vdouble a0, vopmask m) {
+  vopmask o = vinactive_vo_vo(m);
+  return _ZGVeN8v_fabs(vsel_vd_vo_vd_vd(o, vcast_vd_d(1), a0));
+}
+EXPORT CONST VECTOR_CC vdouble _ZGVeM8v___fabs_finite(vdouble, vopmask) __attribute__((weak, alias("_ZGVeM8v_fabs")));
+EXPORT CONST VECTOR_CC vdouble _ZGVeM8vv_copysign(vdouble a0, vdouble a1, vopmask m) {
+  vopmask o = vinactive_vo_vo(m);
+  return _ZGVeN8vv_copysign(vsel_vd_vo_vd_vd(o, vcast_vd_d(1), a0), vsel_vd_vo_vd_vd(o, vcast_vd_d(1), a1));
+}
+EXPORT CONST VECTOR_CC vdouble _ZGVeM8vv___copysign_finite(vdouble, vdouble, vopmask) __attribute__((weak, alias("_ZGVeM8vv_copysign")));
+EXPORT CONST VECTOR_CC vdouble _ZGVeM8vv_fmax(vdouble a0, vdouble a1, vopmask m) {
+  vopmask o = vinactive_vo_vo(m);
+  return _ZGVeN8vv_fmax(vsel_vd_vo_vd_vd(o, vcast_vd_d(1), a0), vsel_vd_vo_vd_vd(o, vcast_vd_d(1), a1));
+}
+EXPORT CONST VECTOR_CC vdouble _ZGVeM8vv___fmax_finite(vdouble, vdouble, vopmask) __attribute__((weak, alias("_ZGVeM8vv_fmax")));
+EXPORT CONST VECTOR_CC vdouble _ZGVeM8vv_fmin(vdouble a0, vdouble a1, vopmask m) {
+  vopmask o = vinactive_vo_vo(m);
+  return _ZGVeN8vv_fmin(vsel_vd_vo_vd_vd(o, vcast_vd_d(1), a0), vsel_vd_vo_vd_vd(o, vcast_vd_d(1), a1));
+}
+EXPORT CONST VECTOR_CC vdouble _ZGVeM8vv___fmin_finite(vdouble, vdouble, vopmask) __attribute__((weak, alias("_ZGVeM8vv_fmin")));
+EXPORT CONST VECTOR_CC vdouble _ZGVeM8vv_fdim(vdouble a0, vdouble a1, vopmask m) {
+  vopmask o = vinactive_vo_vo(m);
+  return _ZGVeN8vv_fdim(vsel_vd_vo_vd_vd(o, vcast_vd_d(1), a0), vsel_vd_vo_vd_vd(o, vcast_vd_d(1), a1));
+}
+EXPORT CONST VECTOR_CC vdouble _ZGVeM8vv___fdim_finite(vdouble, vdouble, vopmask) __attribute__((weak, alias("_ZGVeM8vv_fdim")));
+EXPORT CONST VECTOR_CC vdouble _ZGVeM8v_trunc(vdouble a0, vopmask m) {
+  vopmask o = vinactive_vo_vo(m);
+  return _ZGVeN8v_trunc(vsel_vd_vo_vd_vd(o, vcast_vd_d(1), a0));
+}
+EXPORT CONST VECTOR_CC vdouble _ZGVeM8v___trunc_finite(vdouble, vopmask) __attribute__((weak, alias("_ZGVeM8v_trunc")));
+EXPORT CONST VECTOR_CC vdouble _ZGVeM8v_floor(vdouble a0, vopmask m) {
+  vopmask o = vinactive_vo_vo(m);
+  return _ZGVeN8v_floor(vsel_vd_vo_vd_vd(o, vcast_vd_d(1), a0));
+}
+EXPORT CONST VECTOR_CC vdouble _ZGVeM8v___floor_finite(vdouble, vopmask) __attribute__((weak, alias("_ZGVeM8v_floor")));
+EXPORT CONST VECTOR_CC vdouble _ZGVeM8v_ceil(vdouble a0, vopmask m) {
+  vopmask o = vinactive_vo_vo(m);
+  return _ZGVeN8v_ceil(vsel_vd_vo_vd_vd(o, vcast_vd_d(1), a0));
+}
+EXPORT CONST VECTOR_CC vdouble _ZGVeM8v___ceil_finite(vdouble, vopmask) __attribute__((weak, alias("_ZGVeM8v_ceil")));
+EXPORT CONST VECTOR_CC vdouble _ZGVeM8v_round(vdouble a0, vopmask m) {
+  vopmask o = vinactive_vo_vo(m);
+  return _ZGVeN8v_round(vsel_vd_vo_vd_vd(o, vcast_vd_d(1), a0));
+}
+EXPORT CONST VECTOR_CC vdouble _ZGVeM8v___round_finite(vdouble, vopmask) __attribute__((weak, alias("_ZGVeM8v_round")));
+EXPORT CONST VECTOR_CC vdouble _ZGVeM8v_rint(vdouble a0, vopmask m) {
+  vopmask o = vinactive_vo_vo(m);
+  return _ZGVeN8v_rint(vsel_vd_vo_vd_vd(o, vcast_vd_d(1), a0));
+}
+EXPORT CONST VECTOR_CC vdouble _ZGVeM8v___rint_finite(vdouble, vopmask) __attribute__((weak, alias("_ZGVeM8v_rint")));
+EXPORT CONST VECTOR_CC vdouble _ZGVeM8vv_nextafter(vdouble a0, vdouble a1, vopmask m) {
+  vopmask o = vinactive_vo_vo(m);
+  return _ZGVeN8vv_nextafter(vsel_vd_vo_vd_vd(o, vcast_vd_d(1), a0), vsel_vd_vo_vd_vd(o, vcast_vd_d(1), a1));
+}
+EXPORT CONST VECTOR_CC vdouble _ZGVeM8vv___nextafter_finite(vdouble, vdouble, vopmask) __attribute__((weak, alias("_ZGVeM8vv_nextafter")));
+EXPORT CONST VECTOR_CC vdouble _ZGVeM8v_frfrexp(vdouble a0, vopmask m) {
+  vopmask o = vinactive_vo_vo(m);
+  return _ZGVeN8v_frfrexp(vsel_vd_vo_vd_vd(o, vcast_vd_d(1), a0));
+}
+EXPORT CONST VECTOR_CC vdouble _ZGVeM8v___frfrexp_finite(vdouble, vopmask) __attribute__((weak, alias("_ZGVeM8v_frfrexp")));
+EXPORT CONST VECTOR_CC vint _ZGVeM8v_expfrexp(vdouble a0, vopmask m) {
+  vopmask o = vinactive_vo_vo(m);
+  return _ZGVeN8v_expfrexp(vsel_vd_vo_vd_vd(o, vcast_vd_d(1), a0));
+}
+EXPORT CONST VECTOR_CC vdouble _ZGVeM8vv_fmod(vdouble a0, vdouble a1, vopmask m) {
+  vopmask o = vinactive_vo_vo(m);
+  return _ZGVeN8vv_fmod(vsel_vd_vo_vd_vd(o, vcast_vd_d(1), a0), vsel_vd_vo_vd_vd(o, vcast_vd_d(1), a1));
+}
+EXPORT CONST VECTOR_CC vdouble _ZGVeM8vv___fmod_finite(vdouble, vdouble, vopmask) __attribute__((weak, alias("_ZGVeM8vv_fmod")));
+EXPORT CONST VECTOR_CC vdouble _ZGVeM8vv_remainder(vdouble a0, vdouble a1, vopmask m) {
+  vopmask o = vinactive_vo_vo(m);
+  return _ZGVeN8vv_remainder(vsel_vd_vo_vd_vd(o, vcast_vd_d(1), a0), vsel_vd_vo_vd_vd(o, vcast_vd_d(1), a1));
+}
+EXPORT CONST VECTOR_CC vdouble _ZGVeM8vv___remainder_finite(vdouble, vdouble, vopmask) __attribute__((weak, alias("_ZGVeM8vv_remainder")));
+EXPORT VECTOR_CC vdouble _ZGVeM8vl8_modf(vdouble a0, double *a1, vopmask m) {
+  vopmask o = vinactive_vo_vo(m);
+  double t[VECTLENDP];
+  int32_t mbuf[VECTLENSP];
+  vdouble r = _ZGVeN8vl8_modf(vsel_vd_vo_vd_vd(o, vcast_vd_d(1), a0), t);
+  vstoreu_v_p_vi2(mbuf, vcast_vi2_vm(vand_vm_vo64_vm(o, vcast_vm_i_i(-1, -1))));
+  for(int i=0;i<VECTLENDP;i++) {
+    if (!mbuf[i*2]) a1[i] = t[i];
+  }
+  return r;
+}
+EXPORT VECTOR_CC vdouble _ZGVeM8vl8___modf_finite(vdouble, double *, vopmask) __attribute__((weak, alias("_ZGVeM8vl8_modf")));
+EXPORT CONST VECTOR_CC vdouble _ZGVeM8v_lgamma(vdouble a0, vopmask m) {
+  vopmask o = vinactive_vo_vo(m);
+  return _ZGVeN8v_lgamma(vsel_vd_vo_vd_vd(o, vcast_vd_d(1), a0));
+}
+EXPORT CONST VECTOR_CC vdouble _ZGVeM8v___lgamma_finite(vdouble, vopmask) __attribute__((weak, alias("_ZGVeM8v_lgamma")));
+EXPORT CONST VECTOR_CC vdouble _ZGVeM8v_tgamma(vdouble a0, vopmask m) {
+  vopmask o = vinactive_vo_vo(m);
+  return _ZGVeN8v_tgamma(vsel_vd_vo_vd_vd(o, vcast_vd_d(1), a0));
+}
+EXPORT CONST VECTOR_CC vdouble _ZGVeM8v___tgamma_finite(vdouble, vopmask) __attribute__((weak, alias("_ZGVeM8v_tgamma")));
+EXPORT CONST VECTOR_CC vdouble _ZGVeM8v_erf(vdouble a0, vopmask m) {
+  vopmask o = vinactive_vo_vo(m);
+  return _ZGVeN8v_erf(vsel_vd_vo_vd_vd(o, vcast_vd_d(1), a0));
+}
+EXPORT CONST VECTOR_CC vdouble _ZGVeM8v___erf_finite(vdouble, vopmask) __attribute__((weak, alias("_ZGVeM8v_erf")));
+EXPORT CONST VECTOR_CC vdouble _ZGVeM8v_erfc(vdouble a0, vopmask m) {
+  vopmask o = vinactive_vo_vo(m);
+  return _ZGVeN8v_erfc(vsel_vd_vo_vd_vd(o, vcast_vd_d(1), a0));
+}
+EXPORT CONST VECTOR_CC vdouble _ZGVeM8v___erfc_finite(vdouble, vopmask) __attribute__((weak, alias("_ZGVeM8v_erfc")));
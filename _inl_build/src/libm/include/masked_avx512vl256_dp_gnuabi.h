@@ -0,0 +1,422 @@
+static INLINE CONST VECTOR_CC vopmask vinactive_vo_vo(vopmask m) {
+  return veq64_vo_vm_vm(vand_vm_vo64_vm(m, vcast_vm_i_i(-1, -1)), vcast_vm_i_i(0, 0));
+}
+
+EXPORT CONST VECTOR_CC vdouble _ZGVeM4v_sin_u35(vdouble a0, vopmask m) {
+  vopmask o = vinactive_vo_vo(m);
+  return _ZGVeN4v_sin_u35(vsel_vd_vo_vd_vd(o, vcast_vd_d(1), a0));
+}
+EXPORT CONST VECTOR_CC vdouble _ZGVeM4v___sin_finite_u35(vdouble, vopmask) __attribute__((weak, alias("_ZGVeM4v_sin_u35")));
+EXPORT CONST VECTOR_CC vdouble _ZGVeM4v_cos_u35(vdouble a0, vopmask m) {
+  vopmask o = vinactive_vo_vo(m);
+  return _ZGVeN4v_cos_u35(vsel_vd_vo_vd_vd(o, vcast_vd_d(1), a0));
+}
+EXPORT CONST VECTOR_CC vdouble _ZGVeM4v___cos_finite_u35(vdouble, vopmask) __attribute__((weak, alias("_ZGVeM4v_cos_u35")));
+EXPORT VECTOR_CC void _ZGVeM4vl8l8_sincos_u35(vdouble a0, double *a1, double *a2, vopmask m) {
+  vopmask o = vinactive_vo_vo(m);
+  double s[VECTLENDP], c[VECTLENDP];
+  int32_t mbuf[VECTLENSP];
+  _ZGVeN4vl8l8_sincos_u35(vsel_vd_vo_vd_vd(o, vcast_vd_d(1), a0), s, c);
+  vstoreu_v_p_vi2(mbuf, vcast_vi2_vm(vand_vm_vo64_vm(o, vcast_vm_i_i(-1, -1))));
+  for(int i=0;i<VECTLENDP;i++) {
+    if (!mbuf[i*2]) { a1[i] = s[i]; a2[i] = c[i]; }
+  }
+}
+EXPORT CONST VECTOR_CC vdouble _ZGVeM4v_tan_u35(vdouble a0, vopmask m) {
+  vopmask o = vinactive_vo_vo(m);
+  return _ZGVeN4v_tan_u35(vsel_vd_vo_vd_vd(o, vcast_vd_d(1), a0));
+}
+EXPORT CONST VECTOR_CC vdouble _ZGVeM4v___tan_finite_u35(vdouble, vopmask) __attribute__((weak, alias("_ZGVeM4v_tan_u35")));
+EXPORT CONST VECTOR_CC vdouble _ZGVeM4v_asin_u35(vdouble a0, vopmask m) {
+  vopmask o = vinactive_vo_vo(m);
+  return _ZGVeN4v_asin_u35(vsel_vd_vo_vd_vd(o, vcast_vd_d(1), a0));
+}
+EXPORT CONST VECTOR_CC vdouble _ZGVeM4v___asin_finite_u35(vdouble, vopmask) __attribute__((weak, alias("_ZGVeM4v_asin_u35")));
+EXPORT CONST VECTOR_CC vdouble _ZGVeM4v_acos_u35(vdouble a0, vopmask m) {
+  vopmask o = vinactive_vo_vo(m);
+  return _ZGVeN4v_acos_u35(vsel_vd_vo_vd_vd(o, vcast_vd_d(1), a0));
+}
+EXPORT CONST VECTOR_CC vdouble _ZGVeM4v___acos_finite_u35(vdouble, vopmask) __attribute__((weak, alias("_ZGVeM4v_acos_u35")));
+EXPORT CONST VECTOR_CC vdouble _ZGVeM4v_atan_u35(vdouble a0, vopmask m) {
+  vopmask o = vinactive_vo_vo(m);
+  return _ZGVeN4v_atan_u35(vsel_vd_vo_vd_vd(o, vcast_vd_d(1), a0));
+}
+EXPORT CONST VECTOR_CC vdouble _ZGVeM4v___atan_finite_u35(vdouble, vopmask) __attribute__((weak, alias("_ZGVeM4v_atan_u35")));
+EXPORT CONST VECTOR_CC vdouble _ZGVeM4vv_atan2_u35(vdouble a0, vdouble a1, vopmask m) {
+  vopmask o = vinactive_vo_vo(m);
+  return _ZGVeN4vv_atan2_u35(vsel_vd_vo_vd_vd(o, vcast_vd_d(1), a0), vsel_vd_vo_vd_vd(o, vcast_vd_d(1), a1));
+}
+EXPORT CONST VECTOR_CC vdouble _ZGVeM4vv___atan2_finite_u35(vdouble, vdouble, vopmask) __attribute__((weak, alias("_ZGVeM4vv_atan2_u35")));
+EXPORT CONST VECTOR_CC vdouble _ZGVeM4v_log_u35(vdouble a0, vopmask m) {
+  vopmask o = vinactive_vo_vo(m);
+  return _ZGVeN4v_log_u35(vsel_vd_vo_vd_vd(o, vcast_vd_d(1), a0));
+}
+EXPORT CONST VECTOR_CC vdouble _ZGVeM4v___log_finite_u35(vdouble, vopmask) __attribute__((weak, alias("_ZGVeM4v_log_u35")));
+EXPORT CONST VECTOR_CC vdouble _ZGVeM4v_cbrt_u35(vdouble a0, vopmask m) {
+  vopmask o = vinactive_vo_vo(m);
+  return _ZGVeN4v_cbrt_u35(vsel_vd_vo_vd_vd(o, vcast_vd_d(1), a0));
+}
+EXPORT CONST VECTOR_CC vdouble _ZGVeM4v___cbrt_finite_u35(vdouble, vopmask) __attribute__((weak, alias("_ZGVeM4v_cbrt_u35")));
+EXPORT CONST VECTOR_CC vdouble _ZGVeM4v_sin(vdouble a0, vopmask m) {
+  vopmask o = vinactive_vo_vo(m);
+  return _ZGVeN4v_sin(vsel_vd_vo_vd_vd(o, vcast_vd_d(1), a0));
+}
+EXPORT CONST VECTOR_CC vdouble _ZGVeM4v___sin_finite(vdouble, vopmask) __attribute__((weak, alias("_ZGVeM4v_sin")));
+EXPORT CONST VECTOR_CC vdouble _ZGVeM4v_cos(vdouble a0, vopmask m) {
+  vopmask o = vinactive_vo_vo(m);
+  return _ZGVeN4v_cos(vsel_vd_vo_vd_vd(o, vcast_vd_d(1), a0));
+}
+EXPORT CONST VECTOR_CC vdouble _ZGVeM4v___cos_finite(vdouble, vopmask) __attribute__((weak, alias("_ZGVeM4v_cos")));
+EXPORT VECTOR_CC void _ZGVeM4vl8l8_sincos(vdouble a0, double *a1, double *a2, vopmask m) {
+  vopmask o = vinactive_vo_vo(m);
+  double s[VECTLENDP], c[VECTLENDP];
+  int32_t mbuf[VECTLENSP];
+  _ZGVeN4vl8l8_sincos(vsel_vd_vo_vd_vd(o, vcast_vd_d(1), a0), s, c);
+  vstoreu_v_p_vi2(mbuf, vcast_vi2_vm(vand_vm_vo64_vm(o, vcast_vm_i_i(-1, -1))));
+  for(int i=0;i<VECTLENDP;i++) {
+    if (!mbuf[i*2]) { a1[i] = s[i]; a2[i] = c[i]; }
+  }
+}
+EXPORT CONST VECTOR_CC vdouble _ZGVeM4v_tan(vdouble a0, vopmask m) {
+  vopmask o = vinactive_vo_vo(m);
+  return _ZGVeN4v_tan(vsel_vd_vo_vd_vd(o, vcast_vd_d(1), a0));
+}
+EXPORT CONST VECTOR_CC vdouble _ZGVeM4v___tan_finite(vdouble, vopmask) __attribute__((weak, alias("_ZGVeM4v_tan")));
+EXPORT CONST VECTOR_CC vdouble _ZGVeM4v_asin(vdouble a0, vopmask m) {
+  vopmask o = vinactive_vo_vo(m);
+  return _ZGVeN4v_asin(vsel_vd_vo_vd_vd(o, vcast_vd_d(1), a0));
+}
+EXPORT CONST VECTOR_CC vdouble _ZGVeM4v___asin_finite(vdouble, vopmask) __attribute__((weak, alias("_ZGVeM4v_asin")));
+EXPORT CONST VECTOR_CC vdouble _ZGVeM4v_acos(vdouble a0, vopmask m) {
+  vopmask o = vinactive_vo_vo(m);
+  return _ZGVeN4v_acos(vsel_vd_vo_vd_vd(o, vcast_vd_d(1), a0));
+}
+EXPORT CONST VECTOR_CC vdouble _ZGVeM4v___acos_finite(vdouble, vopmask) __attribute__((weak, alias("_ZGVeM4v_acos")));
+EXPORT CONST VECTOR_CC vdouble _ZGVeM4v_atan(vdouble a0, vopmask m) {
+  vopmask o = vinactive_vo_vo(m);
+  return _ZGVeN4v_atan(vsel_vd_vo_vd_vd(o, vcast_vd_d(1), a0));
+}
+EXPORT CONST VECTOR_CC vdouble _ZGVeM4v___atan_finite(vdouble, vopmask) __attribute__((weak, alias("_ZGVeM4v_atan")));
+EXPORT CONST VECTOR_CC vdouble _ZGVeM4vv_atan2(vdouble a0, vdouble a1, vopmask m) {
+  vopmask o = vinactive_vo_vo(m);
+  return _ZGVeN4vv_atan2(vsel_vd_vo_vd_vd(o, vcast_vd_d(1), a0), vsel_vd_vo_vd_vd(o, vcast_vd_d(1), a1));
+}
+EXPORT CONST VECTOR_CC vdouble _ZGVeM4vv___atan2_finite(vdouble, vdouble, vopmask) __attribute__((weak, alias("_ZGVeM4vv_atan2")));
+EXPORT CONST VECTOR_CC vdouble _ZGVeM4v_log(vdouble a0, vopmask m) {
+  vopmask o = vinactive_vo_vo(m);
+  return _ZGVeN4v_log(vsel_vd_vo_vd_vd(o, vcast_vd_d(1), a0));
+}
+EXPORT CONST VECTOR_CC vdouble _ZGVeM4v___log_finite(vdouble, vopmask) __attribute__((weak, alias("_ZGVeM4v_log")));
+EXPORT CONST VECTOR_CC vdouble _ZGVeM4v_cbrt(vdouble a0, vopmask m) {
+  vopmask o = vinactive_vo_vo(m);
+  return _ZGVeN4v_cbrt(vsel_vd_vo_vd_vd(o, vcast_vd_d(1), a0));
+}
+EXPORT CONST VECTOR_CC vdouble _ZGVeM4v___cbrt_finite(vdouble, vopmask) __attribute__((weak, alias("_ZGVeM4v_cbrt")));
+EXPORT CONST VECTOR_CC vdouble _ZGVeM4v_exp(vdouble a0, vopmask m) {
+  vopmask o = vinactive_vo_vo(m);
+  return _ZGVeN4v_exp(vsel_vd_vo_vd_vd(o, vcast_vd_d(1), a0));
+}
+EXPORT CONST VECTOR_CC vdouble _ZGVeM4v___exp_finite(vdouble, vopmask) __attribute__((weak, alias("_ZGVeM4v_exp")));
+EXPORT CONST VECTOR_CC vdouble _ZGVeM4vv_pow(vdouble a0, vdouble a1, vopmask m) {
+  vopmask o = vinactive_vo_vo(m);
+  return _ZGVeN4vv_pow(vsel_vd_vo_vd_vd(o, vcast_vd_d(1), a0), vsel_vd_vo_vd_vd(o, vcast_vd_d(1), a1));
+}
+EXPORT CONST VECTOR_CC vdouble _ZGVeM4vv___pow_finite(vdouble, vdouble, vopmask) __attribute__((weak, alias("_ZGVeM4vv_pow")));
+EXPORT CONST VECTOR_CC vdouble _ZGVeM4v_sinh(vdouble a0, vopmask m) {
+  vopmask o = vinactive_vo_vo(m);
+  return _ZGVeN4v_sinh(vsel_vd_vo_vd_vd(o, vcast_vd_d(1), a0));
+}
+EXPORT CONST VECTOR_CC vdouble _ZGVeM4v___sinh_finite(vdouble, vopmask) __attribute__((weak, alias("_ZGVeM4v_sinh")));
+EXPORT CONST VECTOR_CC vdouble _ZGVeM4v_cosh(vdouble a0, vopmask m) {
+  vopmask o = vinactive_vo_vo(m);
+  return _ZGVeN4v_cosh(vsel_vd_vo_vd_vd(o, vcast_vd_d(1), a0));
+}
+EXPORT CONST VECTOR_CC vdouble _ZGVeM4v___cosh_finite(vdouble, vopmask) __attribute__((weak, alias("_ZGVeM4v_cosh")));
+EXPORT CONST VECTOR_CC vdouble _ZGVeM4v_tanh(vdouble a0, vopmask m) {
+  vopmask o = vinactive_vo_vo(m);
+  return _ZGVeN4v_tanh(vsel_vd_vo_vd_vd(o, vcast_vd_d(1), a0));
+}
+EXPORT CONST VECTOR_CC vdouble _ZGVeM4v___tanh_finite(vdouble, vopmask) __attribute__((weak, alias("_ZGVeM4v_tanh")));
+EXPORT CONST VECTOR_CC vdouble _ZGVeM4v_sinh_u35(vdouble a0, vopmask m) {
+  vopmask o = vinactive_vo_vo(m);
+  return _ZGVeN4v_sinh_u35(vsel_vd_vo_vd_vd(o, vcast_vd_d(1), a0));
+}
+EXPORT CONST VECTOR_CC vdouble _ZGVeM4v___sinh_finite_u35(vdouble, vopmask) __attribute__((weak, alias("_ZGVeM4v_sinh_u35")));
+EXPORT CONST VECTOR_CC vdouble _ZGVeM4v_cosh_u35(vdouble a0, vopmask m) {
+  vopmask o = vinactive_vo_vo(m);
+  return _ZGVeN4v_cosh_u35(vsel_vd_vo_vd_vd(o, vcast_vd_d(1), a0));
+}
+EXPORT CONST VECTOR_CC vdouble _ZGVeM4v___cosh_finite_u35(vdouble, vopmask) __attribute__((weak, alias("_ZGVeM4v_cosh_u35")));
+EXPORT CONST VECTOR_CC vdouble _ZGVeM4v_tanh_u35(vdouble a0, vopmask m) {
+  vopmask o = vinactive_vo_vo(m);
+  return _ZGVeN4v_tanh_u35(vsel_vd_vo_vd_vd(o, vcast_vd_d(1), a0));
+}
+EXPORT CONST VECTOR_CC vdouble _ZGVeM4v___tanh_finite_u35(vdouble, vopmask) __attribute__((weak, alias("_ZGVeM4v_tanh_u35")));
+EXPORT CONST VECTOR_CC vdouble _ZGVeM4v_fastexp_u3500(vdouble a0, vopmask m) {
+  vopmask o = vinactive_vo_vo(m);
+  return _ZGVeN4v_fastexp_u3500(vsel_vd_vo_vd_vd(o, vcast_vd_d(1), a0));
+}
+EXPORT CONST VECTOR_CC vdouble _ZGVeM4v___fastexp_finite_u3500(vdouble, vopmask) __attribute__((weak, alias("_ZGVeM4v_fastexp_u3500")));
+EXPORT CONST VECTOR_CC vdouble _ZGVeM4v_fastexp2_u3500(vdouble a0, vopmask m) {
+  vopmask o = vinactive_vo_vo(m);
+  return _ZGVeN4v_fastexp2_u3500(vsel_vd_vo_vd_vd(o, vcast_vd_d(1), a0));
+}
+EXPORT CONST VECTOR_CC vdouble _ZGVeM4v___fastexp2_finite_u3500(vdouble, vopmask) __attribute__((weak, alias("_ZGVeM4v_fastexp2_u3500")));
+EXPORT CONST VECTOR_CC vdouble _ZGVeM4v_fastlog_u3500(vdouble a0, vopmask m) {
+  vopmask o = vinactive_vo_vo(m);
+  return _ZGVeN4v_fastlog_u3500(vsel_vd_vo_vd_vd(o, vcast_vd_d(1), a0));
+}
+EXPORT CONST VECTOR_CC vdouble _ZGVeM4v___fastlog_finite_u3500(vdouble, vopmask) __attribute__((weak, alias("_ZGVeM4v_fastlog_u3500")));
+EXPORT CONST VECTOR_CC vdouble _ZGVeM4v_fastlog2_u3500(vdouble a0, vopmask m) {
+  vopmask o = vinactive_vo_vo(m);
+  return _ZGVeN4v_fastlog2_u3500(vsel_vd_vo_vd_vd(o, vcast_vd_d(1), a0));
+}
+EXPORT CONST VECTOR_CC vdouble _ZGVeM4v___fastlog2_finite_u3500(vdouble, vopmask) __attribute__((weak, alias("_ZGVeM4v_fastlog2_u3500")));
+EXPORT CONST VECTOR_CC vdouble _ZGVeM4v_fasttanh_u3500(vdouble a0, vopmask m) {
+  vopmask o = vinactive_vo_vo(m);
+  return _ZGVeN4v_fasttanh_u3500(vsel_vd_vo_vd_vd(o, vcast_vd_d(1), a0));
+}
+EXPORT CONST VECTOR_CC vdouble _ZGVeM4v___fasttanh_finite_u3500(vdouble, vopmask) __attribute__((weak, alias("_ZGVeM4v_fasttanh_u3500")));
+EXPORT CONST VECTOR_CC vdouble _ZGVeM4vv_fastatan2_u3500(vdouble a0, vdouble a1, vopmask m) {
+  vopmask o = vinactive_vo_vo(m);
+  return _ZGVeN4vv_fastatan2_u3500(vsel_vd_vo_vd_vd(o, vcast_vd_d(1), a0), vsel_vd_vo_vd_vd(o, vcast_vd_d(1), a1));
+}
+EXPORT CONST VECTOR_CC vdouble _ZGVeM4vv___fastatan2_finite_u3500(vdouble, vdouble, vopmask) __attribute__((weak, alias("_ZGVeM4vv_fastatan2_u3500")));
+EXPORT CONST VECTOR_CC vdouble _ZGVeM4v_fastrsqrt_u3500(vdouble a0, vopmask m) {
+  vopmask o = vinactive_vo_vo(m);
+  return _ZGVeN4v_fastrsqrt_u3500(vsel_vd_vo_vd_vd(o, vcast_vd_d(1), a0));
+}
+EXPORT CONST VECTOR_CC vdouble _ZGVeM4v___fastrsqrt_finite_u3500(vdouble, vopmask) __attribute__((weak, alias("_ZGVeM4v_fastrsqrt_u3500")));
+EXPORT CONST VECTOR_CC vdouble _ZGVeM4v_fastrcp_u3500(vdouble a0, vopmask m) {
+  vopmask o = vinactive_vo_vo(m);
+  return _ZGVeN4v_fastrcp_u3500(vsel_vd_vo_vd_vd(o, vcast_vd_d(1), a0));
+}
+EXPORT CONST VECTOR_CC vdouble _ZGVeM4v___fastrcp_finite_u3500(vdouble, vopmask) __attribute__((weak, alias("_ZGVeM4v_fastrcp_u3500")));
+EXPORT CONST VECTOR_CC vdouble _ZGVeM4v_asinh(vdouble a0, vopmask m) {
+  vopmask o = vinactive_vo_vo(m);
+  return _ZGVeN4v_asinh(vsel_vd_vo_vd_vd(o, vcast_vd_d(1), a0));
+}
+EXPORT CONST VECTOR_CC vdouble _ZGVeM4v___asinh_finite(vdouble, vopmask) __attribute__((weak, alias("_ZGVeM4v_asinh")));
+EXPORT CONST VECTOR_CC vdouble _ZGVeM4v_acosh(vdouble a0, vopmask m) {
+  vopmask o = vinactive_vo_vo(m);
+  return _ZGVeN4v_acosh(vsel_vd_vo_vd_vd(o, vcast_vd_d(1), a0));
+}
+EXPORT CONST VECTOR_CC vdouble _ZGVeM4v___acosh_finite(vdouble, vopmask) __attribute__((weak, alias("_ZGVeM4v_acosh")));
+EXPORT CONST VECTOR_CC vdouble _ZGVeM4v_atanh(vdouble a0, vopmask m) {
+  vopmask o = vinactive_vo_vo(m);
+  return _ZGVeN4v_atanh(vsel_vd_vo_vd_vd(o, vcast_vd_d(1), a0));
+}
+EXPORT CONST VECTOR_CC vdouble _ZGVeM4v___atanh_finite(vdouble, vopmask) __attribute__((weak, alias("_ZGVeM4v_atanh")));
+EXPORT CONST VECTOR_CC vdouble _ZGVeM4v_exp2(vdouble a0, vopmask m) {
+  vopmask o = vinactive_vo_vo(m);
+  return _ZGVeN4v_exp2(vsel_vd_vo_vd_vd(o, vcast_vd_d(1), a0));
+}
+EXPORT CONST VECTOR_CC vdouble _ZGVeM4v___exp2_finite(vdouble, vopmask) __attribute__((weak, alias("_ZGVeM4v_exp2")));
+EXPORT CONST VECTOR_CC vdouble _ZGVeM4v_exp2_u35(vdouble a0, vopmask m) {
+  vopmask o = vinactive_vo_vo(m);
+  return _ZGVeN4v_exp2_u35(vsel_vd_vo_vd_vd(o, vcast_vd_d(1), a0));
+}
+EXPORT CONST VECTOR_CC vdouble _ZGVeM4v___exp2_finite_u35(vdouble, vopmask) __attribute__((weak, alias("_ZGVeM4v_exp2_u35")));
+EXPORT CONST VECTOR_CC vdouble _ZGVeM4v_exp10(vdouble a0, vopmask m) {
+  vopmask o = vinactive_vo_vo(m);
+  return _ZGVeN4v_exp10(vsel_vd_vo_vd_vd(o, vcast_vd_d(1), a0));
+}
+EXPORT CONST VECTOR_CC vdouble _ZGVeM4v___exp10_finite(vdouble, vopmask) __attribute__((weak, alias("_ZGVeM4v_exp10")));
+EXPORT CONST VECTOR_CC vdouble _ZGVeM4v_exp10_u35(vdouble a0, vopmask m) {
+  vopmask o = vinactive_vo_vo(m);
+  return _ZGVeN4v_exp10_u35(vsel_vd_vo_vd_vd(o, vcast_vd_d(1), a0));
+}
+EXPORT CONST VECTOR_CC vdouble _ZGVeM4v___exp10_finite_u35(vdouble, vopmask) __attribute__((weak, alias("_ZGVeM4v_exp10_u35")));
+EXPORT CONST VECTOR_CC vdouble _ZGVeM4v_expm1(vdouble a0, vopmask m) {
+  vopmask o = vinactive_vo_vo(m);
+  return _ZGVeN4v_expm1(vsel_vd_vo_vd_vd(o, vcast_vd_d(1), a0));
+}
+EXPORT CONST VECTOR_CC vdouble _ZGVeM4v___expm1_finite(vdouble, vopmask) __attribute__((weak, alias("_ZGVeM4v_expm1")));
+EXPORT CONST VECTOR_CC vdouble _ZGVeM4v_log10(vdouble a0, vopmask m) {
+  vopmask o = vinactive_vo_vo(m);
+  return _ZGVeN4v_log10(vsel_vd_vo_vd_vd(o, vcast_vd_d(1), a0));
+}
+EXPORT CONST VECTOR_CC vdouble _ZGVeM4v___log10_finite(vdouble, vopmask) __attribute__((weak, alias("_ZGVeM4v_log10")));
+EXPORT CONST VECTOR_CC vdouble _ZGVeM4v_log2(vdouble a0, vopmask m) {
+  vopmask o = vinactive_vo_vo(m);
+  return _ZGVeN4v_log2(vsel_vd_vo_vd_vd(o, vcast_vd_d(1), a0));
+}
+EXPORT CONST VECTOR_CC vdouble _ZGVeM4v___log2_finite(vdouble, vopmask) __attribute__((weak, alias("_ZGVeM4v_log2")));
+EXPORT CONST VECTOR_CC vdouble _ZGVeM4v_log2_u35(vdouble a0, vopmask m) {
+  vopmask o = vinactive_vo_vo(m);
+  return _ZGVeN4v_log2_u35(vsel_vd_vo_vd_vd(o, vcast_vd_d(1), a0));
+}
+EXPORT CONST VECTOR_CC vdouble _ZGVeM4v___log2_finite_u35(vdouble, vopmask) __attribute__((weak, alias("_ZGVeM4v_log2_u35")));
+EXPORT CONST VECTOR_CC vdouble _ZGVeM4v_log1p(vdouble a0, vopmask m) {
+  vopmask o = vinactive_vo_vo(m);
+  return _ZGVeN4v_log1p(vsel_vd_vo_vd_vd(o, vcast_vd_d(1), a0));
+}
+EXPORT CONST VECTOR_CC vdouble _ZGVeM4v___log1p_finite(vdouble, vopmask) __attribute__((weak, alias("_ZGVeM4v_log1p")));
+EXPORT VECTOR_CC void _ZGVeM4vl8l8_sincospi(vdouble a0, double *a1, double *a2, vopmask m) {
+  vopmask o = vinactive_vo_vo(m);
+  double s[VECTLENDP], c[VECTLENDP];
+  int32_t mbuf[VECTLENSP];
+  _ZGVeN4vl8l8_sincospi(vsel_vd_vo_vd_vd(o, vcast_vd_d(1), a0), s, c);
+  vstoreu_v_p_vi2(mbuf, vcast_vi2_vm(vand_vm_vo64_vm(o, vcast_vm_i_i(-1, -1))));
+  for(int i=0;i<VECTLENDP;i++) {
+    if (!mbuf[i*2]) { a1[i] = s[i]; a2[i] = c[i]; }
+  }
+}
+EXPORT VECTOR_CC void _ZGVeM4vl8l8_sincospi_u35(vdouble a0, double *a1, double *a2, vopmask m) {
+  vopmask o = vinactive_vo_vo(m);
+  double s[VECTLENDP], c[VECTLENDP];
+  int32_t mbuf[VECTLENSP];
+  _ZGVeN4vl8l8_sincospi_u35(vsel_vd_vo_vd_vd(o, vcast_vd_d(1), a0), s, c);
+  vstoreu_v_p_vi2(mbuf, vcast_vi2_vm(vand_vm_vo64_vm(o, vcast_vm_i_i(-1, -1))));
+  for(int i=0;i<VECTLENDP;i++) {
+    if (!mbuf[i*2]) { a1[i] = s[i]; a2[i] = c[i]; }
+  }
+}
+EXPORT CONST VECTOR_CC vdouble _ZGVeM4v_sinpi(vdouble a0, vopmask m) {
+  vopmask o = vinactive_vo_vo(m);
+  return _ZGVeN4v_sinpi(vsel_vd_vo_vd_vd(o, vcast_vd_d(1), a0));
+}
+EXPORT CONST VECTOR_CC vdouble _ZGVeM4v___sinpi_finite(vdouble, vopmask) __attribute__((weak, alias("_ZGVeM4v_sinpi")));
+EXPORT CONST VECTOR_CC vdouble _ZGVeM4v_cospi(vdouble a0, vopmask m) {
+  vopmask o = vinactive_vo_vo(m);
+  return _ZGVeN4v_cospi(vsel_vd_vo_vd_vd(o, vcast_vd_d(1), a0));
+}
+EXPORT CONST VECTOR_CC vdouble _ZGVeM4v___cospi_finite(vdouble, vopmask) __attribute__((weak, alias("_ZGVeM4v_cospi")));
+EXPORT CONST VECTOR_CC vdouble _ZGVeM4vv_ldexp(vdouble a0, vint a1, vopmask m) {
+  vopmask o = vinactive_vo_vo(m);
+  return _ZGVeN4vv_ldexp(vsel_vd_vo_vd_vd(o, vcast_vd_d(1), a0), a1);
+}
+EXPORT CONST VECTOR_CC vint _ZGVeM4v_ilogb(vdouble a0, vopmask m) {
+  vopmask o = vinactive_vo_vo(m);
+  return _ZGVeN4v_ilogb(vsel_vd_vo_vd_vd(o, vcast_vd_d(1), a0));
+}
+EXPORT CONST VECTOR_CC vdouble _ZGVeM4vvv_fma(vdouble a0, vdouble a1, vdouble a2, vopmask m) {
+  vopmask o = vinactive_vo_vo(m);
+  return _ZGVeN4vvv_fma(vsel_vd_vo_vd_vd(o, vcast_vd_d(1), a0), vsel_vd_vo_vd_vd(o, vcast_vd_d(1), a1), vsel_vd_vo_vd_vd(o, vcast_vd_d(1), a2));
+}
+EXPORT CONST VECTOR_CC vdouble _ZGVeM4v_sqrt(vdouble a0, vopmask m) {
+  vopmask o = vinactive_vo_vo(m);
+  return _ZGVeN4v_sqrt(vsel_vd_vo_vd_vd(o, vcast_vd_d(1), a0));
+}
+EXPORT CONST VECTOR_CC vdouble _ZGVeM4v___sqrt_finite(vdouble, vopmask) __attribute__((weak, alias("_ZGVeM4v_sqrt")));
+EXPORT CONST VECTOR_CC vdouble _ZGVeM4v_sqrt_u35(vdouble a0, vopmask m) {
+  vopmask o = vinactive_vo_vo(m);
+  return _ZGVeN4v_sqrt_u35(vsel_vd_vo_vd_vd(o, vcast_vd_d(1), a0));
+}
+EXPORT CONST VECTOR_CC vdouble _ZGVeM4v___sqrt_finite_u35(vdouble, vopmask) __attribute__((weak, alias("_ZGVeM4v_sqrt_u35")));
+EXPORT CONST VECTOR_CC vdouble _ZGVeM4vv_hypot(vdouble a0, vdouble a1, vopmask m) {
+  vopmask o = vinactive_vo_vo(m);
+  return _ZGVeN4vv_hypot(vsel_vd_vo_vd_vd(o, vcast_vd_d(1), a0), vsel_vd_vo_vd_vd(o, vcast_vd_d(1), a1));
+}
+EXPORT CONST VECTOR_CC vdouble _ZGVeM4vv___hypot_finite(vdouble, vdouble, vopmask) __attribute__((weak, alias("_ZGVeM4vv_hypot")));
+EXPORT CONST VECTOR_CC vdouble _ZGVeM4vv_hypot_u35(vdouble a0, vdouble a1, vopmask m) {
+  vopmask o = vinactive_vo_vo(m);
+  return _ZGVeN4vv_hypot_u35(vsel_vd_vo_vd_vd(o, vcast_vd_d(1), a0), vsel_vd_vo_vd_vd(o, vcast_vd_d(1), a1));
+}
+EXPORT CONST VECTOR_CC vdouble _ZGVeM4vv___hypot_finite_u35(vdouble, vdouble, vopmask) __attribute__((weak, alias("_ZGVeM4vv_hypot_u35")));
+EXPORT CONST VECTOR_CC vdouble _ZGVeM4v_fabs(vdouble a0, vopmask m) {
+  vopmask o = vinactive_vo_vo(m);
+  return _ZGVeN4v_fabs(vsel_vd_vo_vd_vd(o, vcast_vd_d(1), a0));
+}
+EXPORT CONST VECTOR_CC vdouble _ZGVeM4v___fabs_finite(vdouble, vopmask) __attribute__((weak, alias("_ZGVeM4v_fabs")));
+EXPORT CONST VECTOR_CC vdouble _ZGVeM4vv_copysign(vdouble a0, vdouble a1, vopmask m) {
+  vopmask o = vinactive_vo_vo(m);
+  return _ZGVeN4vv_copysign(vsel_vd_vo_vd_vd(o, vcast_vd_d(1), a0), vsel_vd_vo_vd_vd(o, vcast_vd_d(1), a1));
+}
+EXPORT CONST VECTOR_CC vdouble _ZGVeM4vv___copysign_finite(vdouble, vdouble, vopmask) __attribute__((weak, alias("_ZGVeM4vv_copysign")));
+EXPORT CONST VECTOR_CC vdouble _ZGVeM4vv_fmax(vdouble a0, vdouble a1, vopmask m) {
+  vopmask o = vinactive_vo_vo(m);
+  return _ZGVeN4vv_fmax(vsel_vd_vo_vd_vd(o, vcast_vd_d(1), a0), vsel_vd_vo_vd_vd(o, vcast_vd_d(1), a1));
+}
+EXPORT CONST VECTOR_CC vdouble _ZGVeM4vv___fmax_finite(vdouble, vdouble, vopmask) __attribute__((weak, alias("_ZGVeM4vv_fmax")));
+EXPORT CONST VECTOR_CC vdouble _ZGVeM4vv_fmin(vdouble a0, vdouble a1, vopmask m) {
+  vopmask o = vinactive_vo_vo(m);
+  return _ZGVeN4vv_fmin(vsel_vd_vo_vd_vd(o, vcast_vd_d(1), a0), vsel_vd_vo_vd_vd(o, vcast_vd_d(1), a1));
+}
+EXPORT CONST VECTOR_CC vdouble _ZGVeM4vv___fmin_finite(vdouble, vdouble, vopmask) __attribute__((weak, alias("_ZGVeM4vv_fmin")));
+EXPORT CONST VECTOR_CC vdouble _ZGVeM4vv_fdim(vdouble a0, vdouble a1, vopmask m) {
+  vopmask o = vinactive_vo_vo(m);
+  return _ZGVeN4vv_fdim(vsel_vd_vo_vd_vd(o, vcast_vd_d(1), a0), vsel_vd_vo_vd_vd(o, vcast_vd_d(1), a1));
+}
+EXPORT CONST VECTOR_CC vdouble _ZGVeM4vv___fdim_finite(vdouble, vdouble, vopmask) __attribute__((weak, alias("_ZGVeM4vv_fdim")));
+EXPORT CONST VECTOR_CC vdouble _ZGVeM4v_trunc(vdouble a0, vopmask m) {
+  vopmask o = vinactive_vo_vo(m);
+  return _ZGVeN4v_trunc(vsel_vd_vo_vd_vd(o, vcast_vd_d(1), a0));
+}
+EXPORT CONST VECTOR_CC vdouble _ZGVeM4v___trunc_finite(vdouble, vopmask) __attribute__((weak, alias("_ZGVeM4v_trunc")));
+EXPORT CONST VECTOR_CC vdouble _ZGVeM4v_floor(vdouble a0, vopmask m) {
+  vopmask o = vinactive_vo_vo(m);
+  return _ZGVeN4v_floor(vsel_vd_vo_vd_vd(o, vcast_vd_d(1), a0));
+}
+EXPORT CONST VECTOR_CC vdouble _ZGVeM4v___floor_finite(vdouble, vopmask) __attribute__((weak, alias("_ZGVeM4v_floor")));
+EXPORT CONST VECTOR_CC vdouble _ZGVeM4v_ceil(vdouble a0, vopmask m) {
+  vopmask o = vinactive_vo_vo(m);
+  return _ZGVeN4v_ceil(vsel_vd_vo_vd_vd(o, vcast_vd_d(1), a0));
+}
+EXPORT CONST VECTOR_CC vdouble _ZGVeM4v___ceil_finite(vdouble, vopmask) __attribute__((weak, alias("_ZGVeM4v_ceil")));
+EXPORT CONST VECTOR_CC vdouble _ZGVeM4v_round(vdouble a0, vopmask m) {
+  vopmask o = vinactive_vo_vo(m);
+  return _ZGVeN4v_round(vsel_vd_vo_vd_vd(o, vcast_vd_d(1), a0));
+}
+EXPORT CONST VECTOR_CC vdouble _ZGVeM4v___round_finite(vdouble, vopmask) __attribute__((weak, alias("_ZGVeM4v_round")));
+EXPORT CONST VECTOR_CC vdouble _ZGVeM4v_rint(vdouble a0, vopmask m) {
+  vopmask o = vinactive_vo_vo(m);
+  return _ZGVeN4v_rint(vsel_vd_vo_vd_vd(o, vcast_vd_d(1), a0));
+}
+EXPORT CONST VECTOR_CC vdouble _ZGVeM4v___rint_finite(vdouble, vopmask) __attribute__((weak, alias("_ZGVeM4v_rint")));
+EXPORT CONST VECTOR_CC vdouble _ZGVeM4vv_nextafter(vdouble a0, vdouble a1, vopmask m) {
+  vopmask o = vinactive_vo_vo(m);
+  return _ZGVeN4vv_nextafter(vsel_vd_vo_vd_vd(o, vcast_vd_d(1), a0), vsel_vd_vo_vd_vd(o, vcast_vd_d(1), a1));
+}
+EXPORT CONST VECTOR_CC vdouble _ZGVeM4vv___nextafter_finite(vdouble, vdouble, vopmask) __attribute__((weak, alias("_ZGVeM4vv_nextafter")));
+EXPORT CONST VECTOR_CC vdouble _ZGVeM4v_frfrexp(vdouble a0, vopmask m) {
+  vopmask o = vinactive_vo_vo(m);
+  return _ZGVeN4v_frfrexp(vsel_vd_vo_vd_vd(o, vcast_vd_d(1), a0));
+}
+EXPORT CONST VECTOR_CC vdouble _ZGVeM4v___frfrexp_finite(vdouble, vopmask) __attribute__((weak, alias("_ZGVeM4v_frfrexp")));
+EXPORT CONST VECTOR_CC vint _ZGVeM4v_expfrexp(vdouble a0, vopmask m) {
+  vopmask o = vinactive_vo_vo(m);
+  return _ZGVeN4v_expfrexp(vsel_vd_vo_vd_vd(o, vcast_vd_d(1), a0));
+}
+EXPORT CONST VECTOR_CC vdouble _ZGVeM4vv_fmod(vdouble a0, vdouble a1, vopmask m) {
+  vopmask o = vinactive_vo_vo(m);
+  return _ZGVeN4vv_fmod(vsel_vd_vo_vd_vd(o, vcast_vd_d(1), a0), vsel_vd_vo_vd_vd(o, vcast_vd_d(1), a1));
+}
+EXPORT CONST VECTOR_CC vdouble _ZGVeM4vv___fmod_finite(vdouble, vdouble, vopmask) __attribute__((weak, alias("_ZGVeM4vv_fmod")));
+EXPORT CONST VECTOR_CC vdouble _ZGVeM4vv_remainder(vdouble a0, vdouble a1, vopmask m) {
+  vopmask o = vinactive_vo_vo(m);
+  return _ZGVeN4vv_remainder(vsel_vd_vo_vd_vd(o, vcast_vd_d(1), a0), vsel_vd_vo_vd_vd(o, vcast_vd_d(1), a1));
+}
+EXPORT CONST VECTOR_CC vdouble _ZGVeM4vv___remainder_finite(vdouble, vdouble, vopmask) __attribute__((weak, alias("_ZGVeM4vv_remainder")));
+EXPORT VECTOR_CC vdouble _ZGVeM4vl8_modf(vdouble a0, double *a1, vopmask m) {
+  vopmask o = vinactive_vo_vo(m);
+  double t[VECTLENDP];
+  int32_t mbuf[VECTLENSP];
+  vdouble r = _ZGVeN4vl8_modf(vsel_vd_vo_vd_vd(o, vcast_vd_d(1), a0), t);
+  vstoreu_v_p_vi2(mbuf, vcast_vi2_vm(vand_vm_vo64_vm(o, vcast_vm_i_i(-1, -1))));
+  for(int i=0;i<VECTLENDP;i++) {
+    if (!mbuf[i*2]) a1[i] = t[i];
+  }
+  return r;
+}
+EXPORT VECTOR_CC vdouble _ZGVeM4vl8___modf_finite(vdouble, double *, vopmask) __attribute__((weak, alias("_ZGVeM4vl8_modf")));
+EXPORT CONST VECTOR_CC vdouble _ZGVeM4v_lgamma(vdouble a0, vopmask m) {
+  vopmask o = vinactive_vo_vo(m);
+  return _ZGVeN4v_lgamma(vsel_vd_vo_vd_vd(o, vcast_vd_d(1), a0));
+}
+EXPORT CONST VECTOR_CC vdouble _ZGVeM4v___lgamma_finite(vdouble, vopmask) __attribute__((weak, alias("_ZGVeM4v_lgamma")));
+EXPORT CONST VECTOR_CC vdouble _ZGVeM4v_tgamma(vdouble a0, vopmask m) {
+  vopmask o = vinactive_vo_vo(m);
+  return _ZGVeN4v_tgamma(vsel_vd_vo_vd_vd(o, vcast_vd_d(1), a0));
+}
+EXPORT CONST VECTOR_CC vdouble _ZGVeM4v___tgamma_finite(vdouble, vopmask) __attribute__((weak, alias("_ZGVeM4v_tgamma")));
+EXPORT CONST VECTOR_CC vdouble _ZGVeM4v_erf(vdouble a0, vopmask m) {
+  vopmask o = vinactive_vo_vo(m);
+  return _ZGVeN4v_erf(vsel_vd_vo_vd_vd(o, vcast_vd_d(1), a0));
+}
+EXPORT CONST VECTOR_CC vdouble _ZGVeM4v___erf_finite(vdouble, vopmask) __attribute__((weak, alias("_ZGVeM4v_erf")));
+EXPORT CONST VECTOR_CC vdouble _ZGVeM4v_erfc(vdouble a0, vopmask m) {
+  vopmask o = vinactive_vo_vo(m);
+  return _ZGVeN4v_erfc(vsel_vd_vo_vd_vd(o, vcast_vd_d(1), a0));
+}
+EXPORT CONST VECTOR_CC vdouble _ZGVeM4v___erfc_finite(vdouble, vopmask) __attribute__((weak, alias("_ZGVeM4v_erfc")));
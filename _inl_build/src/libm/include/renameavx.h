@@ -0,0 +1,652 @@
+#ifndef DETERMINISTIC
+
+#define xsin Sleef_sind4_u35avx
+#define ysin Sleef_cinz_sind4_u35avx
+#define xcos Sleef_cosd4_u35avx
+#define ycos Sleef_cinz_cosd4_u35avx
+#define xsincos Sleef_sincosd4_u35avx
+#define ysincos Sleef_cinz_sincosd4_u35avx
+#define xtan Sleef_tand4_u35avx
+#define ytan Sleef_cinz_tand4_u35avx
+#define xasin Sleef_asind4_u35avx
+#define yasin Sleef_cinz_asind4_u35avx
+#define xacos Sleef_acosd4_u35avx
+#define yacos Sleef_cinz_acosd4_u35avx
+#define xatan Sleef_atand4_u35avx
+#define yatan Sleef_cinz_atand4_u35avx
+#define xatan2 Sleef_atan2d4_u35avx
+#define yatan2 Sleef_cinz_atan2d4_u35avx
+#define xlog Sleef_logd4_u35avx
+#define ylog Sleef_cinz_logd4_u35avx
+#define xcbrt Sleef_cbrtd4_u35avx
+#define ycbrt Sleef_cinz_cbrtd4_u35avx
+#define xsin_u1 Sleef_sind4_u10avx
+#define ysin_u1 Sleef_cinz_sind4_u10avx
+#define xcos_u1 Sleef_cosd4_u10avx
+#define ycos_u1 Sleef_cinz_cosd4_u10avx
+#define xsincos_u1 Sleef_sincosd4_u10avx
+#define ysincos_u1 Sleef_cinz_sincosd4_u10avx
+#define xtan_u1 Sleef_tand4_u10avx
+#define ytan_u1 Sleef_cinz_tand4_u10avx
+#define xasin_u1 Sleef_asind4_u10avx
+#define yasin_u1 Sleef_cinz_asind4_u10avx
+#define xacos_u1 Sleef_acosd4_u10avx
+#define yacos_u1 Sleef_cinz_acosd4_u10avx
+#define xatan_u1 Sleef_atand4_u10avx
+#define yatan_u1 Sleef_cinz_atand4_u10avx
+#define xatan2_u1 Sleef_atan2d4_u10avx
+#define yatan2_u1 Sleef_cinz_atan2d4_u10avx
+#define xlog_u1 Sleef_logd4_u10avx
+#define ylog_u1 Sleef_cinz_logd4_u10avx
+#define xcbrt_u1 Sleef_cbrtd4_u10avx
+#define ycbrt_u1 Sleef_cinz_cbrtd4_u10avx
+#define xexp Sleef_expd4_u10avx
+#define yexp Sleef_cinz_expd4_u10avx
+#define xpow Sleef_powd4_u10avx
+#define ypow Sleef_cinz_powd4_u10avx
+#define xsinh Sleef_sinhd4_u10avx
+#define ysinh Sleef_cinz_sinhd4_u10avx
+#define xcosh Sleef_coshd4_u10avx
+#define ycosh Sleef_cinz_coshd4_u10avx
+#define xtanh Sleef_tanhd4_u10avx
+#define ytanh Sleef_cinz_tanhd4_u10avx
+#define xsinh_u35 Sleef_sinhd4_u35avx
+#define ysinh_u35 Sleef_cinz_sinhd4_u35avx
+#define xcosh_u35 Sleef_coshd4_u35avx
+#define ycosh_u35 Sleef_cinz_coshd4_u35avx
+#define xtanh_u35 Sleef_tanhd4_u35avx
+#define ytanh_u35 Sleef_cinz_tanhd4_u35avx
+#define xfastsin_u3500 Sleef_fastsind4_u3500avx
+#define yfastsin_u3500 Sleef_cinz_fastsind4_u3500avx
+#define xfastcos_u3500 Sleef_fastcosd4_u3500avx
+#define yfastcos_u3500 Sleef_cinz_fastcosd4_u3500avx
+#define xfastpow_u3500 Sleef_fastpowd4_u3500avx
+#define yfastpow_u3500 Sleef_cinz_fastpowd4_u3500avx
+#define xfastexp_u3500 Sleef_fastexpd4_u3500avx
+#define yfastexp_u3500 Sleef_cinz_fastexpd4_u3500avx
+#define xfastexp2_u3500 Sleef_fastexp2d4_u3500avx
+#define yfastexp2_u3500 Sleef_cinz_fastexp2d4_u3500avx
+#define xfastlog_u3500 Sleef_fastlogd4_u3500avx
+#define yfastlog_u3500 Sleef_cinz_fastlogd4_u3500avx
+#define xfastlog2_u3500 Sleef_fastlog2d4_u3500avx
+#define yfastlog2_u3500 Sleef_cinz_fastlog2d4_u3500avx
+#define xfasttanh_u3500 Sleef_fasttanhd4_u3500avx
+#define yfasttanh_u3500 Sleef_cinz_fasttanhd4_u3500avx
+#define xfastatan2_u3500 Sleef_fastatan2d4_u3500avx
+#define yfastatan2_u3500 Sleef_cinz_fastatan2d4_u3500avx
+#define xfastrsqrt_u3500 Sleef_fastrsqrtd4_u3500avx
+#define yfastrsqrt_u3500 Sleef_cinz_fastrsqrtd4_u3500avx
+#define xfastrcp_u3500 Sleef_fastrcpd4_u3500avx
+#define yfastrcp_u3500 Sleef_cinz_fastrcpd4_u3500avx
+#define xsinr_u35 Sleef_sinrd4_u35avx
+#define ysinr_u35 Sleef_cinz_sinrd4_u35avx
+#define xcosr_u35 Sleef_cosrd4_u35avx
+#define ycosr_u35 Sleef_cinz_cosrd4_u35avx
+#define xsincosr_u35 Sleef_sincosrd4_u35avx
+#define ysincosr_u35 Sleef_cinz_sincosrd4_u35avx
+#define xtanr_u35 Sleef_tanrd4_u35avx
+#define ytanr_u35 Sleef_cinz_tanrd4_u35avx
+#define xasinh Sleef_asinhd4_u10avx
+#define yasinh Sleef_cinz_asinhd4_u10avx
+#define xacosh Sleef_acoshd4_u10avx
+#define yacosh Sleef_cinz_acoshd4_u10avx
+#define xatanh Sleef_atanhd4_u10avx
+#define yatanh Sleef_cinz_atanhd4_u10avx
+#define xexp2 Sleef_exp2d4_u10avx
+#define yexp2 Sleef_cinz_exp2d4_u10avx
+#define xexp2_u35 Sleef_exp2d4_u35avx
+#define yexp2_u35 Sleef_cinz_exp2d4_u35avx
+#define xexp10 Sleef_exp10d4_u10avx
+#define yexp10 Sleef_cinz_exp10d4_u10avx
+#define xexp10_u35 Sleef_exp10d4_u35avx
+#define yexp10_u35 Sleef_cinz_exp10d4_u35avx
+#define xexpm1 Sleef_expm1d4_u10avx
+#define yexpm1 Sleef_cinz_expm1d4_u10avx
+#define xlog10 Sleef_log10d4_u10avx
+#define ylog10 Sleef_cinz_log10d4_u10avx
+#define xlog2 Sleef_log2d4_u10avx
+#define ylog2 Sleef_cinz_log2d4_u10avx
+#define xlog2_u35 Sleef_log2d4_u35avx
+#define ylog2_u35 Sleef_cinz_log2d4_u35avx
+#define xlog1p Sleef_log1pd4_u10avx
+#define ylog1p Sleef_cinz_log1pd4_u10avx
+#define xsincospi_u05 Sleef_sincospid4_u05avx
+#define ysincospi_u05 Sleef_cinz_sincospid4_u05avx
+#define xsincospi_u35 Sleef_sincospid4_u35avx
+#define ysincospi_u35 Sleef_cinz_sincospid4_u35avx
+#define xsinpi_u05 Sleef_sinpid4_u05avx
+#define ysinpi_u05 Sleef_cinz_sinpid4_u05avx
+#define xcospi_u05 Sleef_cospid4_u05avx
+#define ycospi_u05 Sleef_cinz_cospid4_u05avx
+#define xldexp Sleef_ldexpd4_avx
+#define yldexp Sleef_cinz_ldexpd4_avx
+#define xilogb Sleef_ilogbd4_avx
+#define yilogb Sleef_cinz_ilogbd4_avx
+#define xfma Sleef_fmad4_avx
+#define yfma Sleef_cinz_fmad4_avx
+#define xsqrt Sleef_sqrtd4_avx
+#define ysqrt Sleef_cinz_sqrtd4_avx
+#define xsqrt_u05 Sleef_sqrtd4_u05avx
+#define ysqrt_u05 Sleef_cinz_sqrtd4_u05avx
+#define xsqrt_u35 Sleef_sqrtd4_u35avx
+#define ysqrt_u35 Sleef_cinz_sqrtd4_u35avx
+#define xhypot_u05 Sleef_hypotd4_u05avx
+#define yhypot_u05 Sleef_cinz_hypotd4_u05avx
+#define xhypot_u35 Sleef_hypotd4_u35avx
+#define yhypot_u35 Sleef_cinz_hypotd4_u35avx
+#define xfabs Sleef_fabsd4_avx
+#define yfabs Sleef_cinz_fabsd4_avx
+#define xcopysign Sleef_copysignd4_avx
+#define ycopysign Sleef_cinz_copysignd4_avx
+#define xfmax Sleef_fmaxd4_avx
+#define yfmax Sleef_cinz_fmaxd4_avx
+#define xfmin Sleef_fmind4_avx
+#define yfmin Sleef_cinz_fmind4_avx
+#define xfdim Sleef_fdimd4_avx
+#define yfdim Sleef_cinz_fdimd4_avx
+#define xtrunc Sleef_truncd4_avx
+#define ytrunc Sleef_cinz_truncd4_avx
+#define xfloor Sleef_floord4_avx
+#define yfloor Sleef_cinz_floord4_avx
+#define xceil Sleef_ceild4_avx
+#define yceil Sleef_cinz_ceild4_avx
+#define xround Sleef_roundd4_avx
+#define yround Sleef_cinz_roundd4_avx
+#define xrint Sleef_rintd4_avx
+#define yrint Sleef_cinz_rintd4_avx
+#define xnextafter Sleef_nextafterd4_avx
+#define ynextafter Sleef_cinz_nextafterd4_avx
+#define xfrfrexp Sleef_frfrexpd4_avx
+#define yfrfrexp Sleef_cinz_frfrexpd4_avx
+#define xexpfrexp Sleef_expfrexpd4_avx
+#define yexpfrexp Sleef_cinz_expfrexpd4_avx
+#define xfmod Sleef_fmodd4_avx
+#define yfmod Sleef_cinz_fmodd4_avx
+#define xremainder Sleef_remainderd4_avx
+#define yremainder Sleef_cinz_remainderd4_avx
+#define xmodf Sleef_modfd4_avx
+#define ymodf Sleef_cinz_modfd4_avx
+#define xlgamma_u1 Sleef_lgammad4_u10avx
+#define ylgamma_u1 Sleef_cinz_lgammad4_u10avx
+#define xtgamma_u1 Sleef_tgammad4_u10avx
+#define ytgamma_u1 Sleef_cinz_tgammad4_u10avx
+#define xerf_u1 Sleef_erfd4_u10avx
+#define yerf_u1 Sleef_cinz_erfd4_u10avx
+#define xerfc_u15 Sleef_erfcd4_u15avx
+#define yerfc_u15 Sleef_cinz_erfcd4_u15avx
+#define xsigmoid Sleef_sigmoidd4_u10avx
+#define ysigmoid Sleef_cinz_sigmoidd4_u10avx
+#define xsigmoid_u35 Sleef_sigmoidd4_u35avx
+#define ysigmoid_u35 Sleef_cinz_sigmoidd4_u35avx
+#define xsoftplus Sleef_softplusd4_u10avx
+#define ysoftplus Sleef_cinz_softplusd4_u10avx
+#define xsoftplus_u35 Sleef_softplusd4_u35avx
+#define ysoftplus_u35 Sleef_cinz_softplusd4_u35avx
+#define xsilu Sleef_silud4_u10avx
+#define ysilu Sleef_cinz_silud4_u10avx
+#define xsilu_u35 Sleef_silud4_u35avx
+#define ysilu_u35 Sleef_cinz_silud4_u35avx
+#define xgelutanh Sleef_gelutanhd4_u10avx
+#define ygelutanh Sleef_cinz_gelutanhd4_u10avx
+#define xgelutanh_u35 Sleef_gelutanhd4_u35avx
+#define ygelutanh_u35 Sleef_cinz_gelutanhd4_u35avx
+#define xgelu_u15 Sleef_gelud4_u15avx
+#define ygelu_u15 Sleef_cinz_gelud4_u15avx
+#define xgetInt Sleef_getIntd4_avx
+#define ygetInt Sleef_cinz_getIntd4_avx
+#define xgetPtr Sleef_getPtrd4_avx
+#define ygetPtr Sleef_cinz_getPtrd4_avx
+
+#define xsinf Sleef_sinf8_u35avx
+#define ysinf Sleef_cinz_sinf8_u35avx
+#define xcosf Sleef_cosf8_u35avx
+#define ycosf Sleef_cinz_cosf8_u35avx
+#define xsincosf Sleef_sincosf8_u35avx
+#define ysincosf Sleef_cinz_sincosf8_u35avx
+#define xtanf Sleef_tanf8_u35avx
+#define ytanf Sleef_cinz_tanf8_u35avx
+#define xasinf Sleef_asinf8_u35avx
+#define yasinf Sleef_cinz_asinf8_u35avx
+#define xacosf Sleef_acosf8_u35avx
+#define yacosf Sleef_cinz_acosf8_u35avx
+#define xatanf Sleef_atanf8_u35avx
+#define yatanf Sleef_cinz_atanf8_u35avx
+#define xatan2f Sleef_atan2f8_u35avx
+#define yatan2f Sleef_cinz_atan2f8_u35avx
+#define xlogf Sleef_logf8_u35avx
+#define ylogf Sleef_cinz_logf8_u35avx
+#define xcbrtf Sleef_cbrtf8_u35avx
+#define ycbrtf Sleef_cinz_cbrtf8_u35avx
+#define xsinf_u1 Sleef_sinf8_u10avx
+#define ysinf_u1 Sleef_cinz_sinf8_u10avx
+#define xcosf_u1 Sleef_cosf8_u10avx
+#define ycosf_u1 Sleef_cinz_cosf8_u10avx
+#define xsincosf_u1 Sleef_sincosf8_u10avx
+#define ysincosf_u1 Sleef_cinz_sincosf8_u10avx
+#define xtanf_u1 Sleef_tanf8_u10avx
+#define ytanf_u1 Sleef_cinz_tanf8_u10avx
+#define xasinf_u1 Sleef_asinf8_u10avx
+#define yasinf_u1 Sleef_cinz_asinf8_u10avx
+#define xacosf_u1 Sleef_acosf8_u10avx
+#define yacosf_u1 Sleef_cinz_acosf8_u10avx
+#define xatanf_u1 Sleef_atanf8_u10avx
+#define yatanf_u1 Sleef_cinz_atanf8_u10avx
+#define xatan2f_u1 Sleef_atan2f8_u10avx
+#define yatan2f_u1 Sleef_cinz_atan2f8_u10avx
+#define xlogf_u1 Sleef_logf8_u10avx
+#define ylogf_u1 Sleef_cinz_logf8_u10avx
+#define xcbrtf_u1 Sleef_cbrtf8_u10avx
+#define ycbrtf_u1 Sleef_cinz_cbrtf8_u10avx
+#define xexpf Sleef_expf8_u10avx
+#define yexpf Sleef_cinz_expf8_u10avx
+#define xpowf Sleef_powf8_u10avx
+#define ypowf Sleef_cinz_powf8_u10avx
+#define xsinhf Sleef_sinhf8_u10avx
+#define ysinhf Sleef_cinz_sinhf8_u10avx
+#define xcoshf Sleef_coshf8_u10avx
+#define ycoshf Sleef_cinz_coshf8_u10avx
+#define xtanhf Sleef_tanhf8_u10avx
+#define ytanhf Sleef_cinz_tanhf8_u10avx
+#define xsinhf_u35 Sleef_sinhf8_u35avx
+#define ysinhf_u35 Sleef_cinz_sinhf8_u35avx
+#define xcoshf_u35 Sleef_coshf8_u35avx
+#define ycoshf_u35 Sleef_cinz_coshf8_u35avx
+#define xtanhf_u35 Sleef_tanhf8_u35avx
+#define ytanhf_u35 Sleef_cinz_tanhf8_u35avx
+#define xfastsinf_u3500 Sleef_fastsinf8_u3500avx
+#define yfastsinf_u3500 Sleef_cinz_fastsinf8_u3500avx
+#define xfastcosf_u3500 Sleef_fastcosf8_u3500avx
+#define yfastcosf_u3500 Sleef_cinz_fastcosf8_u3500avx
+#define xfastpowf_u3500 Sleef_fastpowf8_u3500avx
+#define yfastpowf_u3500 Sleef_cinz_fastpowf8_u3500avx
+#define xfastexpf_u3500 Sleef_fastexpf8_u3500avx
+#define yfastexpf_u3500 Sleef_cinz_fastexpf8_u3500avx
+#define xfastexp2f_u3500 Sleef_fastexp2f8_u3500avx
+#define yfastexp2f_u3500 Sleef_cinz_fastexp2f8_u3500avx
+#define xfastlogf_u3500 Sleef_fastlogf8_u3500avx
+#define yfastlogf_u3500 Sleef_cinz_fastlogf8_u3500avx
+#define xfastlog2f_u3500 Sleef_fastlog2f8_u3500avx
+#define yfastlog2f_u3500 Sleef_cinz_fastlog2f8_u3500avx
+#define xfasttanhf_u3500 Sleef_fasttanhf8_u3500avx
+#define yfasttanhf_u3500 Sleef_cinz_fasttanhf8_u3500avx
+#define xfastatan2f_u3500 Sleef_fastatan2f8_u3500avx
+#define yfastatan2f_u3500 Sleef_cinz_fastatan2f8_u3500avx
+#define xfastrsqrtf_u3500 Sleef_fastrsqrtf8_u3500avx
+#define yfastrsqrtf_u3500 Sleef_cinz_fastrsqrtf8_u3500avx
+#define xfastrcpf_u3500 Sleef_fastrcpf8_u3500avx
+#define yfastrcpf_u3500 Sleef_cinz_fastrcpf8_u3500avx
+#define xsinrf_u35 Sleef_sinrf8_u35avx
+#define ysinrf_u35 Sleef_cinz_sinrf8_u35avx
+#define xcosrf_u35 Sleef_cosrf8_u35avx
+#define ycosrf_u35 Sleef_cinz_cosrf8_u35avx
+#define xsincosrf_u35 Sleef_sincosrf8_u35avx
+#define ysincosrf_u35 Sleef_cinz_sincosrf8_u35avx
+#define xtanrf_u35 Sleef_tanrf8_u35avx
+#define ytanrf_u35 Sleef_cinz_tanrf8_u35avx
+#define xasinhf Sleef_asinhf8_u10avx
+#define yasinhf Sleef_cinz_asinhf8_u10avx
+#define xacoshf Sleef_acoshf8_u10avx
+#define yacoshf Sleef_cinz_acoshf8_u10avx
+#define xatanhf Sleef_atanhf8_u10avx
+#define yatanhf Sleef_cinz_atanhf8_u10avx
+#define xexp2f Sleef_exp2f8_u10avx
+#define yexp2f Sleef_cinz_exp2f8_u10avx
+#define xexp2f_u35 Sleef_exp2f8_u35avx
+#define yexp2f_u35 Sleef_cinz_exp2f8_u35avx
+#define xexp10f Sleef_exp10f8_u10avx
+#define yexp10f Sleef_cinz_exp10f8_u10avx
+#define xexp10f_u35 Sleef_exp10f8_u35avx
+#define yexp10f_u35 Sleef_cinz_exp10f8_u35avx
+#define xexpm1f Sleef_expm1f8_u10avx
+#define yexpm1f Sleef_cinz_expm1f8_u10avx
+#define xlog10f Sleef_log10f8_u10avx
+#define ylog10f Sleef_cinz_log10f8_u10avx
+#define xlog2f Sleef_log2f8_u10avx
+#define ylog2f Sleef_cinz_log2f8_u10avx
+#define xlog2f_u35 Sleef_log2f8_u35avx
+#define ylog2f_u35 Sleef_cinz_log2f8_u35avx
+#define xlog1pf Sleef_log1pf8_u10avx
+#define ylog1pf Sleef_cinz_log1pf8_u10avx
+#define xsincospif_u05 Sleef_sincospif8_u05avx
+#define ysincospif_u05 Sleef_cinz_sincospif8_u05avx
+#define xsincospif_u35 Sleef_sincospif8_u35avx
+#define ysincospif_u35 Sleef_cinz_sincospif8_u35avx
+#define xsinpif_u05 Sleef_sinpif8_u05avx
+#define ysinpif_u05 Sleef_cinz_sinpif8_u05avx
+#define xcospif_u05 Sleef_cospif8_u05avx
+#define ycospif_u05 Sleef_cinz_cospif8_u05avx
+#define xldexpf Sleef_ldexpf8_avx
+#define yldexpf Sleef_cinz_ldexpf8_avx
+#define xilogbf Sleef_ilogbf8_avx
+#define yilogbf Sleef_cinz_ilogbf8_avx
+#define xfmaf Sleef_fmaf8_avx
+#define yfmaf Sleef_cinz_fmaf8_avx
+#define xsqrtf Sleef_sqrtf8_avx
+#define ysqrtf Sleef_cinz_sqrtf8_avx
+#define xsqrtf_u05 Sleef_sqrtf8_u05avx
+#define ysqrtf_u05 Sleef_cinz_sqrtf8_u05avx
+#define xsqrtf_u35 Sleef_sqrtf8_u35avx
+#define ysqrtf_u35 Sleef_cinz_sqrtf8_u35avx
+#define xhypotf_u05 Sleef_hypotf8_u05avx
+#define yhypotf_u05 Sleef_cinz_hypotf8_u05avx
+#define xhypotf_u35 Sleef_hypotf8_u35avx
+#define yhypotf_u35 Sleef_cinz_hypotf8_u35avx
+#define xfabsf Sleef_fabsf8_avx
+#define yfabsf Sleef_cinz_fabsf8_avx
+#define xcopysignf Sleef_copysignf8_avx
+#define ycopysignf Sleef_cinz_copysignf8_avx
+#define xfmaxf Sleef_fmaxf8_avx
+#define yfmaxf Sleef_cinz_fmaxf8_avx
+#define xfminf Sleef_fminf8_avx
+#define yfminf Sleef_cinz_fminf8_avx
+#define xfdimf Sleef_fdimf8_avx
+#define yfdimf Sleef_cinz_fdimf8_avx
+#define xtruncf Sleef_truncf8_avx
+#define ytruncf Sleef_cinz_truncf8_avx
+#define xfloorf Sleef_floorf8_avx
+#define yfloorf Sleef_cinz_floorf8_avx
+#define xceilf Sleef_ceilf8_avx
+#define yceilf Sleef_cinz_ceilf8_avx
+#define xroundf Sleef_roundf8_avx
+#define yroundf Sleef_cinz_roundf8_avx
+#define xrintf Sleef_rintf8_avx
+#define yrintf Sleef_cinz_rintf8_avx
+#define xnextafterf Sleef_nextafterf8_avx
+#define ynextafterf Sleef_cinz_nextafterf8_avx
+#define xfrfrexpf Sleef_frfrexpf8_avx
+#define yfrfrexpf Sleef_cinz_frfrexpf8_avx
+#define xexpfrexpf Sleef_expfrexpf8_avx
+#define yexpfrexpf Sleef_cinz_expfrexpf8_avx
+#define xfmodf Sleef_fmodf8_avx
+#define yfmodf Sleef_cinz_fmodf8_avx
+#define xremainderf Sleef_remainderf8_avx
+#define yremainderf Sleef_cinz_remainderf8_avx
+#define xmodff Sleef_modff8_avx
+#define ymodff Sleef_cinz_modff8_avx
+#define xlgammaf_u1 Sleef_lgammaf8_u10avx
+#define ylgammaf_u1 Sleef_cinz_lgammaf8_u10avx
+#define xtgammaf_u1 Sleef_tgammaf8_u10avx
+#define ytgammaf_u1 Sleef_cinz_tgammaf8_u10avx
+#define xerff_u1 Sleef_erff8_u10avx
+#define yerff_u1 Sleef_cinz_erff8_u10avx
+#define xerfcf_u15 Sleef_erfcf8_u15avx
+#define yerfcf_u15 Sleef_cinz_erfcf8_u15avx
+#define xsigmoidf Sleef_sigmoidf8_u10avx
+#define ysigmoidf Sleef_cinz_sigmoidf8_u10avx
+#define xsigmoidf_u35 Sleef_sigmoidf8_u35avx
+#define ysigmoidf_u35 Sleef_cinz_sigmoidf8_u35avx
+#define xsoftplusf Sleef_softplusf8_u10avx
+#define ysoftplusf Sleef_cinz_softplusf8_u10avx
+#define xsoftplusf_u35 Sleef_softplusf8_u35avx
+#define ysoftplusf_u35 Sleef_cinz_softplusf8_u35avx
+#define xsiluf Sleef_siluf8_u10avx
+#define ysiluf Sleef_cinz_siluf8_u10avx
+#define xsiluf_u35 Sleef_siluf8_u35avx
+#define ysiluf_u35 Sleef_cinz_siluf8_u35avx
+#define xgelutanhf Sleef_gelutanhf8_u10avx
+#define ygelutanhf Sleef_cinz_gelutanhf8_u10avx
+#define xgelutanhf_u35 Sleef_gelutanhf8_u35avx
+#define ygelutanhf_u35 Sleef_cinz_gelutanhf8_u35avx
+#define xgeluf_u15 Sleef_geluf8_u15avx
+#define ygeluf_u15 Sleef_cinz_geluf8_u15avx
+#define xgetIntf Sleef_getIntf8_avx
+#define ygetIntf Sleef_cinz_getIntf8_avx
+#define xgetPtrf Sleef_getPtrf8_avx
+#define ygetPtrf Sleef_cinz_getPtrf8_avx
+
+#define xsinf16_u1 Sleef_sinh8_u10avx
+#define xcosf16_u1 Sleef_cosh8_u10avx
+#define xtanf16_u1 Sleef_tanh8_u10avx
+#define xasinf16_u1 Sleef_asinh8_u10avx
+#define xacosf16_u1 Sleef_acosh8_u10avx
+#define xatanf16_u1 Sleef_atanh8_u10avx
+#define xatan2f16_u1 Sleef_atan2h8_u10avx
+#define xlogf16_u1 Sleef_logh8_u10avx
+#define xcbrtf16_u1 Sleef_cbrth8_u10avx
+#define xexpf16 Sleef_exph8_u10avx
+#define xpowf16 Sleef_powh8_u10avx
+#define xsinhf16 Sleef_sinhh8_u10avx
+#define xcoshf16 Sleef_coshh8_u10avx
+#define xtanhf16 Sleef_tanhh8_u10avx
+#define xasinhf16 Sleef_asinhh8_u10avx
+#define xacoshf16 Sleef_acoshh8_u10avx
+#define xatanhf16 Sleef_atanhh8_u10avx
+#define xexp2f16 Sleef_exp2h8_u10avx
+#define xexp10f16 Sleef_exp10h8_u10avx
+#define xexpm1f16 Sleef_expm1h8_u10avx
+#define xlog10f16 Sleef_log10h8_u10avx
+#define xlog2f16 Sleef_log2h8_u10avx
+#define xlog1pf16 Sleef_log1ph8_u10avx
+#define xsqrtf16 Sleef_sqrth8_avx
+#define xlgammaf16_u1 Sleef_lgammah8_u10avx
+#define xtgammaf16_u1 Sleef_tgammah8_u10avx
+#define xerff16_u1 Sleef_erfh8_u10avx
+#define xerfcf16_u15 Sleef_erfch8_u15avx
+#define xsigmoidf16 Sleef_sigmoidh8_u10avx
+#define xsoftplusf16 Sleef_softplush8_u10avx
+#define xsiluf16 Sleef_siluh8_u10avx
+#define xgelutanhf16 Sleef_gelutanhh8_u10avx
+#define xgeluf16_u15 Sleef_geluh8_u15avx
+
+#define xsinbf16_u1 Sleef_sinbf16x8_u10avx
+#define xcosbf16_u1 Sleef_cosbf16x8_u10avx
+#define xlogbf16_u1 Sleef_logbf16x8_u10avx
+#define xexpbf16 Sleef_expbf16x8_u10avx
+#define xpowbf16 Sleef_powbf16x8_u10avx
+#define xtanhbf16 Sleef_tanhbf16x8_u10avx
+#define xexp2bf16 Sleef_exp2bf16x8_u10avx
+#define xexp10bf16 Sleef_exp10bf16x8_u10avx
+#define xexpm1bf16 Sleef_expm1bf16x8_u10avx
+#define xlog10bf16 Sleef_log10bf16x8_u10avx
+#define xlog2bf16 Sleef_log2bf16x8_u10avx
+#define xlog1pbf16 Sleef_log1pbf16x8_u10avx
+#define xsqrtbf16 Sleef_sqrtbf16x8_avx
+#define xerfbf16_u1 Sleef_erfbf16x8_u10avx
+#define xerfcbf16_u15 Sleef_erfcbf16x8_u15avx
+#define xsigmoidbf16 Sleef_sigmoidbf16x8_u10avx
+#define xsoftplusbf16 Sleef_softplusbf16x8_u10avx
+#define xsilubf16 Sleef_silubf16x8_u10avx
+#define xgelutanhbf16 Sleef_gelutanhbf16x8_u10avx
+#define xgelubf16_u15 Sleef_gelubf16x8_u15avx
+
+#else //#ifndef DETERMINISTIC
+
+#define xsin Sleef_cinz_sind4_u35avx
+#define xcos Sleef_cinz_cosd4_u35avx
+#define xsincos Sleef_cinz_sincosd4_u35avx
+#define xtan Sleef_cinz_tand4_u35avx
+#define xasin Sleef_cinz_asind4_u35avx
+#define xacos Sleef_cinz_acosd4_u35avx
+#define xatan Sleef_cinz_atand4_u35avx
+#define xatan2 Sleef_cinz_atan2d4_u35avx
+#define xlog Sleef_cinz_logd4_u35avx
+#define xcbrt Sleef_cinz_cbrtd4_u35avx
+#define xsin_u1 Sleef_cinz_sind4_u10avx
+#define xcos_u1 Sleef_cinz_cosd4_u10avx
+#define xsincos_u1 Sleef_cinz_sincosd4_u10avx
+#define xtan_u1 Sleef_cinz_tand4_u10avx
+#define xasin_u1 Sleef_cinz_asind4_u10avx
+#define xacos_u1 Sleef_cinz_acosd4_u10avx
+#define xatan_u1 Sleef_cinz_atand4_u10avx
+#define xatan2_u1 Sleef_cinz_atan2d4_u10avx
+#define xlog_u1 Sleef_cinz_logd4_u10avx
+#define xcbrt_u1 Sleef_cinz_cbrtd4_u10avx
+#define xexp Sleef_cinz_expd4_u10avx
+#define xpow Sleef_cinz_powd4_u10avx
+#define xsinh Sleef_cinz_sinhd4_u10avx
+#define xcosh Sleef_cinz_coshd4_u10avx
+#define xtanh Sleef_cinz_tanhd4_u10avx
+#define xsinh_u35 Sleef_cinz_sinhd4_u35avx
+#define xcosh_u35 Sleef_cinz_coshd4_u35avx
+#define xtanh_u35 Sleef_cinz_tanhd4_u35avx
+#define xfastsin_u3500 Sleef_cinz_fastsind4_u3500avx
+#define xfastcos_u3500 Sleef_cinz_fastcosd4_u3500avx
+#define xfastpow_u3500 Sleef_cinz_fastpowd4_u3500avx
+#define xfastexp_u3500 Sleef_cinz_fastexpd4_u3500avx
+#define xfastexp2_u3500 Sleef_cinz_fastexp2d4_u3500avx
+#define xfastlog_u3500 Sleef_cinz_fastlogd4_u3500avx
+#define xfastlog2_u3500 Sleef_cinz_fastlog2d4_u3500avx
+#define xfasttanh_u3500 Sleef_cinz_fasttanhd4_u3500avx
+#define xfastatan2_u3500 Sleef_cinz_fastatan2d4_u3500avx
+#define xfastrsqrt_u3500 Sleef_cinz_fastrsqrtd4_u3500avx
+#define xfastrcp_u3500 Sleef_cinz_fastrcpd4_u3500avx
+#define xsinr_u35 Sleef_cinz_sinrd4_u35avx
+#define xcosr_u35 Sleef_cinz_cosrd4_u35avx
+#define xsincosr_u35 Sleef_cinz_sincosrd4_u35avx
+#define xtanr_u35 Sleef_cinz_tanrd4_u35avx
+#define xasinh Sleef_cinz_asinhd4_u10avx
+#define xacosh Sleef_cinz_acoshd4_u10avx
+#define xatanh Sleef_cinz_atanhd4_u10avx
+#define xexp2 Sleef_cinz_exp2d4_u10avx
+#define xexp2_u35 Sleef_cinz_exp2d4_u35avx
+#define xexp10 Sleef_cinz_exp10d4_u10avx
+#define xexp10_u35 Sleef_cinz_exp10d4_u35avx
+#define xexpm1 Sleef_cinz_expm1d4_u10avx
+#define xlog10 Sleef_cinz_log10d4_u10avx
+#define xlog2 Sleef_cinz_log2d4_u10avx
+#define xlog2_u35 Sleef_cinz_log2d4_u35avx
+#define xlog1p Sleef_cinz_log1pd4_u10avx
+#define xsincospi_u05 Sleef_cinz_sincospid4_u05avx
+#define xsincospi_u35 Sleef_cinz_sincospid4_u35avx
+#define xsinpi_u05 Sleef_cinz_sinpid4_u05avx
+#define xcospi_u05 Sleef_cinz_cospid4_u05avx
+#define xldexp Sleef_cinz_ldexpd4_avx
+#define xilogb Sleef_cinz_ilogbd4_avx
+#define xfma Sleef_cinz_fmad4_avx
+#define xsqrt Sleef_cinz_sqrtd4_avx
+#define xsqrt_u05 Sleef_cinz_sqrtd4_u05avx
+#define xsqrt_u35 Sleef_cinz_sqrtd4_u35avx
+#define xhypot_u05 Sleef_cinz_hypotd4_u05avx
+#define xhypot_u35 Sleef_cinz_hypotd4_u35avx
+#define xfabs Sleef_cinz_fabsd4_avx
+#define xcopysign Sleef_cinz_copysignd4_avx
+#define xfmax Sleef_cinz_fmaxd4_avx
+#define xfmin Sleef_cinz_fmind4_avx
+#define xfdim Sleef_cinz_fdimd4_avx
+#define xtrunc Sleef_cinz_truncd4_avx
+#define xfloor Sleef_cinz_floord4_avx
+#define xceil Sleef_cinz_ceild4_avx
+#define xround Sleef_cinz_roundd4_avx
+#define xrint Sleef_cinz_rintd4_avx
+#define xnextafter Sleef_cinz_nextafterd4_avx
+#define xfrfrexp Sleef_cinz_frfrexpd4_avx
+#define xexpfrexp Sleef_cinz_expfrexpd4_avx
+#define xfmod Sleef_cinz_fmodd4_avx
+#define xremainder Sleef_cinz_remainderd4_avx
+#define xmodf Sleef_cinz_modfd4_avx
+#define xlgamma_u1 Sleef_cinz_lgammad4_u10avx
+#define xtgamma_u1 Sleef_cinz_tgammad4_u10avx
+#define xerf_u1 Sleef_cinz_erfd4_u10avx
+#define xerfc_u15 Sleef_cinz_erfcd4_u15avx
+#define xsigmoid Sleef_cinz_sigmoidd4_u10avx
+#define xsigmoid_u35 Sleef_cinz_sigmoidd4_u35avx
+#define xsoftplus Sleef_cinz_softplusd4_u10avx
+#define xsoftplus_u35 Sleef_cinz_softplusd4_u35avx
+#define xsilu Sleef_cinz_silud4_u10avx
+#define xsilu_u35 Sleef_cinz_silud4_u35avx
+#define xgelutanh Sleef_cinz_gelutanhd4_u10avx
+#define xgelutanh_u35 Sleef_cinz_gelutanhd4_u35avx
+#define xgelu_u15 Sleef_cinz_gelud4_u15avx
+#define xgetInt Sleef_cinz_getIntd4_avx
+#define xgetPtr Sleef_cinz_getPtrd4_avx
+
+#define xsinf Sleef_cinz_sinf8_u35avx
+#define xcosf Sleef_cinz_cosf8_u35avx
+#define xsincosf Sleef_cinz_sincosf8_u35avx
+#define xtanf Sleef_cinz_tanf8_u35avx
+#define xasinf Sleef_cinz_asinf8_u35avx
+#define xacosf Sleef_cinz_acosf8_u35avx
+#define xatanf Sleef_cinz_atanf8_u35avx
+#define xatan2f Sleef_cinz_atan2f8_u35avx
+#define xlogf Sleef_cinz_logf8_u35avx
+#define xcbrtf Sleef_cinz_cbrtf8_u35avx
+#define xsinf_u1 Sleef_cinz_sinf8_u10avx
+#define xcosf_u1 Sleef_cinz_cosf8_u10avx
+#define xsincosf_u1 Sleef_cinz_sincosf8_u10avx
+#define xtanf_u1 Sleef_cinz_tanf8_u10avx
+#define xasinf_u1 Sleef_cinz_asinf8_u10avx
+#define xacosf_u1 Sleef_cinz_acosf8_u10avx
+#define xatanf_u1 Sleef_cinz_atanf8_u10avx
+#define xatan2f_u1 Sleef_cinz_atan2f8_u10avx
+#define xlogf_u1 Sleef_cinz_logf8_u10avx
+#define xcbrtf_u1 Sleef_cinz_cbrtf8_u10avx
+#define xexpf Sleef_cinz_expf8_u10avx
+#define xpowf Sleef_cinz_powf8_u10avx
+#define xsinhf Sleef_cinz_sinhf8_u10avx
+#define xcoshf Sleef_cinz_coshf8_u10avx
+#define xtanhf Sleef_cinz_tanhf8_u10avx
+#define xsinhf_u35 Sleef_cinz_sinhf8_u35avx
+#define xcoshf_u35 Sleef_cinz_coshf8_u35avx
+#define xtanhf_u35 Sleef_cinz_tanhf8_u35avx
+#define xfastsinf_u3500 Sleef_cinz_fastsinf8_u3500avx
+#define xfastcosf_u3500 Sleef_cinz_fastcosf8_u3500avx
+#define xfastpowf_u3500 Sleef_cinz_fastpowf8_u3500avx
+#define xfastexpf_u3500 Sleef_cinz_fastexpf8_u3500avx
+#define xfastexp2f_u3500 Sleef_cinz_fastexp2f8_u3500avx
+#define xfastlogf_u3500 Sleef_cinz_fastlogf8_u3500avx
+#define xfastlog2f_u3500 Sleef_cinz_fastlog2f8_u3500avx
+#define xfasttanhf_u3500 Sleef_cinz_fasttanhf8_u3500avx
+#define xfastatan2f_u3500 Sleef_cinz_fastatan2f8_u3500avx
+#define xfastrsqrtf_u3500 Sleef_cinz_fastrsqrtf8_u3500avx
+#define xfastrcpf_u3500 Sleef_cinz_fastrcpf8_u3500avx
+#define xsinrf_u35 Sleef_cinz_sinrf8_u35avx
+#define xcosrf_u35 Sleef_cinz_cosrf8_u35avx
+#define xsincosrf_u35 Sleef_cinz_sincosrf8_u35avx
+#define xtanrf_u35 Sleef_cinz_tanrf8_u35avx
+#define xasinhf Sleef_cinz_asinhf8_u10avx
+#define xacoshf Sleef_cinz_acoshf8_u10avx
+#define xatanhf Sleef_cinz_atanhf8_u10avx
+#define xexp2f Sleef_cinz_exp2f8_u10avx
+#define xexp2f_u35 Sleef_cinz_exp2f8_u35avx
+#define xexp10f Sleef_cinz_exp10f8_u10avx
+#define xexp10f_u35 Sleef_cinz_exp10f8_u35avx
+#define xexpm1f Sleef_cinz_expm1f8_u10avx
+#define xlog10f Sleef_cinz_log10f8_u10avx
+#define xlog2f Sleef_cinz_log2f8_u10avx
+#define xlog2f_u35 Sleef_cinz_log2f8_u35avx
+#define xlog1pf Sleef_cinz_log1pf8_u10avx
+#define xsincospif_u05 Sleef_cinz_sincospif8_u05avx
+#define xsincospif_u35 Sleef_cinz_sincospif8_u35avx
+#define xsinpif_u05 Sleef_cinz_sinpif8_u05avx
+#define xcospif_u05 Sleef_cinz_cospif8_u05avx
+#define xldexpf Sleef_cinz_ldexpf8_avx
+#define xilogbf Sleef_cinz_ilogbf8_avx
+#define xfmaf Sleef_cinz_fmaf8_avx
+#define xsqrtf Sleef_cinz_sqrtf8_avx
+#define xsqrtf_u05 Sleef_cinz_sqrtf8_u05avx
+#define xsqrtf_u35 Sleef_cinz_sqrtf8_u35avx
+#define xhypotf_u05 Sleef_cinz_hypotf8_u05avx
+#define xhypotf_u35 Sleef_cinz_hypotf8_u35avx
+#define xfabsf Sleef_cinz_fabsf8_avx
+#define xcopysignf Sleef_cinz_copysignf8_avx
+#define xfmaxf Sleef_cinz_fmaxf8_avx
+#define xfminf Sleef_cinz_fminf8_avx
+#define xfdimf Sleef_cinz_fdimf8_avx
+#define xtruncf Sleef_cinz_truncf8_avx
+#define xfloorf Sleef_cinz_floorf8_avx
+#define xceilf Sleef_cinz_ceilf8_avx
+#define xroundf Sleef_cinz_roundf8_avx
+#define xrintf Sleef_cinz_rintf8_avx
+#define xnextafterf Sleef_cinz_nextafterf8_avx
+#define xfrfrexpf Sleef_cinz_frfrexpf8_avx
+#define xexpfrexpf Sleef_cinz_expfrexpf8_avx
+#define xfmodf Sleef_cinz_fmodf8_avx
+#define xremainderf Sleef_cinz_remainderf8_avx
+#define xmodff Sleef_cinz_modff8_avx
+#define xlgammaf_u1 Sleef_cinz_lgammaf8_u10avx
+#define xtgammaf_u1 Sleef_cinz_tgammaf8_u10avx
+#define xerff_u1 Sleef_cinz_erff8_u10avx
+#define xerfcf_u15 Sleef_cinz_erfcf8_u15avx
+#define xsigmoidf Sleef_cinz_sigmoidf8_u10avx
+#define xsigmoidf_u35 Sleef_cinz_sigmoidf8_u35avx
+#define xsoftplusf Sleef_cinz_softplusf8_u10avx
+#define xsoftplusf_u35 Sleef_cinz_softplusf8_u35avx
+#define xsiluf Sleef_cinz_siluf8_u10avx
+#define xsiluf_u35 Sleef_cinz_siluf8_u35avx
+#define xgelutanhf Sleef_cinz_gelutanhf8_u10avx
+#define xgelutanhf_u35 Sleef_cinz_gelutanhf8_u35avx
+#define xgeluf_u15 Sleef_cinz_geluf8_u15avx
+#define xgetIntf Sleef_cinz_getIntf8_avx
+#define xgetPtrf Sleef_cinz_getPtrf8_avx
+
+#endif // #ifndef DETERMINISTIC
@@ -0,0 +1,652 @@
+#ifndef DETERMINISTIC
+
+#define xsin Sleef_sind2_u35avx2128
+#define ysin Sleef_finz_sind2_u35avx2128
+#define xcos Sleef_cosd2_u35avx2128
+#define ycos Sleef_finz_cosd2_u35avx2128
+#define xsincos Sleef_sincosd2_u35avx2128
+#define ysincos Sleef_finz_sincosd2_u35avx2128
+#define xtan Sleef_tand2_u35avx2128
+#define ytan Sleef_finz_tand2_u35avx2128
+#define xasin Sleef_asind2_u35avx2128
+#define yasin Sleef_finz_asind2_u35avx2128
+#define xacos Sleef_acosd2_u35avx2128
+#define yacos Sleef_finz_acosd2_u35avx2128
+#define xatan Sleef_atand2_u35avx2128
+#define yatan Sleef_finz_atand2_u35avx2128
+#define xatan2 Sleef_atan2d2_u35avx2128
+#define yatan2 Sleef_finz_atan2d2_u35avx2128
+#define xlog Sleef_logd2_u35avx2128
+#define ylog Sleef_finz_logd2_u35avx2128
+#define xcbrt Sleef_cbrtd2_u35avx2128
+#define ycbrt Sleef_finz_cbrtd2_u35avx2128
+#define xsin_u1 Sleef_sind2_u10avx2128
+#define ysin_u1 Sleef_finz_sind2_u10avx2128
+#define xcos_u1 Sleef_cosd2_u10avx2128
+#define ycos_u1 Sleef_finz_cosd2_u10avx2128
+#define xsincos_u1 Sleef_sincosd2_u10avx2128
+#define ysincos_u1 Sleef_finz_sincosd2_u10avx2128
+#define xtan_u1 Sleef_tand2_u10avx2128
+#define ytan_u1 Sleef_finz_tand2_u10avx2128
+#define xasin_u1 Sleef_asind2_u10avx2128
+#define yasin_u1 Sleef_finz_asind2_u10avx2128
+#define xacos_u1 Sleef_acosd2_u10avx2128
+#define yacos_u1 Sleef_finz_acosd2_u10avx2128
+#define xatan_u1 Sleef_atand2_u10avx2128
+#define yatan_u1 Sleef_finz_atand2_u10avx2128
+#define xatan2_u1 Sleef_atan2d2_u10avx2128
+#define yatan2_u1 Sleef_finz_atan2d2_u10avx2128
+#define xlog_u1 Sleef_logd2_u10avx2128
+#define ylog_u1 Sleef_finz_logd2_u10avx2128
+#define xcbrt_u1 Sleef_cbrtd2_u10avx2128
+#define ycbrt_u1 Sleef_finz_cbrtd2_u10avx2128
+#define xexp Sleef_expd2_u10avx2128
+#define yexp Sleef_finz_expd2_u10avx2128
+#define xpow Sleef_powd2_u10avx2128
+#define ypow Sleef_finz_powd2_u10avx2128
+#define xsinh Sleef_sinhd2_u10avx2128
+#define ysinh Sleef_finz_sinhd2_u10avx2128
+#define xcosh Sleef_coshd2_u10avx2128
+#define ycosh Sleef_finz_coshd2_u10avx2128
+#define xtanh Sleef_tanhd2_u10avx2128
+#define ytanh Sleef_finz_tanhd2_u10avx2128
+#define xsinh_u35 Sleef_sinhd2_u35avx2128
+#define ysinh_u35 Sleef_finz_sinhd2_u35avx2128
+#define xcosh_u35 Sleef_coshd2_u35avx2128
+#define ycosh_u35 Sleef_finz_coshd2_u35avx2128
+#define xtanh_u35 Sleef_tanhd2_u35avx2128
+#define ytanh_u35 Sleef_finz_tanhd2_u35avx2128
+#define xfastsin_u3500 Sleef_fastsind2_u3500avx2128
+#define yfastsin_u3500 Sleef_finz_fastsind2_u3500avx2128
+#define xfastcos_u3500 Sleef_fastcosd2_u3500avx2128
+#define yfastcos_u3500 Sleef_finz_fastcosd2_u3500avx2128
+#define xfastpow_u3500 Sleef_fastpowd2_u3500avx2128
+#define yfastpow_u3500 Sleef_finz_fastpowd2_u3500avx2128
+#define xfastexp_u3500 Sleef_fastexpd2_u3500avx2128
+#define yfastexp_u3500 Sleef_finz_fastexpd2_u3500avx2128
+#define xfastexp2_u3500 Sleef_fastexp2d2_u3500avx2128
+#define yfastexp2_u3500 Sleef_finz_fastexp2d2_u3500avx2128
+#define xfastlog_u3500 Sleef_fastlogd2_u3500avx2128
+#define yfastlog_u3500 Sleef_finz_fastlogd2_u3500avx2128
+#define xfastlog2_u3500 Sleef_fastlog2d2_u3500avx2128
+#define yfastlog2_u3500 Sleef_finz_fastlog2d2_u3500avx2128
+#define xfasttanh_u3500 Sleef_fasttanhd2_u3500avx2128
+#define yfasttanh_u3500 Sleef_finz_fasttanhd2_u3500avx2128
+#define xfastatan2_u3500 Sleef_fastatan2d2_u3500avx2128
+#define yfastatan2_u3500 Sleef_finz_fastatan2d2_u3500avx2128
+#define xfastrsqrt_u3500 Sleef_fastrsqrtd2_u3500avx2128
+#define yfastrsqrt_u3500 Sleef_finz_fastrsqrtd2_u3500avx2128
+#define xfastrcp_u3500 Sleef_fastrcpd2_u3500avx2128
+#define yfastrcp_u3500 Sleef_finz_fastrcpd2_u3500avx2128
+#define xsinr_u35 Sleef_sinrd2_u35avx2128
+#define ysinr_u35 Sleef_finz_sinrd2_u35avx2128
+#define xcosr_u35 Sleef_cosrd2_u35avx2128
+#define ycosr_u35 Sleef_finz_cosrd2_u35avx2128
+#define xsincosr_u35 Sleef_sincosrd2_u35avx2128
+#define ysincosr_u35 Sleef_finz_sincosrd2_u35avx2128
+#define xtanr_u35 Sleef_tanrd2_u35avx2128
+#define ytanr_u35 Sleef_finz_tanrd2_u35avx2128
+#define xasinh Sleef_asinhd2_u10avx2128
+#define yasinh Sleef_finz_asinhd2_u10avx2128
+#define xacosh Sleef_acoshd2_u10avx2128
+#define yacosh Sleef_finz_acoshd2_u10avx2128
+#define xatanh Sleef_atanhd2_u10avx2128
+#define yatanh Sleef_finz_atanhd2_u10avx2128
+#define xexp2 Sleef_exp2d2_u10avx2128
+#define yexp2 Sleef_finz_exp2d2_u10avx2128
+#define xexp2_u35 Sleef_exp2d2_u35avx2128
+#define yexp2_u35 Sleef_finz_exp2d2_u35avx2128
+#define xexp10 Sleef_exp10d2_u10avx2128
+#define yexp10 Sleef_finz_exp10d2_u10avx2128
+#define xexp10_u35 Sleef_exp10d2_u35avx2128
+#define yexp10_u35 Sleef_finz_exp10d2_u35avx2128
+#define xexpm1 Sleef_expm1d2_u10avx2128
+#define yexpm1 Sleef_finz_expm1d2_u10avx2128
+#define xlog10 Sleef_log10d2_u10avx2128
+#define ylog10 Sleef_finz_log10d2_u10avx2128
+#define xlog2 Sleef_log2d2_u10avx2128
+#define ylog2 Sleef_finz_log2d2_u10avx2128
+#define xlog2_u35 Sleef_log2d2_u35avx2128
+#define ylog2_u35 Sleef_finz_log2d2_u35avx2128
+#define xlog1p Sleef_log1pd2_u10avx2128
+#define ylog1p Sleef_finz_log1pd2_u10avx2128
+#define xsincospi_u05 Sleef_sincospid2_u05avx2128
+#define ysincospi_u05 Sleef_finz_sincospid2_u05avx2128
+#define xsincospi_u35 Sleef_sincospid2_u35avx2128
+#define ysincospi_u35 Sleef_finz_sincospid2_u35avx2128
+#define xsinpi_u05 Sleef_sinpid2_u05avx2128
+#define ysinpi_u05 Sleef_finz_sinpid2_u05avx2128
+#define xcospi_u05 Sleef_cospid2_u05avx2128
+#define ycospi_u05 Sleef_finz_cospid2_u05avx2128
+#define xldexp Sleef_ldexpd2_avx2128
+#define yldexp Sleef_finz_ldexpd2_avx2128
+#define xilogb Sleef_ilogbd2_avx2128
+#define yilogb Sleef_finz_ilogbd2_avx2128
+#define xfma Sleef_fmad2_avx2128
+#define yfma Sleef_finz_fmad2_avx2128
+#define xsqrt Sleef_sqrtd2_avx2128
+#define ysqrt Sleef_finz_sqrtd2_avx2128
+#define xsqrt_u05 Sleef_sqrtd2_u05avx2128
+#define ysqrt_u05 Sleef_finz_sqrtd2_u05avx2128
+#define xsqrt_u35 Sleef_sqrtd2_u35avx2128
+#define ysqrt_u35 Sleef_finz_sqrtd2_u35avx2128
+#define xhypot_u05 Sleef_hypotd2_u05avx2128
+#define yhypot_u05 Sleef_finz_hypotd2_u05avx2128
+#define xhypot_u35 Sleef_hypotd2_u35avx2128
+#define yhypot_u35 Sleef_finz_hypotd2_u35avx2128
+#define xfabs Sleef_fabsd2_avx2128
+#define yfabs Sleef_finz_fabsd2_avx2128
+#define xcopysign Sleef_copysignd2_avx2128
+#define ycopysign Sleef_finz_copysignd2_avx2128
+#define xfmax Sleef_fmaxd2_avx2128
+#define yfmax Sleef_finz_fmaxd2_avx2128
+#define xfmin Sleef_fmind2_avx2128
+#define yfmin Sleef_finz_fmind2_avx2128
+#define xfdim Sleef_fdimd2_avx2128
+#define yfdim Sleef_finz_fdimd2_avx2128
+#define xtrunc Sleef_truncd2_avx2128
+#define ytrunc Sleef_finz_truncd2_avx2128
+#define xfloor Sleef_floord2_avx2128
+#define yfloor Sleef_finz_floord2_avx2128
+#define xceil Sleef_ceild2_avx2128
+#define yceil Sleef_finz_ceild2_avx2128
+#define xround Sleef_roundd2_avx2128
+#define yround Sleef_finz_roundd2_avx2128
+#define xrint Sleef_rintd2_avx2128
+#define yrint Sleef_finz_rintd2_avx2128
+#define xnextafter Sleef_nextafterd2_avx2128
+#define ynextafter Sleef_finz_nextafterd2_avx2128
+#define xfrfrexp Sleef_frfrexpd2_avx2128
+#define yfrfrexp Sleef_finz_frfrexpd2_avx2128
+#define xexpfrexp Sleef_expfrexpd2_avx2128
+#define yexpfrexp Sleef_finz_expfrexpd2_avx2128
+#define xfmod Sleef_fmodd2_avx2128
+#define yfmod Sleef_finz_fmodd2_avx2128
+#define xremainder Sleef_remainderd2_avx2128
+#define yremainder Sleef_finz_remainderd2_avx2128
+#define xmodf Sleef_modfd2_avx2128
+#define ymodf Sleef_finz_modfd2_avx2128
+#define xlgamma_u1 Sleef_lgammad2_u10avx2128
+#define ylgamma_u1 Sleef_finz_lgammad2_u10avx2128
+#define xtgamma_u1 Sleef_tgammad2_u10avx2128
+#define ytgamma_u1 Sleef_finz_tgammad2_u10avx2128
+#define xerf_u1 Sleef_erfd2_u10avx2128
+#define yerf_u1 Sleef_finz_erfd2_u10avx2128
+#define xerfc_u15 Sleef_erfcd2_u15avx2128
+#define yerfc_u15 Sleef_finz_erfcd2_u15avx2128
+#define xsigmoid Sleef_sigmoidd2_u10avx2128
+#define ysigmoid Sleef_finz_sigmoidd2_u10avx2128
+#define xsigmoid_u35 Sleef_sigmoidd2_u35avx2128
+#define ysigmoid_u35 Sleef_finz_sigmoidd2_u35avx2128
+#define xsoftplus Sleef_softplusd2_u10avx2128
+#define ysoftplus Sleef_finz_softplusd2_u10avx2128
+#define xsoftplus_u35 Sleef_softplusd2_u35avx2128
+#define ysoftplus_u35 Sleef_finz_softplusd2_u35avx2128
+#define xsilu Sleef_silud2_u10avx2128
+#define ysilu Sleef_finz_silud2_u10avx2128
+#define xsilu_u35 Sleef_silud2_u35avx2128
+#define ysilu_u35 Sleef_finz_silud2_u35avx2128
+#define xgelutanh Sleef_gelutanhd2_u10avx2128
+#define ygelutanh Sleef_finz_gelutanhd2_u10avx2128
+#define xgelutanh_u35 Sleef_gelutanhd2_u35avx2128
+#define ygelutanh_u35 Sleef_finz_gelutanhd2_u35avx2128
+#define xgelu_u15 Sleef_gelud2_u15avx2128
+#define ygelu_u15 Sleef_finz_gelud2_u15avx2128
+#define xgetInt Sleef_getIntd2_avx2128
+#define ygetInt Sleef_finz_getIntd2_avx2128
+#define xgetPtr Sleef_getPtrd2_avx2128
+#define ygetPtr Sleef_finz_getPtrd2_avx2128
+
+#define xsinf Sleef_sinf4_u35avx2128
+#define ysinf Sleef_finz_sinf4_u35avx2128
+#define xcosf Sleef_cosf4_u35avx2128
+#define ycosf Sleef_finz_cosf4_u35avx2128
+#define xsincosf Sleef_sincosf4_u35avx2128
+#define ysincosf Sleef_finz_sincosf4_u35avx2128
+#define xtanf Sleef_tanf4_u35avx2128
+#define ytanf Sleef_finz_tanf4_u35avx2128
+#define xasinf Sleef_asinf4_u35avx2128
+#define yasinf Sleef_finz_asinf4_u35avx2128
+#define xacosf Sleef_acosf4_u35avx2128
+#define yacosf Sleef_finz_acosf4_u35avx2128
+#define xatanf Sleef_atanf4_u35avx2128
+#define yatanf Sleef_finz_atanf4_u35avx2128
+#define xatan2f Sleef_atan2f4_u35avx2128
+#define yatan2f Sleef_finz_atan2f4_u35avx2128
+#define xlogf Sleef_logf4_u35avx2128
+#define ylogf Sleef_finz_logf4_u35avx2128
+#define xcbrtf Sleef_cbrtf4_u35avx2128
+#define ycbrtf Sleef_finz_cbrtf4_u35avx2128
+#define xsinf_u1 Sleef_sinf4_u10avx2128
+#define ysinf_u1 Sleef_finz_sinf4_u10avx2128
+#define xcosf_u1 Sleef_cosf4_u10avx2128
+#define ycosf_u1 Sleef_finz_cosf4_u10avx2128
+#define xsincosf_u1 Sleef_sincosf4_u10avx2128
+#define ysincosf_u1 Sleef_finz_sincosf4_u10avx2128
+#define xtanf_u1 Sleef_tanf4_u10avx2128
+#define ytanf_u1 Sleef_finz_tanf4_u10avx2128
+#define xasinf_u1 Sleef_asinf4_u10avx2128
+#define yasinf_u1 Sleef_finz_asinf4_u10avx2128
+#define xacosf_u1 Sleef_acosf4_u10avx2128
+#define yacosf_u1 Sleef_finz_acosf4_u10avx2128
+#define xatanf_u1 Sleef_atanf4_u10avx2128
+#define yatanf_u1 Sleef_finz_atanf4_u10avx2128
+#define xatan2f_u1 Sleef_atan2f4_u10avx2128
+#define yatan2f_u1 Sleef_finz_atan2f4_u10avx2128
+#define xlogf_u1 Sleef_logf4_u10avx2128
+#define ylogf_u1 Sleef_finz_logf4_u10avx2128
+#define xcbrtf_u1 Sleef_cbrtf4_u10avx2128
+#define ycbrtf_u1 Sleef_finz_cbrtf4_u10avx2128
+#define xexpf Sleef_expf4_u10avx2128
+#define yexpf Sleef_finz_expf4_u10avx2128
+#define xpowf Sleef_powf4_u10avx2128
+#define ypowf Sleef_finz_powf4_u10avx2128
+#define xsinhf Sleef_sinhf4_u10avx2128
+#define ysinhf Sleef_finz_sinhf4_u10avx2128
+#define xcoshf Sleef_coshf4_u10avx2128
+#define ycoshf Sleef_finz_coshf4_u10avx2128
+#define xtanhf Sleef_tanhf4_u10avx2128
+#define ytanhf Sleef_finz_tanhf4_u10avx2128
+#define xsinhf_u35 Sleef_sinhf4_u35avx2128
+#define ysinhf_u35 Sleef_finz_sinhf4_u35avx2128
+#define xcoshf_u35 Sleef_coshf4_u35avx2128
+#define ycoshf_u35 Sleef_finz_coshf4_u35avx2128
+#define xtanhf_u35 Sleef_tanhf4_u35avx2128
+#define ytanhf_u35 Sleef_finz_tanhf4_u35avx2128
+#define xfastsinf_u3500 Sleef_fastsinf4_u3500avx2128
+#define yfastsinf_u3500 Sleef_finz_fastsinf4_u3500avx2128
+#define xfastcosf_u3500 Sleef_fastcosf4_u3500avx2128
+#define yfastcosf_u3500 Sleef_finz_fastcosf4_u3500avx2128
+#define xfastpowf_u3500 Sleef_fastpowf4_u3500avx2128
+#define yfastpowf_u3500 Sleef_finz_fastpowf4_u3500avx2128
+#define xfastexpf_u3500 Sleef_fastexpf4_u3500avx2128
+#define yfastexpf_u3500 Sleef_finz_fastexpf4_u3500avx2128
+#define xfastexp2f_u3500 Sleef_fastexp2f4_u3500avx2128
+#define yfastexp2f_u3500 Sleef_finz_fastexp2f4_u3500avx2128
+#define xfastlogf_u3500 Sleef_fastlogf4_u3500avx2128
+#define yfastlogf_u3500 Sleef_finz_fastlogf4_u3500avx2128
+#define xfastlog2f_u3500 Sleef_fastlog2f4_u3500avx2128
+#define yfastlog2f_u3500 Sleef_finz_fastlog2f4_u3500avx2128
+#define xfasttanhf_u3500 Sleef_fasttanhf4_u3500avx2128
+#define yfasttanhf_u3500 Sleef_finz_fasttanhf4_u3500avx2128
+#define xfastatan2f_u3500 Sleef_fastatan2f4_u3500avx2128
+#define yfastatan2f_u3500 Sleef_finz_fastatan2f4_u3500avx2128
+#define xfastrsqrtf_u3500 Sleef_fastrsqrtf4_u3500avx2128
+#define yfastrsqrtf_u3500 Sleef_finz_fastrsqrtf4_u3500avx2128
+#define xfastrcpf_u3500 Sleef_fastrcpf4_u3500avx2128
+#define yfastrcpf_u3500 Sleef_finz_fastrcpf4_u3500avx2128
+#define xsinrf_u35 Sleef_sinrf4_u35avx2128
+#define ysinrf_u35 Sleef_finz_sinrf4_u35avx2128
+#define xcosrf_u35 Sleef_cosrf4_u35avx2128
+#define ycosrf_u35 Sleef_finz_cosrf4_u35avx2128
+#define xsincosrf_u35 Sleef_sincosrf4_u35avx2128
+#define ysincosrf_u35 Sleef_finz_sincosrf4_u35avx2128
+#define xtanrf_u35 Sleef_tanrf4_u35avx2128
+#define ytanrf_u35 Sleef_finz_tanrf4_u35avx2128
+#define xasinhf Sleef_asinhf4_u10avx2128
+#define yasinhf Sleef_finz_asinhf4_u10avx2128
+#define xacoshf Sleef_acoshf4_u10avx2128
+#define yacoshf Sleef_finz_acoshf4_u10avx2128
+#define xatanhf Sleef_atanhf4_u10avx2128
+#define yatanhf Sleef_finz_atanhf4_u10avx2128
+#define xexp2f Sleef_exp2f4_u10avx2128
+#define yexp2f Sleef_finz_exp2f4_u10avx2128
+#define xexp2f_u35 Sleef_exp2f4_u35avx2128
+#define yexp2f_u35 Sleef_finz_exp2f4_u35avx2128
+#define xexp10f Sleef_exp10f4_u10avx2128
+#define yexp10f Sleef_finz_exp10f4_u10avx2128
+#define xexp10f_u35 Sleef_exp10f4_u35avx2128
+#define yexp10f_u35 Sleef_finz_exp10f4_u35avx2128
+#define xexpm1f Sleef_expm1f4_u10avx2128
+#define yexpm1f Sleef_finz_expm1f4_u10avx2128
+#define xlog10f Sleef_log10f4_u10avx2128
+#define ylog10f Sleef_finz_log10f4_u10avx2128
+#define xlog2f Sleef_log2f4_u10avx2128
+#define ylog2f Sleef_finz_log2f4_u10avx2128
+#define xlog2f_u35 Sleef_log2f4_u35avx2128
+#define ylog2f_u35 Sleef_finz_log2f4_u35avx2128
+#define xlog1pf Sleef_log1pf4_u10avx2128
+#define ylog1pf Sleef_finz_log1pf4_u10avx2128
+#define xsincospif_u05 Sleef_sincospif4_u05avx2128
+#define ysincospif_u05 Sleef_finz_sincospif4_u05avx2128
+#define xsincospif_u35 Sleef_sincospif4_u35avx2128
+#define ysincospif_u35 Sleef_finz_sincospif4_u35avx2128
+#define xsinpif_u05 Sleef_sinpif4_u05avx2128
+#define ysinpif_u05 Sleef_finz_sinpif4_u05avx2128
+#define xcospif_u05 Sleef_cospif4_u05avx2128
+#define ycospif_u05 Sleef_finz_cospif4_u05avx2128
+#define xldexpf Sleef_ldexpf4_avx2128
+#define yldexpf Sleef_finz_ldexpf4_avx2128
+#define xilogbf Sleef_ilogbf4_avx2128
+#define yilogbf Sleef_finz_ilogbf4_avx2128
+#define xfmaf Sleef_fmaf4_avx2128
+#define yfmaf Sleef_finz_fmaf4_avx2128
+#define xsqrtf Sleef_sqrtf4_avx2128
+#define ysqrtf Sleef_finz_sqrtf4_avx2128
+#define xsqrtf_u05 Sleef_sqrtf4_u05avx2128
+#define ysqrtf_u05 Sleef_finz_sqrtf4_u05avx2128
+#define xsqrtf_u35 Sleef_sqrtf4_u35avx2128
+#define ysqrtf_u35 Sleef_finz_sqrtf4_u35avx2128
+#define xhypotf_u05 Sleef_hypotf4_u05avx2128
+#define yhypotf_u05 Sleef_finz_hypotf4_u05avx2128
+#define xhypotf_u35 Sleef_hypotf4_u35avx2128
+#define yhypotf_u35 Sleef_finz_hypotf4_u35avx2128
+#define xfabsf Sleef_fabsf4_avx2128
+#define yfabsf Sleef_finz_fabsf4_avx2128
+#define xcopysignf Sleef_copysignf4_avx2128
+#define ycopysignf Sleef_finz_copysignf4_avx2128
+#define xfmaxf Sleef_fmaxf4_avx2128
+#define yfmaxf Sleef_finz_fmaxf4_avx2128
+#define xfminf Sleef_fminf4_avx2128
+#define yfminf Sleef_finz_fminf4_avx2128
+#define xfdimf Sleef_fdimf4_avx2128
+#define yfdimf Sleef_finz_fdimf4_avx2128
+#define xtruncf Sleef_truncf4_avx2128
+#define ytruncf Sleef_finz_truncf4_avx2128
+#define xfloorf Sleef_floorf4_avx2128
+#define yfloorf Sleef_finz_floorf4_avx2128
+#define xceilf Sleef_ceilf4_avx2128
+#define yceilf Sleef_finz_ceilf4_avx2128
+#define xroundf Sleef_roundf4_avx2128
+#define yroundf Sleef_finz_roundf4_avx2128
+#define xrintf Sleef_rintf4_avx2128
+#define yrintf Sleef_finz_rintf4_avx2128
+#define xnextafterf Sleef_nextafterf4_avx2128
+#define ynextafterf Sleef_finz_nextafterf4_avx2128
+#define xfrfrexpf Sleef_frfrexpf4_avx2128
+#define yfrfrexpf Sleef_finz_frfrexpf4_avx2128
+#define xexpfrexpf Sleef_expfrexpf4_avx2128
+#define yexpfrexpf Sleef_finz_expfrexpf4_avx2128
+#define xfmodf Sleef_fmodf4_avx2128
+#define yfmodf Sleef_finz_fmodf4_avx2128
+#define xremainderf Sleef_remainderf4_avx2128
+#define yremainderf Sleef_finz_remainderf4_avx2128
+#define xmodff Sleef_modff4_avx2128
+#define ymodff Sleef_finz_modff4_avx2128
+#define xlgammaf_u1 Sleef_lgammaf4_u10avx2128
+#define ylgammaf_u1 Sleef_finz_lgammaf4_u10avx2128
+#define xtgammaf_u1 Sleef_tgammaf4_u10avx2128
+#define ytgammaf_u1 Sleef_finz_tgammaf4_u10avx2128
+#define xerff_u1 Sleef_erff4_u10avx2128
+#define yerff_u1 Sleef_finz_erff4_u10avx2128
+#define xerfcf_u15 Sleef_erfcf4_u15avx2128
+#define yerfcf_u15 Sleef_finz_erfcf4_u15avx2128
+#define xsigmoidf Sleef_sigmoidf4_u10avx2128
+#define ysigmoidf Sleef_finz_sigmoidf4_u10avx2128
+#define xsigmoidf_u35 Sleef_sigmoidf4_u35avx2128
+#define ysigmoidf_u35 Sleef_finz_sigmoidf4_u35avx2128
+#define xsoftplusf Sleef_softplusf4_u10avx2128
+#define ysoftplusf Sleef_finz_softplusf4_u10avx2128
+#define xsoftplusf_u35 Sleef_softplusf4_u35avx2128
+#define ysoftplusf_u35 Sleef_finz_softplusf4_u35avx2128
+#define xsiluf Sleef_siluf4_u10avx2128
+#define ysiluf Sleef_finz_siluf4_u10avx2128
+#define xsiluf_u35 Sleef_siluf4_u35avx2128
+#define ysiluf_u35 Sleef_finz_siluf4_u35avx2128
+#define xgelutanhf Sleef_gelutanhf4_u10avx2128
+#define ygelutanhf Sleef_finz_gelutanhf4_u10avx2128
+#define xgelutanhf_u35 Sleef_gelutanhf4_u35avx2128
+#define ygelutanhf_u35 Sleef_finz_gelutanhf4_u35avx2128
+#define xgeluf_u15 Sleef_geluf4_u15avx2128
+#define ygeluf_u15 Sleef_finz_geluf4_u15avx2128
+#define xgetIntf Sleef_getIntf4_avx2128
+#define ygetIntf Sleef_finz_getIntf4_avx2128
+#define xgetPtrf Sleef_getPtrf4_avx2128
+#define ygetPtrf Sleef_finz_getPtrf4_avx2128
+
+#define xsinf16_u1 Sleef_sinh4_u10avx2128
+#define xcosf16_u1 Sleef_cosh4_u10avx2128
+#define xtanf16_u1 Sleef_tanh4_u10avx2128
+#define xasinf16_u1 Sleef_asinh4_u10avx2128
+#define xacosf16_u1 Sleef_acosh4_u10avx2128
+#define xatanf16_u1 Sleef_atanh4_u10avx2128
+#define xatan2f16_u1 Sleef_atan2h4_u10avx2128
+#define xlogf16_u1 Sleef_logh4_u10avx2128
+#define xcbrtf16_u1 Sleef_cbrth4_u10avx2128
+#define xexpf16 Sleef_exph4_u10avx2128
+#define xpowf16 Sleef_powh4_u10avx2128
+#define xsinhf16 Sleef_sinhh4_u10avx2128
+#define xcoshf16 Sleef_coshh4_u10avx2128
+#define xtanhf16 Sleef_tanhh4_u10avx2128
+#define xasinhf16 Sleef_asinhh4_u10avx2128
+#define xacoshf16 Sleef_acoshh4_u10avx2128
+#define xatanhf16 Sleef_atanhh4_u10avx2128
+#define xexp2f16 Sleef_exp2h4_u10avx2128
+#define xexp10f16 Sleef_exp10h4_u10avx2128
+#define xexpm1f16 Sleef_expm1h4_u10avx2128
+#define xlog10f16 Sleef_log10h4_u10avx2128
+#define xlog2f16 Sleef_log2h4_u10avx2128
+#define xlog1pf16 Sleef_log1ph4_u10avx2128
+#define xsqrtf16 Sleef_sqrth4_avx2128
+#define xlgammaf16_u1 Sleef_lgammah4_u10avx2128
+#define xtgammaf16_u1 Sleef_tgammah4_u10avx2128
+#define xerff16_u1 Sleef_erfh4_u10avx2128
+#define xerfcf16_u15 Sleef_erfch4_u15avx2128
+#define xsigmoidf16 Sleef_sigmoidh4_u10avx2128
+#define xsoftplusf16 Sleef_softplush4_u10avx2128
+#define xsiluf16 Sleef_siluh4_u10avx2128
+#define xgelutanhf16 Sleef_gelutanhh4_u10avx2128
+#define xgeluf16_u15 Sleef_geluh4_u15avx2128
+
+#define xsinbf16_u1 Sleef_sinbf16x4_u10avx2128
+#define xcosbf16_u1 Sleef_cosbf16x4_u10avx2128
+#define xlogbf16_u1 Sleef_logbf16x4_u10avx2128
+#define xexpbf16 Sleef_expbf16x4_u10avx2128
+#define xpowbf16 Sleef_powbf16x4_u10avx2128
+#define xtanhbf16 Sleef_tanhbf16x4_u10avx2128
+#define xexp2bf16 Sleef_exp2bf16x4_u10avx2128
+#define xexp10bf16 Sleef_exp10bf16x4_u10avx2128
+#define xexpm1bf16 Sleef_expm1bf16x4_u10avx2128
+#define xlog10bf16 Sleef_log10bf16x4_u10avx2128
+#define xlog2bf16 Sleef_log2bf16x4_u10avx2128
+#define xlog1pbf16 Sleef_log1pbf16x4_u10avx2128
+#define xsqrtbf16 Sleef_sqrtbf16x4_avx2128
+#define xerfbf16_u1 Sleef_erfbf16x4_u10avx2128
+#define xerfcbf16_u15 Sleef_erfcbf16x4_u15avx2128
+#define xsigmoidbf16 Sleef_sigmoidbf16x4_u10avx2128
+#define xsoftplusbf16 Sleef_softplusbf16x4_u10avx2128
+#define xsilubf16 Sleef_silubf16x4_u10avx2128
+#define xgelutanhbf16 Sleef_gelutanhbf16x4_u10avx2128
+#define xgelubf16_u15 Sleef_gelubf16x4_u15avx2128
+
+#else //#ifndef DETERMINISTIC
+
+#define xsin Sleef_finz_sind2_u35avx2128
+#define xcos Sleef_finz_cosd2_u35avx2128
+#define xsincos Sleef_finz_sincosd2_u35avx2128
+#define xtan Sleef_finz_tand2_u35avx2128
+#define xasin Sleef_finz_asind2_u35avx2128
+#define xacos Sleef_finz_acosd2_u35avx2128
+#define xatan Sleef_finz_atand2_u35avx2128
+#define xatan2 Sleef_finz_atan2d2_u35avx2128
+#define xlog Sleef_finz_logd2_u35avx2128
+#define xcbrt Sleef_finz_cbrtd2_u35avx2128
+#define xsin_u1 Sleef_finz_sind2_u10avx2128
+#define xcos_u1 Sleef_finz_cosd2_u10avx2128
+#define xsincos_u1 Sleef_finz_sincosd2_u10avx2128
+#define xtan_u1 Sleef_finz_tand2_u10avx2128
+#define xasin_u1 Sleef_finz_asind2_u10avx2128
+#define xacos_u1 Sleef_finz_acosd2_u10avx2128
+#define xatan_u1 Sleef_finz_atand2_u10avx2128
+#define xatan2_u1 Sleef_finz_atan2d2_u10avx2128
+#define xlog_u1 Sleef_finz_logd2_u10avx2128
+#define xcbrt_u1 Sleef_finz_cbrtd2_u10avx2128
+#define xexp Sleef_finz_expd2_u10avx2128
+#define xpow Sleef_finz_powd2_u10avx2128
+#define xsinh Sleef_finz_sinhd2_u10avx2128
+#define xcosh Sleef_finz_coshd2_u10avx2128
+#define xtanh Sleef_finz_tanhd2_u10avx2128
+#define xsinh_u35 Sleef_finz_sinhd2_u35avx2128
+#define xcosh_u35 Sleef_finz_coshd2_u35avx2128
+#define xtanh_u35 Sleef_finz_tanhd2_u35avx2128
+#define xfastsin_u3500 Sleef_finz_fastsind2_u3500avx2128
+#define xfastcos_u3500 Sleef_finz_fastcosd2_u3500avx2128
+#define xfastpow_u3500 Sleef_finz_fastpowd2_u3500avx2128
+#define xfastexp_u3500 Sleef_finz_fastexpd2_u3500avx2128
+#define xfastexp2_u3500 Sleef_finz_fastexp2d2_u3500avx2128
+#define xfastlog_u3500 Sleef_finz_fastlogd2_u3500avx2128
+#define xfastlog2_u3500 Sleef_finz_fastlog2d2_u3500avx2128
+#define xfasttanh_u3500 Sleef_finz_fasttanhd2_u3500avx2128
+#define xfastatan2_u3500 Sleef_finz_fastatan2d2_u3500avx2128
+#define xfastrsqrt_u3500 Sleef_finz_fastrsqrtd2_u3500avx2128
+#define xfastrcp_u3500 Sleef_finz_fastrcpd2_u3500avx2128
+#define xsinr_u35 Sleef_finz_sinrd2_u35avx2128
+#define xcosr_u35 Sleef_finz_cosrd2_u35avx2128
+#define xsincosr_u35 Sleef_finz_sincosrd2_u35avx2128
+#define xtanr_u35 Sleef_finz_tanrd2_u35avx2128
+#define xasinh Sleef_finz_asinhd2_u10avx2128
+#define xacosh Sleef_finz_acoshd2_u10avx2128
+#define xatanh Sleef_finz_atanhd2_u10avx2128
+#define xexp2 Sleef_finz_exp2d2_u10avx2128
+#define xexp2_u35 Sleef_finz_exp2d2_u35avx2128
+#define xexp10 Sleef_finz_exp10d2_u10avx2128
+#define xexp10_u35 Sleef_finz_exp10d2_u35avx2128
+#define xexpm1 Sleef_finz_expm1d2_u10avx2128
+#define xlog10 Sleef_finz_log10d2_u10avx2128
+#define xlog2 Sleef_finz_log2d2_u10avx2128
+#define xlog2_u35 Sleef_finz_log2d2_u35avx2128
+#define xlog1p Sleef_finz_log1pd2_u10avx2128
+#define xsincospi_u05 Sleef_finz_sincospid2_u05avx2128
+#define xsincospi_u35 Sleef_finz_sincospid2_u35avx2128
+#define xsinpi_u05 Sleef_finz_sinpid2_u05avx2128
+#define xcospi_u05 Sleef_finz_cospid2_u05avx2128
+#define xldexp Sleef_finz_ldexpd2_avx2128
+#define xilogb Sleef_finz_ilogbd2_avx2128
+#define xfma Sleef_finz_fmad2_avx2128
+#define xsqrt Sleef_finz_sqrtd2_avx2128
+#define xsqrt_u05 Sleef_finz_sqrtd2_u05avx2128
+#define xsqrt_u35 Sleef_finz_sqrtd2_u35avx2128
+#define xhypot_u05 Sleef_finz_hypotd2_u05avx2128
+#define xhypot_u35 Sleef_finz_hypotd2_u35avx2128
+#define xfabs Sleef_finz_fabsd2_avx2128
+#define xcopysign Sleef_finz_copysignd2_avx2128
+#define xfmax Sleef_finz_fmaxd2_avx2128
+#define xfmin Sleef_finz_fmind2_avx2128
+#define xfdim Sleef_finz_fdimd2_avx2128
+#define xtrunc Sleef_finz_truncd2_avx2128
+#define xfloor Sleef_finz_floord2_avx2128
+#define xceil Sleef_finz_ceild2_avx2128
+#define xround Sleef_finz_roundd2_avx2128
+#define xrint Sleef_finz_rintd2_avx2128
+#define xnextafter Sleef_finz_nextafterd2_avx2128
+#define xfrfrexp Sleef_finz_frfrexpd2_avx2128
+#define xexpfrexp Sleef_finz_expfrexpd2_avx2128
+#define xfmod Sleef_finz_fmodd2_avx2128
+#define xremainder Sleef_finz_remainderd2_avx2128
+#define xmodf Sleef_finz_modfd2_avx2128
+#define xlgamma_u1 Sleef_finz_lgammad2_u10avx2128
+#define xtgamma_u1 Sleef_finz_tgammad2_u10avx2128
+#define xerf_u1 Sleef_finz_erfd2_u10avx2128
+#define xerfc_u15 Sleef_finz_erfcd2_u15avx2128
+#define xsigmoid Sleef_finz_sigmoidd2_u10avx2128
+#define xsigmoid_u35 Sleef_finz_sigmoidd2_u35avx2128
+#define xsoftplus Sleef_finz_softplusd2_u10avx2128
+#define xsoftplus_u35 Sleef_finz_softplusd2_u35avx2128
+#define xsilu Sleef_finz_silud2_u10avx2128
+#define xsilu_u35 Sleef_finz_silud2_u35avx2128
+#define xgelutanh Sleef_finz_gelutanhd2_u10avx2128
+#define xgelutanh_u35 Sleef_finz_gelutanhd2_u35avx2128
+#define xgelu_u15 Sleef_finz_gelud2_u15avx2128
+#define xgetInt Sleef_finz_getIntd2_avx2128
+#define xgetPtr Sleef_finz_getPtrd2_avx2128
+
+#define xsinf Sleef_finz_sinf4_u35avx2128
+#define xcosf Sleef_finz_cosf4_u35avx2128
+#define xsincosf Sleef_finz_sincosf4_u35avx2128
+#define xtanf Sleef_finz_tanf4_u35avx2128
+#define xasinf Sleef_finz_asinf4_u35avx2128
+#define xacosf Sleef_finz_acosf4_u35avx2128
+#define xatanf Sleef_finz_atanf4_u35avx2128
+#define xatan2f Sleef_finz_atan2f4_u35avx2128
+#define xlogf Sleef_finz_logf4_u35avx2128
+#define xcbrtf Sleef_finz_cbrtf4_u35avx2128
+#define xsinf_u1 Sleef_finz_sinf4_u10avx2128
+#define xcosf_u1 Sleef_finz_cosf4_u10avx2128
+#define xsincosf_u1 Sleef_finz_sincosf4_u10avx2128
+#define xtanf_u1 Sleef_finz_tanf4_u10avx2128
+#define xasinf_u1 Sleef_finz_asinf4_u10avx2128
+#define xacosf_u1 Sleef_finz_acosf4_u10avx2128
+#define xatanf_u1 Sleef_finz_atanf4_u10avx2128
+#define xatan2f_u1 Sleef_finz_atan2f4_u10avx2128
+#define xlogf_u1 Sleef_finz_logf4_u10avx2128
+#define xcbrtf_u1 Sleef_finz_cbrtf4_u10avx2128
+#define xexpf Sleef_finz_expf4_u10avx2128
+#define xpowf Sleef_finz_powf4_u10avx2128
+#define xsinhf Sleef_finz_sinhf4_u10avx2128
+#define xcoshf Sleef_finz_coshf4_u10avx2128
+#define xtanhf Sleef_finz_tanhf4_u10avx2128
+#define xsinhf_u35 Sleef_finz_sinhf4_u35avx2128
+#define xcoshf_u35 Sleef_finz_coshf4_u35avx2128
+#define xtanhf_u35 Sleef_finz_tanhf4_u35avx2128
+#define xfastsinf_u3500 Sleef_finz_fastsinf4_u3500avx2128
+#define xfastcosf_u3500 Sleef_finz_fastcosf4_u3500avx2128
+#define xfastpowf_u3500 Sleef_finz_fastpowf4_u3500avx2128
+#define xfastexpf_u3500 Sleef_finz_fastexpf4_u3500avx2128
+#define xfastexp2f_u3500 Sleef_finz_fastexp2f4_u3500avx2128
+#define xfastlogf_u3500 Sleef_finz_fastlogf4_u3500avx2128
+#define xfastlog2f_u3500 Sleef_finz_fastlog2f4_u3500avx2128
+#define xfasttanhf_u3500 Sleef_finz_fasttanhf4_u3500avx2128
+#define xfastatan2f_u3500 Sleef_finz_fastatan2f4_u3500avx2128
+#define xfastrsqrtf_u3500 Sleef_finz_fastrsqrtf4_u3500avx2128
+#define xfastrcpf_u3500 Sleef_finz_fastrcpf4_u3500avx2128
+#define xsinrf_u35 Sleef_finz_sinrf4_u35avx2128
+#define xcosrf_u35 Sleef_finz_cosrf4_u35avx2128
+#define xsincosrf_u35 Sleef_finz_sincosrf4_u35avx2128
+#define xtanrf_u35 Sleef_finz_tanrf4_u35avx2128
+#define xasinhf Sleef_finz_asinhf4_u10avx2128
+#define xacoshf Sleef_finz_acoshf4_u10avx2128
+#define xatanhf Sleef_finz_atanhf4_u10avx2128
+#define xexp2f Sleef_finz_exp2f4_u10avx2128
+#define xexp2f_u35 Sleef_finz_exp2f4_u35avx2128
+#define xexp10f Sleef_finz_exp10f4_u10avx2128
+#define xexp10f_u35 Sleef_finz_exp10f4_u35avx2128
+#define xexpm1f Sleef_finz_expm1f4_u10avx2128
+#define xlog10f Sleef_finz_log10f4_u10avx2128
+#define xlog2f Sleef_finz_log2f4_u10avx2128
+#define xlog2f_u35 Sleef_finz_log2f4_u35avx2128
+#define xlog1pf Sleef_finz_log1pf4_u10avx2128
+#define xsincospif_u05 Sleef_finz_sincospif4_u05avx2128
+#define xsincospif_u35 Sleef_finz_sincospif4_u35avx2128
+#define xsinpif_u05 Sleef_finz_sinpif4_u05avx2128
+#define xcospif_u05 Sleef_finz_cospif4_u05avx2128
+#define xldexpf Sleef_finz_ldexpf4_avx2128
+#define xilogbf Sleef_finz_ilogbf4_avx2128
+#define xfmaf Sleef_finz_fmaf4_avx2128
+#define xsqrtf Sleef_finz_sqrtf4_avx2128
+#define xsqrtf_u05 Sleef_finz_sqrtf4_u05avx2128
+#define xsqrtf_u35 Sleef_finz_sqrtf4_u35avx2128
+#define xhypotf_u05 Sleef_finz_hypotf4_u05avx2128
+#define xhypotf_u35 Sleef_finz_hypotf4_u35avx2128
+#define xfabsf Sleef_finz_fabsf4_avx2128
+#define xcopysignf Sleef_finz_copysignf4_avx2128
+#define xfmaxf Sleef_finz_fmaxf4_avx2128
+#define xfminf Sleef_finz_fminf4_avx2128
+#define xfdimf Sleef_finz_fdimf4_avx2128
+#define xtruncf Sleef_finz_truncf4_avx2128
+#define xfloorf Sleef_finz_floorf4_avx2128
+#define xceilf Sleef_finz_ceilf4_avx2128
+#define xroundf Sleef_finz_roundf4_avx2128
+#define xrintf Sleef_finz_rintf4_avx2128
+#define xnextafterf Sleef_finz_nextafterf4_avx2128
+#define xfrfrexpf Sleef_finz_frfrexpf4_avx2128
+#define xexpfrexpf Sleef_finz_expfrexpf4_avx2128
+#define xfmodf Sleef_finz_fmodf4_avx2128
+#define xremainderf Sleef_finz_remainderf4_avx2128
+#define xmodff Sleef_finz_modff4_avx2128
+#define xlgammaf_u1 Sleef_finz_lgammaf4_u10avx2128
+#define xtgammaf_u1 Sleef_finz_tgammaf4_u10avx2128
+#define xerff_u1 Sleef_finz_erff4_u10avx2128
+#define xerfcf_u15 Sleef_finz_erfcf4_u15avx2128
+#define xsigmoidf Sleef_finz_sigmoidf4_u10avx2128
+#define xsigmoidf_u35 Sleef_finz_sigmoidf4_u35avx2128
+#define xsoftplusf Sleef_finz_softplusf4_u10avx2128
+#define xsoftplusf_u35 Sleef_finz_softplusf4_u35avx2128
+#define xsiluf Sleef_finz_siluf4_u10avx2128
+#define xsiluf_u35 Sleef_finz_siluf4_u35avx2128
+#define xgelutanhf Sleef_finz_gelutanhf4_u10avx2128
+#define xgelutanhf_u35 Sleef_finz_gelutanhf4_u35avx2128
+#define xgeluf_u15 Sleef_finz_geluf4_u15avx2128
+#define xgetIntf Sleef_finz_getIntf4_avx2128
+#define xgetPtrf Sleef_finz_getPtrf4_avx2128
+
+#endif // #ifndef DETERMINISTIC
@@ -0,0 +1,652 @@
+#ifndef DETERMINISTIC
+
+#define xsin Sleef_sind8_u35avx512f
+#define ysin Sleef_finz_sind8_u35avx512f
+#define xcos Sleef_cosd8_u35avx512f
+#define ycos Sleef_finz_cosd8_u35avx512f
+#define xsincos Sleef_sincosd8_u35avx512f
+#define ysincos Sleef_finz_sincosd8_u35avx512f
+#define xtan Sleef_tand8_u35avx512f
+#define ytan Sleef_finz_tand8_u35avx512f
+#define xasin Sleef_asind8_u35avx512f
+#define yasin Sleef_finz_asind8_u35avx512f
+#define xacos Sleef_acosd8_u35avx512f
+#define yacos Sleef_finz_acosd8_u35avx512f
+#define xatan Sleef_atand8_u35avx512f
+#define yatan Sleef_finz_atand8_u35avx512f
+#define xatan2 Sleef_atan2d8_u35avx512f
+#define yatan2 Sleef_finz_atan2d8_u35avx512f
+#define xlog Sleef_logd8_u35avx512f
+#define ylog Sleef_finz_logd8_u35avx512f
+#define xcbrt Sleef_cbrtd8_u35avx512f
+#define ycbrt Sleef_finz_cbrtd8_u35avx512f
+#define xsin_u1 Sleef_sind8_u10avx512f
+#define ysin_u1 Sleef_finz_sind8_u10avx512f
+#define xcos_u1 Sleef_cosd8_u10avx512f
+#define ycos_u1 Sleef_finz_cosd8_u10avx512f
+#define xsincos_u1 Sleef_sincosd8_u10avx512f
+#define ysincos_u1 Sleef_finz_sincosd8_u10avx512f
+#define xtan_u1 Sleef_tand8_u10avx512f
+#define ytan_u1 Sleef_finz_tand8_u10avx512f
+#define xasin_u1 Sleef_asind8_u10avx512f
+#define yasin_u1 Sleef_finz_asind8_u10avx512f
+#define xacos_u1 Sleef_acosd8_u10avx512f
+#define yacos_u1 Sleef_finz_acosd8_u10avx512f
+#define xatan_u1 Sleef_atand8_u10avx512f
+#define yatan_u1 Sleef_finz_atand8_u10avx512f
+#define xatan2_u1 Sleef_atan2d8_u10avx512f
+#define yatan2_u1 Sleef_finz_atan2d8_u10avx512f
+#define xlog_u1 Sleef_logd8_u10avx512f
+#define ylog_u1 Sleef_finz_logd8_u10avx512f
+#define xcbrt_u1 Sleef_cbrtd8_u10avx512f
+#define ycbrt_u1 Sleef_finz_cbrtd8_u10avx512f
+#define xexp Sleef_expd8_u10avx512f
+#define yexp Sleef_finz_expd8_u10avx512f
+#define xpow Sleef_powd8_u10avx512f
+#define ypow Sleef_finz_powd8_u10avx512f
+#define xsinh Sleef_sinhd8_u10avx512f
+#define ysinh Sleef_finz_sinhd8_u10avx512f
+#define xcosh Sleef_coshd8_u10avx512f
+#define ycosh Sleef_finz_coshd8_u10avx512f
+#define xtanh Sleef_tanhd8_u10avx512f
+#define ytanh Sleef_finz_tanhd8_u10avx512f
+#define xsinh_u35 Sleef_sinhd8_u35avx512f
+#define ysinh_u35 Sleef_finz_sinhd8_u35avx512f
+#define xcosh_u35 Sleef_coshd8_u35avx512f
+#define ycosh_u35 Sleef_finz_coshd8_u35avx512f
+#define xtanh_u35 Sleef_tanhd8_u35avx512f
+#define ytanh_u35 Sleef_finz_tanhd8_u35avx512f
+#define xfastsin_u3500 Sleef_fastsind8_u3500avx512f
+#define yfastsin_u3500 Sleef_finz_fastsind8_u3500avx512f
+#define xfastcos_u3500 Sleef_fastcosd8_u3500avx512f
+#define yfastcos_u3500 Sleef_finz_fastcosd8_u3500avx512f
+#define xfastpow_u3500 Sleef_fastpowd8_u3500avx512f
+#define yfastpow_u3500 Sleef_finz_fastpowd8_u3500avx512f
+#define xfastexp_u3500 Sleef_fastexpd8_u3500avx512f
+#define yfastexp_u3500 Sleef_finz_fastexpd8_u3500avx512f
+#define xfastexp2_u3500 Sleef_fastexp2d8_u3500avx512f
+#define yfastexp2_u3500 Sleef_finz_fastexp2d8_u3500avx512f
+#define xfastlog_u3500 Sleef_fastlogd8_u3500avx512f
+#define yfastlog_u3500 Sleef_finz_fastlogd8_u3500avx512f
+#define xfastlog2_u3500 Sleef_fastlog2d8_u3500avx512f
+#define yfastlog2_u3500 Sleef_finz_fastlog2d8_u3500avx512f
+#define xfasttanh_u3500 Sleef_fasttanhd8_u3500avx512f
+#define yfasttanh_u3500 Sleef_finz_fasttanhd8_u3500avx512f
+#define xfastatan2_u3500 Sleef_fastatan2d8_u3500avx512f
+#define yfastatan2_u3500 Sleef_finz_fastatan2d8_u3500avx512f
+#define xfastrsqrt_u3500 Sleef_fastrsqrtd8_u3500avx512f
+#define yfastrsqrt_u3500 Sleef_finz_fastrsqrtd8_u3500avx512f
+#define xfastrcp_u3500 Sleef_fastrcpd8_u3500avx512f
+#define yfastrcp_u3500 Sleef_finz_fastrcpd8_u3500avx512f
+#define xsinr_u35 Sleef_sinrd8_u35avx512f
+#define ysinr_u35 Sleef_finz_sinrd8_u35avx512f
+#define xcosr_u35 Sleef_cosrd8_u35avx512f
+#define ycosr_u35 Sleef_finz_cosrd8_u35avx512f
+#define xsincosr_u35 Sleef_sincosrd8_u35avx512f
+#define ysincosr_u35 Sleef_finz_sincosrd8_u35avx512f
+#define xtanr_u35 Sleef_tanrd8_u35avx512f
+#define ytanr_u35 Sleef_finz_tanrd8_u35avx512f
+#define xasinh Sleef_asinhd8_u10avx512f
+#define yasinh Sleef_finz_asinhd8_u10avx512f
+#define xacosh Sleef_acoshd8_u10avx512f
+#define yacosh Sleef_finz_acoshd8_u10avx512f
+#define xatanh Sleef_atanhd8_u10avx512f
+#define yatanh Sleef_finz_atanhd8_u10avx512f
+#define xexp2 Sleef_exp2d8_u10avx512f
+#define yexp2 Sleef_finz_exp2d8_u10avx512f
+#define xexp2_u35 Sleef_exp2d8_u35avx512f
+#define yexp2_u35 Sleef_finz_exp2d8_u35avx512f
+#define xexp10 Sleef_exp10d8_u10avx512f
+#define yexp10 Sleef_finz_exp10d8_u10avx512f
+#define xexp10_u35 Sleef_exp10d8_u35avx512f
+#define yexp10_u35 Sleef_finz_exp10d8_u35avx512f
+#define xexpm1 Sleef_expm1d8_u10avx512f
+#define yexpm1 Sleef_finz_expm1d8_u10avx512f
+#define xlog10 Sleef_log10d8_u10avx512f
+#define ylog10 Sleef_finz_log10d8_u10avx512f
+#define xlog2 Sleef_log2d8_u10avx512f
+#define ylog2 Sleef_finz_log2d8_u10avx512f
+#define xlog2_u35 Sleef_log2d8_u35avx512f
+#define ylog2_u35 Sleef_finz_log2d8_u35avx512f
+#define xlog1p Sleef_log1pd8_u10avx512f
+#define ylog1p Sleef_finz_log1pd8_u10avx512f
+#define xsincospi_u05 Sleef_sincospid8_u05avx512f
+#define ysincospi_u05 Sleef_finz_sincospid8_u05avx512f
+#define xsincospi_u35 Sleef_sincospid8_u35avx512f
+#define ysincospi_u35 Sleef_finz_sincospid8_u35avx512f
+#define xsinpi_u05 Sleef_sinpid8_u05avx512f
+#define ysinpi_u05 Sleef_finz_sinpid8_u05avx512f
+#define xcospi_u05 Sleef_cospid8_u05avx512f
+#define ycospi_u05 Sleef_finz_cospid8_u05avx512f
+#define xldexp Sleef_ldexpd8_avx512f
+#define yldexp Sleef_finz_ldexpd8_avx512f
+#define xilogb Sleef_ilogbd8_avx512f
+#define yilogb Sleef_finz_ilogbd8_avx512f
+#define xfma Sleef_fmad8_avx512f
+#define yfma Sleef_finz_fmad8_avx512f
+#define xsqrt Sleef_sqrtd8_avx512f
+#define ysqrt Sleef_finz_sqrtd8_avx512f
+#define xsqrt_u05 Sleef_sqrtd8_u05avx512f
+#define ysqrt_u05 Sleef_finz_sqrtd8_u05avx512f
+#define xsqrt_u35 Sleef_sqrtd8_u35avx512f
+#define ysqrt_u35 Sleef_finz_sqrtd8_u35avx512f
+#define xhypot_u05 Sleef_hypotd8_u05avx512f
+#define yhypot_u05 Sleef_finz_hypotd8_u05avx512f
+#define xhypot_u35 Sleef_hypotd8_u35avx512f
+#define yhypot_u35 Sleef_finz_hypotd8_u35avx512f
+#define xfabs Sleef_fabsd8_avx512f
+#define yfabs Sleef_finz_fabsd8_avx512f
+#define xcopysign Sleef_copysignd8_avx512f
+#define ycopysign Sleef_finz_copysignd8_avx512f
+#define xfmax Sleef_fmaxd8_avx512f
+#define yfmax Sleef_finz_fmaxd8_avx512f
+#define xfmin Sleef_fmind8_avx512f
+#define yfmin Sleef_finz_fmind8_avx512f
+#define xfdim Sleef_fdimd8_avx512f
+#define yfdim Sleef_finz_fdimd8_avx512f
+#define xtrunc Sleef_truncd8_avx512f
+#define ytrunc Sleef_finz_truncd8_avx512f
+#define xfloor Sleef_floord8_avx512f
+#define yfloor Sleef_finz_floord8_avx512f
+#define xceil Sleef_ceild8_avx512f
+#define yceil Sleef_finz_ceild8_avx512f
+#define xround Sleef_roundd8_avx512f
+#define yround Sleef_finz_roundd8_avx512f
+#define xrint Sleef_rintd8_avx512f
+#define yrint Sleef_finz_rintd8_avx512f
+#define xnextafter Sleef_nextafterd8_avx512f
+#define ynextafter Sleef_finz_nextafterd8_avx512f
+#define xfrfrexp Sleef_frfrexpd8_avx512f
+#define yfrfrexp Sleef_finz_frfrexpd8_avx512f
+#define xexpfrexp Sleef_expfrexpd8_avx512f
+#define yexpfrexp Sleef_finz_expfrexpd8_avx512f
+#define xfmod Sleef_fmodd8_avx512f
+#define yfmod Sleef_finz_fmodd8_avx512f
+#define xremainder Sleef_remainderd8_avx512f
+#define yremainder Sleef_finz_remainderd8_avx512f
+#define xmodf Sleef_modfd8_avx512f
+#define ymodf Sleef_finz_modfd8_avx512f
+#define xlgamma_u1 Sleef_lgammad8_u10avx512f
+#define ylgamma_u1 Sleef_finz_lgammad8_u10avx512f
+#define xtgamma_u1 Sleef_tgammad8_u10avx512f
+#define ytgamma_u1 Sleef_finz_tgammad8_u10avx512f
+#define xerf_u1 Sleef_erfd8_u10avx512f
+#define yerf_u1 Sleef_finz_erfd8_u10avx512f
+#define xerfc_u15 Sleef_erfcd8_u15avx512f
+#define yerfc_u15 Sleef_finz_erfcd8_u15avx512f
+#define xsigmoid Sleef_sigmoidd8_u10avx512f
+#define ysigmoid Sleef_finz_sigmoidd8_u10avx512f
+#define xsigmoid_u35 Sleef_sigmoidd8_u35avx512f
+#define ysigmoid_u35 Sleef_finz_sigmoidd8_u35avx512f
+#define xsoftplus Sleef_softplusd8_u10avx512f
+#define ysoftplus Sleef_finz_softplusd8_u10avx512f
+#define xsoftplus_u35 Sleef_softplusd8_u35avx512f
+#define ysoftplus_u35 Sleef_finz_softplusd8_u35avx512f
+#define xsilu Sleef_silud8_u10avx512f
+#define ysilu Sleef_finz_silud8_u10avx512f
+#define xsilu_u35 Sleef_silud8_u35avx512f
+#define ysilu_u35 Sleef_finz_silud8_u35avx512f
+#define xgelutanh Sleef_gelutanhd8_u10avx512f
+#define ygelutanh Sleef_finz_gelutanhd8_u10avx512f
+#define xgelutanh_u35 Sleef_gelutanhd8_u35avx512f
+#define ygelutanh_u35 Sleef_finz_gelutanhd8_u35avx512f
+#define xgelu_u15 Sleef_gelud8_u15avx512f
+#define ygelu_u15 Sleef_finz_gelud8_u15avx512f
+#define xgetInt Sleef_getIntd8_avx512f
+#define ygetInt Sleef_finz_getIntd8_avx512f
+#define xgetPtr Sleef_getPtrd8_avx512f
+#define ygetPtr Sleef_finz_getPtrd8_avx512f
+
+#define xsinf Sleef_sinf16_u35avx512f
+#define ysinf Sleef_finz_sinf16_u35avx512f
+#define xcosf Sleef_cosf16_u35avx512f
+#define ycosf Sleef_finz_cosf16_u35avx512f
+#define xsincosf Sleef_sincosf16_u35avx512f
+#define ysincosf Sleef_finz_sincosf16_u35avx512f
+#define xtanf Sleef_tanf16_u35avx512f
+#define ytanf Sleef_finz_tanf16_u35avx512f
+#define xasinf Sleef_asinf16_u35avx512f
+#define yasinf Sleef_finz_asinf16_u35avx512f
+#define xacosf Sleef_acosf16_u35avx512f
+#define yacosf Sleef_finz_acosf16_u35avx512f
+#define xatanf Sleef_atanf16_u35avx512f
+#define yatanf Sleef_finz_atanf16_u35avx512f
+#define xatan2f Sleef_atan2f16_u35avx512f
+#define yatan2f Sleef_finz_atan2f16_u35avx512f
+#define xlogf Sleef_logf16_u35avx512f
+#define ylogf Sleef_finz_logf16_u35avx512f
+#define xcbrtf Sleef_cbrtf16_u35avx512f
+#define ycbrtf Sleef_finz_cbrtf16_u35avx512f
+#define xsinf_u1 Sleef_sinf16_u10avx512f
+#define ysinf_u1 Sleef_finz_sinf16_u10avx512f
+#define xcosf_u1 Sleef_cosf16_u10avx512f
+#define ycosf_u1 Sleef_finz_cosf16_u10avx512f
+#define xsincosf_u1 Sleef_sincosf16_u10avx512f
+#define ysincosf_u1 Sleef_finz_sincosf16_u10avx512f
+#define xtanf_u1 Sleef_tanf16_u10avx512f
+#define ytanf_u1 Sleef_finz_tanf16_u10avx512f
+#define xasinf_u1 Sleef_asinf16_u10avx512f
+#define yasinf_u1 Sleef_finz_asinf16_u10avx512f
+#define xacosf_u1 Sleef_acosf16_u10avx512f
+#define yacosf_u1 Sleef_finz_acosf16_u10avx512f
+#define xatanf_u1 Sleef_atanf16_u10avx512f
+#define yatanf_u1 Sleef_finz_atanf16_u10avx512f
+#define xatan2f_u1 Sleef_atan2f16_u10avx512f
+#define yatan2f_u1 Sleef_finz_atan2f16_u10avx512f
+#define xlogf_u1 Sleef_logf16_u10avx512f
+#define ylogf_u1 Sleef_finz_logf16_u10avx512f
+#define xcbrtf_u1 Sleef_cbrtf16_u10avx512f
+#define ycbrtf_u1 Sleef_finz_cbrtf16_u10avx512f
+#define xexpf Sleef_expf16_u10avx512f
+#define yexpf Sleef_finz_expf16_u10avx512f
+#define xpowf Sleef_powf16_u10avx512f
+#define ypowf Sleef_finz_powf16_u10avx512f
+#define xsinhf Sleef_sinhf16_u10avx512f
+#define ysinhf Sleef_finz_sinhf16_u10avx512f
+#define xcoshf Sleef_coshf16_u10avx512f
+#define ycoshf Sleef_finz_coshf16_u10avx512f
+#define xtanhf Sleef_tanhf16_u10avx512f
+#define ytanhf Sleef_finz_tanhf16_u10avx512f
+#define xsinhf_u35 Sleef_sinhf16_u35avx512f
+#define ysinhf_u35 Sleef_finz_sinhf16_u35avx512f
+#define xcoshf_u35 Sleef_coshf16_u35avx512f
+#define ycoshf_u35 Sleef_finz_coshf16_u35avx512f
+#define xtanhf_u35 Sleef_tanhf16_u35avx512f
+#define ytanhf_u35 Sleef_finz_tanhf16_u35avx512f
+#define xfastsinf_u3500 Sleef_fastsinf16_u3500avx512f
+#define yfastsinf_u3500 Sleef_finz_fastsinf16_u3500avx512f
+#define xfastcosf_u3500 Sleef_fastcosf16_u3500avx512f
+#define yfastcosf_u3500 Sleef_finz_fastcosf16_u3500avx512f
+#define xfastpowf_u3500 Sleef_fastpowf16_u3500avx512f
+#define yfastpowf_u3500 Sleef_finz_fastpowf16_u3500avx512f
+#define xfastexpf_u3500 Sleef_fastexpf16_u3500avx512f
+#define yfastexpf_u3500 Sleef_finz_fastexpf16_u3500avx512f
+#define xfastexp2f_u3500 Sleef_fastexp2f16_u3500avx512f
+#define yfastexp2f_u3500 Sleef_finz_fastexp2f16_u3500avx512f
+#define xfastlogf_u3500 Sleef_fastlogf16_u3500avx512f
+#define yfastlogf_u3500 Sleef_finz_fastlogf16_u3500avx512f
+#define xfastlog2f_u3500 Sleef_fastlog2f16_u3500avx512f
+#define yfastlog2f_u3500 Sleef_finz_fastlog2f16_u3500avx512f
+#define xfasttanhf_u3500 Sleef_fasttanhf16_u3500avx512f
+#define yfasttanhf_u3500 Sleef_finz_fasttanhf16_u3500avx512f
+#define xfastatan2f_u3500 Sleef_fastatan2f16_u3500avx512f
+#define yfastatan2f_u3500 Sleef_finz_fastatan2f16_u3500avx512f
+#define xfastrsqrtf_u3500 Sleef_fastrsqrtf16_u3500avx512f
+#define yfastrsqrtf_u3500 Sleef_finz_fastrsqrtf16_u3500avx512f
+#define xfastrcpf_u3500 Sleef_fastrcpf16_u3500avx512f
+#define yfastrcpf_u3500 Sleef_finz_fastrcpf16_u3500avx512f
+#define xsinrf_u35 Sleef_sinrf16_u35avx512f
+#define ysinrf_u35 Sleef_finz_sinrf16_u35avx512f
+#define xcosrf_u35 Sleef_cosrf16_u35avx512f
+#define ycosrf_u35 Sleef_finz_cosrf16_u35avx512f
+#define xsincosrf_u35 Sleef_sincosrf16_u35avx512f
+#define ysincosrf_u35 Sleef_finz_sincosrf16_u35avx512f
+#define xtanrf_u35 Sleef_tanrf16_u35avx512f
+#define ytanrf_u35 Sleef_finz_tanrf16_u35avx512f
+#define xasinhf Sleef_asinhf16_u10avx512f
+#define yasinhf Sleef_finz_asinhf16_u10avx512f
+#define xacoshf Sleef_acoshf16_u10avx512f
+#define yacoshf Sleef_finz_acoshf16_u10avx512f
+#define xatanhf Sleef_atanhf16_u10avx512f
+#define yatanhf Sleef_finz_atanhf16_u10avx512f
+#define xexp2f Sleef_exp2f16_u10avx512f
+#define yexp2f Sleef_finz_exp2f16_u10avx512f
+#define xexp2f_u35 Sleef_exp2f16_u35avx512f
+#define yexp2f_u35 Sleef_finz_exp2f16_u35avx512f
+#define xexp10f Sleef_exp10f16_u10avx512f
+#define yexp10f Sleef_finz_exp10f16_u10avx512f
+#define xexp10f_u35 Sleef_exp10f16_u35avx512f
+#define yexp10f_u35 Sleef_finz_exp10f16_u35avx512f
+#define xexpm1f Sleef_expm1f16_u10avx512f
+#define yexpm1f Sleef_finz_expm1f16_u10avx512f
+#define xlog10f Sleef_log10f16_u10avx512f
+#define ylog10f Sleef_finz_log10f16_u10avx512f
+#define xlog2f Sleef_log2f16_u10avx512f
+#define ylog2f Sleef_finz_log2f16_u10avx512f
+#define xlog2f_u35 Sleef_log2f16_u35avx512f
+#define ylog2f_u35 Sleef_finz_log2f16_u35avx512f
+#define xlog1pf Sleef_log1pf16_u10avx512f
+#define ylog1pf Sleef_finz_log1pf16_u10avx512f
+#define xsincospif_u05 Sleef_sincospif16_u05avx512f
+#define ysincospif_u05 Sleef_finz_sincospif16_u05avx512f
+#define xsincospif_u35 Sleef_sincospif16_u35avx512f
+#define ysincospif_u35 Sleef_finz_sincospif16_u35avx512f
+#define xsinpif_u05 Sleef_sinpif16_u05avx512f
+#define ysinpif_u05 Sleef_finz_sinpif16_u05avx512f
+#define xcospif_u05 Sleef_cospif16_u05avx512f
+#define ycospif_u05 Sleef_finz_cospif16_u05avx512f
+#define xldexpf Sleef_ldexpf16_avx512f
+#define yldexpf Sleef_finz_ldexpf16_avx512f
+#define xilogbf Sleef_ilogbf16_avx512f
+#define yilogbf Sleef_finz_ilogbf16_avx512f
+#define xfmaf Sleef_fmaf16_avx512f
+#define yfmaf Sleef_finz_fmaf16_avx512f
+#define xsqrtf Sleef_sqrtf16_avx512f
+#define ysqrtf Sleef_finz_sqrtf16_avx512f
+#define xsqrtf_u05 Sleef_sqrtf16_u05avx512f
+#define ysqrtf_u05 Sleef_finz_sqrtf16_u05avx512f
+#define xsqrtf_u35 Sleef_sqrtf16_u35avx512f
+#define ysqrtf_u35 Sleef_finz_sqrtf16_u35avx512f
+#define xhypotf_u05 Sleef_hypotf16_u05avx512f
+#define yhypotf_u05 Sleef_finz_hypotf16_u05avx512f
+#define xhypotf_u35 Sleef_hypotf16_u35avx512f
+#define yhypotf_u35 Sleef_finz_hypotf16_u35avx512f
+#define xfabsf Sleef_fabsf16_avx512f
+#define yfabsf Sleef_finz_fabsf16_avx512f
+#define xcopysignf Sleef_copysignf16_avx512f
+#define ycopysignf Sleef_finz_copysignf16_avx512f
+#define xfmaxf Sleef_fmaxf16_avx512f
+#define yfmaxf Sleef_finz_fmaxf16_avx512f
+#define xfminf Sleef_fminf16_avx512f
+#define yfminf Sleef_finz_fminf16_avx512f
+#define xfdimf Sleef_fdimf16_avx512f
+#define yfdimf Sleef_finz_fdimf16_avx512f
+#define xtruncf Sleef_truncf16_avx512f
+#define ytruncf Sleef_finz_truncf16_avx512f
+#define xfloorf Sleef_floorf16_avx512f
+#define yfloorf Sleef_finz_floorf16_avx512f
+#define xceilf Sleef_ceilf16_avx512f
+#define yceilf Sleef_finz_ceilf16_avx512f
+#define xroundf Sleef_roundf16_avx512f
+#define yroundf Sleef_finz_roundf16_avx512f
+#define xrintf Sleef_rintf16_avx512f
+#define yrintf Sleef_finz_rintf16_avx512f
+#define xnextafterf Sleef_nextafterf16_avx512f
+#define ynextafterf Sleef_finz_nextafterf16_avx512f
+#define xfrfrexpf Sleef_frfrexpf16_avx512f
+#define yfrfrexpf Sleef_finz_frfrexpf16_avx512f
+#define xexpfrexpf Sleef_expfrexpf16_avx512f
+#define yexpfrexpf Sleef_finz_expfrexpf16_avx512f
+#define xfmodf Sleef_fmodf16_avx512f
+#define yfmodf Sleef_finz_fmodf16_avx512f
+#define xremainderf Sleef_remainderf16_avx512f
+#define yremainderf Sleef_finz_remainderf16_avx512f
+#define xmodff Sleef_modff16_avx512f
+#define ymodff Sleef_finz_modff16_avx512f
+#define xlgammaf_u1 Sleef_lgammaf16_u10avx512f
+#define ylgammaf_u1 Sleef_finz_lgammaf16_u10avx512f
+#define xtgammaf_u1 Sleef_tgammaf16_u10avx512f
+#define ytgammaf_u1 Sleef_finz_tgammaf16_u10avx512f
+#define xerff_u1 Sleef_erff16_u10avx512f
+#define yerff_u1 Sleef_finz_erff16_u10avx512f
+#define xerfcf_u15 Sleef_erfcf16_u15avx512f
+#define yerfcf_u15 Sleef_finz_erfcf16_u15avx512f
+#define xsigmoidf Sleef_sigmoidf16_u10avx512f
+#define ysigmoidf Sleef_finz_sigmoidf16_u10avx512f
+#define xsigmoidf_u35 Sleef_sigmoidf16_u35avx512f
+#define ysigmoidf_u35 Sleef_finz_sigmoidf16_u35avx512f
+#define xsoftplusf Sleef_softplusf16_u10avx512f
+#define ysoftplusf Sleef_finz_softplusf16_u10avx512f
+#define xsoftplusf_u35 Sleef_softplusf16_u35avx512f
+#define ysoftplusf_u35 Sleef_finz_softplusf16_u35avx512f
+#define xsiluf Sleef_siluf16_u10avx512f
+#define ysiluf Sleef_finz_siluf16_u10avx512f
+#define xsiluf_u35 Sleef_siluf16_u35avx512f
+#define ysiluf_u35 Sleef_finz_siluf16_u35avx512f
+#define xgelutanhf Sleef_gelutanhf16_u10avx512f
+#define ygelutanhf Sleef_finz_gelutanhf16_u10avx512f
+#define xgelutanhf_u35 Sleef_gelutanhf16_u35avx512f
+#define ygelutanhf_u35 Sleef_finz_gelutanhf16_u35avx512f
+#define xgeluf_u15 Sleef_geluf16_u15avx512f
+#define ygeluf_u15 Sleef_finz_geluf16_u15avx512f
+#define xgetIntf Sleef_getIntf16_avx512f
+#define ygetIntf Sleef_finz_getIntf16_avx512f
+#define xgetPtrf Sleef_getPtrf16_avx512f
+#define ygetPtrf Sleef_finz_getPtrf16_avx512f
+
+#define xsinf16_u1 Sleef_sinh16_u10avx512f
+#define xcosf16_u1 Sleef_cosh16_u10avx512f
+#define xtanf16_u1 Sleef_tanh16_u10avx512f
+#define xasinf16_u1 Sleef_asinh16_u10avx512f
+#define xacosf16_u1 Sleef_acosh16_u10avx512f
+#define xatanf16_u1 Sleef_atanh16_u10avx512f
+#define xatan2f16_u1 Sleef_atan2h16_u10avx512f
+#define xlogf16_u1 Sleef_logh16_u10avx512f
+#define xcbrtf16_u1 Sleef_cbrth16_u10avx512f
+#define xexpf16 Sleef_exph16_u10avx512f
+#define xpowf16 Sleef_powh16_u10avx512f
+#define xsinhf16 Sleef_sinhh16_u10avx512f
+#define xcoshf16 Sleef_coshh16_u10avx512f
+#define xtanhf16 Sleef_tanhh16_u10avx512f
+#define xasinhf16 Sleef_asinhh16_u10avx512f
+#define xacoshf16 Sleef_acoshh16_u10avx512f
+#define xatanhf16 Sleef_atanhh16_u10avx512f
+#define xexp2f16 Sleef_exp2h16_u10avx512f
+#define xexp10f16 Sleef_exp10h16_u10avx512f
+#define xexpm1f16 Sleef_expm1h16_u10avx512f
+#define xlog10f16 Sleef_log10h16_u10avx512f
+#define xlog2f16 Sleef_log2h16_u10avx512f
+#define xlog1pf16 Sleef_log1ph16_u10avx512f
+#define xsqrtf16 Sleef_sqrth16_avx512f
+#define xlgammaf16_u1 Sleef_lgammah16_u10avx512f
+#define xtgammaf16_u1 Sleef_tgammah16_u10avx512f
+#define xerff16_u1 Sleef_erfh16_u10avx512f
+#define xerfcf16_u15 Sleef_erfch16_u15avx512f
+#define xsigmoidf16 Sleef_sigmoidh16_u10avx512f
+#define xsoftplusf16 Sleef_softplush16_u10avx512f
+#define xsiluf16 Sleef_siluh16_u10avx512f
+#define xgelutanhf16 Sleef_gelutanhh16_u10avx512f
+#define xgeluf16_u15 Sleef_geluh16_u15avx512f
+
+#define xsinbf16_u1 Sleef_sinbf16x16_u10avx512f
+#define xcosbf16_u1 Sleef_cosbf16x16_u10avx512f
+#define xlogbf16_u1 Sleef_logbf16x16_u10avx512f
+#define xexpbf16 Sleef_expbf16x16_u10avx512f
+#define xpowbf16 Sleef_powbf16x16_u10avx512f
+#define xtanhbf16 Sleef_tanhbf16x16_u10avx512f
+#define xexp2bf16 Sleef_exp2bf16x16_u10avx512f
+#define xexp10bf16 Sleef_exp10bf16x16_u10avx512f
+#define xexpm1bf16 Sleef_expm1bf16x16_u10avx512f
+#define xlog10bf16 Sleef_log10bf16x16_u10avx512f
+#define xlog2bf16 Sleef_log2bf16x16_u10avx512f
+#define xlog1pbf16 Sleef_log1pbf16x16_u10avx512f
+#define xsqrtbf16 Sleef_sqrtbf16x16_avx512f
+#define xerfbf16_u1 Sleef_erfbf16x16_u10avx512f
+#define xerfcbf16_u15 Sleef_erfcbf16x16_u15avx512f
+#define xsigmoidbf16 Sleef_sigmoidbf16x16_u10avx512f
+#define xsoftplusbf16 Sleef_softplusbf16x16_u10avx512f
+#define xsilubf16 Sleef_silubf16x16_u10avx512f
+#define xgelutanhbf16 Sleef_gelutanhbf16x16_u10avx512f
+#define xgelubf16_u15 Sleef_gelubf16x16_u15avx512f
+
+#else //#ifndef DETERMINISTIC
+
+#define xsin Sleef_finz_sind8_u35avx512f
+#define xcos Sleef_finz_cosd8_u35avx512f
+#define xsincos Sleef_finz_sincosd8_u35avx512f
+#define xtan Sleef_finz_tand8_u35avx512f
+#define xasin Sleef_finz_asind8_u35avx512f
+#define xacos Sleef_finz_acosd8_u35avx512f
+#define xatan Sleef_finz_atand8_u35avx512f
+#define xatan2 Sleef_finz_atan2d8_u35avx512f
+#define xlog Sleef_finz_logd8_u35avx512f
+#define xcbrt Sleef_finz_cbrtd8_u35avx512f
+#define xsin_u1 Sleef_finz_sind8_u10avx512f
+#define xcos_u1 Sleef_finz_cosd8_u10avx512f
+#define xsincos_u1 Sleef_finz_sincosd8_u10avx512f
+#define xtan_u1 Sleef_finz_tand8_u10avx512f
+#define xasin_u1 Sleef_finz_asind8_u10avx512f
+#define xacos_u1 Sleef_finz_acosd8_u10avx512f
+#define xatan_u1 Sleef_finz_atand8_u10avx512f
+#define xatan2_u1 Sleef_finz_atan2d8_u10avx512f
+#define xlog_u1 Sleef_finz_logd8_u10avx512f
+#define xcbrt_u1 Sleef_finz_cbrtd8_u10avx512f
+#define xexp Sleef_finz_expd8_u10avx512f
+#define xpow Sleef_finz_powd8_u10avx512f
+#define xsinh Sleef_finz_sinhd8_u10avx512f
+#define xcosh Sleef_finz_coshd8_u10avx512f
+#define xtanh Sleef_finz_tanhd8_u10avx512f
+#define xsinh_u35 Sleef_finz_sinhd8_u35avx512f
+#define xcosh_u35 Sleef_finz_coshd8_u35avx512f
+#define xtanh_u35 Sleef_finz_tanhd8_u35avx512f
+#define xfastsin_u3500 Sleef_finz_fastsind8_u3500avx512f
+#define xfastcos_u3500 Sleef_finz_fastcosd8_u3500avx512f
+#define xfastpow_u3500 Sleef_finz_fastpowd8_u3500avx512f
+#define xfastexp_u3500 Sleef_finz_fastexpd8_u3500avx512f
+#define xfastexp2_u3500 Sleef_finz_fastexp2d8_u3500avx512f
+#define xfastlog_u3500 Sleef_finz_fastlogd8_u3500avx512f
+#define xfastlog2_u3500 Sleef_finz_fastlog2d8_u3500avx512f
+#define xfasttanh_u3500 Sleef_finz_fasttanhd8_u3500avx512f
+#define xfastatan2_u3500 Sleef_finz_fastatan2d8_u3500avx512f
+#define xfastrsqrt_u3500 Sleef_finz_fastrsqrtd8_u3500avx512f
+#define xfastrcp_u3500 Sleef_finz_fastrcpd8_u3500avx512f
+#define xsinr_u35 Sleef_finz_sinrd8_u35avx512f
+#define xcosr_u35 Sleef_finz_cosrd8_u35avx512f
+#define xsincosr_u35 Sleef_finz_sincosrd8_u35avx512f
+#define xtanr_u35 Sleef_finz_tanrd8_u35avx512f
+#define xasinh Sleef_finz_asinhd8_u10avx512f
+#define xacosh Sleef_finz_acoshd8_u10avx512f
+#define xatanh Sleef_finz_atanhd8_u10avx512f
+#define xexp2 Sleef_finz_exp2d8_u10avx512f
+#define xexp2_u35 Sleef_finz_exp2d8_u35avx512f
+#define xexp10 Sleef_finz_exp10d8_u10avx512f
+#define xexp10_u35 Sleef_finz_exp10d8_u35avx512f
+#define xexpm1 Sleef_finz_expm1d8_u10avx512f
+#define xlog10 Sleef_finz_log10d8_u10avx512f
+#define xlog2 Sleef_finz_log2d8_u10avx512f
+#define xlog2_u35 Sleef_finz_log2d8_u35avx512f
+#define xlog1p Sleef_finz_log1pd8_u10avx512f
+#define xsincospi_u05 Sleef_finz_sincospid8_u05avx512f
+#define xsincospi_u35 Sleef_finz_sincospid8_u35avx512f
+#define xsinpi_u05 Sleef_finz_sinpid8_u05avx512f
+#define xcospi_u05 Sleef_finz_cospid8_u05avx512f
+#define xldexp Sleef_finz_ldexpd8_avx512f
+#define xilogb Sleef_finz_ilogbd8_avx512f
+#define xfma Sleef_finz_fmad8_avx512f
+#define xsqrt Sleef_finz_sqrtd8_avx512f
+#define xsqrt_u05 Sleef_finz_sqrtd8_u05avx512f
+#define xsqrt_u35 Sleef_finz_sqrtd8_u35avx512f
+#define xhypot_u05 Sleef_finz_hypotd8_u05avx512f
+#define xhypot_u35 Sleef_finz_hypotd8_u35avx512f
+#define xfabs Sleef_finz_fabsd8_avx512f
+#define xcopysign Sleef_finz_copysignd8_avx512f
+#define xfmax Sleef_finz_fmaxd8_avx512f
+#define xfmin Sleef_finz_fmind8_avx512f
+#define xfdim Sleef_finz_fdimd8_avx512f
+#define xtrunc Sleef_finz_truncd8_avx512f
+#define xfloor Sleef_finz_floord8_avx512f
+#define xceil Sleef_finz_ceild8_avx512f
+#define xround Sleef_finz_roundd8_avx512f
+#define xrint Sleef_finz_rintd8_avx512f
+#define xnextafter Sleef_finz_nextafterd8_avx512f
+#define xfrfrexp Sleef_finz_frfrexpd8_avx512f
+#define xexpfrexp Sleef_finz_expfrexpd8_avx512f
+#define xfmod Sleef_finz_fmodd8_avx512f
+#define xremainder Sleef_finz_remainderd8_avx512f
+#define xmodf Sleef_finz_modfd8_avx512f
+#define xlgamma_u1 Sleef_finz_lgammad8_u10avx512f
+#define xtgamma_u1 Sleef_finz_tgammad8_u10avx512f
+#define xerf_u1 Sleef_finz_erfd8_u10avx512f
+#define xerfc_u15 Sleef_finz_erfcd8_u15avx512f
+#define xsigmoid Sleef_finz_sigmoidd8_u10avx512f
+#define xsigmoid_u35 Sleef_finz_sigmoidd8_u35avx512f
+#define xsoftplus Sleef_finz_softplusd8_u10avx512f
+#define xsoftplus_u35 Sleef_finz_softplusd8_u35avx512f
+#define xsilu Sleef_finz_silud8_u10avx512f
+#define xsilu_u35 Sleef_finz_silud8_u35avx512f
+#define xgelutanh Sleef_finz_gelutanhd8_u10avx512f
+#define xgelutanh_u35 Sleef_finz_gelutanhd8_u35avx512f
+#define xgelu_u15 Sleef_finz_gelud8_u15avx512f
+#define xgetInt Sleef_finz_getIntd8_avx512f
+#define xgetPtr Sleef_finz_getPtrd8_avx512f
+
+#define xsinf Sleef_finz_sinf16_u35avx512f
+#define xcosf Sleef_finz_cosf16_u35avx512f
+#define xsincosf Sleef_finz_sincosf16_u35avx512f
+#define xtanf Sleef_finz_tanf16_u35avx512f
+#define xasinf Sleef_finz_asinf16_u35avx512f
+#define xacosf Sleef_finz_acosf16_u35avx512f
+#define xatanf Sleef_finz_atanf16_u35avx512f
+#define xatan2f Sleef_finz_atan2f16_u35avx512f
+#define xlogf Sleef_finz_logf16_u35avx512f
+#define xcbrtf Sleef_finz_cbrtf16_u35avx512f
+#define xsinf_u1 Sleef_finz_sinf16_u10avx512f
+#define xcosf_u1 Sleef_finz_cosf16_u10avx512f
+#define xsincosf_u1 Sleef_finz_sincosf16_u10avx512f
+#define xtanf_u1 Sleef_finz_tanf16_u10avx512f
+#define xasinf_u1 Sleef_finz_asinf16_u10avx512f
+#define xacosf_u1 Sleef_finz_acosf16_u10avx512f
+#define xatanf_u1 Sleef_finz_atanf16_u10avx512f
+#define xatan2f_u1 Sleef_finz_atan2f16_u10avx512f
+#define xlogf_u1 Sleef_finz_logf16_u10avx512f
+#define xcbrtf_u1 Sleef_finz_cbrtf16_u10avx512f
+#define xexpf Sleef_finz_expf16_u10avx512f
+#define xpowf Sleef_finz_powf16_u10avx512f
+#define xsinhf Sleef_finz_sinhf16_u10avx512f
+#define xcoshf Sleef_finz_coshf16_u10avx512f
+#define xtanhf Sleef_finz_tanhf16_u10avx512f
+#define xsinhf_u35 Sleef_finz_sinhf16_u35avx512f
+#define xcoshf_u35 Sleef_finz_coshf16_u35avx512f
+#define xtanhf_u35 Sleef_finz_tanhf16_u35avx512f
+#define xfastsinf_u3500 Sleef_finz_fastsinf16_u3500avx512f
+#define xfastcosf_u3500 Sleef_finz_fastcosf16_u3500avx512f
+#define xfastpowf_u3500 Sleef_finz_fastpowf16_u3500avx512f
+#define xfastexpf_u3500 Sleef_finz_fastexpf16_u3500avx512f
+#define xfastexp2f_u3500 Sleef_finz_fastexp2f16_u3500avx512f
+#define xfastlogf_u3500 Sleef_finz_fastlogf16_u3500avx512f
+#define xfastlog2f_u3500 Sleef_finz_fastlog2f16_u3500avx512f
+#define xfasttanhf_u3500 Sleef_finz_fasttanhf16_u3500avx512f
+#define xfastatan2f_u3500 Sleef_finz_fastatan2f16_u3500avx512f
+#define xfastrsqrtf_u3500 Sleef_finz_fastrsqrtf16_u3500avx512f
+#define xfastrcpf_u3500 Sleef_finz_fastrcpf16_u3500avx512f
+#define xsinrf_u35 Sleef_finz_sinrf16_u35avx512f
+#define xcosrf_u35 Sleef_finz_cosrf16_u35avx512f
+#define xsincosrf_u35 Sleef_finz_sincosrf16_u35avx512f
+#define xtanrf_u35 Sleef_finz_tanrf16_u35avx512f
+#define xasinhf Sleef_finz_asinhf16_u10avx512f
+#define xacoshf Sleef_finz_acoshf16_u10avx512f
+#define xatanhf Sleef_finz_atanhf16_u10avx512f
+#define xexp2f Sleef_finz_exp2f16_u10avx512f
+#define xexp2f_u35 Sleef_finz_exp2f16_u35avx512f
+#define xexp10f Sleef_finz_exp10f16_u10avx512f
+#define xexp10f_u35 Sleef_finz_exp10f16_u35avx512f
+#define xexpm1f Sleef_finz_expm1f16_u10avx512f
+#define xlog10f Sleef_finz_log10f16_u10avx512f
+#define xlog2f Sleef_finz_log2f16_u10avx512f
+#define xlog2f_u35 Sleef_finz_log2f16_u35avx512f
+#define xlog1pf Sleef_finz_log1pf16_u10avx512f
+#define xsincospif_u05 Sleef_finz_sincospif16_u05avx512f
+#define xsincospif_u35 Sleef_finz_sincospif16_u35avx512f
+#define xsinpif_u05 Sleef_finz_sinpif16_u05avx512f
+#define xcospif_u05 Sleef_finz_cospif16_u05avx512f
+#define xldexpf Sleef_finz_ldexpf16_avx512f
+#define xilogbf Sleef_finz_ilogbf16_avx512f
+#define xfmaf Sleef_finz_fmaf16_avx512f
+#define xsqrtf Sleef_finz_sqrtf16_avx512f
+#define xsqrtf_u05 Sleef_finz_sqrtf16_u05avx512f
+#define xsqrtf_u35 Sleef_finz_sqrtf16_u35avx512f
+#define xhypotf_u05 Sleef_finz_hypotf16_u05avx512f
+#define xhypotf_u35 Sleef_finz_hypotf16_u35avx512f
+#define xfabsf Sleef_finz_fabsf16_avx512f
+#define xcopysignf Sleef_finz_copysignf16_avx512f
+#define xfmaxf Sleef_finz_fmaxf16_avx512f
+#define xfminf Sleef_finz_fminf16_avx512f
+#define xfdimf Sleef_finz_fdimf16_avx512f
+#define xtruncf Sleef_finz_truncf16_avx512f
+#define xfloorf Sleef_finz_floorf16_avx512f
+#define xceilf Sleef_finz_ceilf16_avx512f
+#define xroundf Sleef_finz_roundf16_avx512f
+#define xrintf Sleef_finz_rintf16_avx512f
+#define xnextafterf Sleef_finz_nextafterf16_avx512f
+#define xfrfrexpf Sleef_finz_frfrexpf16_avx512f
+#define xexpfrexpf Sleef_finz_expfrexpf16_avx512f
+#define xfmodf Sleef_finz_fmodf16_avx512f
+#define xremainderf Sleef_finz_remainderf16_avx512f
+#define xmodff Sleef_finz_modff16_avx512f
+#define xlgammaf_u1 Sleef_finz_lgammaf16_u10avx512f
+#define xtgammaf_u1 Sleef_finz_tgammaf16_u10avx512f
+#define xerff_u1 Sleef_finz_erff16_u10avx512f
+#define xerfcf_u15 Sleef_finz_erfcf16_u15avx512f
+#define xsigmoidf Sleef_finz_sigmoidf16_u10avx512f
+#define xsigmoidf_u35 Sleef_finz_sigmoidf16_u35avx512f
+#define xsoftplusf Sleef_finz_softplusf16_u10avx512f
+#define xsoftplusf_u35 Sleef_finz_softplusf16_u35avx512f
+#define xsiluf Sleef_finz_siluf16_u10avx512f
+#define xsiluf_u35 Sleef_finz_siluf16_u35avx512f
+#define xgelutanhf Sleef_finz_gelutanhf16_u10avx512f
+#define xgelutanhf_u35 Sleef_finz_gelutanhf16_u35avx512f
+#define xgeluf_u15 Sleef_finz_geluf16_u15avx512f
+#define xgetIntf Sleef_finz_getIntf16_avx512f
+#define xgetPtrf Sleef_finz_getPtrf16_avx512f
+
+#endif // #ifndef DETERMINISTIC
@@ -0,0 +1,652 @@
+#ifndef DETERMINISTIC
+
+#define xsin Sleef_sind8_u35avx512fnofma
+#define ysin Sleef_cinz_sind8_u35avx512fnofma
+#define xcos Sleef_cosd8_u35avx512fnofma
+#define ycos Sleef_cinz_cosd8_u35avx512fnofma
+#define xsincos Sleef_sincosd8_u35avx512fnofma
+#define ysincos Sleef_cinz_sincosd8_u35avx512fnofma
+#define xtan Sleef_tand8_u35avx512fnofma
+#define ytan Sleef_cinz_tand8_u35avx512fnofma
+#define xasin Sleef_asind8_u35avx512fnofma
+#define yasin Sleef_cinz_asind8_u35avx512fnofma
+#define xacos Sleef_acosd8_u35avx512fnofma
+#define yacos Sleef_cinz_acosd8_u35avx512fnofma
+#define xatan Sleef_atand8_u35avx512fnofma
+#define yatan Sleef_cinz_atand8_u35avx512fnofma
+#define xatan2 Sleef_atan2d8_u35avx512fnofma
+#define yatan2 Sleef_cinz_atan2d8_u35avx512fnofma
+#define xlog Sleef_logd8_u35avx512fnofma
+#define ylog Sleef_cinz_logd8_u35avx512fnofma
+#define xcbrt Sleef_cbrtd8_u35avx512fnofma
+#define ycbrt Sleef_cinz_cbrtd8_u35avx512fnofma
+#define xsin_u1 Sleef_sind8_u10avx512fnofma
+#define ysin_u1 Sleef_cinz_sind8_u10avx512fnofma
+#define xcos_u1 Sleef_cosd8_u10avx512fnofma
+#define ycos_u1 Sleef_cinz_cosd8_u10avx512fnofma
+#define xsincos_u1 Sleef_sincosd8_u10avx512fnofma
+#define ysincos_u1 Sleef_cinz_sincosd8_u10avx512fnofma
+#define xtan_u1 Sleef_tand8_u10avx512fnofma
+#define ytan_u1 Sleef_cinz_tand8_u10avx512fnofma
+#define xasin_u1 Sleef_asind8_u10avx512fnofma
+#define yasin_u1 Sleef_cinz_asind8_u10avx512fnofma
+#define xacos_u1 Sleef_acosd8_u10avx512fnofma
+#define yacos_u1 Sleef_cinz_acosd8_u10avx512fnofma
+#define xatan_u1 Sleef_atand8_u10avx512fnofma
+#define yatan_u1 Sleef_cinz_atand8_u10avx512fnofma
+#define xatan2_u1 Sleef_atan2d8_u10avx512fnofma
+#define yatan2_u1 Sleef_cinz_atan2d8_u10avx512fnofma
+#define xlog_u1 Sleef_logd8_u10avx512fnofma
+#define ylog_u1 Sleef_cinz_logd8_u10avx512fnofma
+#define xcbrt_u1 Sleef_cbrtd8_u10avx512fnofma
+#define ycbrt_u1 Sleef_cinz_cbrtd8_u10avx512fnofma
+#define xexp Sleef_expd8_u10avx512fnofma
+#define yexp Sleef_cinz_expd8_u10avx512fnofma
+#define xpow Sleef_powd8_u10avx512fnofma
+#define ypow Sleef_cinz_powd8_u10avx512fnofma
+#define xsinh Sleef_sinhd8_u10avx512fnofma
+#define ysinh Sleef_cinz_sinhd8_u10avx512fnofma
+#define xcosh Sleef_coshd8_u10avx512fnofma
+#define ycosh Sleef_cinz_coshd8_u10avx512fnofma
+#define xtanh Sleef_tanhd8_u10avx512fnofma
+#define ytanh Sleef_cinz_tanhd8_u10avx512fnofma
+#define xsinh_u35 Sleef_sinhd8_u35avx512fnofma
+#define ysinh_u35 Sleef_cinz_sinhd8_u35avx512fnofma
+#define xcosh_u35 Sleef_coshd8_u35avx512fnofma
+#define ycosh_u35 Sleef_cinz_coshd8_u35avx512fnofma
+#define xtanh_u35 Sleef_tanhd8_u35avx512fnofma
+#define ytanh_u35 Sleef_cinz_tanhd8_u35avx512fnofma
+#define xfastsin_u3500 Sleef_fastsind8_u3500avx512fnofma
+#define yfastsin_u3500 Sleef_cinz_fastsind8_u3500avx512fnofma
+#define xfastcos_u3500 Sleef_fastcosd8_u3500avx512fnofma
+#define yfastcos_u3500 Sleef_cinz_fastcosd8_u3500avx512fnofma
+#define xfastpow_u3500 Sleef_fastpowd8_u3500avx512fnofma
+#define yfastpow_u3500 Sleef_cinz_fastpowd8_u3500avx512fnofma
+#define xfastexp_u3500 Sleef_fastexpd8_u3500avx512fnofma
+#define yfastexp_u3500 Sleef_cinz_fastexpd8_u3500avx512fnofma
+#define xfastexp2_u3500 Sleef_fastexp2d8_u3500avx512fnofma
+#define yfastexp2_u3500 Sleef_cinz_fastexp2d8_u3500avx512fnofma
+#define xfastlog_u3500 Sleef_fastlogd8_u3500avx512fnofma
+#define yfastlog_u3500 Sleef_cinz_fastlogd8_u3500avx512fnofma
+#define xfastlog2_u3500 Sleef_fastlog2d8_u3500avx512fnofma
+#define yfastlog2_u3500 Sleef_cinz_fastlog2d8_u3500avx512fnofma
+#define xfasttanh_u3500 Sleef_fasttanhd8_u3500avx512fnofma
+#define yfasttanh_u3500 Sleef_cinz_fasttanhd8_u3500avx512fnofma
+#define xfastatan2_u3500 Sleef_fastatan2d8_u3500avx512fnofma
+#define yfastatan2_u3500 Sleef_cinz_fastatan2d8_u3500avx512fnofma
+#define xfastrsqrt_u3500 Sleef_fastrsqrtd8_u3500avx512fnofma
+#define yfastrsqrt_u3500 Sleef_cinz_fastrsqrtd8_u3500avx512fnofma
+#define xfastrcp_u3500 Sleef_fastrcpd8_u3500avx512fnofma
+#define yfastrcp_u3500 Sleef_cinz_fastrcpd8_u3500avx512fnofma
+#define xsinr_u35 Sleef_sinrd8_u35avx512fnofma
+#define ysinr_u35 Sleef_cinz_sinrd8_u35avx512fnofma
+#define xcosr_u35 Sleef_cosrd8_u35avx512fnofma
+#define ycosr_u35 Sleef_cinz_cosrd8_u35avx512fnofma
+#define xsincosr_u35 Sleef_sincosrd8_u35avx512fnofma
+#define ysincosr_u35 Sleef_cinz_sincosrd8_u35avx512fnofma
+#define xtanr_u35 Sleef_tanrd8_u35avx512fnofma
+#define ytanr_u35 Sleef_cinz_tanrd8_u35avx512fnofma
+#define xasinh Sleef_asinhd8_u10avx512fnofma
+#define yasinh Sleef_cinz_asinhd8_u10avx512fnofma
+#define xacosh Sleef_acoshd8_u10avx512fnofma
+#define yacosh Sleef_cinz_acoshd8_u10avx512fnofma
+#define xatanh Sleef_atanhd8_u10avx512fnofma
+#define yatanh Sleef_cinz_atanhd8_u10avx512fnofma
+#define xexp2 Sleef_exp2d8_u10avx512fnofma
+#define yexp2 Sleef_cinz_exp2d8_u10avx512fnofma
+#define xexp2_u35 Sleef_exp2d8_u35avx512fnofma
+#define yexp2_u35 Sleef_cinz_exp2d8_u35avx512fnofma
+#define xexp10 Sleef_exp10d8_u10avx512fnofma
+#define yexp10 Sleef_cinz_exp10d8_u10avx512fnofma
+#define xexp10_u35 Sleef_exp10d8_u35avx512fnofma
+#define yexp10_u35 Sleef_cinz_exp10d8_u35avx512fnofma
+#define xexpm1 Sleef_expm1d8_u10avx512fnofma
+#define yexpm1 Sleef_cinz_expm1d8_u10avx512fnofma
+#define xlog10 Sleef_log10d8_u10avx512fnofma
+#define ylog10 Sleef_cinz_log10d8_u10avx512fnofma
+#define xlog2 Sleef_log2d8_u10avx512fnofma
+#define ylog2 Sleef_cinz_log2d8_u10avx512fnofma
+#define xlog2_u35 Sleef_log2d8_u35avx512fnofma
+#define ylog2_u35 Sleef_cinz_log2d8_u35avx512fnofma
+#define xlog1p Sleef_log1pd8_u10avx512fnofma
+#define ylog1p Sleef_cinz_log1pd8_u10avx512fnofma
+#define xsincospi_u05 Sleef_sincospid8_u05avx512fnofma
+#define ysincospi_u05 Sleef_cinz_sincospid8_u05avx512fnofma
+#define xsincospi_u35 Sleef_sincospid8_u35avx512fnofma
+#define ysincospi_u35 Sleef_cinz_sincospid8_u35avx512fnofma
+#define xsinpi_u05 Sleef_sinpid8_u05avx512fnofma
+#define ysinpi_u05 Sleef_cinz_sinpid8_u05avx512fnofma
+#define xcospi_u05 Sleef_cospid8_u05avx512fnofma
+#define ycospi_u05 Sleef_cinz_cospid8_u05avx512fnofma
+#define xldexp Sleef_ldexpd8_avx512fnofma
+#define yldexp Sleef_cinz_ldexpd8_avx512fnofma
+#define xilogb Sleef_ilogbd8_avx512fnofma
+#define yilogb Sleef_cinz_ilogbd8_avx512fnofma
+#define xfma Sleef_fmad8_avx512fnofma
+#define yfma Sleef_cinz_fmad8_avx512fnofma
+#define xsqrt Sleef_sqrtd8_avx512fnofma
+#define ysqrt Sleef_cinz_sqrtd8_avx512fnofma
+#define xsqrt_u05 Sleef_sqrtd8_u05avx512fnofma
+#define ysqrt_u05 Sleef_cinz_sqrtd8_u05avx512fnofma
+#define xsqrt_u35 Sleef_sqrtd8_u35avx512fnofma
+#define ysqrt_u35 Sleef_cinz_sqrtd8_u35avx512fnofma
+#define xhypot_u05 Sleef_hypotd8_u05avx512fnofma
+#define yhypot_u05 Sleef_cinz_hypotd8_u05avx512fnofma
+#define xhypot_u35 Sleef_hypotd8_u35avx512fnofma
+#define yhypot_u35 Sleef_cinz_hypotd8_u35avx512fnofma
+#define xfabs Sleef_fabsd8_avx512fnofma
+#define yfabs Sleef_cinz_fabsd8_avx512fnofma
+#define xcopysign Sleef_copysignd8_avx512fnofma
+#define ycopysign Sleef_cinz_copysignd8_avx512fnofma
+#define xfmax Sleef_fmaxd8_avx512fnofma
+#define yfmax Sleef_cinz_fmaxd8_avx512fnofma
+#define xfmin Sleef_fmind8_avx512fnofma
+#define yfmin Sleef_cinz_fmind8_avx512fnofma
+#define xfdim Sleef_fdimd8_avx512fnofma
+#define yfdim Sleef_cinz_fdimd8_avx512fnofma
+#define xtrunc Sleef_truncd8_avx512fnofma
+#define ytrunc Sleef_cinz_truncd8_avx512fnofma
+#define xfloor Sleef_floord8_avx512fnofma
+#define yfloor Sleef_cinz_floord8_avx512fnofma
+#define xceil Sleef_ceild8_avx512fnofma
+#define yceil Sleef_cinz_ceild8_avx512fnofma
+#define xround Sleef_roundd8_avx512fnofma
+#define yround Sleef_cinz_roundd8_avx512fnofma
+#define xrint Sleef_rintd8_avx512fnofma
+#define yrint Sleef_cinz_rintd8_avx512fnofma
+#define xnextafter Sleef_nextafterd8_avx512fnofma
+#define ynextafter Sleef_cinz_nextafterd8_avx512fnofma
+#define xfrfrexp Sleef_frfrexpd8_avx512fnofma
+#define yfrfrexp Sleef_cinz_frfrexpd8_avx512fnofma
+#define xexpfrexp Sleef_expfrexpd8_avx512fnofma
+#define yexpfrexp Sleef_cinz_expfrexpd8_avx512fnofma
+#define xfmod Sleef_fmodd8_avx512fnofma
+#define yfmod Sleef_cinz_fmodd8_avx512fnofma
+#define xremainder Sleef_remainderd8_avx512fnofma
+#define yremainder Sleef_cinz_remainderd8_avx512fnofma
+#define xmodf Sleef_modfd8_avx512fnofma
+#define ymodf Sleef_cinz_modfd8_avx512fnofma
+#define xlgamma_u1 Sleef_lgammad8_u10avx512fnofma
+#define ylgamma_u1 Sleef_cinz_lgammad8_u10avx512fnofma
+#define xtgamma_u1 Sleef_tgammad8_u10avx512fnofma
+#define ytgamma_u1 Sleef_cinz_tgammad8_u10avx512fnofma
+#define xerf_u1 Sleef_erfd8_u10avx512fnofma
+#define yerf_u1 Sleef_cinz_erfd8_u10avx512fnofma
+#define xerfc_u15 Sleef_erfcd8_u15avx512fnofma
+#define yerfc_u15 Sleef_cinz_erfcd8_u15avx512fnofma
+#define xsigmoid Sleef_sigmoidd8_u10avx512fnofma
+#define ysigmoid Sleef_cinz_sigmoidd8_u10avx512fnofma
+#define xsigmoid_u35 Sleef_sigmoidd8_u35avx512fnofma
+#define ysigmoid_u35 Sleef_cinz_sigmoidd8_u35avx512fnofma
+#define xsoftplus Sleef_softplusd8_u10avx512fnofma
+#define ysoftplus Sleef_cinz_softplusd8_u10avx512fnofma
+#define xsoftplus_u35 Sleef_softplusd8_u35avx512fnofma
+#define ysoftplus_u35 Sleef_cinz_softplusd8_u35avx512fnofma
+#define xsilu Sleef_silud8_u10avx512fnofma
+#define ysilu Sleef_cinz_silud8_u10avx512fnofma
+#define xsilu_u35 Sleef_silud8_u35avx512fnofma
+#define ysilu_u35 Sleef_cinz_silud8_u35avx512fnofma
+#define xgelutanh Sleef_gelutanhd8_u10avx512fnofma
+#define ygelutanh Sleef_cinz_gelutanhd8_u10avx512fnofma
+#define xgelutanh_u35 Sleef_gelutanhd8_u35avx512fnofma
+#define ygelutanh_u35 Sleef_cinz_gelutanhd8_u35avx512fnofma
+#define xgelu_u15 Sleef_gelud8_u15avx512fnofma
+#define ygelu_u15 Sleef_cinz_gelud8_u15avx512fnofma
+#define xgetInt Sleef_getIntd8_avx512fnofma
+#define ygetInt Sleef_cinz_getIntd8_avx512fnofma
+#define xgetPtr Sleef_getPtrd8_avx512fnofma
+#define ygetPtr Sleef_cinz_getPtrd8_avx512fnofma
+
+#define xsinf Sleef_sinf16_u35avx512fnofma
+#define ysinf Sleef_cinz_sinf16_u35avx512fnofma
+#define xcosf Sleef_cosf16_u35avx512fnofma
+#define ycosf Sleef_cinz_cosf16_u35avx512fnofma
+#define xsincosf Sleef_sincosf16_u35avx512fnofma
+#define ysincosf Sleef_cinz_sincosf16_u35avx512fnofma
+#define xtanf Sleef_tanf16_u35avx512fnofma
+#define ytanf Sleef_cinz_tanf16_u35avx512fnofma
+#define xasinf Sleef_asinf16_u35avx512fnofma
+#define yasinf Sleef_cinz_asinf16_u35avx512fnofma
+#define xacosf Sleef_acosf16_u35avx512fnofma
+#define yacosf Sleef_cinz_acosf16_u35avx512fnofma
+#define xatanf Sleef_atanf16_u35avx512fnofma
+#define yatanf Sleef_cinz_atanf16_u35avx512fnofma
+#define xatan2f Sleef_atan2f16_u35avx512fnofma
+#define yatan2f Sleef_cinz_atan2f16_u35avx512fnofma
+#define xlogf Sleef_logf16_u35avx512fnofma
+#define ylogf Sleef_cinz_logf16_u35avx512fnofma
+#define xcbrtf Sleef_cbrtf16_u35avx512fnofma
+#define ycbrtf Sleef_cinz_cbrtf16_u35avx512fnofma
+#define xsinf_u1 Sleef_sinf16_u10avx512fnofma
+#define ysinf_u1 Sleef_cinz_sinf16_u10avx512fnofma
+#define xcosf_u1 Sleef_cosf16_u10avx512fnofma
+#define ycosf_u1 Sleef_cinz_cosf16_u10avx512fnofma
+#define xsincosf_u1 Sleef_sincosf16_u10avx512fnofma
+#define ysincosf_u1 Sleef_cinz_sincosf16_u10avx512fnofma
+#define xtanf_u1 Sleef_tanf16_u10avx512fnofma
+#define ytanf_u1 Sleef_cinz_tanf16_u10avx512fnofma
+#define xasinf_u1 Sleef_asinf16_u10avx512fnofma
+#define yasinf_u1 Sleef_cinz_asinf16_u10avx512fnofma
+#define xacosf_u1 Sleef_acosf16_u10avx512fnofma
+#define yacosf_u1 Sleef_cinz_acosf16_u10avx512fnofma
+#define xatanf_u1 Sleef_atanf16_u10avx512fnofma
+#define yatanf_u1 Sleef_cinz_atanf16_u10avx512fnofma
+#define xatan2f_u1 Sleef_atan2f16_u10avx512fnofma
+#define yatan2f_u1 Sleef_cinz_atan2f16_u10avx512fnofma
+#define xlogf_u1 Sleef_logf16_u10avx512fnofma
+#define ylogf_u1 Sleef_cinz_logf16_u10avx512fnofma
+#define xcbrtf_u1 Sleef_cbrtf16_u10avx512fnofma
+#define ycbrtf_u1 Sleef_cinz_cbrtf16_u10avx512fnofma
+#define xexpf Sleef_expf16_u10avx512fnofma
+#define yexpf Sleef_cinz_expf16_u10avx512fnofma
+#define xpowf Sleef_powf16_u10avx512fnofma
+#define ypowf Sleef_cinz_powf16_u10avx512fnofma
+#define xsinhf Sleef_sinhf16_u10avx512fnofma
+#define ysinhf Sleef_cinz_sinhf16_u10avx512fnofma
+#define xcoshf Sleef_coshf16_u10avx512fnofma
+#define ycoshf Sleef_cinz_coshf16_u10avx512fnofma
+#define xtanhf Sleef_tanhf16_u10avx512fnofma
+#define ytanhf Sleef_cinz_tanhf16_u10avx512fnofma
+#define xsinhf_u35 Sleef_sinhf16_u35avx512fnofma
+#define ysinhf_u35 Sleef_cinz_sinhf16_u35avx512fnofma
+#define xcoshf_u35 Sleef_coshf16_u35avx512fnofma
+#define ycoshf_u35 Sleef_cinz_coshf16_u35avx512fnofma
+#define xtanhf_u35 Sleef_tanhf16_u35avx512fnofma
+#define ytanhf_u35 Sleef_cinz_tanhf16_u35avx512fnofma
+#define xfastsinf_u3500 Sleef_fastsinf16_u3500avx512fnofma
+#define yfastsinf_u3500 Sleef_cinz_fastsinf16_u3500avx512fnofma
+#define xfastcosf_u3500 Sleef_fastcosf16_u3500avx512fnofma
+#define yfastcosf_u3500 Sleef_cinz_fastcosf16_u3500avx512fnofma
+#define xfastpowf_u3500 Sleef_fastpowf16_u3500avx512fnofma
+#define yfastpowf_u3500 Sleef_cinz_fastpowf16_u3500avx512fnofma
+#define xfastexpf_u3500 Sleef_fastexpf16_u3500avx512fnofma
+#define yfastexpf_u3500 Sleef_cinz_fastexpf16_u3500avx512fnofma
+#define xfastexp2f_u3500 Sleef_fastexp2f16_u3500avx512fnofma
+#define yfastexp2f_u3500 Sleef_cinz_fastexp2f16_u3500avx512fnofma
+#define xfastlogf_u3500 Sleef_fastlogf16_u3500avx512fnofma
+#define yfastlogf_u3500 Sleef_cinz_fastlogf16_u3500avx512fnofma
+#define xfastlog2f_u3500 Sleef_fastlog2f16_u3500avx512fnofma
+#define yfastlog2f_u3500 Sleef_cinz_fastlog2f16_u3500avx512fnofma
+#define xfasttanhf_u3500 Sleef_fasttanhf16_u3500avx512fnofma
+#define yfasttanhf_u3500 Sleef_cinz_fasttanhf16_u3500avx512fnofma
+#define xfastatan2f_u3500 Sleef_fastatan2f16_u3500avx512fnofma
+#define yfastatan2f_u3500 Sleef_cinz_fastatan2f16_u3500avx512fnofma
+#define xfastrsqrtf_u3500 Sleef_fastrsqrtf16_u3500avx512fnofma
+#define yfastrsqrtf_u3500 Sleef_cinz_fastrsqrtf16_u3500avx512fnofma
+#define xfastrcpf_u3500 Sleef_fastrcpf16_u3500avx512fnofma
+#define yfastrcpf_u3500 Sleef_cinz_fastrcpf16_u3500avx512fnofma
+#define xsinrf_u35 Sleef_sinrf16_u35avx512fnofma
+#define ysinrf_u35 Sleef_cinz_sinrf16_u35avx512fnofma
+#define xcosrf_u35 Sleef_cosrf16_u35avx512fnofma
+#define ycosrf_u35 Sleef_cinz_cosrf16_u35avx512fnofma
+#define xsincosrf_u35 Sleef_sincosrf16_u35avx512fnofma
+#define ysincosrf_u35 Sleef_cinz_sincosrf16_u35avx512fnofma
+#define xtanrf_u35 Sleef_tanrf16_u35avx512fnofma
+#define ytanrf_u35 Sleef_cinz_tanrf16_u35avx512fnofma
+#define xasinhf Sleef_asinhf16_u10avx512fnofma
+#define yasinhf Sleef_cinz_asinhf16_u10avx512fnofma
+#define xacoshf Sleef_acoshf16_u10avx512fnofma
+#define yacoshf Sleef_cinz_acoshf16_u10avx512fnofma
+#define xatanhf Sleef_atanhf16_u10avx512fnofma
+#define yatanhf Sleef_cinz_atanhf16_u10avx512fnofma
+#define xexp2f Sleef_exp2f16_u10avx512fnofma
+#define yexp2f Sleef_cinz_exp2f16_u10avx512fnofma
+#define xexp2f_u35 Sleef_exp2f16_u35avx512fnofma
+#define yexp2f_u35 Sleef_cinz_exp2f16_u35avx512fnofma
+#define xexp10f Sleef_exp10f16_u10avx512fnofma
+#define yexp10f Sleef_cinz_exp10f16_u10avx512fnofma
+#define xexp10f_u35 Sleef_exp10f16_u35avx512fnofma
+#define yexp10f_u35 Sleef_cinz_exp10f16_u35avx512fnofma
+#define xexpm1f Sleef_expm1f16_u10avx512fnofma
+#define yexpm1f Sleef_cinz_expm1f16_u10avx512fnofma
+#define xlog10f Sleef_log10f16_u10avx512fnofma
+#define ylog10f Sleef_cinz_log10f16_u10avx512fnofma
+#define xlog2f Sleef_log2f16_u10avx512fnofma
+#define ylog2f Sleef_cinz_log2f16_u10avx512fnofma
+#define xlog2f_u35 Sleef_log2f16_u35avx512fnofma
+#define ylog2f_u35 Sleef_cinz_log2f16_u35avx512fnofma
+#define xlog1pf Sleef_log1pf16_u10avx512fnofma
+#define ylog1pf Sleef_cinz_log1pf16_u10avx512fnofma
+#define xsincospif_u05 Sleef_sincospif16_u05avx512fnofma
+#define ysincospif_u05 Sleef_cinz_sincospif16_u05avx512fnofma
+#define xsincospif_u35 Sleef_sincospif16_u35avx512fnofma
+#define ysincospif_u35 Sleef_cinz_sincospif16_u35avx512fnofma
+#define xsinpif_u05 Sleef_sinpif16_u05avx512fnofma
+#define ysinpif_u05 Sleef_cinz_sinpif16_u05avx512fnofma
+#define xcospif_u05 Sleef_cospif16_u05avx512fnofma
+#define ycospif_u05 Sleef_cinz_cospif16_u05avx512fnofma
+#define xldexpf Sleef_ldexpf16_avx512fnofma
+#define yldexpf Sleef_cinz_ldexpf16_avx512fnofma
+#define xilogbf Sleef_ilogbf16_avx512fnofma
+#define yilogbf Sleef_cinz_ilogbf16_avx512fnofma
+#define xfmaf Sleef_fmaf16_avx512fnofma
+#define yfmaf Sleef_cinz_fmaf16_avx512fnofma
+#define xsqrtf Sleef_sqrtf16_avx512fnofma
+#define ysqrtf Sleef_cinz_sqrtf16_avx512fnofma
+#define xsqrtf_u05 Sleef_sqrtf16_u05avx512fnofma
+#define ysqrtf_u05 Sleef_cinz_sqrtf16_u05avx512fnofma
+#define xsqrtf_u35 Sleef_sqrtf16_u35avx512fnofma
+#define ysqrtf_u35 Sleef_cinz_sqrtf16_u35avx512fnofma
+#define xhypotf_u05 Sleef_hypotf16_u05avx512fnofma
+#define yhypotf_u05 Sleef_cinz_hypotf16_u05avx512fnofma
+#define xhypotf_u35 Sleef_hypotf16_u35avx512fnofma
+#define yhypotf_u35 Sleef_cinz_hypotf16_u35avx512fnofma
+#define xfabsf Sleef_fabsf16_avx512fnofma
+#define yfabsf Sleef_cinz_fabsf16_avx512fnofma
+#define xcopysignf Sleef_copysignf16_avx512fnofma
+#define ycopysignf Sleef_cinz_copysignf16_avx512fnofma
+#define xfmaxf Sleef_fmaxf16_avx512fnofma
+#define yfmaxf Sleef_cinz_fmaxf16_avx512fnofma
+#define xfminf Sleef_fminf16_avx512fnofma
+#define yfminf Sleef_cinz_fminf16_avx512fnofma
+#define xfdimf Sleef_fdimf16_avx512fnofma
+#define yfdimf Sleef_cinz_fdimf16_avx512fnofma
+#define xtruncf Sleef_truncf16_avx512fnofma
+#define ytruncf Sleef_cinz_truncf16_avx512fnofma
+#define xfloorf Sleef_floorf16_avx512fnofma
+#define yfloorf Sleef_cinz_floorf16_avx512fnofma
+#define xceilf Sleef_ceilf16_avx512fnofma
+#define yceilf Sleef_cinz_ceilf16_avx512fnofma
+#define xroundf Sleef_roundf16_avx512fnofma
+#define yroundf Sleef_cinz_roundf16_avx512fnofma
+#define xrintf Sleef_rintf16_avx512fnofma
+#define yrintf Sleef_cinz_rintf16_avx512fnofma
+#define xnextafterf Sleef_nextafterf16_avx512fnofma
+#define ynextafterf Sleef_cinz_nextafterf16_avx512fnofma
+#define xfrfrexpf Sleef_frfrexpf16_avx512fnofma
+#define yfrfrexpf Sleef_cinz_frfrexpf16_avx512fnofma
+#define xexpfrexpf Sleef_expfrexpf16_avx512fnofma
+#define yexpfrexpf Sleef_cinz_expfrexpf16_avx512fnofma
+#define xfmodf Sleef_fmodf16_avx512fnofma
+#define yfmodf Sleef_cinz_fmodf16_avx512fnofma
+#define xremainderf Sleef_remainderf16_avx512fnofma
+#define yremainderf Sleef_cinz_remainderf16_avx512fnofma
+#define xmodff Sleef_modff16_avx512fnofma
+#define ymodff Sleef_cinz_modff16_avx512fnofma
+#define xlgammaf_u1 Sleef_lgammaf16_u10avx512fnofma
+#define ylgammaf_u1 Sleef_cinz_lgammaf16_u10avx512fnofma
+#define xtgammaf_u1 Sleef_tgammaf16_u10avx512fnofma
+#define ytgammaf_u1 Sleef_cinz_tgammaf16_u10avx512fnofma
+#define xerff_u1 Sleef_erff16_u10avx512fnofma
+#define yerff_u1 Sleef_cinz_erff16_u10avx512fnofma
+#define xerfcf_u15 Sleef_erfcf16_u15avx512fnofma
+#define yerfcf_u15 Sleef_cinz_erfcf16_u15avx512fnofma
+#define xsigmoidf Sleef_sigmoidf16_u10avx512fnofma
+#define ysigmoidf Sleef_cinz_sigmoidf16_u10avx512fnofma
+#define xsigmoidf_u35 Sleef_sigmoidf16_u35avx512fnofma
+#define ysigmoidf_u35 Sleef_cinz_sigmoidf16_u35avx512fnofma
+#define xsoftplusf Sleef_softplusf16_u10avx512fnofma
+#define ysoftplusf Sleef_cinz_softplusf16_u10avx512fnofma
+#define xsoftplusf_u35 Sleef_softplusf16_u35avx512fnofma
+#define ysoftplusf_u35 Sleef_cinz_softplusf16_u35avx512fnofma
+#define xsiluf Sleef_siluf16_u10avx512fnofma
+#define ysiluf Sleef_cinz_siluf16_u10avx512fnofma
+#define xsiluf_u35 Sleef_siluf16_u35avx512fnofma
+#define ysiluf_u35 Sleef_cinz_siluf16_u35avx512fnofma
+#define xgelutanhf Sleef_gelutanhf16_u10avx512fnofma
+#define ygelutanhf Sleef_cinz_gelutanhf16_u10avx512fnofma
+#define xgelutanhf_u35 Sleef_gelutanhf16_u35avx512fnofma
+#define ygelutanhf_u35 Sleef_cinz_gelutanhf16_u35avx512fnofma
+#define xgeluf_u15 Sleef_geluf16_u15avx512fnofma
+#define ygeluf_u15 Sleef_cinz_geluf16_u15avx512fnofma
+#define xgetIntf Sleef_getIntf16_avx512fnofma
+#define ygetIntf Sleef_cinz_getIntf16_avx512fnofma
+#define xgetPtrf Sleef_getPtrf16_avx512fnofma
+#define ygetPtrf Sleef_cinz_getPtrf16_avx512fnofma
+
+#define xsinf16_u1 Sleef_sinh16_u10avx512fnofma
+#define xcosf16_u1 Sleef_cosh16_u10avx512fnofma
+#define xtanf16_u1 Sleef_tanh16_u10avx512fnofma
+#define xasinf16_u1 Sleef_asinh16_u10avx512fnofma
+#define xacosf16_u1 Sleef_acosh16_u10avx512fnofma
+#define xatanf16_u1 Sleef_atanh16_u10avx512fnofma
+#define xatan2f16_u1 Sleef_atan2h16_u10avx512fnofma
+#define xlogf16_u1 Sleef_logh16_u10avx512fnofma
+#define xcbrtf16_u1 Sleef_cbrth16_u10avx512fnofma
+#define xexpf16 Sleef_exph16_u10avx512fnofma
+#define xpowf16 Sleef_powh16_u10avx512fnofma
+#define xsinhf16 Sleef_sinhh16_u10avx512fnofma
+#define xcoshf16 Sleef_coshh16_u10avx512fnofma
+#define xtanhf16 Sleef_tanhh16_u10avx512fnofma
+#define xasinhf16 Sleef_asinhh16_u10avx512fnofma
+#define xacoshf16 Sleef_acoshh16_u10avx512fnofma
+#define xatanhf16 Sleef_atanhh16_u10avx512fnofma
+#define xexp2f16 Sleef_exp2h16_u10avx512fnofma
+#define xexp10f16 Sleef_exp10h16_u10avx512fnofma
+#define xexpm1f16 Sleef_expm1h16_u10avx512fnofma
+#define xlog10f16 Sleef_log10h16_u10avx512fnofma
+#define xlog2f16 Sleef_log2h16_u10avx512fnofma
+#define xlog1pf16 Sleef_log1ph16_u10avx512fnofma
+#define xsqrtf16 Sleef_sqrth16_avx512fnofma
+#define xlgammaf16_u1 Sleef_lgammah16_u10avx512fnofma
+#define xtgammaf16_u1 Sleef_tgammah16_u10avx512fnofma
+#define xerff16_u1 Sleef_erfh16_u10avx512fnofma
+#define xerfcf16_u15 Sleef_erfch16_u15avx512fnofma
+#define xsigmoidf16 Sleef_sigmoidh16_u10avx512fnofma
+#define xsoftplusf16 Sleef_softplush16_u10avx512fnofma
+#define xsiluf16 Sleef_siluh16_u10avx512fnofma
+#define xgelutanhf16 Sleef_gelutanhh16_u10avx512fnofma
+#define xgeluf16_u15 Sleef_geluh16_u15avx512fnofma
+
+#define xsinbf16_u1 Sleef_sinbf16x16_u10avx512fnofma
+#define xcosbf16_u1 Sleef_cosbf16x16_u10avx512fnofma
+#define xlogbf16_u1 Sleef_logbf16x16_u10avx512fnofma
+#define xexpbf16 Sleef_expbf16x16_u10avx512fnofma
+#define xpowbf16 Sleef_powbf16x16_u10avx512fnofma
+#define xtanhbf16 Sleef_tanhbf16x16_u10avx512fnofma
+#define xexp2bf16 Sleef_exp2bf16x16_u10avx512fnofma
+#define xexp10bf16 Sleef_exp10bf16x16_u10avx512fnofma
+#define xexpm1bf16 Sleef_expm1bf16x16_u10avx512fnofma
+#define xlog10bf16 Sleef_log10bf16x16_u10avx512fnofma
+#define xlog2bf16 Sleef_log2bf16x16_u10avx512fnofma
+#define xlog1pbf16 Sleef_log1pbf16x16_u10avx512fnofma
+#define xsqrtbf16 Sleef_sqrtbf16x16_avx512fnofma
+#define xerfbf16_u1 Sleef_erfbf16x16_u10avx512fnofma
+#define xerfcbf16_u15 Sleef_erfcbf16x16_u15avx512fnofma
+#define xsigmoidbf16 Sleef_sigmoidbf16x16_u10avx512fnofma
+#define xsoftplusbf16 Sleef_softplusbf16x16_u10avx512fnofma
+#define xsilubf16 Sleef_silubf16x16_u10avx512fnofma
+#define xgelutanhbf16 Sleef_gelutanhbf16x16_u10avx512fnofma
+#define xgelubf16_u15 Sleef_gelubf16x16_u15avx512fnofma
+
+#else //#ifndef DETERMINISTIC
+
+#define xsin Sleef_cinz_sind8_u35avx512fnofma
+#define xcos Sleef_cinz_cosd8_u35avx512fnofma
+#define xsincos Sleef_cinz_sincosd8_u35avx512fnofma
+#define xtan Sleef_cinz_tand8_u35avx512fnofma
+#define xasin Sleef_cinz_asind8_u35avx512fnofma
+#define xacos Sleef_cinz_acosd8_u35avx512fnofma
+#define xatan Sleef_cinz_atand8_u35avx512fnofma
+#define xatan2 Sleef_cinz_atan2d8_u35avx512fnofma
+#define xlog Sleef_cinz_logd8_u35avx512fnofma
+#define xcbrt Sleef_cinz_cbrtd8_u35avx512fnofma
+#define xsin_u1 Sleef_cinz_sind8_u10avx512fnofma
+#define xcos_u1 Sleef_cinz_cosd8_u10avx512fnofma
+#define xsincos_u1 Sleef_cinz_sincosd8_u10avx512fnofma
+#define xtan_u1 Sleef_cinz_tand8_u10avx512fnofma
+#define xasin_u1 Sleef_cinz_asind8_u10avx512fnofma
+#define xacos_u1 Sleef_cinz_acosd8_u10avx512fnofma
+#define xatan_u1 Sleef_cinz_atand8_u10avx512fnofma
+#define xatan2_u1 Sleef_cinz_atan2d8_u10avx512fnofma
+#define xlog_u1 Sleef_cinz_logd8_u10avx512fnofma
+#define xcbrt_u1 Sleef_cinz_cbrtd8_u10avx512fnofma
+#define xexp Sleef_cinz_expd8_u10avx512fnofma
+#define xpow Sleef_cinz_powd8_u10avx512fnofma
+#define xsinh Sleef_cinz_sinhd8_u10avx512fnofma
+#define xcosh Sleef_cinz_coshd8_u10avx512fnofma
+#define xtanh Sleef_cinz_tanhd8_u10avx512fnofma
+#define xsinh_u35 Sleef_cinz_sinhd8_u35avx512fnofma
+#define xcosh_u35 Sleef_cinz_coshd8_u35avx512fnofma
+#define xtanh_u35 Sleef_cinz_tanhd8_u35avx512fnofma
+#define xfastsin_u3500 Sleef_cinz_fastsind8_u3500avx512fnofma
+#define xfastcos_u3500 Sleef_cinz_fastcosd8_u3500avx512fnofma
+#define xfastpow_u3500 Sleef_cinz_fastpowd8_u3500avx512fnofma
+#define xfastexp_u3500 Sleef_cinz_fastexpd8_u3500avx512fnofma
+#define xfastexp2_u3500 Sleef_cinz_fastexp2d8_u3500avx512fnofma
+#define xfastlog_u3500 Sleef_cinz_fastlogd8_u3500avx512fnofma
+#define xfastlog2_u3500 Sleef_cinz_fastlog2d8_u3500avx512fnofma
+#define xfasttanh_u3500 Sleef_cinz_fasttanhd8_u3500avx512fnofma
+#define xfastatan2_u3500 Sleef_cinz_fastatan2d8_u3500avx512fnofma
+#define xfastrsqrt_u3500 Sleef_cinz_fastrsqrtd8_u3500avx512fnofma
+#define xfastrcp_u3500 Sleef_cinz_fastrcpd8_u3500avx512fnofma
+#define xsinr_u35 Sleef_cinz_sinrd8_u35avx512fnofma
+#define xcosr_u35 Sleef_cinz_cosrd8_u35avx512fnofma
+#define xsincosr_u35 Sleef_cinz_sincosrd8_u35avx512fnofma
+#define xtanr_u35 Sleef_cinz_tanrd8_u35avx512fnofma
+#define xasinh Sleef_cinz_asinhd8_u10avx512fnofma
+#define xacosh Sleef_cinz_acoshd8_u10avx512fnofma
+#define xatanh Sleef_cinz_atanhd8_u10avx512fnofma
+#define xexp2 Sleef_cinz_exp2d8_u10avx512fnofma
+#define xexp2_u35 Sleef_cinz_exp2d8_u35avx512fnofma
+#define xexp10 Sleef_cinz_exp10d8_u10avx512fnofma
+#define xexp10_u35 Sleef_cinz_exp10d8_u35avx512fnofma
+#define xexpm1 Sleef_cinz_expm1d8_u10avx512fnofma
+#define xlog10 Sleef_cinz_log10d8_u10avx512fnofma
+#define xlog2 Sleef_cinz_log2d8_u10avx512fnofma
+#define xlog2_u35 Sleef_cinz_log2d8_u35avx512fnofma
+#define xlog1p Sleef_cinz_log1pd8_u10avx512fnofma
+#define xsincospi_u05 Sleef_cinz_sincospid8_u05avx512fnofma
+#define xsincospi_u35 Sleef_cinz_sincospid8_u35avx512fnofma
+#define xsinpi_u05 Sleef_cinz_sinpid8_u05avx512fnofma
+#define xcospi_u05 Sleef_cinz_cospid8_u05avx512fnofma
+#define xldexp Sleef_cinz_ldexpd8_avx512fnofma
+#define xilogb Sleef_cinz_ilogbd8_avx512fnofma
+#define xfma Sleef_cinz_fmad8_avx512fnofma
+#define xsqrt Sleef_cinz_sqrtd8_avx512fnofma
+#define xsqrt_u05 Sleef_cinz_sqrtd8_u05avx512fnofma
+#define xsqrt_u35 Sleef_cinz_sqrtd8_u35avx512fnofma
+#define xhypot_u05 Sleef_cinz_hypotd8_u05avx512fnofma
+#define xhypot_u35 Sleef_cinz_hypotd8_u35avx512fnofma
+#define xfabs Sleef_cinz_fabsd8_avx512fnofma
+#define xcopysign Sleef_cinz_copysignd8_avx512fnofma
+#define xfmax Sleef_cinz_fmaxd8_avx512fnofma
+#define xfmin Sleef_cinz_fmind8_avx512fnofma
+#define xfdim Sleef_cinz_fdimd8_avx512fnofma
+#define xtrunc Sleef_cinz_truncd8_avx512fnofma
+#define xfloor Sleef_cinz_floord8_avx512fnofma
+#define xceil Sleef_cinz_ceild8_avx512fnofma
+#define xround Sleef_cinz_roundd8_avx512fnofma
+#define xrint Sleef_cinz_rintd8_avx512fnofma
+#define xnextafter Sleef_cinz_nextafterd8_avx512fnofma
+#define xfrfrexp Sleef_cinz_frfrexpd8_avx512fnofma
+#define xexpfrexp Sleef_cinz_expfrexpd8_avx512fnofma
+#define xfmod Sleef_cinz_fmodd8_avx512fnofma
+#define xremainder Sleef_cinz_remainderd8_avx512fnofma
+#define xmodf Sleef_cinz_modfd8_avx512fnofma
+#define xlgamma_u1 Sleef_cinz_lgammad8_u10avx512fnofma
+#define xtgamma_u1 Sleef_cinz_tgammad8_u10avx512fnofma
+#define xerf_u1 Sleef_cinz_erfd8_u10avx512fnofma
+#define xerfc_u15 Sleef_cinz_erfcd8_u15avx512fnofma
+#define xsigmoid Sleef_cinz_sigmoidd8_u10avx512fnofma
+#define xsigmoid_u35 Sleef_cinz_sigmoidd8_u35avx512fnofma
+#define xsoftplus Sleef_cinz_softplusd8_u10avx512fnofma
+#define xsoftplus_u35 Sleef_cinz_softplusd8_u35avx512fnofma
+#define xsilu Sleef_cinz_silud8_u10avx512fnofma
+#define xsilu_u35 Sleef_cinz_silud8_u35avx512fnofma
+#define xgelutanh Sleef_cinz_gelutanhd8_u10avx512fnofma
+#define xgelutanh_u35 Sleef_cinz_gelutanhd8_u35avx512fnofma
+#define xgelu_u15 Sleef_cinz_gelud8_u15avx512fnofma
+#define xgetInt Sleef_cinz_getIntd8_avx512fnofma
+#define xgetPtr Sleef_cinz_getPtrd8_avx512fnofma
+
+#define xsinf Sleef_cinz_sinf16_u35avx512fnofma
+#define xcosf Sleef_cinz_cosf16_u35avx512fnofma
+#define xsincosf Sleef_cinz_sincosf16_u35avx512fnofma
+#define xtanf Sleef_cinz_tanf16_u35avx512fnofma
+#define xasinf Sleef_cinz_asinf16_u35avx512fnofma
+#define xacosf Sleef_cinz_acosf16_u35avx512fnofma
+#define xatanf Sleef_cinz_atanf16_u35avx512fnofma
+#define xatan2f Sleef_cinz_atan2f16_u35avx512fnofma
+#define xlogf Sleef_cinz_logf16_u35avx512fnofma
+#define xcbrtf Sleef_cinz_cbrtf16_u35avx512fnofma
+#define xsinf_u1 Sleef_cinz_sinf16_u10avx512fnofma
+#define xcosf_u1 Sleef_cinz_cosf16_u10avx512fnofma
+#define xsincosf_u1 Sleef_cinz_sincosf16_u10avx512fnofma
+#define xtanf_u1 Sleef_cinz_tanf16_u10avx512fnofma
+#define xasinf_u1 Sleef_cinz_asinf16_u10avx512fnofma
+#define xacosf_u1 Sleef_cinz_acosf16_u10avx512fnofma
+#define xatanf_u1 Sleef_cinz_atanf16_u10avx512fnofma
+#define xatan2f_u1 Sleef_cinz_atan2f16_u10avx512fnofma
+#define xlogf_u1 Sleef_cinz_logf16_u10avx512fnofma
+#define xcbrtf_u1 Sleef_cinz_cbrtf16_u10avx512fnofma
+#define xexpf Sleef_cinz_expf16_u10avx512fnofma
+#define xpowf Sleef_cinz_powf16_u10avx512fnofma
+#define xsinhf Sleef_cinz_sinhf16_u10avx512fnofma
+#define xcoshf Sleef_cinz_coshf16_u10avx512fnofma
+#define xtanhf Sleef_cinz_tanhf16_u10avx512fnofma
+#define xsinhf_u35 Sleef_cinz_sinhf16_u35avx512fnofma
+#define xcoshf_u35 Sleef_cinz_coshf16_u35avx512fnofma
+#define xtanhf_u35 Sleef_cinz_tanhf16_u35avx512fnofma
+#define xfastsinf_u3500 Sleef_cinz_fastsinf16_u3500avx512fnofma
+#define xfastcosf_u3500 Sleef_cinz_fastcosf16_u3500avx512fnofma
+#define xfastpowf_u3500 Sleef_cinz_fastpowf16_u3500avx512fnofma
+#define xfastexpf_u3500 Sleef_cinz_fastexpf16_u3500avx512fnofma
+#define xfastexp2f_u3500 Sleef_cinz_fastexp2f16_u3500avx512fnofma
+#define xfastlogf_u3500 Sleef_cinz_fastlogf16_u3500avx512fnofma
+#define xfastlog2f_u3500 Sleef_cinz_fastlog2f16_u3500avx512fnofma
+#define xfasttanhf_u3500 Sleef_cinz_fasttanhf16_u3500avx512fnofma
+#define xfastatan2f_u3500 Sleef_cinz_fastatan2f16_u3500avx512fnofma
+#define xfastrsqrtf_u3500 Sleef_cinz_fastrsqrtf16_u3500avx512fnofma
+#define xfastrcpf_u3500 Sleef_cinz_fastrcpf16_u3500avx512fnofma
+#define xsinrf_u35 Sleef_cinz_sinrf16_u35avx512fnofma
+#define xcosrf_u35 Sleef_cinz_cosrf16_u35avx512fnofma
+#define xsincosrf_u35 Sleef_cinz_sincosrf16_u35avx512fnofma
+#define xtanrf_u35 Sleef_cinz_tanrf16_u35avx512fnofma
+#define xasinhf Sleef_cinz_asinhf16_u10avx512fnofma
+#define xacoshf Sleef_cinz_acoshf16_u10avx512fnofma
+#define xatanhf Sleef_cinz_atanhf16_u10avx512fnofma
+#define xexp2f Sleef_cinz_exp2f16_u10avx512fnofma
+#define xexp2f_u35 Sleef_cinz_exp2f16_u35avx512fnofma
+#define xexp10f Sleef_cinz_exp10f16_u10avx512fnofma
+#define xexp10f_u35 Sleef_cinz_exp10f16_u35avx512fnofma
+#define xexpm1f Sleef_cinz_expm1f16_u10avx512fnofma
+#define xlog10f Sleef_cinz_log10f16_u10avx512fnofma
+#define xlog2f Sleef_cinz_log2f16_u10avx512fnofma
+#define xlog2f_u35 Sleef_cinz_log2f16_u35avx512fnofma
+#define xlog1pf Sleef_cinz_log1pf16_u10avx512fnofma
+#define xsincospif_u05 Sleef_cinz_sincospif16_u05avx512fnofma
+#define xsincospif_u35 Sleef_cinz_sincospif16_u35avx512fnofma
+#define xsinpif_u05 Sleef_cinz_sinpif16_u05avx512fnofma
+#define xcospif_u05 Sleef_cinz_cospif16_u05avx512fnofma
+#define xldexpf Sleef_cinz_ldexpf16_avx512fnofma
+#define xilogbf Sleef_cinz_ilogbf16_avx512fnofma
+#define xfmaf Sleef_cinz_fmaf16_avx512fnofma
+#define xsqrtf Sleef_cinz_sqrtf16_avx512fnofma
+#define xsqrtf_u05 Sleef_cinz_sqrtf16_u05avx512fnofma
+#define xsqrtf_u35 Sleef_cinz_sqrtf16_u35avx512fnofma
+#define xhypotf_u05 Sleef_cinz_hypotf16_u05avx512fnofma
+#define xhypotf_u35 Sleef_cinz_hypotf16_u35avx512fnofma
+#define xfabsf Sleef_cinz_fabsf16_avx512fnofma
+#define xcopysignf Sleef_cinz_copysignf16_avx512fnofma
+#define xfmaxf Sleef_cinz_fmaxf16_avx512fnofma
+#define xfminf Sleef_cinz_fminf16_avx512fnofma
+#define xfdimf Sleef_cinz_fdimf16_avx512fnofma
+#define xtruncf Sleef_cinz_truncf16_avx512fnofma
+#define xfloorf Sleef_cinz_floorf16_avx512fnofma
+#define xceilf Sleef_cinz_ceilf16_avx512fnofma
+#define xroundf Sleef_cinz_roundf16_avx512fnofma
+#define xrintf Sleef_cinz_rintf16_avx512fnofma
+#define xnextafterf Sleef_cinz_nextafterf16_avx512fnofma
+#define xfrfrexpf Sleef_cinz_frfrexpf16_avx512fnofma
+#define xexpfrexpf Sleef_cinz_expfrexpf16_avx512fnofma
+#define xfmodf Sleef_cinz_fmodf16_avx512fnofma
+#define xremainderf Sleef_cinz_remainderf16_avx512fnofma
+#define xmodff Sleef_cinz_modff16_avx512fnofma
+#define xlgammaf_u1 Sleef_cinz_lgammaf16_u10avx512fnofma
+#define xtgammaf_u1 Sleef_cinz_tgammaf16_u10avx512fnofma
+#define xerff_u1 Sleef_cinz_erff16_u10avx512fnofma
+#define xerfcf_u15 Sleef_cinz_erfcf16_u15avx512fnofma
+#define xsigmoidf Sleef_cinz_sigmoidf16_u10avx512fnofma
+#define xsigmoidf_u35 Sleef_cinz_sigmoidf16_u35avx512fnofma
+#define xsoftplusf Sleef_cinz_softplusf16_u10avx512fnofma
+#define xsoftplusf_u35 Sleef_cinz_softplusf16_u35avx512fnofma
+#define xsiluf Sleef_cinz_siluf16_u10avx512fnofma
+#define xsiluf_u35 Sleef_cinz_siluf16_u35avx512fnofma
+#define xgelutanhf Sleef_cinz_gelutanhf16_u10avx512fnofma
+#define xgelutanhf_u35 Sleef_cinz_gelutanhf16_u35avx512fnofma
+#define xgeluf_u15 Sleef_cinz_geluf16_u15avx512fnofma
+#define xgetIntf Sleef_cinz_getIntf16_avx512fnofma
+#define xgetPtrf Sleef_cinz_getPtrf16_avx512fnofma
+
+#endif // #ifndef DETERMINISTIC
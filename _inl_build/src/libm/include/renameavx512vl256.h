@@ -0,0 +1,652 @@
+#ifndef DETERMINISTIC
+
+#define xsin Sleef_sind4_u35avx512vl256
+#define ysin Sleef_finz_sind4_u35avx512vl256
+#define xcos Sleef_cosd4_u35avx512vl256
+#define ycos Sleef_finz_cosd4_u35avx512vl256
+#define xsincos Sleef_sincosd4_u35avx512vl256
+#define ysincos Sleef_finz_sincosd4_u35avx512vl256
+#define xtan Sleef_tand4_u35avx512vl256
+#define ytan Sleef_finz_tand4_u35avx512vl256
+#define xasin Sleef_asind4_u35avx512vl256
+#define yasin Sleef_finz_asind4_u35avx512vl256
+#define xacos Sleef_acosd4_u35avx512vl256
+#define yacos Sleef_finz_acosd4_u35avx512vl256
+#define xatan Sleef_atand4_u35avx512vl256
+#define yatan Sleef_finz_atand4_u35avx512vl256
+#define xatan2 Sleef_atan2d4_u35avx512vl256
+#define yatan2 Sleef_finz_atan2d4_u35avx512vl256
+#define xlog Sleef_logd4_u35avx512vl256
+#define ylog Sleef_finz_logd4_u35avx512vl256
+#define xcbrt Sleef_cbrtd4_u35avx512vl256
+#define ycbrt Sleef_finz_cbrtd4_u35avx512vl256
+#define xsin_u1 Sleef_sind4_u10avx512vl256
+#define ysin_u1 Sleef_finz_sind4_u10avx512vl256
+#define xcos_u1 Sleef_cosd4_u10avx512vl256
+#define ycos_u1 Sleef_finz_cosd4_u10avx512vl256
+#define xsincos_u1 Sleef_sincosd4_u10avx512vl256
+#define ysincos_u1 Sleef_finz_sincosd4_u10avx512vl256
+#define xtan_u1 Sleef_tand4_u10avx512vl256
+#define ytan_u1 Sleef_finz_tand4_u10avx512vl256
+#define xasin_u1 Sleef_asind4_u10avx512vl256
+#define yasin_u1 Sleef_finz_asind4_u10avx512vl256
+#define xacos_u1 Sleef_acosd4_u10avx512vl256
+#define yacos_u1 Sleef_finz_acosd4_u10avx512vl256
+#define xatan_u1 Sleef_atand4_u10avx512vl256
+#define yatan_u1 Sleef_finz_atand4_u10avx512vl256
+#define xatan2_u1 Sleef_atan2d4_u10avx512vl256
+#define yatan2_u1 Sleef_finz_atan2d4_u10avx512vl256
+#define xlog_u1 Sleef_logd4_u10avx512vl256
+#define ylog_u1 Sleef_finz_logd4_u10avx512vl256
+#define xcbrt_u1 Sleef_cbrtd4_u10avx512vl256
+#define ycbrt_u1 Sleef_finz_cbrtd4_u10avx512vl256
+#define xexp Sleef_expd4_u10avx512vl256
+#define yexp Sleef_finz_expd4_u10avx512vl256
+#define xpow Sleef_powd4_u10avx512vl256
+#define ypow Sleef_finz_powd4_u10avx512vl256
+#define xsinh Sleef_sinhd4_u10avx512vl256
+#define ysinh Sleef_finz_sinhd4_u10avx512vl256
+#define xcosh Sleef_coshd4_u10avx512vl256
+#define ycosh Sleef_finz_coshd4_u10avx512vl256
+#define xtanh Sleef_tanhd4_u10avx512vl256
+#define ytanh Sleef_finz_tanhd4_u10avx512vl256
+#define xsinh_u35 Sleef_sinhd4_u35avx512vl256
+#define ysinh_u35 Sleef_finz_sinhd4_u35avx512vl256
+#define xcosh_u35 Sleef_coshd4_u35avx512vl256
+#define ycosh_u35 Sleef_finz_coshd4_u35avx512vl256
+#define xtanh_u35 Sleef_tanhd4_u35avx512vl256
+#define ytanh_u35 Sleef_finz_tanhd4_u35avx512vl256
+#define xfastsin_u3500 Sleef_fastsind4_u3500avx512vl256
+#define yfastsin_u3500 Sleef_finz_fastsind4_u3500avx512vl256
+#define xfastcos_u3500 Sleef_fastcosd4_u3500avx512vl256
+#define yfastcos_u3500 Sleef_finz_fastcosd4_u3500avx512vl256
+#define xfastpow_u3500 Sleef_fastpowd4_u3500avx512vl256
+#define yfastpow_u3500 Sleef_finz_fastpowd4_u3500avx512vl256
+#define xfastexp_u3500 Sleef_fastexpd4_u3500avx512vl256
+#define yfastexp_u3500 Sleef_finz_fastexpd4_u3500avx512vl256
+#define xfastexp2_u3500 Sleef_fastexp2d4_u3500avx512vl256
+#define yfastexp2_u3500 Sleef_finz_fastexp2d4_u3500avx512vl256
+#define xfastlog_u3500 Sleef_fastlogd4_u3500avx512vl256
+#define yfastlog_u3500 Sleef_finz_fastlogd4_u3500avx512vl256
+#define xfastlog2_u3500 Sleef_fastlog2d4_u3500avx512vl256
+#define yfastlog2_u3500 Sleef_finz_fastlog2d4_u3500avx512vl256
+#define xfasttanh_u3500 Sleef_fasttanhd4_u3500avx512vl256
+#define yfasttanh_u3500 Sleef_finz_fasttanhd4_u3500avx512vl256
+#define xfastatan2_u3500 Sleef_fastatan2d4_u3500avx512vl256
+#define yfastatan2_u3500 Sleef_finz_fastatan2d4_u3500avx512vl256
+#define xfastrsqrt_u3500 Sleef_fastrsqrtd4_u3500avx512vl256
+#define yfastrsqrt_u3500 Sleef_finz_fastrsqrtd4_u3500avx512vl256
+#define xfastrcp_u3500 Sleef_fastrcpd4_u3500avx512vl256
+#define yfastrcp_u3500 Sleef_finz_fastrcpd4_u3500avx512vl256
+#define xsinr_u35 Sleef_sinrd4_u35avx512vl256
+#define ysinr_u35 Sleef_finz_sinrd4_u35avx512vl256
+#define xcosr_u35 Sleef_cosrd4_u35avx512vl256
+#define ycosr_u35 Sleef_finz_cosrd4_u35avx512vl256
+#define xsincosr_u35 Sleef_sincosrd4_u35avx512vl256
+#define ysincosr_u35 Sleef_finz_sincosrd4_u35avx512vl256
+#define xtanr_u35 Sleef_tanrd4_u35avx512vl256
+#define ytanr_u35 Sleef_finz_tanrd4_u35avx512vl256
+#define xasinh Sleef_asinhd4_u10avx512vl256
+#define yasinh Sleef_finz_asinhd4_u10avx512vl256
+#define xacosh Sleef_acoshd4_u10avx512vl256
+#define yacosh Sleef_finz_acoshd4_u10avx512vl256
+#define xatanh Sleef_atanhd4_u10avx512vl256
+#define yatanh Sleef_finz_atanhd4_u10avx512vl256
+#define xexp2 Sleef_exp2d4_u10avx512vl256
+#define yexp2 Sleef_finz_exp2d4_u10avx512vl256
+#define xexp2_u35 Sleef_exp2d4_u35avx512vl256
+#define yexp2_u35 Sleef_finz_exp2d4_u35avx512vl256
+#define xexp10 Sleef_exp10d4_u10avx512vl256
+#define yexp10 Sleef_finz_exp10d4_u10avx512vl256
+#define xexp10_u35 Sleef_exp10d4_u35avx512vl256
+#define yexp10_u35 Sleef_finz_exp10d4_u35avx512vl256
+#define xexpm1 Sleef_expm1d4_u10avx512vl256
+#define yexpm1 Sleef_finz_expm1d4_u10avx512vl256
+#define xlog10 Sleef_log10d4_u10avx512vl256
+#define ylog10 Sleef_finz_log10d4_u10avx512vl256
+#define xlog2 Sleef_log2d4_u10avx512vl256
+#define ylog2 Sleef_finz_log2d4_u10avx512vl256
+#define xlog2_u35 Sleef_log2d4_u35avx512vl256
+#define ylog2_u35 Sleef_finz_log2d4_u35avx512vl256
+#define xlog1p Sleef_log1pd4_u10avx512vl256
+#define ylog1p Sleef_finz_log1pd4_u10avx512vl256
+#define xsincospi_u05 Sleef_sincospid4_u05avx512vl256
+#define ysincospi_u05 Sleef_finz_sincospid4_u05avx512vl256
+#define xsincospi_u35 Sleef_sincospid4_u35avx512vl256
+#define ysincospi_u35 Sleef_finz_sincospid4_u35avx512vl256
+#define xsinpi_u05 Sleef_sinpid4_u05avx512vl256
+#define ysinpi_u05 Sleef_finz_sinpid4_u05avx512vl256
+#define xcospi_u05 Sleef_cospid4_u05avx512vl256
+#define ycospi_u05 Sleef_finz_cospid4_u05avx512vl256
+#define xldexp Sleef_ldexpd4_avx512vl256
+#define yldexp Sleef_finz_ldexpd4_avx512vl256
+#define xilogb Sleef_ilogbd4_avx512vl256
+#define yilogb Sleef_finz_ilogbd4_avx512vl256
+#define xfma Sleef_fmad4_avx512vl256
+#define yfma Sleef_finz_fmad4_avx512vl256
+#define xsqrt Sleef_sqrtd4_avx512vl256
+#define ysqrt Sleef_finz_sqrtd4_avx512vl256
+#define xsqrt_u05 Sleef_sqrtd4_u05avx512vl256
+#define ysqrt_u05 Sleef_finz_sqrtd4_u05avx512vl256
+#define xsqrt_u35 Sleef_sqrtd4_u35avx512vl256
+#define ysqrt_u35 Sleef_finz_sqrtd4_u35avx512vl256
+#define xhypot_u05 Sleef_hypotd4_u05avx512vl256
+#define yhypot_u05 Sleef_finz_hypotd4_u05avx512vl256
+#define xhypot_u35 Sleef_hypotd4_u35avx512vl256
+#define yhypot_u35 Sleef_finz_hypotd4_u35avx512vl256
+#define xfabs Sleef_fabsd4_avx512vl256
+#define yfabs Sleef_finz_fabsd4_avx512vl256
+#define xcopysign Sleef_copysignd4_avx512vl256
+#define ycopysign Sleef_finz_copysignd4_avx512vl256
+#define xfmax Sleef_fmaxd4_avx512vl256
+#define yfmax Sleef_finz_fmaxd4_avx512vl256
+#define xfmin Sleef_fmind4_avx512vl256
+#define yfmin Sleef_finz_fmind4_avx512vl256
+#define xfdim Sleef_fdimd4_avx512vl256
+#define yfdim Sleef_finz_fdimd4_avx512vl256
+#define xtrunc Sleef_truncd4_avx512vl256
+#define ytrunc Sleef_finz_truncd4_avx512vl256
+#define xfloor Sleef_floord4_avx512vl256
+#define yfloor Sleef_finz_floord4_avx512vl256
+#define xceil Sleef_ceild4_avx512vl256
+#define yceil Sleef_finz_ceild4_avx512vl256
+#define xround Sleef_roundd4_avx512vl256
+#define yround Sleef_finz_roundd4_avx512vl256
+#define xrint Sleef_rintd4_avx512vl256
+#define yrint Sleef_finz_rintd4_avx512vl256
+#define xnextafter Sleef_nextafterd4_avx512vl256
+#define ynextafter Sleef_finz_nextafterd4_avx512vl256
+#define xfrfrexp Sleef_frfrexpd4_avx512vl256
+#define yfrfrexp Sleef_finz_frfrexpd4_avx512vl256
+#define xexpfrexp Sleef_expfrexpd4_avx512vl256
+#define yexpfrexp Sleef_finz_expfrexpd4_avx512vl256
+#define xfmod Sleef_fmodd4_avx512vl256
+#define yfmod Sleef_finz_fmodd4_avx512vl256
+#define xremainder Sleef_remainderd4_avx512vl256
+#define yremainder Sleef_finz_remainderd4_avx512vl256
+#define xmodf Sleef_modfd4_avx512vl256
+#define ymodf Sleef_finz_modfd4_avx512vl256
+#define xlgamma_u1 Sleef_lgammad4_u10avx512vl256
+#define ylgamma_u1 Sleef_finz_lgammad4_u10avx512vl256
+#define xtgamma_u1 Sleef_tgammad4_u10avx512vl256
+#define ytgamma_u1 Sleef_finz_tgammad4_u10avx512vl256
+#define xerf_u1 Sleef_erfd4_u10avx512vl256
+#define yerf_u1 Sleef_finz_erfd4_u10avx512vl256
+#define xerfc_u15 Sleef_erfcd4_u15avx512vl256
+#define yerfc_u15 Sleef_finz_erfcd4_u15avx512vl256
+#define xsigmoid Sleef_sigmoidd4_u10avx512vl256
+#define ysigmoid Sleef_finz_sigmoidd4_u10avx512vl256
+#define xsigmoid_u35 Sleef_sigmoidd4_u35avx512vl256
+#define ysigmoid_u35 Sleef_finz_sigmoidd4_u35avx512vl256
+#define xsoftplus Sleef_softplusd4_u10avx512vl256
+#define ysoftplus Sleef_finz_softplusd4_u10avx512vl256
+#define xsoftplus_u35 Sleef_softplusd4_u35avx512vl256
+#define ysoftplus_u35 Sleef_finz_softplusd4_u35avx512vl256
+#define xsilu Sleef_silud4_u10avx512vl256
+#define ysilu Sleef_finz_silud4_u10avx512vl256
+#define xsilu_u35 Sleef_silud4_u35avx512vl256
+#define ysilu_u35 Sleef_finz_silud4_u35avx512vl256
+#define xgelutanh Sleef_gelutanhd4_u10avx512vl256
+#define ygelutanh Sleef_finz_gelutanhd4_u10avx512vl256
+#define xgelutanh_u35 Sleef_gelutanhd4_u35avx512vl256
+#define ygelutanh_u35 Sleef_finz_gelutanhd4_u35avx512vl256
+#define xgelu_u15 Sleef_gelud4_u15avx512vl256
+#define ygelu_u15 Sleef_finz_gelud4_u15avx512vl256
+#define xgetInt Sleef_getIntd4_avx512vl256
+#define ygetInt Sleef_finz_getIntd4_avx512vl256
+#define xgetPtr Sleef_getPtrd4_avx512vl256
+#define ygetPtr Sleef_finz_getPtrd4_avx512vl256
+
+#define xsinf Sleef_sinf8_u35avx512vl256
+#define ysinf Sleef_finz_sinf8_u35avx512vl256
+#define xcosf Sleef_cosf8_u35avx512vl256
+#define ycosf Sleef_finz_cosf8_u35avx512vl256
+#define xsincosf Sleef_sincosf8_u35avx512vl256
+#define ysincosf Sleef_finz_sincosf8_u35avx512vl256
+#define xtanf Sleef_tanf8_u35avx512vl256
+#define ytanf Sleef_finz_tanf8_u35avx512vl256
+#define xasinf Sleef_asinf8_u35avx512vl256
+#define yasinf Sleef_finz_asinf8_u35avx512vl256
+#define xacosf Sleef_acosf8_u35avx512vl256
+#define yacosf Sleef_finz_acosf8_u35avx512vl256
+#define xatanf Sleef_atanf8_u35avx512vl256
+#define yatanf Sleef_finz_atanf8_u35avx512vl256
+#define xatan2f Sleef_atan2f8_u35avx512vl256
+#define yatan2f Sleef_finz_atan2f8_u35avx512vl256
+#define xlogf Sleef_logf8_u35avx512vl256
+#define ylogf Sleef_finz_logf8_u35avx512vl256
+#define xcbrtf Sleef_cbrtf8_u35avx512vl256
+#define ycbrtf Sleef_finz_cbrtf8_u35avx512vl256
+#define xsinf_u1 Sleef_sinf8_u10avx512vl256
+#define ysinf_u1 Sleef_finz_sinf8_u10avx512vl256
+#define xcosf_u1 Sleef_cosf8_u10avx512vl256
+#define ycosf_u1 Sleef_finz_cosf8_u10avx512vl256
+#define xsincosf_u1 Sleef_sincosf8_u10avx512vl256
+#define ysincosf_u1 Sleef_finz_sincosf8_u10avx512vl256
+#define xtanf_u1 Sleef_tanf8_u10avx512vl256
+#define ytanf_u1 Sleef_finz_tanf8_u10avx512vl256
+#define xasinf_u1 Sleef_asinf8_u10avx512vl256
+#define yasinf_u1 Sleef_finz_asinf8_u10avx512vl256
+#define xacosf_u1 Sleef_acosf8_u10avx512vl256
+#define yacosf_u1 Sleef_finz_acosf8_u10avx512vl256
+#define xatanf_u1 Sleef_atanf8_u10avx512vl256
+#define yatanf_u1 Sleef_finz_atanf8_u10avx512vl256
+#define xatan2f_u1 Sleef_atan2f8_u10avx512vl256
+#define yatan2f_u1 Sleef_finz_atan2f8_u10avx512vl256
+#define xlogf_u1 Sleef_logf8_u10avx512vl256
+#define ylogf_u1 Sleef_finz_logf8_u10avx512vl256
+#define xcbrtf_u1 Sleef_cbrtf8_u10avx512vl256
+#define ycbrtf_u1 Sleef_finz_cbrtf8_u10avx512vl256
+#define xexpf Sleef_expf8_u10avx512vl256
+#define yexpf Sleef_finz_expf8_u10avx512vl256
+#define xpowf Sleef_powf8_u10avx512vl256
+#define ypowf Sleef_finz_powf8_u10avx512vl256
+#define xsinhf Sleef_sinhf8_u10avx512vl256
+#define ysinhf Sleef_finz_sinhf8_u10avx512vl256
+#define xcoshf Sleef_coshf8_u10avx512vl256
+#define ycoshf Sleef_finz_coshf8_u10avx512vl256
+#define xtanhf Sleef_tanhf8_u10avx512vl256
+#define ytanhf Sleef_finz_tanhf8_u10avx512vl256
+#define xsinhf_u35 Sleef_sinhf8_u35avx512vl256
+#define ysinhf_u35 Sleef_finz_sinhf8_u35avx512vl256
+#define xcoshf_u35 Sleef_coshf8_u35avx512vl256
+#define ycoshf_u35 Sleef_finz_coshf8_u35avx512vl256
+#define xtanhf_u35 Sleef_tanhf8_u35avx512vl256
+#define ytanhf_u35 Sleef_finz_tanhf8_u35avx512vl256
+#define xfastsinf_u3500 Sleef_fastsinf8_u3500avx512vl256
+#define yfastsinf_u3500 Sleef_finz_fastsinf8_u3500avx512vl256
+#define xfastcosf_u3500 Sleef_fastcosf8_u3500avx512vl256
+#define yfastcosf_u3500 Sleef_finz_fastcosf8_u3500avx512vl256
+#define xfastpowf_u3500 Sleef_fastpowf8_u3500avx512vl256
+#define yfastpowf_u3500 Sleef_finz_fastpowf8_u3500avx512vl256
+#define xfastexpf_u3500 Sleef_fastexpf8_u3500avx512vl256
+#define yfastexpf_u3500 Sleef_finz_fastexpf8_u3500avx512vl256
+#define xfastexp2f_u3500 Sleef_fastexp2f8_u3500avx512vl256
+#define yfastexp2f_u3500 Sleef_finz_fastexp2f8_u3500avx512vl256
+#define xfastlogf_u3500 Sleef_fastlogf8_u3500avx512vl256
+#define yfastlogf_u3500 Sleef_finz_fastlogf8_u3500avx512vl256
+#define xfastlog2f_u3500 Sleef_fastlog2f8_u3500avx512vl256
+#define yfastlog2f_u3500 Sleef_finz_fastlog2f8_u3500avx512vl256
+#define xfasttanhf_u3500 Sleef_fasttanhf8_u3500avx512vl256
+#define yfasttanhf_u3500 Sleef_finz_fasttanhf8_u3500avx512vl256
+#define xfastatan2f_u3500 Sleef_fastatan2f8_u3500avx512vl256
+#define yfastatan2f_u3500 Sleef_finz_fastatan2f8_u3500avx512vl256
+#define xfastrsqrtf_u3500 Sleef_fastrsqrtf8_u3500avx512vl256
+#define yfastrsqrtf_u3500 Sleef_finz_fastrsqrtf8_u3500avx512vl256
+#define xfastrcpf_u3500 Sleef_fastrcpf8_u3500avx512vl256
+#define yfastrcpf_u3500 Sleef_finz_fastrcpf8_u3500avx512vl256
+#define xsinrf_u35 Sleef_sinrf8_u35avx512vl256
+#define ysinrf_u35 Sleef_finz_sinrf8_u35avx512vl256
+#define xcosrf_u35 Sleef_cosrf8_u35avx512vl256
+#define ycosrf_u35 Sleef_finz_cosrf8_u35avx512vl256
+#define xsincosrf_u35 Sleef_sincosrf8_u35avx512vl256
+#define ysincosrf_u35 Sleef_finz_sincosrf8_u35avx512vl256
+#define xtanrf_u35 Sleef_tanrf8_u35avx512vl256
+#define ytanrf_u35 Sleef_finz_tanrf8_u35avx512vl256
+#define xasinhf Sleef_asinhf8_u10avx512vl256
+#define yasinhf Sleef_finz_asinhf8_u10avx512vl256
+#define xacoshf Sleef_acoshf8_u10avx512vl256
+#define yacoshf Sleef_finz_acoshf8_u10avx512vl256
+#define xatanhf Sleef_atanhf8_u10avx512vl256
+#define yatanhf Sleef_finz_atanhf8_u10avx512vl256
+#define xexp2f Sleef_exp2f8_u10avx512vl256
+#define yexp2f Sleef_finz_exp2f8_u10avx512vl256
+#define xexp2f_u35 Sleef_exp2f8_u35avx512vl256
+#define yexp2f_u35 Sleef_finz_exp2f8_u35avx512vl256
+#define xexp10f Sleef_exp10f8_u10avx512vl256
+#define yexp10f Sleef_finz_exp10f8_u10avx512vl256
+#define xexp10f_u35 Sleef_exp10f8_u35avx512vl256
+#define yexp10f_u35 Sleef_finz_exp10f8_u35avx512vl256
+#define xexpm1f Sleef_expm1f8_u10avx512vl256
+#define yexpm1f Sleef_finz_expm1f8_u10avx512vl256
+#define xlog10f Sleef_log10f8_u10avx512vl256
+#define ylog10f Sleef_finz_log10f8_u10avx512vl256
+#define xlog2f Sleef_log2f8_u10avx512vl256
+#define ylog2f Sleef_finz_log2f8_u10avx512vl256
+#define xlog2f_u35 Sleef_log2f8_u35avx512vl256
+#define ylog2f_u35 Sleef_finz_log2f8_u35avx512vl256
+#define xlog1pf Sleef_log1pf8_u10avx512vl256
+#define ylog1pf Sleef_finz_log1pf8_u10avx512vl256
+#define xsincospif_u05 Sleef_sincospif8_u05avx512vl256
+#define ysincospif_u05 Sleef_finz_sincospif8_u05avx512vl256
+#define xsincospif_u35 Sleef_sincospif8_u35avx512vl256
+#define ysincospif_u35 Sleef_finz_sincospif8_u35avx512vl256
+#define xsinpif_u05 Sleef_sinpif8_u05avx512vl256
+#define ysinpif_u05 Sleef_finz_sinpif8_u05avx512vl256
+#define xcospif_u05 Sleef_cospif8_u05avx512vl256
+#define ycospif_u05 Sleef_finz_cospif8_u05avx512vl256
+#define xldexpf Sleef_ldexpf8_avx512vl256
+#define yldexpf Sleef_finz_ldexpf8_avx512vl256
+#define xilogbf Sleef_ilogbf8_avx512vl256
+#define yilogbf Sleef_finz_ilogbf8_avx512vl256
+#define xfmaf Sleef_fmaf8_avx512vl256
+#define yfmaf Sleef_finz_fmaf8_avx512vl256
+#define xsqrtf Sleef_sqrtf8_avx512vl256
+#define ysqrtf Sleef_finz_sqrtf8_avx512vl256
+#define xsqrtf_u05 Sleef_sqrtf8_u05avx512vl256
+#define ysqrtf_u05 Sleef_finz_sqrtf8_u05avx512vl256
+#define xsqrtf_u35 Sleef_sqrtf8_u35avx512vl256
+#define ysqrtf_u35 Sleef_finz_sqrtf8_u35avx512vl256
+#define xhypotf_u05 Sleef_hypotf8_u05avx512vl256
+#define yhypotf_u05 Sleef_finz_hypotf8_u05avx512vl256
+#define xhypotf_u35 Sleef_hypotf8_u35avx512vl256
+#define yhypotf_u35 Sleef_finz_hypotf8_u35avx512vl256
+#define xfabsf Sleef_fabsf8_avx512vl256
+#define yfabsf Sleef_finz_fabsf8_avx512vl256
+#define xcopysignf Sleef_copysignf8_avx512vl256
+#define ycopysignf Sleef_finz_copysignf8_avx512vl256
+#define xfmaxf Sleef_fmaxf8_avx512vl256
+#define yfmaxf Sleef_finz_fmaxf8_avx512vl256
+#define xfminf Sleef_fminf8_avx512vl256
+#define yfminf Sleef_finz_fminf8_avx512vl256
+#define xfdimf Sleef_fdimf8_avx512vl256
+#define yfdimf Sleef_finz_fdimf8_avx512vl256
+#define xtruncf Sleef_truncf8_avx512vl256
+#define ytruncf Sleef_finz_truncf8_avx512vl256
+#define xfloorf Sleef_floorf8_avx512vl256
+#define yfloorf Sleef_finz_floorf8_avx512vl256
+#define xceilf Sleef_ceilf8_avx512vl256
+#define yceilf Sleef_finz_ceilf8_avx512vl256
+#define xroundf Sleef_roundf8_avx512vl256
+#define yroundf Sleef_finz_roundf8_avx512vl256
+#define xrintf Sleef_rintf8_avx512vl256
+#define yrintf Sleef_finz_rintf8_avx512vl256
+#define xnextafterf Sleef_nextafterf8_avx512vl256
+#define ynextafterf Sleef_finz_nextafterf8_avx512vl256
+#define xfrfrexpf Sleef_frfrexpf8_avx512vl256
+#define yfrfrexpf Sleef_finz_frfrexpf8_avx512vl256
+#define xexpfrexpf Sleef_expfrexpf8_avx512vl256
+#define yexpfrexpf Sleef_finz_expfrexpf8_avx512vl256
+#define xfmodf Sleef_fmodf8_avx512vl256
+#define yfmodf Sleef_finz_fmodf8_avx512vl256
+#define xremainderf Sleef_remainderf8_avx512vl256
+#define yremainderf Sleef_finz_remainderf8_avx512vl256
+#define xmodff Sleef_modff8_avx512vl256
+#define ymodff Sleef_finz_modff8_avx512vl256
+#define xlgammaf_u1 Sleef_lgammaf8_u10avx512vl256
+#define ylgammaf_u1 Sleef_finz_lgammaf8_u10avx512vl256
+#define xtgammaf_u1 Sleef_tgammaf8_u10avx512vl256
+#define ytgammaf_u1 Sleef_finz_tgammaf8_u10avx512vl256
+#define xerff_u1 Sleef_erff8_u10avx512vl256
+#define yerff_u1 Sleef_finz_erff8_u10avx512vl256
+#define xerfcf_u15 Sleef_erfcf8_u15avx512vl256
+#define yerfcf_u15 Sleef_finz_erfcf8_u15avx512vl256
+#define xsigmoidf Sleef_sigmoidf8_u10avx512vl256
+#define ysigmoidf Sleef_finz_sigmoidf8_u10avx512vl256
+#define xsigmoidf_u35 Sleef_sigmoidf8_u35avx512vl256
+#define ysigmoidf_u35 Sleef_finz_sigmoidf8_u35avx512vl256
+#define xsoftplusf Sleef_softplusf8_u10avx512vl256
+#define ysoftplusf Sleef_finz_softplusf8_u10avx512vl256
+#define xsoftplusf_u35 Sleef_softplusf8_u35avx512vl256
+#define ysoftplusf_u35 Sleef_finz_softplusf8_u35avx512vl256
+#define xsiluf Sleef_siluf8_u10avx512vl256
+#define ysiluf Sleef_finz_siluf8_u10avx512vl256
+#define xsiluf_u35 Sleef_siluf8_u35avx512vl256
+#define ysiluf_u35 Sleef_finz_siluf8_u35avx512vl256
+#define xgelutanhf Sleef_gelutanhf8_u10avx512vl256
+#define ygelutanhf Sleef_finz_gelutanhf8_u10avx512vl256
+#define xgelutanhf_u35 Sleef_gelutanhf8_u35avx512vl256
+#define ygelutanhf_u35 Sleef_finz_gelutanhf8_u35avx512vl256
+#define xgeluf_u15 Sleef_geluf8_u15avx512vl256
+#define ygeluf_u15 Sleef_finz_geluf8_u15avx512vl256
+#define xgetIntf Sleef_getIntf8_avx512vl256
+#define ygetIntf Sleef_finz_getIntf8_avx512vl256
+#define xgetPtrf Sleef_getPtrf8_avx512vl256
+#define ygetPtrf Sleef_finz_getPtrf8_avx512vl256
+
+#define xsinf16_u1 Sleef_sinh8_u10avx512vl256
+#define xcosf16_u1 Sleef_cosh8_u10avx512vl256
+#define xtanf16_u1 Sleef_tanh8_u10avx512vl256
+#define xasinf16_u1 Sleef_asinh8_u10avx512vl256
+#define xacosf16_u1 Sleef_acosh8_u10avx512vl256
+#define xatanf16_u1 Sleef_atanh8_u10avx512vl256
+#define xatan2f16_u1 Sleef_atan2h8_u10avx512vl256
+#define xlogf16_u1 Sleef_logh8_u10avx512vl256
+#define xcbrtf16_u1 Sleef_cbrth8_u10avx512vl256
+#define xexpf16 Sleef_exph8_u10avx512vl256
+#define xpowf16 Sleef_powh8_u10avx512vl256
+#define xsinhf16 Sleef_sinhh8_u10avx512vl256
+#define xcoshf16 Sleef_coshh8_u10avx512vl256
+#define xtanhf16 Sleef_tanhh8_u10avx512vl256
+#define xasinhf16 Sleef_asinhh8_u10avx512vl256
+#define xacoshf16 Sleef_acoshh8_u10avx512vl256
+#define xatanhf16 Sleef_atanhh8_u10avx512vl256
+#define xexp2f16 Sleef_exp2h8_u10avx512vl256
+#define xexp10f16 Sleef_exp10h8_u10avx512vl256
+#define xexpm1f16 Sleef_expm1h8_u10avx512vl256
+#define xlog10f16 Sleef_log10h8_u10avx512vl256
+#define xlog2f16 Sleef_log2h8_u10avx512vl256
+#define xlog1pf16 Sleef_log1ph8_u10avx512vl256
+#define xsqrtf16 Sleef_sqrth8_avx512vl256
+#define xlgammaf16_u1 Sleef_lgammah8_u10avx512vl256
+#define xtgammaf16_u1 Sleef_tgammah8_u10avx512vl256
+#define xerff16_u1 Sleef_erfh8_u10avx512vl256
+#define xerfcf16_u15 Sleef_erfch8_u15avx512vl256
+#define xsigmoidf16 Sleef_sigmoidh8_u10avx512vl256
+#define xsoftplusf16 Sleef_softplush8_u10avx512vl256
+#define xsiluf16 Sleef_siluh8_u10avx512vl256
+#define xgelutanhf16 Sleef_gelutanhh8_u10avx512vl256
+#define xgeluf16_u15 Sleef_geluh8_u15avx512vl256
+
+#define xsinbf16_u1 Sleef_sinbf16x8_u10avx512vl256
+#define xcosbf16_u1 Sleef_cosbf16x8_u10avx512vl256
+#define xlogbf16_u1 Sleef_logbf16x8_u10avx512vl256
+#define xexpbf16 Sleef_expbf16x8_u10avx512vl256
+#define xpowbf16 Sleef_powbf16x8_u10avx512vl256
+#define xtanhbf16 Sleef_tanhbf16x8_u10avx512vl256
+#define xexp2bf16 Sleef_exp2bf16x8_u10avx512vl256
+#define xexp10bf16 Sleef_exp10bf16x8_u10avx512vl256
+#define xexpm1bf16 Sleef_expm1bf16x8_u10avx512vl256
+#define xlog10bf16 Sleef_log10bf16x8_u10avx512vl256
+#define xlog2bf16 Sleef_log2bf16x8_u10avx512vl256
+#define xlog1pbf16 Sleef_log1pbf16x8_u10avx512vl256
+#define xsqrtbf16 Sleef_sqrtbf16x8_avx512vl256
+#define xerfbf16_u1 Sleef_erfbf16x8_u10avx512vl256
+#define xerfcbf16_u15 Sleef_erfcbf16x8_u15avx512vl256
+#define xsigmoidbf16 Sleef_sigmoidbf16x8_u10avx512vl256
+#define xsoftplusbf16 Sleef_softplusbf16x8_u10avx512vl256
+#define xsilubf16 Sleef_silubf16x8_u10avx512vl256
+#define xgelutanhbf16 Sleef_gelutanhbf16x8_u10avx512vl256
+#define xgelubf16_u15 Sleef_gelubf16x8_u15avx512vl256
+
+#else //#ifndef DETERMINISTIC
+
+#define xsin Sleef_finz_sind4_u35avx512vl256
+#define xcos Sleef_finz_cosd4_u35avx512vl256
+#define xsincos Sleef_finz_sincosd4_u35avx512vl256
+#define xtan Sleef_finz_tand4_u35avx512vl256
+#define xasin Sleef_finz_asind4_u35avx512vl256
+#define xacos Sleef_finz_acosd4_u35avx512vl256
+#define xatan Sleef_finz_atand4_u35avx512vl256
+#define xatan2 Sleef_finz_atan2d4_u35avx512vl256
+#define xlog Sleef_finz_logd4_u35avx512vl256
+#define xcbrt Sleef_finz_cbrtd4_u35avx512vl256
+#define xsin_u1 Sleef_finz_sind4_u10avx512vl256
+#define xcos_u1 Sleef_finz_cosd4_u10avx512vl256
+#define xsincos_u1 Sleef_finz_sincosd4_u10avx512vl256
+#define xtan_u1 Sleef_finz_tand4_u10avx512vl256
+#define xasin_u1 Sleef_finz_asind4_u10avx512vl256
+#define xacos_u1 Sleef_finz_acosd4_u10avx512vl256
+#define xatan_u1 Sleef_finz_atand4_u10avx512vl256
+#define xatan2_u1 Sleef_finz_atan2d4_u10avx512vl256
+#define xlog_u1 Sleef_finz_logd4_u10avx512vl256
+#define xcbrt_u1 Sleef_finz_cbrtd4_u10avx512vl256
+#define xexp Sleef_finz_expd4_u10avx512vl256
+#define xpow Sleef_finz_powd4_u10avx512vl256
+#define xsinh Sleef_finz_sinhd4_u10avx512vl256
+#define xcosh Sleef_finz_coshd4_u10avx512vl256
+#define xtanh Sleef_finz_tanhd4_u10avx512vl256
+#define xsinh_u35 Sleef_finz_sinhd4_u35avx512vl256
+#define xcosh_u35 Sleef_finz_coshd4_u35avx512vl256
+#define xtanh_u35 Sleef_finz_tanhd4_u35avx512vl256
+#define xfastsin_u3500 Sleef_finz_fastsind4_u3500avx512vl256
+#define xfastcos_u3500 Sleef_finz_fastcosd4_u3500avx512vl256
+#define xfastpow_u3500 Sleef_finz_fastpowd4_u3500avx512vl256
+#define xfastexp_u3500 Sleef_finz_fastexpd4_u3500avx512vl256
+#define xfastexp2_u3500 Sleef_finz_fastexp2d4_u3500avx512vl256
+#define xfastlog_u3500 Sleef_finz_fastlogd4_u3500avx512vl256
+#define xfastlog2_u3500 Sleef_finz_fastlog2d4_u3500avx512vl256
+#define xfasttanh_u3500 Sleef_finz_fasttanhd4_u3500avx512vl256
+#define xfastatan2_u3500 Sleef_finz_fastatan2d4_u3500avx512vl256
+#define xfastrsqrt_u3500 Sleef_finz_fastrsqrtd4_u3500avx512vl256
+#define xfastrcp_u3500 Sleef_finz_fastrcpd4_u3500avx512vl256
+#define xsinr_u35 Sleef_finz_sinrd4_u35avx512vl256
+#define xcosr_u35 Sleef_finz_cosrd4_u35avx512vl256
+#define xsincosr_u35 Sleef_finz_sincosrd4_u35avx512vl256
+#define xtanr_u35 Sleef_finz_tanrd4_u35avx512vl256
+#define xasinh Sleef_finz_asinhd4_u10avx512vl256
+#define xacosh Sleef_finz_acoshd4_u10avx512vl256
+#define xatanh Sleef_finz_atanhd4_u10avx512vl256
+#define xexp2 Sleef_finz_exp2d4_u10avx512vl256
+#define xexp2_u35 Sleef_finz_exp2d4_u35avx512vl256
+#define xexp10 Sleef_finz_exp10d4_u10avx512vl256
+#define xexp10_u35 Sleef_finz_exp10d4_u35avx512vl256
+#define xexpm1 Sleef_finz_expm1d4_u10avx512vl256
+#define xlog10 Sleef_finz_log10d4_u10avx512vl256
+#define xlog2 Sleef_finz_log2d4_u10avx512vl256
+#define xlog2_u35 Sleef_finz_log2d4_u35avx512vl256
+#define xlog1p Sleef_finz_log1pd4_u10avx512vl256
+#define xsincospi_u05 Sleef_finz_sincospid4_u05avx512vl256
+#define xsincospi_u35 Sleef_finz_sincospid4_u35avx512vl256
+#define xsinpi_u05 Sleef_finz_sinpid4_u05avx512vl256
+#define xcospi_u05 Sleef_finz_cospid4_u05avx512vl256
+#define xldexp Sleef_finz_ldexpd4_avx512vl256
+#define xilogb Sleef_finz_ilogbd4_avx512vl256
+#define xfma Sleef_finz_fmad4_avx512vl256
+#define xsqrt Sleef_finz_sqrtd4_avx512vl256
+#define xsqrt_u05 Sleef_finz_sqrtd4_u05avx512vl256
+#define xsqrt_u35 Sleef_finz_sqrtd4_u35avx512vl256
+#define xhypot_u05 Sleef_finz_hypotd4_u05avx512vl256
+#define xhypot_u35 Sleef_finz_hypotd4_u35avx512vl256
+#define xfabs Sleef_finz_fabsd4_avx512vl256
+#define xcopysign Sleef_finz_copysignd4_avx512vl256
+#define xfmax Sleef_finz_fmaxd4_avx512vl256
+#define xfmin Sleef_finz_fmind4_avx512vl256
+#define xfdim Sleef_finz_fdimd4_avx512vl256
+#define xtrunc Sleef_finz_truncd4_avx512vl256
+#define xfloor Sleef_finz_floord4_avx512vl256
+#define xceil Sleef_finz_ceild4_avx512vl256
+#define xround Sleef_finz_roundd4_avx512vl256
+#define xrint Sleef_finz_rintd4_avx512vl256
+#define xnextafter Sleef_finz_nextafterd4_avx512vl256
+#define xfrfrexp Sleef_finz_frfrexpd4_avx512vl256
+#define xexpfrexp Sleef_finz_expfrexpd4_avx512vl256
+#define xfmod Sleef_finz_fmodd4_avx512vl256
+#define xremainder Sleef_finz_remainderd4_avx512vl256
+#define xmodf Sleef_finz_modfd4_avx512vl256
+#define xlgamma_u1 Sleef_finz_lgammad4_u10avx512vl256
+#define xtgamma_u1 Sleef_finz_tgammad4_u10avx512vl256
+#define xerf_u1 Sleef_finz_erfd4_u10avx512vl256
+#define xerfc_u15 Sleef_finz_erfcd4_u15avx512vl256
+#define xsigmoid Sleef_finz_sigmoidd4_u10avx512vl256
+#define xsigmoid_u35 Sleef_finz_sigmoidd4_u35avx512vl256
+#define xsoftplus Sleef_finz_softplusd4_u10avx512vl256
+#define xsoftplus_u35 Sleef_finz_softplusd4_u35avx512vl256
+#define xsilu Sleef_finz_silud4_u10avx512vl256
+#define xsilu_u35 Sleef_finz_silud4_u35avx512vl256
+#define xgelutanh Sleef_finz_gelutanhd4_u10avx512vl256
+#define xgelutanh_u35 Sleef_finz_gelutanhd4_u35avx512vl256
+#define xgelu_u15 Sleef_finz_gelud4_u15avx512vl256
+#define xgetInt Sleef_finz_getIntd4_avx512vl256
+#define xgetPtr Sleef_finz_getPtrd4_avx512vl256
+
+#define xsinf Sleef_finz_sinf8_u35avx512vl256
+#define xcosf Sleef_finz_cosf8_u35avx512vl256
+#define xsincosf Sleef_finz_sincosf8_u35avx512vl256
+#define xtanf Sleef_finz_tanf8_u35avx512vl256
+#define xasinf Sleef_finz_asinf8_u35avx512vl256
+#define xacosf Sleef_finz_acosf8_u35avx512vl256
+#define xatanf Sleef_finz_atanf8_u35avx512vl256
+#define xatan2f Sleef_finz_atan2f8_u35avx512vl256
+#define xlogf Sleef_finz_logf8_u35avx512vl256
+#define xcbrtf Sleef_finz_cbrtf8_u35avx512vl256
+#define xsinf_u1 Sleef_finz_sinf8_u10avx512vl256
+#define xcosf_u1 Sleef_finz_cosf8_u10avx512vl256
+#define xsincosf_u1 Sleef_finz_sincosf8_u10avx512vl256
+#define xtanf_u1 Sleef_finz_tanf8_u10avx512vl256
+#define xasinf_u1 Sleef_finz_asinf8_u10avx512vl256
+#define xacosf_u1 Sleef_finz_acosf8_u10avx512vl256
+#define xatanf_u1 Sleef_finz_atanf8_u10avx512vl256
+#define xatan2f_u1 Sleef_finz_atan2f8_u10avx512vl256
+#define xlogf_u1 Sleef_finz_logf8_u10avx512vl256
+#define xcbrtf_u1 Sleef_finz_cbrtf8_u10avx512vl256
+#define xexpf Sleef_finz_expf8_u10avx512vl256
+#define xpowf Sleef_finz_powf8_u10avx512vl256
+#define xsinhf Sleef_finz_sinhf8_u10avx512vl256
+#define xcoshf Sleef_finz_coshf8_u10avx512vl256
+#define xtanhf Sleef_finz_tanhf8_u10avx512vl256
+#define xsinhf_u35 Sleef_finz_sinhf8_u35avx512vl256
+#define xcoshf_u35 Sleef_finz_coshf8_u35avx512vl256
+#define xtanhf_u35 Sleef_finz_tanhf8_u35avx512vl256
+#define xfastsinf_u3500 Sleef_finz_fastsinf8_u3500avx512vl256
+#define xfastcosf_u3500 Sleef_finz_fastcosf8_u3500avx512vl256
+#define xfastpowf_u3500 Sleef_finz_fastpowf8_u3500avx512vl256
+#define xfastexpf_u3500 Sleef_finz_fastexpf8_u3500avx512vl256
+#define xfastexp2f_u3500 Sleef_finz_fastexp2f8_u3500avx512vl256
+#define xfastlogf_u3500 Sleef_finz_fastlogf8_u3500avx512vl256
+#define xfastlog2f_u3500 Sleef_finz_fastlog2f8_u3500avx512vl256
+#define xfasttanhf_u3500 Sleef_finz_fasttanhf8_u3500avx512vl256
+#define xfastatan2f_u3500 Sleef_finz_fastatan2f8_u3500avx512vl256
+#define xfastrsqrtf_u3500 Sleef_finz_fastrsqrtf8_u3500avx512vl256
+#define xfastrcpf_u3500 Sleef_finz_fastrcpf8_u3500avx512vl256
+#define xsinrf_u35 Sleef_finz_sinrf8_u35avx512vl256
+#define xcosrf_u35 Sleef_finz_cosrf8_u35avx512vl256
+#define xsincosrf_u35 Sleef_finz_sincosrf8_u35avx512vl256
+#define xtanrf_u35 Sleef_finz_tanrf8_u35avx512vl256
+#define xasinhf Sleef_finz_asinhf8_u10avx512vl256
+#define xacoshf Sleef_finz_acoshf8_u10avx512vl256
+#define xatanhf Sleef_finz_atanhf8_u10avx512vl256
+#define xexp2f Sleef_finz_exp2f8_u10avx512vl256
+#define xexp2f_u35 Sleef_finz_exp2f8_u35avx512vl256
+#define xexp10f Sleef_finz_exp10f8_u10avx512vl256
+#define xexp10f_u35 Sleef_finz_exp10f8_u35avx512vl256
+#define xexpm1f Sleef_finz_expm1f8_u10avx512vl256
+#define xlog10f Sleef_finz_log10f8_u10avx512vl256
+#define xlog2f Sleef_finz_log2f8_u10avx512vl256
+#define xlog2f_u35 Sleef_finz_log2f8_u35avx512vl256
+#define xlog1pf Sleef_finz_log1pf8_u10avx512vl256
+#define xsincospif_u05 Sleef_finz_sincospif8_u05avx512vl256
+#define xsincospif_u35 Sleef_finz_sincospif8_u35avx512vl256
+#define xsinpif_u05 Sleef_finz_sinpif8_u05avx512vl256
+#define xcospif_u05 Sleef_finz_cospif8_u05avx512vl256
+#define xldexpf Sleef_finz_ldexpf8_avx512vl256
+#define xilogbf Sleef_finz_ilogbf8_avx512vl256
+#define xfmaf Sleef_finz_fmaf8_avx512vl256
+#define xsqrtf Sleef_finz_sqrtf8_avx512vl256
+#define xsqrtf_u05 Sleef_finz_sqrtf8_u05avx512vl256
+#define xsqrtf_u35 Sleef_finz_sqrtf8_u35avx512vl256
+#define xhypotf_u05 Sleef_finz_hypotf8_u05avx512vl256
+#define xhypotf_u35 Sleef_finz_hypotf8_u35avx512vl256
+#define xfabsf Sleef_finz_fabsf8_avx512vl256
+#define xcopysignf Sleef_finz_copysignf8_avx512vl256
+#define xfmaxf Sleef_finz_fmaxf8_avx512vl256
+#define xfminf Sleef_finz_fminf8_avx512vl256
+#define xfdimf Sleef_finz_fdimf8_avx512vl256
+#define xtruncf Sleef_finz_truncf8_avx512vl256
+#define xfloorf Sleef_finz_floorf8_avx512vl256
+#define xceilf Sleef_finz_ceilf8_avx512vl256
+#define xroundf Sleef_finz_roundf8_avx512vl256
+#define xrintf Sleef_finz_rintf8_avx512vl256
+#define xnextafterf Sleef_finz_nextafterf8_avx512vl256
+#define xfrfrexpf Sleef_finz_frfrexpf8_avx512vl256
+#define xexpfrexpf Sleef_finz_expfrexpf8_avx512vl256
+#define xfmodf Sleef_finz_fmodf8_avx512vl256
+#define xremainderf Sleef_finz_remainderf8_avx512vl256
+#define xmodff Sleef_finz_modff8_avx512vl256
+#define xlgammaf_u1 Sleef_finz_lgammaf8_u10avx512vl256
+#define xtgammaf_u1 Sleef_finz_tgammaf8_u10avx512vl256
+#define xerff_u1 Sleef_finz_erff8_u10avx512vl256
+#define xerfcf_u15 Sleef_finz_erfcf8_u15avx512vl256
+#define xsigmoidf Sleef_finz_sigmoidf8_u10avx512vl256
+#define xsigmoidf_u35 Sleef_finz_sigmoidf8_u35avx512vl256
+#define xsoftplusf Sleef_finz_softplusf8_u10avx512vl256
+#define xsoftplusf_u35 Sleef_finz_softplusf8_u35avx512vl256
+#define xsiluf Sleef_finz_siluf8_u10avx512vl256
+#define xsiluf_u35 Sleef_finz_siluf8_u35avx512vl256
+#define xgelutanhf Sleef_finz_gelutanhf8_u10avx512vl256
+#define xgelutanhf_u35 Sleef_finz_gelutanhf8_u35avx512vl256
+#define xgeluf_u15 Sleef_finz_geluf8_u15avx512vl256
+#define xgetIntf Sleef_finz_getIntf8_avx512vl256
+#define xgetPtrf Sleef_finz_getPtrf8_avx512vl256
+
+#endif // #ifndef DETERMINISTIC
@@ -0,0 +1,484 @@
+#define xsin _ZGVeN4v_sin_u35
+#define str_xsin "_ZGVeN4v_sin_u35"
+#define __sin_finite _ZGVeN4v___sin_finite
+#define xcos _ZGVeN4v_cos_u35
+#define str_xcos "_ZGVeN4v_cos_u35"
+#define __cos_finite _ZGVeN4v___cos_finite
+#define xsincos _ZGVeN4vl8l8_sincos_u35
+#define str_xsincos "_ZGVeN4vl8l8_sincos_u35"
+#define __sincos_finite _ZGVeN4vl8l8___sincos_finite
+#define xtan _ZGVeN4v_tan_u35
+#define str_xtan "_ZGVeN4v_tan_u35"
+#define __tan_finite _ZGVeN4v___tan_finite
+#define xasin _ZGVeN4v_asin_u35
+#define str_xasin "_ZGVeN4v_asin_u35"
+#define __asin_finite _ZGVeN4v___asin_finite
+#define xacos _ZGVeN4v_acos_u35
+#define str_xacos "_ZGVeN4v_acos_u35"
+#define __acos_finite _ZGVeN4v___acos_finite
+#define xatan _ZGVeN4v_atan_u35
+#define str_xatan "_ZGVeN4v_atan_u35"
+#define __atan_finite _ZGVeN4v___atan_finite
+#define xatan2 _ZGVeN4vv_atan2_u35
+#define str_xatan2 "_ZGVeN4vv_atan2_u35"
+#define __atan2_finite _ZGVeN4vv___atan2_finite
+#define xlog _ZGVeN4v_log_u35
+#define str_xlog "_ZGVeN4v_log_u35"
+#define __log_finite _ZGVeN4v___log_finite
+#define xcbrt _ZGVeN4v_cbrt_u35
+#define str_xcbrt "_ZGVeN4v_cbrt_u35"
+#define __cbrt_finite _ZGVeN4v___cbrt_finite
+#define xsin_u1 _ZGVeN4v_sin
+#define str_xsin_u1 "_ZGVeN4v_sin"
+#define __sin_u1_finite _ZGVeN4v___sin_finite
+#define xcos_u1 _ZGVeN4v_cos
+#define str_xcos_u1 "_ZGVeN4v_cos"
+#define __cos_u1_finite _ZGVeN4v___cos_finite
+#define xsincos_u1 _ZGVeN4vl8l8_sincos
+#define str_xsincos_u1 "_ZGVeN4vl8l8_sincos"
+#define __sincos_u1_finite _ZGVeN4vl8l8___sincos_finite
+#define xtan_u1 _ZGVeN4v_tan
+#define str_xtan_u1 "_ZGVeN4v_tan"
+#define __tan_u1_finite _ZGVeN4v___tan_finite
+#define xasin_u1 _ZGVeN4v_asin
+#define str_xasin_u1 "_ZGVeN4v_asin"
+#define __asin_u1_finite _ZGVeN4v___asin_finite
+#define xacos_u1 _ZGVeN4v_acos
+#define str_xacos_u1 "_ZGVeN4v_acos"
+#define __acos_u1_finite _ZGVeN4v___acos_finite
+#define xatan_u1 _ZGVeN4v_atan
+#define str_xatan_u1 "_ZGVeN4v_atan"
+#define __atan_u1_finite _ZGVeN4v___atan_finite
+#define xatan2_u1 _ZGVeN4vv_atan2
+#define str_xatan2_u1 "_ZGVeN4vv_atan2"
+#define __atan2_u1_finite _ZGVeN4vv___atan2_finite
+#define xlog_u1 _ZGVeN4v_log
+#define str_xlog_u1 "_ZGVeN4v_log"
+#define __log_u1_finite _ZGVeN4v___log_finite
+#define xcbrt_u1 _ZGVeN4v_cbrt
+#define str_xcbrt_u1 "_ZGVeN4v_cbrt"
+#define __cbrt_u1_finite _ZGVeN4v___cbrt_finite
+#define xexp _ZGVeN4v_exp
+#define str_xexp "_ZGVeN4v_exp"
+#define __exp_finite _ZGVeN4v___exp_finite
+#define xpow _ZGVeN4vv_pow
+#define str_xpow "_ZGVeN4vv_pow"
+#define __pow_finite _ZGVeN4vv___pow_finite
+#define xsinh _ZGVeN4v_sinh
+#define str_xsinh "_ZGVeN4v_sinh"
+#define __sinh_finite _ZGVeN4v___sinh_finite
+#define xcosh _ZGVeN4v_cosh
+#define str_xcosh "_ZGVeN4v_cosh"
+#define __cosh_finite _ZGVeN4v___cosh_finite
+#define xtanh _ZGVeN4v_tanh
+#define str_xtanh "_ZGVeN4v_tanh"
+#define __tanh_finite _ZGVeN4v___tanh_finite
+#define xsinh_u35 _ZGVeN4v_sinh_u35
+#define str_xsinh_u35 "_ZGVeN4v_sinh_u35"
+#define __sinh_u35_finite _ZGVeN4v___sinh_finite
+#define xcosh_u35 _ZGVeN4v_cosh_u35
+#define str_xcosh_u35 "_ZGVeN4v_cosh_u35"
+#define __cosh_u35_finite _ZGVeN4v___cosh_finite
+#define xtanh_u35 _ZGVeN4v_tanh_u35
+#define str_xtanh_u35 "_ZGVeN4v_tanh_u35"
+#define __tanh_u35_finite _ZGVeN4v___tanh_finite
+#define xfastexp_u3500 _ZGVeN4v_fastexp_u3500
+#define str_xfastexp_u3500 "_ZGVeN4v_fastexp_u3500"
+#define __fastexp_u3500_finite _ZGVeN4v___fastexp_finite
+#define xfastexp2_u3500 _ZGVeN4v_fastexp2_u3500
+#define str_xfastexp2_u3500 "_ZGVeN4v_fastexp2_u3500"
+#define __fastexp2_u3500_finite _ZGVeN4v___fastexp2_finite
+#define xfastlog_u3500 _ZGVeN4v_fastlog_u3500
+#define str_xfastlog_u3500 "_ZGVeN4v_fastlog_u3500"
+#define __fastlog_u3500_finite _ZGVeN4v___fastlog_finite
+#define xfastlog2_u3500 _ZGVeN4v_fastlog2_u3500
+#define str_xfastlog2_u3500 "_ZGVeN4v_fastlog2_u3500"
+#define __fastlog2_u3500_finite _ZGVeN4v___fastlog2_finite
+#define xfasttanh_u3500 _ZGVeN4v_fasttanh_u3500
+#define str_xfasttanh_u3500 "_ZGVeN4v_fasttanh_u3500"
+#define __fasttanh_u3500_finite _ZGVeN4v___fasttanh_finite
+#define xfastatan2_u3500 _ZGVeN4vv_fastatan2_u3500
+#define str_xfastatan2_u3500 "_ZGVeN4vv_fastatan2_u3500"
+#define __fastatan2_u3500_finite _ZGVeN4vv___fastatan2_finite
+#define xfastrsqrt_u3500 _ZGVeN4v_fastrsqrt_u3500
+#define str_xfastrsqrt_u3500 "_ZGVeN4v_fastrsqrt_u3500"
+#define __fastrsqrt_u3500_finite _ZGVeN4v___fastrsqrt_finite
+#define xfastrcp_u3500 _ZGVeN4v_fastrcp_u3500
+#define str_xfastrcp_u3500 "_ZGVeN4v_fastrcp_u3500"
+#define __fastrcp_u3500_finite _ZGVeN4v___fastrcp_finite
+#define xasinh _ZGVeN4v_asinh
+#define str_xasinh "_ZGVeN4v_asinh"
+#define __asinh_finite _ZGVeN4v___asinh_finite
+#define xacosh _ZGVeN4v_acosh
+#define str_xacosh "_ZGVeN4v_acosh"
+#define __acosh_finite _ZGVeN4v___acosh_finite
+#define xatanh _ZGVeN4v_atanh
+#define str_xatanh "_ZGVeN4v_atanh"
+#define __atanh_finite _ZGVeN4v___atanh_finite
+#define xexp2 _ZGVeN4v_exp2
+#define str_xexp2 "_ZGVeN4v_exp2"
+#define __exp2_finite _ZGVeN4v___exp2_finite
+#define xexp2_u35 _ZGVeN4v_exp2_u35
+#define str_xexp2_u35 "_ZGVeN4v_exp2_u35"
+#define __exp2_u35_finite _ZGVeN4v___exp2_finite
+#define xexp10 _ZGVeN4v_exp10
+#define str_xexp10 "_ZGVeN4v_exp10"
+#define __exp10_finite _ZGVeN4v___exp10_finite
+#define xexp10_u35 _ZGVeN4v_exp10_u35
+#define str_xexp10_u35 "_ZGVeN4v_exp10_u35"
+#define __exp10_u35_finite _ZGVeN4v___exp10_finite
+#define xexpm1 _ZGVeN4v_expm1
+#define str_xexpm1 "_ZGVeN4v_expm1"
+#define __expm1_finite _ZGVeN4v___expm1_finite
+#define xlog10 _ZGVeN4v_log10
+#define str_xlog10 "_ZGVeN4v_log10"
+#define __log10_finite _ZGVeN4v___log10_finite
+#define xlog2 _ZGVeN4v_log2
+#define str_xlog2 "_ZGVeN4v_log2"
+#define __log2_finite _ZGVeN4v___log2_finite
+#define xlog2_u35 _ZGVeN4v_log2_u35
+#define str_xlog2_u35 "_ZGVeN4v_log2_u35"
+#define __log2_u35_finite _ZGVeN4v___log2_finite
+#define xlog1p _ZGVeN4v_log1p
+#define str_xlog1p "_ZGVeN4v_log1p"
+#define __log1p_finite _ZGVeN4v___log1p_finite
+#define xsincospi_u05 _ZGVeN4vl8l8_sincospi
+#define str_xsincospi_u05 "_ZGVeN4vl8l8_sincospi"
+#define __sincospi_u05_finite _ZGVeN4vl8l8___sincospi_finite
+#define xsincospi_u35 _ZGVeN4vl8l8_sincospi_u35
+#define str_xsincospi_u35 "_ZGVeN4vl8l8_sincospi_u35"
+#define __sincospi_u35_finite _ZGVeN4vl8l8___sincospi_finite
+#define xsinpi_u05 _ZGVeN4v_sinpi
+#define str_xsinpi_u05 "_ZGVeN4v_sinpi"
+#define __sinpi_u05_finite _ZGVeN4v___sinpi_finite
+#define xcospi_u05 _ZGVeN4v_cospi
+#define str_xcospi_u05 "_ZGVeN4v_cospi"
+#define __cospi_u05_finite _ZGVeN4v___cospi_finite
+#define xldexp _ZGVeN4vv_ldexp
+#define str_xldexp "_ZGVeN4vv_ldexp"
+#define __ldexp_finite _ZGVeN4vv___ldexp_finite
+#define xilogb _ZGVeN4v_ilogb
+#define str_xilogb "_ZGVeN4v_ilogb"
+#define __ilogb_finite _ZGVeN4v___ilogb_finite
+#define xfma _ZGVeN4vvv_fma
+#define str_xfma "_ZGVeN4vvv_fma"
+#define __fma_finite _ZGVeN4vvv___fma_finite
+#define xsqrt _ZGVeN4v_sqrt
+#define str_xsqrt "_ZGVeN4v_sqrt"
+#define __sqrt_finite _ZGVeN4v___sqrt_finite
+#define xsqrt_u35 _ZGVeN4v_sqrt_u35
+#define str_xsqrt_u35 "_ZGVeN4v_sqrt_u35"
+#define __sqrt_u35_finite _ZGVeN4v___sqrt_finite
+#define xhypot_u05 _ZGVeN4vv_hypot
+#define str_xhypot_u05 "_ZGVeN4vv_hypot"
+#define __hypot_u05_finite _ZGVeN4vv___hypot_finite
+#define xhypot_u35 _ZGVeN4vv_hypot_u35
+#define str_xhypot_u35 "_ZGVeN4vv_hypot_u35"
+#define __hypot_u35_finite _ZGVeN4vv___hypot_finite
+#define xfabs _ZGVeN4v_fabs
+#define str_xfabs "_ZGVeN4v_fabs"
+#define __fabs_finite _ZGVeN4v___fabs_finite
+#define xcopysign _ZGVeN4vv_copysign
+#define str_xcopysign "_ZGVeN4vv_copysign"
+#define __copysign_finite _ZGVeN4vv___copysign_finite
+#define xfmax _ZGVeN4vv_fmax
+#define str_xfmax "_ZGVeN4vv_fmax"
+#define __fmax_finite _ZGVeN4vv___fmax_finite
+#define xfmin _ZGVeN4vv_fmin
+#define str_xfmin "_ZGVeN4vv_fmin"
+#define __fmin_finite _ZGVeN4vv___fmin_finite
+#define xfdim _ZGVeN4vv_fdim
+#define str_xfdim "_ZGVeN4vv_fdim"
+#define __fdim_finite _ZGVeN4vv___fdim_finite
+#define xtrunc _ZGVeN4v_trunc
+#define str_xtrunc "_ZGVeN4v_trunc"
+#define __trunc_finite _ZGVeN4v___trunc_finite
+#define xfloor _ZGVeN4v_floor
+#define str_xfloor "_ZGVeN4v_floor"
+#define __floor_finite _ZGVeN4v___floor_finite
+#define xceil _ZGVeN4v_ceil
+#define str_xceil "_ZGVeN4v_ceil"
+#define __ceil_finite _ZGVeN4v___ceil_finite
+#define xround _ZGVeN4v_round
+#define str_xround "_ZGVeN4v_round"
+#define __round_finite _ZGVeN4v___round_finite
+#define xrint _ZGVeN4v_rint
+#define str_xrint "_ZGVeN4v_rint"
+#define __rint_finite _ZGVeN4v___rint_finite
+#define xnextafter _ZGVeN4vv_nextafter
+#define str_xnextafter "_ZGVeN4vv_nextafter"
+#define __nextafter_finite _ZGVeN4vv___nextafter_finite
+#define xfrfrexp _ZGVeN4v_frfrexp
+#define str_xfrfrexp "_ZGVeN4v_frfrexp"
+#define __frfrexp_finite _ZGVeN4v___frfrexp_finite
+#define xexpfrexp _ZGVeN4v_expfrexp
+#define str_xexpfrexp "_ZGVeN4v_expfrexp"
+#define __expfrexp_finite _ZGVeN4v___expfrexp_finite
+#define xfmod _ZGVeN4vv_fmod
+#define str_xfmod "_ZGVeN4vv_fmod"
+#define __fmod_finite _ZGVeN4vv___fmod_finite
+#define xremainder _ZGVeN4vv_remainder
+#define str_xremainder "_ZGVeN4vv_remainder"
+#define __remainder_finite _ZGVeN4vv___remainder_finite
+#define xmodf _ZGVeN4vl8_modf
+#define str_xmodf "_ZGVeN4vl8_modf"
+#define __modf_finite _ZGVeN4vl8___modf_finite
+#define xlgamma_u1 _ZGVeN4v_lgamma
+#define str_xlgamma_u1 "_ZGVeN4v_lgamma"
+#define __lgamma_u1_finite _ZGVeN4v___lgamma_finite
+#define xtgamma_u1 _ZGVeN4v_tgamma
+#define str_xtgamma_u1 "_ZGVeN4v_tgamma"
+#define __tgamma_u1_finite _ZGVeN4v___tgamma_finite
+#define xerf_u1 _ZGVeN4v_erf
+#define str_xerf_u1 "_ZGVeN4v_erf"
+#define __erf_u1_finite _ZGVeN4v___erf_finite
+#define xerfc_u15 _ZGVeN4v_erfc
+#define str_xerfc_u15 "_ZGVeN4v_erfc"
+#define __erfc_u15_finite _ZGVeN4v___erfc_finite
+
+#define xsinf _ZGVeN8v_sinf_u35
+#define str_xsinf "_ZGVeN8v_sinf_u35"
+#define __sinf_finite _ZGVeN8v___sinf_finite
+#define xcosf _ZGVeN8v_cosf_u35
+#define str_xcosf "_ZGVeN8v_cosf_u35"
+#define __cosf_finite _ZGVeN8v___cosf_finite
+#define xsincosf _ZGVeN8vl4l4_sincosf_u35
+#define str_xsincosf "_ZGVeN8vl4l4_sincosf_u35"
+#define __sincosf_finite _ZGVeN8vl4l4___sincosf_finite
+#define xtanf _ZGVeN8v_tanf_u35
+#define str_xtanf "_ZGVeN8v_tanf_u35"
+#define __tanf_finite _ZGVeN8v___tanf_finite
+#define xasinf _ZGVeN8v_asinf_u35
+#define str_xasinf "_ZGVeN8v_asinf_u35"
+#define __asinf_finite _ZGVeN8v___asinf_finite
+#define xacosf _ZGVeN8v_acosf_u35
+#define str_xacosf "_ZGVeN8v_acosf_u35"
+#define __acosf_finite _ZGVeN8v___acosf_finite
+#define xatanf _ZGVeN8v_atanf_u35
+#define str_xatanf "_ZGVeN8v_atanf_u35"
+#define __atanf_finite _ZGVeN8v___atanf_finite
+#define xatan2f _ZGVeN8vv_atan2f_u35
+#define str_xatan2f "_ZGVeN8vv_atan2f_u35"
+#define __atan2f_finite _ZGVeN8vv___atan2f_finite
+#define xlogf _ZGVeN8v_logf_u35
+#define str_xlogf "_ZGVeN8v_logf_u35"
+#define __logf_finite _ZGVeN8v___logf_finite
+#define xcbrtf _ZGVeN8v_cbrtf_u35
+#define str_xcbrtf "_ZGVeN8v_cbrtf_u35"
+#define __cbrtf_finite _ZGVeN8v___cbrtf_finite
+#define xsinf_u1 _ZGVeN8v_sinf
+#define str_xsinf_u1 "_ZGVeN8v_sinf"
+#define __sinf_u1_finite _ZGVeN8v___sinf_finite
+#define xcosf_u1 _ZGVeN8v_cosf
+#define str_xcosf_u1 "_ZGVeN8v_cosf"
+#define __cosf_u1_finite _ZGVeN8v___cosf_finite
+#define xsincosf_u1 _ZGVeN8vl4l4_sincosf
+#define str_xsincosf_u1 "_ZGVeN8vl4l4_sincosf"
+#define __sincosf_u1_finite _ZGVeN8vl4l4___sincosf_finite
+#define xtanf_u1 _ZGVeN8v_tanf
+#define str_xtanf_u1 "_ZGVeN8v_tanf"
+#define __tanf_u1_finite _ZGVeN8v___tanf_finite
+#define xasinf_u1 _ZGVeN8v_asinf
+#define str_xasinf_u1 "_ZGVeN8v_asinf"
+#define __asinf_u1_finite _ZGVeN8v___asinf_finite
+#define xacosf_u1 _ZGVeN8v_acosf
+#define str_xacosf_u1 "_ZGVeN8v_acosf"
+#define __acosf_u1_finite _ZGVeN8v___acosf_finite
+#define xatanf_u1 _ZGVeN8v_atanf
+#define str_xatanf_u1 "_ZGVeN8v_atanf"
+#define __atanf_u1_finite _ZGVeN8v___atanf_finite
+#define xatan2f_u1 _ZGVeN8vv_atan2f
+#define str_xatan2f_u1 "_ZGVeN8vv_atan2f"
+#define __atan2f_u1_finite _ZGVeN8vv___atan2f_finite
+#define xlogf_u1 _ZGVeN8v_logf
+#define str_xlogf_u1 "_ZGVeN8v_logf"
+#define __logf_u1_finite _ZGVeN8v___logf_finite
+#define xcbrtf_u1 _ZGVeN8v_cbrtf
+#define str_xcbrtf_u1 "_ZGVeN8v_cbrtf"
+#define __cbrtf_u1_finite _ZGVeN8v___cbrtf_finite
+#define xexpf _ZGVeN8v_expf
+#define str_xexpf "_ZGVeN8v_expf"
+#define __expf_finite _ZGVeN8v___expf_finite
+#define xpowf _ZGVeN8vv_powf
+#define str_xpowf "_ZGVeN8vv_powf"
+#define __powf_finite _ZGVeN8vv___powf_finite
+#define xsinhf _ZGVeN8v_sinhf
+#define str_xsinhf "_ZGVeN8v_sinhf"
+#define __sinhf_finite _ZGVeN8v___sinhf_finite
+#define xcoshf _ZGVeN8v_coshf
+#define str_xcoshf "_ZGVeN8v_coshf"
+#define __coshf_finite _ZGVeN8v___coshf_finite
+#define xtanhf _ZGVeN8v_tanhf
+#define str_xtanhf "_ZGVeN8v_tanhf"
+#define __tanhf_finite _ZGVeN8v___tanhf_finite
+#define xsinhf_u35 _ZGVeN8v_sinhf_u35
+#define str_xsinhf_u35 "_ZGVeN8v_sinhf_u35"
+#define __sinhf_u35_finite _ZGVeN8v___sinhf_finite
+#define xcoshf_u35 _ZGVeN8v_coshf_u35
+#define str_xcoshf_u35 "_ZGVeN8v_coshf_u35"
+#define __coshf_u35_finite _ZGVeN8v___coshf_finite
+#define xtanhf_u35 _ZGVeN8v_tanhf_u35
+#define str_xtanhf_u35 "_ZGVeN8v_tanhf_u35"
+#define __tanhf_u35_finite _ZGVeN8v___tanhf_finite
+#define xfastsinf_u3500 _ZGVeN8v_fastsinf_u3500
+#define str_xfastsinf_u3500 "_ZGVeN8v_fastsinf_u3500"
+#define __fastsinf_u3500_finite _ZGVeN8v___fastsinf_finite
+#define xfastcosf_u3500 _ZGVeN8v_fastcosf_u3500
+#define str_xfastcosf_u3500 "_ZGVeN8v_fastcosf_u3500"
+#define __fastcosf_u3500_finite _ZGVeN8v___fastcosf_finite
+#define xfastpowf_u3500 _ZGVeN8vv_fastpowf_u3500
+#define str_xfastpowf_u3500 "_ZGVeN8vv_fastpowf_u3500"
+#define __fastpowf_u3500_finite _ZGVeN8vv___fastpowf_finite
+#define xfastexpf_u3500 _ZGVeN8v_fastexpf_u3500
+#define str_xfastexpf_u3500 "_ZGVeN8v_fastexpf_u3500"
+#define __fastexpf_u3500_finite _ZGVeN8v___fastexpf_finite
+#define xfastexp2f_u3500 _ZGVeN8v_fastexp2f_u3500
+#define str_xfastexp2f_u3500 "_ZGVeN8v_fastexp2f_u3500"
+#define __fastexp2f_u3500_finite _ZGVeN8v___fastexp2f_finite
+#define xfastlogf_u3500 _ZGVeN8v_fastlogf_u3500
+#define str_xfastlogf_u3500 "_ZGVeN8v_fastlogf_u3500"
+#define __fastlogf_u3500_finite _ZGVeN8v___fastlogf_finite
+#define xfastlog2f_u3500 _ZGVeN8v_fastlog2f_u3500
+#define str_xfastlog2f_u3500 "_ZGVeN8v_fastlog2f_u3500"
+#define __fastlog2f_u3500_finite _ZGVeN8v___fastlog2f_finite
+#define xfasttanhf_u3500 _ZGVeN8v_fasttanhf_u3500
+#define str_xfasttanhf_u3500 "_ZGVeN8v_fasttanhf_u3500"
+#define __fasttanhf_u3500_finite _ZGVeN8v___fasttanhf_finite
+#define xfastatan2f_u3500 _ZGVeN8vv_fastatan2f_u3500
+#define str_xfastatan2f_u3500 "_ZGVeN8vv_fastatan2f_u3500"
+#define __fastatan2f_u3500_finite _ZGVeN8vv___fastatan2f_finite
+#define xfastrsqrtf_u3500 _ZGVeN8v_fastrsqrtf_u3500
+#define str_xfastrsqrtf_u3500 "_ZGVeN8v_fastrsqrtf_u3500"
+#define __fastrsqrtf_u3500_finite _ZGVeN8v___fastrsqrtf_finite
+#define xfastrcpf_u3500 _ZGVeN8v_fastrcpf_u3500
+#define str_xfastrcpf_u3500 "_ZGVeN8v_fastrcpf_u3500"
+#define __fastrcpf_u3500_finite _ZGVeN8v___fastrcpf_finite
+#define xasinhf _ZGVeN8v_asinhf
+#define str_xasinhf "_ZGVeN8v_asinhf"
+#define __asinhf_finite _ZGVeN8v___asinhf_finite
+#define xacoshf _ZGVeN8v_acoshf
+#define str_xacoshf "_ZGVeN8v_acoshf"
+#define __acoshf_finite _ZGVeN8v___acoshf_finite
+#define xatanhf _ZGVeN8v_atanhf
+#define str_xatanhf "_ZGVeN8v_atanhf"
+#define __atanhf_finite _ZGVeN8v___atanhf_finite
+#define xexp2f _ZGVeN8v_exp2f
+#define str_xexp2f "_ZGVeN8v_exp2f"
+#define __exp2f_finite _ZGVeN8v___exp2f_finite
+#define xexp2f_u35 _ZGVeN8v_exp2f_u35
+#define str_xexp2f_u35 "_ZGVeN8v_exp2f_u35"
+#define __exp2f_u35_finite _ZGVeN8v___exp2f_finite
+#define xexp10f _ZGVeN8v_exp10f
+#define str_xexp10f "_ZGVeN8v_exp10f"
+#define __exp10f_finite _ZGVeN8v___exp10f_finite
+#define xexp10f_u35 _ZGVeN8v_exp10f_u35
+#define str_xexp10f_u35 "_ZGVeN8v_exp10f_u35"
+#define __exp10f_u35_finite _ZGVeN8v___exp10f_finite
+#define xexpm1f _ZGVeN8v_expm1f
+#define str_xexpm1f "_ZGVeN8v_expm1f"
+#define __expm1f_finite _ZGVeN8v___expm1f_finite
+#define xlog10f _ZGVeN8v_log10f
+#define str_xlog10f "_ZGVeN8v_log10f"
+#define __log10f_finite _ZGVeN8v___log10f_finite
+#define xlog2f _ZGVeN8v_log2f
+#define str_xlog2f "_ZGVeN8v_log2f"
+#define __log2f_finite _ZGVeN8v___log2f_finite
+#define xlog2f_u35 _ZGVeN8v_log2f_u35
+#define str_xlog2f_u35 "_ZGVeN8v_log2f_u35"
+#define __log2f_u35_finite _ZGVeN8v___log2f_finite
+#define xlog1pf _ZGVeN8v_log1pf
+#define str_xlog1pf "_ZGVeN8v_log1pf"
+#define __log1pf_finite _ZGVeN8v___log1pf_finite
+#define xsincospif_u05 _ZGVeN8vl4l4_sincospif
+#define str_xsincospif_u05 "_ZGVeN8vl4l4_sincospif"
+#define __sincospif_u05_finite _ZGVeN8vl4l4___sincospif_finite
+#define xsincospif_u35 _ZGVeN8vl4l4_sincospif_u35
+#define str_xsincospif_u35 "_ZGVeN8vl4l4_sincospif_u35"
+#define __sincospif_u35_finite _ZGVeN8vl4l4___sincospif_finite
+#define xsinpif_u05 _ZGVeN8v_sinpif
+#define str_xsinpif_u05 "_ZGVeN8v_sinpif"
+#define __sinpif_u05_finite _ZGVeN8v___sinpif_finite
+#define xcospif_u05 _ZGVeN8v_cospif
+#define str_xcospif_u05 "_ZGVeN8v_cospif"
+#define __cospif_u05_finite _ZGVeN8v___cospif_finite
+#define xldexpf _ZGVeN8vv_ldexpf
+#define str_xldexpf "_ZGVeN8vv_ldexpf"
+#define __ldexpf_finite _ZGVeN8vv___ldexpf_finite
+#define xilogbf _ZGVeN8v_ilogbf
+#define str_xilogbf "_ZGVeN8v_ilogbf"
+#define __ilogbf_finite _ZGVeN8v___ilogbf_finite
+#define xfmaf _ZGVeN8vvv_fmaf
+#define str_xfmaf "_ZGVeN8vvv_fmaf"
+#define __fmaf_finite _ZGVeN8vvv___fmaf_finite
+#define xsqrtf _ZGVeN8v_sqrtf
+#define str_xsqrtf "_ZGVeN8v_sqrtf"
+#define __sqrtf_finite _ZGVeN8v___sqrtf_finite
+#define xsqrtf_u35 _ZGVeN8v_sqrtf_u35
+#define str_xsqrtf_u35 "_ZGVeN8v_sqrtf_u35"
+#define __sqrtf_u35_finite _ZGVeN8v___sqrtf_finite
+#define xhypotf_u05 _ZGVeN8vv_hypotf
+#define str_xhypotf_u05 "_ZGVeN8vv_hypotf"
+#define __hypotf_u05_finite _ZGVeN8vv___hypotf_finite
+#define xhypotf_u35 _ZGVeN8vv_hypotf_u35
+#define str_xhypotf_u35 "_ZGVeN8vv_hypotf_u35"
+#define __hypotf_u35_finite _ZGVeN8vv___hypotf_finite
+#define xfabsf _ZGVeN8v_fabsf
+#define str_xfabsf "_ZGVeN8v_fabsf"
+#define __fabsf_finite _ZGVeN8v___fabsf_finite
+#define xcopysignf _ZGVeN8vv_copysignf
+#define str_xcopysignf "_ZGVeN8vv_copysignf"
+#define __copysignf_finite _ZGVeN8vv___copysignf_finite
+#define xfmaxf _ZGVeN8vv_fmaxf
+#define str_xfmaxf "_ZGVeN8vv_fmaxf"
+#define __fmaxf_finite _ZGVeN8vv___fmaxf_finite
+#define xfminf _ZGVeN8vv_fminf
+#define str_xfminf "_ZGVeN8vv_fminf"
+#define __fminf_finite _ZGVeN8vv___fminf_finite
+#define xfdimf _ZGVeN8vv_fdimf
+#define str_xfdimf "_ZGVeN8vv_fdimf"
+#define __fdimf_finite _ZGVeN8vv___fdimf_finite
+#define xtruncf _ZGVeN8v_truncf
+#define str_xtruncf "_ZGVeN8v_truncf"
+#define __truncf_finite _ZGVeN8v___truncf_finite
+#define xfloorf _ZGVeN8v_floorf
+#define str_xfloorf "_ZGVeN8v_floorf"
+#define __floorf_finite _ZGVeN8v___floorf_finite
+#define xceilf _ZGVeN8v_ceilf
+#define str_xceilf "_ZGVeN8v_ceilf"
+#define __ceilf_finite _ZGVeN8v___ceilf_finite
+#define xroundf _ZGVeN8v_roundf
+#define str_xroundf "_ZGVeN8v_roundf"
+#define __roundf_finite _ZGVeN8v___roundf_finite
+#define xrintf _ZGVeN8v_rintf
+#define str_xrintf "_ZGVeN8v_rintf"
+#define __rintf_finite _ZGVeN8v___rintf_finite
+#define xnextafterf _ZGVeN8vv_nextafterf
+#define str_xnextafterf "_ZGVeN8vv_nextafterf"
+#define __nextafterf_finite _ZGVeN8vv___nextafterf_finite
+#define xfrfrexpf _ZGVeN8v_frfrexpf
+#define str_xfrfrexpf "_ZGVeN8v_frfrexpf"
+#define __frfrexpf_finite _ZGVeN8v___frfrexpf_finite
+#define xexpfrexpf _ZGVeN8v_expfrexpf
+#define str_xexpfrexpf "_ZGVeN8v_expfrexpf"
+#define __expfrexpf_finite _ZGVeN8v___expfrexpf_finite
+#define xfmodf _ZGVeN8vv_fmodf
+#define str_xfmodf "_ZGVeN8vv_fmodf"
+#define __fmodf_finite _ZGVeN8vv___fmodf_finite
+#define xremainderf _ZGVeN8vv_remainderf
+#define str_xremainderf "_ZGVeN8vv_remainderf"
+#define __remainderf_finite _ZGVeN8vv___remainderf_finite
+#define xmodff _ZGVeN8vl4_modff
+#define str_xmodff "_ZGVeN8vl4_modff"
+#define __modff_finite _ZGVeN8vl4___modff_finite
+#define xlgammaf_u1 _ZGVeN8v_lgammaf
+#define str_xlgammaf_u1 "_ZGVeN8v_lgammaf"
+#define __lgammaf_u1_finite _ZGVeN8v___lgammaf_finite
+#define xtgammaf_u1 _ZGVeN8v_tgammaf
+#define str_xtgammaf_u1 "_ZGVeN8v_tgammaf"
+#define __tgammaf_u1_finite _ZGVeN8v___tgammaf_finite
+#define xerff_u1 _ZGVeN8v_erff
+#define str_xerff_u1 "_ZGVeN8v_erff"
+#define __erff_u1_finite _ZGVeN8v___erff_finite
+#define xerfcf_u15 _ZGVeN8v_erfcf
+#define str_xerfcf_u15 "_ZGVeN8v_erfcf"
+#define __erfcf_u15_finite _ZGVeN8v___erfcf_finite
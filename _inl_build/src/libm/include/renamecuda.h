@@ -0,0 +1,652 @@
+#ifndef DETERMINISTIC
+
+#define xsin Sleef_sind1_u35cuda
+#define ysin Sleef_finz_sind1_u35cuda
+#define xcos Sleef_cosd1_u35cuda
+#define ycos Sleef_finz_cosd1_u35cuda
+#define xsincos Sleef_sincosd1_u35cuda
+#define ysincos Sleef_finz_sincosd1_u35cuda
+#define xtan Sleef_tand1_u35cuda
+#define ytan Sleef_finz_tand1_u35cuda
+#define xasin Sleef_asind1_u35cuda
+#define yasin Sleef_finz_asind1_u35cuda
+#define xacos Sleef_acosd1_u35cuda
+#define yacos Sleef_finz_acosd1_u35cuda
+#define xatan Sleef_atand1_u35cuda
+#define yatan Sleef_finz_atand1_u35cuda
+#define xatan2 Sleef_atan2d1_u35cuda
+#define yatan2 Sleef_finz_atan2d1_u35cuda
+#define xlog Sleef_logd1_u35cuda
+#define ylog Sleef_finz_logd1_u35cuda
+#define xcbrt Sleef_cbrtd1_u35cuda
+#define ycbrt Sleef_finz_cbrtd1_u35cuda
+#define xsin_u1 Sleef_sind1_u10cuda
+#define ysin_u1 Sleef_finz_sind1_u10cuda
+#define xcos_u1 Sleef_cosd1_u10cuda
+#define ycos_u1 Sleef_finz_cosd1_u10cuda
+#define xsincos_u1 Sleef_sincosd1_u10cuda
+#define ysincos_u1 Sleef_finz_sincosd1_u10cuda
+#define xtan_u1 Sleef_tand1_u10cuda
+#define ytan_u1 Sleef_finz_tand1_u10cuda
+#define xasin_u1 Sleef_asind1_u10cuda
+#define yasin_u1 Sleef_finz_asind1_u10cuda
+#define xacos_u1 Sleef_acosd1_u10cuda
+#define yacos_u1 Sleef_finz_acosd1_u10cuda
+#define xatan_u1 Sleef_atand1_u10cuda
+#define yatan_u1 Sleef_finz_atand1_u10cuda
+#define xatan2_u1 Sleef_atan2d1_u10cuda
+#define yatan2_u1 Sleef_finz_atan2d1_u10cuda
+#define xlog_u1 Sleef_logd1_u10cuda
+#define ylog_u1 Sleef_finz_logd1_u10cuda
+#define xcbrt_u1 Sleef_cbrtd1_u10cuda
+#define ycbrt_u1 Sleef_finz_cbrtd1_u10cuda
+#define xexp Sleef_expd1_u10cuda
+#define yexp Sleef_finz_expd1_u10cuda
+#define xpow Sleef_powd1_u10cuda
+#define ypow Sleef_finz_powd1_u10cuda
+#define xsinh Sleef_sinhd1_u10cuda
+#define ysinh Sleef_finz_sinhd1_u10cuda
+#define xcosh Sleef_coshd1_u10cuda
+#define ycosh Sleef_finz_coshd1_u10cuda
+#define xtanh Sleef_tanhd1_u10cuda
+#define ytanh Sleef_finz_tanhd1_u10cuda
+#define xsinh_u35 Sleef_sinhd1_u35cuda
+#define ysinh_u35 Sleef_finz_sinhd1_u35cuda
+#define xcosh_u35 Sleef_coshd1_u35cuda
+#define ycosh_u35 Sleef_finz_coshd1_u35cuda
+#define xtanh_u35 Sleef_tanhd1_u35cuda
+#define ytanh_u35 Sleef_finz_tanhd1_u35cuda
+#define xfastsin_u3500 Sleef_fastsind1_u3500cuda
+#define yfastsin_u3500 Sleef_finz_fastsind1_u3500cuda
+#define xfastcos_u3500 Sleef_fastcosd1_u3500cuda
+#define yfastcos_u3500 Sleef_finz_fastcosd1_u3500cuda
+#define xfastpow_u3500 Sleef_fastpowd1_u3500cuda
+#define yfastpow_u3500 Sleef_finz_fastpowd1_u3500cuda
+#define xfastexp_u3500 Sleef_fastexpd1_u3500cuda
+#define yfastexp_u3500 Sleef_finz_fastexpd1_u3500cuda
+#define xfastexp2_u3500 Sleef_fastexp2d1_u3500cuda
+#define yfastexp2_u3500 Sleef_finz_fastexp2d1_u3500cuda
+#define xfastlog_u3500 Sleef_fastlogd1_u3500cuda
+#define yfastlog_u3500 Sleef_finz_fastlogd1_u3500cuda
+#define xfastlog2_u3500 Sleef_fastlog2d1_u3500cuda
+#define yfastlog2_u3500 Sleef_finz_fastlog2d1_u3500cuda
+#define xfasttanh_u3500 Sleef_fasttanhd1_u3500cuda
+#define yfasttanh_u3500 Sleef_finz_fasttanhd1_u3500cuda
+#define xfastatan2_u3500 Sleef_fastatan2d1_u3500cuda
+#define yfastatan2_u3500 Sleef_finz_fastatan2d1_u3500cuda
+#define xfastrsqrt_u3500 Sleef_fastrsqrtd1_u3500cuda
+#define yfastrsqrt_u3500 Sleef_finz_fastrsqrtd1_u3500cuda
+#define xfastrcp_u3500 Sleef_fastrcpd1_u3500cuda
+#define yfastrcp_u3500 Sleef_finz_fastrcpd1_u3500cuda
+#define xsinr_u35 Sleef_sinrd1_u35cuda
+#define ysinr_u35 Sleef_finz_sinrd1_u35cuda
+#define xcosr_u35 Sleef_cosrd1_u35cuda
+#define ycosr_u35 Sleef_finz_cosrd1_u35cuda
+#define xsincosr_u35 Sleef_sincosrd1_u35cuda
+#define ysincosr_u35 Sleef_finz_sincosrd1_u35cuda
+#define xtanr_u35 Sleef_tanrd1_u35cuda
+#define ytanr_u35 Sleef_finz_tanrd1_u35cuda
+#define xasinh Sleef_asinhd1_u10cuda
+#define yasinh Sleef_finz_asinhd1_u10cuda
+#define xacosh Sleef_acoshd1_u10cuda
+#define yacosh Sleef_finz_acoshd1_u10cuda
+#define xatanh Sleef_atanhd1_u10cuda
+#define yatanh Sleef_finz_atanhd1_u10cuda
+#define xexp2 Sleef_exp2d1_u10cuda
+#define yexp2 Sleef_finz_exp2d1_u10cuda
+#define xexp2_u35 Sleef_exp2d1_u35cuda
+#define yexp2_u35 Sleef_finz_exp2d1_u35cuda
+#define xexp10 Sleef_exp10d1_u10cuda
+#define yexp10 Sleef_finz_exp10d1_u10cuda
+#define xexp10_u35 Sleef_exp10d1_u35cuda
+#define yexp10_u35 Sleef_finz_exp10d1_u35cuda
+#define xexpm1 Sleef_expm1d1_u10cuda
+#define yexpm1 Sleef_finz_expm1d1_u10cuda
+#define xlog10 Sleef_log10d1_u10cuda
+#define ylog10 Sleef_finz_log10d1_u10cuda
+#define xlog2 Sleef_log2d1_u10cuda
+#define ylog2 Sleef_finz_log2d1_u10cuda
+#define xlog2_u35 Sleef_log2d1_u35cuda
+#define ylog2_u35 Sleef_finz_log2d1_u35cuda
+#define xlog1p Sleef_log1pd1_u10cuda
+#define ylog1p Sleef_finz_log1pd1_u10cuda
+#define xsincospi_u05 Sleef_sincospid1_u05cuda
+#define ysincospi_u05 Sleef_finz_sincospid1_u05cuda
+#define xsincospi_u35 Sleef_sincospid1_u35cuda
+#define ysincospi_u35 Sleef_finz_sincospid1_u35cuda
+#define xsinpi_u05 Sleef_sinpid1_u05cuda
+#define ysinpi_u05 Sleef_finz_sinpid1_u05cuda
+#define xcospi_u05 Sleef_cospid1_u05cuda
+#define ycospi_u05 Sleef_finz_cospid1_u05cuda
+#define xldexp Sleef_ldexpd1_cuda
+#define yldexp Sleef_finz_ldexpd1_cuda
+#define xilogb Sleef_ilogbd1_cuda
+#define yilogb Sleef_finz_ilogbd1_cuda
+#define xfma Sleef_fmad1_cuda
+#define yfma Sleef_finz_fmad1_cuda
+#define xsqrt Sleef_sqrtd1_cuda
+#define ysqrt Sleef_finz_sqrtd1_cuda
+#define xsqrt_u05 Sleef_sqrtd1_u05cuda
+#define ysqrt_u05 Sleef_finz_sqrtd1_u05cuda
+#define xsqrt_u35 Sleef_sqrtd1_u35cuda
+#define ysqrt_u35 Sleef_finz_sqrtd1_u35cuda
+#define xhypot_u05 Sleef_hypotd1_u05cuda
+#define yhypot_u05 Sleef_finz_hypotd1_u05cuda
+#define xhypot_u35 Sleef_hypotd1_u35cuda
+#define yhypot_u35 Sleef_finz_hypotd1_u35cuda
+#define xfabs Sleef_fabsd1_cuda
+#define yfabs Sleef_finz_fabsd1_cuda
+#define xcopysign Sleef_copysignd1_cuda
+#define ycopysign Sleef_finz_copysignd1_cuda
+#define xfmax Sleef_fmaxd1_cuda
+#define yfmax Sleef_finz_fmaxd1_cuda
+#define xfmin Sleef_fmind1_cuda
+#define yfmin Sleef_finz_fmind1_cuda
+#define xfdim Sleef_fdimd1_cuda
+#define yfdim Sleef_finz_fdimd1_cuda
+#define xtrunc Sleef_truncd1_cuda
+#define ytrunc Sleef_finz_truncd1_cuda
+#define xfloor Sleef_floord1_cuda
+#define yfloor Sleef_finz_floord1_cuda
+#define xceil Sleef_ceild1_cuda
+#define yceil Sleef_finz_ceild1_cuda
+#define xround Sleef_roundd1_cuda
+#define yround Sleef_finz_roundd1_cuda
+#define xrint Sleef_rintd1_cuda
+#define yrint Sleef_finz_rintd1_cuda
+#define xnextafter Sleef_nextafterd1_cuda
+#define ynextafter Sleef_finz_nextafterd1_cuda
+#define xfrfrexp Sleef_frfrexpd1_cuda
+#define yfrfrexp Sleef_finz_frfrexpd1_cuda
+#define xexpfrexp Sleef_expfrexpd1_cuda
+#define yexpfrexp Sleef_finz_expfrexpd1_cuda
+#define xfmod Sleef_fmodd1_cuda
+#define yfmod Sleef_finz_fmodd1_cuda
+#define xremainder Sleef_remainderd1_cuda
+#define yremainder Sleef_finz_remainderd1_cuda
+#define xmodf Sleef_modfd1_cuda
+#define ymodf Sleef_finz_modfd1_cuda
+#define xlgamma_u1 Sleef_lgammad1_u10cuda
+#define ylgamma_u1 Sleef_finz_lgammad1_u10cuda
+#define xtgamma_u1 Sleef_tgammad1_u10cuda
+#define ytgamma_u1 Sleef_finz_tgammad1_u10cuda
+#define xerf_u1 Sleef_erfd1_u10cuda
+#define yerf_u1 Sleef_finz_erfd1_u10cuda
+#define xerfc_u15 Sleef_erfcd1_u15cuda
+#define yerfc_u15 Sleef_finz_erfcd1_u15cuda
+#define xsigmoid Sleef_sigmoidd1_u10cuda
+#define ysigmoid Sleef_finz_sigmoidd1_u10cuda
+#define xsigmoid_u35 Sleef_sigmoidd1_u35cuda
+#define ysigmoid_u35 Sleef_finz_sigmoidd1_u35cuda
+#define xsoftplus Sleef_softplusd1_u10cuda
+#define ysoftplus Sleef_finz_softplusd1_u10cuda
+#define xsoftplus_u35 Sleef_softplusd1_u35cuda
+#define ysoftplus_u35 Sleef_finz_softplusd1_u35cuda
+#define xsilu Sleef_silud1_u10cuda
+#define ysilu Sleef_finz_silud1_u10cuda
+#define xsilu_u35 Sleef_silud1_u35cuda
+#define ysilu_u35 Sleef_finz_silud1_u35cuda
+#define xgelutanh Sleef_gelutanhd1_u10cuda
+#define ygelutanh Sleef_finz_gelutanhd1_u10cuda
+#define xgelutanh_u35 Sleef_gelutanhd1_u35cuda
+#define ygelutanh_u35 Sleef_finz_gelutanhd1_u35cuda
+#define xgelu_u15 Sleef_gelud1_u15cuda
+#define ygelu_u15 Sleef_finz_gelud1_u15cuda
+#define xgetInt Sleef_getIntd1_cuda
+#define ygetInt Sleef_finz_getIntd1_cuda
+#define xgetPtr Sleef_getPtrd1_cuda
+#define ygetPtr Sleef_finz_getPtrd1_cuda
+
+#define xsinf Sleef_sinf1_u35cuda
+#define ysinf Sleef_finz_sinf1_u35cuda
+#define xcosf Sleef_cosf1_u35cuda
+#define ycosf Sleef_finz_cosf1_u35cuda
+#define xsincosf Sleef_sincosf1_u35cuda
+#define ysincosf Sleef_finz_sincosf1_u35cuda
+#define xtanf Sleef_tanf1_u35cuda
+#define ytanf Sleef_finz_tanf1_u35cuda
+#define xasinf Sleef_asinf1_u35cuda
+#define yasinf Sleef_finz_asinf1_u35cuda
+#define xacosf Sleef_acosf1_u35cuda
+#define yacosf Sleef_finz_acosf1_u35cuda
+#define xatanf Sleef_atanf1_u35cuda
+#define yatanf Sleef_finz_atanf1_u35cuda
+#define xatan2f Sleef_atan2f1_u35cuda
+#define yatan2f Sleef_finz_atan2f1_u35cuda
+#define xlogf Sleef_logf1_u35cuda
+#define ylogf Sleef_finz_logf1_u35cuda
+#define xcbrtf Sleef_cbrtf1_u35cuda
+#define ycbrtf Sleef_finz_cbrtf1_u35cuda
+#define xsinf_u1 Sleef_sinf1_u10cuda
+#define ysinf_u1 Sleef_finz_sinf1_u10cuda
+#define xcosf_u1 Sleef_cosf1_u10cuda
+#define ycosf_u1 Sleef_finz_cosf1_u10cuda
+#define xsincosf_u1 Sleef_sincosf1_u10cuda
+#define ysincosf_u1 Sleef_finz_sincosf1_u10cuda
+#define xtanf_u1 Sleef_tanf1_u10cuda
+#define ytanf_u1 Sleef_finz_tanf1_u10cuda
+#define xasinf_u1 Sleef_asinf1_u10cuda
+#define yasinf_u1 Sleef_finz_asinf1_u10cuda
+#define xacosf_u1 Sleef_acosf1_u10cuda
+#define yacosf_u1 Sleef_finz_acosf1_u10cuda
+#define xatanf_u1 Sleef_atanf1_u10cuda
+#define yatanf_u1 Sleef_finz_atanf1_u10cuda
+#define xatan2f_u1 Sleef_atan2f1_u10cuda
+#define yatan2f_u1 Sleef_finz_atan2f1_u10cuda
+#define xlogf_u1 Sleef_logf1_u10cuda
+#define ylogf_u1 Sleef_finz_logf1_u10cuda
+#define xcbrtf_u1 Sleef_cbrtf1_u10cuda
+#define ycbrtf_u1 Sleef_finz_cbrtf1_u10cuda
+#define xexpf Sleef_expf1_u10cuda
+#define yexpf Sleef_finz_expf1_u10cuda
+#define xpowf Sleef_powf1_u10cuda
+#define ypowf Sleef_finz_powf1_u10cuda
+#define xsinhf Sleef_sinhf1_u10cuda
+#define ysinhf Sleef_finz_sinhf1_u10cuda
+#define xcoshf Sleef_coshf1_u10cuda
+#define ycoshf Sleef_finz_coshf1_u10cuda
+#define xtanhf Sleef_tanhf1_u10cuda
+#define ytanhf Sleef_finz_tanhf1_u10cuda
+#define xsinhf_u35 Sleef_sinhf1_u35cuda
+#define ysinhf_u35 Sleef_finz_sinhf1_u35cuda
+#define xcoshf_u35 Sleef_coshf1_u35cuda
+#define ycoshf_u35 Sleef_finz_coshf1_u35cuda
+#define xtanhf_u35 Sleef_tanhf1_u35cuda
+#define ytanhf_u35 Sleef_finz_tanhf1_u35cuda
+#define xfastsinf_u3500 Sleef_fastsinf1_u3500cuda
+#define yfastsinf_u3500 Sleef_finz_fastsinf1_u3500cuda
+#define xfastcosf_u3500 Sleef_fastcosf1_u3500cuda
+#define yfastcosf_u3500 Sleef_finz_fastcosf1_u3500cuda
+#define xfastpowf_u3500 Sleef_fastpowf1_u3500cuda
+#define yfastpowf_u3500 Sleef_finz_fastpowf1_u3500cuda
+#define xfastexpf_u3500 Sleef_fastexpf1_u3500cuda
+#define yfastexpf_u3500 Sleef_finz_fastexpf1_u3500cuda
+#define xfastexp2f_u3500 Sleef_fastexp2f1_u3500cuda
+#define yfastexp2f_u3500 Sleef_finz_fastexp2f1_u3500cuda
+#define xfastlogf_u3500 Sleef_fastlogf1_u3500cuda
+#define yfastlogf_u3500 Sleef_finz_fastlogf1_u3500cuda
+#define xfastlog2f_u3500 Sleef_fastlog2f1_u3500cuda
+#define yfastlog2f_u3500 Sleef_finz_fastlog2f1_u3500cuda
+#define xfasttanhf_u3500 Sleef_fasttanhf1_u3500cuda
+#define yfasttanhf_u3500 Sleef_finz_fasttanhf1_u3500cuda
+#define xfastatan2f_u3500 Sleef_fastatan2f1_u3500cuda
+#define yfastatan2f_u3500 Sleef_finz_fastatan2f1_u3500cuda
+#define xfastrsqrtf_u3500 Sleef_fastrsqrtf1_u3500cuda
+#define yfastrsqrtf_u3500 Sleef_finz_fastrsqrtf1_u3500cuda
+#define xfastrcpf_u3500 Sleef_fastrcpf1_u3500cuda
+#define yfastrcpf_u3500 Sleef_finz_fastrcpf1_u3500cuda
+#define xsinrf_u35 Sleef_sinrf1_u35cuda
+#define ysinrf_u35 Sleef_finz_sinrf1_u35cuda
+#define xcosrf_u35 Sleef_cosrf1_u35cuda
+#define ycosrf_u35 Sleef_finz_cosrf1_u35cuda
+#define xsincosrf_u35 Sleef_sincosrf1_u35cuda
+#define ysincosrf_u35 Sleef_finz_sincosrf1_u35cuda
+#define xtanrf_u35 Sleef_tanrf1_u35cuda
+#define ytanrf_u35 Sleef_finz_tanrf1_u35cuda
+#define xasinhf Sleef_asinhf1_u10cuda
+#define yasinhf Sleef_finz_asinhf1_u10cuda
+#define xacoshf Sleef_acoshf1_u10cuda
+#define yacoshf Sleef_finz_acoshf1_u10cuda
+#define xatanhf Sleef_atanhf1_u10cuda
+#define yatanhf Sleef_finz_atanhf1_u10cuda
+#define xexp2f Sleef_exp2f1_u10cuda
+#define yexp2f Sleef_finz_exp2f1_u10cuda
+#define xexp2f_u35 Sleef_exp2f1_u35cuda
+#define yexp2f_u35 Sleef_finz_exp2f1_u35cuda
+#define xexp10f Sleef_exp10f1_u10cuda
+#define yexp10f Sleef_finz_exp10f1_u10cuda
+#define xexp10f_u35 Sleef_exp10f1_u35cuda
+#define yexp10f_u35 Sleef_finz_exp10f1_u35cuda
+#define xexpm1f Sleef_expm1f1_u10cuda
+#define yexpm1f Sleef_finz_expm1f1_u10cuda
+#define xlog10f Sleef_log10f1_u10cuda
+#define ylog10f Sleef_finz_log10f1_u10cuda
+#define xlog2f Sleef_log2f1_u10cuda
+#define ylog2f Sleef_finz_log2f1_u10cuda
+#define xlog2f_u35 Sleef_log2f1_u35cuda
+#define ylog2f_u35 Sleef_finz_log2f1_u35cuda
+#define xlog1pf Sleef_log1pf1_u10cuda
+#define ylog1pf Sleef_finz_log1pf1_u10cuda
+#define xsincospif_u05 Sleef_sincospif1_u05cuda
+#define ysincospif_u05 Sleef_finz_sincospif1_u05cuda
+#define xsincospif_u35 Sleef_sincospif1_u35cuda
+#define ysincospif_u35 Sleef_finz_sincospif1_u35cuda
+#define xsinpif_u05 Sleef_sinpif1_u05cuda
+#define ysinpif_u05 Sleef_finz_sinpif1_u05cuda
+#define xcospif_u05 Sleef_cospif1_u05cuda
+#define ycospif_u05 Sleef_finz_cospif1_u05cuda
+#define xldexpf Sleef_ldexpf1_cuda
+#define yldexpf Sleef_finz_ldexpf1_cuda
+#define xilogbf Sleef_ilogbf1_cuda
+#define yilogbf Sleef_finz_ilogbf1_cuda
+#define xfmaf Sleef_fmaf1_cuda
+#define yfmaf Sleef_finz_fmaf1_cuda
+#define xsqrtf Sleef_sqrtf1_cuda
+#define ysqrtf Sleef_finz_sqrtf1_cuda
+#define xsqrtf_u05 Sleef_sqrtf1_u05cuda
+#define ysqrtf_u05 Sleef_finz_sqrtf1_u05cuda
+#define xsqrtf_u35 Sleef_sqrtf1_u35cuda
+#define ysqrtf_u35 Sleef_finz_sqrtf1_u35cuda
+#define xhypotf_u05 Sleef_hypotf1_u05cuda
+#define yhypotf_u05 Sleef_finz_hypotf1_u05cuda
+#define xhypotf_u35 Sleef_hypotf1_u35cuda
+#define yhypotf_u35 Sleef_finz_hypotf1_u35cuda
+#define xfabsf Sleef_fabsf1_cuda
+#define yfabsf Sleef_finz_fabsf1_cuda
+#define xcopysignf Sleef_copysignf1_cuda
+#define ycopysignf Sleef_finz_copysignf1_cuda
+#define xfmaxf Sleef_fmaxf1_cuda
+#define yfmaxf Sleef_finz_fmaxf1_cuda
+#define xfminf Sleef_fminf1_cuda
+#define yfminf Sleef_finz_fminf1_cuda
+#define xfdimf Sleef_fdimf1_cuda
+#define yfdimf Sleef_finz_fdimf1_cuda
+#define xtruncf Sleef_truncf1_cuda
+#define ytruncf Sleef_finz_truncf1_cuda
+#define xfloorf Sleef_floorf1_cuda
+#define yfloorf Sleef_finz_floorf1_cuda
+#define xceilf Sleef_ceilf1_cuda
+#define yceilf Sleef_finz_ceilf1_cuda
+#define xroundf Sleef_roundf1_cuda
+#define yroundf Sleef_finz_roundf1_cuda
+#define xrintf Sleef_rintf1_cuda
+#define yrintf Sleef_finz_rintf1_cuda
+#define xnextafterf Sleef_nextafterf1_cuda
+#define ynextafterf Sleef_finz_nextafterf1_cuda
+#define xfrfrexpf Sleef_frfrexpf1_cuda
+#define yfrfrexpf Sleef_finz_frfrexpf1_cuda
+#define xexpfrexpf Sleef_expfrexpf1_cuda
+#define yexpfrexpf Sleef_finz_expfrexpf1_cuda
+#define xfmodf Sleef_fmodf1_cuda
+#define yfmodf Sleef_finz_fmodf1_cuda
+#define xremainderf Sleef_remainderf1_cuda
+#define yremainderf Sleef_finz_remainderf1_cuda
+#define xmodff Sleef_modff1_cuda
+#define ymodff Sleef_finz_modff1_cuda
+#define xlgammaf_u1 Sleef_lgammaf1_u10cuda
+#define ylgammaf_u1 Sleef_finz_lgammaf1_u10cuda
+#define xtgammaf_u1 Sleef_tgammaf1_u10cuda
+#define ytgammaf_u1 Sleef_finz_tgammaf1_u10cuda
+#define xerff_u1 Sleef_erff1_u10cuda
+#define yerff_u1 Sleef_finz_erff1_u10cuda
+#define xerfcf_u15 Sleef_erfcf1_u15cuda
+#define yerfcf_u15 Sleef_finz_erfcf1_u15cuda
+#define xsigmoidf Sleef_sigmoidf1_u10cuda
+#define ysigmoidf Sleef_finz_sigmoidf1_u10cuda
+#define xsigmoidf_u35 Sleef_sigmoidf1_u35cuda
+#define ysigmoidf_u35 Sleef_finz_sigmoidf1_u35cuda
+#define xsoftplusf Sleef_softplusf1_u10cuda
+#define ysoftplusf Sleef_finz_softplusf1_u10cuda
+#define xsoftplusf_u35 Sleef_softplusf1_u35cuda
+#define ysoftplusf_u35 Sleef_finz_softplusf1_u35cuda
+#define xsiluf Sleef_siluf1_u10cuda
+#define ysiluf Sleef_finz_siluf1_u10cuda
+#define xsiluf_u35 Sleef_siluf1_u35cuda
+#define ysiluf_u35 Sleef_finz_siluf1_u35cuda
+#define xgelutanhf Sleef_gelutanhf1_u10cuda
+#define ygelutanhf Sleef_finz_gelutanhf1_u10cuda
+#define xgelutanhf_u35 Sleef_gelutanhf1_u35cuda
+#define ygelutanhf_u35 Sleef_finz_gelutanhf1_u35cuda
+#define xgeluf_u15 Sleef_geluf1_u15cuda
+#define ygeluf_u15 Sleef_finz_geluf1_u15cuda
+#define xgetIntf Sleef_getIntf1_cuda
+#define ygetIntf Sleef_finz_getIntf1_cuda
+#define xgetPtrf Sleef_getPtrf1_cuda
+#define ygetPtrf Sleef_finz_getPtrf1_cuda
+
+#define xsinf16_u1 Sleef_sinh1_u10cuda
+#define xcosf16_u1 Sleef_cosh1_u10cuda
+#define xtanf16_u1 Sleef_tanh1_u10cuda
+#define xasinf16_u1 Sleef_asinh1_u10cuda
+#define xacosf16_u1 Sleef_acosh1_u10cuda
+#define xatanf16_u1 Sleef_atanh1_u10cuda
+#define xatan2f16_u1 Sleef_atan2h1_u10cuda
+#define xlogf16_u1 Sleef_logh1_u10cuda
+#define xcbrtf16_u1 Sleef_cbrth1_u10cuda
+#define xexpf16 Sleef_exph1_u10cuda
+#define xpowf16 Sleef_powh1_u10cuda
+#define xsinhf16 Sleef_sinhh1_u10cuda
+#define xcoshf16 Sleef_coshh1_u10cuda
+#define xtanhf16 Sleef_tanhh1_u10cuda
+#define xasinhf16 Sleef_asinhh1_u10cuda
+#define xacoshf16 Sleef_acoshh1_u10cuda
+#define xatanhf16 Sleef_atanhh1_u10cuda
+#define xexp2f16 Sleef_exp2h1_u10cuda
+#define xexp10f16 Sleef_exp10h1_u10cuda
+#define xexpm1f16 Sleef_expm1h1_u10cuda
+#define xlog10f16 Sleef_log10h1_u10cuda
+#define xlog2f16 Sleef_log2h1_u10cuda
+#define xlog1pf16 Sleef_log1ph1_u10cuda
+#define xsqrtf16 Sleef_sqrth1_cuda
+#define xlgammaf16_u1 Sleef_lgammah1_u10cuda
+#define xtgammaf16_u1 Sleef_tgammah1_u10cuda
+#define xerff16_u1 Sleef_erfh1_u10cuda
+#define xerfcf16_u15 Sleef_erfch1_u15cuda
+#define xsigmoidf16 Sleef_sigmoidh1_u10cuda
+#define xsoftplusf16 Sleef_softplush1_u10cuda
+#define xsiluf16 Sleef_siluh1_u10cuda
+#define xgelutanhf16 Sleef_gelutanhh1_u10cuda
+#define xgeluf16_u15 Sleef_geluh1_u15cuda
+
+#define xsinbf16_u1 Sleef_sinbf16x1_u10cuda
+#define xcosbf16_u1 Sleef_cosbf16x1_u10cuda
+#define xlogbf16_u1 Sleef_logbf16x1_u10cuda
+#define xexpbf16 Sleef_expbf16x1_u10cuda
+#define xpowbf16 Sleef_powbf16x1_u10cuda
+#define xtanhbf16 Sleef_tanhbf16x1_u10cuda
+#define xexp2bf16 Sleef_exp2bf16x1_u10cuda
+#define xexp10bf16 Sleef_exp10bf16x1_u10cuda
+#define xexpm1bf16 Sleef_expm1bf16x1_u10cuda
+#define xlog10bf16 Sleef_log10bf16x1_u10cuda
+#define xlog2bf16 Sleef_log2bf16x1_u10cuda
+#define xlog1pbf16 Sleef_log1pbf16x1_u10cuda
+#define xsqrtbf16 Sleef_sqrtbf16x1_cuda
+#define xerfbf16_u1 Sleef_erfbf16x1_u10cuda
+#define xerfcbf16_u15 Sleef_erfcbf16x1_u15cuda
+#define xsigmoidbf16 Sleef_sigmoidbf16x1_u10cuda
+#define xsoftplusbf16 Sleef_softplusbf16x1_u10cuda
+#define xsilubf16 Sleef_silubf16x1_u10cuda
+#define xgelutanhbf16 Sleef_gelutanhbf16x1_u10cuda
+#define xgelubf16_u15 Sleef_gelubf16x1_u15cuda
+
+#else //#ifndef DETERMINISTIC
+
+#define xsin Sleef_finz_sind1_u35cuda
+#define xcos Sleef_finz_cosd1_u35cuda
+#define xsincos Sleef_finz_sincosd1_u35cuda
+#define xtan Sleef_finz_tand1_u35cuda
+#define xasin Sleef_finz_asind1_u35cuda
+#define xacos Sleef_finz_acosd1_u35cuda
+#define xatan Sleef_finz_atand1_u35cuda
+#define xatan2 Sleef_finz_atan2d1_u35cuda
+#define xlog Sleef_finz_logd1_u35cuda
+#define xcbrt Sleef_finz_cbrtd1_u35cuda
+#define xsin_u1 Sleef_finz_sind1_u10cuda
+#define xcos_u1 Sleef_finz_cosd1_u10cuda
+#define xsincos_u1 Sleef_finz_sincosd1_u10cuda
+#define xtan_u1 Sleef_finz_tand1_u10cuda
+#define xasin_u1 Sleef_finz_asind1_u10cuda
+#define xacos_u1 Sleef_finz_acosd1_u10cuda
+#define xatan_u1 Sleef_finz_atand1_u10cuda
+#define xatan2_u1 Sleef_finz_atan2d1_u10cuda
+#define xlog_u1 Sleef_finz_logd1_u10cuda
+#define xcbrt_u1 Sleef_finz_cbrtd1_u10cuda
+#define xexp Sleef_finz_expd1_u10cuda
+#define xpow Sleef_finz_powd1_u10cuda
+#define xsinh Sleef_finz_sinhd1_u10cuda
+#define xcosh Sleef_finz_coshd1_u10cuda
+#define xtanh Sleef_finz_tanhd1_u10cuda
+#define xsinh_u35 Sleef_finz_sinhd1_u35cuda
+#define xcosh_u35 Sleef_finz_coshd1_u35cuda
+#define xtanh_u35 Sleef_finz_tanhd1_u35cuda
+#define xfastsin_u3500 Sleef_finz_fastsind1_u3500cuda
+#define xfastcos_u3500 Sleef_finz_fastcosd1_u3500cuda
+#define xfastpow_u3500 Sleef_finz_fastpowd1_u3500cuda
+#define xfastexp_u3500 Sleef_finz_fastexpd1_u3500cuda
+#define xfastexp2_u3500 Sleef_finz_fastexp2d1_u3500cuda
+#define xfastlog_u3500 Sleef_finz_fastlogd1_u3500cuda
+#define xfastlog2_u3500 Sleef_finz_fastlog2d1_u3500cuda
+#define xfasttanh_u3500 Sleef_finz_fasttanhd1_u3500cuda
+#define xfastatan2_u3500 Sleef_finz_fastatan2d1_u3500cuda
+#define xfastrsqrt_u3500 Sleef_finz_fastrsqrtd1_u3500cuda
+#define xfastrcp_u3500 Sleef_finz_fastrcpd1_u3500cuda
+#define xsinr_u35 Sleef_finz_sinrd1_u35cuda
+#define xcosr_u35 Sleef_finz_cosrd1_u35cuda
+#define xsincosr_u35 Sleef_finz_sincosrd1_u35cuda
+#define xtanr_u35 Sleef_finz_tanrd1_u35cuda
+#define xasinh Sleef_finz_asinhd1_u10cuda
+#define xacosh Sleef_finz_acoshd1_u10cuda
+#define xatanh Sleef_finz_atanhd1_u10cuda
+#define xexp2 Sleef_finz_exp2d1_u10cuda
+#define xexp2_u35 Sleef_finz_exp2d1_u35cuda
+#define xexp10 Sleef_finz_exp10d1_u10cuda
+#define xexp10_u35 Sleef_finz_exp10d1_u35cuda
+#define xexpm1 Sleef_finz_expm1d1_u10cuda
+#define xlog10 Sleef_finz_log10d1_u10cuda
+#define xlog2 Sleef_finz_log2d1_u10cuda
+#define xlog2_u35 Sleef_finz_log2d1_u35cuda
+#define xlog1p Sleef_finz_log1pd1_u10cuda
+#define xsincospi_u05 Sleef_finz_sincospid1_u05cuda
+#define xsincospi_u35 Sleef_finz_sincospid1_u35cuda
+#define xsinpi_u05 Sleef_finz_sinpid1_u05cuda
+#define xcospi_u05 Sleef_finz_cospid1_u05cuda
+#define xldexp Sleef_finz_ldexpd1_cuda
+#define xilogb Sleef_finz_ilogbd1_cuda
+#define xfma Sleef_finz_fmad1_cuda
+#define xsqrt Sleef_finz_sqrtd1_cuda
+#define xsqrt_u05 Sleef_finz_sqrtd1_u05cuda
+#define xsqrt_u35 Sleef_finz_sqrtd1_u35cuda
+#define xhypot_u05 Sleef_finz_hypotd1_u05cuda
+#define xhypot_u35 Sleef_finz_hypotd1_u35cuda
+#define xfabs Sleef_finz_fabsd1_cuda
+#define xcopysign Sleef_finz_copysignd1_cuda
+#define xfmax Sleef_finz_fmaxd1_cuda
+#define xfmin Sleef_finz_fmind1_cuda
+#define xfdim Sleef_finz_fdimd1_cuda
+#define xtrunc Sleef_finz_truncd1_cuda
+#define xfloor Sleef_finz_floord1_cuda
+#define xceil Sleef_finz_ceild1_cuda
+#define xround Sleef_finz_roundd1_cuda
+#define xrint Sleef_finz_rintd1_cuda
+#define xnextafter Sleef_finz_nextafterd1_cuda
+#define xfrfrexp Sleef_finz_frfrexpd1_cuda
+#define xexpfrexp Sleef_finz_expfrexpd1_cuda
+#define xfmod Sleef_finz_fmodd1_cuda
+#define xremainder Sleef_finz_remainderd1_cuda
+#define xmodf Sleef_finz_modfd1_cuda
+#define xlgamma_u1 Sleef_finz_lgammad1_u10cuda
+#define xtgamma_u1 Sleef_finz_tgammad1_u10cuda
+#define xerf_u1 Sleef_finz_erfd1_u10cuda
+#define xerfc_u15 Sleef_finz_erfcd1_u15cuda
+#define xsigmoid Sleef_finz_sigmoidd1_u10cuda
+#define xsigmoid_u35 Sleef_finz_sigmoidd1_u35cuda
+#define xsoftplus Sleef_finz_softplusd1_u10cuda
+#define xsoftplus_u35 Sleef_finz_softplusd1_u35cuda
+#define xsilu Sleef_finz_silud1_u10cuda
+#define xsilu_u35 Sleef_finz_silud1_u35cuda
+#define xgelutanh Sleef_finz_gelutanhd1_u10cuda
+#define xgelutanh_u35 Sleef_finz_gelutanhd1_u35cuda
+#define xgelu_u15 Sleef_finz_gelud1_u15cuda
+#define xgetInt Sleef_finz_getIntd1_cuda
+#define xgetPtr Sleef_finz_getPtrd1_cuda
+
+#define xsinf Sleef_finz_sinf1_u35cuda
+#define xcosf Sleef_finz_cosf1_u35cuda
+#define xsincosf Sleef_finz_sincosf1_u35cuda
+#define xtanf Sleef_finz_tanf1_u35cuda
+#define xasinf Sleef_finz_asinf1_u35cuda
+#define xacosf Sleef_finz_acosf1_u35cuda
+#define xatanf Sleef_finz_atanf1_u35cuda
+#define xatan2f Sleef_finz_atan2f1_u35cuda
+#define xlogf Sleef_finz_logf1_u35cuda
+#define xcbrtf Sleef_finz_cbrtf1_u35cuda
+#define xsinf_u1 Sleef_finz_sinf1_u10cuda
+#define xcosf_u1 Sleef_finz_cosf1_u10cuda
+#define xsincosf_u1 Sleef_finz_sincosf1_u10cuda
+#define xtanf_u1 Sleef_finz_tanf1_u10cuda
+#define xasinf_u1 Sleef_finz_asinf1_u10cuda
+#define xacosf_u1 Sleef_finz_acosf1_u10cuda
+#define xatanf_u1 Sleef_finz_atanf1_u10cuda
+#define xatan2f_u1 Sleef_finz_atan2f1_u10cuda
+#define xlogf_u1 Sleef_finz_logf1_u10cuda
+#define xcbrtf_u1 Sleef_finz_cbrtf1_u10cuda
+#define xexpf Sleef_finz_expf1_u10cuda
+#define xpowf Sleef_finz_powf1_u10cuda
+#define xsinhf Sleef_finz_sinhf1_u10cuda
+#define xcoshf Sleef_finz_coshf1_u10cuda
+#define xtanhf Sleef_finz_tanhf1_u10cuda
+#define xsinhf_u35 Sleef_finz_sinhf1_u35cuda
+#define xcoshf_u35 Sleef_finz_coshf1_u35cuda
+#define xtanhf_u35 Sleef_finz_tanhf1_u35cuda
+#define xfastsinf_u3500 Sleef_finz_fastsinf1_u3500cuda
+#define xfastcosf_u3500 Sleef_finz_fastcosf1_u3500cuda
+#define xfastpowf_u3500 Sleef_finz_fastpowf1_u3500cuda
+#define xfastexpf_u3500 Sleef_finz_fastexpf1_u3500cuda
+#define xfastexp2f_u3500 Sleef_finz_fastexp2f1_u3500cuda
+#define xfastlogf_u3500 Sleef_finz_fastlogf1_u3500cuda
+#define xfastlog2f_u3500 Sleef_finz_fastlog2f1_u3500cuda
+#define xfasttanhf_u3500 Sleef_finz_fasttanhf1_u3500cuda
+#define xfastatan2f_u3500 Sleef_finz_fastatan2f1_u3500cuda
+#define xfastrsqrtf_u3500 Sleef_finz_fastrsqrtf1_u3500cuda
+#define xfastrcpf_u3500 Sleef_finz_fastrcpf1_u3500cuda
+#define xsinrf_u35 Sleef_finz_sinrf1_u35cuda
+#define xcosrf_u35 Sleef_finz_cosrf1_u35cuda
+#define xsincosrf_u35 Sleef_finz_sincosrf1_u35cuda
+#define xtanrf_u35 Sleef_finz_tanrf1_u35cuda
+#define xasinhf Sleef_finz_asinhf1_u10cuda
+#define xacoshf Sleef_finz_acoshf1_u10cuda
+#define xatanhf Sleef_finz_atanhf1_u10cuda
+#define xexp2f Sleef_finz_exp2f1_u10cuda
+#define xexp2f_u35 Sleef_finz_exp2f1_u35cuda
+#define xexp10f Sleef_finz_exp10f1_u10cuda
+#define xexp10f_u35 Sleef_finz_exp10f1_u35cuda
+#define xexpm1f Sleef_finz_expm1f1_u10cuda
+#define xlog10f Sleef_finz_log10f1_u10cuda
+#define xlog2f Sleef_finz_log2f1_u10cuda
+#define xlog2f_u35 Sleef_finz_log2f1_u35cuda
+#define xlog1pf Sleef_finz_log1pf1_u10cuda
+#define xsincospif_u05 Sleef_finz_sincospif1_u05cuda
+#define xsincospif_u35 Sleef_finz_sincospif1_u35cuda
+#define xsinpif_u05 Sleef_finz_sinpif1_u05cuda
+#define xcospif_u05 Sleef_finz_cospif1_u05cuda
+#define xldexpf Sleef_finz_ldexpf1_cuda
+#define xilogbf Sleef_finz_ilogbf1_cuda
+#define xfmaf Sleef_finz_fmaf1_cuda
+#define xsqrtf Sleef_finz_sqrtf1_cuda
+#define xsqrtf_u05 Sleef_finz_sqrtf1_u05cuda
+#define xsqrtf_u35 Sleef_finz_sqrtf1_u35cuda
+#define xhypotf_u05 Sleef_finz_hypotf1_u05cuda
+#define xhypotf_u35 Sleef_finz_hypotf1_u35cuda
+#define xfabsf Sleef_finz_fabsf1_cuda
+#define xcopysignf Sleef_finz_copysignf1_cuda
+#define xfmaxf Sleef_finz_fmaxf1_cuda
+#define xfminf Sleef_finz_fminf1_cuda
+#define xfdimf Sleef_finz_fdimf1_cuda
+#define xtruncf Sleef_finz_truncf1_cuda
+#define xfloorf Sleef_finz_floorf1_cuda
+#define xceilf Sleef_finz_ceilf1_cuda
+#define xroundf Sleef_finz_roundf1_cuda
+#define xrintf Sleef_finz_rintf1_cuda
+#define xnextafterf Sleef_finz_nextafterf1_cuda
+#define xfrfrexpf Sleef_finz_frfrexpf1_cuda
+#define xexpfrexpf Sleef_finz_expfrexpf1_cuda
+#define xfmodf Sleef_finz_fmodf1_cuda
+#define xremainderf Sleef_finz_remainderf1_cuda
+#define xmodff Sleef_finz_modff1_cuda
+#define xlgammaf_u1 Sleef_finz_lgammaf1_u10cuda
+#define xtgammaf_u1 Sleef_finz_tgammaf1_u10cuda
+#define xerff_u1 Sleef_finz_erff1_u10cuda
+#define xerfcf_u15 Sleef_finz_erfcf1_u15cuda
+#define xsigmoidf Sleef_finz_sigmoidf1_u10cuda
+#define xsigmoidf_u35 Sleef_finz_sigmoidf1_u35cuda
+#define xsoftplusf Sleef_finz_softplusf1_u10cuda
+#define xsoftplusf_u35 Sleef_finz_softplusf1_u35cuda
+#define xsiluf Sleef_finz_siluf1_u10cuda
+#define xsiluf_u35 Sleef_finz_siluf1_u35cuda
+#define xgelutanhf Sleef_finz_gelutanhf1_u10cuda
+#define xgelutanhf_u35 Sleef_finz_gelutanhf1_u35cuda
+#define xgeluf_u15 Sleef_finz_geluf1_u15cuda
+#define xgetIntf Sleef_finz_getIntf1_cuda
+#define xgetPtrf Sleef_finz_getPtrf1_cuda
+
+#endif // #ifndef DETERMINISTIC
@@ -0,0 +1,256 @@
+#ifndef DETERMINISTIC
+
+#define xsin Sleef_sind2_u35
+#define xcos Sleef_cosd2_u35
+#define xsincos Sleef_sincosd2_u35
+#define xtan Sleef_tand2_u35
+#define xasin Sleef_asind2_u35
+#define xacos Sleef_acosd2_u35
+#define xatan Sleef_atand2_u35
+#define xatan2 Sleef_atan2d2_u35
+#define xlog Sleef_logd2_u35
+#define xcbrt Sleef_cbrtd2_u35
+#define xsin_u1 Sleef_sind2_u10
+#define xcos_u1 Sleef_cosd2_u10
+#define xsincos_u1 Sleef_sincosd2_u10
+#define xtan_u1 Sleef_tand2_u10
+#define xasin_u1 Sleef_asind2_u10
+#define xacos_u1 Sleef_acosd2_u10
+#define xatan_u1 Sleef_atand2_u10
+#define xatan2_u1 Sleef_atan2d2_u10
+#define xlog_u1 Sleef_logd2_u10
+#define xcbrt_u1 Sleef_cbrtd2_u10
+#define xexp Sleef_expd2_u10
+#define xpow Sleef_powd2_u10
+#define xsinh Sleef_sinhd2_u10
+#define xcosh Sleef_coshd2_u10
+#define xtanh Sleef_tanhd2_u10
+#define xsinh_u35 Sleef_sinhd2_u35
+#define xcosh_u35 Sleef_coshd2_u35
+#define xtanh_u35 Sleef_tanhd2_u35
+#define xfastsin_u3500 Sleef_fastsind2_u3500
+#define xfastcos_u3500 Sleef_fastcosd2_u3500
+#define xfastpow_u3500 Sleef_fastpowd2_u3500
+#define xfastexp_u3500 Sleef_fastexpd2_u3500
+#define xfastexp2_u3500 Sleef_fastexp2d2_u3500
+#define xfastlog_u3500 Sleef_fastlogd2_u3500
+#define xfastlog2_u3500 Sleef_fastlog2d2_u3500
+#define xfasttanh_u3500 Sleef_fasttanhd2_u3500
+#define xfastatan2_u3500 Sleef_fastatan2d2_u3500
+#define xfastrsqrt_u3500 Sleef_fastrsqrtd2_u3500
+#define xfastrcp_u3500 Sleef_fastrcpd2_u3500
+#define xsinr_u35 Sleef_sinrd2_u35
+#define xcosr_u35 Sleef_cosrd2_u35
+#define xsincosr_u35 Sleef_sincosrd2_u35
+#define xtanr_u35 Sleef_tanrd2_u35
+#define xasinh Sleef_asinhd2_u10
+#define xacosh Sleef_acoshd2_u10
+#define xatanh Sleef_atanhd2_u10
+#define xexp2 Sleef_exp2d2_u10
+#define xexp2_u35 Sleef_exp2d2_u35
+#define xexp10 Sleef_exp10d2_u10
+#define xexp10_u35 Sleef_exp10d2_u35
+#define xexpm1 Sleef_expm1d2_u10
+#define xlog10 Sleef_log10d2_u10
+#define xlog2 Sleef_log2d2_u10
+#define xlog2_u35 Sleef_log2d2_u35
+#define xlog1p Sleef_log1pd2_u10
+#define xsincospi_u05 Sleef_sincospid2_u05
+#define xsincospi_u35 Sleef_sincospid2_u35
+#define xsinpi_u05 Sleef_sinpid2_u05
+#define xcospi_u05 Sleef_cospid2_u05
+#define xldexp Sleef_ldexpd2
+#define xilogb Sleef_ilogbd2
+#define xfma Sleef_fmad2
+#define xsqrt Sleef_sqrtd2
+#define xsqrt_u05 Sleef_sqrtd2_u05
+#define xsqrt_u35 Sleef_sqrtd2_u35
+#define xhypot_u05 Sleef_hypotd2_u05
+#define xhypot_u35 Sleef_hypotd2_u35
+#define xfabs Sleef_fabsd2
+#define xcopysign Sleef_copysignd2
+#define xfmax Sleef_fmaxd2
+#define xfmin Sleef_fmind2
+#define xfdim Sleef_fdimd2
+#define xtrunc Sleef_truncd2
+#define xfloor Sleef_floord2
+#define xceil Sleef_ceild2
+#define xround Sleef_roundd2
+#define xrint Sleef_rintd2
+#define xnextafter Sleef_nextafterd2
+#define xfrfrexp Sleef_frfrexpd2
+#define xexpfrexp Sleef_expfrexpd2
+#define xfmod Sleef_fmodd2
+#define xremainder Sleef_remainderd2
+#define xmodf Sleef_modfd2
+#define xlgamma_u1 Sleef_lgammad2_u10
+#define xtgamma_u1 Sleef_tgammad2_u10
+#define xerf_u1 Sleef_erfd2_u10
+#define xerfc_u15 Sleef_erfcd2_u15
+#define xsigmoid Sleef_sigmoidd2_u10
+#define xsigmoid_u35 Sleef_sigmoidd2_u35
+#define xsoftplus Sleef_softplusd2_u10
+#define xsoftplus_u35 Sleef_softplusd2_u35
+#define xsilu Sleef_silud2_u10
+#define xsilu_u35 Sleef_silud2_u35
+#define xgelutanh Sleef_gelutanhd2_u10
+#define xgelutanh_u35 Sleef_gelutanhd2_u35
+#define xgelu_u15 Sleef_gelud2_u15
+#define xgetInt Sleef_getIntd2
+#define xgetPtr Sleef_getPtrd2
+
+#define xsinf Sleef_sinf4_u35
+#define xcosf Sleef_cosf4_u35
+#define xsincosf Sleef_sincosf4_u35
+#define xtanf Sleef_tanf4_u35
+#define xasinf Sleef_asinf4_u35
+#define xacosf Sleef_acosf4_u35
+#define xatanf Sleef_atanf4_u35
+#define xatan2f Sleef_atan2f4_u35
+#define xlogf Sleef_logf4_u35
+#define xcbrtf Sleef_cbrtf4_u35
+#define xsinf_u1 Sleef_sinf4_u10
+#define xcosf_u1 Sleef_cosf4_u10
+#define xsincosf_u1 Sleef_sincosf4_u10
+#define xtanf_u1 Sleef_tanf4_u10
+#define xasinf_u1 Sleef_asinf4_u10
+#define xacosf_u1 Sleef_acosf4_u10
+#define xatanf_u1 Sleef_atanf4_u10
+#define xatan2f_u1 Sleef_atan2f4_u10
+#define xlogf_u1 Sleef_logf4_u10
+#define xcbrtf_u1 Sleef_cbrtf4_u10
+#define xexpf Sleef_expf4_u10
+#define xpowf Sleef_powf4_u10
+#define xsinhf Sleef_sinhf4_u10
+#define xcoshf Sleef_coshf4_u10
+#define xtanhf Sleef_tanhf4_u10
+#define xsinhf_u35 Sleef_sinhf4_u35
+#define xcoshf_u35 Sleef_coshf4_u35
+#define xtanhf_u35 Sleef_tanhf4_u35
+#define xfastsinf_u3500 Sleef_fastsinf4_u3500
+#define xfastcosf_u3500 Sleef_fastcosf4_u3500
+#define xfastpowf_u3500 Sleef_fastpowf4_u3500
+#define xfastexpf_u3500 Sleef_fastexpf4_u3500
+#define xfastexp2f_u3500 Sleef_fastexp2f4_u3500
+#define xfastlogf_u3500 Sleef_fastlogf4_u3500
+#define xfastlog2f_u3500 Sleef_fastlog2f4_u3500
+#define xfasttanhf_u3500 Sleef_fasttanhf4_u3500
+#define xfastatan2f_u3500 Sleef_fastatan2f4_u3500
+#define xfastrsqrtf_u3500 Sleef_fastrsqrtf4_u3500
+#define xfastrcpf_u3500 Sleef_fastrcpf4_u3500
+#define xsinrf_u35 Sleef_sinrf4_u35
+#define xcosrf_u35 Sleef_cosrf4_u35
+#define xsincosrf_u35 Sleef_sincosrf4_u35
+#define xtanrf_u35 Sleef_tanrf4_u35
+#define xasinhf Sleef_asinhf4_u10
+#define xacoshf Sleef_acoshf4_u10
+#define xatanhf Sleef_atanhf4_u10
+#define xexp2f Sleef_exp2f4_u10
+#define xexp2f_u35 Sleef_exp2f4_u35
+#define xexp10f Sleef_exp10f4_u10
+#define xexp10f_u35 Sleef_exp10f4_u35
+#define xexpm1f Sleef_expm1f4_u10
+#define xlog10f Sleef_log10f4_u10
+#define xlog2f Sleef_log2f4_u10
+#define xlog2f_u35 Sleef_log2f4_u35
+#define xlog1pf Sleef_log1pf4_u10
+#define xsincospif_u05 Sleef_sincospif4_u05
+#define xsincospif_u35 Sleef_sincospif4_u35
+#define xsinpif_u05 Sleef_sinpif4_u05
+#define xcospif_u05 Sleef_cospif4_u05
+#define xldexpf Sleef_ldexpf4
+#define xilogbf Sleef_ilogbf4
+#define xfmaf Sleef_fmaf4
+#define xsqrtf Sleef_sqrtf4
+#define xsqrtf_u05 Sleef_sqrtf4_u05
+#define xsqrtf_u35 Sleef_sqrtf4_u35
+#define xhypotf_u05 Sleef_hypotf4_u05
+#define xhypotf_u35 Sleef_hypotf4_u35
+#define xfabsf Sleef_fabsf4
+#define xcopysignf Sleef_copysignf4
+#define xfmaxf Sleef_fmaxf4
+#define xfminf Sleef_fminf4
+#define xfdimf Sleef_fdimf4
+#define xtruncf Sleef_truncf4
+#define xfloorf Sleef_floorf4
+#define xceilf Sleef_ceilf4
+#define xroundf Sleef_roundf4
+#define xrintf Sleef_rintf4
+#define xnextafterf Sleef_nextafterf4
+#define xfrfrexpf Sleef_frfrexpf4
+#define xexpfrexpf Sleef_expfrexpf4
+#define xfmodf Sleef_fmodf4
+#define xremainderf Sleef_remainderf4
+#define xmodff Sleef_modff4
+#define xlgammaf_u1 Sleef_lgammaf4_u10
+#define xtgammaf_u1 Sleef_tgammaf4_u10
+#define xerff_u1 Sleef_erff4_u10
+#define xerfcf_u15 Sleef_erfcf4_u15
+#define xsigmoidf Sleef_sigmoidf4_u10
+#define xsigmoidf_u35 Sleef_sigmoidf4_u35
+#define xsoftplusf Sleef_softplusf4_u10
+#define xsoftplusf_u35 Sleef_softplusf4_u35
+#define xsiluf Sleef_siluf4_u10
+#define xsiluf_u35 Sleef_siluf4_u35
+#define xgelutanhf Sleef_gelutanhf4_u10
+#define xgelutanhf_u35 Sleef_gelutanhf4_u35
+#define xgeluf_u15 Sleef_geluf4_u15
+#define xgetIntf Sleef_getIntf4
+#define xgetPtrf Sleef_getPtrf4
+
+#define xsinf16_u1 Sleef_sinh4_u10
+#define xcosf16_u1 Sleef_cosh4_u10
+#define xtanf16_u1 Sleef_tanh4_u10
+#define xasinf16_u1 Sleef_asinh4_u10
+#define xacosf16_u1 Sleef_acosh4_u10
+#define xatanf16_u1 Sleef_atanh4_u10
+#define xatan2f16_u1 Sleef_atan2h4_u10
+#define xlogf16_u1 Sleef_logh4_u10
+#define xcbrtf16_u1 Sleef_cbrth4_u10
+#define xexpf16 Sleef_exph4_u10
+#define xpowf16 Sleef_powh4_u10
+#define xsinhf16 Sleef_sinhh4_u10
+#define xcoshf16 Sleef_coshh4_u10
+#define xtanhf16 Sleef_tanhh4_u10
+#define xasinhf16 Sleef_asinhh4_u10
+#define xacoshf16 Sleef_acoshh4_u10
+#define xatanhf16 Sleef_atanhh4_u10
+#define xexp2f16 Sleef_exp2h4_u10
+#define xexp10f16 Sleef_exp10h4_u10
+#define xexpm1f16 Sleef_expm1h4_u10
+#define xlog10f16 Sleef_log10h4_u10
+#define xlog2f16 Sleef_log2h4_u10
+#define xlog1pf16 Sleef_log1ph4_u10
+#define xsqrtf16 Sleef_sqrth4
+#define xlgammaf16_u1 Sleef_lgammah4_u10
+#define xtgammaf16_u1 Sleef_tgammah4_u10
+#define xerff16_u1 Sleef_erfh4_u10
+#define xerfcf16_u15 Sleef_erfch4_u15
+#define xsigmoidf16 Sleef_sigmoidh4_u10
+#define xsoftplusf16 Sleef_softplush4_u10
+#define xsiluf16 Sleef_siluh4_u10
+#define xgelutanhf16 Sleef_gelutanhh4_u10
+#define xgeluf16_u15 Sleef_geluh4_u15
+
+#define xsinbf16_u1 Sleef_sinbf16x4_u10
+#define xcosbf16_u1 Sleef_cosbf16x4_u10
+#define xlogbf16_u1 Sleef_logbf16x4_u10
+#define xexpbf16 Sleef_expbf16x4_u10
+#define xpowbf16 Sleef_powbf16x4_u10
+#define xtanhbf16 Sleef_tanhbf16x4_u10
+#define xexp2bf16 Sleef_exp2bf16x4_u10
+#define xexp10bf16 Sleef_exp10bf16x4_u10
+#define xexpm1bf16 Sleef_expm1bf16x4_u10
+#define xlog10bf16 Sleef_log10bf16x4_u10
+#define xlog2bf16 Sleef_log2bf16x4_u10
+#define xlog1pbf16 Sleef_log1pbf16x4_u10
+#define xsqrtbf16 Sleef_sqrtbf16x4
+#define xerfbf16_u1 Sleef_erfbf16x4_u10
+#define xerfcbf16_u15 Sleef_erfcbf16x4_u15
+#define xsigmoidbf16 Sleef_sigmoidbf16x4_u10
+#define xsoftplusbf16 Sleef_softplusbf16x4_u10
+#define xsilubf16 Sleef_silubf16x4_u10
+#define xgelutanhbf16 Sleef_gelutanhbf16x4_u10
+#define xgelubf16_u15 Sleef_gelubf16x4_u15
+
+#endif // #ifndef DETERMINISTIC
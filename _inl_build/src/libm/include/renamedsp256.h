@@ -0,0 +1,256 @@
+#ifndef DETERMINISTIC
+
+#define xsin Sleef_sind4_u35
+#define xcos Sleef_cosd4_u35
+#define xsincos Sleef_sincosd4_u35
+#define xtan Sleef_tand4_u35
+#define xasin Sleef_asind4_u35
+#define xacos Sleef_acosd4_u35
+#define xatan Sleef_atand4_u35
+#define xatan2 Sleef_atan2d4_u35
+#define xlog Sleef_logd4_u35
+#define xcbrt Sleef_cbrtd4_u35
+#define xsin_u1 Sleef_sind4_u10
+#define xcos_u1 Sleef_cosd4_u10
+#define xsincos_u1 Sleef_sincosd4_u10
+#define xtan_u1 Sleef_tand4_u10
+#define xasin_u1 Sleef_asind4_u10
+#define xacos_u1 Sleef_acosd4_u10
+#define xatan_u1 Sleef_atand4_u10
+#define xatan2_u1 Sleef_atan2d4_u10
+#define xlog_u1 Sleef_logd4_u10
+#define xcbrt_u1 Sleef_cbrtd4_u10
+#define xexp Sleef_expd4_u10
+#define xpow Sleef_powd4_u10
+#define xsinh Sleef_sinhd4_u10
+#define xcosh Sleef_coshd4_u10
+#define xtanh Sleef_tanhd4_u10
+#define xsinh_u35 Sleef_sinhd4_u35
+#define xcosh_u35 Sleef_coshd4_u35
+#define xtanh_u35 Sleef_tanhd4_u35
+#define xfastsin_u3500 Sleef_fastsind4_u3500
+#define xfastcos_u3500 Sleef_fastcosd4_u3500
+#define xfastpow_u3500 Sleef_fastpowd4_u3500
+#define xfastexp_u3500 Sleef_fastexpd4_u3500
+#define xfastexp2_u3500 Sleef_fastexp2d4_u3500
+#define xfastlog_u3500 Sleef_fastlogd4_u3500
+#define xfastlog2_u3500 Sleef_fastlog2d4_u3500
+#define xfasttanh_u3500 Sleef_fasttanhd4_u3500
+#define xfastatan2_u3500 Sleef_fastatan2d4_u3500
+#define xfastrsqrt_u3500 Sleef_fastrsqrtd4_u3500
+#define xfastrcp_u3500 Sleef_fastrcpd4_u3500
+#define xsinr_u35 Sleef_sinrd4_u35
+#define xcosr_u35 Sleef_cosrd4_u35
+#define xsincosr_u35 Sleef_sincosrd4_u35
+#define xtanr_u35 Sleef_tanrd4_u35
+#define xasinh Sleef_asinhd4_u10
+#define xacosh Sleef_acoshd4_u10
+#define xatanh Sleef_atanhd4_u10
+#define xexp2 Sleef_exp2d4_u10
+#define xexp2_u35 Sleef_exp2d4_u35
+#define xexp10 Sleef_exp10d4_u10
+#define xexp10_u35 Sleef_exp10d4_u35
+#define xexpm1 Sleef_expm1d4_u10
+#define xlog10 Sleef_log10d4_u10
+#define xlog2 Sleef_log2d4_u10
+#define xlog2_u35 Sleef_log2d4_u35
+#define xlog1p Sleef_log1pd4_u10
+#define xsincospi_u05 Sleef_sincospid4_u05
+#define xsincospi_u35 Sleef_sincospid4_u35
+#define xsinpi_u05 Sleef_sinpid4_u05
+#define xcospi_u05 Sleef_cospid4_u05
+#define xldexp Sleef_ldexpd4
+#define xilogb Sleef_ilogbd4
+#define xfma Sleef_fmad4
+#define xsqrt Sleef_sqrtd4
+#define xsqrt_u05 Sleef_sqrtd4_u05
+#define xsqrt_u35 Sleef_sqrtd4_u35
+#define xhypot_u05 Sleef_hypotd4_u05
+#define xhypot_u35 Sleef_hypotd4_u35
+#define xfabs Sleef_fabsd4
+#define xcopysign Sleef_copysignd4
+#define xfmax Sleef_fmaxd4
+#define xfmin Sleef_fmind4
+#define xfdim Sleef_fdimd4
+#define xtrunc Sleef_truncd4
+#define xfloor Sleef_floord4
+#define xceil Sleef_ceild4
+#define xround Sleef_roundd4
+#define xrint Sleef_rintd4
+#define xnextafter Sleef_nextafterd4
+#define xfrfrexp Sleef_frfrexpd4
+#define xexpfrexp Sleef_expfrexpd4
+#define xfmod Sleef_fmodd4
+#define xremainder Sleef_remainderd4
+#define xmodf Sleef_modfd4
+#define xlgamma_u1 Sleef_lgammad4_u10
+#define xtgamma_u1 Sleef_tgammad4_u10
+#define xerf_u1 Sleef_erfd4_u10
+#define xerfc_u15 Sleef_erfcd4_u15
+#define xsigmoid Sleef_sigmoidd4_u10
+#define xsigmoid_u35 Sleef_sigmoidd4_u35
+#define xsoftplus Sleef_softplusd4_u10
+#define xsoftplus_u35 Sleef_softplusd4_u35
+#define xsilu Sleef_silud4_u10
+#define xsilu_u35 Sleef_silud4_u35
+#define xgelutanh Sleef_gelutanhd4_u10
+#define xgelutanh_u35 Sleef_gelutanhd4_u35
+#define xgelu_u15 Sleef_gelud4_u15
+#define xgetInt Sleef_getIntd4
+#define xgetPtr Sleef_getPtrd4
+
+#define xsinf Sleef_sinf8_u35
+#define xcosf Sleef_cosf8_u35
+#define xsincosf Sleef_sincosf8_u35
+#define xtanf Sleef_tanf8_u35
+#define xasinf Sleef_asinf8_u35
+#define xacosf Sleef_acosf8_u35
+#define xatanf Sleef_atanf8_u35
+#define xatan2f Sleef_atan2f8_u35
+#define xlogf Sleef_logf8_u35
+#define xcbrtf Sleef_cbrtf8_u35
+#define xsinf_u1 Sleef_sinf8_u10
+#define xcosf_u1 Sleef_cosf8_u10
+#define xsincosf_u1 Sleef_sincosf8_u10
+#define xtanf_u1 Sleef_tanf8_u10
+#define xasinf_u1 Sleef_asinf8_u10
+#define xacosf_u1 Sleef_acosf8_u10
+#define xatanf_u1 Sleef_atanf8_u10
+#define xatan2f_u1 Sleef_atan2f8_u10
+#define xlogf_u1 Sleef_logf8_u10
+#define xcbrtf_u1 Sleef_cbrtf8_u10
+#define xexpf Sleef_expf8_u10
+#define xpowf Sleef_powf8_u10
+#define xsinhf Sleef_sinhf8_u10
+#define xcoshf Sleef_coshf8_u10
+#define xtanhf Sleef_tanhf8_u10
+#define xsinhf_u35 Sleef_sinhf8_u35
+#define xcoshf_u35 Sleef_coshf8_u35
+#define xtanhf_u35 Sleef_tanhf8_u35
+#define xfastsinf_u3500 Sleef_fastsinf8_u3500
+#define xfastcosf_u3500 Sleef_fastcosf8_u3500
+#define xfastpowf_u3500 Sleef_fastpowf8_u3500
+#define xfastexpf_u3500 Sleef_fastexpf8_u3500
+#define xfastexp2f_u3500 Sleef_fastexp2f8_u3500
+#define xfastlogf_u3500 Sleef_fastlogf8_u3500
+#define xfastlog2f_u3500 Sleef_fastlog2f8_u3500
+#define xfasttanhf_u3500 Sleef_fasttanhf8_u3500
+#define xfastatan2f_u3500 Sleef_fastatan2f8_u3500
+#define xfastrsqrtf_u3500 Sleef_fastrsqrtf8_u3500
+#define xfastrcpf_u3500 Sleef_fastrcpf8_u3500
+#define xsinrf_u35 Sleef_sinrf8_u35
+#define xcosrf_u35 Sleef_cosrf8_u35
+#define xsincosrf_u35 Sleef_sincosrf8_u35
+#define xtanrf_u35 Sleef_tanrf8_u35
+#define xasinhf Sleef_asinhf8_u10
+#define xacoshf Sleef_acoshf8_u10
+#define xatanhf Sleef_atanhf8_u10
+#define xexp2f Sleef_exp2f8_u10
+#define xexp2f_u35 Sleef_exp2f8_u35
+#define xexp10f Sleef_exp10f8_u10
+#define xexp10f_u35 Sleef_exp10f8_u35
+#define xexpm1f Sleef_expm1f8_u10
+#define xlog10f Sleef_log10f8_u10
+#define xlog2f Sleef_log2f8_u10
+#define xlog2f_u35 Sleef_log2f8_u35
+#define xlog1pf Sleef_log1pf8_u10
+#define xsincospif_u05 Sleef_sincospif8_u05
+#define xsincospif_u35 Sleef_sincospif8_u35
+#define xsinpif_u05 Sleef_sinpif8_u05
+#define xcospif_u05 Sleef_cospif8_u05
+#define xldexpf Sleef_ldexpf8
+#define xilogbf Sleef_ilogbf8
+#define xfmaf Sleef_fmaf8
+#define xsqrtf Sleef_sqrtf8
+#define xsqrtf_u05 Sleef_sqrtf8_u05
+#define xsqrtf_u35 Sleef_sqrtf8_u35
+#define xhypotf_u05 Sleef_hypotf8_u05
+#define xhypotf_u35 Sleef_hypotf8_u35
+#define xfabsf Sleef_fabsf8
+#define xcopysignf Sleef_copysignf8
+#define xfmaxf Sleef_fmaxf8
+#define xfminf Sleef_fminf8
+#define xfdimf Sleef_fdimf8
+#define xtruncf Sleef_truncf8
+#define xfloorf Sleef_floorf8
+#define xceilf Sleef_ceilf8
+#define xroundf Sleef_roundf8
+#define xrintf Sleef_rintf8
+#define xnextafterf Sleef_nextafterf8
+#define xfrfrexpf Sleef_frfrexpf8
+#define xexpfrexpf Sleef_expfrexpf8
+#define xfmodf Sleef_fmodf8
+#define xremainderf Sleef_remainderf8
+#define xmodff Sleef_modff8
+#define xlgammaf_u1 Sleef_lgammaf8_u10
+#define xtgammaf_u1 Sleef_tgammaf8_u10
+#define xerff_u1 Sleef_erff8_u10
+#define xerfcf_u15 Sleef_erfcf8_u15
+#define xsigmoidf Sleef_sigmoidf8_u10
+#define xsigmoidf_u35 Sleef_sigmoidf8_u35
+#define xsoftplusf Sleef_softplusf8_u10
+#define xsoftplusf_u35 Sleef_softplusf8_u35
+#define xsiluf Sleef_siluf8_u10
+#define xsiluf_u35 Sleef_siluf8_u35
+#define xgelutanhf Sleef_gelutanhf8_u10
+#define xgelutanhf_u35 Sleef_gelutanhf8_u35
+#define xgeluf_u15 Sleef_geluf8_u15
+#define xgetIntf Sleef_getIntf8
+#define xgetPtrf Sleef_getPtrf8
+
+#define xsinf16_u1 Sleef_sinh8_u10
+#define xcosf16_u1 Sleef_cosh8_u10
+#define xtanf16_u1 Sleef_tanh8_u10
+#define xasinf16_u1 Sleef_asinh8_u10
+#define xacosf16_u1 Sleef_acosh8_u10
+#define xatanf16_u1 Sleef_atanh8_u10
+#define xatan2f16_u1 Sleef_atan2h8_u10
+#define xlogf16_u1 Sleef_logh8_u10
+#define xcbrtf16_u1 Sleef_cbrth8_u10
+#define xexpf16 Sleef_exph8_u10
+#define xpowf16 Sleef_powh8_u10
+#define xsinhf16 Sleef_sinhh8_u10
+#define xcoshf16 Sleef_coshh8_u10
+#define xtanhf16 Sleef_tanhh8_u10
+#define xasinhf16 Sleef_asinhh8_u10
+#define xacoshf16 Sleef_acoshh8_u10
+#define xatanhf16 Sleef_atanhh8_u10
+#define xexp2f16 Sleef_exp2h8_u10
+#define xexp10f16 Sleef_exp10h8_u10
+#define xexpm1f16 Sleef_expm1h8_u10
+#define xlog10f16 Sleef_log10h8_u10
+#define xlog2f16 Sleef_log2h8_u10
+#define xlog1pf16 Sleef_log1ph8_u10
+#define xsqrtf16 Sleef_sqrth8
+#define xlgammaf16_u1 Sleef_lgammah8_u10
+#define xtgammaf16_u1 Sleef_tgammah8_u10
+#define xerff16_u1 Sleef_erfh8_u10
+#define xerfcf16_u15 Sleef_erfch8_u15
+#define xsigmoidf16 Sleef_sigmoidh8_u10
+#define xsoftplusf16 Sleef_softplush8_u10
+#define xsiluf16 Sleef_siluh8_u10
+#define xgelutanhf16 Sleef_gelutanhh8_u10
+#define xgeluf16_u15 Sleef_geluh8_u15
+
+#define xsinbf16_u1 Sleef_sinbf16x8_u10
+#define xcosbf16_u1 Sleef_cosbf16x8_u10
+#define xlogbf16_u1 Sleef_logbf16x8_u10
+#define xexpbf16 Sleef_expbf16x8_u10
+#define xpowbf16 Sleef_powbf16x8_u10
+#define xtanhbf16 Sleef_tanhbf16x8_u10
+#define xexp2bf16 Sleef_exp2bf16x8_u10
+#define xexp10bf16 Sleef_exp10bf16x8_u10
+#define xexpm1bf16 Sleef_expm1bf16x8_u10
+#define xlog10bf16 Sleef_log10bf16x8_u10
+#define xlog2bf16 Sleef_log2bf16x8_u10
+#define xlog1pbf16 Sleef_log1pbf16x8_u10
+#define xsqrtbf16 Sleef_sqrtbf16x8
+#define xerfbf16_u1 Sleef_erfbf16x8_u10
+#define xerfcbf16_u15 Sleef_erfcbf16x8_u15
+#define xsigmoidbf16 Sleef_sigmoidbf16x8_u10
+#define xsoftplusbf16 Sleef_softplusbf16x8_u10
+#define xsilubf16 Sleef_silubf16x8_u10
+#define xgelutanhbf16 Sleef_gelutanhbf16x8_u10
+#define xgelubf16_u15 Sleef_gelubf16x8_u15
+
+#endif // #ifndef DETERMINISTIC
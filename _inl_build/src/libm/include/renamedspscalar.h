@@ -0,0 +1,256 @@
+#ifndef DETERMINISTIC
+
+#define xsin Sleef_sind1_u35
+#define xcos Sleef_cosd1_u35
+#define xsincos Sleef_sincosd1_u35
+#define xtan Sleef_tand1_u35
+#define xasin Sleef_asind1_u35
+#define xacos Sleef_acosd1_u35
+#define xatan Sleef_atand1_u35
+#define xatan2 Sleef_atan2d1_u35
+#define xlog Sleef_logd1_u35
+#define xcbrt Sleef_cbrtd1_u35
+#define xsin_u1 Sleef_sind1_u10
+#define xcos_u1 Sleef_cosd1_u10
+#define xsincos_u1 Sleef_sincosd1_u10
+#define xtan_u1 Sleef_tand1_u10
+#define xasin_u1 Sleef_asind1_u10
+#define xacos_u1 Sleef_acosd1_u10
+#define xatan_u1 Sleef_atand1_u10
+#define xatan2_u1 Sleef_atan2d1_u10
+#define xlog_u1 Sleef_logd1_u10
+#define xcbrt_u1 Sleef_cbrtd1_u10
+#define xexp Sleef_expd1_u10
+#define xpow Sleef_powd1_u10
+#define xsinh Sleef_sinhd1_u10
+#define xcosh Sleef_coshd1_u10
+#define xtanh Sleef_tanhd1_u10
+#define xsinh_u35 Sleef_sinhd1_u35
+#define xcosh_u35 Sleef_coshd1_u35
+#define xtanh_u35 Sleef_tanhd1_u35
+#define xfastsin_u3500 Sleef_fastsind1_u3500
+#define xfastcos_u3500 Sleef_fastcosd1_u3500
+#define xfastpow_u3500 Sleef_fastpowd1_u3500
+#define xfastexp_u3500 Sleef_fastexpd1_u3500
+#define xfastexp2_u3500 Sleef_fastexp2d1_u3500
+#define xfastlog_u3500 Sleef_fastlogd1_u3500
+#define xfastlog2_u3500 Sleef_fastlog2d1_u3500
+#define xfasttanh_u3500 Sleef_fasttanhd1_u3500
+#define xfastatan2_u3500 Sleef_fastatan2d1_u3500
+#define xfastrsqrt_u3500 Sleef_fastrsqrtd1_u3500
+#define xfastrcp_u3500 Sleef_fastrcpd1_u3500
+#define xsinr_u35 Sleef_sinrd1_u35
+#define xcosr_u35 Sleef_cosrd1_u35
+#define xsincosr_u35 Sleef_sincosrd1_u35
+#define xtanr_u35 Sleef_tanrd1_u35
+#define xasinh Sleef_asinhd1_u10
+#define xacosh Sleef_acoshd1_u10
+#define xatanh Sleef_atanhd1_u10
+#define xexp2 Sleef_exp2d1_u10
+#define xexp2_u35 Sleef_exp2d1_u35
+#define xexp10 Sleef_exp10d1_u10
+#define xexp10_u35 Sleef_exp10d1_u35
+#define xexpm1 Sleef_expm1d1_u10
+#define xlog10 Sleef_log10d1_u10
+#define xlog2 Sleef_log2d1_u10
+#define xlog2_u35 Sleef_log2d1_u35
+#define xlog1p Sleef_log1pd1_u10
+#define xsincospi_u05 Sleef_sincospid1_u05
+#define xsincospi_u35 Sleef_sincospid1_u35
+#define xsinpi_u05 Sleef_sinpid1_u05
+#define xcospi_u05 Sleef_cospid1_u05
+#define xldexp Sleef_ldexpd1
+#define xilogb Sleef_ilogbd1
+#define xfma Sleef_fmad1
+#define xsqrt Sleef_sqrtd1
+#define xsqrt_u05 Sleef_sqrtd1_u05
+#define xsqrt_u35 Sleef_sqrtd1_u35
+#define xhypot_u05 Sleef_hypotd1_u05
+#define xhypot_u35 Sleef_hypotd1_u35
+#define xfabs Sleef_fabsd1
+#define xcopysign Sleef_copysignd1
+#define xfmax Sleef_fmaxd1
+#define xfmin Sleef_fmind1
+#define xfdim Sleef_fdimd1
+#define xtrunc Sleef_truncd1
+#define xfloor Sleef_floord1
+#define xceil Sleef_ceild1
+#define xround Sleef_roundd1
+#define xrint Sleef_rintd1
+#define xnextafter Sleef_nextafterd1
+#define xfrfrexp Sleef_frfrexpd1
+#define xexpfrexp Sleef_expfrexpd1
+#define xfmod Sleef_fmodd1
+#define xremainder Sleef_remainderd1
+#define xmodf Sleef_modfd1
+#define xlgamma_u1 Sleef_lgammad1_u10
+#define xtgamma_u1 Sleef_tgammad1_u10
+#define xerf_u1 Sleef_erfd1_u10
+#define xerfc_u15 Sleef_erfcd1_u15
+#define xsigmoid Sleef_sigmoidd1_u10
+#define xsigmoid_u35 Sleef_sigmoidd1_u35
+#define xsoftplus Sleef_softplusd1_u10
+#define xsoftplus_u35 Sleef_softplusd1_u35
+#define xsilu Sleef_silud1_u10
+#define xsilu_u35 Sleef_silud1_u35
+#define xgelutanh Sleef_gelutanhd1_u10
+#define xgelutanh_u35 Sleef_gelutanhd1_u35
+#define xgelu_u15 Sleef_gelud1_u15
+#define xgetInt Sleef_getIntd1
+#define xgetPtr Sleef_getPtrd1
+
+#define xsinf Sleef_sinf1_u35
+#define xcosf Sleef_cosf1_u35
+#define xsincosf Sleef_sincosf1_u35
+#define xtanf Sleef_tanf1_u35
+#define xasinf Sleef_asinf1_u35
+#define xacosf Sleef_acosf1_u35
+#define xatanf Sleef_atanf1_u35
+#define xatan2f Sleef_atan2f1_u35
+#define xlogf Sleef_logf1_u35
+#define xcbrtf Sleef_cbrtf1_u35
+#define xsinf_u1 Sleef_sinf1_u10
+#define xcosf_u1 Sleef_cosf1_u10
+#define xsincosf_u1 Sleef_sincosf1_u10
+#define xtanf_u1 Sleef_tanf1_u10
+#define xasinf_u1 Sleef_asinf1_u10
+#define xacosf_u1 Sleef_acosf1_u10
+#define xatanf_u1 Sleef_atanf1_u10
+#define xatan2f_u1 Sleef_atan2f1_u10
+#define xlogf_u1 Sleef_logf1_u10
+#define xcbrtf_u1 Sleef_cbrtf1_u10
+#define xexpf Sleef_expf1_u10
+#define xpowf Sleef_powf1_u10
+#define xsinhf Sleef_sinhf1_u10
+#define xcoshf Sleef_coshf1_u10
+#define xtanhf Sleef_tanhf1_u10
+#define xsinhf_u35 Sleef_sinhf1_u35
+#define xcoshf_u35 Sleef_coshf1_u35
+#define xtanhf_u35 Sleef_tanhf1_u35
+#define xfastsinf_u3500 Sleef_fastsinf1_u3500
+#define xfastcosf_u3500 Sleef_fastcosf1_u3500
+#define xfastpowf_u3500 Sleef_fastpowf1_u3500
+#define xfastexpf_u3500 Sleef_fastexpf1_u3500
+#define xfastexp2f_u3500 Sleef_fastexp2f1_u3500
+#define xfastlogf_u3500 Sleef_fastlogf1_u3500
+#define xfastlog2f_u3500 Sleef_fastlog2f1_u3500
+#define xfasttanhf_u3500 Sleef_fasttanhf1_u3500
+#define xfastatan2f_u3500 Sleef_fastatan2f1_u3500
+#define xfastrsqrtf_u3500 Sleef_fastrsqrtf1_u3500
+#define xfastrcpf_u3500 Sleef_fastrcpf1_u3500
+#define xsinrf_u35 Sleef_sinrf1_u35
+#define xcosrf_u35 Sleef_cosrf1_u35
+#define xsincosrf_u35 Sleef_sincosrf1_u35
+#define xtanrf_u35 Sleef_tanrf1_u35
+#define xasinhf Sleef_asinhf1_u10
+#define xacoshf Sleef_acoshf1_u10
+#define xatanhf Sleef_atanhf1_u10
+#define xexp2f Sleef_exp2f1_u10
+#define xexp2f_u35 Sleef_exp2f1_u35
+#define xexp10f Sleef_exp10f1_u10
+#define xexp10f_u35 Sleef_exp10f1_u35
+#define xexpm1f Sleef_expm1f1_u10
+#define xlog10f Sleef_log10f1_u10
+#define xlog2f Sleef_log2f1_u10
+#define xlog2f_u35 Sleef_log2f1_u35
+#define xlog1pf Sleef_log1pf1_u10
+#define xsincospif_u05 Sleef_sincospif1_u05
+#define xsincospif_u35 Sleef_sincospif1_u35
+#define xsinpif_u05 Sleef_sinpif1_u05
+#define xcospif_u05 Sleef_cospif1_u05
+#define xldexpf Sleef_ldexpf1
+#define xilogbf Sleef_ilogbf1
+#define xfmaf Sleef_fmaf1
+#define xsqrtf Sleef_sqrtf1
+#define xsqrtf_u05 Sleef_sqrtf1_u05
+#define xsqrtf_u35 Sleef_sqrtf1_u35
+#define xhypotf_u05 Sleef_hypotf1_u05
+#define xhypotf_u35 Sleef_hypotf1_u35
+#define xfabsf Sleef_fabsf1
+#define xcopysignf Sleef_copysignf1
+#define xfmaxf Sleef_fmaxf1
+#define xfminf Sleef_fminf1
+#define xfdimf Sleef_fdimf1
+#define xtruncf Sleef_truncf1
+#define xfloorf Sleef_floorf1
+#define xceilf Sleef_ceilf1
+#define xroundf Sleef_roundf1
+#define xrintf Sleef_rintf1
+#define xnextafterf Sleef_nextafterf1
+#define xfrfrexpf Sleef_frfrexpf1
+#define xexpfrexpf Sleef_expfrexpf1
+#define xfmodf Sleef_fmodf1
+#define xremainderf Sleef_remainderf1
+#define xmodff Sleef_modff1
+#define xlgammaf_u1 Sleef_lgammaf1_u10
+#define xtgammaf_u1 Sleef_tgammaf1_u10
+#define xerff_u1 Sleef_erff1_u10
+#define xerfcf_u15 Sleef_erfcf1_u15
+#define xsigmoidf Sleef_sigmoidf1_u10
+#define xsigmoidf_u35 Sleef_sigmoidf1_u35
+#define xsoftplusf Sleef_softplusf1_u10
+#define xsoftplusf_u35 Sleef_softplusf1_u35
+#define xsiluf Sleef_siluf1_u10
+#define xsiluf_u35 Sleef_siluf1_u35
+#define xgelutanhf Sleef_gelutanhf1_u10
+#define xgelutanhf_u35 Sleef_gelutanhf1_u35
+#define xgeluf_u15 Sleef_geluf1_u15
+#define xgetIntf Sleef_getIntf1
+#define xgetPtrf Sleef_getPtrf1
+
+#define xsinf16_u1 Sleef_sinh1_u10
+#define xcosf16_u1 Sleef_cosh1_u10
+#define xtanf16_u1 Sleef_tanh1_u10
+#define xasinf16_u1 Sleef_asinh1_u10
+#define xacosf16_u1 Sleef_acosh1_u10
+#define xatanf16_u1 Sleef_atanh1_u10
+#define xatan2f16_u1 Sleef_atan2h1_u10
+#define xlogf16_u1 Sleef_logh1_u10
+#define xcbrtf16_u1 Sleef_cbrth1_u10
+#define xexpf16 Sleef_exph1_u10
+#define xpowf16 Sleef_powh1_u10
+#define xsinhf16 Sleef_sinhh1_u10
+#define xcoshf16 Sleef_coshh1_u10
+#define xtanhf16 Sleef_tanhh1_u10
+#define xasinhf16 Sleef_asinhh1_u10
+#define xacoshf16 Sleef_acoshh1_u10
+#define xatanhf16 Sleef_atanhh1_u10
+#define xexp2f16 Sleef_exp2h1_u10
+#define xexp10f16 Sleef_exp10h1_u10
+#define xexpm1f16 Sleef_expm1h1_u10
+#define xlog10f16 Sleef_log10h1_u10
+#define xlog2f16 Sleef_log2h1_u10
+#define xlog1pf16 Sleef_log1ph1_u10
+#define xsqrtf16 Sleef_sqrth1
+#define xlgammaf16_u1 Sleef_lgammah1_u10
+#define xtgammaf16_u1 Sleef_tgammah1_u10
+#define xerff16_u1 Sleef_erfh1_u10
+#define xerfcf16_u15 Sleef_erfch1_u15
+#define xsigmoidf16 Sleef_sigmoidh1_u10
+#define xsoftplusf16 Sleef_softplush1_u10
+#define xsiluf16 Sleef_siluh1_u10
+#define xgelutanhf16 Sleef_gelutanhh1_u10
+#define xgeluf16_u15 Sleef_geluh1_u15
+
+#define xsinbf16_u1 Sleef_sinbf16x1_u10
+#define xcosbf16_u1 Sleef_cosbf16x1_u10
+#define xlogbf16_u1 Sleef_logbf16x1_u10
+#define xexpbf16 Sleef_expbf16x1_u10
+#define xpowbf16 Sleef_powbf16x1_u10
+#define xtanhbf16 Sleef_tanhbf16x1_u10
+#define xexp2bf16 Sleef_exp2bf16x1_u10
+#define xexp10bf16 Sleef_exp10bf16x1_u10
+#define xexpm1bf16 Sleef_expm1bf16x1_u10
+#define xlog10bf16 Sleef_log10bf16x1_u10
+#define xlog2bf16 Sleef_log2bf16x1_u10
+#define xlog1pbf16 Sleef_log1pbf16x1_u10
+#define xsqrtbf16 Sleef_sqrtbf16x1
+#define xerfbf16_u1 Sleef_erfbf16x1_u10
+#define xerfcbf16_u15 Sleef_erfcbf16x1_u15
+#define xsigmoidbf16 Sleef_sigmoidbf16x1_u10
+#define xsoftplusbf16 Sleef_softplusbf16x1_u10
+#define xsilubf16 Sleef_silubf16x1_u10
+#define xgelutanhbf16 Sleef_gelutanhbf16x1_u10
+#define xgelubf16_u15 Sleef_gelubf16x1_u15
+
+#endif // #ifndef DETERMINISTIC
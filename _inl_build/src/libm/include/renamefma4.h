@@ -0,0 +1,652 @@
+#ifndef DETERMINISTIC
+
+#define xsin Sleef_sind4_u35fma4
+#define ysin Sleef_finz_sind4_u35fma4
+#define xcos Sleef_cosd4_u35fma4
+#define ycos Sleef_finz_cosd4_u35fma4
+#define xsincos Sleef_sincosd4_u35fma4
+#define ysincos Sleef_finz_sincosd4_u35fma4
+#define xtan Sleef_tand4_u35fma4
+#define ytan Sleef_finz_tand4_u35fma4
+#define xasin Sleef_asind4_u35fma4
+#define yasin Sleef_finz_asind4_u35fma4
+#define xacos Sleef_acosd4_u35fma4
+#define yacos Sleef_finz_acosd4_u35fma4
+#define xatan Sleef_atand4_u35fma4
+#define yatan Sleef_finz_atand4_u35fma4
+#define xatan2 Sleef_atan2d4_u35fma4
+#define yatan2 Sleef_finz_atan2d4_u35fma4
+#define xlog Sleef_logd4_u35fma4
+#define ylog Sleef_finz_logd4_u35fma4
+#define xcbrt Sleef_cbrtd4_u35fma4
+#define ycbrt Sleef_finz_cbrtd4_u35fma4
+#define xsin_u1 Sleef_sind4_u10fma4
+#define ysin_u1 Sleef_finz_sind4_u10fma4
+#define xcos_u1 Sleef_cosd4_u10fma4
+#define ycos_u1 Sleef_finz_cosd4_u10fma4
+#define xsincos_u1 Sleef_sincosd4_u10fma4
+#define ysincos_u1 Sleef_finz_sincosd4_u10fma4
+#define xtan_u1 Sleef_tand4_u10fma4
+#define ytan_u1 Sleef_finz_tand4_u10fma4
+#define xasin_u1 Sleef_asind4_u10fma4
+#define yasin_u1 Sleef_finz_asind4_u10fma4
+#define xacos_u1 Sleef_acosd4_u10fma4
+#define yacos_u1 Sleef_finz_acosd4_u10fma4
+#define xatan_u1 Sleef_atand4_u10fma4
+#define yatan_u1 Sleef_finz_atand4_u10fma4
+#define xatan2_u1 Sleef_atan2d4_u10fma4
+#define yatan2_u1 Sleef_finz_atan2d4_u10fma4
+#define xlog_u1 Sleef_logd4_u10fma4
+#define ylog_u1 Sleef_finz_logd4_u10fma4
+#define xcbrt_u1 Sleef_cbrtd4_u10fma4
+#define ycbrt_u1 Sleef_finz_cbrtd4_u10fma4
+#define xexp Sleef_expd4_u10fma4
+#define yexp Sleef_finz_expd4_u10fma4
+#define xpow Sleef_powd4_u10fma4
+#define ypow Sleef_finz_powd4_u10fma4
+#define xsinh Sleef_sinhd4_u10fma4
+#define ysinh Sleef_finz_sinhd4_u10fma4
+#define xcosh Sleef_coshd4_u10fma4
+#define ycosh Sleef_finz_coshd4_u10fma4
+#define xtanh Sleef_tanhd4_u10fma4
+#define ytanh Sleef_finz_tanhd4_u10fma4
+#define xsinh_u35 Sleef_sinhd4_u35fma4
+#define ysinh_u35 Sleef_finz_sinhd4_u35fma4
+#define xcosh_u35 Sleef_coshd4_u35fma4
+#define ycosh_u35 Sleef_finz_coshd4_u35fma4
+#define xtanh_u35 Sleef_tanhd4_u35fma4
+#define ytanh_u35 Sleef_finz_tanhd4_u35fma4
+#define xfastsin_u3500 Sleef_fastsind4_u3500fma4
+#define yfastsin_u3500 Sleef_finz_fastsind4_u3500fma4
+#define xfastcos_u3500 Sleef_fastcosd4_u3500fma4
+#define yfastcos_u3500 Sleef_finz_fastcosd4_u3500fma4
+#define xfastpow_u3500 Sleef_fastpowd4_u3500fma4
+#define yfastpow_u3500 Sleef_finz_fastpowd4_u3500fma4
+#define xfastexp_u3500 Sleef_fastexpd4_u3500fma4
+#define yfastexp_u3500 Sleef_finz_fastexpd4_u3500fma4
+#define xfastexp2_u3500 Sleef_fastexp2d4_u3500fma4
+#define yfastexp2_u3500 Sleef_finz_fastexp2d4_u3500fma4
+#define xfastlog_u3500 Sleef_fastlogd4_u3500fma4
+#define yfastlog_u3500 Sleef_finz_fastlogd4_u3500fma4
+#define xfastlog2_u3500 Sleef_fastlog2d4_u3500fma4
+#define yfastlog2_u3500 Sleef_finz_fastlog2d4_u3500fma4
+#define xfasttanh_u3500 Sleef_fasttanhd4_u3500fma4
+#define yfasttanh_u3500 Sleef_finz_fasttanhd4_u3500fma4
+#define xfastatan2_u3500 Sleef_fastatan2d4_u3500fma4
+#define yfastatan2_u3500 Sleef_finz_fastatan2d4_u3500fma4
+#define xfastrsqrt_u3500 Sleef_fastrsqrtd4_u3500fma4
+#define yfastrsqrt_u3500 Sleef_finz_fastrsqrtd4_u3500fma4
+#define xfastrcp_u3500 Sleef_fastrcpd4_u3500fma4
+#define yfastrcp_u3500 Sleef_finz_fastrcpd4_u3500fma4
+#define xsinr_u35 Sleef_sinrd4_u35fma4
+#define ysinr_u35 Sleef_finz_sinrd4_u35fma4
+#define xcosr_u35 Sleef_cosrd4_u35fma4
+#define ycosr_u35 Sleef_finz_cosrd4_u35fma4
+#define xsincosr_u35 Sleef_sincosrd4_u35fma4
+#define ysincosr_u35 Sleef_finz_sincosrd4_u35fma4
+#define xtanr_u35 Sleef_tanrd4_u35fma4
+#define ytanr_u35 Sleef_finz_tanrd4_u35fma4
+#define xasinh Sleef_asinhd4_u10fma4
+#define yasinh Sleef_finz_asinhd4_u10fma4
+#define xacosh Sleef_acoshd4_u10fma4
+#define yacosh Sleef_finz_acoshd4_u10fma4
+#define xatanh Sleef_atanhd4_u10fma4
+#define yatanh Sleef_finz_atanhd4_u10fma4
+#define xexp2 Sleef_exp2d4_u10fma4
+#define yexp2 Sleef_finz_exp2d4_u10fma4
+#define xexp2_u35 Sleef_exp2d4_u35fma4
+#define yexp2_u35 Sleef_finz_exp2d4_u35fma4
+#define xexp10 Sleef_exp10d4_u10fma4
+#define yexp10 Sleef_finz_exp10d4_u10fma4
+#define xexp10_u35 Sleef_exp10d4_u35fma4
+#define yexp10_u35 Sleef_finz_exp10d4_u35fma4
+#define xexpm1 Sleef_expm1d4_u10fma4
+#define yexpm1 Sleef_finz_expm1d4_u10fma4
+#define xlog10 Sleef_log10d4_u10fma4
+#define ylog10 Sleef_finz_log10d4_u10fma4
+#define xlog2 Sleef_log2d4_u10fma4
+#define ylog2 Sleef_finz_log2d4_u10fma4
+#define xlog2_u35 Sleef_log2d4_u35fma4
+#define ylog2_u35 Sleef_finz_log2d4_u35fma4
+#define xlog1p Sleef_log1pd4_u10fma4
+#define ylog1p Sleef_finz_log1pd4_u10fma4
+#define xsincospi_u05 Sleef_sincospid4_u05fma4
+#define ysincospi_u05 Sleef_finz_sincospid4_u05fma4
+#define xsincospi_u35 Sleef_sincospid4_u35fma4
+#define ysincospi_u35 Sleef_finz_sincospid4_u35fma4
+#define xsinpi_u05 Sleef_sinpid4_u05fma4
+#define ysinpi_u05 Sleef_finz_sinpid4_u05fma4
+#define xcospi_u05 Sleef_cospid4_u05fma4
+#define ycospi_u05 Sleef_finz_cospid4_u05fma4
+#define xldexp Sleef_ldexpd4_fma4
+#define yldexp Sleef_finz_ldexpd4_fma4
+#define xilogb Sleef_ilogbd4_fma4
+#define yilogb Sleef_finz_ilogbd4_fma4
+#define xfma Sleef_fmad4_fma4
+#define yfma Sleef_finz_fmad4_fma4
+#define xsqrt Sleef_sqrtd4_fma4
+#define ysqrt Sleef_finz_sqrtd4_fma4
+#define xsqrt_u05 Sleef_sqrtd4_u05fma4
+#define ysqrt_u05 Sleef_finz_sqrtd4_u05fma4
+#define xsqrt_u35 Sleef_sqrtd4_u35fma4
+#define ysqrt_u35 Sleef_finz_sqrtd4_u35fma4
+#define xhypot_u05 Sleef_hypotd4_u05fma4
+#define yhypot_u05 Sleef_finz_hypotd4_u05fma4
+#define xhypot_u35 Sleef_hypotd4_u35fma4
+#define yhypot_u35 Sleef_finz_hypotd4_u35fma4
+#define xfabs Sleef_fabsd4_fma4
+#define yfabs Sleef_finz_fabsd4_fma4
+#define xcopysign Sleef_copysignd4_fma4
+#define ycopysign Sleef_finz_copysignd4_fma4
+#define xfmax Sleef_fmaxd4_fma4
+#define yfmax Sleef_finz_fmaxd4_fma4
+#define xfmin Sleef_fmind4_fma4
+#define yfmin Sleef_finz_fmind4_fma4
+#define xfdim Sleef_fdimd4_fma4
+#define yfdim Sleef_finz_fdimd4_fma4
+#define xtrunc Sleef_truncd4_fma4
+#define ytrunc Sleef_finz_truncd4_fma4
+#define xfloor Sleef_floord4_fma4
+#define yfloor Sleef_finz_floord4_fma4
+#define xceil Sleef_ceild4_fma4
+#define yceil Sleef_finz_ceild4_fma4
+#define xround Sleef_roundd4_fma4
+#define yround Sleef_finz_roundd4_fma4
+#define xrint Sleef_rintd4_fma4
+#define yrint Sleef_finz_rintd4_fma4
+#define xnextafter Sleef_nextafterd4_fma4
+#define ynextafter Sleef_finz_nextafterd4_fma4
+#define xfrfrexp Sleef_frfrexpd4_fma4
+#define yfrfrexp Sleef_finz_frfrexpd4_fma4
+#define xexpfrexp Sleef_expfrexpd4_fma4
+#define yexpfrexp Sleef_finz_expfrexpd4_fma4
+#define xfmod Sleef_fmodd4_fma4
+#define yfmod Sleef_finz_fmodd4_fma4
+#define xremainder Sleef_remainderd4_fma4
+#define yremainder Sleef_finz_remainderd4_fma4
+#define xmodf Sleef_modfd4_fma4
+#define ymodf Sleef_finz_modfd4_fma4
+#define xlgamma_u1 Sleef_lgammad4_u10fma4
+#define ylgamma_u1 Sleef_finz_lgammad4_u10fma4
+#define xtgamma_u1 Sleef_tgammad4_u10fma4
+#define ytgamma_u1 Sleef_finz_tgammad4_u10fma4
+#define xerf_u1 Sleef_erfd4_u10fma4
+#define yerf_u1 Sleef_finz_erfd4_u10fma4
+#define xerfc_u15 Sleef_erfcd4_u15fma4
+#define yerfc_u15 Sleef_finz_erfcd4_u15fma4
+#define xsigmoid Sleef_sigmoidd4_u10fma4
+#define ysigmoid Sleef_finz_sigmoidd4_u10fma4
+#define xsigmoid_u35 Sleef_sigmoidd4_u35fma4
+#define ysigmoid_u35 Sleef_finz_sigmoidd4_u35fma4
+#define xsoftplus Sleef_softplusd4_u10fma4
+#define ysoftplus Sleef_finz_softplusd4_u10fma4
+#define xsoftplus_u35 Sleef_softplusd4_u35fma4
+#define ysoftplus_u35 Sleef_finz_softplusd4_u35fma4
+#define xsilu Sleef_silud4_u10fma4
+#define ysilu Sleef_finz_silud4_u10fma4
+#define xsilu_u35 Sleef_silud4_u35fma4
+#define ysilu_u35 Sleef_finz_silud4_u35fma4
+#define xgelutanh Sleef_gelutanhd4_u10fma4
+#define ygelutanh Sleef_finz_gelutanhd4_u10fma4
+#define xgelutanh_u35 Sleef_gelutanhd4_u35fma4
+#define ygelutanh_u35 Sleef_finz_gelutanhd4_u35fma4
+#define xgelu_u15 Sleef_gelud4_u15fma4
+#define ygelu_u15 Sleef_finz_gelud4_u15fma4
+#define xgetInt Sleef_getIntd4_fma4
+#define ygetInt Sleef_finz_getIntd4_fma4
+#define xgetPtr Sleef_getPtrd4_fma4
+#define ygetPtr Sleef_finz_getPtrd4_fma4
+
+#define xsinf Sleef_sinf8_u35fma4
+#define ysinf Sleef_finz_sinf8_u35fma4
+#define xcosf Sleef_cosf8_u35fma4
+#define ycosf Sleef_finz_cosf8_u35fma4
+#define xsincosf Sleef_sincosf8_u35fma4
+#define ysincosf Sleef_finz_sincosf8_u35fma4
+#define xtanf Sleef_tanf8_u35fma4
+#define ytanf Sleef_finz_tanf8_u35fma4
+#define xasinf Sleef_asinf8_u35fma4
+#define yasinf Sleef_finz_asinf8_u35fma4
+#define xacosf Sleef_acosf8_u35fma4
+#define yacosf Sleef_finz_acosf8_u35fma4
+#define xatanf Sleef_atanf8_u35fma4
+#define yatanf Sleef_finz_atanf8_u35fma4
+#define xatan2f Sleef_atan2f8_u35fma4
+#define yatan2f Sleef_finz_atan2f8_u35fma4
+#define xlogf Sleef_logf8_u35fma4
+#define ylogf Sleef_finz_logf8_u35fma4
+#define xcbrtf Sleef_cbrtf8_u35fma4
+#define ycbrtf Sleef_finz_cbrtf8_u35fma4
+#define xsinf_u1 Sleef_sinf8_u10fma4
+#define ysinf_u1 Sleef_finz_sinf8_u10fma4
+#define xcosf_u1 Sleef_cosf8_u10fma4
+#define ycosf_u1 Sleef_finz_cosf8_u10fma4
+#define xsincosf_u1 Sleef_sincosf8_u10fma4
+#define ysincosf_u1 Sleef_finz_sincosf8_u10fma4
+#define xtanf_u1 Sleef_tanf8_u10fma4
+#define ytanf_u1 Sleef_finz_tanf8_u10fma4
+#define xasinf_u1 Sleef_asinf8_u10fma4
+#define yasinf_u1 Sleef_finz_asinf8_u10fma4
+#define xacosf_u1 Sleef_acosf8_u10fma4
+#define yacosf_u1 Sleef_finz_acosf8_u10fma4
+#define xatanf_u1 Sleef_atanf8_u10fma4
+#define yatanf_u1 Sleef_finz_atanf8_u10fma4
+#define xatan2f_u1 Sleef_atan2f8_u10fma4
+#define yatan2f_u1 Sleef_finz_atan2f8_u10fma4
+#define xlogf_u1 Sleef_logf8_u10fma4
+#define ylogf_u1 Sleef_finz_logf8_u10fma4
+#define xcbrtf_u1 Sleef_cbrtf8_u10fma4
+#define ycbrtf_u1 Sleef_finz_cbrtf8_u10fma4
+#define xexpf Sleef_expf8_u10fma4
+#define yexpf Sleef_finz_expf8_u10fma4
+#define xpowf Sleef_powf8_u10fma4
+#define ypowf Sleef_finz_powf8_u10fma4
+#define xsinhf Sleef_sinhf8_u10fma4
+#define ysinhf Sleef_finz_sinhf8_u10fma4
+#define xcoshf Sleef_coshf8_u10fma4
+#define ycoshf Sleef_finz_coshf8_u10fma4
+#define xtanhf Sleef_tanhf8_u10fma4
+#define ytanhf Sleef_finz_tanhf8_u10fma4
+#define xsinhf_u35 Sleef_sinhf8_u35fma4
+#define ysinhf_u35 Sleef_finz_sinhf8_u35fma4
+#define xcoshf_u35 Sleef_coshf8_u35fma4
+#define ycoshf_u35 Sleef_finz_coshf8_u35fma4
+#define xtanhf_u35 Sleef_tanhf8_u35fma4
+#define ytanhf_u35 Sleef_finz_tanhf8_u35fma4
+#define xfastsinf_u3500 Sleef_fastsinf8_u3500fma4
+#define yfastsinf_u3500 Sleef_finz_fastsinf8_u3500fma4
+#define xfastcosf_u3500 Sleef_fastcosf8_u3500fma4
+#define yfastcosf_u3500 Sleef_finz_fastcosf8_u3500fma4
+#define xfastpowf_u3500 Sleef_fastpowf8_u3500fma4
+#define yfastpowf_u3500 Sleef_finz_fastpowf8_u3500fma4
+#define xfastexpf_u3500 Sleef_fastexpf8_u3500fma4
+#define yfastexpf_u3500 Sleef_finz_fastexpf8_u3500fma4
+#define xfastexp2f_u3500 Sleef_fastexp2f8_u3500fma4
+#define yfastexp2f_u3500 Sleef_finz_fastexp2f8_u3500fma4
+#define xfastlogf_u3500 Sleef_fastlogf8_u3500fma4
+#define yfastlogf_u3500 Sleef_finz_fastlogf8_u3500fma4
+#define xfastlog2f_u3500 Sleef_fastlog2f8_u3500fma4
+#define yfastlog2f_u3500 Sleef_finz_fastlog2f8_u3500fma4
+#define xfasttanhf_u3500 Sleef_fasttanhf8_u3500fma4
+#define yfasttanhf_u3500 Sleef_finz_fasttanhf8_u3500fma4
+#define xfastatan2f_u3500 Sleef_fastatan2f8_u3500fma4
+#define yfastatan2f_u3500 Sleef_finz_fastatan2f8_u3500fma4
+#define xfastrsqrtf_u3500 Sleef_fastrsqrtf8_u3500fma4
+#define yfastrsqrtf_u3500 Sleef_finz_fastrsqrtf8_u3500fma4
+#define xfastrcpf_u3500 Sleef_fastrcpf8_u3500fma4
+#define yfastrcpf_u3500 Sleef_finz_fastrcpf8_u3500fma4
+#define xsinrf_u35 Sleef_sinrf8_u35fma4
+#define ysinrf_u35 Sleef_finz_sinrf8_u35fma4
+#define xcosrf_u35 Sleef_cosrf8_u35fma4
+#define ycosrf_u35 Sleef_finz_cosrf8_u35fma4
+#define xsincosrf_u35 Sleef_sincosrf8_u35fma4
+#define ysincosrf_u35 Sleef_finz_sincosrf8_u35fma4
+#define xtanrf_u35 Sleef_tanrf8_u35fma4
+#define ytanrf_u35 Sleef_finz_tanrf8_u35fma4
+#define xasinhf Sleef_asinhf8_u10fma4
+#define yasinhf Sleef_finz_asinhf8_u10fma4
+#define xacoshf Sleef_acoshf8_u10fma4
+#define yacoshf Sleef_finz_acoshf8_u10fma4
+#define xatanhf Sleef_atanhf8_u10fma4
+#define yatanhf Sleef_finz_atanhf8_u10fma4
+#define xexp2f Sleef_exp2f8_u10fma4
+#define yexp2f Sleef_finz_exp2f8_u10fma4
+#define xexp2f_u35 Sleef_exp2f8_u35fma4
+#define yexp2f_u35 Sleef_finz_exp2f8_u35fma4
+#define xexp10f Sleef_exp10f8_u10fma4
+#define yexp10f Sleef_finz_exp10f8_u10fma4
+#define xexp10f_u35 Sleef_exp10f8_u35fma4
+#define yexp10f_u35 Sleef_finz_exp10f8_u35fma4
+#define xexpm1f Sleef_expm1f8_u10fma4
+#define yexpm1f Sleef_finz_expm1f8_u10fma4
+#define xlog10f Sleef_log10f8_u10fma4
+#define ylog10f Sleef_finz_log10f8_u10fma4
+#define xlog2f Sleef_log2f8_u10fma4
+#define ylog2f Sleef_finz_log2f8_u10fma4
+#define xlog2f_u35 Sleef_log2f8_u35fma4
+#define ylog2f_u35 Sleef_finz_log2f8_u35fma4
+#define xlog1pf Sleef_log1pf8_u10fma4
+#define ylog1pf Sleef_finz_log1pf8_u10fma4
+#define xsincospif_u05 Sleef_sincospif8_u05fma4
+#define ysincospif_u05 Sleef_finz_sincospif8_u05fma4
+#define xsincospif_u35 Sleef_sincospif8_u35fma4
+#define ysincospif_u35 Sleef_finz_sincospif8_u35fma4
+#define xsinpif_u05 Sleef_sinpif8_u05fma4
+#define ysinpif_u05 Sleef_finz_sinpif8_u05fma4
+#define xcospif_u05 Sleef_cospif8_u05fma4
+#define ycospif_u05 Sleef_finz_cospif8_u05fma4
+#define xldexpf Sleef_ldexpf8_fma4
+#define yldexpf Sleef_finz_ldexpf8_fma4
+#define xilogbf Sleef_ilogbf8_fma4
+#define yilogbf Sleef_finz_ilogbf8_fma4
+#define xfmaf Sleef_fmaf8_fma4
+#define yfmaf Sleef_finz_fmaf8_fma4
+#define xsqrtf Sleef_sqrtf8_fma4
+#define ysqrtf Sleef_finz_sqrtf8_fma4
+#define xsqrtf_u05 Sleef_sqrtf8_u05fma4
+#define ysqrtf_u05 Sleef_finz_sqrtf8_u05fma4
+#define xsqrtf_u35 Sleef_sqrtf8_u35fma4
+#define ysqrtf_u35 Sleef_finz_sqrtf8_u35fma4
+#define xhypotf_u05 Sleef_hypotf8_u05fma4
+#define yhypotf_u05 Sleef_finz_hypotf8_u05fma4
+#define xhypotf_u35 Sleef_hypotf8_u35fma4
+#define yhypotf_u35 Sleef_finz_hypotf8_u35fma4
+#define xfabsf Sleef_fabsf8_fma4
+#define yfabsf Sleef_finz_fabsf8_fma4
+#define xcopysignf Sleef_copysignf8_fma4
+#define ycopysignf Sleef_finz_copysignf8_fma4
+#define xfmaxf Sleef_fmaxf8_fma4
+#define yfmaxf Sleef_finz_fmaxf8_fma4
+#define xfminf Sleef_fminf8_fma4
+#define yfminf Sleef_finz_fminf8_fma4
+#define xfdimf Sleef_fdimf8_fma4
+#define yfdimf Sleef_finz_fdimf8_fma4
+#define xtruncf Sleef_truncf8_fma4
+#define ytruncf Sleef_finz_truncf8_fma4
+#define xfloorf Sleef_floorf8_fma4
+#define yfloorf Sleef_finz_floorf8_fma4
+#define xceilf Sleef_ceilf8_fma4
+#define yceilf Sleef_finz_ceilf8_fma4
+#define xroundf Sleef_roundf8_fma4
+#define yroundf Sleef_finz_roundf8_fma4
+#define xrintf Sleef_rintf8_fma4
+#define yrintf Sleef_finz_rintf8_fma4
+#define xnextafterf Sleef_nextafterf8_fma4
+#define ynextafterf Sleef_finz_nextafterf8_fma4
+#define xfrfrexpf Sleef_frfrexpf8_fma4
+#define yfrfrexpf Sleef_finz_frfrexpf8_fma4
+#define xexpfrexpf Sleef_expfrexpf8_fma4
+#define yexpfrexpf Sleef_finz_expfrexpf8_fma4
+#define xfmodf Sleef_fmodf8_fma4
+#define yfmodf Sleef_finz_fmodf8_fma4
+#define xremainderf Sleef_remainderf8_fma4
+#define yremainderf Sleef_finz_remainderf8_fma4
+#define xmodff Sleef_modff8_fma4
+#define ymodff Sleef_finz_modff8_fma4
+#define xlgammaf_u1 Sleef_lgammaf8_u10fma4
+#define ylgammaf_u1 Sleef_finz_lgammaf8_u10fma4
+#define xtgammaf_u1 Sleef_tgammaf8_u10fma4
+#define ytgammaf_u1 Sleef_finz_tgammaf8_u10fma4
+#define xerff_u1 Sleef_erff8_u10fma4
+#define yerff_u1 Sleef_finz_erff8_u10fma4
+#define xerfcf_u15 Sleef_erfcf8_u15fma4
+#define yerfcf_u15 Sleef_finz_erfcf8_u15fma4
+#define xsigmoidf Sleef_sigmoidf8_u10fma4
+#define ysigmoidf Sleef_finz_sigmoidf8_u10fma4
+#define xsigmoidf_u35 Sleef_sigmoidf8_u35fma4
+#define ysigmoidf_u35 Sleef_finz_sigmoidf8_u35fma4
+#define xsoftplusf Sleef_softplusf8_u10fma4
+#define ysoftplusf Sleef_finz_softplusf8_u10fma4
+#define xsoftplusf_u35 Sleef_softplusf8_u35fma4
+#define ysoftplusf_u35 Sleef_finz_softplusf8_u35fma4
+#define xsiluf Sleef_siluf8_u10fma4
+#define ysiluf Sleef_finz_siluf8_u10fma4
+#define xsiluf_u35 Sleef_siluf8_u35fma4
+#define ysiluf_u35 Sleef_finz_siluf8_u35fma4
+#define xgelutanhf Sleef_gelutanhf8_u10fma4
+#define ygelutanhf Sleef_finz_gelutanhf8_u10fma4
+#define xgelutanhf_u35 Sleef_gelutanhf8_u35fma4
+#define ygelutanhf_u35 Sleef_finz_gelutanhf8_u35fma4
+#define xgeluf_u15 Sleef_geluf8_u15fma4
+#define ygeluf_u15 Sleef_finz_geluf8_u15fma4
+#define xgetIntf Sleef_getIntf8_fma4
+#define ygetIntf Sleef_finz_getIntf8_fma4
+#define xgetPtrf Sleef_getPtrf8_fma4
+#define ygetPtrf Sleef_finz_getPtrf8_fma4
+
+#define xsinf16_u1 Sleef_sinh8_u10fma4
+#define xcosf16_u1 Sleef_cosh8_u10fma4
+#define xtanf16_u1 Sleef_tanh8_u10fma4
+#define xasinf16_u1 Sleef_asinh8_u10fma4
+#define xacosf16_u1 Sleef_acosh8_u10fma4
+#define xatanf16_u1 Sleef_atanh8_u10fma4
+#define xatan2f16_u1 Sleef_atan2h8_u10fma4
+#define xlogf16_u1 Sleef_logh8_u10fma4
+#define xcbrtf16_u1 Sleef_cbrth8_u10fma4
+#define xexpf16 Sleef_exph8_u10fma4
+#define xpowf16 Sleef_powh8_u10fma4
+#define xsinhf16 Sleef_sinhh8_u10fma4
+#define xcoshf16 Sleef_coshh8_u10fma4
+#define xtanhf16 Sleef_tanhh8_u10fma4
+#define xasinhf16 Sleef_asinhh8_u10fma4
+#define xacoshf16 Sleef_acoshh8_u10fma4
+#define xatanhf16 Sleef_atanhh8_u10fma4
+#define xexp2f16 Sleef_exp2h8_u10fma4
+#define xexp10f16 Sleef_exp10h8_u10fma4
+#define xexpm1f16 Sleef_expm1h8_u10fma4
+#define xlog10f16 Sleef_log10h8_u10fma4
+#define xlog2f16 Sleef_log2h8_u10fma4
+#define xlog1pf16 Sleef_log1ph8_u10fma4
+#define xsqrtf16 Sleef_sqrth8_fma4
+#define xlgammaf16_u1 Sleef_lgammah8_u10fma4
+#define xtgammaf16_u1 Sleef_tgammah8_u10fma4
+#define xerff16_u1 Sleef_erfh8_u10fma4
+#define xerfcf16_u15 Sleef_erfch8_u15fma4
+#define xsigmoidf16 Sleef_sigmoidh8_u10fma4
+#define xsoftplusf16 Sleef_softplush8_u10fma4
+#define xsiluf16 Sleef_siluh8_u10fma4
+#define xgelutanhf16 Sleef_gelutanhh8_u10fma4
+#define xgeluf16_u15 Sleef_geluh8_u15fma4
+
+#define xsinbf16_u1 Sleef_sinbf16x8_u10fma4
+#define xcosbf16_u1 Sleef_cosbf16x8_u10fma4
+#define xlogbf16_u1 Sleef_logbf16x8_u10fma4
+#define xexpbf16 Sleef_expbf16x8_u10fma4
+#define xpowbf16 Sleef_powbf16x8_u10fma4
+#define xtanhbf16 Sleef_tanhbf16x8_u10fma4
+#define xexp2bf16 Sleef_exp2bf16x8_u10fma4
+#define xexp10bf16 Sleef_exp10bf16x8_u10fma4
+#define xexpm1bf16 Sleef_expm1bf16x8_u10fma4
+#define xlog10bf16 Sleef_log10bf16x8_u10fma4
+#define xlog2bf16 Sleef_log2bf16x8_u10fma4
+#define xlog1pbf16 Sleef_log1pbf16x8_u10fma4
+#define xsqrtbf16 Sleef_sqrtbf16x8_fma4
+#define xerfbf16_u1 Sleef_erfbf16x8_u10fma4
+#define xerfcbf16_u15 Sleef_erfcbf16x8_u15fma4
+#define xsigmoidbf16 Sleef_sigmoidbf16x8_u10fma4
+#define xsoftplusbf16 Sleef_softplusbf16x8_u10fma4
+#define xsilubf16 Sleef_silubf16x8_u10fma4
+#define xgelutanhbf16 Sleef_gelutanhbf16x8_u10fma4
+#define xgelubf16_u15 Sleef_gelubf16x8_u15fma4
+
+#else //#ifndef DETERMINISTIC
+
+#define xsin Sleef_finz_sind4_u35fma4
+#define xcos Sleef_finz_cosd4_u35fma4
+#define xsincos Sleef_finz_sincosd4_u35fma4
+#define xtan Sleef_finz_tand4_u35fma4
+#define xasin Sleef_finz_asind4_u35fma4
+#define xacos Sleef_finz_acosd4_u35fma4
+#define xatan Sleef_finz_atand4_u35fma4
+#define xatan2 Sleef_finz_atan2d4_u35fma4
+#define xlog Sleef_finz_logd4_u35fma4
+#define xcbrt Sleef_finz_cbrtd4_u35fma4
+#define xsin_u1 Sleef_finz_sind4_u10fma4
+#define xcos_u1 Sleef_finz_cosd4_u10fma4
+#define xsincos_u1 Sleef_finz_sincosd4_u10fma4
+#define xtan_u1 Sleef_finz_tand4_u10fma4
+#define xasin_u1 Sleef_finz_asind4_u10fma4
+#define xacos_u1 Sleef_finz_acosd4_u10fma4
+#define xatan_u1 Sleef_finz_atand4_u10fma4
+#define xatan2_u1 Sleef_finz_atan2d4_u10fma4
+#define xlog_u1 Sleef_finz_logd4_u10fma4
+#define xcbrt_u1 Sleef_finz_cbrtd4_u10fma4
+#define xexp Sleef_finz_expd4_u10fma4
+#define xpow Sleef_finz_powd4_u10fma4
+#define xsinh Sleef_finz_sinhd4_u10fma4
+#define xcosh Sleef_finz_coshd4_u10fma4
+#define xtanh Sleef_finz_tanhd4_u10fma4
+#define xsinh_u35 Sleef_finz_sinhd4_u35fma4
+#define xcosh_u35 Sleef_finz_coshd4_u35fma4
+#define xtanh_u35 Sleef_finz_tanhd4_u35fma4
+#define xfastsin_u3500 Sleef_finz_fastsind4_u3500fma4
+#define xfastcos_u3500 Sleef_finz_fastcosd4_u3500fma4
+#define xfastpow_u3500 Sleef_finz_fastpowd4_u3500fma4
+#define xfastexp_u3500 Sleef_finz_fastexpd4_u3500fma4
+#define xfastexp2_u3500 Sleef_finz_fastexp2d4_u3500fma4
+#define xfastlog_u3500 Sleef_finz_fastlogd4_u3500fma4
+#define xfastlog2_u3500 Sleef_finz_fastlog2d4_u3500fma4
+#define xfasttanh_u3500 Sleef_finz_fasttanhd4_u3500fma4
+#define xfastatan2_u3500 Sleef_finz_fastatan2d4_u3500fma4
+#define xfastrsqrt_u3500 Sleef_finz_fastrsqrtd4_u3500fma4
+#define xfastrcp_u3500 Sleef_finz_fastrcpd4_u3500fma4
+#define xsinr_u35 Sleef_finz_sinrd4_u35fma4
+#define xcosr_u35 Sleef_finz_cosrd4_u35fma4
+#define xsincosr_u35 Sleef_finz_sincosrd4_u35fma4
+#define xtanr_u35 Sleef_finz_tanrd4_u35fma4
+#define xasinh Sleef_finz_asinhd4_u10fma4
+#define xacosh Sleef_finz_acoshd4_u10fma4
+#define xatanh Sleef_finz_atanhd4_u10fma4
+#define xexp2 Sleef_finz_exp2d4_u10fma4
+#define xexp2_u35 Sleef_finz_exp2d4_u35fma4
+#define xexp10 Sleef_finz_exp10d4_u10fma4
+#define xexp10_u35 Sleef_finz_exp10d4_u35fma4
+#define xexpm1 Sleef_finz_expm1d4_u10fma4
+#define xlog10 Sleef_finz_log10d4_u10fma4
+#define xlog2 Sleef_finz_log2d4_u10fma4
+#define xlog2_u35 Sleef_finz_log2d4_u35fma4
+#define xlog1p Sleef_finz_log1pd4_u10fma4
+#define xsincospi_u05 Sleef_finz_sincospid4_u05fma4
+#define xsincospi_u35 Sleef_finz_sincospid4_u35fma4
+#define xsinpi_u05 Sleef_finz_sinpid4_u05fma4
+#define xcospi_u05 Sleef_finz_cospid4_u05fma4
+#define xldexp Sleef_finz_ldexpd4_fma4
+#define xilogb Sleef_finz_ilogbd4_fma4
+#define xfma Sleef_finz_fmad4_fma4
+#define xsqrt Sleef_finz_sqrtd4_fma4
+#define xsqrt_u05 Sleef_finz_sqrtd4_u05fma4
+#define xsqrt_u35 Sleef_finz_sqrtd4_u35fma4
+#define xhypot_u05 Sleef_finz_hypotd4_u05fma4
+#define xhypot_u35 Sleef_finz_hypotd4_u35fma4
+#define xfabs Sleef_finz_fabsd4_fma4
+#define xcopysign Sleef_finz_copysignd4_fma4
+#define xfmax Sleef_finz_fmaxd4_fma4
+#define xfmin Sleef_finz_fmind4_fma4
+#define xfdim Sleef_finz_fdimd4_fma4
+#define xtrunc Sleef_finz_truncd4_fma4
+#define xfloor Sleef_finz_floord4_fma4
+#define xceil Sleef_finz_ceild4_fma4
+#define xround Sleef_finz_roundd4_fma4
+#define xrint Sleef_finz_rintd4_fma4
+#define xnextafter Sleef_finz_nextafterd4_fma4
+#define xfrfrexp Sleef_finz_frfrexpd4_fma4
+#define xexpfrexp Sleef_finz_expfrexpd4_fma4
+#define xfmod Sleef_finz_fmodd4_fma4
+#define xremainder Sleef_finz_remainderd4_fma4
+#define xmodf Sleef_finz_modfd4_fma4
+#define xlgamma_u1 Sleef_finz_lgammad4_u10fma4
+#define xtgamma_u1 Sleef_finz_tgammad4_u10fma4
+#define xerf_u1 Sleef_finz_erfd4_u10fma4
+#define xerfc_u15 Sleef_finz_erfcd4_u15fma4
+#define xsigmoid Sleef_finz_sigmoidd4_u10fma4
+#define xsigmoid_u35 Sleef_finz_sigmoidd4_u35fma4
+#define xsoftplus Sleef_finz_softplusd4_u10fma4
+#define xsoftplus_u35 Sleef_finz_softplusd4_u35fma4
+#define xsilu Sleef_finz_silud4_u10fma4
+#define xsilu_u35 Sleef_finz_silud4_u35fma4
+#define xgelutanh Sleef_finz_gelutanhd4_u10fma4
+#define xgelutanh_u35 Sleef_finz_gelutanhd4_u35fma4
+#define xgelu_u15 Sleef_finz_gelud4_u15fma4
+#define xgetInt Sleef_finz_getIntd4_fma4
+#define xgetPtr Sleef_finz_getPtrd4_fma4
+
+#define xsinf Sleef_finz_sinf8_u35fma4
+#define xcosf Sleef_finz_cosf8_u35fma4
+#define xsincosf Sleef_finz_sincosf8_u35fma4
+#define xtanf Sleef_finz_tanf8_u35fma4
+#define xasinf Sleef_finz_asinf8_u35fma4
+#define xacosf Sleef_finz_acosf8_u35fma4
+#define xatanf Sleef_finz_atanf8_u35fma4
+#define xatan2f Sleef_finz_atan2f8_u35fma4
+#define xlogf Sleef_finz_logf8_u35fma4
+#define xcbrtf Sleef_finz_cbrtf8_u35fma4
+#define xsinf_u1 Sleef_finz_sinf8_u10fma4
+#define xcosf_u1 Sleef_finz_cosf8_u10fma4
+#define xsincosf_u1 Sleef_finz_sincosf8_u10fma4
+#define xtanf_u1 Sleef_finz_tanf8_u10fma4
+#define xasinf_u1 Sleef_finz_asinf8_u10fma4
+#define xacosf_u1 Sleef_finz_acosf8_u10fma4
+#define xatanf_u1 Sleef_finz_atanf8_u10fma4
+#define xatan2f_u1 Sleef_finz_atan2f8_u10fma4
+#define xlogf_u1 Sleef_finz_logf8_u10fma4
+#define xcbrtf_u1 Sleef_finz_cbrtf8_u10fma4
+#define xexpf Sleef_finz_expf8_u10fma4
+#define xpowf Sleef_finz_powf8_u10fma4
+#define xsinhf Sleef_finz_sinhf8_u10fma4
+#define xcoshf Sleef_finz_coshf8_u10fma4
+#define xtanhf Sleef_finz_tanhf8_u10fma4
+#define xsinhf_u35 Sleef_finz_sinhf8_u35fma4
+#define xcoshf_u35 Sleef_finz_coshf8_u35fma4
+#define xtanhf_u35 Sleef_finz_tanhf8_u35fma4
+#define xfastsinf_u3500 Sleef_finz_fastsinf8_u3500fma4
+#define xfastcosf_u3500 Sleef_finz_fastcosf8_u3500fma4
+#define xfastpowf_u3500 Sleef_finz_fastpowf8_u3500fma4
+#define xfastexpf_u3500 Sleef_finz_fastexpf8_u3500fma4
+#define xfastexp2f_u3500 Sleef_finz_fastexp2f8_u3500fma4
+#define xfastlogf_u3500 Sleef_finz_fastlogf8_u3500fma4
+#define xfastlog2f_u3500 Sleef_finz_fastlog2f8_u3500fma4
+#define xfasttanhf_u3500 Sleef_finz_fasttanhf8_u3500fma4
+#define xfastatan2f_u3500 Sleef_finz_fastatan2f8_u3500fma4
+#define xfastrsqrtf_u3500 Sleef_finz_fastrsqrtf8_u3500fma4
+#define xfastrcpf_u3500 Sleef_finz_fastrcpf8_u3500fma4
+#define xsinrf_u35 Sleef_finz_sinrf8_u35fma4
+#define xcosrf_u35 Sleef_finz_cosrf8_u35fma4
+#define xsincosrf_u35 Sleef_finz_sincosrf8_u35fma4
+#define xtanrf_u35 Sleef_finz_tanrf8_u35fma4
+#define xasinhf Sleef_finz_asinhf8_u10fma4
+#define xacoshf Sleef_finz_acoshf8_u10fma4
+#define xatanhf Sleef_finz_atanhf8_u10fma4
+#define xexp2f Sleef_finz_exp2f8_u10fma4
+#define xexp2f_u35 Sleef_finz_exp2f8_u35fma4
+#define xexp10f Sleef_finz_exp10f8_u10fma4
+#define xexp10f_u35 Sleef_finz_exp10f8_u35fma4
+#define xexpm1f Sleef_finz_expm1f8_u10fma4
+#define xlog10f Sleef_finz_log10f8_u10fma4
+#define xlog2f Sleef_finz_log2f8_u10fma4
+#define xlog2f_u35 Sleef_finz_log2f8_u35fma4
+#define xlog1pf Sleef_finz_log1pf8_u10fma4
+#define xsincospif_u05 Sleef_finz_sincospif8_u05fma4
+#define xsincospif_u35 Sleef_finz_sincospif8_u35fma4
+#define xsinpif_u05 Sleef_finz_sinpif8_u05fma4
+#define xcospif_u05 Sleef_finz_cospif8_u05fma4
+#define xldexpf Sleef_finz_ldexpf8_fma4
+#define xilogbf Sleef_finz_ilogbf8_fma4
+#define xfmaf Sleef_finz_fmaf8_fma4
+#define xsqrtf Sleef_finz_sqrtf8_fma4
+#define xsqrtf_u05 Sleef_finz_sqrtf8_u05fma4
+#define xsqrtf_u35 Sleef_finz_sqrtf8_u35fma4
+#define xhypotf_u05 Sleef_finz_hypotf8_u05fma4
+#define xhypotf_u35 Sleef_finz_hypotf8_u35fma4
+#define xfabsf Sleef_finz_fabsf8_fma4
+#define xcopysignf Sleef_finz_copysignf8_fma4
+#define xfmaxf Sleef_finz_fmaxf8_fma4
+#define xfminf Sleef_finz_fminf8_fma4
+#define xfdimf Sleef_finz_fdimf8_fma4
+#define xtruncf Sleef_finz_truncf8_fma4
+#define xfloorf Sleef_finz_floorf8_fma4
+#define xceilf Sleef_finz_ceilf8_fma4
+#define xroundf Sleef_finz_roundf8_fma4
+#define xrintf Sleef_finz_rintf8_fma4
+#define xnextafterf Sleef_finz_nextafterf8_fma4
+#define xfrfrexpf Sleef_finz_frfrexpf8_fma4
+#define xexpfrexpf Sleef_finz_expfrexpf8_fma4
+#define xfmodf Sleef_finz_fmodf8_fma4
+#define xremainderf Sleef_finz_remainderf8_fma4
+#define xmodff Sleef_finz_modff8_fma4
+#define xlgammaf_u1 Sleef_finz_lgammaf8_u10fma4
+#define xtgammaf_u1 Sleef_finz_tgammaf8_u10fma4
+#define xerff_u1 Sleef_finz_erff8_u10fma4
+#define xerfcf_u15 Sleef_finz_erfcf8_u15fma4
+#define xsigmoidf Sleef_finz_sigmoidf8_u10fma4
+#define xsigmoidf_u35 Sleef_finz_sigmoidf8_u35fma4
+#define xsoftplusf Sleef_finz_softplusf8_u10fma4
+#define xsoftplusf_u35 Sleef_finz_softplusf8_u35fma4
+#define xsiluf Sleef_finz_siluf8_u10fma4
+#define xsiluf_u35 Sleef_finz_siluf8_u35fma4
+#define xgelutanhf Sleef_finz_gelutanhf8_u10fma4
+#define xgelutanhf_u35 Sleef_finz_gelutanhf8_u35fma4
+#define xgeluf_u15 Sleef_finz_geluf8_u15fma4
+#define xgetIntf Sleef_finz_getIntf8_fma4
+#define xgetPtrf Sleef_finz_getPtrf8_fma4
+
+#endif // #ifndef DETERMINISTIC
@@ -0,0 +1,652 @@
+#ifndef DETERMINISTIC
+
+#define xsin Sleef_sind1_u35purec
+#define ysin Sleef_cinz_sind1_u35purec
+#define xcos Sleef_cosd1_u35purec
+#define ycos Sleef_cinz_cosd1_u35purec
+#define xsincos Sleef_sincosd1_u35purec
+#define ysincos Sleef_cinz_sincosd1_u35purec
+#define xtan Sleef_tand1_u35purec
+#define ytan Sleef_cinz_tand1_u35purec
+#define xasin Sleef_asind1_u35purec
+#define yasin Sleef_cinz_asind1_u35purec
+#define xacos Sleef_acosd1_u35purec
+#define yacos Sleef_cinz_acosd1_u35purec
+#define xatan Sleef_atand1_u35purec
+#define yatan Sleef_cinz_atand1_u35purec
+#define xatan2 Sleef_atan2d1_u35purec
+#define yatan2 Sleef_cinz_atan2d1_u35purec
+#define xlog Sleef_logd1_u35purec
+#define ylog Sleef_cinz_logd1_u35purec
+#define xcbrt Sleef_cbrtd1_u35purec
+#define ycbrt Sleef_cinz_cbrtd1_u35purec
+#define xsin_u1 Sleef_sind1_u10purec
+#define ysin_u1 Sleef_cinz_sind1_u10purec
+#define xcos_u1 Sleef_cosd1_u10purec
+#define ycos_u1 Sleef_cinz_cosd1_u10purec
+#define xsincos_u1 Sleef_sincosd1_u10purec
+#define ysincos_u1 Sleef_cinz_sincosd1_u10purec
+#define xtan_u1 Sleef_tand1_u10purec
+#define ytan_u1 Sleef_cinz_tand1_u10purec
+#define xasin_u1 Sleef_asind1_u10purec
+#define yasin_u1 Sleef_cinz_asind1_u10purec
+#define xacos_u1 Sleef_acosd1_u10purec
+#define yacos_u1 Sleef_cinz_acosd1_u10purec
+#define xatan_u1 Sleef_atand1_u10purec
+#define yatan_u1 Sleef_cinz_atand1_u10purec
+#define xatan2_u1 Sleef_atan2d1_u10purec
+#define yatan2_u1 Sleef_cinz_atan2d1_u10purec
+#define xlog_u1 Sleef_logd1_u10purec
+#define ylog_u1 Sleef_cinz_logd1_u10purec
+#define xcbrt_u1 Sleef_cbrtd1_u10purec
+#define ycbrt_u1 Sleef_cinz_cbrtd1_u10purec
+#define xexp Sleef_expd1_u10purec
+#define yexp Sleef_cinz_expd1_u10purec
+#define xpow Sleef_powd1_u10purec
+#define ypow Sleef_cinz_powd1_u10purec
+#define xsinh Sleef_sinhd1_u10purec
+#define ysinh Sleef_cinz_sinhd1_u10purec
+#define xcosh Sleef_coshd1_u10purec
+#define ycosh Sleef_cinz_coshd1_u10purec
+#define xtanh Sleef_tanhd1_u10purec
+#define ytanh Sleef_cinz_tanhd1_u10purec
+#define xsinh_u35 Sleef_sinhd1_u35purec
+#define ysinh_u35 Sleef_cinz_sinhd1_u35purec
+#define xcosh_u35 Sleef_coshd1_u35purec
+#define ycosh_u35 Sleef_cinz_coshd1_u35purec
+#define xtanh_u35 Sleef_tanhd1_u35purec
+#define ytanh_u35 Sleef_cinz_tanhd1_u35purec
+#define xfastsin_u3500 Sleef_fastsind1_u3500purec
+#define yfastsin_u3500 Sleef_cinz_fastsind1_u3500purec
+#define xfastcos_u3500 Sleef_fastcosd1_u3500purec
+#define yfastcos_u3500 Sleef_cinz_fastcosd1_u3500purec
+#define xfastpow_u3500 Sleef_fastpowd1_u3500purec
+#define yfastpow_u3500 Sleef_cinz_fastpowd1_u3500purec
+#define xfastexp_u3500 Sleef_fastexpd1_u3500purec
+#define yfastexp_u3500 Sleef_cinz_fastexpd1_u3500purec
+#define xfastexp2_u3500 Sleef_fastexp2d1_u3500purec
+#define yfastexp2_u3500 Sleef_cinz_fastexp2d1_u3500purec
+#define xfastlog_u3500 Sleef_fastlogd1_u3500purec
+#define yfastlog_u3500 Sleef_cinz_fastlogd1_u3500purec
+#define xfastlog2_u3500 Sleef_fastlog2d1_u3500purec
+#define yfastlog2_u3500 Sleef_cinz_fastlog2d1_u3500purec
+#define xfasttanh_u3500 Sleef_fasttanhd1_u3500purec
+#define yfasttanh_u3500 Sleef_cinz_fasttanhd1_u3500purec
+#define xfastatan2_u3500 Sleef_fastatan2d1_u3500purec
+#define yfastatan2_u3500 Sleef_cinz_fastatan2d1_u3500purec
+#define xfastrsqrt_u3500 Sleef_fastrsqrtd1_u3500purec
+#define yfastrsqrt_u3500 Sleef_cinz_fastrsqrtd1_u3500purec
+#define xfastrcp_u3500 Sleef_fastrcpd1_u3500purec
+#define yfastrcp_u3500 Sleef_cinz_fastrcpd1_u3500purec
+#define xsinr_u35 Sleef_sinrd1_u35purec
+#define ysinr_u35 Sleef_cinz_sinrd1_u35purec
+#define xcosr_u35 Sleef_cosrd1_u35purec
+#define ycosr_u35 Sleef_cinz_cosrd1_u35purec
+#define xsincosr_u35 Sleef_sincosrd1_u35purec
+#define ysincosr_u35 Sleef_cinz_sincosrd1_u35purec
+#define xtanr_u35 Sleef_tanrd1_u35purec
+#define ytanr_u35 Sleef_cinz_tanrd1_u35purec
+#define xasinh Sleef_asinhd1_u10purec
+#define yasinh Sleef_cinz_asinhd1_u10purec
+#define xacosh Sleef_acoshd1_u10purec
+#define yacosh Sleef_cinz_acoshd1_u10purec
+#define xatanh Sleef_atanhd1_u10purec
+#define yatanh Sleef_cinz_atanhd1_u10purec
+#define xexp2 Sleef_exp2d1_u10purec
+#define yexp2 Sleef_cinz_exp2d1_u10purec
+#define xexp2_u35 Sleef_exp2d1_u35purec
+#define yexp2_u35 Sleef_cinz_exp2d1_u35purec
+#define xexp10 Sleef_exp10d1_u10purec
+#define yexp10 Sleef_cinz_exp10d1_u10purec
+#define xexp10_u35 Sleef_exp10d1_u35purec
+#define yexp10_u35 Sleef_cinz_exp10d1_u35purec
+#define xexpm1 Sleef_expm1d1_u10purec
+#define yexpm1 Sleef_cinz_expm1d1_u10purec
+#define xlog10 Sleef_log10d1_u10purec
+#define ylog10 Sleef_cinz_log10d1_u10purec
+#define xlog2 Sleef_log2d1_u10purec
+#define ylog2 Sleef_cinz_log2d1_u10purec
+#define xlog2_u35 Sleef_log2d1_u35purec
+#define ylog2_u35 Sleef_cinz_log2d1_u35purec
+#define xlog1p Sleef_log1pd1_u10purec
+#define ylog1p Sleef_cinz_log1pd1_u10purec
+#define xsincospi_u05 Sleef_sincospid1_u05purec
+#define ysincospi_u05 Sleef_cinz_sincospid1_u05purec
+#define xsincospi_u35 Sleef_sincospid1_u35purec
+#define ysincospi_u35 Sleef_cinz_sincospid1_u35purec
+#define xsinpi_u05 Sleef_sinpid1_u05purec
+#define ysinpi_u05 Sleef_cinz_sinpid1_u05purec
+#define xcospi_u05 Sleef_cospid1_u05purec
+#define ycospi_u05 Sleef_cinz_cospid1_u05purec
+#define xldexp Sleef_ldexpd1_purec
+#define yldexp Sleef_cinz_ldexpd1_purec
+#define xilogb Sleef_ilogbd1_purec
+#define yilogb Sleef_cinz_ilogbd1_purec
+#define xfma Sleef_fmad1_purec
+#define yfma Sleef_cinz_fmad1_purec
+#define xsqrt Sleef_sqrtd1_purec
+#define ysqrt Sleef_cinz_sqrtd1_purec
+#define xsqrt_u05 Sleef_sqrtd1_u05purec
+#define ysqrt_u05 Sleef_cinz_sqrtd1_u05purec
+#define xsqrt_u35 Sleef_sqrtd1_u35purec
+#define ysqrt_u35 Sleef_cinz_sqrtd1_u35purec
+#define xhypot_u05 Sleef_hypotd1_u05purec
+#define yhypot_u05 Sleef_cinz_hypotd1_u05purec
+#define xhypot_u35 Sleef_hypotd1_u35purec
+#define yhypot_u35 Sleef_cinz_hypotd1_u35purec
+#define xfabs Sleef_fabsd1_purec
+#define yfabs Sleef_cinz_fabsd1_purec
+#define xcopysign Sleef_copysignd1_purec
+#define ycopysign Sleef_cinz_copysignd1_purec
+#define xfmax Sleef_fmaxd1_purec
+#define yfmax Sleef_cinz_fmaxd1_purec
+#define xfmin Sleef_fmind1_purec
+#define yfmin Sleef_cinz_fmind1_purec
+#define xfdim Sleef_fdimd1_purec
+#define yfdim Sleef_cinz_fdimd1_purec
+#define xtrunc Sleef_truncd1_purec
+#define ytrunc Sleef_cinz_truncd1_purec
+#define xfloor Sleef_floord1_purec
+#define yfloor Sleef_cinz_floord1_purec
+#define xceil Sleef_ceild1_purec
+#define yceil Sleef_cinz_ceild1_purec
+#define xround Sleef_roundd1_purec
+#define yround Sleef_cinz_roundd1_purec
+#define xrint Sleef_rintd1_purec
+#define yrint Sleef_cinz_rintd1_purec
+#define xnextafter Sleef_nextafterd1_purec
+#define ynextafter Sleef_cinz_nextafterd1_purec
+#define xfrfrexp Sleef_frfrexpd1_purec
+#define yfrfrexp Sleef_cinz_frfrexpd1_purec
+#define xexpfrexp Sleef_expfrexpd1_purec
+#define yexpfrexp Sleef_cinz_expfrexpd1_purec
+#define xfmod Sleef_fmodd1_purec
+#define yfmod Sleef_cinz_fmodd1_purec
+#define xremainder Sleef_remainderd1_purec
+#define yremainder Sleef_cinz_remainderd1_purec
+#define xmodf Sleef_modfd1_purec
+#define ymodf Sleef_cinz_modfd1_purec
+#define xlgamma_u1 Sleef_lgammad1_u10purec
+#define ylgamma_u1 Sleef_cinz_lgammad1_u10purec
+#define xtgamma_u1 Sleef_tgammad1_u10purec
+#define ytgamma_u1 Sleef_cinz_tgammad1_u10purec
+#define xerf_u1 Sleef_erfd1_u10purec
+#define yerf_u1 Sleef_cinz_erfd1_u10purec
+#define xerfc_u15 Sleef_erfcd1_u15purec
+#define yerfc_u15 Sleef_cinz_erfcd1_u15purec
+#define xsigmoid Sleef_sigmoidd1_u10purec
+#define ysigmoid Sleef_cinz_sigmoidd1_u10purec
+#define xsigmoid_u35 Sleef_sigmoidd1_u35purec
+#define ysigmoid_u35 Sleef_cinz_sigmoidd1_u35purec
+#define xsoftplus Sleef_softplusd1_u10purec
+#define ysoftplus Sleef_cinz_softplusd1_u10purec
+#define xsoftplus_u35 Sleef_softplusd1_u35purec
+#define ysoftplus_u35 Sleef_cinz_softplusd1_u35purec
+#define xsilu Sleef_silud1_u10purec
+#define ysilu Sleef_cinz_silud1_u10purec
+#define xsilu_u35 Sleef_silud1_u35purec
+#define ysilu_u35 Sleef_cinz_silud1_u35purec
+#define xgelutanh Sleef_gelutanhd1_u10purec
+#define ygelutanh Sleef_cinz_gelutanhd1_u10purec
+#define xgelutanh_u35 Sleef_gelutanhd1_u35purec
+#define ygelutanh_u35 Sleef_cinz_gelutanhd1_u35purec
+#define xgelu_u15 Sleef_gelud1_u15purec
+#define ygelu_u15 Sleef_cinz_gelud1_u15purec
+#define xgetInt Sleef_getIntd1_purec
+#define ygetInt Sleef_cinz_getIntd1_purec
+#define xgetPtr Sleef_getPtrd1_purec
+#define ygetPtr Sleef_cinz_getPtrd1_purec
+
+#define xsinf Sleef_sinf1_u35purec
+#define ysinf Sleef_cinz_sinf1_u35purec
+#define xcosf Sleef_cosf1_u35purec
+#define ycosf Sleef_cinz_cosf1_u35purec
+#define xsincosf Sleef_sincosf1_u35purec
+#define ysincosf Sleef_cinz_sincosf1_u35purec
+#define xtanf Sleef_tanf1_u35purec
+#define ytanf Sleef_cinz_tanf1_u35purec
+#define xasinf Sleef_asinf1_u35purec
+#define yasinf Sleef_cinz_asinf1_u35purec
+#define xacosf Sleef_acosf1_u35purec
+#define yacosf Sleef_cinz_acosf1_u35purec
+#define xatanf Sleef_atanf1_u35purec
+#define yatanf Sleef_cinz_atanf1_u35purec
+#define xatan2f Sleef_atan2f1_u35purec
+#define yatan2f Sleef_cinz_atan2f1_u35purec
+#define xlogf Sleef_logf1_u35purec
+#define ylogf Sleef_cinz_logf1_u35purec
+#define xcbrtf Sleef_cbrtf1_u35purec
+#define ycbrtf Sleef_cinz_cbrtf1_u35purec
+#define xsinf_u1 Sleef_sinf1_u10purec
+#define ysinf_u1 Sleef_cinz_sinf1_u10purec
+#define xcosf_u1 Sleef_cosf1_u10purec
+#define ycosf_u1 Sleef_cinz_cosf1_u10purec
+#define xsincosf_u1 Sleef_sincosf1_u10purec
+#define ysincosf_u1 Sleef_cinz_sincosf1_u10purec
+#define xtanf_u1 Sleef_tanf1_u10purec
+#define ytanf_u1 Sleef_cinz_tanf1_u10purec
+#define xasinf_u1 Sleef_asinf1_u10purec
+#define yasinf_u1 Sleef_cinz_asinf1_u10purec
+#define xacosf_u1 Sleef_acosf1_u10purec
+#define yacosf_u1 Sleef_cinz_acosf1_u10purec
+#define xatanf_u1 Sleef_atanf1_u10purec
+#define yatanf_u1 Sleef_cinz_atanf1_u10purec
+#define xatan2f_u1 Sleef_atan2f1_u10purec
+#define yatan2f_u1 Sleef_cinz_atan2f1_u10purec
+#define xlogf_u1 Sleef_logf1_u10purec
+#define ylogf_u1 Sleef_cinz_logf1_u10purec
+#define xcbrtf_u1 Sleef_cbrtf1_u10purec
+#define ycbrtf_u1 Sleef_cinz_cbrtf1_u10purec
+#define xexpf Sleef_expf1_u10purec
+#define yexpf Sleef_cinz_expf1_u10purec
+#define xpowf Sleef_powf1_u10purec
+#define ypowf Sleef_cinz_powf1_u10purec
+#define xsinhf Sleef_sinhf1_u10purec
+#define ysinhf Sleef_cinz_sinhf1_u10purec
+#define xcoshf Sleef_coshf1_u10purec
+#define ycoshf Sleef_cinz_coshf1_u10purec
+#define xtanhf Sleef_tanhf1_u10purec
+#define ytanhf Sleef_cinz_tanhf1_u10purec
+#define xsinhf_u35 Sleef_sinhf1_u35purec
+#define ysinhf_u35 Sleef_cinz_sinhf1_u35purec
+#define xcoshf_u35 Sleef_coshf1_u35purec
+#define ycoshf_u35 Sleef_cinz_coshf1_u35purec
+#define xtanhf_u35 Sleef_tanhf1_u35purec
+#define ytanhf_u35 Sleef_cinz_tanhf1_u35purec
+#define xfastsinf_u3500 Sleef_fastsinf1_u3500purec
+#define yfastsinf_u3500 Sleef_cinz_fastsinf1_u3500purec
+#define xfastcosf_u3500 Sleef_fastcosf1_u3500purec
+#define yfastcosf_u3500 Sleef_cinz_fastcosf1_u3500purec
+#define xfastpowf_u3500 Sleef_fastpowf1_u3500purec
+#define yfastpowf_u3500 Sleef_cinz_fastpowf1_u3500purec
+#define xfastexpf_u3500 Sleef_fastexpf1_u3500purec
+#define yfastexpf_u3500 Sleef_cinz_fastexpf1_u3500purec
+#define xfastexp2f_u3500 Sleef_fastexp2f1_u3500purec
+#define yfastexp2f_u3500 Sleef_cinz_fastexp2f1_u3500purec
+#define xfastlogf_u3500 Sleef_fastlogf1_u3500purec
+#define yfastlogf_u3500 Sleef_cinz_fastlogf1_u3500purec
+#define xfastlog2f_u3500 Sleef_fastlog2f1_u3500purec
+#define yfastlog2f_u3500 Sleef_cinz_fastlog2f1_u3500purec
+#define xfasttanhf_u3500 Sleef_fasttanhf1_u3500purec
+#define yfasttanhf_u3500 Sleef_cinz_fasttanhf1_u3500purec
+#define xfastatan2f_u3500 Sleef_fastatan2f1_u3500purec
+#define yfastatan2f_u3500 Sleef_cinz_fastatan2f1_u3500purec
+#define xfastrsqrtf_u3500 Sleef_fastrsqrtf1_u3500purec
+#define yfastrsqrtf_u3500 Sleef_cinz_fastrsqrtf1_u3500purec
+#define xfastrcpf_u3500 Sleef_fastrcpf1_u3500purec
+#define yfastrcpf_u3500 Sleef_cinz_fastrcpf1_u3500purec
+#define xsinrf_u35 Sleef_sinrf1_u35purec
+#define ysinrf_u35 Sleef_cinz_sinrf1_u35purec
+#define xcosrf_u35 Sleef_cosrf1_u35purec
+#define ycosrf_u35 Sleef_cinz_cosrf1_u35purec
+#define xsincosrf_u35 Sleef_sincosrf1_u35purec
+#define ysincosrf_u35 Sleef_cinz_sincosrf1_u35purec
+#define xtanrf_u35 Sleef_tanrf1_u35purec
+#define ytanrf_u35 Sleef_cinz_tanrf1_u35purec
+#define xasinhf Sleef_asinhf1_u10purec
+#define yasinhf Sleef_cinz_asinhf1_u10purec
+#define xacoshf Sleef_acoshf1_u10purec
+#define yacoshf Sleef_cinz_acoshf1_u10purec
+#define xatanhf Sleef_atanhf1_u10purec
+#define yatanhf Sleef_cinz_atanhf1_u10purec
+#define xexp2f Sleef_exp2f1_u10purec
+#define yexp2f Sleef_cinz_exp2f1_u10purec
+#define xexp2f_u35 Sleef_exp2f1_u35purec
+#define yexp2f_u35 Sleef_cinz_exp2f1_u35purec
+#define xexp10f Sleef_exp10f1_u10purec
+#define yexp10f Sleef_cinz_exp10f1_u10purec
+#define xexp10f_u35 Sleef_exp10f1_u35purec
+#define yexp10f_u35 Sleef_cinz_exp10f1_u35purec
+#define xexpm1f Sleef_expm1f1_u10purec
+#define yexpm1f Sleef_cinz_expm1f1_u10purec
+#define xlog10f Sleef_log10f1_u10purec
+#define ylog10f Sleef_cinz_log10f1_u10purec
+#define xlog2f Sleef_log2f1_u10purec
+#define ylog2f Sleef_cinz_log2f1_u10purec
+#define xlog2f_u35 Sleef_log2f1_u35purec
+#define ylog2f_u35 Sleef_cinz_log2f1_u35purec
+#define xlog1pf Sleef_log1pf1_u10purec
+#define ylog1pf Sleef_cinz_log1pf1_u10purec
+#define xsincospif_u05 Sleef_sincospif1_u05purec
+#define ysincospif_u05 Sleef_cinz_sincospif1_u05purec
+#define xsincospif_u35 Sleef_sincospif1_u35purec
+#define ysincospif_u35 Sleef_cinz_sincospif1_u35purec
+#define xsinpif_u05 Sleef_sinpif1_u05purec
+#define ysinpif_u05 Sleef_cinz_sinpif1_u05purec
+#define xcospif_u05 Sleef_cospif1_u05purec
+#define ycospif_u05 Sleef_cinz_cospif1_u05purec
+#define xldexpf Sleef_ldexpf1_purec
+#define yldexpf Sleef_cinz_ldexpf1_purec
+#define xilogbf Sleef_ilogbf1_purec
+#define yilogbf Sleef_cinz_ilogbf1_purec
+#define xfmaf Sleef_fmaf1_purec
+#define yfmaf Sleef_cinz_fmaf1_purec
+#define xsqrtf Sleef_sqrtf1_purec
+#define ysqrtf Sleef_cinz_sqrtf1_purec
+#define xsqrtf_u05 Sleef_sqrtf1_u05purec
+#define ysqrtf_u05 Sleef_cinz_sqrtf1_u05purec
+#define xsqrtf_u35 Sleef_sqrtf1_u35purec
+#define ysqrtf_u35 Sleef_cinz_sqrtf1_u35purec
+#define xhypotf_u05 Sleef_hypotf1_u05purec
+#define yhypotf_u05 Sleef_cinz_hypotf1_u05purec
+#define xhypotf_u35 Sleef_hypotf1_u35purec
+#define yhypotf_u35 Sleef_cinz_hypotf1_u35purec
+#define xfabsf Sleef_fabsf1_purec
+#define yfabsf Sleef_cinz_fabsf1_purec
+#define xcopysignf Sleef_copysignf1_purec
+#define ycopysignf Sleef_cinz_copysignf1_purec
+#define xfmaxf Sleef_fmaxf1_purec
+#define yfmaxf Sleef_cinz_fmaxf1_purec
+#define xfminf Sleef_fminf1_purec
+#define yfminf Sleef_cinz_fminf1_purec
+#define xfdimf Sleef_fdimf1_purec
+#define yfdimf Sleef_cinz_fdimf1_purec
+#define xtruncf Sleef_truncf1_purec
+#define ytruncf Sleef_cinz_truncf1_purec
+#define xfloorf Sleef_floorf1_purec
+#define yfloorf Sleef_cinz_floorf1_purec
+#define xceilf Sleef_ceilf1_purec
+#define yceilf Sleef_cinz_ceilf1_purec
+#define xroundf Sleef_roundf1_purec
+#define yroundf Sleef_cinz_roundf1_purec
+#define xrintf Sleef_rintf1_purec
+#define yrintf Sleef_cinz_rintf1_purec
+#define xnextafterf Sleef_nextafterf1_purec
+#define ynextafterf Sleef_cinz_nextafterf1_purec
+#define xfrfrexpf Sleef_frfrexpf1_purec
+#define yfrfrexpf Sleef_cinz_frfrexpf1_purec
+#define xexpfrexpf Sleef_expfrexpf1_purec
+#define yexpfrexpf Sleef_cinz_expfrexpf1_purec
+#define xfmodf Sleef_fmodf1_purec
+#define yfmodf Sleef_cinz_fmodf1_purec
+#define xremainderf Sleef_remainderf1_purec
+#define yremainderf Sleef_cinz_remainderf1_purec
+#define xmodff Sleef_modff1_purec
+#define ymodff Sleef_cinz_modff1_purec
+#define xlgammaf_u1 Sleef_lgammaf1_u10purec
+#define ylgammaf_u1 Sleef_cinz_lgammaf1_u10purec
+#define xtgammaf_u1 Sleef_tgammaf1_u10purec
+#define ytgammaf_u1 Sleef_cinz_tgammaf1_u10purec
+#define xerff_u1 Sleef_erff1_u10purec
+#define yerff_u1 Sleef_cinz_erff1_u10purec
+#define xerfcf_u15 Sleef_erfcf1_u15purec
+#define yerfcf_u15 Sleef_cinz_erfcf1_u15purec
+#define xsigmoidf Sleef_sigmoidf1_u10purec
+#define ysigmoidf Sleef_cinz_sigmoidf1_u10purec
+#define xsigmoidf_u35 Sleef_sigmoidf1_u35purec
+#define ysigmoidf_u35 Sleef_cinz_sigmoidf1_u35purec
+#define xsoftplusf Sleef_softplusf1_u10purec
+#define ysoftplusf Sleef_cinz_softplusf1_u10purec
+#define xsoftplusf_u35 Sleef_softplusf1_u35purec
+#define ysoftplusf_u35 Sleef_cinz_softplusf1_u35purec
+#define xsiluf Sleef_siluf1_u10purec
+#define ysiluf Sleef_cinz_siluf1_u10purec
+#define xsiluf_u35 Sleef_siluf1_u35purec
+#define ysiluf_u35 Sleef_cinz_siluf1_u35purec
+#define xgelutanhf Sleef_gelutanhf1_u10purec
+#define ygelutanhf Sleef_cinz_gelutanhf1_u10purec
+#define xgelutanhf_u35 Sleef_gelutanhf1_u35purec
+#define ygelutanhf_u35 Sleef_cinz_gelutanhf1_u35purec
+#define xgeluf_u15 Sleef_geluf1_u15purec
+#define ygeluf_u15 Sleef_cinz_geluf1_u15purec
+#define xgetIntf Sleef_getIntf1_purec
+#define ygetIntf Sleef_cinz_getIntf1_purec
+#define xgetPtrf Sleef_getPtrf1_purec
+#define ygetPtrf Sleef_cinz_getPtrf1_purec
+
+#define xsinf16_u1 Sleef_sinh1_u10purec
+#define xcosf16_u1 Sleef_cosh1_u10purec
+#define xtanf16_u1 Sleef_tanh1_u10purec
+#define xasinf16_u1 Sleef_asinh1_u10purec
+#define xacosf16_u1 Sleef_acosh1_u10purec
+#define xatanf16_u1 Sleef_atanh1_u10purec
+#define xatan2f16_u1 Sleef_atan2h1_u10purec
+#define xlogf16_u1 Sleef_logh1_u10purec
+#define xcbrtf16_u1 Sleef_cbrth1_u10purec
+#define xexpf16 Sleef_exph1_u10purec
+#define xpowf16 Sleef_powh1_u10purec
+#define xsinhf16 Sleef_sinhh1_u10purec
+#define xcoshf16 Sleef_coshh1_u10purec
+#define xtanhf16 Sleef_tanhh1_u10purec
+#define xasinhf16 Sleef_asinhh1_u10purec
+#define xacoshf16 Sleef_acoshh1_u10purec
+#define xatanhf16 Sleef_atanhh1_u10purec
+#define xexp2f16 Sleef_exp2h1_u10purec
+#define xexp10f16 Sleef_exp10h1_u10purec
+#define xexpm1f16 Sleef_expm1h1_u10purec
+#define xlog10f16 Sleef_log10h1_u10purec
+#define xlog2f16 Sleef_log2h1_u10purec
+#define xlog1pf16 Sleef_log1ph1_u10purec
+#define xsqrtf16 Sleef_sqrth1_purec
+#define xlgammaf16_u1 Sleef_lgammah1_u10purec
+#define xtgammaf16_u1 Sleef_tgammah1_u10purec
+#define xerff16_u1 Sleef_erfh1_u10purec
+#define xerfcf16_u15 Sleef_erfch1_u15purec
+#define xsigmoidf16 Sleef_sigmoidh1_u10purec
+#define xsoftplusf16 Sleef_softplush1_u10purec
+#define xsiluf16 Sleef_siluh1_u10purec
+#define xgelutanhf16 Sleef_gelutanhh1_u10purec
+#define xgeluf16_u15 Sleef_geluh1_u15purec
+
+#define xsinbf16_u1 Sleef_sinbf16x1_u10purec
+#define xcosbf16_u1 Sleef_cosbf16x1_u10purec
+#define xlogbf16_u1 Sleef_logbf16x1_u10purec
+#define xexpbf16 Sleef_expbf16x1_u10purec
+#define xpowbf16 Sleef_powbf16x1_u10purec
+#define xtanhbf16 Sleef_tanhbf16x1_u10purec
+#define xexp2bf16 Sleef_exp2bf16x1_u10purec
+#define xexp10bf16 Sleef_exp10bf16x1_u10purec
+#define xexpm1bf16 Sleef_expm1bf16x1_u10purec
+#define xlog10bf16 Sleef_log10bf16x1_u10purec
+#define xlog2bf16 Sleef_log2bf16x1_u10purec
+#define xlog1pbf16 Sleef_log1pbf16x1_u10purec
+#define xsqrtbf16 Sleef_sqrtbf16x1_purec
+#define xerfbf16_u1 Sleef_erfbf16x1_u10purec
+#define xerfcbf16_u15 Sleef_erfcbf16x1_u15purec
+#define xsigmoidbf16 Sleef_sigmoidbf16x1_u10purec
+#define xsoftplusbf16 Sleef_softplusbf16x1_u10purec
+#define xsilubf16 Sleef_silubf16x1_u10purec
+#define xgelutanhbf16 Sleef_gelutanhbf16x1_u10purec
+#define xgelubf16_u15 Sleef_gelubf16x1_u15purec
+
+#else //#ifndef DETERMINISTIC
+
+#define xsin Sleef_cinz_sind1_u35purec
+#define xcos Sleef_cinz_cosd1_u35purec
+#define xsincos Sleef_cinz_sincosd1_u35purec
+#define xtan Sleef_cinz_tand1_u35purec
+#define xasin Sleef_cinz_asind1_u35purec
+#define xacos Sleef_cinz_acosd1_u35purec
+#define xatan Sleef_cinz_atand1_u35purec
+#define xatan2 Sleef_cinz_atan2d1_u35purec
+#define xlog Sleef_cinz_logd1_u35purec
+#define xcbrt Sleef_cinz_cbrtd1_u35purec
+#define xsin_u1 Sleef_cinz_sind1_u10purec
+#define xcos_u1 Sleef_cinz_cosd1_u10purec
+#define xsincos_u1 Sleef_cinz_sincosd1_u10purec
+#define xtan_u1 Sleef_cinz_tand1_u10purec
+#define xasin_u1 Sleef_cinz_asind1_u10purec
+#define xacos_u1 Sleef_cinz_acosd1_u10purec
+#define xatan_u1 Sleef_cinz_atand1_u10purec
+#define xatan2_u1 Sleef_cinz_atan2d1_u10purec
+#define xlog_u1 Sleef_cinz_logd1_u10purec
+#define xcbrt_u1 Sleef_cinz_cbrtd1_u10purec
+#define xexp Sleef_cinz_expd1_u10purec
+#define xpow Sleef_cinz_powd1_u10purec
+#define xsinh Sleef_cinz_sinhd1_u10purec
+#define xcosh Sleef_cinz_coshd1_u10purec
+#define xtanh Sleef_cinz_tanhd1_u10purec
+#define xsinh_u35 Sleef_cinz_sinhd1_u35purec
+#define xcosh_u35 Sleef_cinz_coshd1_u35purec
+#define xtanh_u35 Sleef_cinz_tanhd1_u35purec
+#define xfastsin_u3500 Sleef_cinz_fastsind1_u3500purec
+#define xfastcos_u3500 Sleef_cinz_fastcosd1_u3500purec
+#define xfastpow_u3500 Sleef_cinz_fastpowd1_u3500purec
+#define xfastexp_u3500 Sleef_cinz_fastexpd1_u3500purec
+#define xfastexp2_u3500 Sleef_cinz_fastexp2d1_u3500purec
+#define xfastlog_u3500 Sleef_cinz_fastlogd1_u3500purec
+#define xfastlog2_u3500 Sleef_cinz_fastlog2d1_u3500purec
+#define xfasttanh_u3500 Sleef_cinz_fasttanhd1_u3500purec
+#define xfastatan2_u3500 Sleef_cinz_fastatan2d1_u3500purec
+#define xfastrsqrt_u3500 Sleef_cinz_fastrsqrtd1_u3500purec
+#define xfastrcp_u3500 Sleef_cinz_fastrcpd1_u3500purec
+#define xsinr_u35 Sleef_cinz_sinrd1_u35purec
+#define xcosr_u35 Sleef_cinz_cosrd1_u35purec
+#define xsincosr_u35 Sleef_cinz_sincosrd1_u35purec
+#define xtanr_u35 Sleef_cinz_tanrd1_u35purec
+#define xasinh Sleef_cinz_asinhd1_u10purec
+#define xacosh Sleef_cinz_acoshd1_u10purec
+#define xatanh Sleef_cinz_atanhd1_u10purec
+#define xexp2 Sleef_cinz_exp2d1_u10purec
+#define xexp2_u35 Sleef_cinz_exp2d1_u35purec
+#define xexp10 Sleef_cinz_exp10d1_u10purec
+#define xexp10_u35 Sleef_cinz_exp10d1_u35purec
+#define xexpm1 Sleef_cinz_expm1d1_u10purec
+#define xlog10 Sleef_cinz_log10d1_u10purec
+#define xlog2 Sleef_cinz_log2d1_u10purec
+#define xlog2_u35 Sleef_cinz_log2d1_u35purec
+#define xlog1p Sleef_cinz_log1pd1_u10purec
+#define xsincospi_u05 Sleef_cinz_sincospid1_u05purec
+#define xsincospi_u35 Sleef_cinz_sincospid1_u35purec
+#define xsinpi_u05 Sleef_cinz_sinpid1_u05purec
+#define xcospi_u05 Sleef_cinz_cospid1_u05purec
+#define xldexp Sleef_cinz_ldexpd1_purec
+#define xilogb Sleef_cinz_ilogbd1_purec
+#define xfma Sleef_cinz_fmad1_purec
+#define xsqrt Sleef_cinz_sqrtd1_purec
+#define xsqrt_u05 Sleef_cinz_sqrtd1_u05purec
+#define xsqrt_u35 Sleef_cinz_sqrtd1_u35purec
+#define xhypot_u05 Sleef_cinz_hypotd1_u05purec
+#define xhypot_u35 Sleef_cinz_hypotd1_u35purec
+#define xfabs Sleef_cinz_fabsd1_purec
+#define xcopysign Sleef_cinz_copysignd1_purec
+#define xfmax Sleef_cinz_fmaxd1_purec
+#define xfmin Sleef_cinz_fmind1_purec
+#define xfdim Sleef_cinz_fdimd1_purec
+#define xtrunc Sleef_cinz_truncd1_purec
+#define xfloor Sleef_cinz_floord1_purec
+#define xceil Sleef_cinz_ceild1_purec
+#define xround Sleef_cinz_roundd1_purec
+#define xrint Sleef_cinz_rintd1_purec
+#define xnextafter Sleef_cinz_nextafterd1_purec
+#define xfrfrexp Sleef_cinz_frfrexpd1_purec
+#define xexpfrexp Sleef_cinz_expfrexpd1_purec
+#define xfmod Sleef_cinz_fmodd1_purec
+#define xremainder Sleef_cinz_remainderd1_purec
+#define xmodf Sleef_cinz_modfd1_purec
+#define xlgamma_u1 Sleef_cinz_lgammad1_u10purec
+#define xtgamma_u1 Sleef_cinz_tgammad1_u10purec
+#define xerf_u1 Sleef_cinz_erfd1_u10purec
+#define xerfc_u15 Sleef_cinz_erfcd1_u15purec
+#define xsigmoid Sleef_cinz_sigmoidd1_u10purec
+#define xsigmoid_u35 Sleef_cinz_sigmoidd1_u35purec
+#define xsoftplus Sleef_cinz_softplusd1_u10purec
+#define xsoftplus_u35 Sleef_cinz_softplusd1_u35purec
+#define xsilu Sleef_cinz_silud1_u10purec
+#define xsilu_u35 Sleef_cinz_silud1_u35purec
+#define xgelutanh Sleef_cinz_gelutanhd1_u10purec
+#define xgelutanh_u35 Sleef_cinz_gelutanhd1_u35purec
+#define xgelu_u15 Sleef_cinz_gelud1_u15purec
+#define xgetInt Sleef_cinz_getIntd1_purec
+#define xgetPtr Sleef_cinz_getPtrd1_purec
+
+#define xsinf Sleef_cinz_sinf1_u35purec
+#define xcosf Sleef_cinz_cosf1_u35purec
+#define xsincosf Sleef_cinz_sincosf1_u35purec
+#define xtanf Sleef_cinz_tanf1_u35purec
+#define xasinf Sleef_cinz_asinf1_u35purec
+#define xacosf Sleef_cinz_acosf1_u35purec
+#define xatanf Sleef_cinz_atanf1_u35purec
+#define xatan2f Sleef_cinz_atan2f1_u35purec
+#define xlogf Sleef_cinz_logf1_u35purec
+#define xcbrtf Sleef_cinz_cbrtf1_u35purec
+#define xsinf_u1 Sleef_cinz_sinf1_u10purec
+#define xcosf_u1 Sleef_cinz_cosf1_u10purec
+#define xsincosf_u1 Sleef_cinz_sincosf1_u10purec
+#define xtanf_u1 Sleef_cinz_tanf1_u10purec
+#define xasinf_u1 Sleef_cinz_asinf1_u10purec
+#define xacosf_u1 Sleef_cinz_acosf1_u10purec
+#define xatanf_u1 Sleef_cinz_atanf1_u10purec
+#define xatan2f_u1 Sleef_cinz_atan2f1_u10purec
+#define xlogf_u1 Sleef_cinz_logf1_u10purec
+#define xcbrtf_u1 Sleef_cinz_cbrtf1_u10purec
+#define xexpf Sleef_cinz_expf1_u10purec
+#define xpowf Sleef_cinz_powf1_u10purec
+#define xsinhf Sleef_cinz_sinhf1_u10purec
+#define xcoshf Sleef_cinz_coshf1_u10purec
+#define xtanhf Sleef_cinz_tanhf1_u10purec
+#define xsinhf_u35 Sleef_cinz_sinhf1_u35purec
+#define xcoshf_u35 Sleef_cinz_coshf1_u35purec
+#define xtanhf_u35 Sleef_cinz_tanhf1_u35purec
+#define xfastsinf_u3500 Sleef_cinz_fastsinf1_u3500purec
+#define xfastcosf_u3500 Sleef_cinz_fastcosf1_u3500purec
+#define xfastpowf_u3500 Sleef_cinz_fastpowf1_u3500purec
+#define xfastexpf_u3500 Sleef_cinz_fastexpf1_u3500purec
+#define xfastexp2f_u3500 Sleef_cinz_fastexp2f1_u3500purec
+#define xfastlogf_u3500 Sleef_cinz_fastlogf1_u3500purec
+#define xfastlog2f_u3500 Sleef_cinz_fastlog2f1_u3500purec
+#define xfasttanhf_u3500 Sleef_cinz_fasttanhf1_u3500purec
+#define xfastatan2f_u3500 Sleef_cinz_fastatan2f1_u3500purec
+#define xfastrsqrtf_u3500 Sleef_cinz_fastrsqrtf1_u3500purec
+#define xfastrcpf_u3500 Sleef_cinz_fastrcpf1_u3500purec
+#define xsinrf_u35 Sleef_cinz_sinrf1_u35purec
+#define xcosrf_u35 Sleef_cinz_cosrf1_u35purec
+#define xsincosrf_u35 Sleef_cinz_sincosrf1_u35purec
+#define xtanrf_u35 Sleef_cinz_tanrf1_u35purec
+#define xasinhf Sleef_cinz_asinhf1_u10purec
+#define xacoshf Sleef_cinz_acoshf1_u10purec
+#define xatanhf Sleef_cinz_atanhf1_u10purec
+#define xexp2f Sleef_cinz_exp2f1_u10purec
+#define xexp2f_u35 Sleef_cinz_exp2f1_u35purec
+#define xexp10f Sleef_cinz_exp10f1_u10purec
+#define xexp10f_u35 Sleef_cinz_exp10f1_u35purec
+#define xexpm1f Sleef_cinz_expm1f1_u10purec
+#define xlog10f Sleef_cinz_log10f1_u10purec
+#define xlog2f Sleef_cinz_log2f1_u10purec
+#define xlog2f_u35 Sleef_cinz_log2f1_u35purec
+#define xlog1pf Sleef_cinz_log1pf1_u10purec
+#define xsincospif_u05 Sleef_cinz_sincospif1_u05purec
+#define xsincospif_u35 Sleef_cinz_sincospif1_u35purec
+#define xsinpif_u05 Sleef_cinz_sinpif1_u05purec
+#define xcospif_u05 Sleef_cinz_cospif1_u05purec
+#define xldexpf Sleef_cinz_ldexpf1_purec
+#define xilogbf Sleef_cinz_ilogbf1_purec
+#define xfmaf Sleef_cinz_fmaf1_purec
+#define xsqrtf Sleef_cinz_sqrtf1_purec
+#define xsqrtf_u05 Sleef_cinz_sqrtf1_u05purec
+#define xsqrtf_u35 Sleef_cinz_sqrtf1_u35purec
+#define xhypotf_u05 Sleef_cinz_hypotf1_u05purec
+#define xhypotf_u35 Sleef_cinz_hypotf1_u35purec
+#define xfabsf Sleef_cinz_fabsf1_purec
+#define xcopysignf Sleef_cinz_copysignf1_purec
+#define xfmaxf Sleef_cinz_fmaxf1_purec
+#define xfminf Sleef_cinz_fminf1_purec
+#define xfdimf Sleef_cinz_fdimf1_purec
+#define xtruncf Sleef_cinz_truncf1_purec
+#define xfloorf Sleef_cinz_floorf1_purec
+#define xceilf Sleef_cinz_ceilf1_purec
+#define xroundf Sleef_cinz_roundf1_purec
+#define xrintf Sleef_cinz_rintf1_purec
+#define xnextafterf Sleef_cinz_nextafterf1_purec
+#define xfrfrexpf Sleef_cinz_frfrexpf1_purec
+#define xexpfrexpf Sleef_cinz_expfrexpf1_purec
+#define xfmodf Sleef_cinz_fmodf1_purec
+#define xremainderf Sleef_cinz_remainderf1_purec
+#define xmodff Sleef_cinz_modff1_purec
+#define xlgammaf_u1 Sleef_cinz_lgammaf1_u10purec
+#define xtgammaf_u1 Sleef_cinz_tgammaf1_u10purec
+#define xerff_u1 Sleef_cinz_erff1_u10purec
+#define xerfcf_u15 Sleef_cinz_erfcf1_u15purec
+#define xsigmoidf Sleef_cinz_sigmoidf1_u10purec
+#define xsigmoidf_u35 Sleef_cinz_sigmoidf1_u35purec
+#define xsoftplusf Sleef_cinz_softplusf1_u10purec
+#define xsoftplusf_u35 Sleef_cinz_softplusf1_u35purec
+#define xsiluf Sleef_cinz_siluf1_u10purec
+#define xsiluf_u35 Sleef_cinz_siluf1_u35purec
+#define xgelutanhf Sleef_cinz_gelutanhf1_u10purec
+#define xgelutanhf_u35 Sleef_cinz_gelutanhf1_u35purec
+#define xgeluf_u15 Sleef_cinz_geluf1_u15purec
+#define xgetIntf Sleef_cinz_getIntf1_purec
+#define xgetPtrf Sleef_cinz_getPtrf1_purec
+
+#endif // #ifndef DETERMINISTIC
@@ -0,0 +1,652 @@
+#ifndef DETERMINISTIC
+
+#define xsin Sleef_sind1_u35purecfma
+#define ysin Sleef_finz_sind1_u35purecfma
+#define xcos Sleef_cosd1_u35purecfma
+#define ycos Sleef_finz_cosd1_u35purecfma
+#define xsincos Sleef_sincosd1_u35purecfma
+#define ysincos Sleef_finz_sincosd1_u35purecfma
+#define xtan Sleef_tand1_u35purecfma
+#define ytan Sleef_finz_tand1_u35purecfma
+#define xasin Sleef_asind1_u35purecfma
+#define yasin Sleef_finz_asind1_u35purecfma
+#define xacos Sleef_acosd1_u35purecfma
+#define yacos Sleef_finz_acosd1_u35purecfma
+#define xatan Sleef_atand1_u35purecfma
+#define yatan Sleef_finz_atand1_u35purecfma
+#define xatan2 Sleef_atan2d1_u35purecfma
+#define yatan2 Sleef_finz_atan2d1_u35purecfma
+#define xlog Sleef_logd1_u35purecfma
+#define ylog Sleef_finz_logd1_u35purecfma
+#define xcbrt Sleef_cbrtd1_u35purecfma
+#define ycbrt Sleef_finz_cbrtd1_u35purecfma
+#define xsin_u1 Sleef_sind1_u10purecfma
+#define ysin_u1 Sleef_finz_sind1_u10purecfma
+#define xcos_u1 Sleef_cosd1_u10purecfma
+#define ycos_u1 Sleef_finz_cosd1_u10purecfma
+#define xsincos_u1 Sleef_sincosd1_u10purecfma
+#define ysincos_u1 Sleef_finz_sincosd1_u10purecfma
+#define xtan_u1 Sleef_tand1_u10purecfma
+#define ytan_u1 Sleef_finz_tand1_u10purecfma
+#define xasin_u1 Sleef_asind1_u10purecfma
+#define yasin_u1 Sleef_finz_asind1_u10purecfma
+#define xacos_u1 Sleef_acosd1_u10purecfma
+#define yacos_u1 Sleef_finz_acosd1_u10purecfma
+#define xatan_u1 Sleef_atand1_u10purecfma
+#define yatan_u1 Sleef_finz_atand1_u10purecfma
+#define xatan2_u1 Sleef_atan2d1_u10purecfma
+#define yatan2_u1 Sleef_finz_atan2d1_u10purecfma
+#define xlog_u1 Sleef_logd1_u10purecfma
+#define ylog_u1 Sleef_finz_logd1_u10purecfma
+#define xcbrt_u1 Sleef_cbrtd1_u10purecfma
+#define ycbrt_u1 Sleef_finz_cbrtd1_u10purecfma
+#define xexp Sleef_expd1_u10purecfma
+#define yexp Sleef_finz_expd1_u10purecfma
+#define xpow Sleef_powd1_u10purecfma
+#define ypow Sleef_finz_powd1_u10purecfma
+#define xsinh Sleef_sinhd1_u10purecfma
+#define ysinh Sleef_finz_sinhd1_u10purecfma
+#define xcosh Sleef_coshd1_u10purecfma
+#define ycosh Sleef_finz_coshd1_u10purecfma
+#define xtanh Sleef_tanhd1_u10purecfma
+#define ytanh Sleef_finz_tanhd1_u10purecfma
+#define xsinh_u35 Sleef_sinhd1_u35purecfma
+#define ysinh_u35 Sleef_finz_sinhd1_u35purecfma
+#define xcosh_u35 Sleef_coshd1_u35purecfma
+#define ycosh_u35 Sleef_finz_coshd1_u35purecfma
+#define xtanh_u35 Sleef_tanhd1_u35purecfma
+#define ytanh_u35 Sleef_finz_tanhd1_u35purecfma
+#define xfastsin_u3500 Sleef_fastsind1_u3500purecfma
+#define yfastsin_u3500 Sleef_finz_fastsind1_u3500purecfma
+#define xfastcos_u3500 Sleef_fastcosd1_u3500purecfma
+#define yfastcos_u3500 Sleef_finz_fastcosd1_u3500purecfma
+#define xfastpow_u3500 Sleef_fastpowd1_u3500purecfma
+#define yfastpow_u3500 Sleef_finz_fastpowd1_u3500purecfma
+#define xfastexp_u3500 Sleef_fastexpd1_u3500purecfma
+#define yfastexp_u3500 Sleef_finz_fastexpd1_u3500purecfma
+#define xfastexp2_u3500 Sleef_fastexp2d1_u3500purecfma
+#define yfastexp2_u3500 Sleef_finz_fastexp2d1_u3500purecfma
+#define xfastlog_u3500 Sleef_fastlogd1_u3500purecfma
+#define yfastlog_u3500 Sleef_finz_fastlogd1_u3500purecfma
+#define xfastlog2_u3500 Sleef_fastlog2d1_u3500purecfma
+#define yfastlog2_u3500 Sleef_finz_fastlog2d1_u3500purecfma
+#define xfasttanh_u3500 Sleef_fasttanhd1_u3500purecfma
+#define yfasttanh_u3500 Sleef_finz_fasttanhd1_u3500purecfma
+#define xfastatan2_u3500 Sleef_fastatan2d1_u3500purecfma
+#define yfastatan2_u3500 Sleef_finz_fastatan2d1_u3500purecfma
+#define xfastrsqrt_u3500 Sleef_fastrsqrtd1_u3500purecfma
+#define yfastrsqrt_u3500 Sleef_finz_fastrsqrtd1_u3500purecfma
+#define xfastrcp_u3500 Sleef_fastrcpd1_u3500purecfma
+#define yfastrcp_u3500 Sleef_finz_fastrcpd1_u3500purecfma
+#define xsinr_u35 Sleef_sinrd1_u35purecfma
+#define ysinr_u35 Sleef_finz_sinrd1_u35purecfma
+#define xcosr_u35 Sleef_cosrd1_u35purecfma
+#define ycosr_u35 Sleef_finz_cosrd1_u35purecfma
+#define xsincosr_u35 Sleef_sincosrd1_u35purecfma
+#define ysincosr_u35 Sleef_finz_sincosrd1_u35purecfma
+#define xtanr_u35 Sleef_tanrd1_u35purecfma
+#define ytanr_u35 Sleef_finz_tanrd1_u35purecfma
+#define xasinh Sleef_asinhd1_u10purecfma
+#define yasinh Sleef_finz_asinhd1_u10purecfma
+#define xacosh Sleef_acoshd1_u10purecfma
+#define yacosh Sleef_finz_acoshd1_u10purecfma
+#define xatanh Sleef_atanhd1_u10purecfma
+#define yatanh Sleef_finz_atanhd1_u10purecfma
+#define xexp2 Sleef_exp2d1_u10purecfma
+#define yexp2 Sleef_finz_exp2d1_u10purecfma
+#define xexp2_u35 Sleef_exp2d1_u35purecfma
+#define yexp2_u35 Sleef_finz_exp2d1_u35purecfma
+#define xexp10 Sleef_exp10d1_u10purecfma
+#define yexp10 Sleef_finz_exp10d1_u10purecfma
+#define xexp10_u35 Sleef_exp10d1_u35purecfma
+#define yexp10_u35 Sleef_finz_exp10d1_u35purecfma
+#define xexpm1 Sleef_expm1d1_u10purecfma
+#define yexpm1 Sleef_finz_expm1d1_u10purecfma
+#define xlog10 Sleef_log10d1_u10purecfma
+#define ylog10 Sleef_finz_log10d1_u10purecfma
+#define xlog2 Sleef_log2d1_u10purecfma
+#define ylog2 Sleef_finz_log2d1_u10purecfma
+#define xlog2_u35 Sleef_log2d1_u35purecfma
+#define ylog2_u35 Sleef_finz_log2d1_u35purecfma
+#define xlog1p Sleef_log1pd1_u10purecfma
+#define ylog1p Sleef_finz_log1pd1_u10purecfma
+#define xsincospi_u05 Sleef_sincospid1_u05purecfma
+#define ysincospi_u05 Sleef_finz_sincospid1_u05purecfma
+#define xsincospi_u35 Sleef_sincospid1_u35purecfma
+#define ysincospi_u35 Sleef_finz_sincospid1_u35purecfma
+#define xsinpi_u05 Sleef_sinpid1_u05purecfma
+#define ysinpi_u05 Sleef_finz_sinpid1_u05purecfma
+#define xcospi_u05 Sleef_cospid1_u05purecfma
+#define ycospi_u05 Sleef_finz_cospid1_u05purecfma
+#define xldexp Sleef_ldexpd1_purecfma
+#define yldexp Sleef_finz_ldexpd1_purecfma
+#define xilogb Sleef_ilogbd1_purecfma
+#define yilogb Sleef_finz_ilogbd1_purecfma
+#define xfma Sleef_fmad1_purecfma
+#define yfma Sleef_finz_fmad1_purecfma
+#define xsqrt Sleef_sqrtd1_purecfma
+#define ysqrt Sleef_finz_sqrtd1_purecfma
+#define xsqrt_u05 Sleef_sqrtd1_u05purecfma
+#define ysqrt_u05 Sleef_finz_sqrtd1_u05purecfma
+#define xsqrt_u35 Sleef_sqrtd1_u35purecfma
+#define ysqrt_u35 Sleef_finz_sqrtd1_u35purecfma
+#define xhypot_u05 Sleef_hypotd1_u05purecfma
+#define yhypot_u05 Sleef_finz_hypotd1_u05purecfma
+#define xhypot_u35 Sleef_hypotd1_u35purecfma
+#define yhypot_u35 Sleef_finz_hypotd1_u35purecfma
+#define xfabs Sleef_fabsd1_purecfma
+#define yfabs Sleef_finz_fabsd1_purecfma
+#define xcopysign Sleef_copysignd1_purecfma
+#define ycopysign Sleef_finz_copysignd1_purecfma
+#define xfmax Sleef_fmaxd1_purecfma
+#define yfmax Sleef_finz_fmaxd1_purecfma
+#define xfmin Sleef_fmind1_purecfma
+#define yfmin Sleef_finz_fmind1_purecfma
+#define xfdim Sleef_fdimd1_purecfma
+#define yfdim Sleef_finz_fdimd1_purecfma
+#define xtrunc Sleef_truncd1_purecfma
+#define ytrunc Sleef_finz_truncd1_purecfma
+#define xfloor Sleef_floord1_purecfma
+#define yfloor Sleef_finz_floord1_purecfma
+#define xceil Sleef_ceild1_purecfma
+#define yceil Sleef_finz_ceild1_purecfma
+#define xround Sleef_roundd1_purecfma
+#define yround Sleef_finz_roundd1_purecfma
+#define xrint Sleef_rintd1_purecfma
+#define yrint Sleef_finz_rintd1_purecfma
+#define xnextafter Sleef_nextafterd1_purecfma
+#define ynextafter Sleef_finz_nextafterd1_purecfma
+#define xfrfrexp Sleef_frfrexpd1_purecfma
+#define yfrfrexp Sleef_finz_frfrexpd1_purecfma
+#define xexpfrexp Sleef_expfrexpd1_purecfma
+#define yexpfrexp Sleef_finz_expfrexpd1_purecfma
+#define xfmod Sleef_fmodd1_purecfma
+#define yfmod Sleef_finz_fmodd1_purecfma
+#define xremainder Sleef_remainderd1_purecfma
+#define yremainder Sleef_finz_remainderd1_purecfma
+#define xmodf Sleef_modfd1_purecfma
+#define ymodf Sleef_finz_modfd1_purecfma
+#define xlgamma_u1 Sleef_lgammad1_u10purecfma
+#define ylgamma_u1 Sleef_finz_lgammad1_u10purecfma
+#define xtgamma_u1 Sleef_tgammad1_u10purecfma
+#define ytgamma_u1 Sleef_finz_tgammad1_u10purecfma
+#define xerf_u1 Sleef_erfd1_u10purecfma
+#define yerf_u1 Sleef_finz_erfd1_u10purecfma
+#define xerfc_u15 Sleef_erfcd1_u15purecfma
+#define yerfc_u15 Sleef_finz_erfcd1_u15purecfma
+#define xsigmoid Sleef_sigmoidd1_u10purecfma
+#define ysigmoid Sleef_finz_sigmoidd1_u10purecfma
+#define xsigmoid_u35 Sleef_sigmoidd1_u35purecfma
+#define ysigmoid_u35 Sleef_finz_sigmoidd1_u35purecfma
+#define xsoftplus Sleef_softplusd1_u10purecfma
+#define ysoftplus Sleef_finz_softplusd1_u10purecfma
+#define xsoftplus_u35 Sleef_softplusd1_u35purecfma
+#define ysoftplus_u35 Sleef_finz_softplusd1_u35purecfma
+#define xsilu Sleef_silud1_u10purecfma
+#define ysilu Sleef_finz_silud1_u10purecfma
+#define xsilu_u35 Sleef_silud1_u35purecfma
+#define ysilu_u35 Sleef_finz_silud1_u35purecfma
+#define xgelutanh Sleef_gelutanhd1_u10purecfma
+#define ygelutanh Sleef_finz_gelutanhd1_u10purecfma
+#define xgelutanh_u35 Sleef_gelutanhd1_u35purecfma
+#define ygelutanh_u35 Sleef_finz_gelutanhd1_u35purecfma
+#define xgelu_u15 Sleef_gelud1_u15purecfma
+#define ygelu_u15 Sleef_finz_gelud1_u15purecfma
+#define xgetInt Sleef_getIntd1_purecfma
+#define ygetInt Sleef_finz_getIntd1_purecfma
+#define xgetPtr Sleef_getPtrd1_purecfma
+#define ygetPtr Sleef_finz_getPtrd1_purecfma
+
+#define xsinf Sleef_sinf1_u35purecfma
+#define ysinf Sleef_finz_sinf1_u35purecfma
+#define xcosf Sleef_cosf1_u35purecfma
+#define ycosf Sleef_finz_cosf1_u35purecfma
+#define xsincosf Sleef_sincosf1_u35purecfma
+#define ysincosf Sleef_finz_sincosf1_u35purecfma
+#define xtanf Sleef_tanf1_u35purecfma
+#define ytanf Sleef_finz_tanf1_u35purecfma
+#define xasinf Sleef_asinf1_u35purecfma
+#define yasinf Sleef_finz_asinf1_u35purecfma
+#define xacosf Sleef_acosf1_u35purecfma
+#define yacosf Sleef_finz_acosf1_u35purecfma
+#define xatanf Sleef_atanf1_u35purecfma
+#define yatanf Sleef_finz_atanf1_u35purecfma
+#define xatan2f Sleef_atan2f1_u35purecfma
+#define yatan2f Sleef_finz_atan2f1_u35purecfma
+#define xlogf Sleef_logf1_u35purecfma
+#define ylogf Sleef_finz_logf1_u35purecfma
+#define xcbrtf Sleef_cbrtf1_u35purecfma
+#define ycbrtf Sleef_finz_cbrtf1_u35purecfma
+#define xsinf_u1 Sleef_sinf1_u10purecfma
+#define ysinf_u1 Sleef_finz_sinf1_u10purecfma
+#define xcosf_u1 Sleef_cosf1_u10purecfma
+#define ycosf_u1 Sleef_finz_cosf1_u10purecfma
+#define xsincosf_u1 Sleef_sincosf1_u10purecfma
+#define ysincosf_u1 Sleef_finz_sincosf1_u10purecfma
+#define xtanf_u1 Sleef_tanf1_u10purecfma
+#define ytanf_u1 Sleef_finz_tanf1_u10purecfma
+#define xasinf_u1 Sleef_asinf1_u10purecfma
+#define yasinf_u1 Sleef_finz_asinf1_u10purecfma
+#define xacosf_u1 Sleef_acosf1_u10purecfma
+#define yacosf_u1 Sleef_finz_acosf1_u10purecfma
+#define xatanf_u1 Sleef_atanf1_u10purecfma
+#define yatanf_u1 Sleef_finz_atanf1_u10purecfma
+#define xatan2f_u1 Sleef_atan2f1_u10purecfma
+#define yatan2f_u1 Sleef_finz_atan2f1_u10purecfma
+#define xlogf_u1 Sleef_logf1_u10purecfma
+#define ylogf_u1 Sleef_finz_logf1_u10purecfma
+#define xcbrtf_u1 Sleef_cbrtf1_u10purecfma
+#define ycbrtf_u1 Sleef_finz_cbrtf1_u10purecfma
+#define xexpf Sleef_expf1_u10purecfma
+#define yexpf Sleef_finz_expf1_u10purecfma
+#define xpowf Sleef_powf1_u10purecfma
+#define ypowf Sleef_finz_powf1_u10purecfma
+#define xsinhf Sleef_sinhf1_u10purecfma
+#define ysinhf Sleef_finz_sinhf1_u10purecfma
+#define xcoshf Sleef_coshf1_u10purecfma
+#define ycoshf Sleef_finz_coshf1_u10purecfma
+#define xtanhf Sleef_tanhf1_u10purecfma
+#define ytanhf Sleef_finz_tanhf1_u10purecfma
+#define xsinhf_u35 Sleef_sinhf1_u35purecfma
+#define ysinhf_u35 Sleef_finz_sinhf1_u35purecfma
+#define xcoshf_u35 Sleef_coshf1_u35purecfma
+#define ycoshf_u35 Sleef_finz_coshf1_u35purecfma
+#define xtanhf_u35 Sleef_tanhf1_u35purecfma
+#define ytanhf_u35 Sleef_finz_tanhf1_u35purecfma
+#define xfastsinf_u3500 Sleef_fastsinf1_u3500purecfma
+#define yfastsinf_u3500 Sleef_finz_fastsinf1_u3500purecfma
+#define xfastcosf_u3500 Sleef_fastcosf1_u3500purecfma
+#define yfastcosf_u3500 Sleef_finz_fastcosf1_u3500purecfma
+#define xfastpowf_u3500 Sleef_fastpowf1_u3500purecfma
+#define yfastpowf_u3500 Sleef_finz_fastpowf1_u3500purecfma
+#define xfastexpf_u3500 Sleef_fastexpf1_u3500purecfma
+#define yfastexpf_u3500 Sleef_finz_fastexpf1_u3500purecfma
+#define xfastexp2f_u3500 Sleef_fastexp2f1_u3500purecfma
+#define yfastexp2f_u3500 Sleef_finz_fastexp2f1_u3500purecfma
+#define xfastlogf_u3500 Sleef_fastlogf1_u3500purecfma
+#define yfastlogf_u3500 Sleef_finz_fastlogf1_u3500purecfma
+#define xfastlog2f_u3500 Sleef_fastlog2f1_u3500purecfma
+#define yfastlog2f_u3500 Sleef_finz_fastlog2f1_u3500purecfma
+#define xfasttanhf_u3500 Sleef_fasttanhf1_u3500purecfma
+#define yfasttanhf_u3500 Sleef_finz_fasttanhf1_u3500purecfma
+#define xfastatan2f_u3500 Sleef_fastatan2f1_u3500purecfma
+#define yfastatan2f_u3500 Sleef_finz_fastatan2f1_u3500purecfma
+#define xfastrsqrtf_u3500 Sleef_fastrsqrtf1_u3500purecfma
+#define yfastrsqrtf_u3500 Sleef_finz_fastrsqrtf1_u3500purecfma
+#define xfastrcpf_u3500 Sleef_fastrcpf1_u3500purecfma
+#define yfastrcpf_u3500 Sleef_finz_fastrcpf1_u3500purecfma
+#define xsinrf_u35 Sleef_sinrf1_u35purecfma
+#define ysinrf_u35 Sleef_finz_sinrf1_u35purecfma
+#define xcosrf_u35 Sleef_cosrf1_u35purecfma
+#define ycosrf_u35 Sleef_finz_cosrf1_u35purecfma
+#define xsincosrf_u35 Sleef_sincosrf1_u35purecfma
+#define ysincosrf_u35 Sleef_finz_sincosrf1_u35purecfma
+#define xtanrf_u35 Sleef_tanrf1_u35purecfma
+#define ytanrf_u35 Sleef_finz_tanrf1_u35purecfma
+#define xasinhf Sleef_asinhf1_u10purecfma
+#define yasinhf Sleef_finz_asinhf1_u10purecfma
+#define xacoshf Sleef_acoshf1_u10purecfma
+#define yacoshf Sleef_finz_acoshf1_u10purecfma
+#define xatanhf Sleef_atanhf1_u10purecfma
+#define yatanhf Sleef_finz_atanhf1_u10purecfma
+#define xexp2f Sleef_exp2f1_u10purecfma
+#define yexp2f Sleef_finz_exp2f1_u10purecfma
+#define xexp2f_u35 Sleef_exp2f1_u35purecfma
+#define yexp2f_u35 Sleef_finz_exp2f1_u35purecfma
+#define xexp10f Sleef_exp10f1_u10purecfma
+#define yexp10f Sleef_finz_exp10f1_u10purecfma
+#define xexp10f_u35 Sleef_exp10f1_u35purecfma
+#define yexp10f_u35 Sleef_finz_exp10f1_u35purecfma
+#define xexpm1f Sleef_expm1f1_u10purecfma
+#define yexpm1f Sleef_finz_expm1f1_u10purecfma
+#define xlog10f Sleef_log10f1_u10purecfma
+#define ylog10f Sleef_finz_log10f1_u10purecfma
+#define xlog2f Sleef_log2f1_u10purecfma
+#define ylog2f Sleef_finz_log2f1_u10purecfma
+#define xlog2f_u35 Sleef_log2f1_u35purecfma
+#define ylog2f_u35 Sleef_finz_log2f1_u35purecfma
+#define xlog1pf Sleef_log1pf1_u10purecfma
+#define ylog1pf Sleef_finz_log1pf1_u10purecfma
+#define xsincospif_u05 Sleef_sincospif1_u05purecfma
+#define ysincospif_u05 Sleef_finz_sincospif1_u05purecfma
+#define xsincospif_u35 Sleef_sincospif1_u35purecfma
+#define ysincospif_u35 Sleef_finz_sincospif1_u35purecfma
+#define xsinpif_u05 Sleef_sinpif1_u05purecfma
+#define ysinpif_u05 Sleef_finz_sinpif1_u05purecfma
+#define xcospif_u05 Sleef_cospif1_u05purecfma
+#define ycospif_u05 Sleef_finz_cospif1_u05purecfma
+#define xldexpf Sleef_ldexpf1_purecfma
+#define yldexpf Sleef_finz_ldexpf1_purecfma
+#define xilogbf Sleef_ilogbf1_purecfma
+#define yilogbf Sleef_finz_ilogbf1_purecfma
+#define xfmaf Sleef_fmaf1_purecfma
+#define yfmaf Sleef_finz_fmaf1_purecfma
+#define xsqrtf Sleef_sqrtf1_purecfma
+#define ysqrtf Sleef_finz_sqrtf1_purecfma
+#define xsqrtf_u05 Sleef_sqrtf1_u05purecfma
+#define ysqrtf_u05 Sleef_finz_sqrtf1_u05purecfma
+#define xsqrtf_u35 Sleef_sqrtf1_u35purecfma
+#define ysqrtf_u35 Sleef_finz_sqrtf1_u35purecfma
+#define xhypotf_u05 Sleef_hypotf1_u05purecfma
+#define yhypotf_u05 Sleef_finz_hypotf1_u05purecfma
+#define xhypotf_u35 Sleef_hypotf1_u35purecfma
+#define yhypotf_u35 Sleef_finz_hypotf1_u35purecfma
+#define xfabsf Sleef_fabsf1_purecfma
+#define yfabsf Sleef_finz_fabsf1_purecfma
+#define xcopysignf Sleef_copysignf1_purecfma
+#define ycopysignf Sleef_finz_copysignf1_purecfma
+#define xfmaxf Sleef_fmaxf1_purecfma
+#define yfmaxf Sleef_finz_fmaxf1_purecfma
+#define xfminf Sleef_fminf1_purecfma
+#define yfminf Sleef_finz_fminf1_purecfma
+#define xfdimf Sleef_fdimf1_purecfma
+#define yfdimf Sleef_finz_fdimf1_purecfma
+#define xtruncf Sleef_truncf1_purecfma
+#define ytruncf Sleef_finz_truncf1_purecfma
+#define xfloorf Sleef_floorf1_purecfma
+#define yfloorf Sleef_finz_floorf1_purecfma
+#define xceilf Sleef_ceilf1_purecfma
+#define yceilf Sleef_finz_ceilf1_purecfma
+#define xroundf Sleef_roundf1_purecfma
+#define yroundf Sleef_finz_roundf1_purecfma
+#define xrintf Sleef_rintf1_purecfma
+#define yrintf Sleef_finz_rintf1_purecfma
+#define xnextafterf Sleef_nextafterf1_purecfma
+#define ynextafterf Sleef_finz_nextafterf1_purecfma
+#define xfrfrexpf Sleef_frfrexpf1_purecfma
+#define yfrfrexpf Sleef_finz_frfrexpf1_purecfma
+#define xexpfrexpf Sleef_expfrexpf1_purecfma
+#define yexpfrexpf Sleef_finz_expfrexpf1_purecfma
+#define xfmodf Sleef_fmodf1_purecfma
+#define yfmodf Sleef_finz_fmodf1_purecfma
+#define xremainderf Sleef_remainderf1_purecfma
+#define yremainderf Sleef_finz_remainderf1_purecfma
+#define xmodff Sleef_modff1_purecfma
+#define ymodff Sleef_finz_modff1_purecfma
+#define xlgammaf_u1 Sleef_lgammaf1_u10purecfma
+#define ylgammaf_u1 Sleef_finz_lgammaf1_u10purecfma
+#define xtgammaf_u1 Sleef_tgammaf1_u10purecfma
+#define ytgammaf_u1 Sleef_finz_tgammaf1_u10purecfma
+#define xerff_u1 Sleef_erff1_u10purecfma
+#define yerff_u1 Sleef_finz_erff1_u10purecfma
+#define xerfcf_u15 Sleef_erfcf1_u15purecfma
+#define yerfcf_u15 Sleef_finz_erfcf1_u15purecfma
+#define xsigmoidf Sleef_sigmoidf1_u10purecfma
+#define ysigmoidf Sleef_finz_sigmoidf1_u10purecfma
+#define xsigmoidf_u35 Sleef_sigmoidf1_u35purecfma
+#define ysigmoidf_u35 Sleef_finz_sigmoidf1_u35purecfma
+#define xsoftplusf Sleef_softplusf1_u10purecfma
+#define ysoftplusf Sleef_finz_softplusf1_u10purecfma
+#define xsoftplusf_u35 Sleef_softplusf1_u35purecfma
+#define ysoftplusf_u35 Sleef_finz_softplusf1_u35purecfma
+#define xsiluf Sleef_siluf1_u10purecfma
+#define ysiluf Sleef_finz_siluf1_u10purecfma
+#define xsiluf_u35 Sleef_siluf1_u35purecfma
+#define ysiluf_u35 Sleef_finz_siluf1_u35purecfma
+#define xgelutanhf Sleef_gelutanhf1_u10purecfma
+#define ygelutanhf Sleef_finz_gelutanhf1_u10purecfma
+#define xgelutanhf_u35 Sleef_gelutanhf1_u35purecfma
+#define ygelutanhf_u35 Sleef_finz_gelutanhf1_u35purecfma
+#define xgeluf_u15 Sleef_geluf1_u15purecfma
+#define ygeluf_u15 Sleef_finz_geluf1_u15purecfma
+#define xgetIntf Sleef_getIntf1_purecfma
+#define ygetIntf Sleef_finz_getIntf1_purecfma
+#define xgetPtrf Sleef_getPtrf1_purecfma
+#define ygetPtrf Sleef_finz_getPtrf1_purecfma
+
+#define xsinf16_u1 Sleef_sinh1_u10purecfma
+#define xcosf16_u1 Sleef_cosh1_u10purecfma
+#define xtanf16_u1 Sleef_tanh1_u10purecfma
+#define xasinf16_u1 Sleef_asinh1_u10purecfma
+#define xacosf16_u1 Sleef_acosh1_u10purecfma
+#define xatanf16_u1 Sleef_atanh1_u10purecfma
+#define xatan2f16_u1 Sleef_atan2h1_u10purecfma
+#define xlogf16_u1 Sleef_logh1_u10purecfma
+#define xcbrtf16_u1 Sleef_cbrth1_u10purecfma
+#define xexpf16 Sleef_exph1_u10purecfma
+#define xpowf16 Sleef_powh1_u10purecfma
+#define xsinhf16 Sleef_sinhh1_u10purecfma
+#define xcoshf16 Sleef_coshh1_u10purecfma
+#define xtanhf16 Sleef_tanhh1_u10purecfma
+#define xasinhf16 Sleef_asinhh1_u10purecfma
+#define xacoshf16 Sleef_acoshh1_u10purecfma
+#define xatanhf16 Sleef_atanhh1_u10purecfma
+#define xexp2f16 Sleef_exp2h1_u10purecfma
+#define xexp10f16 Sleef_exp10h1_u10purecfma
+#define xexpm1f16 Sleef_expm1h1_u10purecfma
+#define xlog10f16 Sleef_log10h1_u10purecfma
+#define xlog2f16 Sleef_log2h1_u10purecfma
+#define xlog1pf16 Sleef_log1ph1_u10purecfma
+#define xsqrtf16 Sleef_sqrth1_purecfma
+#define xlgammaf16_u1 Sleef_lgammah1_u10purecfma
+#define xtgammaf16_u1 Sleef_tgammah1_u10purecfma
+#define xerff16_u1 Sleef_erfh1_u10purecfma
+#define xerfcf16_u15 Sleef_erfch1_u15purecfma
+#define xsigmoidf16 Sleef_sigmoidh1_u10purecfma
+#define xsoftplusf16 Sleef_softplush1_u10purecfma
+#define xsiluf16 Sleef_siluh1_u10purecfma
+#define xgelutanhf16 Sleef_gelutanhh1_u10purecfma
+#define xgeluf16_u15 Sleef_geluh1_u15purecfma
+
+#define xsinbf16_u1 Sleef_sinbf16x1_u10purecfma
+#define xcosbf16_u1 Sleef_cosbf16x1_u10purecfma
+#define xlogbf16_u1 Sleef_logbf16x1_u10purecfma
+#define xexpbf16 Sleef_expbf16x1_u10purecfma
+#define xpowbf16 Sleef_powbf16x1_u10purecfma
+#define xtanhbf16 Sleef_tanhbf16x1_u10purecfma
+#define xexp2bf16 Sleef_exp2bf16x1_u10purecfma
+#define xexp10bf16 Sleef_exp10bf16x1_u10purecfma
+#define xexpm1bf16 Sleef_expm1bf16x1_u10purecfma
+#define xlog10bf16 Sleef_log10bf16x1_u10purecfma
+#define xlog2bf16 Sleef_log2bf16x1_u10purecfma
+#define xlog1pbf16 Sleef_log1pbf16x1_u10purecfma
+#define xsqrtbf16 Sleef_sqrtbf16x1_purecfma
+#define xerfbf16_u1 Sleef_erfbf16x1_u10purecfma
+#define xerfcbf16_u15 Sleef_erfcbf16x1_u15purecfma
+#define xsigmoidbf16 Sleef_sigmoidbf16x1_u10purecfma
+#define xsoftplusbf16 Sleef_softplusbf16x1_u10purecfma
+#define xsilubf16 Sleef_silubf16x1_u10purecfma
+#define xgelutanhbf16 Sleef_gelutanhbf16x1_u10purecfma
+#define xgelubf16_u15 Sleef_gelubf16x1_u15purecfma
+
+#else //#ifndef DETERMINISTIC
+
+#define xsin Sleef_finz_sind1_u35purecfma
+#define xcos Sleef_finz_cosd1_u35purecfma
+#define xsincos Sleef_finz_sincosd1_u35purecfma
+#define xtan Sleef_finz_tand1_u35purecfma
+#define xasin Sleef_finz_asind1_u35purecfma
+#define xacos Sleef_finz_acosd1_u35purecfma
+#define xatan Sleef_finz_atand1_u35purecfma
+#define xatan2 Sleef_finz_atan2d1_u35purecfma
+#define xlog Sleef_finz_logd1_u35purecfma
+#define xcbrt Sleef_finz_cbrtd1_u35purecfma
+#define xsin_u1 Sleef_finz_sind1_u10purecfma
+#define xcos_u1 Sleef_finz_cosd1_u10purecfma
+#define xsincos_u1 Sleef_finz_sincosd1_u10purecfma
+#define xtan_u1 Sleef_finz_tand1_u10purecfma
+#define xasin_u1 Sleef_finz_asind1_u10purecfma
+#define xacos_u1 Sleef_finz_acosd1_u10purecfma
+#define xatan_u1 Sleef_finz_atand1_u10purecfma
+#define xatan2_u1 Sleef_finz_atan2d1_u10purecfma
+#define xlog_u1 Sleef_finz_logd1_u10purecfma
+#define xcbrt_u1 Sleef_finz_cbrtd1_u10purecfma
+#define xexp Sleef_finz_expd1_u10purecfma
+#define xpow Sleef_finz_powd1_u10purecfma
+#define xsinh Sleef_finz_sinhd1_u10purecfma
+#define xcosh Sleef_finz_coshd1_u10purecfma
+#define xtanh Sleef_finz_tanhd1_u10purecfma
+#define xsinh_u35 Sleef_finz_sinhd1_u35purecfma
+#define xcosh_u35 Sleef_finz_coshd1_u35purecfma
+#define xtanh_u35 Sleef_finz_tanhd1_u35purecfma
+#define xfastsin_u3500 Sleef_finz_fastsind1_u3500purecfma
+#define xfastcos_u3500 Sleef_finz_fastcosd1_u3500purecfma
+#define xfastpow_u3500 Sleef_finz_fastpowd1_u3500purecfma
+#define xfastexp_u3500 Sleef_finz_fastexpd1_u3500purecfma
+#define xfastexp2_u3500 Sleef_finz_fastexp2d1_u3500purecfma
+#define xfastlog_u3500 Sleef_finz_fastlogd1_u3500purecfma
+#define xfastlog2_u3500 Sleef_finz_fastlog2d1_u3500purecfma
+#define xfasttanh_u3500 Sleef_finz_fasttanhd1_u3500purecfma
+#define xfastatan2_u3500 Sleef_finz_fastatan2d1_u3500purecfma
+#define xfastrsqrt_u3500 Sleef_finz_fastrsqrtd1_u3500purecfma
+#define xfastrcp_u3500 Sleef_finz_fastrcpd1_u3500purecfma
+#define xsinr_u35 Sleef_finz_sinrd1_u35purecfma
+#define xcosr_u35 Sleef_finz_cosrd1_u35purecfma
+#define xsincosr_u35 Sleef_finz_sincosrd1_u35purecfma
+#define xtanr_u35 Sleef_finz_tanrd1_u35purecfma
+#define xasinh Sleef_finz_asinhd1_u10purecfma
+#define xacosh Sleef_finz_acoshd1_u10purecfma
+#define xatanh Sleef_finz_atanhd1_u10purecfma
+#define xexp2 Sleef_finz_exp2d1_u10purecfma
+#define xexp2_u35 Sleef_finz_exp2d1_u35purecfma
+#define xexp10 Sleef_finz_exp10d1_u10purecfma
+#define xexp10_u35 Sleef_finz_exp10d1_u35purecfma
+#define xexpm1 Sleef_finz_expm1d1_u10purecfma
+#define xlog10 Sleef_finz_log10d1_u10purecfma
+#define xlog2 Sleef_finz_log2d1_u10purecfma
+#define xlog2_u35 Sleef_finz_log2d1_u35purecfma
+#define xlog1p Sleef_finz_log1pd1_u10purecfma
+#define xsincospi_u05 Sleef_finz_sincospid1_u05purecfma
+#define xsincospi_u35 Sleef_finz_sincospid1_u35purecfma
+#define xsinpi_u05 Sleef_finz_sinpid1_u05purecfma
+#define xcospi_u05 Sleef_finz_cospid1_u05purecfma
+#define xldexp Sleef_finz_ldexpd1_purecfma
+#define xilogb Sleef_finz_ilogbd1_purecfma
+#define xfma Sleef_finz_fmad1_purecfma
+#define xsqrt Sleef_finz_sqrtd1_purecfma
+#define xsqrt_u05 Sleef_finz_sqrtd1_u05purecfma
+#define xsqrt_u35 Sleef_finz_sqrtd1_u35purecfma
+#define xhypot_u05 Sleef_finz_hypotd1_u05purecfma
+#define xhypot_u35 Sleef_finz_hypotd1_u35purecfma
+#define xfabs Sleef_finz_fabsd1_purecfma
+#define xcopysign Sleef_finz_copysignd1_purecfma
+#define xfmax Sleef_finz_fmaxd1_purecfma
+#define xfmin Sleef_finz_fmind1_purecfma
+#define xfdim Sleef_finz_fdimd1_purecfma
+#define xtrunc Sleef_finz_truncd1_purecfma
+#define xfloor Sleef_finz_floord1_purecfma
+#define xceil Sleef_finz_ceild1_purecfma
+#define xround Sleef_finz_roundd1_purecfma
+#define xrint Sleef_finz_rintd1_purecfma
+#define xnextafter Sleef_finz_nextafterd1_purecfma
+#define xfrfrexp Sleef_finz_frfrexpd1_purecfma
+#define xexpfrexp Sleef_finz_expfrexpd1_purecfma
+#define xfmod Sleef_finz_fmodd1_purecfma
+#define xremainder Sleef_finz_remainderd1_purecfma
+#define xmodf Sleef_finz_modfd1_purecfma
+#define xlgamma_u1 Sleef_finz_lgammad1_u10purecfma
+#define xtgamma_u1 Sleef_finz_tgammad1_u10purecfma
+#define xerf_u1 Sleef_finz_erfd1_u10purecfma
+#define xerfc_u15 Sleef_finz_erfcd1_u15purecfma
+#define xsigmoid Sleef_finz_sigmoidd1_u10purecfma
+#define xsigmoid_u35 Sleef_finz_sigmoidd1_u35purecfma
+#define xsoftplus Sleef_finz_softplusd1_u10purecfma
+#define xsoftplus_u35 Sleef_finz_softplusd1_u35purecfma
+#define xsilu Sleef_finz_silud1_u10purecfma
+#define xsilu_u35 Sleef_finz_silud1_u35purecfma
+#define xgelutanh Sleef_finz_gelutanhd1_u10purecfma
+#define xgelutanh_u35 Sleef_finz_gelutanhd1_u35purecfma
+#define xgelu_u15 Sleef_finz_gelud1_u15purecfma
+#define xgetInt Sleef_finz_getIntd1_purecfma
+#define xgetPtr Sleef_finz_getPtrd1_purecfma
+
+#define xsinf Sleef_finz_sinf1_u35purecfma
+#define xcosf Sleef_finz_cosf1_u35purecfma
+#define xsincosf Sleef_finz_sincosf1_u35purecfma
+#define xtanf Sleef_finz_tanf1_u35purecfma
+#define xasinf Sleef_finz_asinf1_u35purecfma
+#define xacosf Sleef_finz_acosf1_u35purecfma
+#define xatanf Sleef_finz_atanf1_u35purecfma
+#define xatan2f Sleef_finz_atan2f1_u35purecfma
+#define xlogf Sleef_finz_logf1_u35purecfma
+#define xcbrtf Sleef_finz_cbrtf1_u35purecfma
+#define xsinf_u1 Sleef_finz_sinf1_u10purecfma
+#define xcosf_u1 Sleef_finz_cosf1_u10purecfma
+#define xsincosf_u1 Sleef_finz_sincosf1_u10purecfma
+#define xtanf_u1 Sleef_finz_tanf1_u10purecfma
+#define xasinf_u1 Sleef_finz_asinf1_u10purecfma
+#define xacosf_u1 Sleef_finz_acosf1_u10purecfma
+#define xatanf_u1 Sleef_finz_atanf1_u10purecfma
+#define xatan2f_u1 Sleef_finz_atan2f1_u10purecfma
+#define xlogf_u1 Sleef_finz_logf1_u10purecfma
+#define xcbrtf_u1 Sleef_finz_cbrtf1_u10purecfma
+#define xexpf Sleef_finz_expf1_u10purecfma
+#define xpowf Sleef_finz_powf1_u10purecfma
+#define xsinhf Sleef_finz_sinhf1_u10purecfma
+#define xcoshf Sleef_finz_coshf1_u10purecfma
+#define xtanhf Sleef_finz_tanhf1_u10purecfma
+#define xsinhf_u35 Sleef_finz_sinhf1_u35purecfma
+#define xcoshf_u35 Sleef_finz_coshf1_u35purecfma
+#define xtanhf_u35 Sleef_finz_tanhf1_u35purecfma
+#define xfastsinf_u3500 Sleef_finz_fastsinf1_u3500purecfma
+#define xfastcosf_u3500 Sleef_finz_fastcosf1_u3500purecfma
+#define xfastpowf_u3500 Sleef_finz_fastpowf1_u3500purecfma
+#define xfastexpf_u3500 Sleef_finz_fastexpf1_u3500purecfma
+#define xfastexp2f_u3500 Sleef_finz_fastexp2f1_u3500purecfma
+#define xfastlogf_u3500 Sleef_finz_fastlogf1_u3500purecfma
+#define xfastlog2f_u3500 Sleef_finz_fastlog2f1_u3500purecfma
+#define xfasttanhf_u3500 Sleef_finz_fasttanhf1_u3500purecfma
+#define xfastatan2f_u3500 Sleef_finz_fastatan2f1_u3500purecfma
+#define xfastrsqrtf_u3500 Sleef_finz_fastrsqrtf1_u3500purecfma
+#define xfastrcpf_u3500 Sleef_finz_fastrcpf1_u3500purecfma
+#define xsinrf_u35 Sleef_finz_sinrf1_u35purecfma
+#define xcosrf_u35 Sleef_finz_cosrf1_u35purecfma
+#define xsincosrf_u35 Sleef_finz_sincosrf1_u35purecfma
+#define xtanrf_u35 Sleef_finz_tanrf1_u35purecfma
+#define xasinhf Sleef_finz_asinhf1_u10purecfma
+#define xacoshf Sleef_finz_acoshf1_u10purecfma
+#define xatanhf Sleef_finz_atanhf1_u10purecfma
+#define xexp2f Sleef_finz_exp2f1_u10purecfma
+#define xexp2f_u35 Sleef_finz_exp2f1_u35purecfma
+#define xexp10f Sleef_finz_exp10f1_u10purecfma
+#define xexp10f_u35 Sleef_finz_exp10f1_u35purecfma
+#define xexpm1f Sleef_finz_expm1f1_u10purecfma
+#define xlog10f Sleef_finz_log10f1_u10purecfma
+#define xlog2f Sleef_finz_log2f1_u10purecfma
+#define xlog2f_u35 Sleef_finz_log2f1_u35purecfma
+#define xlog1pf Sleef_finz_log1pf1_u10purecfma
+#define xsincospif_u05 Sleef_finz_sincospif1_u05purecfma
+#define xsincospif_u35 Sleef_finz_sincospif1_u35purecfma
+#define xsinpif_u05 Sleef_finz_sinpif1_u05purecfma
+#define xcospif_u05 Sleef_finz_cospif1_u05purecfma
+#define xldexpf Sleef_finz_ldexpf1_purecfma
+#define xilogbf Sleef_finz_ilogbf1_purecfma
+#define xfmaf Sleef_finz_fmaf1_purecfma
+#define xsqrtf Sleef_finz_sqrtf1_purecfma
+#define xsqrtf_u05 Sleef_finz_sqrtf1_u05purecfma
+#define xsqrtf_u35 Sleef_finz_sqrtf1_u35purecfma
+#define xhypotf_u05 Sleef_finz_hypotf1_u05purecfma
+#define xhypotf_u35 Sleef_finz_hypotf1_u35purecfma
+#define xfabsf Sleef_finz_fabsf1_purecfma
+#define xcopysignf Sleef_finz_copysignf1_purecfma
+#define xfmaxf Sleef_finz_fmaxf1_purecfma
+#define xfminf Sleef_finz_fminf1_purecfma
+#define xfdimf Sleef_finz_fdimf1_purecfma
+#define xtruncf Sleef_finz_truncf1_purecfma
+#define xfloorf Sleef_finz_floorf1_purecfma
+#define xceilf Sleef_finz_ceilf1_purecfma
+#define xroundf Sleef_finz_roundf1_purecfma
+#define xrintf Sleef_finz_rintf1_purecfma
+#define xnextafterf Sleef_finz_nextafterf1_purecfma
+#define xfrfrexpf Sleef_finz_frfrexpf1_purecfma
+#define xexpfrexpf Sleef_finz_expfrexpf1_purecfma
+#define xfmodf Sleef_finz_fmodf1_purecfma
+#define xremainderf Sleef_finz_remainderf1_purecfma
+#define xmodff Sleef_finz_modff1_purecfma
+#define xlgammaf_u1 Sleef_finz_lgammaf1_u10purecfma
+#define xtgammaf_u1 Sleef_finz_tgammaf1_u10purecfma
+#define xerff_u1 Sleef_finz_erff1_u10purecfma
+#define xerfcf_u15 Sleef_finz_erfcf1_u15purecfma
+#define xsigmoidf Sleef_finz_sigmoidf1_u10purecfma
+#define xsigmoidf_u35 Sleef_finz_sigmoidf1_u35purecfma
+#define xsoftplusf Sleef_finz_softplusf1_u10purecfma
+#define xsoftplusf_u35 Sleef_finz_softplusf1_u35purecfma
+#define xsiluf Sleef_finz_siluf1_u10purecfma
+#define xsiluf_u35 Sleef_finz_siluf1_u35purecfma
+#define xgelutanhf Sleef_finz_gelutanhf1_u10purecfma
+#define xgelutanhf_u35 Sleef_finz_gelutanhf1_u35purecfma
+#define xgeluf_u15 Sleef_finz_geluf1_u15purecfma
+#define xgetIntf Sleef_finz_getIntf1_purecfma
+#define xgetPtrf Sleef_finz_getPtrf1_purecfma
+
+#endif // #ifndef DETERMINISTIC
@@ -0,0 +1,652 @@
+#ifndef DETERMINISTIC
+
+#define xsin Sleef_sind2_u35sse2
+#define ysin Sleef_cinz_sind2_u35sse2
+#define xcos Sleef_cosd2_u35sse2
+#define ycos Sleef_cinz_cosd2_u35sse2
+#define xsincos Sleef_sincosd2_u35sse2
+#define ysincos Sleef_cinz_sincosd2_u35sse2
+#define xtan Sleef_tand2_u35sse2
+#define ytan Sleef_cinz_tand2_u35sse2
+#define xasin Sleef_asind2_u35sse2
+#define yasin Sleef_cinz_asind2_u35sse2
+#define xacos Sleef_acosd2_u35sse2
+#define yacos Sleef_cinz_acosd2_u35sse2
+#define xatan Sleef_atand2_u35sse2
+#define yatan Sleef_cinz_atand2_u35sse2
+#define xatan2 Sleef_atan2d2_u35sse2
+#define yatan2 Sleef_cinz_atan2d2_u35sse2
+#define xlog Sleef_logd2_u35sse2
+#define ylog Sleef_cinz_logd2_u35sse2
+#define xcbrt Sleef_cbrtd2_u35sse2
+#define ycbrt Sleef_cinz_cbrtd2_u35sse2
+#define xsin_u1 Sleef_sind2_u10sse2
+#define ysin_u1 Sleef_cinz_sind2_u10sse2
+#define xcos_u1 Sleef_cosd2_u10sse2
+#define ycos_u1 Sleef_cinz_cosd2_u10sse2
+#define xsincos_u1 Sleef_sincosd2_u10sse2
+#define ysincos_u1 Sleef_cinz_sincosd2_u10sse2
+#define xtan_u1 Sleef_tand2_u10sse2
+#define ytan_u1 Sleef_cinz_tand2_u10sse2
+#define xasin_u1 Sleef_asind2_u10sse2
+#define yasin_u1 Sleef_cinz_asind2_u10sse2
+#define xacos_u1 Sleef_acosd2_u10sse2
+#define yacos_u1 Sleef_cinz_acosd2_u10sse2
+#define xatan_u1 Sleef_atand2_u10sse2
+#define yatan_u1 Sleef_cinz_atand2_u10sse2
+#define xatan2_u1 Sleef_atan2d2_u10sse2
+#define yatan2_u1 Sleef_cinz_atan2d2_u10sse2
+#define xlog_u1 Sleef_logd2_u10sse2
+#define ylog_u1 Sleef_cinz_logd2_u10sse2
+#define xcbrt_u1 Sleef_cbrtd2_u10sse2
+#define ycbrt_u1 Sleef_cinz_cbrtd2_u10sse2
+#define xexp Sleef_expd2_u10sse2
+#define yexp Sleef_cinz_expd2_u10sse2
+#define xpow Sleef_powd2_u10sse2
+#define ypow Sleef_cinz_powd2_u10sse2
+#define xsinh Sleef_sinhd2_u10sse2
+#define ysinh Sleef_cinz_sinhd2_u10sse2
+#define xcosh Sleef_coshd2_u10sse2
+#define ycosh Sleef_cinz_coshd2_u10sse2
+#define xtanh Sleef_tanhd2_u10sse2
+#define ytanh Sleef_cinz_tanhd2_u10sse2
+#define xsinh_u35 Sleef_sinhd2_u35sse2
+#define ysinh_u35 Sleef_cinz_sinhd2_u35sse2
+#define xcosh_u35 Sleef_coshd2_u35sse2
+#define ycosh_u35 Sleef_cinz_coshd2_u35sse2
+#define xtanh_u35 Sleef_tanhd2_u35sse2
+#define ytanh_u35 Sleef_cinz_tanhd2_u35sse2
+#define xfastsin_u3500 Sleef_fastsind2_u3500sse2
+#define yfastsin_u3500 Sleef_cinz_fastsind2_u3500sse2
+#define xfastcos_u3500 Sleef_fastcosd2_u3500sse2
+#define yfastcos_u3500 Sleef_cinz_fastcosd2_u3500sse2
+#define xfastpow_u3500 Sleef_fastpowd2_u3500sse2
+#define yfastpow_u3500 Sleef_cinz_fastpowd2_u3500sse2
+#define xfastexp_u3500 Sleef_fastexpd2_u3500sse2
+#define yfastexp_u3500 Sleef_cinz_fastexpd2_u3500sse2
+#define xfastexp2_u3500 Sleef_fastexp2d2_u3500sse2
+#define yfastexp2_u3500 Sleef_cinz_fastexp2d2_u3500sse2
+#define xfastlog_u3500 Sleef_fastlogd2_u3500sse2
+#define yfastlog_u3500 Sleef_cinz_fastlogd2_u3500sse2
+#define xfastlog2_u3500 Sleef_fastlog2d2_u3500sse2
+#define yfastlog2_u3500 Sleef_cinz_fastlog2d2_u3500sse2
+#define xfasttanh_u3500 Sleef_fasttanhd2_u3500sse2
+#define yfasttanh_u3500 Sleef_cinz_fasttanhd2_u3500sse2
+#define xfastatan2_u3500 Sleef_fastatan2d2_u3500sse2
+#define yfastatan2_u3500 Sleef_cinz_fastatan2d2_u3500sse2
+#define xfastrsqrt_u3500 Sleef_fastrsqrtd2_u3500sse2
+#define yfastrsqrt_u3500 Sleef_cinz_fastrsqrtd2_u3500sse2
+#define xfastrcp_u3500 Sleef_fastrcpd2_u3500sse2
+#define yfastrcp_u3500 Sleef_cinz_fastrcpd2_u3500sse2
+#define xsinr_u35 Sleef_sinrd2_u35sse2
+#define ysinr_u35 Sleef_cinz_sinrd2_u35sse2
+#define xcosr_u35 Sleef_cosrd2_u35sse2
+#define ycosr_u35 Sleef_cinz_cosrd2_u35sse2
+#define xsincosr_u35 Sleef_sincosrd2_u35sse2
+#define ysincosr_u35 Sleef_cinz_sincosrd2_u35sse2
+#define xtanr_u35 Sleef_tanrd2_u35sse2
+#define ytanr_u35 Sleef_cinz_tanrd2_u35sse2
+#define xasinh Sleef_asinhd2_u10sse2
+#define yasinh Sleef_cinz_asinhd2_u10sse2
+#define xacosh Sleef_acoshd2_u10sse2
+#define yacosh Sleef_cinz_acoshd2_u10sse2
+#define xatanh Sleef_atanhd2_u10sse2
+#define yatanh Sleef_cinz_atanhd2_u10sse2
+#define xexp2 Sleef_exp2d2_u10sse2
+#define yexp2 Sleef_cinz_exp2d2_u10sse2
+#define xexp2_u35 Sleef_exp2d2_u35sse2
+#define yexp2_u35 Sleef_cinz_exp2d2_u35sse2
+#define xexp10 Sleef_exp10d2_u10sse2
+#define yexp10 Sleef_cinz_exp10d2_u10sse2
+#define xexp10_u35 Sleef_exp10d2_u35sse2
+#define yexp10_u35 Sleef_cinz_exp10d2_u35sse2
+#define xexpm1 Sleef_expm1d2_u10sse2
+#define yexpm1 Sleef_cinz_expm1d2_u10sse2
+#define xlog10 Sleef_log10d2_u10sse2
+#define ylog10 Sleef_cinz_log10d2_u10sse2
+#define xlog2 Sleef_log2d2_u10sse2
+#define ylog2 Sleef_cinz_log2d2_u10sse2
+#define xlog2_u35 Sleef_log2d2_u35sse2
+#define ylog2_u35 Sleef_cinz_log2d2_u35sse2
+#define xlog1p Sleef_log1pd2_u10sse2
+#define ylog1p Sleef_cinz_log1pd2_u10sse2
+#define xsincospi_u05 Sleef_sincospid2_u05sse2
+#define ysincospi_u05 Sleef_cinz_sincospid2_u05sse2
+#define xsincospi_u35 Sleef_sincospid2_u35sse2
+#define ysincospi_u35 Sleef_cinz_sincospid2_u35sse2
+#define xsinpi_u05 Sleef_sinpid2_u05sse2
+#define ysinpi_u05 Sleef_cinz_sinpid2_u05sse2
+#define xcospi_u05 Sleef_cospid2_u05sse2
+#define ycospi_u05 Sleef_cinz_cospid2_u05sse2
+#define xldexp Sleef_ldexpd2_sse2
+#define yldexp Sleef_cinz_ldexpd2_sse2
+#define xilogb Sleef_ilogbd2_sse2
+#define yilogb Sleef_cinz_ilogbd2_sse2
+#define xfma Sleef_fmad2_sse2
+#define yfma Sleef_cinz_fmad2_sse2
+#define xsqrt Sleef_sqrtd2_sse2
+#define ysqrt Sleef_cinz_sqrtd2_sse2
+#define xsqrt_u05 Sleef_sqrtd2_u05sse2
+#define ysqrt_u05 Sleef_cinz_sqrtd2_u05sse2
+#define xsqrt_u35 Sleef_sqrtd2_u35sse2
+#define ysqrt_u35 Sleef_cinz_sqrtd2_u35sse2
+#define xhypot_u05 Sleef_hypotd2_u05sse2
+#define yhypot_u05 Sleef_cinz_hypotd2_u05sse2
+#define xhypot_u35 Sleef_hypotd2_u35sse2
+#define yhypot_u35 Sleef_cinz_hypotd2_u35sse2
+#define xfabs Sleef_fabsd2_sse2
+#define yfabs Sleef_cinz_fabsd2_sse2
+#define xcopysign Sleef_copysignd2_sse2
+#define ycopysign Sleef_cinz_copysignd2_sse2
+#define xfmax Sleef_fmaxd2_sse2
+#define yfmax Sleef_cinz_fmaxd2_sse2
+#define xfmin Sleef_fmind2_sse2
+#define yfmin Sleef_cinz_fmind2_sse2
+#define xfdim Sleef_fdimd2_sse2
+#define yfdim Sleef_cinz_fdimd2_sse2
+#define xtrunc Sleef_truncd2_sse2
+#define ytrunc Sleef_cinz_truncd2_sse2
+#define xfloor Sleef_floord2_sse2
+#define yfloor Sleef_cinz_floord2_sse2
+#define xceil Sleef_ceild2_sse2
+#define yceil Sleef_cinz_ceild2_sse2
+#define xround Sleef_roundd2_sse2
+#define yround Sleef_cinz_roundd2_sse2
+#define xrint Sleef_rintd2_sse2
+#define yrint Sleef_cinz_rintd2_sse2
+#define xnextafter Sleef_nextafterd2_sse2
+#define ynextafter Sleef_cinz_nextafterd2_sse2
+#define xfrfrexp Sleef_frfrexpd2_sse2
+#define yfrfrexp Sleef_cinz_frfrexpd2_sse2
+#define xexpfrexp Sleef_expfrexpd2_sse2
+#define yexpfrexp Sleef_cinz_expfrexpd2_sse2
+#define xfmod Sleef_fmodd2_sse2
+#define yfmod Sleef_cinz_fmodd2_sse2
+#define xremainder Sleef_remainderd2_sse2
+#define yremainder Sleef_cinz_remainderd2_sse2
+#define xmodf Sleef_modfd2_sse2
+#define ymodf Sleef_cinz_modfd2_sse2
+#define xlgamma_u1 Sleef_lgammad2_u10sse2
+#define ylgamma_u1 Sleef_cinz_lgammad2_u10sse2
+#define xtgamma_u1 Sleef_tgammad2_u10sse2
+#define ytgamma_u1 Sleef_cinz_tgammad2_u10sse2
+#define xerf_u1 Sleef_erfd2_u10sse2
+#define yerf_u1 Sleef_cinz_erfd2_u10sse2
+#define xerfc_u15 Sleef_erfcd2_u15sse2
+#define yerfc_u15 Sleef_cinz_erfcd2_u15sse2
+#define xsigmoid Sleef_sigmoidd2_u10sse2
+#define ysigmoid Sleef_cinz_sigmoidd2_u10sse2
+#define xsigmoid_u35 Sleef_sigmoidd2_u35sse2
+#define ysigmoid_u35 Sleef_cinz_sigmoidd2_u35sse2
+#define xsoftplus Sleef_softplusd2_u10sse2
+#define ysoftplus Sleef_cinz_softplusd2_u10sse2
+#define xsoftplus_u35 Sleef_softplusd2_u35sse2
+#define ysoftplus_u35 Sleef_cinz_softplusd2_u35sse2
+#define xsilu Sleef_silud2_u10sse2
+#define ysilu Sleef_cinz_silud2_u10sse2
+#define xsilu_u35 Sleef_silud2_u35sse2
+#define ysilu_u35 Sleef_cinz_silud2_u35sse2
+#define xgelutanh Sleef_gelutanhd2_u10sse2
+#define ygelutanh Sleef_cinz_gelutanhd2_u10sse2
+#define xgelutanh_u35 Sleef_gelutanhd2_u35sse2
+#define ygelutanh_u35 Sleef_cinz_gelutanhd2_u35sse2
+#define xgelu_u15 Sleef_gelud2_u15sse2
+#define ygelu_u15 Sleef_cinz_gelud2_u15sse2
+#define xgetInt Sleef_getIntd2_sse2
+#define ygetInt Sleef_cinz_getIntd2_sse2
+#define xgetPtr Sleef_getPtrd2_sse2
+#define ygetPtr Sleef_cinz_getPtrd2_sse2
+
+#define xsinf Sleef_sinf4_u35sse2
+#define ysinf Sleef_cinz_sinf4_u35sse2
+#define xcosf Sleef_cosf4_u35sse2
+#define ycosf Sleef_cinz_cosf4_u35sse2
+#define xsincosf Sleef_sincosf4_u35sse2
+#define ysincosf Sleef_cinz_sincosf4_u35sse2
+#define xtanf Sleef_tanf4_u35sse2
+#define ytanf Sleef_cinz_tanf4_u35sse2
+#define xasinf Sleef_asinf4_u35sse2
+#define yasinf Sleef_cinz_asinf4_u35sse2
+#define xacosf Sleef_acosf4_u35sse2
+#define yacosf Sleef_cinz_acosf4_u35sse2
+#define xatanf Sleef_atanf4_u35sse2
+#define yatanf Sleef_cinz_atanf4_u35sse2
+#define xatan2f Sleef_atan2f4_u35sse2
+#define yatan2f Sleef_cinz_atan2f4_u35sse2
+#define xlogf Sleef_logf4_u35sse2
+#define ylogf Sleef_cinz_logf4_u35sse2
+#define xcbrtf Sleef_cbrtf4_u35sse2
+#define ycbrtf Sleef_cinz_cbrtf4_u35sse2
+#define xsinf_u1 Sleef_sinf4_u10sse2
+#define ysinf_u1 Sleef_cinz_sinf4_u10sse2
+#define xcosf_u1 Sleef_cosf4_u10sse2
+#define ycosf_u1 Sleef_cinz_cosf4_u10sse2
+#define xsincosf_u1 Sleef_sincosf4_u10sse2
+#define ysincosf_u1 Sleef_cinz_sincosf4_u10sse2
+#define xtanf_u1 Sleef_tanf4_u10sse2
+#define ytanf_u1 Sleef_cinz_tanf4_u10sse2
+#define xasinf_u1 Sleef_asinf4_u10sse2
+#define yasinf_u1 Sleef_cinz_asinf4_u10sse2
+#define xacosf_u1 Sleef_acosf4_u10sse2
+#define yacosf_u1 Sleef_cinz_acosf4_u10sse2
+#define xatanf_u1 Sleef_atanf4_u10sse2
+#define yatanf_u1 Sleef_cinz_atanf4_u10sse2
+#define xatan2f_u1 Sleef_atan2f4_u10sse2
+#define yatan2f_u1 Sleef_cinz_atan2f4_u10sse2
+#define xlogf_u1 Sleef_logf4_u10sse2
+#define ylogf_u1 Sleef_cinz_logf4_u10sse2
+#define xcbrtf_u1 Sleef_cbrtf4_u10sse2
+#define ycbrtf_u1 Sleef_cinz_cbrtf4_u10sse2
+#define xexpf Sleef_expf4_u10sse2
+#define yexpf Sleef_cinz_expf4_u10sse2
+#define xpowf Sleef_powf4_u10sse2
+#define ypowf Sleef_cinz_powf4_u10sse2
+#define xsinhf Sleef_sinhf4_u10sse2
+#define ysinhf Sleef_cinz_sinhf4_u10sse2
+#define xcoshf Sleef_coshf4_u10sse2
+#define ycoshf Sleef_cinz_coshf4_u10sse2
+#define xtanhf Sleef_tanhf4_u10sse2
+#define ytanhf Sleef_cinz_tanhf4_u10sse2
+#define xsinhf_u35 Sleef_sinhf4_u35sse2
+#define ysinhf_u35 Sleef_cinz_sinhf4_u35sse2
+#define xcoshf_u35 Sleef_coshf4_u35sse2
+#define ycoshf_u35 Sleef_cinz_coshf4_u35sse2
+#define xtanhf_u35 Sleef_tanhf4_u35sse2
+#define ytanhf_u35 Sleef_cinz_tanhf4_u35sse2
+#define xfastsinf_u3500 Sleef_fastsinf4_u3500sse2
+#define yfastsinf_u3500 Sleef_cinz_fastsinf4_u3500sse2
+#define xfastcosf_u3500 Sleef_fastcosf4_u3500sse2
+#define yfastcosf_u3500 Sleef_cinz_fastcosf4_u3500sse2
+#define xfastpowf_u3500 Sleef_fastpowf4_u3500sse2
+#define yfastpowf_u3500 Sleef_cinz_fastpowf4_u3500sse2
+#define xfastexpf_u3500 Sleef_fastexpf4_u3500sse2
+#define yfastexpf_u3500 Sleef_cinz_fastexpf4_u3500sse2
+#define xfastexp2f_u3500 Sleef_fastexp2f4_u3500sse2
+#define yfastexp2f_u3500 Sleef_cinz_fastexp2f4_u3500sse2
+#define xfastlogf_u3500 Sleef_fastlogf4_u3500sse2
+#define yfastlogf_u3500 Sleef_cinz_fastlogf4_u3500sse2
+#define xfastlog2f_u3500 Sleef_fastlog2f4_u3500sse2
+#define yfastlog2f_u3500 Sleef_cinz_fastlog2f4_u3500sse2
+#define xfasttanhf_u3500 Sleef_fasttanhf4_u3500sse2
+#define yfasttanhf_u3500 Sleef_cinz_fasttanhf4_u3500sse2
+#define xfastatan2f_u3500 Sleef_fastatan2f4_u3500sse2
+#define yfastatan2f_u3500 Sleef_cinz_fastatan2f4_u3500sse2
+#define xfastrsqrtf_u3500 Sleef_fastrsqrtf4_u3500sse2
+#define yfastrsqrtf_u3500 Sleef_cinz_fastrsqrtf4_u3500sse2
+#define xfastrcpf_u3500 Sleef_fastrcpf4_u3500sse2
+#define yfastrcpf_u3500 Sleef_cinz_fastrcpf4_u3500sse2
+#define xsinrf_u35 Sleef_sinrf4_u35sse2
+#define ysinrf_u35 Sleef_cinz_sinrf4_u35sse2
+#define xcosrf_u35 Sleef_cosrf4_u35sse2
+#define ycosrf_u35 Sleef_cinz_cosrf4_u35sse2
+#define xsincosrf_u35 Sleef_sincosrf4_u35sse2
+#define ysincosrf_u35 Sleef_cinz_sincosrf4_u35sse2
+#define xtanrf_u35 Sleef_tanrf4_u35sse2
+#define ytanrf_u35 Sleef_cinz_tanrf4_u35sse2
+#define xasinhf Sleef_asinhf4_u10sse2
+#define yasinhf Sleef_cinz_asinhf4_u10sse2
+#define xacoshf Sleef_acoshf4_u10sse2
+#define yacoshf Sleef_cinz_acoshf4_u10sse2
+#define xatanhf Sleef_atanhf4_u10sse2
+#define yatanhf Sleef_cinz_atanhf4_u10sse2
+#define xexp2f Sleef_exp2f4_u10sse2
+#define yexp2f Sleef_cinz_exp2f4_u10sse2
+#define xexp2f_u35 Sleef_exp2f4_u35sse2
+#define yexp2f_u35 Sleef_cinz_exp2f4_u35sse2
+#define xexp10f Sleef_exp10f4_u10sse2
+#define yexp10f Sleef_cinz_exp10f4_u10sse2
+#define xexp10f_u35 Sleef_exp10f4_u35sse2
+#define yexp10f_u35 Sleef_cinz_exp10f4_u35sse2
+#define xexpm1f Sleef_expm1f4_u10sse2
+#define yexpm1f Sleef_cinz_expm1f4_u10sse2
+#define xlog10f Sleef_log10f4_u10sse2
+#define ylog10f Sleef_cinz_log10f4_u10sse2
+#define xlog2f Sleef_log2f4_u10sse2
+#define ylog2f Sleef_cinz_log2f4_u10sse2
+#define xlog2f_u35 Sleef_log2f4_u35sse2
+#define ylog2f_u35 Sleef_cinz_log2f4_u35sse2
+#define xlog1pf Sleef_log1pf4_u10sse2
+#define ylog1pf Sleef_cinz_log1pf4_u10sse2
+#define xsincospif_u05 Sleef_sincospif4_u05sse2
+#define ysincospif_u05 Sleef_cinz_sincospif4_u05sse2
+#define xsincospif_u35 Sleef_sincospif4_u35sse2
+#define ysincospif_u35 Sleef_cinz_sincospif4_u35sse2
+#define xsinpif_u05 Sleef_sinpif4_u05sse2
+#define ysinpif_u05 Sleef_cinz_sinpif4_u05sse2
+#define xcospif_u05 Sleef_cospif4_u05sse2
+#define ycospif_u05 Sleef_cinz_cospif4_u05sse2
+#define xldexpf Sleef_ldexpf4_sse2
+#define yldexpf Sleef_cinz_ldexpf4_sse2
+#define xilogbf Sleef_ilogbf4_sse2
+#define yilogbf Sleef_cinz_ilogbf4_sse2
+#define xfmaf Sleef_fmaf4_sse2
+#define yfmaf Sleef_cinz_fmaf4_sse2
+#define xsqrtf Sleef_sqrtf4_sse2
+#define ysqrtf Sleef_cinz_sqrtf4_sse2
+#define xsqrtf_u05 Sleef_sqrtf4_u05sse2
+#define ysqrtf_u05 Sleef_cinz_sqrtf4_u05sse2
+#define xsqrtf_u35 Sleef_sqrtf4_u35sse2
+#define ysqrtf_u35 Sleef_cinz_sqrtf4_u35sse2
+#define xhypotf_u05 Sleef_hypotf4_u05sse2
+#define yhypotf_u05 Sleef_cinz_hypotf4_u05sse2
+#define xhypotf_u35 Sleef_hypotf4_u35sse2
+#define yhypotf_u35 Sleef_cinz_hypotf4_u35sse2
+#define xfabsf Sleef_fabsf4_sse2
+#define yfabsf Sleef_cinz_fabsf4_sse2
+#define xcopysignf Sleef_copysignf4_sse2
+#define ycopysignf Sleef_cinz_copysignf4_sse2
+#define xfmaxf Sleef_fmaxf4_sse2
+#define yfmaxf Sleef_cinz_fmaxf4_sse2
+#define xfminf Sleef_fminf4_sse2
+#define yfminf Sleef_cinz_fminf4_sse2
+#define xfdimf Sleef_fdimf4_sse2
+#define yfdimf Sleef_cinz_fdimf4_sse2
+#define xtruncf Sleef_truncf4_sse2
+#define ytruncf Sleef_cinz_truncf4_sse2
+#define xfloorf Sleef_floorf4_sse2
+#define yfloorf Sleef_cinz_floorf4_sse2
+#define xceilf Sleef_ceilf4_sse2
+#define yceilf Sleef_cinz_ceilf4_sse2
+#define xroundf Sleef_roundf4_sse2
+#define yroundf Sleef_cinz_roundf4_sse2
+#define xrintf Sleef_rintf4_sse2
+#define yrintf Sleef_cinz_rintf4_sse2
+#define xnextafterf Sleef_nextafterf4_sse2
+#define ynextafterf Sleef_cinz_nextafterf4_sse2
+#define xfrfrexpf Sleef_frfrexpf4_sse2
+#define yfrfrexpf Sleef_cinz_frfrexpf4_sse2
+#define xexpfrexpf Sleef_expfrexpf4_sse2
+#define yexpfrexpf Sleef_cinz_expfrexpf4_sse2
+#define xfmodf Sleef_fmodf4_sse2
+#define yfmodf Sleef_cinz_fmodf4_sse2
+#define xremainderf Sleef_remainderf4_sse2
+#define yremainderf Sleef_cinz_remainderf4_sse2
+#define xmodff Sleef_modff4_sse2
+#define ymodff Sleef_cinz_modff4_sse2
+#define xlgammaf_u1 Sleef_lgammaf4_u10sse2
+#define ylgammaf_u1 Sleef_cinz_lgammaf4_u10sse2
+#define xtgammaf_u1 Sleef_tgammaf4_u10sse2
+#define ytgammaf_u1 Sleef_cinz_tgammaf4_u10sse2
+#define xerff_u1 Sleef_erff4_u10sse2
+#define yerff_u1 Sleef_cinz_erff4_u10sse2
+#define xerfcf_u15 Sleef_erfcf4_u15sse2
+#define yerfcf_u15 Sleef_cinz_erfcf4_u15sse2
+#define xsigmoidf Sleef_sigmoidf4_u10sse2
+#define ysigmoidf Sleef_cinz_sigmoidf4_u10sse2
+#define xsigmoidf_u35 Sleef_sigmoidf4_u35sse2
+#define ysigmoidf_u35 Sleef_cinz_sigmoidf4_u35sse2
+#define xsoftplusf Sleef_softplusf4_u10sse2
+#define ysoftplusf Sleef_cinz_softplusf4_u10sse2
+#define xsoftplusf_u35 Sleef_softplusf4_u35sse2
+#define ysoftplusf_u35 Sleef_cinz_softplusf4_u35sse2
+#define xsiluf Sleef_siluf4_u10sse2
+#define ysiluf Sleef_cinz_siluf4_u10sse2
+#define xsiluf_u35 Sleef_siluf4_u35sse2
+#define ysiluf_u35 Sleef_cinz_siluf4_u35sse2
+#define xgelutanhf Sleef_gelutanhf4_u10sse2
+#define ygelutanhf Sleef_cinz_gelutanhf4_u10sse2
+#define xgelutanhf_u35 Sleef_gelutanhf4_u35sse2
+#define ygelutanhf_u35 Sleef_cinz_gelutanhf4_u35sse2
+#define xgeluf_u15 Sleef_geluf4_u15sse2
+#define ygeluf_u15 Sleef_cinz_geluf4_u15sse2
+#define xgetIntf Sleef_getIntf4_sse2
+#define ygetIntf Sleef_cinz_getIntf4_sse2
+#define xgetPtrf Sleef_getPtrf4_sse2
+#define ygetPtrf Sleef_cinz_getPtrf4_sse2
+
+#define xsinf16_u1 Sleef_sinh4_u10sse2
+#define xcosf16_u1 Sleef_cosh4_u10sse2
+#define xtanf16_u1 Sleef_tanh4_u10sse2
+#define xasinf16_u1 Sleef_asinh4_u10sse2
+#define xacosf16_u1 Sleef_acosh4_u10sse2
+#define xatanf16_u1 Sleef_atanh4_u10sse2
+#define xatan2f16_u1 Sleef_atan2h4_u10sse2
+#define xlogf16_u1 Sleef_logh4_u10sse2
+#define xcbrtf16_u1 Sleef_cbrth4_u10sse2
+#define xexpf16 Sleef_exph4_u10sse2
+#define xpowf16 Sleef_powh4_u10sse2
+#define xsinhf16 Sleef_sinhh4_u10sse2
+#define xcoshf16 Sleef_coshh4_u10sse2
+#define xtanhf16 Sleef_tanhh4_u10sse2
+#define xasinhf16 Sleef_asinhh4_u10sse2
+#define xacoshf16 Sleef_acoshh4_u10sse2
+#define xatanhf16 Sleef_atanhh4_u10sse2
+#define xexp2f16 Sleef_exp2h4_u10sse2
+#define xexp10f16 Sleef_exp10h4_u10sse2
+#define xexpm1f16 Sleef_expm1h4_u10sse2
+#define xlog10f16 Sleef_log10h4_u10sse2
+#define xlog2f16 Sleef_log2h4_u10sse2
+#define xlog1pf16 Sleef_log1ph4_u10sse2
+#define xsqrtf16 Sleef_sqrth4_sse2
+#define xlgammaf16_u1 Sleef_lgammah4_u10sse2
+#define xtgammaf16_u1 Sleef_tgammah4_u10sse2
+#define xerff16_u1 Sleef_erfh4_u10sse2
+#define xerfcf16_u15 Sleef_erfch4_u15sse2
+#define xsigmoidf16 Sleef_sigmoidh4_u10sse2
+#define xsoftplusf16 Sleef_softplush4_u10sse2
+#define xsiluf16 Sleef_siluh4_u10sse2
+#define xgelutanhf16 Sleef_gelutanhh4_u10sse2
+#define xgeluf16_u15 Sleef_geluh4_u15sse2
+
+#define xsinbf16_u1 Sleef_sinbf16x4_u10sse2
+#define xcosbf16_u1 Sleef_cosbf16x4_u10sse2
+#define xlogbf16_u1 Sleef_logbf16x4_u10sse2
+#define xexpbf16 Sleef_expbf16x4_u10sse2
+#define xpowbf16 Sleef_powbf16x4_u10sse2
+#define xtanhbf16 Sleef_tanhbf16x4_u10sse2
+#define xexp2bf16 Sleef_exp2bf16x4_u10sse2
+#define xexp10bf16 Sleef_exp10bf16x4_u10sse2
+#define xexpm1bf16 Sleef_expm1bf16x4_u10sse2
+#define xlog10bf16 Sleef_log10bf16x4_u10sse2
+#define xlog2bf16 Sleef_log2bf16x4_u10sse2
+#define xlog1pbf16 Sleef_log1pbf16x4_u10sse2
+#define xsqrtbf16 Sleef_sqrtbf16x4_sse2
+#define xerfbf16_u1 Sleef_erfbf16x4_u10sse2
+#define xerfcbf16_u15 Sleef_erfcbf16x4_u15sse2
+#define xsigmoidbf16 Sleef_sigmoidbf16x4_u10sse2
+#define xsoftplusbf16 Sleef_softplusbf16x4_u10sse2
+#define xsilubf16 Sleef_silubf16x4_u10sse2
+#define xgelutanhbf16 Sleef_gelutanhbf16x4_u10sse2
+#define xgelubf16_u15 Sleef_gelubf16x4_u15sse2
+
+#else //#ifndef DETERMINISTIC
+
+#define xsin Sleef_cinz_sind2_u35sse2
+#define xcos Sleef_cinz_cosd2_u35sse2
+#define xsincos Sleef_cinz_sincosd2_u35sse2
+#define xtan Sleef_cinz_tand2_u35sse2
+#define xasin Sleef_cinz_asind2_u35sse2
+#define xacos Sleef_cinz_acosd2_u35sse2
+#define xatan Sleef_cinz_atand2_u35sse2
+#define xatan2 Sleef_cinz_atan2d2_u35sse2
+#define xlog Sleef_cinz_logd2_u35sse2
+#define xcbrt Sleef_cinz_cbrtd2_u35sse2
+#define xsin_u1 Sleef_cinz_sind2_u10sse2
+#define xcos_u1 Sleef_cinz_cosd2_u10sse2
+#define xsincos_u1 Sleef_cinz_sincosd2_u10sse2
+#define xtan_u1 Sleef_cinz_tand2_u10sse2
+#define xasin_u1 Sleef_cinz_asind2_u10sse2
+#define xacos_u1 Sleef_cinz_acosd2_u10sse2
+#define xatan_u1 Sleef_cinz_atand2_u10sse2
+#define xatan2_u1 Sleef_cinz_atan2d2_u10sse2
+#define xlog_u1 Sleef_cinz_logd2_u10sse2
+#define xcbrt_u1 Sleef_cinz_cbrtd2_u10sse2
+#define xexp Sleef_cinz_expd2_u10sse2
+#define xpow Sleef_cinz_powd2_u10sse2
+#define xsinh Sleef_cinz_sinhd2_u10sse2
+#define xcosh Sleef_cinz_coshd2_u10sse2
+#define xtanh Sleef_cinz_tanhd2_u10sse2
+#define xsinh_u35 Sleef_cinz_sinhd2_u35sse2
+#define xcosh_u35 Sleef_cinz_coshd2_u35sse2
+#define xtanh_u35 Sleef_cinz_tanhd2_u35sse2
+#define xfastsin_u3500 Sleef_cinz_fastsind2_u3500sse2
+#define xfastcos_u3500 Sleef_cinz_fastcosd2_u3500sse2
+#define xfastpow_u3500 Sleef_cinz_fastpowd2_u3500sse2
+#define xfastexp_u3500 Sleef_cinz_fastexpd2_u3500sse2
+#define xfastexp2_u3500 Sleef_cinz_fastexp2d2_u3500sse2
+#define xfastlog_u3500 Sleef_cinz_fastlogd2_u3500sse2
+#define xfastlog2_u3500 Sleef_cinz_fastlog2d2_u3500sse2
+#define xfasttanh_u3500 Sleef_cinz_fasttanhd2_u3500sse2
+#define xfastatan2_u3500 Sleef_cinz_fastatan2d2_u3500sse2
+#define xfastrsqrt_u3500 Sleef_cinz_fastrsqrtd2_u3500sse2
+#define xfastrcp_u3500 Sleef_cinz_fastrcpd2_u3500sse2
+#define xsinr_u35 Sleef_cinz_sinrd2_u35sse2
+#define xcosr_u35 Sleef_cinz_cosrd2_u35sse2
+#define xsincosr_u35 Sleef_cinz_sincosrd2_u35sse2
+#define xtanr_u35 Sleef_cinz_tanrd2_u35sse2
+#define xasinh Sleef_cinz_asinhd2_u10sse2
+#define xacosh Sleef_cinz_acoshd2_u10sse2
+#define xatanh Sleef_cinz_atanhd2_u10sse2
+#define xexp2 Sleef_cinz_exp2d2_u10sse2
+#define xexp2_u35 Sleef_cinz_exp2d2_u35sse2
+#define xexp10 Sleef_cinz_exp10d2_u10sse2
+#define xexp10_u35 Sleef_cinz_exp10d2_u35sse2
+#define xexpm1 Sleef_cinz_expm1d2_u10sse2
+#define xlog10 Sleef_cinz_log10d2_u10sse2
+#define xlog2 Sleef_cinz_log2d2_u10sse2
+#define xlog2_u35 Sleef_cinz_log2d2_u35sse2
+#define xlog1p Sleef_cinz_log1pd2_u10sse2
+#define xsincospi_u05 Sleef_cinz_sincospid2_u05sse2
+#define xsincospi_u35 Sleef_cinz_sincospid2_u35sse2
+#define xsinpi_u05 Sleef_cinz_sinpid2_u05sse2
+#define xcospi_u05 Sleef_cinz_cospid2_u05sse2
+#define xldexp Sleef_cinz_ldexpd2_sse2
+#define xilogb Sleef_cinz_ilogbd2_sse2
+#define xfma Sleef_cinz_fmad2_sse2
+#define xsqrt Sleef_cinz_sqrtd2_sse2
+#define xsqrt_u05 Sleef_cinz_sqrtd2_u05sse2
+#define xsqrt_u35 Sleef_cinz_sqrtd2_u35sse2
+#define xhypot_u05 Sleef_cinz_hypotd2_u05sse2
+#define xhypot_u35 Sleef_cinz_hypotd2_u35sse2
+#define xfabs Sleef_cinz_fabsd2_sse2
+#define xcopysign Sleef_cinz_copysignd2_sse2
+#define xfmax Sleef_cinz_fmaxd2_sse2
+#define xfmin Sleef_cinz_fmind2_sse2
+#define xfdim Sleef_cinz_fdimd2_sse2
+#define xtrunc Sleef_cinz_truncd2_sse2
+#define xfloor Sleef_cinz_floord2_sse2
+#define xceil Sleef_cinz_ceild2_sse2
+#define xround Sleef_cinz_roundd2_sse2
+#define xrint Sleef_cinz_rintd2_sse2
+#define xnextafter Sleef_cinz_nextafterd2_sse2
+#define xfrfrexp Sleef_cinz_frfrexpd2_sse2
+#define xexpfrexp Sleef_cinz_expfrexpd2_sse2
+#define xfmod Sleef_cinz_fmodd2_sse2
+#define xremainder Sleef_cinz_remainderd2_sse2
+#define xmodf Sleef_cinz_modfd2_sse2
+#define xlgamma_u1 Sleef_cinz_lgammad2_u10sse2
+#define xtgamma_u1 Sleef_cinz_tgammad2_u10sse2
+#define xerf_u1 Sleef_cinz_erfd2_u10sse2
+#define xerfc_u15 Sleef_cinz_erfcd2_u15sse2
+#define xsigmoid Sleef_cinz_sigmoidd2_u10sse2
+#define xsigmoid_u35 Sleef_cinz_sigmoidd2_u35sse2
+#define xsoftplus Sleef_cinz_softplusd2_u10sse2
+#define xsoftplus_u35 Sleef_cinz_softplusd2_u35sse2
+#define xsilu Sleef_cinz_silud2_u10sse2
+#define xsilu_u35 Sleef_cinz_silud2_u35sse2
+#define xgelutanh Sleef_cinz_gelutanhd2_u10sse2
+#define xgelutanh_u35 Sleef_cinz_gelutanhd2_u35sse2
+#define xgelu_u15 Sleef_cinz_gelud2_u15sse2
+#define xgetInt Sleef_cinz_getIntd2_sse2
+#define xgetPtr Sleef_cinz_getPtrd2_sse2
+
+#define xsinf Sleef_cinz_sinf4_u35sse2
+#define xcosf Sleef_cinz_cosf4_u35sse2
+#define xsincosf Sleef_cinz_sincosf4_u35sse2
+#define xtanf Sleef_cinz_tanf4_u35sse2
+#define xasinf Sleef_cinz_asinf4_u35sse2
+#define xacosf Sleef_cinz_acosf4_u35sse2
+#define xatanf Sleef_cinz_atanf4_u35sse2
+#define xatan2f Sleef_cinz_atan2f4_u35sse2
+#define xlogf Sleef_cinz_logf4_u35sse2
+#define xcbrtf Sleef_cinz_cbrtf4_u35sse2
+#define xsinf_u1 Sleef_cinz_sinf4_u10sse2
+#define xcosf_u1 Sleef_cinz_cosf4_u10sse2
+#define xsincosf_u1 Sleef_cinz_sincosf4_u10sse2
+#define xtanf_u1 Sleef_cinz_tanf4_u10sse2
+#define xasinf_u1 Sleef_cinz_asinf4_u10sse2
+#define xacosf_u1 Sleef_cinz_acosf4_u10sse2
+#define xatanf_u1 Sleef_cinz_atanf4_u10sse2
+#define xatan2f_u1 Sleef_cinz_atan2f4_u10sse2
+#define xlogf_u1 Sleef_cinz_logf4_u10sse2
+#define xcbrtf_u1 Sleef_cinz_cbrtf4_u10sse2
+#define xexpf Sleef_cinz_expf4_u10sse2
+#define xpowf Sleef_cinz_powf4_u10sse2
+#define xsinhf Sleef_cinz_sinhf4_u10sse2
+#define xcoshf Sleef_cinz_coshf4_u10sse2
+#define xtanhf Sleef_cinz_tanhf4_u10sse2
+#define xsinhf_u35 Sleef_cinz_sinhf4_u35sse2
+#define xcoshf_u35 Sleef_cinz_coshf4_u35sse2
+#define xtanhf_u35 Sleef_cinz_tanhf4_u35sse2
+#define xfastsinf_u3500 Sleef_cinz_fastsinf4_u3500sse2
+#define xfastcosf_u3500 Sleef_cinz_fastcosf4_u3500sse2
+#define xfastpowf_u3500 Sleef_cinz_fastpowf4_u3500sse2
+#define xfastexpf_u3500 Sleef_cinz_fastexpf4_u3500sse2
+#define xfastexp2f_u3500 Sleef_cinz_fastexp2f4_u3500sse2
+#define xfastlogf_u3500 Sleef_cinz_fastlogf4_u3500sse2
+#define xfastlog2f_u3500 Sleef_cinz_fastlog2f4_u3500sse2
+#define xfasttanhf_u3500 Sleef_cinz_fasttanhf4_u3500sse2
+#define xfastatan2f_u3500 Sleef_cinz_fastatan2f4_u3500sse2
+#define xfastrsqrtf_u3500 Sleef_cinz_fastrsqrtf4_u3500sse2
+#define xfastrcpf_u3500 Sleef_cinz_fastrcpf4_u3500sse2
+#define xsinrf_u35 Sleef_cinz_sinrf4_u35sse2
+#define xcosrf_u35 Sleef_cinz_cosrf4_u35sse2
+#define xsincosrf_u35 Sleef_cinz_sincosrf4_u35sse2
+#define xtanrf_u35 Sleef_cinz_tanrf4_u35sse2
+#define xasinhf Sleef_cinz_asinhf4_u10sse2
+#define xacoshf Sleef_cinz_acoshf4_u10sse2
+#define xatanhf Sleef_cinz_atanhf4_u10sse2
+#define xexp2f Sleef_cinz_exp2f4_u10sse2
+#define xexp2f_u35 Sleef_cinz_exp2f4_u35sse2
+#define xexp10f Sleef_cinz_exp10f4_u10sse2
+#define xexp10f_u35 Sleef_cinz_exp10f4_u35sse2
+#define xexpm1f Sleef_cinz_expm1f4_u10sse2
+#define xlog10f Sleef_cinz_log10f4_u10sse2
+#define xlog2f Sleef_cinz_log2f4_u10sse2
+#define xlog2f_u35 Sleef_cinz_log2f4_u35sse2
+#define xlog1pf Sleef_cinz_log1pf4_u10sse2
+#define xsincospif_u05 Sleef_cinz_sincospif4_u05sse2
+#define xsincospif_u35 Sleef_cinz_sincospif4_u35sse2
+#define xsinpif_u05 Sleef_cinz_sinpif4_u05sse2
+#define xcospif_u05 Sleef_cinz_cospif4_u05sse2
+#define xldexpf Sleef_cinz_ldexpf4_sse2
+#define xilogbf Sleef_cinz_ilogbf4_sse2
+#define xfmaf Sleef_cinz_fmaf4_sse2
+#define xsqrtf Sleef_cinz_sqrtf4_sse2
+#define xsqrtf_u05 Sleef_cinz_sqrtf4_u05sse2
+#define xsqrtf_u35 Sleef_cinz_sqrtf4_u35sse2
+#define xhypotf_u05 Sleef_cinz_hypotf4_u05sse2
+#define xhypotf_u35 Sleef_cinz_hypotf4_u35sse2
+#define xfabsf Sleef_cinz_fabsf4_sse2
+#define xcopysignf Sleef_cinz_copysignf4_sse2
+#define xfmaxf Sleef_cinz_fmaxf4_sse2
+#define xfminf Sleef_cinz_fminf4_sse2
+#define xfdimf Sleef_cinz_fdimf4_sse2
+#define xtruncf Sleef_cinz_truncf4_sse2
+#define xfloorf Sleef_cinz_floorf4_sse2
+#define xceilf Sleef_cinz_ceilf4_sse2
+#define xroundf Sleef_cinz_roundf4_sse2
+#define xrintf Sleef_cinz_rintf4_sse2
+#define xnextafterf Sleef_cinz_nextafterf4_sse2
+#define xfrfrexpf Sleef_cinz_frfrexpf4_sse2
+#define xexpfrexpf Sleef_cinz_expfrexpf4_sse2
+#define xfmodf Sleef_cinz_fmodf4_sse2
+#define xremainderf Sleef_cinz_remainderf4_sse2
+#define xmodff Sleef_cinz_modff4_sse2
+#define xlgammaf_u1 Sleef_cinz_lgammaf4_u10sse2
+#define xtgammaf_u1 Sleef_cinz_tgammaf4_u10sse2
+#define xerff_u1 Sleef_cinz_erff4_u10sse2
+#define xerfcf_u15 Sleef_cinz_erfcf4_u15sse2
+#define xsigmoidf Sleef_cinz_sigmoidf4_u10sse2
+#define xsigmoidf_u35 Sleef_cinz_sigmoidf4_u35sse2
+#define xsoftplusf Sleef_cinz_softplusf4_u10sse2
+#define xsoftplusf_u35 Sleef_cinz_softplusf4_u35sse2
+#define xsiluf Sleef_cinz_siluf4_u10sse2
+#define xsiluf_u35 Sleef_cinz_siluf4_u35sse2
+#define xgelutanhf Sleef_cinz_gelutanhf4_u10sse2
+#define xgelutanhf_u35 Sleef_cinz_gelutanhf4_u35sse2
+#define xgeluf_u15 Sleef_cinz_geluf4_u15sse2
+#define xgetIntf Sleef_cinz_getIntf4_sse2
+#define xgetPtrf Sleef_cinz_getPtrf4_sse2
+
+#endif // #ifndef DETERMINISTIC
@@ -0,0 +1,484 @@
+#define xsin _ZGVbN2v_sin_u35
+#define str_xsin "_ZGVbN2v_sin_u35"
+#define __sin_finite _ZGVbN2v___sin_finite
+#define xcos _ZGVbN2v_cos_u35
+#define str_xcos "_ZGVbN2v_cos_u35"
+#define __cos_finite _ZGVbN2v___cos_finite
+#define xsincos _ZGVbN2vl8l8_sincos_u35
+#define str_xsincos "_ZGVbN2vl8l8_sincos_u35"
+#define __sincos_finite _ZGVbN2vl8l8___sincos_finite
+#define xtan _ZGVbN2v_tan_u35
+#define str_xtan "_ZGVbN2v_tan_u35"
+#define __tan_finite _ZGVbN2v___tan_finite
+#define xasin _ZGVbN2v_asin_u35
+#define str_xasin "_ZGVbN2v_asin_u35"
+#define __asin_finite _ZGVbN2v___asin_finite
+#define xacos _ZGVbN2v_acos_u35
+#define str_xacos "_ZGVbN2v_acos_u35"
+#define __acos_finite _ZGVbN2v___acos_finite
+#define xatan _ZGVbN2v_atan_u35
+#define str_xatan "_ZGVbN2v_atan_u35"
+#define __atan_finite _ZGVbN2v___atan_finite
+#define xatan2 _ZGVbN2vv_atan2_u35
+#define str_xatan2 "_ZGVbN2vv_atan2_u35"
+#define __atan2_finite _ZGVbN2vv___atan2_finite
+#define xlog _ZGVbN2v_log_u35
+#define str_xlog "_ZGVbN2v_log_u35"
+#define __log_finite _ZGVbN2v___log_finite
+#define xcbrt _ZGVbN2v_cbrt_u35
+#define str_xcbrt "_ZGVbN2v_cbrt_u35"
+#define __cbrt_finite _ZGVbN2v___cbrt_finite
+#define xsin_u1 _ZGVbN2v_sin
+#define str_xsin_u1 "_ZGVbN2v_sin"
+#define __sin_u1_finite _ZGVbN2v___sin_finite
+#define xcos_u1 _ZGVbN2v_cos
+#define str_xcos_u1 "_ZGVbN2v_cos"
+#define __cos_u1_finite _ZGVbN2v___cos_finite
+#define xsincos_u1 _ZGVbN2vl8l8_sincos
+#define str_xsincos_u1 "_ZGVbN2vl8l8_sincos"
+#define __sincos_u1_finite _ZGVbN2vl8l8___sincos_finite
+#define xtan_u1 _ZGVbN2v_tan
+#define str_xtan_u1 "_ZGVbN2v_tan"
+#define __tan_u1_finite _ZGVbN2v___tan_finite
+#define xasin_u1 _ZGVbN2v_asin
+#define str_xasin_u1 "_ZGVbN2v_asin"
+#define __asin_u1_finite _ZGVbN2v___asin_finite
+#define xacos_u1 _ZGVbN2v_acos
+#define str_xacos_u1 "_ZGVbN2v_acos"
+#define __acos_u1_finite _ZGVbN2v___acos_finite
+#define xatan_u1 _ZGVbN2v_atan
+#define str_xatan_u1 "_ZGVbN2v_atan"
+#define __atan_u1_finite _ZGVbN2v___atan_finite
+#define xatan2_u1 _ZGVbN2vv_atan2
+#define str_xatan2_u1 "_ZGVbN2vv_atan2"
+#define __atan2_u1_finite _ZGVbN2vv___atan2_finite
+#define xlog_u1 _ZGVbN2v_log
+#define str_xlog_u1 "_ZGVbN2v_log"
+#define __log_u1_finite _ZGVbN2v___log_finite
+#define xcbrt_u1 _ZGVbN2v_cbrt
+#define str_xcbrt_u1 "_ZGVbN2v_cbrt"
+#define __cbrt_u1_finite _ZGVbN2v___cbrt_finite
+#define xexp _ZGVbN2v_exp
+#define str_xexp "_ZGVbN2v_exp"
+#define __exp_finite _ZGVbN2v___exp_finite
+#define xpow _ZGVbN2vv_pow
+#define str_xpow "_ZGVbN2vv_pow"
+#define __pow_finite _ZGVbN2vv___pow_finite
+#define xsinh _ZGVbN2v_sinh
+#define str_xsinh "_ZGVbN2v_sinh"
+#define __sinh_finite _ZGVbN2v___sinh_finite
+#define xcosh _ZGVbN2v_cosh
+#define str_xcosh "_ZGVbN2v_cosh"
+#define __cosh_finite _ZGVbN2v___cosh_finite
+#define xtanh _ZGVbN2v_tanh
+#define str_xtanh "_ZGVbN2v_tanh"
+#define __tanh_finite _ZGVbN2v___tanh_finite
+#define xsinh_u35 _ZGVbN2v_sinh_u35
+#define str_xsinh_u35 "_ZGVbN2v_sinh_u35"
+#define __sinh_u35_finite _ZGVbN2v___sinh_finite
+#define xcosh_u35 _ZGVbN2v_cosh_u35
+#define str_xcosh_u35 "_ZGVbN2v_cosh_u35"
+#define __cosh_u35_finite _ZGVbN2v___cosh_finite
+#define xtanh_u35 _ZGVbN2v_tanh_u35
+#define str_xtanh_u35 "_ZGVbN2v_tanh_u35"
+#define __tanh_u35_finite _ZGVbN2v___tanh_finite
+#define xfastexp_u3500 _ZGVbN2v_fastexp_u3500
+#define str_xfastexp_u3500 "_ZGVbN2v_fastexp_u3500"
+#define __fastexp_u3500_finite _ZGVbN2v___fastexp_finite
+#define xfastexp2_u3500 _ZGVbN2v_fastexp2_u3500
+#define str_xfastexp2_u3500 "_ZGVbN2v_fastexp2_u3500"
+#define __fastexp2_u3500_finite _ZGVbN2v___fastexp2_finite
+#define xfastlog_u3500 _ZGVbN2v_fastlog_u3500
+#define str_xfastlog_u3500 "_ZGVbN2v_fastlog_u3500"
+#define __fastlog_u3500_finite _ZGVbN2v___fastlog_finite
+#define xfastlog2_u3500 _ZGVbN2v_fastlog2_u3500
+#define str_xfastlog2_u3500 "_ZGVbN2v_fastlog2_u3500"
+#define __fastlog2_u3500_finite _ZGVbN2v___fastlog2_finite
+#define xfasttanh_u3500 _ZGVbN2v_fasttanh_u3500
+#define str_xfasttanh_u3500 "_ZGVbN2v_fasttanh_u3500"
+#define __fasttanh_u3500_finite _ZGVbN2v___fasttanh_finite
+#define xfastatan2_u3500 _ZGVbN2vv_fastatan2_u3500
+#define str_xfastatan2_u3500 "_ZGVbN2vv_fastatan2_u3500"
+#define __fastatan2_u3500_finite _ZGVbN2vv___fastatan2_finite
+#define xfastrsqrt_u3500 _ZGVbN2v_fastrsqrt_u3500
+#define str_xfastrsqrt_u3500 "_ZGVbN2v_fastrsqrt_u3500"
+#define __fastrsqrt_u3500_finite _ZGVbN2v___fastrsqrt_finite
+#define xfastrcp_u3500 _ZGVbN2v_fastrcp_u3500
+#define str_xfastrcp_u3500 "_ZGVbN2v_fastrcp_u3500"
+#define __fastrcp_u3500_finite _ZGVbN2v___fastrcp_finite
+#define xasinh _ZGVbN2v_asinh
+#define str_xasinh "_ZGVbN2v_asinh"
+#define __asinh_finite _ZGVbN2v___asinh_finite
+#define xacosh _ZGVbN2v_acosh
+#define str_xacosh "_ZGVbN2v_acosh"
+#define __acosh_finite _ZGVbN2v___acosh_finite
+#define xatanh _ZGVbN2v_atanh
+#define str_xatanh "_ZGVbN2v_atanh"
+#define __atanh_finite _ZGVbN2v___atanh_finite
+#define xexp2 _ZGVbN2v_exp2
+#define str_xexp2 "_ZGVbN2v_exp2"
+#define __exp2_finite _ZGVbN2v___exp2_finite
+#define xexp2_u35 _ZGVbN2v_exp2_u35
+#define str_xexp2_u35 "_ZGVbN2v_exp2_u35"
+#define __exp2_u35_finite _ZGVbN2v___exp2_finite
+#define xexp10 _ZGVbN2v_exp10
+#define str_xexp10 "_ZGVbN2v_exp10"
+#define __exp10_finite _ZGVbN2v___exp10_finite
+#define xexp10_u35 _ZGVbN2v_exp10_u35
+#define str_xexp10_u35 "_ZGVbN2v_exp10_u35"
+#define __exp10_u35_finite _ZGVbN2v___exp10_finite
+#define xexpm1 _ZGVbN2v_expm1
+#define str_xexpm1 "_ZGVbN2v_expm1"
+#define __expm1_finite _ZGVbN2v___expm1_finite
+#define xlog10 _ZGVbN2v_log10
+#define str_xlog10 "_ZGVbN2v_log10"
+#define __log10_finite _ZGVbN2v___log10_finite
+#define xlog2 _ZGVbN2v_log2
+#define str_xlog2 "_ZGVbN2v_log2"
+#define __log2_finite _ZGVbN2v___log2_finite
+#define xlog2_u35 _ZGVbN2v_log2_u35
+#define str_xlog2_u35 "_ZGVbN2v_log2_u35"
+#define __log2_u35_finite _ZGVbN2v___log2_finite
+#define xlog1p _ZGVbN2v_log1p
+#define str_xlog1p "_ZGVbN2v_log1p"
+#define __log1p_finite _ZGVbN2v___log1p_finite
+#define xsincospi_u05 _ZGVbN2vl8l8_sincospi
+#define str_xsincospi_u05 "_ZGVbN2vl8l8_sincospi"
+#define __sincospi_u05_finite _ZGVbN2vl8l8___sincospi_finite
+#define xsincospi_u35 _ZGVbN2vl8l8_sincospi_u35
+#define str_xsincospi_u35 "_ZGVbN2vl8l8_sincospi_u35"
+#define __sincospi_u35_finite _ZGVbN2vl8l8___sincospi_finite
+#define xsinpi_u05 _ZGVbN2v_sinpi
+#define str_xsinpi_u05 "_ZGVbN2v_sinpi"
+#define __sinpi_u05_finite _ZGVbN2v___sinpi_finite
+#define xcospi_u05 _ZGVbN2v_cospi
+#define str_xcospi_u05 "_ZGVbN2v_cospi"
+#define __cospi_u05_finite _ZGVbN2v___cospi_finite
+#define xldexp _ZGVbN2vv_ldexp
+#define str_xldexp "_ZGVbN2vv_ldexp"
+#define __ldexp_finite _ZGVbN2vv___ldexp_finite
+#define xilogb _ZGVbN2v_ilogb
+#define str_xilogb "_ZGVbN2v_ilogb"
+#define __ilogb_finite _ZGVbN2v___ilogb_finite
+#define xfma _ZGVbN2vvv_fma
+#define str_xfma "_ZGVbN2vvv_fma"
+#define __fma_finite _ZGVbN2vvv___fma_finite
+#define xsqrt _ZGVbN2v_sqrt
+#define str_xsqrt "_ZGVbN2v_sqrt"
+#define __sqrt_finite _ZGVbN2v___sqrt_finite
+#define xsqrt_u35 _ZGVbN2v_sqrt_u35
+#define str_xsqrt_u35 "_ZGVbN2v_sqrt_u35"
+#define __sqrt_u35_finite _ZGVbN2v___sqrt_finite
+#define xhypot_u05 _ZGVbN2vv_hypot
+#define str_xhypot_u05 "_ZGVbN2vv_hypot"
+#define __hypot_u05_finite _ZGVbN2vv___hypot_finite
+#define xhypot_u35 _ZGVbN2vv_hypot_u35
+#define str_xhypot_u35 "_ZGVbN2vv_hypot_u35"
+#define __hypot_u35_finite _ZGVbN2vv___hypot_finite
+#define xfabs _ZGVbN2v_fabs
+#define str_xfabs "_ZGVbN2v_fabs"
+#define __fabs_finite _ZGVbN2v___fabs_finite
+#define xcopysign _ZGVbN2vv_copysign
+#define str_xcopysign "_ZGVbN2vv_copysign"
+#define __copysign_finite _ZGVbN2vv___copysign_finite
+#define xfmax _ZGVbN2vv_fmax
+#define str_xfmax "_ZGVbN2vv_fmax"
+#define __fmax_finite _ZGVbN2vv___fmax_finite
+#define xfmin _ZGVbN2vv_fmin
+#define str_xfmin "_ZGVbN2vv_fmin"
+#define __fmin_finite _ZGVbN2vv___fmin_finite
+#define xfdim _ZGVbN2vv_fdim
+#define str_xfdim "_ZGVbN2vv_fdim"
+#define __fdim_finite _ZGVbN2vv___fdim_finite
+#define xtrunc _ZGVbN2v_trunc
+#define str_xtrunc "_ZGVbN2v_trunc"
+#define __trunc_finite _ZGVbN2v___trunc_finite
+#define xfloor _ZGVbN2v_floor
+#define str_xfloor "_ZGVbN2v_floor"
+#define __floor_finite _ZGVbN2v___floor_finite
+#define xceil _ZGVbN2v_ceil
+#define str_xceil "_ZGVbN2v_ceil"
+#define __ceil_finite _ZGVbN2v___ceil_finite
+#define xround _ZGVbN2v_round
+#define str_xround "_ZGVbN2v_round"
+#define __round_finite _ZGVbN2v___round_finite
+#define xrint _ZGVbN2v_rint
+#define str_xrint "_ZGVbN2v_rint"
+#define __rint_finite _ZGVbN2v___rint_finite
+#define xnextafter _ZGVbN2vv_nextafter
+#define str_xnextafter "_ZGVbN2vv_nextafter"
+#define __nextafter_finite _ZGVbN2vv___nextafter_finite
+#define xfrfrexp _ZGVbN2v_frfrexp
+#define str_xfrfrexp "_ZGVbN2v_frfrexp"
+#define __frfrexp_finite _ZGVbN2v___frfrexp_finite
+#define xexpfrexp _ZGVbN2v_expfrexp
+#define str_xexpfrexp "_ZGVbN2v_expfrexp"
+#define __expfrexp_finite _ZGVbN2v___expfrexp_finite
+#define xfmod _ZGVbN2vv_fmod
+#define str_xfmod "_ZGVbN2vv_fmod"
+#define __fmod_finite _ZGVbN2vv___fmod_finite
+#define xremainder _ZGVbN2vv_remainder
+#define str_xremainder "_ZGVbN2vv_remainder"
+#define __remainder_finite _ZGVbN2vv___remainder_finite
+#define xmodf _ZGVbN2vl8_modf
+#define str_xmodf "_ZGVbN2vl8_modf"
+#define __modf_finite _ZGVbN2vl8___modf_finite
+#define xlgamma_u1 _ZGVbN2v_lgamma
+#define str_xlgamma_u1 "_ZGVbN2v_lgamma"
+#define __lgamma_u1_finite _ZGVbN2v___lgamma_finite
+#define xtgamma_u1 _ZGVbN2v_tgamma
+#define str_xtgamma_u1 "_ZGVbN2v_tgamma"
+#define __tgamma_u1_finite _ZGVbN2v___tgamma_finite
+#define xerf_u1 _ZGVbN2v_erf
+#define str_xerf_u1 "_ZGVbN2v_erf"
+#define __erf_u1_finite _ZGVbN2v___erf_finite
+#define xerfc_u15 _ZGVbN2v_erfc
+#define str_xerfc_u15 "_ZGVbN2v_erfc"
+#define __erfc_u15_finite _ZGVbN2v___erfc_finite
+
+#define xsinf _ZGVbN4v_sinf_u35
+#define str_xsinf "_ZGVbN4v_sinf_u35"
+#define __sinf_finite _ZGVbN4v___sinf_finite
+#define xcosf _ZGVbN4v_cosf_u35
+#define str_xcosf "_ZGVbN4v_cosf_u35"
+#define __cosf_finite _ZGVbN4v___cosf_finite
+#define xsincosf _ZGVbN4vl4l4_sincosf_u35
+#define str_xsincosf "_ZGVbN4vl4l4_sincosf_u35"
+#define __sincosf_finite _ZGVbN4vl4l4___sincosf_finite
+#define xtanf _ZGVbN4v_tanf_u35
+#define str_xtanf "_ZGVbN4v_tanf_u35"
+#define __tanf_finite _ZGVbN4v___tanf_finite
+#define xasinf _ZGVbN4v_asinf_u35
+#define str_xasinf "_ZGVbN4v_asinf_u35"
+#define __asinf_finite _ZGVbN4v___asinf_finite
+#define xacosf _ZGVbN4v_acosf_u35
+#define str_xacosf "_ZGVbN4v_acosf_u35"
+#define __acosf_finite _ZGVbN4v___acosf_finite
+#define xatanf _ZGVbN4v_atanf_u35
+#define str_xatanf "_ZGVbN4v_atanf_u35"
+#define __atanf_finite _ZGVbN4v___atanf_finite
+#define xatan2f _ZGVbN4vv_atan2f_u35
+#define str_xatan2f "_ZGVbN4vv_atan2f_u35"
+#define __atan2f_finite _ZGVbN4vv___atan2f_finite
+#define xlogf _ZGVbN4v_logf_u35
+#define str_xlogf "_ZGVbN4v_logf_u35"
+#define __logf_finite _ZGVbN4v___logf_finite
+#define xcbrtf _ZGVbN4v_cbrtf_u35
+#define str_xcbrtf "_ZGVbN4v_cbrtf_u35"
+#define __cbrtf_finite _ZGVbN4v___cbrtf_finite
+#define xsinf_u1 _ZGVbN4v_sinf
+#define str_xsinf_u1 "_ZGVbN4v_sinf"
+#define __sinf_u1_finite _ZGVbN4v___sinf_finite
+#define xcosf_u1 _ZGVbN4v_cosf
+#define str_xcosf_u1 "_ZGVbN4v_cosf"
+#define __cosf_u1_finite _ZGVbN4v___cosf_finite
+#define xsincosf_u1 _ZGVbN4vl4l4_sincosf
+#define str_xsincosf_u1 "_ZGVbN4vl4l4_sincosf"
+#define __sincosf_u1_finite _ZGVbN4vl4l4___sincosf_finite
+#define xtanf_u1 _ZGVbN4v_tanf
+#define str_xtanf_u1 "_ZGVbN4v_tanf"
+#define __tanf_u1_finite _ZGVbN4v___tanf_finite
+#define xasinf_u1 _ZGVbN4v_asinf
+#define str_xasinf_u1 "_ZGVbN4v_asinf"
+#define __asinf_u1_finite _ZGVbN4v___asinf_finite
+#define xacosf_u1 _ZGVbN4v_acosf
+#define str_xacosf_u1 "_ZGVbN4v_acosf"
+#define __acosf_u1_finite _ZGVbN4v___acosf_finite
+#define xatanf_u1 _ZGVbN4v_atanf
+#define str_xatanf_u1 "_ZGVbN4v_atanf"
+#define __atanf_u1_finite _ZGVbN4v___atanf_finite
+#define xatan2f_u1 _ZGVbN4vv_atan2f
+#define str_xatan2f_u1 "_ZGVbN4vv_atan2f"
+#define __atan2f_u1_finite _ZGVbN4vv___atan2f_finite
+#define xlogf_u1 _ZGVbN4v_logf
+#define str_xlogf_u1 "_ZGVbN4v_logf"
+#define __logf_u1_finite _ZGVbN4v___logf_finite
+#define xcbrtf_u1 _ZGVbN4v_cbrtf
+#define str_xcbrtf_u1 "_ZGVbN4v_cbrtf"
+#define __cbrtf_u1_finite _ZGVbN4v___cbrtf_finite
+#define xexpf _ZGVbN4v_expf
+#define str_xexpf "_ZGVbN4v_expf"
+#define __expf_finite _ZGVbN4v___expf_finite
+#define xpowf _ZGVbN4vv_powf
+#define str_xpowf "_ZGVbN4vv_powf"
+#define __powf_finite _ZGVbN4vv___powf_finite
+#define xsinhf _ZGVbN4v_sinhf
+#define str_xsinhf "_ZGVbN4v_sinhf"
+#define __sinhf_finite _ZGVbN4v___sinhf_finite
+#define xcoshf _ZGVbN4v_coshf
+#define str_xcoshf "_ZGVbN4v_coshf"
+#define __coshf_finite _ZGVbN4v___coshf_finite
+#define xtanhf _ZGVbN4v_tanhf
+#define str_xtanhf "_ZGVbN4v_tanhf"
+#define __tanhf_finite _ZGVbN4v___tanhf_finite
+#define xsinhf_u35 _ZGVbN4v_sinhf_u35
+#define str_xsinhf_u35 "_ZGVbN4v_sinhf_u35"
+#define __sinhf_u35_finite _ZGVbN4v___sinhf_finite
+#define xcoshf_u35 _ZGVbN4v_coshf_u35
+#define str_xcoshf_u35 "_ZGVbN4v_coshf_u35"
+#define __coshf_u35_finite _ZGVbN4v___coshf_finite
+#define xtanhf_u35 _ZGVbN4v_tanhf_u35
+#define str_xtanhf_u35 "_ZGVbN4v_tanhf_u35"
+#define __tanhf_u35_finite _ZGVbN4v___tanhf_finite
+#define xfastsinf_u3500 _ZGVbN4v_fastsinf_u3500
+#define str_xfastsinf_u3500 "_ZGVbN4v_fastsinf_u3500"
+#define __fastsinf_u3500_finite _ZGVbN4v___fastsinf_finite
+#define xfastcosf_u3500 _ZGVbN4v_fastcosf_u3500
+#define str_xfastcosf_u3500 "_ZGVbN4v_fastcosf_u3500"
+#define __fastcosf_u3500_finite _ZGVbN4v___fastcosf_finite
+#define xfastpowf_u3500 _ZGVbN4vv_fastpowf_u3500
+#define str_xfastpowf_u3500 "_ZGVbN4vv_fastpowf_u3500"
+#define __fastpowf_u3500_finite _ZGVbN4vv___fastpowf_finite
+#define xfastexpf_u3500 _ZGVbN4v_fastexpf_u3500
+#define str_xfastexpf_u3500 "_ZGVbN4v_fastexpf_u3500"
+#define __fastexpf_u3500_finite _ZGVbN4v___fastexpf_finite
+#define xfastexp2f_u3500 _ZGVbN4v_fastexp2f_u3500
+#define str_xfastexp2f_u3500 "_ZGVbN4v_fastexp2f_u3500"
+#define __fastexp2f_u3500_finite _ZGVbN4v___fastexp2f_finite
+#define xfastlogf_u3500 _ZGVbN4v_fastlogf_u3500
+#define str_xfastlogf_u3500 "_ZGVbN4v_fastlogf_u3500"
+#define __fastlogf_u3500_finite _ZGVbN4v___fastlogf_finite
+#define xfastlog2f_u3500 _ZGVbN4v_fastlog2f_u3500
+#define str_xfastlog2f_u3500 "_ZGVbN4v_fastlog2f_u3500"
+#define __fastlog2f_u3500_finite _ZGVbN4v___fastlog2f_finite
+#define xfasttanhf_u3500 _ZGVbN4v_fasttanhf_u3500
+#define str_xfasttanhf_u3500 "_ZGVbN4v_fasttanhf_u3500"
+#define __fasttanhf_u3500_finite _ZGVbN4v___fasttanhf_finite
+#define xfastatan2f_u3500 _ZGVbN4vv_fastatan2f_u3500
+#define str_xfastatan2f_u3500 "_ZGVbN4vv_fastatan2f_u3500"
+#define __fastatan2f_u3500_finite _ZGVbN4vv___fastatan2f_finite
+#define xfastrsqrtf_u3500 _ZGVbN4v_fastrsqrtf_u3500
+#define str_xfastrsqrtf_u3500 "_ZGVbN4v_fastrsqrtf_u3500"
+#define __fastrsqrtf_u3500_finite _ZGVbN4v___fastrsqrtf_finite
+#define xfastrcpf_u3500 _ZGVbN4v_fastrcpf_u3500
+#define str_xfastrcpf_u3500 "_ZGVbN4v_fastrcpf_u3500"
+#define __fastrcpf_u3500_finite _ZGVbN4v___fastrcpf_finite
+#define xasinhf _ZGVbN4v_asinhf
+#define str_xasinhf "_ZGVbN4v_asinhf"
+#define __asinhf_finite _ZGVbN4v___asinhf_finite
+#define xacoshf _ZGVbN4v_acoshf
+#define str_xacoshf "_ZGVbN4v_acoshf"
+#define __acoshf_finite _ZGVbN4v___acoshf_finite
+#define xatanhf _ZGVbN4v_atanhf
+#define str_xatanhf "_ZGVbN4v_atanhf"
+#define __atanhf_finite _ZGVbN4v___atanhf_finite
+#define xexp2f _ZGVbN4v_exp2f
+#define str_xexp2f "_ZGVbN4v_exp2f"
+#define __exp2f_finite _ZGVbN4v___exp2f_finite
+#define xexp2f_u35 _ZGVbN4v_exp2f_u35
+#define str_xexp2f_u35 "_ZGVbN4v_exp2f_u35"
+#define __exp2f_u35_finite _ZGVbN4v___exp2f_finite
+#define xexp10f _ZGVbN4v_exp10f
+#define str_xexp10f "_ZGVbN4v_exp10f"
+#define __exp10f_finite _ZGVbN4v___exp10f_finite
+#define xexp10f_u35 _ZGVbN4v_exp10f_u35
+#define str_xexp10f_u35 "_ZGVbN4v_exp10f_u35"
+#define __exp10f_u35_finite _ZGVbN4v___exp10f_finite
+#define xexpm1f _ZGVbN4v_expm1f
+#define str_xexpm1f "_ZGVbN4v_expm1f"
+#define __expm1f_finite _ZGVbN4v___expm1f_finite
+#define xlog10f _ZGVbN4v_log10f
+#define str_xlog10f "_ZGVbN4v_log10f"
+#define __log10f_finite _ZGVbN4v___log10f_finite
+#define xlog2f _ZGVbN4v_log2f
+#define str_xlog2f "_ZGVbN4v_log2f"
+#define __log2f_finite _ZGVbN4v___log2f_finite
+#define xlog2f_u35 _ZGVbN4v_log2f_u35
+#define str_xlog2f_u35 "_ZGVbN4v_log2f_u35"
+#define __log2f_u35_finite _ZGVbN4v___log2f_finite
+#define xlog1pf _ZGVbN4v_log1pf
+#define str_xlog1pf "_ZGVbN4v_log1pf"
+#define __log1pf_finite _ZGVbN4v___log1pf_finite
+#define xsincospif_u05 _ZGVbN4vl4l4_sincospif
+#define str_xsincospif_u05 "_ZGVbN4vl4l4_sincospif"
+#define __sincospif_u05_finite _ZGVbN4vl4l4___sincospif_finite
+#define xsincospif_u35 _ZGVbN4vl4l4_sincospif_u35
+#define str_xsincospif_u35 "_ZGVbN4vl4l4_sincospif_u35"
+#define __sincospif_u35_finite _ZGVbN4vl4l4___sincospif_finite
+#define xsinpif_u05 _ZGVbN4v_sinpif
+#define str_xsinpif_u05 "_ZGVbN4v_sinpif"
+#define __sinpif_u05_finite _ZGVbN4v___sinpif_finite
+#define xcospif_u05 _ZGVbN4v_cospif
+#define str_xcospif_u05 "_ZGVbN4v_cospif"
+#define __cospif_u05_finite _ZGVbN4v___cospif_finite
+#define xldexpf _ZGVbN4vv_ldexpf
+#define str_xldexpf "_ZGVbN4vv_ldexpf"
+#define __ldexpf_finite _ZGVbN4vv___ldexpf_finite
+#define xilogbf _ZGVbN4v_ilogbf
+#define str_xilogbf "_ZGVbN4v_ilogbf"
+#define __ilogbf_finite _ZGVbN4v___ilogbf_finite
+#define xfmaf _ZGVbN4vvv_fmaf
+#define str_xfmaf "_ZGVbN4vvv_fmaf"
+#define __fmaf_finite _ZGVbN4vvv___fmaf_finite
+#define xsqrtf _ZGVbN4v_sqrtf
+#define str_xsqrtf "_ZGVbN4v_sqrtf"
+#define __sqrtf_finite _ZGVbN4v___sqrtf_finite
+#define xsqrtf_u35 _ZGVbN4v_sqrtf_u35
+#define str_xsqrtf_u35 "_ZGVbN4v_sqrtf_u35"
+#define __sqrtf_u35_finite _ZGVbN4v___sqrtf_finite
+#define xhypotf_u05 _ZGVbN4vv_hypotf
+#define str_xhypotf_u05 "_ZGVbN4vv_hypotf"
+#define __hypotf_u05_finite _ZGVbN4vv___hypotf_finite
+#define xhypotf_u35 _ZGVbN4vv_hypotf_u35
+#define str_xhypotf_u35 "_ZGVbN4vv_hypotf_u35"
+#define __hypotf_u35_finite _ZGVbN4vv___hypotf_finite
+#define xfabsf _ZGVbN4v_fabsf
+#define str_xfabsf "_ZGVbN4v_fabsf"
+#define __fabsf_finite _ZGVbN4v___fabsf_finite
+#define xcopysignf _ZGVbN4vv_copysignf
+#define str_xcopysignf "_ZGVbN4vv_copysignf"
+#define __copysignf_finite _ZGVbN4vv___copysignf_finite
+#define xfmaxf _ZGVbN4vv_fmaxf
+#define str_xfmaxf "_ZGVbN4vv_fmaxf"
+#define __fmaxf_finite _ZGVbN4vv___fmaxf_finite
+#define xfminf _ZGVbN4vv_fminf
+#define str_xfminf "_ZGVbN4vv_fminf"
+#define __fminf_finite _ZGVbN4vv___fminf_finite
+#define xfdimf _ZGVbN4vv_fdimf
+#define str_xfdimf "_ZGVbN4vv_fdimf"
+#define __fdimf_finite _ZGVbN4vv___fdimf_finite
+#define xtruncf _ZGVbN4v_truncf
+#define str_xtruncf "_ZGVbN4v_truncf"
+#define __truncf_finite _ZGVbN4v___truncf_finite
+#define xfloorf _ZGVbN4v_floorf
+#define str_xfloorf "_ZGVbN4v_floorf"
+#define __floorf_finite _ZGVbN4v___floorf_finite
+#define xceilf _ZGVbN4v_ceilf
+#define str_xceilf "_ZGVbN4v_ceilf"
+#define __ceilf_finite _ZGVbN4v___ceilf_finite
+#define xroundf _ZGVbN4v_roundf
+#define str_xroundf "_ZGVbN4v_roundf"
+#define __roundf_finite _ZGVbN4v___roundf_finite
+#define xrintf _ZGVbN4v_rintf
+#define str_xrintf "_ZGVbN4v_rintf"
+#define __rintf_finite _ZGVbN4v___rintf_finite
+#define xnextafterf _ZGVbN4vv_nextafterf
+#define str_xnextafterf "_ZGVbN4vv_nextafterf"
+#define __nextafterf_finite _ZGVbN4vv___nextafterf_finite
+#define xfrfrexpf _ZGVbN4v_frfrexpf
+#define str_xfrfrexpf "_ZGVbN4v_frfrexpf"
+#define __frfrexpf_finite _ZGVbN4v___frfrexpf_finite
+#define xexpfrexpf _ZGVbN4v_expfrexpf
+#define str_xexpfrexpf "_ZGVbN4v_expfrexpf"
+#define __expfrexpf_finite _ZGVbN4v___expfrexpf_finite
+#define xfmodf _ZGVbN4vv_fmodf
+#define str_xfmodf "_ZGVbN4vv_fmodf"
+#define __fmodf_finite _ZGVbN4vv___fmodf_finite
+#define xremainderf _ZGVbN4vv_remainderf
+#define str_xremainderf "_ZGVbN4vv_remainderf"
+#define __remainderf_finite _ZGVbN4vv___remainderf_finite
+#define xmodff _ZGVbN4vl4_modff
+#define str_xmodff "_ZGVbN4vl4_modff"
+#define __modff_finite _ZGVbN4vl4___modff_finite
+#define xlgammaf_u1 _ZGVbN4v_lgammaf
+#define str_xlgammaf_u1 "_ZGVbN4v_lgammaf"
+#define __lgammaf_u1_finite _ZGVbN4v___lgammaf_finite
+#define xtgammaf_u1 _ZGVbN4v_tgammaf
+#define str_xtgammaf_u1 "_ZGVbN4v_tgammaf"
+#define __tgammaf_u1_finite _ZGVbN4v___tgammaf_finite
+#define xerff_u1 _ZGVbN4v_erff
+#define str_xerff_u1 "_ZGVbN4v_erff"
+#define __erff_u1_finite _ZGVbN4v___erff_finite
+#define xerfcf_u15 _ZGVbN4v_erfcf
+#define str_xerfcf_u15 "_ZGVbN4v_erfcf"
+#define __erfcf_u15_finite _ZGVbN4v___erfcf_finite
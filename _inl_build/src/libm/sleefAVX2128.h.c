@@ -0,0 +1,7305 @@
+
+
+
+
+
+
+/* Copyright (C) 1991-2022 Free Software Foundation, Inc.
+   This file is part of the GNU C Library.
+
+   The GNU C Library is free software; you can redistribute it and/or
+   modify it under the terms of the GNU Lesser General Public
+   License as published by the Free Software Foundation; either
+   version 2.1 of the License, or (at your option) any later version.
+
+   The GNU C Library is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+   Lesser General Public License for more details.
+
+   You should have received a copy of the GNU Lesser General Public
+   License along with the GNU C Library; if not, see
+   <https://www.gnu.org/licenses/>.  */
+
+
+
+
+/* This header is separate from features.h so that the compiler can
+   include it implicitly at the start of every compilation.  It must
+   not itself include <features.h> or any other header that includes
+   <features.h> because the implicit include comes before any feature
+   test macros that may be defined in a source file before it first
+   explicitly includes a system header.  GCC knows the name of this
+   header in order to preinclude it.  */
+
+/* glibc's intent is to support the IEC 559 math functionality, real
+   and complex.  If the GCC (4.9 and later) predefined macros
+   specifying compiler intent are available, use them to determine
+   whether the overall intent is to support these features; otherwise,
+   presume an older compiler has intent to support these features and
+   define these macros by default.  */
+
+/* wchar_t uses Unicode 10.0.0.  Version 10.0 of the Unicode Standard is
+   synchronized with ISO/IEC 10646:2017, fifth edition, plus
+   the following additions from Amendment 1 to the fifth edition:
+   - 56 emoji characters
+   - 285 hentaigana
+   - 3 additional Zanabazar Square characters */
+
+
+
+
+//   Copyright Naoki Shibata and contributors 2010 - 2021.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+// Always use -ffp-contract=off option to compile SLEEF.
+
+
+//   Copyright Naoki Shibata and contributors 2010 - 2021.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+SLEEFSHARPif !defined(SLEEFXXX__NVCC__) && ((defined(SLEEFXXX__SIZEOF_FLOAT128__) && SLEEFXXX__SIZEOF_FLOAT128__ == 16) || (defined(SLEEFXXX__linux__) && defined(SLEEFXXX__GNUC__) && (defined(SLEEFXXX__i386__) || defined(SLEEFXXX__x86_64__))) || (defined(SLEEFXXX__PPC64__) && defined(SLEEFXXX__GNUC__) && !defined(SLEEFXXX__clang__) && SLEEFXXX__GNUC__ >= 8))
+SLEEFSHARPdefine SLEEFXXXSLEEF_FLOAT128_IS_IEEEQP
+SLEEFSHARPendif
+
+SLEEFSHARPif !defined(SLEEFXXXSLEEF_FLOAT128_IS_IEEEQP) && !defined(SLEEFXXX__NVCC__) && defined(SLEEFXXX__SIZEOF_LONG_DOUBLE__) && SLEEFXXX__SIZEOF_LONG_DOUBLE__ == 16 && (defined(SLEEFXXX__aarch64__) || defined(SLEEFXXX__zarch__))
+SLEEFSHARPdefine SLEEFXXXSLEEF_LONGDOUBLE_IS_IEEEQP
+SLEEFSHARPendif
+
+SLEEFSHARPif !defined(SLEEFXXXSleef_quad_DEFINED)
+SLEEFSHARPdefine SLEEFXXXSleef_quad_DEFINED
+typedef struct { uint64_t x, y; } Sleef_uint64_2t;
+SLEEFSHARPif defined(SLEEFXXXSLEEF_FLOAT128_IS_IEEEQP)
+typedef __float128 Sleef_quad;
+SLEEFSHARPdefine SLEEFXXXSLEEF_QUAD_C(x) (x ## Q)
+SLEEFSHARPelif defined(SLEEFXXXSLEEF_LONGDOUBLE_IS_IEEEQP)
+typedef long double Sleef_quad;
+SLEEFSHARPdefine SLEEFXXXSLEEF_QUAD_C(x) (x ## L)
+SLEEFSHARPelse
+typedef Sleef_uint64_2t Sleef_quad;
+SLEEFSHARPendif
+SLEEFSHARPendif
+
+
+//   Copyright Naoki Shibata and contributors 2010 - 2021.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+//
+
+//
+
+/*
+  PI_A to PI_D are constants that satisfy the following two conditions.
+
+  * For PI_A, PI_B and PI_C, the last 28 bits are zero.
+  * PI_A + PI_B + PI_C + PI_D is close to PI as much as possible.
+
+  The argument of a trig function is multiplied by 1/PI, and the
+  integral part is divided into two parts, each has at most 28
+  bits. So, the maximum argument that could be correctly reduced
+  should be 2^(28*2-1) PI = 1.1e+17. However, due to internal
+  double precision calculation, the actual maximum argument that can
+  be correctly reduced is around 2^47.
+ */
+
+
+
+
+
+
+
+/*
+  PI_A2 and PI_B2 are constants that satisfy the following two conditions.
+
+  * The last 3 bits of PI_A2 are zero.
+  * PI_A2 + PI_B2 is close to PI as much as possible.
+
+  The argument of a trig function is multiplied by 1/PI, and the
+  integral part is multiplied by PI_A2. So, the maximum argument that
+  could be correctly reduced should be 2^(3-1) PI = 12.6. By testing,
+  we confirmed that it correctly reduces the argument up to around 15.
+ */
+
+//
+
+//
+
+//
+
+//
+
+
+
+
+
+
+
+
+
+
+
+extern const double Sleef_rempitabdp[];
+
+
+
+// Intel
+
+
+//   Copyright Naoki Shibata and contributors 2010 - 2021.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+//@#define ENABLE_DP
+
+//@#define LOG2VECTLENDP 1
+
+//@#define VECTLENDP (1 << LOG2VECTLENDP)
+
+//@#define ENABLE_FMA_DP
+
+
+//@#define ENABLE_SP
+
+//@#define LOG2VECTLENSP (LOG2VECTLENDP+1)
+
+//@#define VECTLENSP (1 << LOG2VECTLENSP)
+
+//@#define ENABLE_FMA_SP
+
+
+//@#define FULL_FP_ROUNDING
+
+//@#define ACCURATE_SQRT
+
+typedef __m128i vmask;
+typedef __m128i vopmask;
+
+typedef __m128d vdouble;
+typedef __m128i vint;
+
+typedef __m128 vfloat;
+typedef __m128i vint2;
+
+typedef __m128i vint64;
+typedef __m128i vuint64;
+
+typedef struct {
+  vmask x, y;
+} vquad;
+
+typedef vquad vargquad;
+
+//
+
+static SLEEF_ALWAYS_INLINE void vprefetch_v_p(const void *ptr) { _mm_prefetch(ptr, _MM_HINT_T0); }
+
+static SLEEF_ALWAYS_INLINE int vtestallones_i_vo32(vopmask g) { return _mm_movemask_epi8(g) == 0xFFFF; }
+static SLEEF_ALWAYS_INLINE int vtestallones_i_vo64(vopmask g) { return _mm_movemask_epi8(g) == 0xFFFF; }
+
+//
+
+static SLEEF_ALWAYS_INLINE vdouble vcast_vd_d(double d) { return _mm_set1_pd(d); }
+static SLEEF_ALWAYS_INLINE vmask vreinterpret_vm_vd(vdouble vd) { return _mm_castpd_si128(vd); }
+static SLEEF_ALWAYS_INLINE vdouble vreinterpret_vd_vm(vmask vm) { return _mm_castsi128_pd(vm); }
+
+//
+
+static vint2 vloadu_vi2_p(int32_t *p) { return _mm_loadu_si128((__m128i const *)p); }
+static void vstoreu_v_p_vi2(int32_t *p, vint2 v) { _mm_storeu_si128((__m128i *)p, v); }
+static vint vloadu_vi_p(int32_t *p) { return _mm_loadu_si128((__m128i *)p); }
+static void vstoreu_v_p_vi(int32_t *p, vint v) { _mm_storeu_si128((__m128i *)p, v); }
+
+//
+
+static SLEEF_ALWAYS_INLINE vmask vand_vm_vm_vm(vmask x, vmask y) { return vreinterpret_vm_vd(_mm_and_pd(vreinterpret_vd_vm(x), vreinterpret_vd_vm(y))); }
+static SLEEF_ALWAYS_INLINE vmask vandnot_vm_vm_vm(vmask x, vmask y) { return vreinterpret_vm_vd(_mm_andnot_pd(vreinterpret_vd_vm(x), vreinterpret_vd_vm(y))); }
+static SLEEF_ALWAYS_INLINE vmask vor_vm_vm_vm(vmask x, vmask y) { return vreinterpret_vm_vd(_mm_or_pd(vreinterpret_vd_vm(x), vreinterpret_vd_vm(y))); }
+static SLEEF_ALWAYS_INLINE vmask vxor_vm_vm_vm(vmask x, vmask y) { return vreinterpret_vm_vd(_mm_xor_pd(vreinterpret_vd_vm(x), vreinterpret_vd_vm(y))); }
+
+static SLEEF_ALWAYS_INLINE vopmask vand_vo_vo_vo(vopmask x, vopmask y) { return vreinterpret_vm_vd(_mm_and_pd(vreinterpret_vd_vm(x), vreinterpret_vd_vm(y))); }
+static SLEEF_ALWAYS_INLINE vopmask vandnot_vo_vo_vo(vopmask x, vopmask y) { return vreinterpret_vm_vd(_mm_andnot_pd(vreinterpret_vd_vm(x), vreinterpret_vd_vm(y))); }
+static SLEEF_ALWAYS_INLINE vopmask vor_vo_vo_vo(vopmask x, vopmask y) { return vreinterpret_vm_vd(_mm_or_pd(vreinterpret_vd_vm(x), vreinterpret_vd_vm(y))); }
+static SLEEF_ALWAYS_INLINE vopmask vxor_vo_vo_vo(vopmask x, vopmask y) { return vreinterpret_vm_vd(_mm_xor_pd(vreinterpret_vd_vm(x), vreinterpret_vd_vm(y))); }
+
+static SLEEF_ALWAYS_INLINE vmask vand_vm_vo64_vm(vopmask x, vmask y) { return vreinterpret_vm_vd(_mm_and_pd(vreinterpret_vd_vm(x), vreinterpret_vd_vm(y))); }
+static SLEEF_ALWAYS_INLINE vmask vandnot_vm_vo64_vm(vopmask x, vmask y) { return vreinterpret_vm_vd(_mm_andnot_pd(vreinterpret_vd_vm(x), vreinterpret_vd_vm(y))); }
+static SLEEF_ALWAYS_INLINE vmask vor_vm_vo64_vm(vopmask x, vmask y) { return vreinterpret_vm_vd(_mm_or_pd(vreinterpret_vd_vm(x), vreinterpret_vd_vm(y))); }
+static SLEEF_ALWAYS_INLINE vmask vxor_vm_vo64_vm(vopmask x, vmask y) { return vreinterpret_vm_vd(_mm_xor_pd(vreinterpret_vd_vm(x), vreinterpret_vd_vm(y))); }
+
+static SLEEF_ALWAYS_INLINE vmask vand_vm_vo32_vm(vopmask x, vmask y) { return vreinterpret_vm_vd(_mm_and_pd(vreinterpret_vd_vm(x), vreinterpret_vd_vm(y))); }
+static SLEEF_ALWAYS_INLINE vmask vandnot_vm_vo32_vm(vopmask x, vmask y) { return vreinterpret_vm_vd(_mm_andnot_pd(vreinterpret_vd_vm(x), vreinterpret_vd_vm(y))); }
+static SLEEF_ALWAYS_INLINE vmask vor_vm_vo32_vm(vopmask x, vmask y) { return vreinterpret_vm_vd(_mm_or_pd(vreinterpret_vd_vm(x), vreinterpret_vd_vm(y))); }
+static SLEEF_ALWAYS_INLINE vmask vxor_vm_vo32_vm(vopmask x, vmask y) { return vreinterpret_vm_vd(_mm_xor_pd(vreinterpret_vd_vm(x), vreinterpret_vd_vm(y))); }
+
+static SLEEF_ALWAYS_INLINE vopmask vcast_vo32_vo64(vopmask m) { return _mm_shuffle_epi32(m, 0x08); }
+static SLEEF_ALWAYS_INLINE vopmask vcast_vo64_vo32(vopmask m) { return _mm_shuffle_epi32(m, 0x50); }
+
+static SLEEF_ALWAYS_INLINE vopmask vcast_vo_i(int i) { return _mm_set1_epi64x(i ? -1 : 0); }
+
+//
+
+static SLEEF_ALWAYS_INLINE vint vrint_vi_vd(vdouble vd) { return _mm_cvtpd_epi32(vd); }
+static SLEEF_ALWAYS_INLINE vint vtruncate_vi_vd(vdouble vd) { return _mm_cvttpd_epi32(vd); }
+static SLEEF_ALWAYS_INLINE vdouble vrint_vd_vd(vdouble vd) { return _mm_round_pd(vd, _MM_FROUND_TO_NEAREST_INT |_MM_FROUND_NO_EXC); }
+static SLEEF_ALWAYS_INLINE vfloat vrint_vf_vf(vfloat vd) { return _mm_round_ps(vd, _MM_FROUND_TO_NEAREST_INT |_MM_FROUND_NO_EXC); }
+static SLEEF_ALWAYS_INLINE vdouble vtruncate_vd_vd(vdouble vd) { return _mm_round_pd(vd, _MM_FROUND_TO_ZERO |_MM_FROUND_NO_EXC); }
+static SLEEF_ALWAYS_INLINE vfloat vtruncate_vf_vf(vfloat vf) { return _mm_round_ps(vf, _MM_FROUND_TO_ZERO |_MM_FROUND_NO_EXC); }
+static SLEEF_ALWAYS_INLINE vdouble vcast_vd_vi(vint vi) { return _mm_cvtepi32_pd(vi); }
+static SLEEF_ALWAYS_INLINE vint vcast_vi_i(int i) { return _mm_set1_epi32(i); }
+
+static SLEEF_ALWAYS_INLINE vmask vcastu_vm_vi(vint vi) { return _mm_and_si128(_mm_shuffle_epi32(vi, 0x73), _mm_set_epi32(-1, 0, -1, 0)); }
+static SLEEF_ALWAYS_INLINE vint vcastu_vi_vm(vmask vi) { return _mm_shuffle_epi32(vi, 0x0d); }
+
+static SLEEF_ALWAYS_INLINE vmask vcast_vm_i_i(int i0, int i1) { return _mm_set_epi32(i0, i1, i0, i1); }
+
+static SLEEF_ALWAYS_INLINE vmask vcast_vm_i64(int64_t i) { return _mm_set1_epi64x(i); }
+static SLEEF_ALWAYS_INLINE vmask vcast_vm_u64(uint64_t i) { return _mm_set1_epi64x((uint64_t)i); }
+
+static SLEEF_ALWAYS_INLINE vopmask veq64_vo_vm_vm(vmask x, vmask y) { return _mm_cmpeq_epi64(x, y); }
+static SLEEF_ALWAYS_INLINE vmask vadd64_vm_vm_vm(vmask x, vmask y) { return _mm_add_epi64(x, y); }
+
+//
+
+static SLEEF_ALWAYS_INLINE vdouble vadd_vd_vd_vd(vdouble x, vdouble y) { return _mm_add_pd(x, y); }
+static SLEEF_ALWAYS_INLINE vdouble vsub_vd_vd_vd(vdouble x, vdouble y) { return _mm_sub_pd(x, y); }
+static SLEEF_ALWAYS_INLINE vdouble vmul_vd_vd_vd(vdouble x, vdouble y) { return _mm_mul_pd(x, y); }
+static SLEEF_ALWAYS_INLINE vdouble vdiv_vd_vd_vd(vdouble x, vdouble y) { return _mm_div_pd(x, y); }
+static SLEEF_ALWAYS_INLINE vdouble vrec_vd_vd(vdouble x) { return _mm_div_pd(_mm_set1_pd(1), x); }
+static SLEEF_ALWAYS_INLINE vdouble vsqrt_vd_vd(vdouble x) { return _mm_sqrt_pd(x); }
+static SLEEF_ALWAYS_INLINE vdouble vabs_vd_vd(vdouble d) { return _mm_andnot_pd(_mm_set1_pd(-0.0), d); }
+static SLEEF_ALWAYS_INLINE vdouble vneg_vd_vd(vdouble d) { return _mm_xor_pd(_mm_set1_pd(-0.0), d); }
+static SLEEF_ALWAYS_INLINE vdouble vmla_vd_vd_vd_vd(vdouble x, vdouble y, vdouble z) { return _mm_fmadd_pd(x, y, z); }
+static SLEEF_ALWAYS_INLINE vdouble vmlapn_vd_vd_vd_vd(vdouble x, vdouble y, vdouble z) { return _mm_fmsub_pd(x, y, z); }
+static SLEEF_ALWAYS_INLINE vdouble vmlanp_vd_vd_vd_vd(vdouble x, vdouble y, vdouble z) { return _mm_fnmadd_pd(x, y, z); }
+static SLEEF_ALWAYS_INLINE vdouble vmax_vd_vd_vd(vdouble x, vdouble y) { return _mm_max_pd(x, y); }
+static SLEEF_ALWAYS_INLINE vdouble vmin_vd_vd_vd(vdouble x, vdouble y) { return _mm_min_pd(x, y); }
+
+static SLEEF_ALWAYS_INLINE vdouble vfma_vd_vd_vd_vd(vdouble x, vdouble y, vdouble z) { return _mm_fmadd_pd(x, y, z); }
+static SLEEF_ALWAYS_INLINE vdouble vfmapp_vd_vd_vd_vd(vdouble x, vdouble y, vdouble z) { return _mm_fmadd_pd(x, y, z); }
+static SLEEF_ALWAYS_INLINE vdouble vfmapn_vd_vd_vd_vd(vdouble x, vdouble y, vdouble z) { return _mm_fmsub_pd(x, y, z); }
+static SLEEF_ALWAYS_INLINE vdouble vfmanp_vd_vd_vd_vd(vdouble x, vdouble y, vdouble z) { return _mm_fnmadd_pd(x, y, z); }
+static SLEEF_ALWAYS_INLINE vdouble vfmann_vd_vd_vd_vd(vdouble x, vdouble y, vdouble z) { return _mm_fnmsub_pd(x, y, z); }
+
+static SLEEF_ALWAYS_INLINE vopmask veq_vo_vd_vd(vdouble x, vdouble y) { return vreinterpret_vm_vd(_mm_cmp_pd(x, y, _CMP_EQ_OQ)); }
+static SLEEF_ALWAYS_INLINE vopmask vneq_vo_vd_vd(vdouble x, vdouble y) { return vreinterpret_vm_vd(_mm_cmp_pd(x, y, _CMP_NEQ_UQ)); }
+static SLEEF_ALWAYS_INLINE vopmask vlt_vo_vd_vd(vdouble x, vdouble y) { return vreinterpret_vm_vd(_mm_cmp_pd(x, y, _CMP_LT_OQ)); }
+static SLEEF_ALWAYS_INLINE vopmask vle_vo_vd_vd(vdouble x, vdouble y) { return vreinterpret_vm_vd(_mm_cmp_pd(x, y, _CMP_LE_OQ)); }
+static SLEEF_ALWAYS_INLINE vopmask vgt_vo_vd_vd(vdouble x, vdouble y) { return vreinterpret_vm_vd(_mm_cmp_pd(x, y, _CMP_GT_OQ)); }
+static SLEEF_ALWAYS_INLINE vopmask vge_vo_vd_vd(vdouble x, vdouble y) { return vreinterpret_vm_vd(_mm_cmp_pd(x, y, _CMP_GE_OQ)); }
+
+//
+
+static SLEEF_ALWAYS_INLINE vint vadd_vi_vi_vi(vint x, vint y) { return _mm_add_epi32(x, y); }
+static SLEEF_ALWAYS_INLINE vint vsub_vi_vi_vi(vint x, vint y) { return _mm_sub_epi32(x, y); }
+static SLEEF_ALWAYS_INLINE vint vneg_vi_vi(vint e) { return vsub_vi_vi_vi(vcast_vi_i(0), e); }
+
+static SLEEF_ALWAYS_INLINE vint vand_vi_vi_vi(vint x, vint y) { return _mm_and_si128(x, y); }
+static SLEEF_ALWAYS_INLINE vint vandnot_vi_vi_vi(vint x, vint y) { return _mm_andnot_si128(x, y); }
+static SLEEF_ALWAYS_INLINE vint vor_vi_vi_vi(vint x, vint y) { return _mm_or_si128(x, y); }
+static SLEEF_ALWAYS_INLINE vint vxor_vi_vi_vi(vint x, vint y) { return _mm_xor_si128(x, y); }
+
+static SLEEF_ALWAYS_INLINE vint vand_vi_vo_vi(vopmask x, vint y) { return _mm_and_si128(x, y); }
+static SLEEF_ALWAYS_INLINE vint vandnot_vi_vo_vi(vopmask x, vint y) { return _mm_andnot_si128(x, y); }
+
+static SLEEF_ALWAYS_INLINE vint vsll_vi_vi_i(vint x, int c) { return _mm_slli_epi32(x, c); }
+static SLEEF_ALWAYS_INLINE vint vsrl_vi_vi_i(vint x, int c) { return _mm_srli_epi32(x, c); }
+static SLEEF_ALWAYS_INLINE vint vsra_vi_vi_i(vint x, int c) { return _mm_srai_epi32(x, c); }
+
+static SLEEF_ALWAYS_INLINE vint veq_vi_vi_vi(vint x, vint y) { return _mm_cmpeq_epi32(x, y); }
+static SLEEF_ALWAYS_INLINE vint vgt_vi_vi_vi(vint x, vint y) { return _mm_cmpgt_epi32(x, y); }
+
+static SLEEF_ALWAYS_INLINE vopmask veq_vo_vi_vi(vint x, vint y) { return _mm_cmpeq_epi32(x, y); }
+static SLEEF_ALWAYS_INLINE vopmask vgt_vo_vi_vi(vint x, vint y) { return _mm_cmpgt_epi32(x, y); }
+
+static SLEEF_ALWAYS_INLINE vint vsel_vi_vo_vi_vi(vopmask m, vint x, vint y) { return _mm_blendv_epi8(y, x, m); }
+
+static SLEEF_ALWAYS_INLINE vdouble vsel_vd_vo_vd_vd(vopmask o, vdouble x, vdouble y) { return _mm_blendv_pd(y, x, _mm_castsi128_pd(o)); }
+
+static SLEEF_ALWAYS_INLINE SLEEF_CONST vdouble vsel_vd_vo_d_d(vopmask o, double v1, double v0) {
+  return vsel_vd_vo_vd_vd(o, vcast_vd_d(v1), vcast_vd_d(v0));
+}
+
+static SLEEF_ALWAYS_INLINE vdouble vsel_vd_vo_vo_d_d_d(vopmask o0, vopmask o1, double d0, double d1, double d2) {
+  return vsel_vd_vo_vd_vd(o0, vcast_vd_d(d0), vsel_vd_vo_d_d(o1, d1, d2));
+}
+
+static SLEEF_ALWAYS_INLINE vdouble vsel_vd_vo_vo_vo_d_d_d_d(vopmask o0, vopmask o1, vopmask o2, double d0, double d1, double d2, double d3) {
+  return vsel_vd_vo_vd_vd(o0, vcast_vd_d(d0), vsel_vd_vo_vd_vd(o1, vcast_vd_d(d1), vsel_vd_vo_d_d(o2, d2, d3)));
+}
+
+static SLEEF_ALWAYS_INLINE vopmask visinf_vo_vd(vdouble d) {
+  return vreinterpret_vm_vd(_mm_cmp_pd(vabs_vd_vd(d), _mm_set1_pd(__builtin_inf()), _CMP_EQ_OQ));
+}
+
+static SLEEF_ALWAYS_INLINE vopmask vispinf_vo_vd(vdouble d) {
+  return vreinterpret_vm_vd(_mm_cmp_pd(d, _mm_set1_pd(__builtin_inf()), _CMP_EQ_OQ));
+}
+
+static SLEEF_ALWAYS_INLINE vopmask visminf_vo_vd(vdouble d) {
+  return vreinterpret_vm_vd(_mm_cmp_pd(d, _mm_set1_pd(-__builtin_inf()), _CMP_EQ_OQ));
+}
+
+static SLEEF_ALWAYS_INLINE vopmask visnan_vo_vd(vdouble d) {
+  return vreinterpret_vm_vd(_mm_cmp_pd(d, d, _CMP_NEQ_UQ));
+}
+
+static SLEEF_ALWAYS_INLINE vdouble vload_vd_p(const double *ptr) { return _mm_load_pd(ptr); }
+static SLEEF_ALWAYS_INLINE vdouble vloadu_vd_p(const double *ptr) { return _mm_loadu_pd(ptr); }
+
+static SLEEF_ALWAYS_INLINE void vstore_v_p_vd(double *ptr, vdouble v) { _mm_store_pd(ptr, v); }
+static SLEEF_ALWAYS_INLINE void vstoreu_v_p_vd(double *ptr, vdouble v) { _mm_storeu_pd(ptr, v); }
+
+static SLEEF_ALWAYS_INLINE vdouble vgather_vd_p_vi(const double *ptr, vint vi) { return _mm_i32gather_pd(ptr, vi, 8); }
+
+//
+
+static SLEEF_ALWAYS_INLINE vint2 vcast_vi2_vm(vmask vm) { return vm; }
+static SLEEF_ALWAYS_INLINE vmask vcast_vm_vi2(vint2 vi) { return vi; }
+
+static SLEEF_ALWAYS_INLINE vint2 vrint_vi2_vf(vfloat vf) { return vcast_vi2_vm(_mm_cvtps_epi32(vf)); }
+static SLEEF_ALWAYS_INLINE vint2 vtruncate_vi2_vf(vfloat vf) { return vcast_vi2_vm(_mm_cvttps_epi32(vf)); }
+static SLEEF_ALWAYS_INLINE vfloat vcast_vf_vi2(vint2 vi) { return _mm_cvtepi32_ps(vcast_vm_vi2(vi)); }
+static SLEEF_ALWAYS_INLINE vfloat vcast_vf_f(float f) { return _mm_set1_ps(f); }
+static SLEEF_ALWAYS_INLINE vint2 vcast_vi2_i(int i) { return _mm_set1_epi32(i); }
+static SLEEF_ALWAYS_INLINE vmask vreinterpret_vm_vf(vfloat vf) { return _mm_castps_si128(vf); }
+static SLEEF_ALWAYS_INLINE vfloat vreinterpret_vf_vm(vmask vm) { return _mm_castsi128_ps(vm); }
+
+static SLEEF_ALWAYS_INLINE vfloat vreinterpret_vf_vi2(vint2 vi) { return vreinterpret_vf_vm(vcast_vm_vi2(vi)); }
+static SLEEF_ALWAYS_INLINE vint2 vreinterpret_vi2_vf(vfloat vf) { return vcast_vi2_vm(vreinterpret_vm_vf(vf)); }
+
+static SLEEF_ALWAYS_INLINE vfloat vadd_vf_vf_vf(vfloat x, vfloat y) { return _mm_add_ps(x, y); }
+static SLEEF_ALWAYS_INLINE vfloat vsub_vf_vf_vf(vfloat x, vfloat y) { return _mm_sub_ps(x, y); }
+static SLEEF_ALWAYS_INLINE vfloat vmul_vf_vf_vf(vfloat x, vfloat y) { return _mm_mul_ps(x, y); }
+static SLEEF_ALWAYS_INLINE vfloat vdiv_vf_vf_vf(vfloat x, vfloat y) { return _mm_div_ps(x, y); }
+static SLEEF_ALWAYS_INLINE vfloat vrec_vf_vf(vfloat x) { return vdiv_vf_vf_vf(vcast_vf_f(1.0f), x); }
+static SLEEF_ALWAYS_INLINE vfloat vsqrt_vf_vf(vfloat x) { return _mm_sqrt_ps(x); }
+static SLEEF_ALWAYS_INLINE vfloat vabs_vf_vf(vfloat f) { return vreinterpret_vf_vm(vandnot_vm_vm_vm(vreinterpret_vm_vf(vcast_vf_f(-0.0f)), vreinterpret_vm_vf(f))); }
+static SLEEF_ALWAYS_INLINE vfloat vneg_vf_vf(vfloat d) { return vreinterpret_vf_vm(vxor_vm_vm_vm(vreinterpret_vm_vf(vcast_vf_f(-0.0f)), vreinterpret_vm_vf(d))); }
+static SLEEF_ALWAYS_INLINE vfloat vmla_vf_vf_vf_vf(vfloat x, vfloat y, vfloat z) { return _mm_fmadd_ps(x, y, z); }
+static SLEEF_ALWAYS_INLINE vfloat vmlapn_vf_vf_vf_vf(vfloat x, vfloat y, vfloat z) { return _mm_fmsub_ps(x, y, z); }
+static SLEEF_ALWAYS_INLINE vfloat vmlanp_vf_vf_vf_vf(vfloat x, vfloat y, vfloat z) { return _mm_fnmadd_ps(x, y, z); }
+static SLEEF_ALWAYS_INLINE vfloat vmax_vf_vf_vf(vfloat x, vfloat y) { return _mm_max_ps(x, y); }
+static SLEEF_ALWAYS_INLINE vfloat vmin_vf_vf_vf(vfloat x, vfloat y) { return _mm_min_ps(x, y); }
+
+static SLEEF_ALWAYS_INLINE vfloat vfma_vf_vf_vf_vf(vfloat x, vfloat y, vfloat z) { return _mm_fmadd_ps(x, y, z); }
+static SLEEF_ALWAYS_INLINE vfloat vfmapp_vf_vf_vf_vf(vfloat x, vfloat y, vfloat z) { return _mm_fmadd_ps(x, y, z); }
+static SLEEF_ALWAYS_INLINE vfloat vfmapn_vf_vf_vf_vf(vfloat x, vfloat y, vfloat z) { return _mm_fmsub_ps(x, y, z); }
+static SLEEF_ALWAYS_INLINE vfloat vfmanp_vf_vf_vf_vf(vfloat x, vfloat y, vfloat z) { return _mm_fnmadd_ps(x, y, z); }
+static SLEEF_ALWAYS_INLINE vfloat vfmann_vf_vf_vf_vf(vfloat x, vfloat y, vfloat z) { return _mm_fnmsub_ps(x, y, z); }
+
+static SLEEF_ALWAYS_INLINE vopmask veq_vo_vf_vf(vfloat x, vfloat y) { return vreinterpret_vm_vf(_mm_cmp_ps(x, y, _CMP_EQ_OQ)); }
+static SLEEF_ALWAYS_INLINE vopmask vneq_vo_vf_vf(vfloat x, vfloat y) { return vreinterpret_vm_vf(_mm_cmp_ps(x, y, _CMP_NEQ_UQ)); }
+static SLEEF_ALWAYS_INLINE vopmask vlt_vo_vf_vf(vfloat x, vfloat y) { return vreinterpret_vm_vf(_mm_cmp_ps(x, y, _CMP_LT_OQ)); }
+static SLEEF_ALWAYS_INLINE vopmask vle_vo_vf_vf(vfloat x, vfloat y) { return vreinterpret_vm_vf(_mm_cmp_ps(x, y, _CMP_LE_OQ)); }
+static SLEEF_ALWAYS_INLINE vopmask vgt_vo_vf_vf(vfloat x, vfloat y) { return vreinterpret_vm_vf(_mm_cmp_ps(x, y, _CMP_GT_OQ)); }
+static SLEEF_ALWAYS_INLINE vopmask vge_vo_vf_vf(vfloat x, vfloat y) { return vreinterpret_vm_vf(_mm_cmp_ps(x, y, _CMP_GE_OQ)); }
+
+static SLEEF_ALWAYS_INLINE vint2 vadd_vi2_vi2_vi2(vint2 x, vint2 y) { return _mm_add_epi32(x, y); }
+static SLEEF_ALWAYS_INLINE vint2 vsub_vi2_vi2_vi2(vint2 x, vint2 y) { return _mm_sub_epi32(x, y); }
+static SLEEF_ALWAYS_INLINE vint2 vneg_vi2_vi2(vint2 e) { return vsub_vi2_vi2_vi2(vcast_vi2_i(0), e); }
+
+static SLEEF_ALWAYS_INLINE vint2 vand_vi2_vi2_vi2(vint2 x, vint2 y) { return _mm_and_si128(x, y); }
+static SLEEF_ALWAYS_INLINE vint2 vandnot_vi2_vi2_vi2(vint2 x, vint2 y) { return _mm_andnot_si128(x, y); }
+static SLEEF_ALWAYS_INLINE vint2 vor_vi2_vi2_vi2(vint2 x, vint2 y) { return _mm_or_si128(x, y); }
+static SLEEF_ALWAYS_INLINE vint2 vxor_vi2_vi2_vi2(vint2 x, vint2 y) { return _mm_xor_si128(x, y); }
+
+static SLEEF_ALWAYS_INLINE vint2 vand_vi2_vo_vi2(vopmask x, vint2 y) { return vand_vi2_vi2_vi2(vcast_vi2_vm(x), y); }
+static SLEEF_ALWAYS_INLINE vint2 vandnot_vi2_vo_vi2(vopmask x, vint2 y) { return vandnot_vi2_vi2_vi2(vcast_vi2_vm(x), y); }
+
+static SLEEF_ALWAYS_INLINE vint2 vsll_vi2_vi2_i(vint2 x, int c) { return _mm_slli_epi32(x, c); }
+static SLEEF_ALWAYS_INLINE vint2 vsrl_vi2_vi2_i(vint2 x, int c) { return _mm_srli_epi32(x, c); }
+static SLEEF_ALWAYS_INLINE vint2 vsra_vi2_vi2_i(vint2 x, int c) { return _mm_srai_epi32(x, c); }
+
+static SLEEF_ALWAYS_INLINE vopmask veq_vo_vi2_vi2(vint2 x, vint2 y) { return _mm_cmpeq_epi32(x, y); }
+static SLEEF_ALWAYS_INLINE vopmask vgt_vo_vi2_vi2(vint2 x, vint2 y) { return _mm_cmpgt_epi32(x, y); }
+static SLEEF_ALWAYS_INLINE vint2 veq_vi2_vi2_vi2(vint2 x, vint2 y) { return _mm_cmpeq_epi32(x, y); }
+static SLEEF_ALWAYS_INLINE vint2 vgt_vi2_vi2_vi2(vint2 x, vint2 y) { return _mm_cmpgt_epi32(x, y); }
+
+static SLEEF_ALWAYS_INLINE vint2 vsel_vi2_vo_vi2_vi2(vopmask m, vint2 x, vint2 y) {
+  return _mm_blendv_epi8(y, x, m);
+}
+
+static SLEEF_ALWAYS_INLINE vfloat vsel_vf_vo_vf_vf(vopmask o, vfloat x, vfloat y) { return _mm_blendv_ps(y, x, _mm_castsi128_ps(o)); }
+
+static SLEEF_ALWAYS_INLINE SLEEF_CONST vfloat vsel_vf_vo_f_f(vopmask o, float v1, float v0) {
+  return vsel_vf_vo_vf_vf(o, vcast_vf_f(v1), vcast_vf_f(v0));
+}
+
+static SLEEF_ALWAYS_INLINE vfloat vsel_vf_vo_vo_f_f_f(vopmask o0, vopmask o1, float d0, float d1, float d2) {
+  return vsel_vf_vo_vf_vf(o0, vcast_vf_f(d0), vsel_vf_vo_f_f(o1, d1, d2));
+}
+
+static SLEEF_ALWAYS_INLINE vfloat vsel_vf_vo_vo_vo_f_f_f_f(vopmask o0, vopmask o1, vopmask o2, float d0, float d1, float d2, float d3) {
+  return vsel_vf_vo_vf_vf(o0, vcast_vf_f(d0), vsel_vf_vo_vf_vf(o1, vcast_vf_f(d1), vsel_vf_vo_f_f(o2, d2, d3)));
+}
+
+static SLEEF_ALWAYS_INLINE vopmask visinf_vo_vf(vfloat d) { return veq_vo_vf_vf(vabs_vf_vf(d), vcast_vf_f(__builtin_inff())); }
+static SLEEF_ALWAYS_INLINE vopmask vispinf_vo_vf(vfloat d) { return veq_vo_vf_vf(d, vcast_vf_f(__builtin_inff())); }
+static SLEEF_ALWAYS_INLINE vopmask visminf_vo_vf(vfloat d) { return veq_vo_vf_vf(d, vcast_vf_f(-__builtin_inff())); }
+static SLEEF_ALWAYS_INLINE vopmask visnan_vo_vf(vfloat d) { return vneq_vo_vf_vf(d, d); }
+
+static SLEEF_ALWAYS_INLINE vfloat vload_vf_p(const float *ptr) { return _mm_load_ps(ptr); }
+static SLEEF_ALWAYS_INLINE vfloat vloadu_vf_p(const float *ptr) { return _mm_loadu_ps(ptr); }
+
+static SLEEF_ALWAYS_INLINE void vstore_v_p_vf(float *ptr, vfloat v) { _mm_store_ps(ptr, v); }
+static SLEEF_ALWAYS_INLINE void vstoreu_v_p_vf(float *ptr, vfloat v) { _mm_storeu_ps(ptr, v); }
+
+static SLEEF_ALWAYS_INLINE vfloat vgather_vf_p_vi2(const float *ptr, vint2 vi2) { return _mm_i32gather_ps(ptr, vi2, 4); }
+
+//
+
+//
+
+
+
+
+
+
+static SLEEF_ALWAYS_INLINE vdouble vposneg_vd_vd(vdouble d) { return vreinterpret_vd_vm(vxor_vm_vm_vm(vreinterpret_vm_vd(d), vreinterpret_vm_vd(((vdouble) { +0.0, -0.0 })))); }
+static SLEEF_ALWAYS_INLINE vdouble vnegpos_vd_vd(vdouble d) { return vreinterpret_vd_vm(vxor_vm_vm_vm(vreinterpret_vm_vd(d), vreinterpret_vm_vd(((vdouble) { -0.0, +0.0 })))); }
+static SLEEF_ALWAYS_INLINE vfloat vposneg_vf_vf(vfloat d) { return vreinterpret_vf_vm(vxor_vm_vm_vm(vreinterpret_vm_vf(d), vreinterpret_vm_vf(((vfloat) { +0.0f, -0.0f, +0.0f, -0.0f })))); }
+static SLEEF_ALWAYS_INLINE vfloat vnegpos_vf_vf(vfloat d) { return vreinterpret_vf_vm(vxor_vm_vm_vm(vreinterpret_vm_vf(d), vreinterpret_vm_vf(((vfloat) { -0.0f, +0.0f, -0.0f, +0.0f })))); }
+
+static SLEEF_ALWAYS_INLINE vdouble vsubadd_vd_vd_vd(vdouble x, vdouble y) { return _mm_addsub_pd(x, y); }
+static SLEEF_ALWAYS_INLINE vfloat vsubadd_vf_vf_vf(vfloat x, vfloat y) { return _mm_addsub_ps(x, y); }
+
+static SLEEF_ALWAYS_INLINE vdouble vmlsubadd_vd_vd_vd_vd(vdouble x, vdouble y, vdouble z) { return vmla_vd_vd_vd_vd(x, y, vnegpos_vd_vd(z)); }
+static SLEEF_ALWAYS_INLINE vfloat vmlsubadd_vf_vf_vf_vf(vfloat x, vfloat y, vfloat z) { return vmla_vf_vf_vf_vf(x, y, vnegpos_vf_vf(z)); }
+
+static SLEEF_ALWAYS_INLINE vdouble vrev21_vd_vd(vdouble d0) { return _mm_shuffle_pd(d0, d0, 1); }
+static SLEEF_ALWAYS_INLINE vdouble vreva2_vd_vd(vdouble vd) { return vd; }
+
+static SLEEF_ALWAYS_INLINE void vstream_v_p_vd(double *ptr, vdouble v) { _mm_stream_pd(ptr, v); }
+static SLEEF_ALWAYS_INLINE void vscatter2_v_p_i_i_vd(double *ptr, int offset, int step, vdouble v) { vstore_v_p_vd((double *)(&ptr[2*offset]), v); }
+static SLEEF_ALWAYS_INLINE void vsscatter2_v_p_i_i_vd(double *ptr, int offset, int step, vdouble v) { _mm_stream_pd((double *)(&ptr[2*offset]), v); }
+
+//
+
+static SLEEF_ALWAYS_INLINE vfloat vrev21_vf_vf(vfloat d0) { return _mm_shuffle_ps(d0, d0, (2 << 6) | (3 << 4) | (0 << 2) | (1 << 0)); }
+static SLEEF_ALWAYS_INLINE vfloat vreva2_vf_vf(vfloat d0) { return _mm_shuffle_ps(d0, d0, (1 << 6) | (0 << 4) | (3 << 2) | (2 << 0)); }
+
+static SLEEF_ALWAYS_INLINE void vstream_v_p_vf(float *ptr, vfloat v) { _mm_stream_ps(ptr, v); }
+
+static SLEEF_ALWAYS_INLINE void vscatter2_v_p_i_i_vf(float *ptr, int offset, int step, vfloat v) {
+  _mm_storel_pd((double *)(ptr+(offset + step * 0)*2), vreinterpret_vd_vm(vreinterpret_vm_vf(v)));
+  _mm_storeh_pd((double *)(ptr+(offset + step * 1)*2), vreinterpret_vd_vm(vreinterpret_vm_vf(v)));
+}
+
+static SLEEF_ALWAYS_INLINE void vsscatter2_v_p_i_i_vf(float *ptr, int offset, int step, vfloat v) {
+  _mm_storel_pd((double *)(ptr+(offset + step * 0)*2), vreinterpret_vd_vm(vreinterpret_vm_vf(v)));
+  _mm_storeh_pd((double *)(ptr+(offset + step * 1)*2), vreinterpret_vd_vm(vreinterpret_vm_vf(v)));
+}
+
+//
+
+static vquad loadu_vq_p(void *p) {
+  vquad vq = {
+    vloadu_vi2_p((int32_t *)p),
+    vloadu_vi2_p((int32_t *)((uint8_t *)p + sizeof(vmask)))
+  };
+  return vq;
+}
+
+static SLEEF_ALWAYS_INLINE vquad cast_vq_aq(vargquad aq) {
+  vquad vq;
+  memcpy(&vq, &aq, (1 << 1) * 16);
+  return vq;
+}
+
+static SLEEF_ALWAYS_INLINE vargquad cast_aq_vq(vquad vq) {
+  vargquad aq;
+  memcpy(&aq, &vq, (1 << 1) * 16);
+  return aq;
+}
+
+static void vstoreu_v_p_vq(void *p, vquad vq) {
+  vstoreu_v_p_vi2((int32_t *)p, vcast_vi2_vm(vq.x));
+  vstoreu_v_p_vi2((int32_t *)((uint8_t *)p + sizeof(vmask)), vcast_vi2_vm(vq.y));
+}
+
+static SLEEF_ALWAYS_INLINE int vtestallzeros_i_vo64(vopmask g) { return _mm_movemask_epi8(g) == 0; }
+
+static SLEEF_ALWAYS_INLINE vmask vsel_vm_vo64_vm_vm(vopmask o, vmask x, vmask y) { return _mm_blendv_epi8(y, x, o); }
+
+static SLEEF_ALWAYS_INLINE vmask vsub64_vm_vm_vm(vmask x, vmask y) { return _mm_sub_epi64(x, y); }
+static SLEEF_ALWAYS_INLINE vmask vneg64_vm_vm(vmask x) { return _mm_sub_epi64(vcast_vm_i_i(0, 0), x); }
+static SLEEF_ALWAYS_INLINE vopmask vgt64_vo_vm_vm(vmask x, vmask y) { return _mm_cmpgt_epi64(x, y); } // signed compare
+
+
+
+//@#define vsll64_vm_vm_i(x, c) _mm_slli_epi64(x, c)
+//@#define vsrl64_vm_vm_i(x, c) _mm_srli_epi64(x, c)
+
+static SLEEF_ALWAYS_INLINE vmask vcast_vm_vi(vint vi) {
+  vmask m = _mm_and_si128(_mm_shuffle_epi32(vi, (0 << 6) | (1 << 4) | (0 << 2) | (0 << 0)), _mm_set_epi32(0, -1, 0, -1));
+  return vor_vm_vm_vm(vcastu_vm_vi(vgt_vo_vi_vi(vcast_vi_i(0), vi)), m);
+}
+static SLEEF_ALWAYS_INLINE vint vcast_vi_vm(vmask vm) { return _mm_shuffle_epi32(vm, 0x08); }
+
+static SLEEF_ALWAYS_INLINE vmask vreinterpret_vm_vi64(vint64 v) { return v; }
+static SLEEF_ALWAYS_INLINE vint64 vreinterpret_vi64_vm(vmask m) { return m; }
+static SLEEF_ALWAYS_INLINE vmask vreinterpret_vm_vu64(vuint64 v) { return v; }
+static SLEEF_ALWAYS_INLINE vuint64 vreinterpret_vu64_vm(vmask m) { return m; }
+
+
+
+
+
+// Arm
+
+// IBM
+
+// Generic
+
+//
+
+
+
+
+//   Copyright Naoki Shibata and contributors 2010 - 2021.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+// These are macros for evaluating polynomials using Estrin's method
+
+
+//
+
+
+//   Copyright Naoki Shibata and contributors 2010 - 2021.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+
+
+typedef struct {
+  vdouble x, y;
+} vdouble2;
+
+
+
+
+static SLEEF_ALWAYS_INLINE SLEEF_CONST vdouble vd2getx_vd_vd2(vdouble2 v) { return v.x; }
+static SLEEF_ALWAYS_INLINE SLEEF_CONST vdouble vd2gety_vd_vd2(vdouble2 v) { return v.y; }
+static SLEEF_ALWAYS_INLINE SLEEF_CONST vdouble2 vd2setxy_vd2_vd_vd(vdouble x, vdouble y) { vdouble2 v; v.x = x; v.y = y; return v; }
+static SLEEF_ALWAYS_INLINE SLEEF_CONST vdouble2 vd2setx_vd2_vd2_vd(vdouble2 v, vdouble d) { v.x = d; return v; }
+static SLEEF_ALWAYS_INLINE SLEEF_CONST vdouble2 vd2sety_vd2_vd2_vd(vdouble2 v, vdouble d) { v.y = d; return v; }
+
+
+
+typedef struct {
+  double x, y;
+} double2;
+
+
+static SLEEF_ALWAYS_INLINE SLEEF_CONST double2 dd(double h, double l) {
+  double2 ret = { h, l };
+  return ret;
+}
+
+static SLEEF_ALWAYS_INLINE SLEEF_CONST vdouble vupper_vd_vd(vdouble d) {
+  return vreinterpret_vd_vm(vand_vm_vm_vm(vreinterpret_vm_vd(d), vcast_vm_i_i(0xffffffff, 0xf8000000)));
+}
+
+static SLEEF_ALWAYS_INLINE SLEEF_CONST vdouble2 vcast_vd2_vd_vd(vdouble h, vdouble l) {
+  return vd2setxy_vd2_vd_vd(h, l);
+}
+
+static SLEEF_ALWAYS_INLINE SLEEF_CONST vdouble2 vcast_vd2_d_d(double h, double l) {
+  return vd2setxy_vd2_vd_vd(vcast_vd_d(h), vcast_vd_d(l));
+}
+
+static SLEEF_ALWAYS_INLINE SLEEF_CONST vdouble2 vcast_vd2_d2(double2 dd) {
+  return vd2setxy_vd2_vd_vd(vcast_vd_d(dd.x), vcast_vd_d(dd.y));
+}
+
+static SLEEF_ALWAYS_INLINE SLEEF_CONST vdouble2 vsel_vd2_vo_vd2_vd2(vopmask m, vdouble2 x, vdouble2 y) {
+  return vd2setxy_vd2_vd_vd(vsel_vd_vo_vd_vd(m, vd2getx_vd_vd2(x), vd2getx_vd_vd2(y)),
+       vsel_vd_vo_vd_vd(m, vd2gety_vd_vd2(x), vd2gety_vd_vd2(y)));
+}
+
+static SLEEF_ALWAYS_INLINE SLEEF_CONST vdouble2 vsel_vd2_vo_d_d_d_d(vopmask o, double x1, double y1, double x0, double y0) {
+  return vd2setxy_vd2_vd_vd(vsel_vd_vo_d_d(o, x1, x0),
+       vsel_vd_vo_d_d(o, y1, y0));
+}
+
+static SLEEF_ALWAYS_INLINE SLEEF_CONST vdouble vadd_vd_3vd(vdouble v0, vdouble v1, vdouble v2) {
+  return vadd_vd_vd_vd(vadd_vd_vd_vd(v0, v1), v2);
+}
+
+static SLEEF_ALWAYS_INLINE SLEEF_CONST vdouble vadd_vd_4vd(vdouble v0, vdouble v1, vdouble v2, vdouble v3) {
+  return vadd_vd_3vd(vadd_vd_vd_vd(v0, v1), v2, v3);
+}
+
+static SLEEF_ALWAYS_INLINE SLEEF_CONST vdouble vadd_vd_5vd(vdouble v0, vdouble v1, vdouble v2, vdouble v3, vdouble v4) {
+  return vadd_vd_4vd(vadd_vd_vd_vd(v0, v1), v2, v3, v4);
+}
+
+static SLEEF_ALWAYS_INLINE SLEEF_CONST vdouble vadd_vd_6vd(vdouble v0, vdouble v1, vdouble v2, vdouble v3, vdouble v4, vdouble v5) {
+  return vadd_vd_5vd(vadd_vd_vd_vd(v0, v1), v2, v3, v4, v5);
+}
+
+static SLEEF_ALWAYS_INLINE SLEEF_CONST vdouble vadd_vd_7vd(vdouble v0, vdouble v1, vdouble v2, vdouble v3, vdouble v4, vdouble v5, vdouble v6) {
+  return vadd_vd_6vd(vadd_vd_vd_vd(v0, v1), v2, v3, v4, v5, v6);
+}
+
+static SLEEF_ALWAYS_INLINE SLEEF_CONST vdouble vsub_vd_3vd(vdouble v0, vdouble v1, vdouble v2) {
+  return vsub_vd_vd_vd(vsub_vd_vd_vd(v0, v1), v2);
+}
+
+static SLEEF_ALWAYS_INLINE SLEEF_CONST vdouble vsub_vd_4vd(vdouble v0, vdouble v1, vdouble v2, vdouble v3) {
+  return vsub_vd_3vd(vsub_vd_vd_vd(v0, v1), v2, v3);
+}
+
+static SLEEF_ALWAYS_INLINE SLEEF_CONST vdouble vsub_vd_5vd(vdouble v0, vdouble v1, vdouble v2, vdouble v3, vdouble v4) {
+  return vsub_vd_4vd(vsub_vd_vd_vd(v0, v1), v2, v3, v4);
+}
+
+static SLEEF_ALWAYS_INLINE SLEEF_CONST vdouble vsub_vd_6vd(vdouble v0, vdouble v1, vdouble v2, vdouble v3, vdouble v4, vdouble v5) {
+  return vsub_vd_5vd(vsub_vd_vd_vd(v0, v1), v2, v3, v4, v5);
+}
+
+//
+
+static SLEEF_ALWAYS_INLINE SLEEF_CONST vdouble2 ddneg_vd2_vd2(vdouble2 x) {
+  return vcast_vd2_vd_vd(vneg_vd_vd(vd2getx_vd_vd2(x)), vneg_vd_vd(vd2gety_vd_vd2(x)));
+}
+
+static SLEEF_ALWAYS_INLINE SLEEF_CONST vdouble2 ddabs_vd2_vd2(vdouble2 x) {
+  return vcast_vd2_vd_vd(vabs_vd_vd(vd2getx_vd_vd2(x)),
+    vreinterpret_vd_vm(vxor_vm_vm_vm(vreinterpret_vm_vd(vd2gety_vd_vd2(x)),
+         vand_vm_vm_vm(vreinterpret_vm_vd(vd2getx_vd_vd2(x)),
+         vreinterpret_vm_vd(vcast_vd_d(-0.0))))));
+}
+
+static SLEEF_ALWAYS_INLINE SLEEF_CONST vdouble2 ddnormalize_vd2_vd2(vdouble2 t) {
+  vdouble s = vadd_vd_vd_vd(vd2getx_vd_vd2(t), vd2gety_vd_vd2(t));
+  return vd2setxy_vd2_vd_vd(s, vadd_vd_vd_vd(vsub_vd_vd_vd(vd2getx_vd_vd2(t), s), vd2gety_vd_vd2(t)));
+}
+
+static SLEEF_ALWAYS_INLINE SLEEF_CONST vdouble2 ddscale_vd2_vd2_vd(vdouble2 d, vdouble s) {
+  return vd2setxy_vd2_vd_vd(vmul_vd_vd_vd(vd2getx_vd_vd2(d), s), vmul_vd_vd_vd(vd2gety_vd_vd2(d), s));
+}
+
+static SLEEF_ALWAYS_INLINE SLEEF_CONST vdouble2 ddscale_vd2_vd2_d(vdouble2 d, double s) { return ddscale_vd2_vd2_vd(d, vcast_vd_d(s)); }
+
+static SLEEF_ALWAYS_INLINE SLEEF_CONST vdouble2 ddadd_vd2_vd_vd(vdouble x, vdouble y) {
+  vdouble s = vadd_vd_vd_vd(x, y);
+  return vd2setxy_vd2_vd_vd(s, vadd_vd_vd_vd(vsub_vd_vd_vd(x, s), y));
+}
+
+static SLEEF_ALWAYS_INLINE SLEEF_CONST vdouble2 ddadd2_vd2_vd_vd(vdouble x, vdouble y) {
+  vdouble s = vadd_vd_vd_vd(x, y);
+  vdouble v = vsub_vd_vd_vd(s, x);
+  return vd2setxy_vd2_vd_vd(s, vadd_vd_vd_vd(vsub_vd_vd_vd(x, vsub_vd_vd_vd(s, v)), vsub_vd_vd_vd(y, v)));
+}
+
+static SLEEF_ALWAYS_INLINE SLEEF_CONST vdouble2 ddadd_vd2_vd2_vd(vdouble2 x, vdouble y) {
+  vdouble s = vadd_vd_vd_vd(vd2getx_vd_vd2(x), y);
+  return vd2setxy_vd2_vd_vd(s, vadd_vd_3vd(vsub_vd_vd_vd(vd2getx_vd_vd2(x), s), y, vd2gety_vd_vd2(x)));
+}
+
+static SLEEF_ALWAYS_INLINE SLEEF_CONST vdouble2 ddsub_vd2_vd2_vd(vdouble2 x, vdouble y) {
+  vdouble s = vsub_vd_vd_vd(vd2getx_vd_vd2(x), y);
+  return vd2setxy_vd2_vd_vd(s, vadd_vd_vd_vd(vsub_vd_vd_vd(vsub_vd_vd_vd(vd2getx_vd_vd2(x), s), y), vd2gety_vd_vd2(x)));
+}
+
+static SLEEF_ALWAYS_INLINE SLEEF_CONST vdouble2 ddadd2_vd2_vd2_vd(vdouble2 x, vdouble y) {
+  vdouble s = vadd_vd_vd_vd(vd2getx_vd_vd2(x), y);
+  vdouble v = vsub_vd_vd_vd(s, vd2getx_vd_vd2(x));
+  vdouble w = vadd_vd_vd_vd(vsub_vd_vd_vd(vd2getx_vd_vd2(x), vsub_vd_vd_vd(s, v)), vsub_vd_vd_vd(y, v));
+  return vd2setxy_vd2_vd_vd(s, vadd_vd_vd_vd(w, vd2gety_vd_vd2(x)));
+}
+
+static SLEEF_ALWAYS_INLINE SLEEF_CONST vdouble2 ddadd_vd2_vd_vd2(vdouble x, vdouble2 y) {
+  vdouble s = vadd_vd_vd_vd(x, vd2getx_vd_vd2(y));
+  return vd2setxy_vd2_vd_vd(s, vadd_vd_3vd(vsub_vd_vd_vd(x, s), vd2getx_vd_vd2(y), vd2gety_vd_vd2(y)));
+}
+
+static SLEEF_ALWAYS_INLINE SLEEF_CONST vdouble2 ddadd2_vd2_vd_vd2(vdouble x, vdouble2 y) {
+  vdouble s = vadd_vd_vd_vd(x, vd2getx_vd_vd2(y));
+  vdouble v = vsub_vd_vd_vd(s, x);
+  return vd2setxy_vd2_vd_vd(s, vadd_vd_vd_vd(vadd_vd_vd_vd(vsub_vd_vd_vd(x, vsub_vd_vd_vd(s, v)),
+          vsub_vd_vd_vd(vd2getx_vd_vd2(y), v)), vd2gety_vd_vd2(y)));
+}
+
+static SLEEF_ALWAYS_INLINE SLEEF_CONST vdouble2 ddadd_vd2_vd2_vd2(vdouble2 x, vdouble2 y) {
+  // |x| >= |y|
+
+  vdouble s = vadd_vd_vd_vd(vd2getx_vd_vd2(x), vd2getx_vd_vd2(y));
+  return vd2setxy_vd2_vd_vd(s, vadd_vd_4vd(vsub_vd_vd_vd(vd2getx_vd_vd2(x), s), vd2getx_vd_vd2(y), vd2gety_vd_vd2(x), vd2gety_vd_vd2(y)));
+}
+
+static SLEEF_ALWAYS_INLINE SLEEF_CONST vdouble2 ddadd2_vd2_vd2_vd2(vdouble2 x, vdouble2 y) {
+  vdouble s = vadd_vd_vd_vd(vd2getx_vd_vd2(x), vd2getx_vd_vd2(y));
+  vdouble v = vsub_vd_vd_vd(s, vd2getx_vd_vd2(x));
+  vdouble t = vadd_vd_vd_vd(vsub_vd_vd_vd(vd2getx_vd_vd2(x), vsub_vd_vd_vd(s, v)), vsub_vd_vd_vd(vd2getx_vd_vd2(y), v));
+  return vd2setxy_vd2_vd_vd(s, vadd_vd_vd_vd(t, vadd_vd_vd_vd(vd2gety_vd_vd2(x), vd2gety_vd_vd2(y))));
+}
+
+static SLEEF_ALWAYS_INLINE SLEEF_CONST vdouble2 ddsub_vd2_vd_vd(vdouble x, vdouble y) {
+  // |x| >= |y|
+
+  vdouble s = vsub_vd_vd_vd(x, y);
+  return vd2setxy_vd2_vd_vd(s, vsub_vd_vd_vd(vsub_vd_vd_vd(x, s), y));
+}
+
+static SLEEF_ALWAYS_INLINE SLEEF_CONST vdouble2 ddsub_vd2_vd2_vd2(vdouble2 x, vdouble2 y) {
+  // |x| >= |y|
+
+  vdouble s = vsub_vd_vd_vd(vd2getx_vd_vd2(x), vd2getx_vd_vd2(y));
+  vdouble t = vsub_vd_vd_vd(vd2getx_vd_vd2(x), s);
+  t = vsub_vd_vd_vd(t, vd2getx_vd_vd2(y));
+  t = vadd_vd_vd_vd(t, vd2gety_vd_vd2(x));
+  return vd2setxy_vd2_vd_vd(s, vsub_vd_vd_vd(t, vd2gety_vd_vd2(y)));
+}
+
+
+static SLEEF_ALWAYS_INLINE SLEEF_CONST vdouble2 dddiv_vd2_vd2_vd2(vdouble2 n, vdouble2 d) {
+  vdouble t = vrec_vd_vd(vd2getx_vd_vd2(d));
+  vdouble s = vmul_vd_vd_vd(vd2getx_vd_vd2(n), t);
+  vdouble u = vfmapn_vd_vd_vd_vd(t, vd2getx_vd_vd2(n), s);
+  vdouble v = vfmanp_vd_vd_vd_vd(vd2gety_vd_vd2(d), t, vfmanp_vd_vd_vd_vd(vd2getx_vd_vd2(d), t, vcast_vd_d(1)));
+  return vd2setxy_vd2_vd_vd(s, vfma_vd_vd_vd_vd(s, v, vfma_vd_vd_vd_vd(vd2gety_vd_vd2(n), t, u)));
+}
+
+static SLEEF_ALWAYS_INLINE SLEEF_CONST vdouble2 ddmul_vd2_vd_vd(vdouble x, vdouble y) {
+  vdouble s = vmul_vd_vd_vd(x, y);
+  return vd2setxy_vd2_vd_vd(s, vfmapn_vd_vd_vd_vd(x, y, s));
+}
+
+static SLEEF_ALWAYS_INLINE SLEEF_CONST vdouble2 ddsqu_vd2_vd2(vdouble2 x) {
+  vdouble s = vmul_vd_vd_vd(vd2getx_vd_vd2(x), vd2getx_vd_vd2(x));
+  return vd2setxy_vd2_vd_vd(s, vfma_vd_vd_vd_vd(vadd_vd_vd_vd(vd2getx_vd_vd2(x), vd2getx_vd_vd2(x)), vd2gety_vd_vd2(x), vfmapn_vd_vd_vd_vd(vd2getx_vd_vd2(x), vd2getx_vd_vd2(x), s)));
+}
+
+static SLEEF_ALWAYS_INLINE SLEEF_CONST vdouble2 ddmul_vd2_vd2_vd2(vdouble2 x, vdouble2 y) {
+  vdouble s = vmul_vd_vd_vd(vd2getx_vd_vd2(x), vd2getx_vd_vd2(y));
+  return vd2setxy_vd2_vd_vd(s, vfma_vd_vd_vd_vd(vd2getx_vd_vd2(x), vd2gety_vd_vd2(y), vfma_vd_vd_vd_vd(vd2gety_vd_vd2(x), vd2getx_vd_vd2(y), vfmapn_vd_vd_vd_vd(vd2getx_vd_vd2(x), vd2getx_vd_vd2(y), s))));
+}
+
+static SLEEF_ALWAYS_INLINE SLEEF_CONST vdouble ddmul_vd_vd2_vd2(vdouble2 x, vdouble2 y) {
+  return vfma_vd_vd_vd_vd(vd2getx_vd_vd2(x), vd2getx_vd_vd2(y), vfma_vd_vd_vd_vd(vd2gety_vd_vd2(x), vd2getx_vd_vd2(y), vmul_vd_vd_vd(vd2getx_vd_vd2(x), vd2gety_vd_vd2(y))));
+}
+
+static SLEEF_ALWAYS_INLINE SLEEF_CONST vdouble ddsqu_vd_vd2(vdouble2 x) {
+  return vfma_vd_vd_vd_vd(vd2getx_vd_vd2(x), vd2getx_vd_vd2(x), vadd_vd_vd_vd(vmul_vd_vd_vd(vd2getx_vd_vd2(x), vd2gety_vd_vd2(x)), vmul_vd_vd_vd(vd2getx_vd_vd2(x), vd2gety_vd_vd2(x))));
+}
+
+static SLEEF_ALWAYS_INLINE SLEEF_CONST vdouble2 ddmul_vd2_vd2_vd(vdouble2 x, vdouble y) {
+  vdouble s = vmul_vd_vd_vd(vd2getx_vd_vd2(x), y);
+  return vd2setxy_vd2_vd_vd(s, vfma_vd_vd_vd_vd(vd2gety_vd_vd2(x), y, vfmapn_vd_vd_vd_vd(vd2getx_vd_vd2(x), y, s)));
+}
+
+static SLEEF_ALWAYS_INLINE SLEEF_CONST vdouble2 ddrec_vd2_vd(vdouble d) {
+  vdouble s = vrec_vd_vd(d);
+  return vd2setxy_vd2_vd_vd(s, vmul_vd_vd_vd(s, vfmanp_vd_vd_vd_vd(d, s, vcast_vd_d(1))));
+}
+
+static SLEEF_ALWAYS_INLINE SLEEF_CONST vdouble2 ddrec_vd2_vd2(vdouble2 d) {
+  vdouble s = vrec_vd_vd(vd2getx_vd_vd2(d));
+  return vd2setxy_vd2_vd_vd(s, vmul_vd_vd_vd(s, vfmanp_vd_vd_vd_vd(vd2gety_vd_vd2(d), s, vfmanp_vd_vd_vd_vd(vd2getx_vd_vd2(d), s, vcast_vd_d(1)))));
+}
+
+static SLEEF_ALWAYS_INLINE SLEEF_CONST vdouble2 ddsqrt_vd2_vd2(vdouble2 d) {
+  vdouble t = vsqrt_vd_vd(vadd_vd_vd_vd(vd2getx_vd_vd2(d), vd2gety_vd_vd2(d)));
+  return ddscale_vd2_vd2_vd(ddmul_vd2_vd2_vd2(ddadd2_vd2_vd2_vd2(d, ddmul_vd2_vd_vd(t, t)), ddrec_vd2_vd(t)), vcast_vd_d(0.5));
+}
+
+static SLEEF_ALWAYS_INLINE SLEEF_CONST vdouble2 ddsqrt_vd2_vd(vdouble d) {
+  vdouble t = vsqrt_vd_vd(d);
+  return ddscale_vd2_vd2_vd(ddmul_vd2_vd2_vd2(ddadd2_vd2_vd_vd2(d, ddmul_vd2_vd_vd(t, t)), ddrec_vd2_vd(t)), vcast_vd_d(0.5));
+}
+
+static SLEEF_ALWAYS_INLINE SLEEF_CONST vdouble2 ddmla_vd2_vd2_vd2_vd2(vdouble2 x, vdouble2 y, vdouble2 z) {
+  return ddadd_vd2_vd2_vd2(z, ddmul_vd2_vd2_vd2(x, y));
+}
+
+
+//   Copyright Naoki Shibata and contributors 2010 - 2021.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+
+typedef struct {
+  vdouble x, y, z;
+} vdouble3;
+
+static SLEEF_ALWAYS_INLINE SLEEF_CONST vdouble vd3getx_vd_vd3(vdouble3 v) { return v.x; }
+static SLEEF_ALWAYS_INLINE SLEEF_CONST vdouble vd3gety_vd_vd3(vdouble3 v) { return v.y; }
+static SLEEF_ALWAYS_INLINE SLEEF_CONST vdouble vd3getz_vd_vd3(vdouble3 v) { return v.z; }
+static SLEEF_ALWAYS_INLINE SLEEF_CONST vdouble3 vd3setxyz_vd3_vd_vd_vd(vdouble x, vdouble y, vdouble z) {
+  vdouble3 v = { x, y, z };
+  return v;
+}
+static SLEEF_ALWAYS_INLINE SLEEF_CONST vdouble3 vd3setx_vd3_vd3_vd(vdouble3 v, vdouble d) { v.x = d; return v; }
+static SLEEF_ALWAYS_INLINE SLEEF_CONST vdouble3 vd3sety_vd3_vd3_vd(vdouble3 v, vdouble d) { v.y = d; return v; }
+static SLEEF_ALWAYS_INLINE SLEEF_CONST vdouble3 vd3setz_vd3_vd3_vd(vdouble3 v, vdouble d) { v.z = d; return v; }
+
+//
+
+typedef struct {
+  vdouble2 a, b;
+} dd2;
+
+static dd2 dd2setab_dd2_vd2_vd2(vdouble2 a, vdouble2 b) {
+  dd2 r = { a, b };
+  return r;
+}
+static vdouble2 dd2geta_vd2_dd2(dd2 d) { return d.a; }
+static vdouble2 dd2getb_vd2_dd2(dd2 d) { return d.b; }
+
+//
+
+typedef struct {
+  vmask e;
+  vdouble3 d3;
+} tdx;
+
+static SLEEF_ALWAYS_INLINE SLEEF_CONST vmask tdxgete_vm_tdx(tdx t) { return t.e; }
+static SLEEF_ALWAYS_INLINE SLEEF_CONST vdouble3 tdxgetd3_vd3_tdx(tdx t) { return t.d3; }
+static SLEEF_ALWAYS_INLINE SLEEF_CONST vdouble tdxgetd3x_vd_tdx(tdx t) { return t.d3.x; }
+static SLEEF_ALWAYS_INLINE SLEEF_CONST vdouble tdxgetd3y_vd_tdx(tdx t) { return t.d3.y; }
+static SLEEF_ALWAYS_INLINE SLEEF_CONST vdouble tdxgetd3z_vd_tdx(tdx t) { return t.d3.z; }
+static SLEEF_ALWAYS_INLINE SLEEF_CONST tdx tdxsete_tdx_tdx_vm(tdx t, vmask e) { t.e = e; return t; }
+static SLEEF_ALWAYS_INLINE SLEEF_CONST tdx tdxsetd3_tdx_tdx_vd3(tdx t, vdouble3 d3) { t.d3 = d3; return t; }
+static SLEEF_ALWAYS_INLINE SLEEF_CONST tdx tdxsetx_tdx_tdx_vd(tdx t, vdouble x) { t.d3.x = x; return t; }
+static SLEEF_ALWAYS_INLINE SLEEF_CONST tdx tdxsety_tdx_tdx_vd(tdx t, vdouble y) { t.d3.y = y; return t; }
+static SLEEF_ALWAYS_INLINE SLEEF_CONST tdx tdxsetz_tdx_tdx_vd(tdx t, vdouble z) { t.d3.z = z; return t; }
+static SLEEF_ALWAYS_INLINE SLEEF_CONST tdx tdxsetxyz_tdx_tdx_vd_vd_vd(tdx t, vdouble x, vdouble y, vdouble z) {
+  t.d3 = (vdouble3) { x, y, z };
+  return t;
+}
+
+static SLEEF_ALWAYS_INLINE SLEEF_CONST tdx tdxseted3_tdx_vm_vd3(vmask e, vdouble3 d3) { return (tdx) { e, d3 }; }
+static SLEEF_ALWAYS_INLINE SLEEF_CONST tdx tdxsetexyz_tdx_vm_vd_vd_vd(vmask e, vdouble x, vdouble y, vdouble z) {
+  return (tdx) { e, (vdouble3) { x, y, z } };
+}
+
+static SLEEF_ALWAYS_INLINE SLEEF_CONST vmask vqgetx_vm_vq(vquad v) { return v.x; }
+static SLEEF_ALWAYS_INLINE SLEEF_CONST vmask vqgety_vm_vq(vquad v) { return v.y; }
+static SLEEF_ALWAYS_INLINE SLEEF_CONST vquad vqsetxy_vq_vm_vm(vmask x, vmask y) { return (vquad) { x, y }; }
+static SLEEF_ALWAYS_INLINE SLEEF_CONST vquad vqsetx_vq_vq_vm(vquad v, vmask x) { v.x = x; return v; }
+static SLEEF_ALWAYS_INLINE SLEEF_CONST vquad vqsety_vq_vq_vm(vquad v, vmask y) { v.y = y; return v; }
+
+//
+
+typedef struct {
+  vdouble d;
+  vint i;
+} di_t;
+
+static SLEEF_ALWAYS_INLINE SLEEF_CONST vdouble digetd_vd_di(di_t d) { return d.d; }
+static SLEEF_ALWAYS_INLINE SLEEF_CONST vint digeti_vi_di(di_t d) { return d.i; }
+static SLEEF_ALWAYS_INLINE SLEEF_CONST di_t disetdi_di_vd_vi(vdouble d, vint i) {
+  di_t r = { d, i };
+  return r;
+}
+
+//
+
+typedef struct {
+  vdouble2 dd;
+  vint i;
+} ddi_t;
+
+static SLEEF_ALWAYS_INLINE SLEEF_CONST vdouble2 ddigetdd_vd2_ddi(ddi_t d) { return d.dd; }
+static SLEEF_ALWAYS_INLINE SLEEF_CONST vint ddigeti_vi_ddi(ddi_t d) { return d.i; }
+static SLEEF_ALWAYS_INLINE SLEEF_CONST ddi_t ddisetddi_ddi_vd2_vi(vdouble2 v, vint i) {
+  ddi_t r = { v, i };
+  return r;
+}
+static SLEEF_ALWAYS_INLINE SLEEF_CONST ddi_t ddisetdd_ddi_ddi_vd2(ddi_t ddi, vdouble2 v) {
+  ddi.dd = v;
+  return ddi;
+}
+
+//
+
+typedef struct {
+  vdouble3 td;
+  vint i;
+} tdi_t;
+
+static SLEEF_ALWAYS_INLINE SLEEF_CONST vdouble3 tdigettd_vd3_tdi(tdi_t d) { return d.td; }
+static SLEEF_ALWAYS_INLINE SLEEF_CONST vdouble tdigetx_vd_tdi(tdi_t d) { return d.td.x; }
+static SLEEF_ALWAYS_INLINE SLEEF_CONST vint tdigeti_vi_tdi(tdi_t d) { return d.i; }
+static SLEEF_ALWAYS_INLINE SLEEF_CONST tdi_t tdisettdi_tdi_vd3_vi(vdouble3 v, vint i) {
+  tdi_t r = { v, i };
+  return r;
+}
+
+///////////////////////////////////////////////////////////////////////////////////
+
+// vdouble functions
+
+static SLEEF_ALWAYS_INLINE SLEEF_CONST vopmask visnegzero_vo_vd(vdouble d) {
+  return veq64_vo_vm_vm(vreinterpret_vm_vd(d), vreinterpret_vm_vd(vcast_vd_d(-0.0)));
+}
+
+static SLEEF_ALWAYS_INLINE SLEEF_CONST vopmask visnumber_vo_vd(vdouble x) {
+  return vandnot_vo_vo_vo(visinf_vo_vd(x), veq_vo_vd_vd(x, x));
+}
+
+static SLEEF_ALWAYS_INLINE SLEEF_CONST vopmask visnonfinite_vo_vd(vdouble x) {
+  return veq64_vo_vm_vm(vand_vm_vm_vm(vreinterpret_vm_vd(x), vcast_vm_i64(INT64_C(0x7ff0000000000000))), vcast_vm_i64(INT64_C(0x7ff0000000000000)));
+}
+
+static SLEEF_ALWAYS_INLINE SLEEF_CONST vmask vsignbit_vm_vd(vdouble d) {
+  return vand_vm_vm_vm(vreinterpret_vm_vd(d), vreinterpret_vm_vd(vcast_vd_d(-0.0)));
+}
+
+static SLEEF_ALWAYS_INLINE SLEEF_CONST vopmask vsignbit_vo_vd(vdouble d) {
+  return veq64_vo_vm_vm(vand_vm_vm_vm(vreinterpret_vm_vd(d), vreinterpret_vm_vd(vcast_vd_d(-0.0))), vreinterpret_vm_vd(vcast_vd_d(-0.0)));
+}
+
+static SLEEF_ALWAYS_INLINE SLEEF_CONST vdouble vclearlsb_vd_vd_i(vdouble d, int n) {
+  return vreinterpret_vd_vm(vand_vm_vm_vm(vreinterpret_vm_vd(d), vcast_vm_u64((~UINT64_C(0)) << n)));
+}
+
+static SLEEF_ALWAYS_INLINE SLEEF_CONST vdouble vtoward0_vd_vd(vdouble x) { // returns nextafter(x, 0)
+  vdouble t = vreinterpret_vd_vm(vadd64_vm_vm_vm(vreinterpret_vm_vd(x), vcast_vm_i64(-1)));
+  return vsel_vd_vo_vd_vd(veq_vo_vd_vd(x, vcast_vd_d(0)), vcast_vd_d(0), t);
+}
+
+static SLEEF_ALWAYS_INLINE SLEEF_CONST vdouble vmulsign_vd_vd_vd(vdouble x, vdouble y) {
+  return vreinterpret_vd_vm(vxor_vm_vm_vm(vreinterpret_vm_vd(x), vsignbit_vm_vd(y)));
+}
+
+static SLEEF_ALWAYS_INLINE SLEEF_CONST vdouble vsign_vd_vd(vdouble d) {
+  return vmulsign_vd_vd_vd(vcast_vd_d(1.0), d);
+}
+
+static SLEEF_ALWAYS_INLINE SLEEF_CONST vdouble vorsign_vd_vd_vd(vdouble x, vdouble y) {
+  return vreinterpret_vd_vm(vor_vm_vm_vm(vreinterpret_vm_vd(x), vsignbit_vm_vd(y)));
+}
+
+static SLEEF_ALWAYS_INLINE SLEEF_CONST vdouble vcopysign_vd_vd_vd(vdouble x, vdouble y) {
+  return vreinterpret_vd_vm(vxor_vm_vm_vm(vandnot_vm_vm_vm(vreinterpret_vm_vd(vcast_vd_d(-0.0)), vreinterpret_vm_vd(x)),
+       vand_vm_vm_vm (vreinterpret_vm_vd(vcast_vd_d(-0.0)), vreinterpret_vm_vd(y))));
+}
+
+static SLEEF_ALWAYS_INLINE SLEEF_CONST vdouble vtruncate2_vd_vd(vdouble x) {
+
+  return vtruncate_vd_vd(x);
+
+
+
+
+
+}
+
+static SLEEF_ALWAYS_INLINE SLEEF_CONST vdouble vfloor2_vd_vd(vdouble x) {
+  vdouble fr = vsub_vd_vd_vd(x, vmul_vd_vd_vd(vcast_vd_d(INT64_C(1) << 31), vcast_vd_vi(vtruncate_vi_vd(vmul_vd_vd_vd(x, vcast_vd_d(1.0 / (INT64_C(1) << 31)))))));
+  fr = vsub_vd_vd_vd(fr, vcast_vd_vi(vtruncate_vi_vd(fr)));
+  fr = vsel_vd_vo_vd_vd(vlt_vo_vd_vd(fr, vcast_vd_d(0)), vadd_vd_vd_vd(fr, vcast_vd_d(1.0)), fr);
+  return vsel_vd_vo_vd_vd(vor_vo_vo_vo(visinf_vo_vd(x), vge_vo_vd_vd(vabs_vd_vd(x), vcast_vd_d(INT64_C(1) << 52))), x, vcopysign_vd_vd_vd(vsub_vd_vd_vd(x, fr), x));
+}
+
+static SLEEF_ALWAYS_INLINE SLEEF_CONST vdouble vceil2_vd_vd(vdouble x) {
+  vdouble fr = vsub_vd_vd_vd(x, vmul_vd_vd_vd(vcast_vd_d(INT64_C(1) << 31), vcast_vd_vi(vtruncate_vi_vd(vmul_vd_vd_vd(x, vcast_vd_d(1.0 / (INT64_C(1) << 31)))))));
+  fr = vsub_vd_vd_vd(fr, vcast_vd_vi(vtruncate_vi_vd(fr)));
+  fr = vsel_vd_vo_vd_vd(vle_vo_vd_vd(fr, vcast_vd_d(0)), fr, vsub_vd_vd_vd(fr, vcast_vd_d(1.0)));
+  return vsel_vd_vo_vd_vd(vor_vo_vo_vo(visinf_vo_vd(x), vge_vo_vd_vd(vabs_vd_vd(x), vcast_vd_d(INT64_C(1) << 52))), x, vcopysign_vd_vd_vd(vsub_vd_vd_vd(x, fr), x));
+}
+
+static SLEEF_ALWAYS_INLINE SLEEF_CONST vdouble vround2_vd_vd(vdouble d) {
+  vdouble x = vadd_vd_vd_vd(d, vcast_vd_d(0.5));
+  vdouble fr = vsub_vd_vd_vd(x, vmul_vd_vd_vd(vcast_vd_d(INT64_C(1) << 31), vcast_vd_vi(vtruncate_vi_vd(vmul_vd_vd_vd(x, vcast_vd_d(1.0 / (INT64_C(1) << 31)))))));
+  fr = vsub_vd_vd_vd(fr, vcast_vd_vi(vtruncate_vi_vd(fr)));
+  x = vsel_vd_vo_vd_vd(vand_vo_vo_vo(vle_vo_vd_vd(x, vcast_vd_d(0)), veq_vo_vd_vd(fr, vcast_vd_d(0))), vsub_vd_vd_vd(x, vcast_vd_d(1.0)), x);
+  fr = vsel_vd_vo_vd_vd(vlt_vo_vd_vd(fr, vcast_vd_d(0)), vadd_vd_vd_vd(fr, vcast_vd_d(1.0)), fr);
+  x = vsel_vd_vo_vd_vd(veq_vo_vd_vd(d, vcast_vd_d(0.49999999999999994449)), vcast_vd_d(0), x);
+  return vsel_vd_vo_vd_vd(vor_vo_vo_vo(visinf_vo_vd(d), vge_vo_vd_vd(vabs_vd_vd(d), vcast_vd_d(INT64_C(1) << 52))), d, vcopysign_vd_vd_vd(vsub_vd_vd_vd(x, fr), d));
+}
+
+static SLEEF_ALWAYS_INLINE SLEEF_CONST vdouble vrint2_vd_vd(vdouble d) {
+
+  return vrint_vd_vd(d);
+
+
+
+
+
+}
+
+static SLEEF_ALWAYS_INLINE SLEEF_CONST vopmask visint_vo_vd(vdouble d) {
+  return veq_vo_vd_vd(vrint2_vd_vd(d), d);
+}
+
+static SLEEF_ALWAYS_INLINE SLEEF_CONST vopmask visodd_vo_vd(vdouble d) {
+  vdouble x = vmul_vd_vd_vd(d, vcast_vd_d(0.5));
+  return vneq_vo_vd_vd(vrint2_vd_vd(x), x);
+}
+
+// ilogb
+
+
+static SLEEF_ALWAYS_INLINE SLEEF_CONST vint vilogbk_vi_vd(vdouble d) {
+  vopmask o = vlt_vo_vd_vd(d, vcast_vd_d(4.9090934652977266E-91));
+  d = vsel_vd_vo_vd_vd(o, vmul_vd_vd_vd(vcast_vd_d(2.037035976334486E90), d), d);
+  vint q = vcastu_vi_vm(vreinterpret_vm_vd(d));
+  q = vand_vi_vi_vi(q, vcast_vi_i((int)(((1U << 12) - 1) << 20)));
+  q = vsrl_vi_vi_i(q, 20);
+  q = vsub_vi_vi_vi(q, vsel_vi_vo_vi_vi(vcast_vo32_vo64(o), vcast_vi_i(300 + 0x3ff), vcast_vi_i(0x3ff)));
+  return q;
+}
+
+static SLEEF_ALWAYS_INLINE SLEEF_CONST vint vilogb2k_vi_vd(vdouble d) {
+  vint q = vcastu_vi_vm(vreinterpret_vm_vd(d));
+  q = vsrl_vi_vi_i(q, 20);
+  q = vand_vi_vi_vi(q, vcast_vi_i(0x7ff));
+  q = vsub_vi_vi_vi(q, vcast_vi_i(0x3ff));
+  return q;
+}
+
+
+static SLEEF_ALWAYS_INLINE SLEEF_CONST vmask vilogb2k_vm_vd(vdouble d) {
+  vmask m = vreinterpret_vm_vd(d);
+  m = _mm_srli_epi64(m, 20 + 32);
+  m = vand_vm_vm_vm(m, vcast_vm_i64(0x7ff));
+  m = vsub64_vm_vm_vm(m, vcast_vm_i64(0x3ff));
+  return m;
+}
+
+static SLEEF_ALWAYS_INLINE SLEEF_CONST vmask vilogb3k_vm_vd(vdouble d) {
+  vmask m = vreinterpret_vm_vd(d);
+  m = _mm_srli_epi64(m, 20 + 32);
+  m = vand_vm_vm_vm(m, vcast_vm_i64(0x7ff));
+  return m;
+}
+
+// ldexp
+
+static SLEEF_ALWAYS_INLINE SLEEF_CONST vdouble vpow2i_vd_vi(vint q) {
+  q = vadd_vi_vi_vi(vcast_vi_i(0x3ff), q);
+  vmask r = vcastu_vm_vi(vsll_vi_vi_i(q, 20));
+  return vreinterpret_vd_vm(r);
+}
+
+static SLEEF_ALWAYS_INLINE SLEEF_CONST vdouble vpow2i_vd_vm(vmask q) {
+  q = vadd64_vm_vm_vm(vcast_vm_i64(0x3ff), q);
+  return vreinterpret_vd_vm(_mm_slli_epi64(q, 52));
+}
+
+static SLEEF_ALWAYS_INLINE SLEEF_CONST vdouble vldexp_vd_vd_vi(vdouble x, vint q) {
+  vint m = vsra_vi_vi_i(q, 31);
+  m = vsll_vi_vi_i(vsub_vi_vi_vi(vsra_vi_vi_i(vadd_vi_vi_vi(m, q), 9), m), 7);
+  q = vsub_vi_vi_vi(q, vsll_vi_vi_i(m, 2));
+  m = vadd_vi_vi_vi(vcast_vi_i(0x3ff), m);
+  m = vandnot_vi_vo_vi(vgt_vo_vi_vi(vcast_vi_i(0), m), m);
+  m = vsel_vi_vo_vi_vi(vgt_vo_vi_vi(m, vcast_vi_i(0x7ff)), vcast_vi_i(0x7ff), m);
+  vmask r = vcastu_vm_vi(vsll_vi_vi_i(m, 20));
+  vdouble y = vreinterpret_vd_vm(r);
+  return vmul_vd_vd_vd(vmul_vd_vd_vd(vmul_vd_vd_vd(vmul_vd_vd_vd(vmul_vd_vd_vd(x, y), y), y), y), vpow2i_vd_vi(q));
+}
+
+static SLEEF_ALWAYS_INLINE SLEEF_CONST vdouble vldexp2_vd_vd_vi(vdouble d, vint e) {
+  return vmul_vd_vd_vd(vmul_vd_vd_vd(d, vpow2i_vd_vi(vsra_vi_vi_i(e, 1))), vpow2i_vd_vi(vsub_vi_vi_vi(e, vsra_vi_vi_i(e, 1))));
+}
+
+static SLEEF_ALWAYS_INLINE SLEEF_CONST vdouble vldexp3_vd_vd_vi(vdouble d, vint q) {
+  return vreinterpret_vd_vm(vadd64_vm_vm_vm(vreinterpret_vm_vd(d), vcastu_vm_vi(vsll_vi_vi_i(q, 20))));
+}
+
+static SLEEF_ALWAYS_INLINE SLEEF_CONST vdouble vldexp1_vd_vd_vm(vdouble d, vmask e) {
+  vmask m = _mm_srli_epi64(e, 2);
+  e = vsub64_vm_vm_vm(vsub64_vm_vm_vm(vsub64_vm_vm_vm(e, m), m), m);
+  d = vmul_vd_vd_vd(d, vpow2i_vd_vm(m));
+  d = vmul_vd_vd_vd(d, vpow2i_vd_vm(m));
+  d = vmul_vd_vd_vd(d, vpow2i_vd_vm(m));
+  d = vmul_vd_vd_vd(d, vpow2i_vd_vm(e));
+  return d;
+}
+
+static SLEEF_ALWAYS_INLINE SLEEF_CONST vdouble vldexp2_vd_vd_vm(vdouble d, vmask e) {
+  return vmul_vd_vd_vd(vmul_vd_vd_vd(d, vpow2i_vd_vm(_mm_srli_epi64(e, 1))), vpow2i_vd_vm(vsub64_vm_vm_vm(e, _mm_srli_epi64(e, 1))));
+}
+
+static SLEEF_ALWAYS_INLINE SLEEF_CONST vdouble vldexp3_vd_vd_vm(vdouble d, vmask q) {
+  return vreinterpret_vd_vm(vadd64_vm_vm_vm(vreinterpret_vm_vd(d), _mm_slli_epi64(q, 52)));
+}
+
+// vmask functions
+
+static SLEEF_ALWAYS_INLINE SLEEF_CONST vdouble vcast_vd_vm(vmask m) { return vcast_vd_vi(vcast_vi_vm(m)); } // 32 bit only
+static SLEEF_ALWAYS_INLINE SLEEF_CONST vmask vtruncate_vm_vd(vdouble d) { return vcast_vm_vi(vtruncate_vi_vd(d)); }
+
+static SLEEF_ALWAYS_INLINE SLEEF_CONST vopmask vlt64_vo_vm_vm(vmask x, vmask y) { return vgt64_vo_vm_vm(y, x); }
+
+static SLEEF_ALWAYS_INLINE SLEEF_CONST vopmask vnot_vo64_vo64(vopmask x) {
+  return vxor_vo_vo_vo(x, veq64_vo_vm_vm(vcast_vm_i64(0), vcast_vm_i64(0)));
+}
+
+static SLEEF_ALWAYS_INLINE SLEEF_CONST vopmask vugt64_vo_vm_vm(vmask x, vmask y) { // unsigned compare
+  x = vxor_vm_vm_vm(vcast_vm_u64(UINT64_C(0x8000000000000000)), x);
+  y = vxor_vm_vm_vm(vcast_vm_u64(UINT64_C(0x8000000000000000)), y);
+  return vgt64_vo_vm_vm(x, y);
+}
+
+static SLEEF_ALWAYS_INLINE SLEEF_CONST vmask vilogbk_vm_vd(vdouble d) {
+  vopmask o = vlt_vo_vd_vd(vabs_vd_vd(d), vcast_vd_d(4.9090934652977266E-91));
+  d = vsel_vd_vo_vd_vd(o, vmul_vd_vd_vd(vcast_vd_d(2.037035976334486E90), d), d);
+  vmask q = vreinterpret_vm_vd(d);
+  q = _mm_srli_epi64(q, 20 + 32);
+  q = vand_vm_vm_vm(q, vcast_vm_i64(0x7ff));
+  q = vsub64_vm_vm_vm(q, vsel_vm_vo64_vm_vm(o, vcast_vm_i64(300 + 0x3ff), vcast_vm_i64(0x3ff)));
+  return q;
+}
+
+// vquad functions
+
+static SLEEF_ALWAYS_INLINE SLEEF_CONST vquad sel_vq_vo_vq_vq(vopmask o, vquad x, vquad y) {
+  return vqsetxy_vq_vm_vm(vsel_vm_vo64_vm_vm(o, vqgetx_vm_vq(x), vqgetx_vm_vq(y)), vsel_vm_vo64_vm_vm(o, vqgety_vm_vq(x), vqgety_vm_vq(y)));
+}
+
+static SLEEF_ALWAYS_INLINE SLEEF_CONST vquad add128_vq_vq_vq(vquad x, vquad y) {
+  vquad r = vqsetxy_vq_vm_vm(vadd64_vm_vm_vm(vqgetx_vm_vq(x), vqgetx_vm_vq(y)), vadd64_vm_vm_vm(vqgety_vm_vq(x), vqgety_vm_vq(y)));
+  r = vqsety_vq_vq_vm(r, vadd64_vm_vm_vm(vqgety_vm_vq(r), vand_vm_vo64_vm(vugt64_vo_vm_vm(vqgetx_vm_vq(x), vqgetx_vm_vq(r)), vcast_vm_i64(1))));
+  return r;
+}
+
+
+static SLEEF_ALWAYS_INLINE SLEEF_CONST vquad imdvq_vq_vm_vm(vmask x, vmask y) { vquad r = vqsetxy_vq_vm_vm(x, y); return r; }
+
+// imm must be smaller than 64
+
+
+
+// This function is equivalent to :
+// di_t ret = { x - rint(4 * x) * 0.25, (int32_t)(rint(4 * x) - rint(x) * 4) };
+static SLEEF_ALWAYS_INLINE SLEEF_CONST di_t rempisub(vdouble x) {
+
+  vdouble y = vrint_vd_vd(vmul_vd_vd_vd(x, vcast_vd_d(4)));
+  vint vi = vtruncate_vi_vd(vsub_vd_vd_vd(y, vmul_vd_vd_vd(vrint_vd_vd(x), vcast_vd_d(4))));
+  return disetdi_di_vd_vi(vsub_vd_vd_vd(x, vmul_vd_vd_vd(y, vcast_vd_d(0.25))), vi);
+
+}
+
+
+// return d0 < d1 ? x : y
+static SLEEF_ALWAYS_INLINE SLEEF_CONST vint vsel_vi_vd_vd_vi_vi(vdouble d0, vdouble d1, vint x, vint y) { return vsel_vi_vo_vi_vi(vcast_vo32_vo64(vlt_vo_vd_vd(d0, d1)), x, y); }
+
+// return d0 < 0 ? x : 0
+static SLEEF_ALWAYS_INLINE SLEEF_CONST vint vsel_vi_vd_vi(vdouble d, vint x) { return vand_vi_vo_vi(vcast_vo32_vo64(vsignbit_vo_vd(d)), x); }
+
+//
+
+SLEEF_INLINE SLEEF_CONST vdouble Sleef_ldexpd2_avx2128(vdouble x, vint q) { return vldexp_vd_vd_vi(x, q); }
+
+SLEEF_INLINE SLEEF_CONST vint Sleef_ilogbd2_avx2128(vdouble d) {
+  vdouble e = vcast_vd_vi(vilogbk_vi_vd(vabs_vd_vd(d)));
+  e = vsel_vd_vo_vd_vd(veq_vo_vd_vd(d, vcast_vd_d(0)), vcast_vd_d(SLEEF_FP_ILOGB0), e);
+  e = vsel_vd_vo_vd_vd(visnan_vo_vd(d), vcast_vd_d(SLEEF_FP_ILOGBNAN), e);
+  e = vsel_vd_vo_vd_vd(visinf_vo_vd(d), vcast_vd_d(2147483647), e);
+  return vrint_vi_vd(e);
+}
+
+static SLEEF_ALWAYS_INLINE SLEEF_CONST ddi_t rempi(vdouble a) {
+  vdouble2 x, y;
+  vint ex = vilogb2k_vi_vd(a);
+
+
+
+
+  ex = vsub_vi_vi_vi(ex, vcast_vi_i(55));
+  vint q = vand_vi_vo_vi(vgt_vo_vi_vi(ex, vcast_vi_i(700-55)), vcast_vi_i(-64));
+  a = vldexp3_vd_vd_vi(a, q);
+  ex = vandnot_vi_vi_vi(vsra_vi_vi_i(ex, 31), ex);
+  ex = vsll_vi_vi_i(ex, 2);
+  x = ddmul_vd2_vd_vd(a, vgather_vd_p_vi(Sleef_rempitabdp, ex));
+  di_t di = rempisub(vd2getx_vd_vd2(x));
+  q = digeti_vi_di(di);
+  x = vd2setx_vd2_vd2_vd(x, digetd_vd_di(di));
+  x = ddnormalize_vd2_vd2(x);
+  y = ddmul_vd2_vd_vd(a, vgather_vd_p_vi(Sleef_rempitabdp+1, ex));
+  x = ddadd2_vd2_vd2_vd2(x, y);
+  di = rempisub(vd2getx_vd_vd2(x));
+  q = vadd_vi_vi_vi(q, digeti_vi_di(di));
+  x = vd2setx_vd2_vd2_vd(x, digetd_vd_di(di));
+  x = ddnormalize_vd2_vd2(x);
+  y = vcast_vd2_vd_vd(vgather_vd_p_vi(Sleef_rempitabdp+2, ex), vgather_vd_p_vi(Sleef_rempitabdp+3, ex));
+  y = ddmul_vd2_vd2_vd(y, a);
+  x = ddadd2_vd2_vd2_vd2(x, y);
+  x = ddnormalize_vd2_vd2(x);
+  x = ddmul_vd2_vd2_vd2(x, vcast_vd2_d_d(3.141592653589793116*2, 1.2246467991473532072e-16*2));
+  vopmask o = vlt_vo_vd_vd(vabs_vd_vd(a), vcast_vd_d(0.7));
+  x = vd2setx_vd2_vd2_vd(x, vsel_vd_vo_vd_vd(o, a, vd2getx_vd_vd2(x)));
+  x = vd2sety_vd2_vd2_vd(x, vreinterpret_vd_vm(vandnot_vm_vo64_vm(o, vreinterpret_vm_vd(vd2gety_vd_vd2(x)))));
+  return ddisetddi_ddi_vd2_vi(x, q);
+}
+
+SLEEF_INLINE SLEEF_CONST vdouble Sleef_sind2_u35avx2128(vdouble d) {
+
+// The SIMD source files(sleefsimd?p.c) are compiled twice for each
+// vector extension, with DETERMINISTIC macro turned on and off.
+// Below is the normal(faster) implementation of sin function.  The
+// function name xsin will be renamed to Sleef_sind2_u35sse2 with
+// renamesse2.h, for example.
+
+  vdouble u, s, r = d;
+  vint ql;
+
+  if (__builtin_expect(!!(vtestallones_i_vo64(vlt_vo_vd_vd(vabs_vd_vd(d), vcast_vd_d(15)))), 1)) {
+    vdouble dql = vrint_vd_vd(vmul_vd_vd_vd(d, vcast_vd_d(0.318309886183790671537767526745028724)));
+    ql = vrint_vi_vd(dql);
+    d = vmla_vd_vd_vd_vd(dql, vcast_vd_d(-3.141592653589793116), d);
+    d = vmla_vd_vd_vd_vd(dql, vcast_vd_d(-1.2246467991473532072e-16), d);
+  } else if (__builtin_expect(!!(vtestallones_i_vo64(vlt_vo_vd_vd(vabs_vd_vd(d), vcast_vd_d(1e+14)))), 1)) {
+    vdouble dqh = vtruncate_vd_vd(vmul_vd_vd_vd(d, vcast_vd_d(0.318309886183790671537767526745028724 / (1 << 24))));
+    dqh = vmul_vd_vd_vd(dqh, vcast_vd_d(1 << 24));
+    vdouble dql = vrint_vd_vd(vmlapn_vd_vd_vd_vd(d, vcast_vd_d(0.318309886183790671537767526745028724), dqh));
+    ql = vrint_vi_vd(dql);
+
+    d = vmla_vd_vd_vd_vd(dqh, vcast_vd_d(-3.1415926218032836914), d);
+    d = vmla_vd_vd_vd_vd(dql, vcast_vd_d(-3.1415926218032836914), d);
+    d = vmla_vd_vd_vd_vd(dqh, vcast_vd_d(-3.1786509424591713469e-08), d);
+    d = vmla_vd_vd_vd_vd(dql, vcast_vd_d(-3.1786509424591713469e-08), d);
+    d = vmla_vd_vd_vd_vd(dqh, vcast_vd_d(-1.2246467864107188502e-16), d);
+    d = vmla_vd_vd_vd_vd(dql, vcast_vd_d(-1.2246467864107188502e-16), d);
+    d = vmla_vd_vd_vd_vd(vadd_vd_vd_vd(dqh, dql), vcast_vd_d(-1.2736634327021899816e-24), d);
+  } else {
+    ddi_t ddi = rempi(d);
+    ql = vand_vi_vi_vi(ddigeti_vi_ddi(ddi), vcast_vi_i(3));
+    ql = vadd_vi_vi_vi(vadd_vi_vi_vi(ql, ql), vsel_vi_vo_vi_vi(vcast_vo32_vo64(vgt_vo_vd_vd(vd2getx_vd_vd2(ddigetdd_vd2_ddi(ddi)), vcast_vd_d(0))), vcast_vi_i(2), vcast_vi_i(1)));
+    ql = vsra_vi_vi_i(ql, 2);
+    vopmask o = veq_vo_vi_vi(vand_vi_vi_vi(ddigeti_vi_ddi(ddi), vcast_vi_i(1)), vcast_vi_i(1));
+    vdouble2 x = vcast_vd2_vd_vd(vmulsign_vd_vd_vd(vcast_vd_d(-3.141592653589793116 * 0.5), vd2getx_vd_vd2(ddigetdd_vd2_ddi(ddi))),
+     vmulsign_vd_vd_vd(vcast_vd_d(-1.2246467991473532072e-16 * 0.5), vd2getx_vd_vd2(ddigetdd_vd2_ddi(ddi))));
+    x = ddadd2_vd2_vd2_vd2(ddigetdd_vd2_ddi(ddi), x);
+    ddi = ddisetdd_ddi_ddi_vd2(ddi, vsel_vd2_vo_vd2_vd2(vcast_vo64_vo32(o), x, ddigetdd_vd2_ddi(ddi)));
+    d = vadd_vd_vd_vd(vd2getx_vd_vd2(ddigetdd_vd2_ddi(ddi)), vd2gety_vd_vd2(ddigetdd_vd2_ddi(ddi)));
+    d = vreinterpret_vd_vm(vor_vm_vo64_vm(vor_vo_vo_vo(visinf_vo_vd(r), visnan_vo_vd(r)), vreinterpret_vm_vd(d)));
+  }
+
+  s = vmul_vd_vd_vd(d, d);
+
+  d = vreinterpret_vd_vm(vxor_vm_vm_vm(vand_vm_vo64_vm(vcast_vo64_vo32(veq_vo_vi_vi(vand_vi_vi_vi(ql, vcast_vi_i(1)), vcast_vi_i(1))), vreinterpret_vm_vd(vcast_vd_d(-0.0))), vreinterpret_vm_vd(d)));
+
+  vdouble s2 = vmul_vd_vd_vd(s, s), s4 = vmul_vd_vd_vd(s2, s2);
+  u = vmla_vd_vd_vd_vd((s4), (vmla_vd_vd_vd_vd((s2), (vmla_vd_vd_vd_vd((s), (vcast_vd_d(-7.97255955009037868891952e-18)), (vcast_vd_d(2.81009972710863200091251e-15)))), (vmla_vd_vd_vd_vd((s), (vcast_vd_d(-7.64712219118158833288484e-13)), (vcast_vd_d(1.60590430605664501629054e-10)))))), (vmla_vd_vd_vd_vd((s2), (vmla_vd_vd_vd_vd((s), (vcast_vd_d(-2.50521083763502045810755e-08)), (vcast_vd_d(2.75573192239198747630416e-06)))), (vmla_vd_vd_vd_vd((s), (vcast_vd_d(-0.000198412698412696162806809)), (vcast_vd_d(0.00833333333333332974823815)))))))
+
+
+
+
+
+
+
+                                  ;
+  u = vmla_vd_vd_vd_vd(u, s, vcast_vd_d(-0.166666666666666657414808));
+
+  u = vadd_vd_vd_vd(vmul_vd_vd_vd(s, vmul_vd_vd_vd(u, d)), d);
+
+  u = vsel_vd_vo_vd_vd(visnegzero_vo_vd(r), r, u);
+
+  return u;
+
+}
+
+SLEEF_INLINE SLEEF_CONST vdouble Sleef_sind2_u10avx2128(vdouble d) {
+
+  vdouble u;
+  vdouble2 s, t, x;
+  vint ql;
+
+  if (__builtin_expect(!!(vtestallones_i_vo64(vlt_vo_vd_vd(vabs_vd_vd(d), vcast_vd_d(15)))), 1)) {
+    const vdouble dql = vrint_vd_vd(vmul_vd_vd_vd(d, vcast_vd_d(0.318309886183790671537767526745028724)));
+    ql = vrint_vi_vd(dql);
+    u = vmla_vd_vd_vd_vd(dql, vcast_vd_d(-3.141592653589793116), d);
+    s = ddadd_vd2_vd_vd (u, vmul_vd_vd_vd(dql, vcast_vd_d(-1.2246467991473532072e-16)));
+  } else if (__builtin_expect(!!(vtestallones_i_vo64(vlt_vo_vd_vd(vabs_vd_vd(d), vcast_vd_d(1e+14)))), 1)) {
+    vdouble dqh = vtruncate_vd_vd(vmul_vd_vd_vd(d, vcast_vd_d(0.318309886183790671537767526745028724 / (1 << 24))));
+    dqh = vmul_vd_vd_vd(dqh, vcast_vd_d(1 << 24));
+    const vdouble dql = vrint_vd_vd(vmlapn_vd_vd_vd_vd(d, vcast_vd_d(0.318309886183790671537767526745028724), dqh));
+    ql = vrint_vi_vd(dql);
+
+    u = vmla_vd_vd_vd_vd(dqh, vcast_vd_d(-3.1415926218032836914), d);
+    s = ddadd_vd2_vd_vd (u, vmul_vd_vd_vd(dql, vcast_vd_d(-3.1415926218032836914)));
+    s = ddadd2_vd2_vd2_vd(s, vmul_vd_vd_vd(dqh, vcast_vd_d(-3.1786509424591713469e-08)));
+    s = ddadd2_vd2_vd2_vd(s, vmul_vd_vd_vd(dql, vcast_vd_d(-3.1786509424591713469e-08)));
+    s = ddadd2_vd2_vd2_vd(s, vmul_vd_vd_vd(dqh, vcast_vd_d(-1.2246467864107188502e-16)));
+    s = ddadd2_vd2_vd2_vd(s, vmul_vd_vd_vd(dql, vcast_vd_d(-1.2246467864107188502e-16)));
+    s = ddadd_vd2_vd2_vd(s, vmul_vd_vd_vd(vadd_vd_vd_vd(dqh, dql), vcast_vd_d(-1.2736634327021899816e-24)));
+  } else {
+    ddi_t ddi = rempi(d);
+    ql = vand_vi_vi_vi(ddigeti_vi_ddi(ddi), vcast_vi_i(3));
+    ql = vadd_vi_vi_vi(vadd_vi_vi_vi(ql, ql), vsel_vi_vo_vi_vi(vcast_vo32_vo64(vgt_vo_vd_vd(vd2getx_vd_vd2(ddigetdd_vd2_ddi(ddi)), vcast_vd_d(0))), vcast_vi_i(2), vcast_vi_i(1)));
+    ql = vsra_vi_vi_i(ql, 2);
+    vopmask o = veq_vo_vi_vi(vand_vi_vi_vi(ddigeti_vi_ddi(ddi), vcast_vi_i(1)), vcast_vi_i(1));
+    vdouble2 x = vcast_vd2_vd_vd(vmulsign_vd_vd_vd(vcast_vd_d(-3.141592653589793116 * 0.5), vd2getx_vd_vd2(ddigetdd_vd2_ddi(ddi))),
+     vmulsign_vd_vd_vd(vcast_vd_d(-1.2246467991473532072e-16 * 0.5), vd2getx_vd_vd2(ddigetdd_vd2_ddi(ddi))));
+    x = ddadd2_vd2_vd2_vd2(ddigetdd_vd2_ddi(ddi), x);
+    ddi = ddisetdd_ddi_ddi_vd2(ddi, vsel_vd2_vo_vd2_vd2(vcast_vo64_vo32(o), x, ddigetdd_vd2_ddi(ddi)));
+    s = ddnormalize_vd2_vd2(ddigetdd_vd2_ddi(ddi));
+    s = vd2setx_vd2_vd2_vd(s, vreinterpret_vd_vm(vor_vm_vo64_vm(vor_vo_vo_vo(visinf_vo_vd(d), visnan_vo_vd(d)), vreinterpret_vm_vd(vd2getx_vd_vd2(s)))));
+  }
+
+  t = s;
+  s = ddsqu_vd2_vd2(s);
+
+  vdouble s2 = vmul_vd_vd_vd(vd2getx_vd_vd2(s), vd2getx_vd_vd2(s)), s4 = vmul_vd_vd_vd(s2, s2);
+  u = vmla_vd_vd_vd_vd((s4), (vmla_vd_vd_vd_vd((vd2getx_vd_vd2(s)), (vcast_vd_d(2.72052416138529567917983e-15)), (vcast_vd_d(-7.6429259411395447190023e-13)))), (vmla_vd_vd_vd_vd((s2), (vmla_vd_vd_vd_vd((vd2getx_vd_vd2(s)), (vcast_vd_d(1.60589370117277896211623e-10)), (vcast_vd_d(-2.5052106814843123359368e-08)))), (vmla_vd_vd_vd_vd((vd2getx_vd_vd2(s)), (vcast_vd_d(2.75573192104428224777379e-06)), (vcast_vd_d(-0.000198412698412046454654947)))))))
+
+
+
+
+
+                                    ;
+  u = vmla_vd_vd_vd_vd(u, vd2getx_vd_vd2(s), vcast_vd_d(0.00833333333333318056201922));
+
+  x = ddadd_vd2_vd_vd2(vcast_vd_d(1), ddmul_vd2_vd2_vd2(ddadd_vd2_vd_vd(vcast_vd_d(-0.166666666666666657414808), vmul_vd_vd_vd(u, vd2getx_vd_vd2(s))), s));
+  u = ddmul_vd_vd2_vd2(t, x);
+
+  u = vreinterpret_vd_vm(vxor_vm_vm_vm(vand_vm_vo64_vm(vcast_vo64_vo32(veq_vo_vi_vi(vand_vi_vi_vi(ql, vcast_vi_i(1)), vcast_vi_i(1))),
+             vreinterpret_vm_vd(vcast_vd_d(-0.0))), vreinterpret_vm_vd(u)));
+  u = vsel_vd_vo_vd_vd(veq_vo_vd_vd(d, vcast_vd_d(0)), d, u);
+
+  return u;
+
+}
+
+SLEEF_INLINE SLEEF_CONST vdouble Sleef_cosd2_u35avx2128(vdouble d) {
+
+  vdouble u, s, r = d;
+  vint ql;
+
+  if (__builtin_expect(!!(vtestallones_i_vo64(vlt_vo_vd_vd(vabs_vd_vd(d), vcast_vd_d(15)))), 1)) {
+    vdouble dql = vmla_vd_vd_vd_vd(vcast_vd_d(2),
+       vrint_vd_vd(vmla_vd_vd_vd_vd(d, vcast_vd_d(0.318309886183790671537767526745028724), vcast_vd_d(-0.5))),
+       vcast_vd_d(1));
+    ql = vrint_vi_vd(dql);
+    d = vmla_vd_vd_vd_vd(dql, vcast_vd_d(-3.141592653589793116 * 0.5), d);
+    d = vmla_vd_vd_vd_vd(dql, vcast_vd_d(-1.2246467991473532072e-16 * 0.5), d);
+  } else if (__builtin_expect(!!(vtestallones_i_vo64(vlt_vo_vd_vd(vabs_vd_vd(d), vcast_vd_d(1e+14)))), 1)) {
+    vdouble dqh = vtruncate_vd_vd(vmla_vd_vd_vd_vd(d, vcast_vd_d(0.318309886183790671537767526745028724 / (1 << 23)), vcast_vd_d(-0.318309886183790671537767526745028724 / (1 << 24))));
+    ql = vrint_vi_vd(vadd_vd_vd_vd(vmul_vd_vd_vd(d, vcast_vd_d(0.318309886183790671537767526745028724)),
+       vmla_vd_vd_vd_vd(dqh, vcast_vd_d(-(1 << 23)), vcast_vd_d(-0.5))));
+    dqh = vmul_vd_vd_vd(dqh, vcast_vd_d(1 << 24));
+    ql = vadd_vi_vi_vi(vadd_vi_vi_vi(ql, ql), vcast_vi_i(1));
+    vdouble dql = vcast_vd_vi(ql);
+
+    d = vmla_vd_vd_vd_vd(dqh, vcast_vd_d(-3.1415926218032836914 * 0.5), d);
+    d = vmla_vd_vd_vd_vd(dql, vcast_vd_d(-3.1415926218032836914 * 0.5), d);
+    d = vmla_vd_vd_vd_vd(dqh, vcast_vd_d(-3.1786509424591713469e-08 * 0.5), d);
+    d = vmla_vd_vd_vd_vd(dql, vcast_vd_d(-3.1786509424591713469e-08 * 0.5), d);
+    d = vmla_vd_vd_vd_vd(dqh, vcast_vd_d(-1.2246467864107188502e-16 * 0.5), d);
+    d = vmla_vd_vd_vd_vd(dql, vcast_vd_d(-1.2246467864107188502e-16 * 0.5), d);
+    d = vmla_vd_vd_vd_vd(vadd_vd_vd_vd(dqh, dql), vcast_vd_d(-1.2736634327021899816e-24 * 0.5), d);
+  } else {
+    ddi_t ddi = rempi(d);
+    ql = vand_vi_vi_vi(ddigeti_vi_ddi(ddi), vcast_vi_i(3));
+    ql = vadd_vi_vi_vi(vadd_vi_vi_vi(ql, ql), vsel_vi_vo_vi_vi(vcast_vo32_vo64(vgt_vo_vd_vd(vd2getx_vd_vd2(ddigetdd_vd2_ddi(ddi)), vcast_vd_d(0))), vcast_vi_i(8), vcast_vi_i(7)));
+    ql = vsra_vi_vi_i(ql, 1);
+    vopmask o = veq_vo_vi_vi(vand_vi_vi_vi(ddigeti_vi_ddi(ddi), vcast_vi_i(1)), vcast_vi_i(0));
+    vdouble y = vsel_vd_vo_vd_vd(vgt_vo_vd_vd(vd2getx_vd_vd2(ddigetdd_vd2_ddi(ddi)), vcast_vd_d(0)), vcast_vd_d(0), vcast_vd_d(-1));
+    vdouble2 x = vcast_vd2_vd_vd(vmulsign_vd_vd_vd(vcast_vd_d(-3.141592653589793116 * 0.5), y),
+     vmulsign_vd_vd_vd(vcast_vd_d(-1.2246467991473532072e-16 * 0.5), y));
+    x = ddadd2_vd2_vd2_vd2(ddigetdd_vd2_ddi(ddi), x);
+    ddi = ddisetdd_ddi_ddi_vd2(ddi, vsel_vd2_vo_vd2_vd2(vcast_vo64_vo32(o), x, ddigetdd_vd2_ddi(ddi)));
+    d = vadd_vd_vd_vd(vd2getx_vd_vd2(ddigetdd_vd2_ddi(ddi)), vd2gety_vd_vd2(ddigetdd_vd2_ddi(ddi)));
+    d = vreinterpret_vd_vm(vor_vm_vo64_vm(vor_vo_vo_vo(visinf_vo_vd(r), visnan_vo_vd(r)), vreinterpret_vm_vd(d)));
+  }
+
+  s = vmul_vd_vd_vd(d, d);
+
+  d = vreinterpret_vd_vm(vxor_vm_vm_vm(vand_vm_vo64_vm(vcast_vo64_vo32(veq_vo_vi_vi(vand_vi_vi_vi(ql, vcast_vi_i(2)), vcast_vi_i(0))), vreinterpret_vm_vd(vcast_vd_d(-0.0))), vreinterpret_vm_vd(d)));
+
+  vdouble s2 = vmul_vd_vd_vd(s, s), s4 = vmul_vd_vd_vd(s2, s2);
+  u = vmla_vd_vd_vd_vd((s4), (vmla_vd_vd_vd_vd((s2), (vmla_vd_vd_vd_vd((s), (vcast_vd_d(-7.97255955009037868891952e-18)), (vcast_vd_d(2.81009972710863200091251e-15)))), (vmla_vd_vd_vd_vd((s), (vcast_vd_d(-7.64712219118158833288484e-13)), (vcast_vd_d(1.60590430605664501629054e-10)))))), (vmla_vd_vd_vd_vd((s2), (vmla_vd_vd_vd_vd((s), (vcast_vd_d(-2.50521083763502045810755e-08)), (vcast_vd_d(2.75573192239198747630416e-06)))), (vmla_vd_vd_vd_vd((s), (vcast_vd_d(-0.000198412698412696162806809)), (vcast_vd_d(0.00833333333333332974823815)))))))
+
+
+
+
+
+
+
+                                  ;
+  u = vmla_vd_vd_vd_vd(u, s, vcast_vd_d(-0.166666666666666657414808));
+
+  u = vadd_vd_vd_vd(vmul_vd_vd_vd(s, vmul_vd_vd_vd(u, d)), d);
+
+  return u;
+
+}
+
+SLEEF_INLINE SLEEF_CONST vdouble Sleef_cosd2_u10avx2128(vdouble d) {
+
+  vdouble u;
+  vdouble2 s, t, x;
+  vint ql;
+
+  if (__builtin_expect(!!(vtestallones_i_vo64(vlt_vo_vd_vd(vabs_vd_vd(d), vcast_vd_d(15)))), 1)) {
+    vdouble dql = vrint_vd_vd(vmla_vd_vd_vd_vd(d, vcast_vd_d(0.318309886183790671537767526745028724), vcast_vd_d(-0.5)));
+    dql = vmla_vd_vd_vd_vd(vcast_vd_d(2), dql, vcast_vd_d(1));
+    ql = vrint_vi_vd(dql);
+    s = ddadd2_vd2_vd_vd(d, vmul_vd_vd_vd(dql, vcast_vd_d(-3.141592653589793116*0.5)));
+    s = ddadd_vd2_vd2_vd(s, vmul_vd_vd_vd(dql, vcast_vd_d(-1.2246467991473532072e-16*0.5)));
+  } else if (__builtin_expect(!!(vtestallones_i_vo64(vlt_vo_vd_vd(vabs_vd_vd(d), vcast_vd_d(1e+14)))), 1)) {
+    vdouble dqh = vtruncate_vd_vd(vmla_vd_vd_vd_vd(d, vcast_vd_d(0.318309886183790671537767526745028724 / (1 << 23)), vcast_vd_d(-0.318309886183790671537767526745028724 / (1 << 24))));
+    ql = vrint_vi_vd(vadd_vd_vd_vd(vmul_vd_vd_vd(d, vcast_vd_d(0.318309886183790671537767526745028724)),
+     vmla_vd_vd_vd_vd(dqh, vcast_vd_d(-(1 << 23)), vcast_vd_d(-0.5))));
+    dqh = vmul_vd_vd_vd(dqh, vcast_vd_d(1 << 24));
+    ql = vadd_vi_vi_vi(vadd_vi_vi_vi(ql, ql), vcast_vi_i(1));
+    const vdouble dql = vcast_vd_vi(ql);
+
+    u = vmla_vd_vd_vd_vd(dqh, vcast_vd_d(-3.1415926218032836914 * 0.5), d);
+    s = ddadd2_vd2_vd_vd(u, vmul_vd_vd_vd(dql, vcast_vd_d(-3.1415926218032836914*0.5)));
+    s = ddadd2_vd2_vd2_vd(s, vmul_vd_vd_vd(dqh, vcast_vd_d(-3.1786509424591713469e-08*0.5)));
+    s = ddadd2_vd2_vd2_vd(s, vmul_vd_vd_vd(dql, vcast_vd_d(-3.1786509424591713469e-08*0.5)));
+    s = ddadd2_vd2_vd2_vd(s, vmul_vd_vd_vd(dqh, vcast_vd_d(-1.2246467864107188502e-16*0.5)));
+    s = ddadd2_vd2_vd2_vd(s, vmul_vd_vd_vd(dql, vcast_vd_d(-1.2246467864107188502e-16*0.5)));
+    s = ddadd_vd2_vd2_vd(s, vmul_vd_vd_vd(vadd_vd_vd_vd(dqh, dql), vcast_vd_d(-1.2736634327021899816e-24*0.5)));
+  } else {
+    ddi_t ddi = rempi(d);
+    ql = vand_vi_vi_vi(ddigeti_vi_ddi(ddi), vcast_vi_i(3));
+    ql = vadd_vi_vi_vi(vadd_vi_vi_vi(ql, ql), vsel_vi_vo_vi_vi(vcast_vo32_vo64(vgt_vo_vd_vd(vd2getx_vd_vd2(ddigetdd_vd2_ddi(ddi)), vcast_vd_d(0))), vcast_vi_i(8), vcast_vi_i(7)));
+    ql = vsra_vi_vi_i(ql, 1);
+    vopmask o = veq_vo_vi_vi(vand_vi_vi_vi(ddigeti_vi_ddi(ddi), vcast_vi_i(1)), vcast_vi_i(0));
+    vdouble y = vsel_vd_vo_vd_vd(vgt_vo_vd_vd(vd2getx_vd_vd2(ddigetdd_vd2_ddi(ddi)), vcast_vd_d(0)), vcast_vd_d(0), vcast_vd_d(-1));
+    vdouble2 x = vcast_vd2_vd_vd(vmulsign_vd_vd_vd(vcast_vd_d(-3.141592653589793116 * 0.5), y),
+     vmulsign_vd_vd_vd(vcast_vd_d(-1.2246467991473532072e-16 * 0.5), y));
+    x = ddadd2_vd2_vd2_vd2(ddigetdd_vd2_ddi(ddi), x);
+    ddi = ddisetdd_ddi_ddi_vd2(ddi, vsel_vd2_vo_vd2_vd2(vcast_vo64_vo32(o), x, ddigetdd_vd2_ddi(ddi)));
+    s = ddnormalize_vd2_vd2(ddigetdd_vd2_ddi(ddi));
+    s = vd2setx_vd2_vd2_vd(s, vreinterpret_vd_vm(vor_vm_vo64_vm(vor_vo_vo_vo(visinf_vo_vd(d), visnan_vo_vd(d)), vreinterpret_vm_vd(vd2getx_vd_vd2(s)))));
+  }
+
+  t = s;
+  s = ddsqu_vd2_vd2(s);
+
+  vdouble s2 = vmul_vd_vd_vd(vd2getx_vd_vd2(s), vd2getx_vd_vd2(s)), s4 = vmul_vd_vd_vd(s2, s2);
+  u = vmla_vd_vd_vd_vd((s4), (vmla_vd_vd_vd_vd((vd2getx_vd_vd2(s)), (vcast_vd_d(2.72052416138529567917983e-15)), (vcast_vd_d(-7.6429259411395447190023e-13)))), (vmla_vd_vd_vd_vd((s2), (vmla_vd_vd_vd_vd((vd2getx_vd_vd2(s)), (vcast_vd_d(1.60589370117277896211623e-10)), (vcast_vd_d(-2.5052106814843123359368e-08)))), (vmla_vd_vd_vd_vd((vd2getx_vd_vd2(s)), (vcast_vd_d(2.75573192104428224777379e-06)), (vcast_vd_d(-0.000198412698412046454654947)))))))
+
+
+
+
+
+                                    ;
+  u = vmla_vd_vd_vd_vd(u, vd2getx_vd_vd2(s), vcast_vd_d(0.00833333333333318056201922));
+
+  x = ddadd_vd2_vd_vd2(vcast_vd_d(1), ddmul_vd2_vd2_vd2(ddadd_vd2_vd_vd(vcast_vd_d(-0.166666666666666657414808), vmul_vd_vd_vd(u, vd2getx_vd_vd2(s))), s));
+  u = ddmul_vd_vd2_vd2(t, x);
+
+  u = vreinterpret_vd_vm(vxor_vm_vm_vm(vand_vm_vo64_vm(vcast_vo64_vo32(veq_vo_vi_vi(vand_vi_vi_vi(ql, vcast_vi_i(2)), vcast_vi_i(0))), vreinterpret_vm_vd(vcast_vd_d(-0.0))), vreinterpret_vm_vd(u)));
+
+  return u;
+
+}
+
+SLEEF_INLINE vdouble2 Sleef_sincosd2_u35avx2128(vdouble d) {
+
+  vopmask o;
+  vdouble u, t, rx, ry, s;
+  vdouble2 r;
+  vint ql;
+
+  if (__builtin_expect(!!(vtestallones_i_vo64(vlt_vo_vd_vd(vabs_vd_vd(d), vcast_vd_d(15)))), 1)) {
+    vdouble dql = vrint_vd_vd(vmul_vd_vd_vd(d, vcast_vd_d(2 * 0.318309886183790671537767526745028724)));
+    ql = vrint_vi_vd(dql);
+    s = vmla_vd_vd_vd_vd(dql, vcast_vd_d(-3.141592653589793116 * 0.5), d);
+    s = vmla_vd_vd_vd_vd(dql, vcast_vd_d(-1.2246467991473532072e-16 * 0.5), s);
+  } else if (__builtin_expect(!!(vtestallones_i_vo64(vlt_vo_vd_vd(vabs_vd_vd(d), vcast_vd_d(1e+14)))), 1)) {
+    vdouble dqh = vtruncate_vd_vd(vmul_vd_vd_vd(d, vcast_vd_d(2*0.318309886183790671537767526745028724 / (1 << 24))));
+    dqh = vmul_vd_vd_vd(dqh, vcast_vd_d(1 << 24));
+    vdouble dql = vrint_vd_vd(vsub_vd_vd_vd(vmul_vd_vd_vd(d, vcast_vd_d(2*0.318309886183790671537767526745028724)), dqh));
+    ql = vrint_vi_vd(dql);
+
+    s = vmla_vd_vd_vd_vd(dqh, vcast_vd_d(-3.1415926218032836914 * 0.5), d);
+    s = vmla_vd_vd_vd_vd(dql, vcast_vd_d(-3.1415926218032836914 * 0.5), s);
+    s = vmla_vd_vd_vd_vd(dqh, vcast_vd_d(-3.1786509424591713469e-08 * 0.5), s);
+    s = vmla_vd_vd_vd_vd(dql, vcast_vd_d(-3.1786509424591713469e-08 * 0.5), s);
+    s = vmla_vd_vd_vd_vd(dqh, vcast_vd_d(-1.2246467864107188502e-16 * 0.5), s);
+    s = vmla_vd_vd_vd_vd(dql, vcast_vd_d(-1.2246467864107188502e-16 * 0.5), s);
+    s = vmla_vd_vd_vd_vd(vadd_vd_vd_vd(dqh, dql), vcast_vd_d(-1.2736634327021899816e-24 * 0.5), s);
+  } else {
+    ddi_t ddi = rempi(d);
+    ql = ddigeti_vi_ddi(ddi);
+    s = vadd_vd_vd_vd(vd2getx_vd_vd2(ddigetdd_vd2_ddi(ddi)), vd2gety_vd_vd2(ddigetdd_vd2_ddi(ddi)));
+    s = vreinterpret_vd_vm(vor_vm_vo64_vm(vor_vo_vo_vo(visinf_vo_vd(d), visnan_vo_vd(d)), vreinterpret_vm_vd(s)));
+  }
+
+  t = s;
+
+  s = vmul_vd_vd_vd(s, s);
+
+  u = vcast_vd_d(1.58938307283228937328511e-10);
+  u = vmla_vd_vd_vd_vd(u, s, vcast_vd_d(-2.50506943502539773349318e-08));
+  u = vmla_vd_vd_vd_vd(u, s, vcast_vd_d(2.75573131776846360512547e-06));
+  u = vmla_vd_vd_vd_vd(u, s, vcast_vd_d(-0.000198412698278911770864914));
+  u = vmla_vd_vd_vd_vd(u, s, vcast_vd_d(0.0083333333333191845961746));
+  u = vmla_vd_vd_vd_vd(u, s, vcast_vd_d(-0.166666666666666130709393));
+
+  rx = vmla_vd_vd_vd_vd(vmul_vd_vd_vd(u, s), t, t);
+  rx = vsel_vd_vo_vd_vd(visnegzero_vo_vd(d), vcast_vd_d(-0.0), rx);
+
+  u = vcast_vd_d(-1.13615350239097429531523e-11);
+  u = vmla_vd_vd_vd_vd(u, s, vcast_vd_d(2.08757471207040055479366e-09));
+  u = vmla_vd_vd_vd_vd(u, s, vcast_vd_d(-2.75573144028847567498567e-07));
+  u = vmla_vd_vd_vd_vd(u, s, vcast_vd_d(2.48015872890001867311915e-05));
+  u = vmla_vd_vd_vd_vd(u, s, vcast_vd_d(-0.00138888888888714019282329));
+  u = vmla_vd_vd_vd_vd(u, s, vcast_vd_d(0.0416666666666665519592062));
+  u = vmla_vd_vd_vd_vd(u, s, vcast_vd_d(-0.5));
+
+  ry = vmla_vd_vd_vd_vd(s, u, vcast_vd_d(1));
+
+  o = vcast_vo64_vo32(veq_vo_vi_vi(vand_vi_vi_vi(ql, vcast_vi_i(1)), vcast_vi_i(0)));
+  r = vd2setxy_vd2_vd_vd(vsel_vd_vo_vd_vd(o, rx, ry), vsel_vd_vo_vd_vd(o, ry, rx));
+
+  o = vcast_vo64_vo32(veq_vo_vi_vi(vand_vi_vi_vi(ql, vcast_vi_i(2)), vcast_vi_i(2)));
+  r = vd2setx_vd2_vd2_vd(r, vreinterpret_vd_vm(vxor_vm_vm_vm(vand_vm_vo64_vm(o, vreinterpret_vm_vd(vcast_vd_d(-0.0))), vreinterpret_vm_vd(vd2getx_vd_vd2(r)))));
+
+  o = vcast_vo64_vo32(veq_vo_vi_vi(vand_vi_vi_vi(vadd_vi_vi_vi(ql, vcast_vi_i(1)), vcast_vi_i(2)), vcast_vi_i(2)));
+  r = vd2sety_vd2_vd2_vd(r, vreinterpret_vd_vm(vxor_vm_vm_vm(vand_vm_vo64_vm(o, vreinterpret_vm_vd(vcast_vd_d(-0.0))), vreinterpret_vm_vd(vd2gety_vd_vd2(r)))));
+
+  return r;
+
+}
+
+SLEEF_INLINE vdouble2 Sleef_sincosd2_u10avx2128(vdouble d) {
+
+  vopmask o;
+  vdouble u, rx, ry;
+  vdouble2 r, s, t, x;
+  vint ql;
+
+  if (__builtin_expect(!!(vtestallones_i_vo64(vlt_vo_vd_vd(vabs_vd_vd(d), vcast_vd_d(15)))), 1)) {
+    const vdouble dql = vrint_vd_vd(vmul_vd_vd_vd(d, vcast_vd_d(2 * 0.318309886183790671537767526745028724)));
+    ql = vrint_vi_vd(dql);
+    u = vmla_vd_vd_vd_vd(dql, vcast_vd_d(-3.141592653589793116*0.5), d);
+    s = ddadd_vd2_vd_vd (u, vmul_vd_vd_vd(dql, vcast_vd_d(-1.2246467991473532072e-16*0.5)));
+  } else if (__builtin_expect(!!(vtestallones_i_vo64(vlt_vo_vd_vd(vabs_vd_vd(d), vcast_vd_d(1e+14)))), 1)) {
+    vdouble dqh = vtruncate_vd_vd(vmul_vd_vd_vd(d, vcast_vd_d(2*0.318309886183790671537767526745028724 / (1 << 24))));
+    dqh = vmul_vd_vd_vd(dqh, vcast_vd_d(1 << 24));
+    const vdouble dql = vrint_vd_vd(vsub_vd_vd_vd(vmul_vd_vd_vd(d, vcast_vd_d(2*0.318309886183790671537767526745028724)), dqh));
+    ql = vrint_vi_vd(dql);
+
+    u = vmla_vd_vd_vd_vd(dqh, vcast_vd_d(-3.1415926218032836914 * 0.5), d);
+    s = ddadd_vd2_vd_vd(u, vmul_vd_vd_vd(dql, vcast_vd_d(-3.1415926218032836914*0.5)));
+    s = ddadd2_vd2_vd2_vd(s, vmul_vd_vd_vd(dqh, vcast_vd_d(-3.1786509424591713469e-08*0.5)));
+    s = ddadd2_vd2_vd2_vd(s, vmul_vd_vd_vd(dql, vcast_vd_d(-3.1786509424591713469e-08*0.5)));
+    s = ddadd2_vd2_vd2_vd(s, vmul_vd_vd_vd(dqh, vcast_vd_d(-1.2246467864107188502e-16*0.5)));
+    s = ddadd2_vd2_vd2_vd(s, vmul_vd_vd_vd(dql, vcast_vd_d(-1.2246467864107188502e-16*0.5)));
+    s = ddadd_vd2_vd2_vd(s, vmul_vd_vd_vd(vadd_vd_vd_vd(dqh, dql), vcast_vd_d(-1.2736634327021899816e-24*0.5)));
+  } else {
+    ddi_t ddi = rempi(d);
+    ql = ddigeti_vi_ddi(ddi);
+    s = ddigetdd_vd2_ddi(ddi);
+    o = vor_vo_vo_vo(visinf_vo_vd(d), visnan_vo_vd(d));
+    s = vd2setxy_vd2_vd_vd(vreinterpret_vd_vm(vor_vm_vo64_vm(o, vreinterpret_vm_vd(vd2getx_vd_vd2(s)))),
+      vreinterpret_vd_vm(vor_vm_vo64_vm(o, vreinterpret_vm_vd(vd2gety_vd_vd2(s)))));
+  }
+
+  t = s;
+
+  s = vd2setx_vd2_vd2_vd(s, ddsqu_vd_vd2(s));
+
+  u = vcast_vd_d(1.58938307283228937328511e-10);
+  u = vmla_vd_vd_vd_vd(u, vd2getx_vd_vd2(s), vcast_vd_d(-2.50506943502539773349318e-08));
+  u = vmla_vd_vd_vd_vd(u, vd2getx_vd_vd2(s), vcast_vd_d(2.75573131776846360512547e-06));
+  u = vmla_vd_vd_vd_vd(u, vd2getx_vd_vd2(s), vcast_vd_d(-0.000198412698278911770864914));
+  u = vmla_vd_vd_vd_vd(u, vd2getx_vd_vd2(s), vcast_vd_d(0.0083333333333191845961746));
+  u = vmla_vd_vd_vd_vd(u, vd2getx_vd_vd2(s), vcast_vd_d(-0.166666666666666130709393));
+
+  u = vmul_vd_vd_vd(u, vmul_vd_vd_vd(vd2getx_vd_vd2(s), vd2getx_vd_vd2(t)));
+
+  x = ddadd_vd2_vd2_vd(t, u);
+  rx = vadd_vd_vd_vd(vd2getx_vd_vd2(x), vd2gety_vd_vd2(x));
+
+  rx = vsel_vd_vo_vd_vd(visnegzero_vo_vd(d), vcast_vd_d(-0.0), rx);
+
+  u = vcast_vd_d(-1.13615350239097429531523e-11);
+  u = vmla_vd_vd_vd_vd(u, vd2getx_vd_vd2(s), vcast_vd_d(2.08757471207040055479366e-09));
+  u = vmla_vd_vd_vd_vd(u, vd2getx_vd_vd2(s), vcast_vd_d(-2.75573144028847567498567e-07));
+  u = vmla_vd_vd_vd_vd(u, vd2getx_vd_vd2(s), vcast_vd_d(2.48015872890001867311915e-05));
+  u = vmla_vd_vd_vd_vd(u, vd2getx_vd_vd2(s), vcast_vd_d(-0.00138888888888714019282329));
+  u = vmla_vd_vd_vd_vd(u, vd2getx_vd_vd2(s), vcast_vd_d(0.0416666666666665519592062));
+  u = vmla_vd_vd_vd_vd(u, vd2getx_vd_vd2(s), vcast_vd_d(-0.5));
+
+  x = ddadd_vd2_vd_vd2(vcast_vd_d(1), ddmul_vd2_vd_vd(vd2getx_vd_vd2(s), u));
+  ry = vadd_vd_vd_vd(vd2getx_vd_vd2(x), vd2gety_vd_vd2(x));
+
+  o = vcast_vo64_vo32(veq_vo_vi_vi(vand_vi_vi_vi(ql, vcast_vi_i(1)), vcast_vi_i(0)));
+  r = vd2setxy_vd2_vd_vd(vsel_vd_vo_vd_vd(o, rx, ry), vsel_vd_vo_vd_vd(o, ry, rx));
+
+  o = vcast_vo64_vo32(veq_vo_vi_vi(vand_vi_vi_vi(ql, vcast_vi_i(2)), vcast_vi_i(2)));
+  r = vd2setx_vd2_vd2_vd(r, vreinterpret_vd_vm(vxor_vm_vm_vm(vand_vm_vo64_vm(o, vreinterpret_vm_vd(vcast_vd_d(-0.0))), vreinterpret_vm_vd(vd2getx_vd_vd2(r)))));
+
+  o = vcast_vo64_vo32(veq_vo_vi_vi(vand_vi_vi_vi(vadd_vi_vi_vi(ql, vcast_vi_i(1)), vcast_vi_i(2)), vcast_vi_i(2)));
+  r = vd2sety_vd2_vd2_vd(r, vreinterpret_vd_vm(vxor_vm_vm_vm(vand_vm_vo64_vm(o, vreinterpret_vm_vd(vcast_vd_d(-0.0))), vreinterpret_vm_vd(vd2gety_vd_vd2(r)))));
+
+  return r;
+
+}
+
+
+SLEEF_INLINE vdouble2 Sleef_sincospid2_u05avx2128(vdouble d) {
+  vopmask o;
+  vdouble u, s, t, rx, ry;
+  vdouble2 r, x, s2;
+
+  u = vmul_vd_vd_vd(d, vcast_vd_d(4.0));
+  vint q = vtruncate_vi_vd(u);
+  q = vand_vi_vi_vi(vadd_vi_vi_vi(q, vxor_vi_vi_vi(vsrl_vi_vi_i(q, 31), vcast_vi_i(1))), vcast_vi_i(~1));
+  s = vsub_vd_vd_vd(u, vcast_vd_vi(q));
+
+  t = s;
+  s = vmul_vd_vd_vd(s, s);
+  s2 = ddmul_vd2_vd_vd(t, t);
+
+  //
+
+  u = vcast_vd_d(-2.02461120785182399295868e-14);
+  u = vmla_vd_vd_vd_vd(u, s, vcast_vd_d(6.94821830580179461327784e-12));
+  u = vmla_vd_vd_vd_vd(u, s, vcast_vd_d(-1.75724749952853179952664e-09));
+  u = vmla_vd_vd_vd_vd(u, s, vcast_vd_d(3.13361688966868392878422e-07));
+  u = vmla_vd_vd_vd_vd(u, s, vcast_vd_d(-3.6576204182161551920361e-05));
+  u = vmla_vd_vd_vd_vd(u, s, vcast_vd_d(0.00249039457019271850274356));
+  x = ddadd2_vd2_vd_vd2(vmul_vd_vd_vd(u, s), vcast_vd2_d_d(-0.0807455121882807852484731, 3.61852475067037104849987e-18));
+  x = ddadd2_vd2_vd2_vd2(ddmul_vd2_vd2_vd2(s2, x), vcast_vd2_d_d(0.785398163397448278999491, 3.06287113727155002607105e-17));
+
+  x = ddmul_vd2_vd2_vd(x, t);
+  rx = vadd_vd_vd_vd(vd2getx_vd_vd2(x), vd2gety_vd_vd2(x));
+
+  rx = vsel_vd_vo_vd_vd(visnegzero_vo_vd(d), vcast_vd_d(-0.0), rx);
+
+  //
+
+  u = vcast_vd_d(9.94480387626843774090208e-16);
+  u = vmla_vd_vd_vd_vd(u, s, vcast_vd_d(-3.89796226062932799164047e-13));
+  u = vmla_vd_vd_vd_vd(u, s, vcast_vd_d(1.15011582539996035266901e-10));
+  u = vmla_vd_vd_vd_vd(u, s, vcast_vd_d(-2.4611369501044697495359e-08));
+  u = vmla_vd_vd_vd_vd(u, s, vcast_vd_d(3.59086044859052754005062e-06));
+  u = vmla_vd_vd_vd_vd(u, s, vcast_vd_d(-0.000325991886927389905997954));
+  x = ddadd2_vd2_vd_vd2(vmul_vd_vd_vd(u, s), vcast_vd2_d_d(0.0158543442438155018914259, -1.04693272280631521908845e-18));
+  x = ddadd2_vd2_vd2_vd2(ddmul_vd2_vd2_vd2(s2, x), vcast_vd2_d_d(-0.308425137534042437259529, -1.95698492133633550338345e-17));
+
+  x = ddadd2_vd2_vd2_vd(ddmul_vd2_vd2_vd2(x, s2), vcast_vd_d(1));
+  ry = vadd_vd_vd_vd(vd2getx_vd_vd2(x), vd2gety_vd_vd2(x));
+
+  //
+
+  o = vcast_vo64_vo32(veq_vo_vi_vi(vand_vi_vi_vi(q, vcast_vi_i(2)), vcast_vi_i(0)));
+  r = vd2setxy_vd2_vd_vd(vsel_vd_vo_vd_vd(o, rx, ry), vsel_vd_vo_vd_vd(o, ry, rx));
+
+  o = vcast_vo64_vo32(veq_vo_vi_vi(vand_vi_vi_vi(q, vcast_vi_i(4)), vcast_vi_i(4)));
+  r = vd2setx_vd2_vd2_vd(r, vreinterpret_vd_vm(vxor_vm_vm_vm(vand_vm_vo64_vm(o, vreinterpret_vm_vd(vcast_vd_d(-0.0))), vreinterpret_vm_vd(vd2getx_vd_vd2(r)))));
+
+  o = vcast_vo64_vo32(veq_vo_vi_vi(vand_vi_vi_vi(vadd_vi_vi_vi(q, vcast_vi_i(2)), vcast_vi_i(4)), vcast_vi_i(4)));
+  r = vd2sety_vd2_vd2_vd(r, vreinterpret_vd_vm(vxor_vm_vm_vm(vand_vm_vo64_vm(o, vreinterpret_vm_vd(vcast_vd_d(-0.0))), vreinterpret_vm_vd(vd2gety_vd_vd2(r)))));
+
+  o = vgt_vo_vd_vd(vabs_vd_vd(d), vcast_vd_d(1e+9/4));
+  r = vd2setx_vd2_vd2_vd(r, vreinterpret_vd_vm(vandnot_vm_vo64_vm(o, vreinterpret_vm_vd(vd2getx_vd_vd2(r)))));
+  r = vd2sety_vd2_vd2_vd(r, vsel_vd_vo_vd_vd(o, vcast_vd_d(1), vd2gety_vd_vd2(r)));
+
+  o = visinf_vo_vd(d);
+  r = vd2setx_vd2_vd2_vd(r, vreinterpret_vd_vm(vor_vm_vo64_vm(o, vreinterpret_vm_vd(vd2getx_vd_vd2(r)))));
+  r = vd2sety_vd2_vd2_vd(r, vreinterpret_vd_vm(vor_vm_vo64_vm(o, vreinterpret_vm_vd(vd2gety_vd_vd2(r)))));
+
+  return r;
+}
+
+SLEEF_INLINE vdouble2 Sleef_sincospid2_u35avx2128(vdouble d) {
+  vopmask o;
+  vdouble u, s, t, rx, ry;
+  vdouble2 r;
+
+  u = vmul_vd_vd_vd(d, vcast_vd_d(4.0));
+  vint q = vtruncate_vi_vd(u);
+  q = vand_vi_vi_vi(vadd_vi_vi_vi(q, vxor_vi_vi_vi(vsrl_vi_vi_i(q, 31), vcast_vi_i(1))), vcast_vi_i(~1));
+  s = vsub_vd_vd_vd(u, vcast_vd_vi(q));
+
+  t = s;
+  s = vmul_vd_vd_vd(s, s);
+
+  //
+
+  u = vcast_vd_d(+0.6880638894766060136e-11);
+  u = vmla_vd_vd_vd_vd(u, s, vcast_vd_d(-0.1757159564542310199e-8));
+  u = vmla_vd_vd_vd_vd(u, s, vcast_vd_d(+0.3133616327257867311e-6));
+  u = vmla_vd_vd_vd_vd(u, s, vcast_vd_d(-0.3657620416388486452e-4));
+  u = vmla_vd_vd_vd_vd(u, s, vcast_vd_d(+0.2490394570189932103e-2));
+  u = vmla_vd_vd_vd_vd(u, s, vcast_vd_d(-0.8074551218828056320e-1));
+  u = vmla_vd_vd_vd_vd(u, s, vcast_vd_d(+0.7853981633974482790e+0));
+
+  rx = vmul_vd_vd_vd(u, t);
+
+  //
+
+  u = vcast_vd_d(-0.3860141213683794352e-12);
+  u = vmla_vd_vd_vd_vd(u, s, vcast_vd_d(+0.1150057888029681415e-9));
+  u = vmla_vd_vd_vd_vd(u, s, vcast_vd_d(-0.2461136493006663553e-7));
+  u = vmla_vd_vd_vd_vd(u, s, vcast_vd_d(+0.3590860446623516713e-5));
+  u = vmla_vd_vd_vd_vd(u, s, vcast_vd_d(-0.3259918869269435942e-3));
+  u = vmla_vd_vd_vd_vd(u, s, vcast_vd_d(+0.1585434424381541169e-1));
+  u = vmla_vd_vd_vd_vd(u, s, vcast_vd_d(-0.3084251375340424373e+0));
+  u = vmla_vd_vd_vd_vd(u, s, vcast_vd_d(1));
+
+  ry = u;
+
+  //
+
+  o = vcast_vo64_vo32(veq_vo_vi_vi(vand_vi_vi_vi(q, vcast_vi_i(2)), vcast_vi_i(0)));
+  r = vd2setxy_vd2_vd_vd(vsel_vd_vo_vd_vd(o, rx, ry), vsel_vd_vo_vd_vd(o, ry, rx));
+
+  o = vcast_vo64_vo32(veq_vo_vi_vi(vand_vi_vi_vi(q, vcast_vi_i(4)), vcast_vi_i(4)));
+  r = vd2setx_vd2_vd2_vd(r, vreinterpret_vd_vm(vxor_vm_vm_vm(vand_vm_vo64_vm(o, vreinterpret_vm_vd(vcast_vd_d(-0.0))), vreinterpret_vm_vd(vd2getx_vd_vd2(r)))));
+
+  o = vcast_vo64_vo32(veq_vo_vi_vi(vand_vi_vi_vi(vadd_vi_vi_vi(q, vcast_vi_i(2)), vcast_vi_i(4)), vcast_vi_i(4)));
+  r = vd2sety_vd2_vd2_vd(r, vreinterpret_vd_vm(vxor_vm_vm_vm(vand_vm_vo64_vm(o, vreinterpret_vm_vd(vcast_vd_d(-0.0))), vreinterpret_vm_vd(vd2gety_vd_vd2(r)))));
+
+  o = vgt_vo_vd_vd(vabs_vd_vd(d), vcast_vd_d(1e+9/4));
+  r = vd2setx_vd2_vd2_vd(r, vreinterpret_vd_vm(vandnot_vm_vo64_vm(o, vreinterpret_vm_vd(vd2getx_vd_vd2(r)))));
+  r = vd2sety_vd2_vd2_vd(r, vreinterpret_vd_vm(vandnot_vm_vo64_vm(o, vreinterpret_vm_vd(vd2gety_vd_vd2(r)))));
+
+  o = visinf_vo_vd(d);
+  r = vd2setx_vd2_vd2_vd(r, vreinterpret_vd_vm(vor_vm_vo64_vm(o, vreinterpret_vm_vd(vd2getx_vd_vd2(r)))));
+  r = vd2sety_vd2_vd2_vd(r, vreinterpret_vd_vm(vor_vm_vo64_vm(o, vreinterpret_vm_vd(vd2gety_vd_vd2(r)))));
+
+  return r;
+}
+
+SLEEF_INLINE SLEEF_CONST vdouble2 Sleef_modfd2_avx2128(vdouble x) {
+  vdouble fr = vsub_vd_vd_vd(x, vmul_vd_vd_vd(vcast_vd_d(INT64_C(1) << 31), vcast_vd_vi(vtruncate_vi_vd(vmul_vd_vd_vd(x, vcast_vd_d(1.0 / (INT64_C(1) << 31)))))));
+  fr = vsub_vd_vd_vd(fr, vcast_vd_vi(vtruncate_vi_vd(fr)));
+  fr = vsel_vd_vo_vd_vd(vgt_vo_vd_vd(vabs_vd_vd(x), vcast_vd_d(INT64_C(1) << 52)), vcast_vd_d(0), fr);
+
+  vdouble2 ret;
+
+  ret = vd2setxy_vd2_vd_vd(vcopysign_vd_vd_vd(fr, x), vcopysign_vd_vd_vd(vsub_vd_vd_vd(x, fr), x));
+
+  return ret;
+}
+
+static SLEEF_ALWAYS_INLINE SLEEF_CONST vdouble2 sinpik(vdouble d) {
+  vopmask o;
+  vdouble u, s, t;
+  vdouble2 x, s2;
+
+  u = vmul_vd_vd_vd(d, vcast_vd_d(4.0));
+  vint q = vtruncate_vi_vd(u);
+  q = vand_vi_vi_vi(vadd_vi_vi_vi(q, vxor_vi_vi_vi(vsrl_vi_vi_i(q, 31), vcast_vi_i(1))), vcast_vi_i(~1));
+  o = vcast_vo64_vo32(veq_vo_vi_vi(vand_vi_vi_vi(q, vcast_vi_i(2)), vcast_vi_i(2)));
+
+  s = vsub_vd_vd_vd(u, vcast_vd_vi(q));
+  t = s;
+  s = vmul_vd_vd_vd(s, s);
+  s2 = ddmul_vd2_vd_vd(t, t);
+
+  //
+
+  u = vsel_vd_vo_d_d(o, 9.94480387626843774090208e-16, -2.02461120785182399295868e-14);
+  u = vmla_vd_vd_vd_vd(u, s, vsel_vd_vo_d_d(o, -3.89796226062932799164047e-13, 6.948218305801794613277840e-12));
+  u = vmla_vd_vd_vd_vd(u, s, vsel_vd_vo_d_d(o, 1.150115825399960352669010e-10, -1.75724749952853179952664e-09));
+  u = vmla_vd_vd_vd_vd(u, s, vsel_vd_vo_d_d(o, -2.46113695010446974953590e-08, 3.133616889668683928784220e-07));
+  u = vmla_vd_vd_vd_vd(u, s, vsel_vd_vo_d_d(o, 3.590860448590527540050620e-06, -3.65762041821615519203610e-05));
+  u = vmla_vd_vd_vd_vd(u, s, vsel_vd_vo_d_d(o, -0.000325991886927389905997954, 0.0024903945701927185027435600));
+  x = ddadd2_vd2_vd_vd2(vmul_vd_vd_vd(u, s),
+   vsel_vd2_vo_d_d_d_d(o, 0.0158543442438155018914259, -1.04693272280631521908845e-18,
+         -0.0807455121882807852484731, 3.61852475067037104849987e-18));
+  x = ddadd2_vd2_vd2_vd2(ddmul_vd2_vd2_vd2(s2, x),
+    vsel_vd2_vo_d_d_d_d(o, -0.308425137534042437259529, -1.95698492133633550338345e-17,
+          0.785398163397448278999491, 3.06287113727155002607105e-17));
+
+  x = ddmul_vd2_vd2_vd2(x, vsel_vd2_vo_vd2_vd2(o, s2, vcast_vd2_vd_vd(t, vcast_vd_d(0))));
+  x = vsel_vd2_vo_vd2_vd2(o, ddadd2_vd2_vd2_vd(x, vcast_vd_d(1)), x);
+
+  o = vcast_vo64_vo32(veq_vo_vi_vi(vand_vi_vi_vi(q, vcast_vi_i(4)), vcast_vi_i(4)));
+  x = vd2setx_vd2_vd2_vd(x, vreinterpret_vd_vm(vxor_vm_vm_vm(vand_vm_vo64_vm(o, vreinterpret_vm_vd(vcast_vd_d(-0.0))), vreinterpret_vm_vd(vd2getx_vd_vd2(x)))));
+  x = vd2sety_vd2_vd2_vd(x, vreinterpret_vd_vm(vxor_vm_vm_vm(vand_vm_vo64_vm(o, vreinterpret_vm_vd(vcast_vd_d(-0.0))), vreinterpret_vm_vd(vd2gety_vd_vd2(x)))));
+
+  return x;
+}
+
+SLEEF_INLINE SLEEF_CONST vdouble Sleef_sinpid2_u05avx2128(vdouble d) {
+  vdouble2 x = sinpik(d);
+  vdouble r = vadd_vd_vd_vd(vd2getx_vd_vd2(x), vd2gety_vd_vd2(x));
+
+  r = vsel_vd_vo_vd_vd(visnegzero_vo_vd(d), vcast_vd_d(-0.0), r);
+  r = vreinterpret_vd_vm(vandnot_vm_vo64_vm(vgt_vo_vd_vd(vabs_vd_vd(d), vcast_vd_d(1e+9/4)), vreinterpret_vm_vd(r)));
+  r = vreinterpret_vd_vm(vor_vm_vo64_vm(visinf_vo_vd(d), vreinterpret_vm_vd(r)));
+
+  return r;
+}
+
+static SLEEF_ALWAYS_INLINE SLEEF_CONST vdouble2 cospik(vdouble d) {
+  vopmask o;
+  vdouble u, s, t;
+  vdouble2 x, s2;
+
+  u = vmul_vd_vd_vd(d, vcast_vd_d(4.0));
+  vint q = vtruncate_vi_vd(u);
+  q = vand_vi_vi_vi(vadd_vi_vi_vi(q, vxor_vi_vi_vi(vsrl_vi_vi_i(q, 31), vcast_vi_i(1))), vcast_vi_i(~1));
+  o = vcast_vo64_vo32(veq_vo_vi_vi(vand_vi_vi_vi(q, vcast_vi_i(2)), vcast_vi_i(0)));
+
+  s = vsub_vd_vd_vd(u, vcast_vd_vi(q));
+  t = s;
+  s = vmul_vd_vd_vd(s, s);
+  s2 = ddmul_vd2_vd_vd(t, t);
+
+  //
+
+  u = vsel_vd_vo_d_d(o, 9.94480387626843774090208e-16, -2.02461120785182399295868e-14);
+  u = vmla_vd_vd_vd_vd(u, s, vsel_vd_vo_d_d(o, -3.89796226062932799164047e-13, 6.948218305801794613277840e-12));
+  u = vmla_vd_vd_vd_vd(u, s, vsel_vd_vo_d_d(o, 1.150115825399960352669010e-10, -1.75724749952853179952664e-09));
+  u = vmla_vd_vd_vd_vd(u, s, vsel_vd_vo_d_d(o, -2.46113695010446974953590e-08, 3.133616889668683928784220e-07));
+  u = vmla_vd_vd_vd_vd(u, s, vsel_vd_vo_d_d(o, 3.590860448590527540050620e-06, -3.65762041821615519203610e-05));
+  u = vmla_vd_vd_vd_vd(u, s, vsel_vd_vo_d_d(o, -0.000325991886927389905997954, 0.0024903945701927185027435600));
+  x = ddadd2_vd2_vd_vd2(vmul_vd_vd_vd(u, s),
+   vsel_vd2_vo_d_d_d_d(o, 0.0158543442438155018914259, -1.04693272280631521908845e-18,
+         -0.0807455121882807852484731, 3.61852475067037104849987e-18));
+  x = ddadd2_vd2_vd2_vd2(ddmul_vd2_vd2_vd2(s2, x),
+    vsel_vd2_vo_d_d_d_d(o, -0.308425137534042437259529, -1.95698492133633550338345e-17,
+          0.785398163397448278999491, 3.06287113727155002607105e-17));
+
+  x = ddmul_vd2_vd2_vd2(x, vsel_vd2_vo_vd2_vd2(o, s2, vcast_vd2_vd_vd(t, vcast_vd_d(0))));
+  x = vsel_vd2_vo_vd2_vd2(o, ddadd2_vd2_vd2_vd(x, vcast_vd_d(1)), x);
+
+  o = vcast_vo64_vo32(veq_vo_vi_vi(vand_vi_vi_vi(vadd_vi_vi_vi(q, vcast_vi_i(2)), vcast_vi_i(4)), vcast_vi_i(4)));
+  x = vd2setx_vd2_vd2_vd(x, vreinterpret_vd_vm(vxor_vm_vm_vm(vand_vm_vo64_vm(o, vreinterpret_vm_vd(vcast_vd_d(-0.0))), vreinterpret_vm_vd(vd2getx_vd_vd2(x)))));
+  x = vd2sety_vd2_vd2_vd(x, vreinterpret_vd_vm(vxor_vm_vm_vm(vand_vm_vo64_vm(o, vreinterpret_vm_vd(vcast_vd_d(-0.0))), vreinterpret_vm_vd(vd2gety_vd_vd2(x)))));
+
+  return x;
+}
+
+SLEEF_INLINE SLEEF_CONST vdouble Sleef_cospid2_u05avx2128(vdouble d) {
+  vdouble2 x = cospik(d);
+  vdouble r = vadd_vd_vd_vd(vd2getx_vd_vd2(x), vd2gety_vd_vd2(x));
+
+  r = vsel_vd_vo_vd_vd(vgt_vo_vd_vd(vabs_vd_vd(d), vcast_vd_d(1e+9/4)), vcast_vd_d(1), r);
+  r = vreinterpret_vd_vm(vor_vm_vo64_vm(visinf_vo_vd(d), vreinterpret_vm_vd(r)));
+
+  return r;
+}
+
+SLEEF_INLINE SLEEF_CONST vdouble Sleef_tand2_u35avx2128(vdouble d) {
+
+  vdouble u, s, x, y;
+  vopmask o;
+  vint ql;
+
+  if (__builtin_expect(!!(vtestallones_i_vo64(vlt_vo_vd_vd(vabs_vd_vd(d), vcast_vd_d(15)))), 1)) {
+    vdouble dql = vrint_vd_vd(vmul_vd_vd_vd(d, vcast_vd_d(2 * 0.318309886183790671537767526745028724)));
+    ql = vrint_vi_vd(dql);
+    x = vmla_vd_vd_vd_vd(dql, vcast_vd_d(-3.141592653589793116 * 0.5), d);
+    x = vmla_vd_vd_vd_vd(dql, vcast_vd_d(-1.2246467991473532072e-16 * 0.5), x);
+  } else if (__builtin_expect(!!(vtestallones_i_vo64(vlt_vo_vd_vd(vabs_vd_vd(d), vcast_vd_d(1e+6)))), 1)) {
+    vdouble dqh = vtruncate_vd_vd(vmul_vd_vd_vd(d, vcast_vd_d(2*0.318309886183790671537767526745028724 / (1 << 24))));
+    dqh = vmul_vd_vd_vd(dqh, vcast_vd_d(1 << 24));
+    vdouble dql = vrint_vd_vd(vsub_vd_vd_vd(vmul_vd_vd_vd(d, vcast_vd_d(2*0.318309886183790671537767526745028724)), dqh));
+    ql = vrint_vi_vd(dql);
+
+    x = vmla_vd_vd_vd_vd(dqh, vcast_vd_d(-3.1415926218032836914 * 0.5), d);
+    x = vmla_vd_vd_vd_vd(dql, vcast_vd_d(-3.1415926218032836914 * 0.5), x);
+    x = vmla_vd_vd_vd_vd(dqh, vcast_vd_d(-3.1786509424591713469e-08 * 0.5), x);
+    x = vmla_vd_vd_vd_vd(dql, vcast_vd_d(-3.1786509424591713469e-08 * 0.5), x);
+    x = vmla_vd_vd_vd_vd(dqh, vcast_vd_d(-1.2246467864107188502e-16 * 0.5), x);
+    x = vmla_vd_vd_vd_vd(dql, vcast_vd_d(-1.2246467864107188502e-16 * 0.5), x);
+    x = vmla_vd_vd_vd_vd(vadd_vd_vd_vd(dqh, dql), vcast_vd_d(-1.2736634327021899816e-24 * 0.5), x);
+  } else {
+    ddi_t ddi = rempi(d);
+    ql = ddigeti_vi_ddi(ddi);
+    x = vadd_vd_vd_vd(vd2getx_vd_vd2(ddigetdd_vd2_ddi(ddi)), vd2gety_vd_vd2(ddigetdd_vd2_ddi(ddi)));
+    x = vreinterpret_vd_vm(vor_vm_vo64_vm(visinf_vo_vd(d), vreinterpret_vm_vd(x)));
+    x = vreinterpret_vd_vm(vor_vm_vo64_vm(vor_vo_vo_vo(visinf_vo_vd(d), visnan_vo_vd(d)), vreinterpret_vm_vd(x)));
+  }
+
+  x = vmul_vd_vd_vd(x, vcast_vd_d(0.5));
+  s = vmul_vd_vd_vd(x, x);
+
+  vdouble s2 = vmul_vd_vd_vd(s, s), s4 = vmul_vd_vd_vd(s2, s2);
+  u = vmla_vd_vd_vd_vd((s4), (vmla_vd_vd_vd_vd((s2), (vmla_vd_vd_vd_vd((s), (vcast_vd_d(+0.3245098826639276316e-3)), (vcast_vd_d(+0.5619219738114323735e-3)))), (vmla_vd_vd_vd_vd((s), (vcast_vd_d(+0.1460781502402784494e-2)), (vcast_vd_d(+0.3591611540792499519e-2)))))), (vmla_vd_vd_vd_vd((s2), (vmla_vd_vd_vd_vd((s), (vcast_vd_d(+0.8863268409563113126e-2)), (vcast_vd_d(+0.2186948728185535498e-1)))), (vmla_vd_vd_vd_vd((s), (vcast_vd_d(+0.5396825399517272970e-1)), (vcast_vd_d(+0.1333333333330500581e+0)))))))
+
+
+
+
+
+
+
+                                ;
+
+  u = vmla_vd_vd_vd_vd(u, s, vcast_vd_d(+0.3333333333333343695e+0));
+  u = vmla_vd_vd_vd_vd(s, vmul_vd_vd_vd(u, x), x);
+
+  y = vmla_vd_vd_vd_vd(u, u, vcast_vd_d(-1));
+  x = vmul_vd_vd_vd(u, vcast_vd_d(-2));
+
+  o = vcast_vo64_vo32(veq_vo_vi_vi(vand_vi_vi_vi(ql, vcast_vi_i(1)), vcast_vi_i(1)));
+  u = vdiv_vd_vd_vd(vsel_vd_vo_vd_vd(o, vneg_vd_vd(y), x),
+      vsel_vd_vo_vd_vd(o, x, y));
+  u = vsel_vd_vo_vd_vd(veq_vo_vd_vd(d, vcast_vd_d(0)), d, u);
+
+  return u;
+
+}
+
+SLEEF_INLINE SLEEF_CONST vdouble Sleef_tand2_u10avx2128(vdouble d) {
+
+  vdouble u;
+  vdouble2 s, t, x, y;
+  vopmask o;
+  vint ql;
+
+  if (__builtin_expect(!!(vtestallones_i_vo64(vlt_vo_vd_vd(vabs_vd_vd(d), vcast_vd_d(15)))), 1)) {
+    vdouble dql = vrint_vd_vd(vmul_vd_vd_vd(d, vcast_vd_d(2 * 0.318309886183790671537767526745028724)));
+    ql = vrint_vi_vd(dql);
+    u = vmla_vd_vd_vd_vd(dql, vcast_vd_d(-3.141592653589793116*0.5), d);
+    s = ddadd_vd2_vd_vd (u, vmul_vd_vd_vd(dql, vcast_vd_d(-1.2246467991473532072e-16*0.5)));
+  } else if (__builtin_expect(!!(vtestallones_i_vo64(vlt_vo_vd_vd(vabs_vd_vd(d), vcast_vd_d(1e+14)))), 1)) {
+    vdouble dqh = vtruncate_vd_vd(vmul_vd_vd_vd(d, vcast_vd_d(2*0.318309886183790671537767526745028724 / (1 << 24))));
+    dqh = vmul_vd_vd_vd(dqh, vcast_vd_d(1 << 24));
+    s = ddadd2_vd2_vd2_vd(ddmul_vd2_vd2_vd(vcast_vd2_d_d(0.63661977236758138243, -3.9357353350364971764e-17), d),
+     vsub_vd_vd_vd(vsel_vd_vo_vd_vd(vlt_vo_vd_vd(d, vcast_vd_d(0)),
+        vcast_vd_d(-0.5), vcast_vd_d(0.5)), dqh));
+    const vdouble dql = vtruncate_vd_vd(vadd_vd_vd_vd(vd2getx_vd_vd2(s), vd2gety_vd_vd2(s)));
+    ql = vrint_vi_vd(dql);
+
+    u = vmla_vd_vd_vd_vd(dqh, vcast_vd_d(-3.1415926218032836914 * 0.5), d);
+    s = ddadd_vd2_vd_vd(u, vmul_vd_vd_vd(dql, vcast_vd_d(-3.1415926218032836914*0.5 )));
+    s = ddadd2_vd2_vd2_vd(s, vmul_vd_vd_vd(dqh, vcast_vd_d(-3.1786509424591713469e-08*0.5)));
+    s = ddadd2_vd2_vd2_vd(s, vmul_vd_vd_vd(dql, vcast_vd_d(-3.1786509424591713469e-08*0.5 )));
+    s = ddadd2_vd2_vd2_vd(s, vmul_vd_vd_vd(dqh, vcast_vd_d(-1.2246467864107188502e-16*0.5)));
+    s = ddadd2_vd2_vd2_vd(s, vmul_vd_vd_vd(dql, vcast_vd_d(-1.2246467864107188502e-16*0.5 )));
+    s = ddadd_vd2_vd2_vd(s, vmul_vd_vd_vd(vadd_vd_vd_vd(dqh, dql), vcast_vd_d(-1.2736634327021899816e-24*0.5)));
+  } else {
+    ddi_t ddi = rempi(d);
+    ql = ddigeti_vi_ddi(ddi);
+    s = ddigetdd_vd2_ddi(ddi);
+    o = vor_vo_vo_vo(visinf_vo_vd(d), visnan_vo_vd(d));
+    s = vd2setx_vd2_vd2_vd(s, vreinterpret_vd_vm(vor_vm_vo64_vm(o, vreinterpret_vm_vd(vd2getx_vd_vd2(s)))));
+    s = vd2sety_vd2_vd2_vd(s, vreinterpret_vd_vm(vor_vm_vo64_vm(o, vreinterpret_vm_vd(vd2gety_vd_vd2(s)))));
+  }
+
+  t = ddscale_vd2_vd2_vd(s, vcast_vd_d(0.5));
+  s = ddsqu_vd2_vd2(t);
+
+  vdouble s2 = vmul_vd_vd_vd(vd2getx_vd_vd2(s), vd2getx_vd_vd2(s)), s4 = vmul_vd_vd_vd(s2, s2);
+  u = vmla_vd_vd_vd_vd((s4), (vmla_vd_vd_vd_vd((s2), (vmla_vd_vd_vd_vd((vd2getx_vd_vd2(s)), (vcast_vd_d(+0.3245098826639276316e-3)), (vcast_vd_d(+0.5619219738114323735e-3)))), (vmla_vd_vd_vd_vd((vd2getx_vd_vd2(s)), (vcast_vd_d(+0.1460781502402784494e-2)), (vcast_vd_d(+0.3591611540792499519e-2)))))), (vmla_vd_vd_vd_vd((s2), (vmla_vd_vd_vd_vd((vd2getx_vd_vd2(s)), (vcast_vd_d(+0.8863268409563113126e-2)), (vcast_vd_d(+0.2186948728185535498e-1)))), (vmla_vd_vd_vd_vd((vd2getx_vd_vd2(s)), (vcast_vd_d(+0.5396825399517272970e-1)), (vcast_vd_d(+0.1333333333330500581e+0)))))))
+
+
+
+
+
+
+
+                                ;
+
+  u = vmla_vd_vd_vd_vd(u, vd2getx_vd_vd2(s), vcast_vd_d(+0.3333333333333343695e+0));
+  x = ddadd_vd2_vd2_vd2(t, ddmul_vd2_vd2_vd(ddmul_vd2_vd2_vd2(s, t), u));
+
+  y = ddadd_vd2_vd_vd2(vcast_vd_d(-1), ddsqu_vd2_vd2(x));
+  x = ddscale_vd2_vd2_vd(x, vcast_vd_d(-2));
+
+  o = vcast_vo64_vo32(veq_vo_vi_vi(vand_vi_vi_vi(ql, vcast_vi_i(1)), vcast_vi_i(1)));
+
+  x = dddiv_vd2_vd2_vd2(vsel_vd2_vo_vd2_vd2(o, ddneg_vd2_vd2(y), x),
+   vsel_vd2_vo_vd2_vd2(o, x, y));
+
+  u = vadd_vd_vd_vd(vd2getx_vd_vd2(x), vd2gety_vd_vd2(x));
+
+  u = vsel_vd_vo_vd_vd(veq_vo_vd_vd(d, vcast_vd_d(0)), d, u);
+
+  return u;
+
+}
+
+
+// The following functions assume that the argument is in
+// [-TRIGRANGEMAX2, TRIGRANGEMAX2], and perform only the first
+// argument reduction of xsin, xcos, xsincos and xtan. They have no
+// branch, and do not carry the code for the larger arguments. The
+// returned values are unspecified if the argument is out of the
+// range. The normal and deterministic versions are common.
+
+SLEEF_INLINE SLEEF_CONST vdouble Sleef_sinrd2_u35avx2128(vdouble d) {
+  vdouble u, s, r = d;
+
+  vdouble dql = vrint_vd_vd(vmul_vd_vd_vd(d, vcast_vd_d(0.318309886183790671537767526745028724)));
+  vint ql = vrint_vi_vd(dql);
+  d = vmla_vd_vd_vd_vd(dql, vcast_vd_d(-3.141592653589793116), d);
+  d = vmla_vd_vd_vd_vd(dql, vcast_vd_d(-1.2246467991473532072e-16), d);
+
+  s = vmul_vd_vd_vd(d, d);
+
+  d = vreinterpret_vd_vm(vxor_vm_vm_vm(vand_vm_vo64_vm(vcast_vo64_vo32(veq_vo_vi_vi(vand_vi_vi_vi(ql, vcast_vi_i(1)), vcast_vi_i(1))), vreinterpret_vm_vd(vcast_vd_d(-0.0))), vreinterpret_vm_vd(d)));
+
+  vdouble s2 = vmul_vd_vd_vd(s, s), s4 = vmul_vd_vd_vd(s2, s2);
+  u = vmla_vd_vd_vd_vd((s4), (vmla_vd_vd_vd_vd((s2), (vmla_vd_vd_vd_vd((s), (vcast_vd_d(-7.97255955009037868891952e-18)), (vcast_vd_d(2.81009972710863200091251e-15)))), (vmla_vd_vd_vd_vd((s), (vcast_vd_d(-7.64712219118158833288484e-13)), (vcast_vd_d(1.60590430605664501629054e-10)))))), (vmla_vd_vd_vd_vd((s2), (vmla_vd_vd_vd_vd((s), (vcast_vd_d(-2.50521083763502045810755e-08)), (vcast_vd_d(2.75573192239198747630416e-06)))), (vmla_vd_vd_vd_vd((s), (vcast_vd_d(-0.000198412698412696162806809)), (vcast_vd_d(0.00833333333333332974823815)))))))
+
+
+
+
+
+
+
+                                  ;
+  u = vmla_vd_vd_vd_vd(u, s, vcast_vd_d(-0.166666666666666657414808));
+
+  u = vadd_vd_vd_vd(vmul_vd_vd_vd(s, vmul_vd_vd_vd(u, d)), d);
+
+  return vsel_vd_vo_vd_vd(visnegzero_vo_vd(r), r, u);
+}
+
+SLEEF_INLINE SLEEF_CONST vdouble Sleef_cosrd2_u35avx2128(vdouble d) {
+  vdouble u, s;
+
+  vdouble dql = vmla_vd_vd_vd_vd(vcast_vd_d(2),
+     vrint_vd_vd(vmla_vd_vd_vd_vd(d, vcast_vd_d(0.318309886183790671537767526745028724), vcast_vd_d(-0.5))),
+     vcast_vd_d(1));
+  vint ql = vrint_vi_vd(dql);
+  d = vmla_vd_vd_vd_vd(dql, vcast_vd_d(-3.141592653589793116 * 0.5), d);
+  d = vmla_vd_vd_vd_vd(dql, vcast_vd_d(-1.2246467991473532072e-16 * 0.5), d);
+
+  s = vmul_vd_vd_vd(d, d);
+
+  d = vreinterpret_vd_vm(vxor_vm_vm_vm(vand_vm_vo64_vm(vcast_vo64_vo32(veq_vo_vi_vi(vand_vi_vi_vi(ql, vcast_vi_i(2)), vcast_vi_i(0))), vreinterpret_vm_vd(vcast_vd_d(-0.0))), vreinterpret_vm_vd(d)));
+
+  vdouble s2 = vmul_vd_vd_vd(s, s), s4 = vmul_vd_vd_vd(s2, s2);
+  u = vmla_vd_vd_vd_vd((s4), (vmla_vd_vd_vd_vd((s2), (vmla_vd_vd_vd_vd((s), (vcast_vd_d(-7.97255955009037868891952e-18)), (vcast_vd_d(2.81009972710863200091251e-15)))), (vmla_vd_vd_vd_vd((s), (vcast_vd_d(-7.64712219118158833288484e-13)), (vcast_vd_d(1.60590430605664501629054e-10)))))), (vmla_vd_vd_vd_vd((s2), (vmla_vd_vd_vd_vd((s), (vcast_vd_d(-2.50521083763502045810755e-08)), (vcast_vd_d(2.75573192239198747630416e-06)))), (vmla_vd_vd_vd_vd((s), (vcast_vd_d(-0.000198412698412696162806809)), (vcast_vd_d(0.00833333333333332974823815)))))))
+
+
+
+
+
+
+
+                                  ;
+  u = vmla_vd_vd_vd_vd(u, s, vcast_vd_d(-0.166666666666666657414808));
+
+  return vadd_vd_vd_vd(vmul_vd_vd_vd(s, vmul_vd_vd_vd(u, d)), d);
+}
+
+SLEEF_INLINE SLEEF_CONST vdouble2 Sleef_sincosrd2_u35avx2128(vdouble d) {
+  vopmask o;
+  vdouble u, t, rx, ry, s;
+  vdouble2 r;
+
+  vdouble dql = vrint_vd_vd(vmul_vd_vd_vd(d, vcast_vd_d(2 * 0.318309886183790671537767526745028724)));
+  vint ql = vrint_vi_vd(dql);
+  s = vmla_vd_vd_vd_vd(dql, vcast_vd_d(-3.141592653589793116 * 0.5), d);
+  s = vmla_vd_vd_vd_vd(dql, vcast_vd_d(-1.2246467991473532072e-16 * 0.5), s);
+
+  t = s;
+
+  s = vmul_vd_vd_vd(s, s);
+
+  u = vcast_vd_d(1.58938307283228937328511e-10);
+  u = vmla_vd_vd_vd_vd(u, s, vcast_vd_d(-2.50506943502539773349318e-08));
+  u = vmla_vd_vd_vd_vd(u, s, vcast_vd_d(2.75573131776846360512547e-06));
+  u = vmla_vd_vd_vd_vd(u, s, vcast_vd_d(-0.000198412698278911770864914));
+  u = vmla_vd_vd_vd_vd(u, s, vcast_vd_d(0.0083333333333191845961746));
+  u = vmla_vd_vd_vd_vd(u, s, vcast_vd_d(-0.166666666666666130709393));
+
+  rx = vmla_vd_vd_vd_vd(vmul_vd_vd_vd(u, s), t, t);
+  rx = vsel_vd_vo_vd_vd(visnegzero_vo_vd(d), vcast_vd_d(-0.0), rx);
+
+  u = vcast_vd_d(-1.13615350239097429531523e-11);
+  u = vmla_vd_vd_vd_vd(u, s, vcast_vd_d(2.08757471207040055479366e-09));
+  u = vmla_vd_vd_vd_vd(u, s, vcast_vd_d(-2.75573144028847567498567e-07));
+  u = vmla_vd_vd_vd_vd(u, s, vcast_vd_d(2.48015872890001867311915e-05));
+  u = vmla_vd_vd_vd_vd(u, s, vcast_vd_d(-0.00138888888888714019282329));
+  u = vmla_vd_vd_vd_vd(u, s, vcast_vd_d(0.0416666666666665519592062));
+  u = vmla_vd_vd_vd_vd(u, s, vcast_vd_d(-0.5));
+
+  ry = vmla_vd_vd_vd_vd(s, u, vcast_vd_d(1));
+
+  o = vcast_vo64_vo32(veq_vo_vi_vi(vand_vi_vi_vi(ql, vcast_vi_i(1)), vcast_vi_i(0)));
+  r = vd2setxy_vd2_vd_vd(vsel_vd_vo_vd_vd(o, rx, ry), vsel_vd_vo_vd_vd(o, ry, rx));
+
+  o = vcast_vo64_vo32(veq_vo_vi_vi(vand_vi_vi_vi(ql, vcast_vi_i(2)), vcast_vi_i(2)));
+  r = vd2setx_vd2_vd2_vd(r, vreinterpret_vd_vm(vxor_vm_vm_vm(vand_vm_vo64_vm(o, vreinterpret_vm_vd(vcast_vd_d(-0.0))), vreinterpret_vm_vd(vd2getx_vd_vd2(r)))));
+
+  o = vcast_vo64_vo32(veq_vo_vi_vi(vand_vi_vi_vi(vadd_vi_vi_vi(ql, vcast_vi_i(1)), vcast_vi_i(2)), vcast_vi_i(2)));
+  r = vd2sety_vd2_vd2_vd(r, vreinterpret_vd_vm(vxor_vm_vm_vm(vand_vm_vo64_vm(o, vreinterpret_vm_vd(vcast_vd_d(-0.0))), vreinterpret_vm_vd(vd2gety_vd_vd2(r)))));
+
+  return r;
+}
+
+SLEEF_INLINE SLEEF_CONST vdouble Sleef_tanrd2_u35avx2128(vdouble d) {
+  vdouble u, s, x, y;
+  vopmask o;
+
+  vdouble dql = vrint_vd_vd(vmul_vd_vd_vd(d, vcast_vd_d(2 * 0.318309886183790671537767526745028724)));
+  vint ql = vrint_vi_vd(dql);
+  x = vmla_vd_vd_vd_vd(dql, vcast_vd_d(-3.141592653589793116 * 0.5), d);
+  x = vmla_vd_vd_vd_vd(dql, vcast_vd_d(-1.2246467991473532072e-16 * 0.5), x);
+
+  x = vmul_vd_vd_vd(x, vcast_vd_d(0.5));
+  s = vmul_vd_vd_vd(x, x);
+
+  vdouble s2 = vmul_vd_vd_vd(s, s), s4 = vmul_vd_vd_vd(s2, s2);
+  u = vmla_vd_vd_vd_vd((s4), (vmla_vd_vd_vd_vd((s2), (vmla_vd_vd_vd_vd((s), (vcast_vd_d(+0.3245098826639276316e-3)), (vcast_vd_d(+0.5619219738114323735e-3)))), (vmla_vd_vd_vd_vd((s), (vcast_vd_d(+0.1460781502402784494e-2)), (vcast_vd_d(+0.3591611540792499519e-2)))))), (vmla_vd_vd_vd_vd((s2), (vmla_vd_vd_vd_vd((s), (vcast_vd_d(+0.8863268409563113126e-2)), (vcast_vd_d(+0.2186948728185535498e-1)))), (vmla_vd_vd_vd_vd((s), (vcast_vd_d(+0.5396825399517272970e-1)), (vcast_vd_d(+0.1333333333330500581e+0)))))))
+
+
+
+
+
+
+
+                                ;
+
+  u = vmla_vd_vd_vd_vd(u, s, vcast_vd_d(+0.3333333333333343695e+0));
+  u = vmla_vd_vd_vd_vd(s, vmul_vd_vd_vd(u, x), x);
+
+  y = vmla_vd_vd_vd_vd(u, u, vcast_vd_d(-1));
+  x = vmul_vd_vd_vd(u, vcast_vd_d(-2));
+
+  o = vcast_vo64_vo32(veq_vo_vi_vi(vand_vi_vi_vi(ql, vcast_vi_i(1)), vcast_vi_i(1)));
+  u = vdiv_vd_vd_vd(vsel_vd_vo_vd_vd(o, vneg_vd_vd(y), x),
+      vsel_vd_vo_vd_vd(o, x, y));
+
+  return vsel_vd_vo_vd_vd(veq_vo_vd_vd(d, vcast_vd_d(0)), d, u);
+}
+
+
+static SLEEF_ALWAYS_INLINE SLEEF_CONST vdouble atan2k(vdouble y, vdouble x) {
+  vdouble s, t, u;
+  vint q;
+  vopmask p;
+
+  q = vsel_vi_vd_vi(x, vcast_vi_i(-2));
+  x = vabs_vd_vd(x);
+
+  q = vsel_vi_vd_vd_vi_vi(x, y, vadd_vi_vi_vi(q, vcast_vi_i(1)), q);
+  p = vlt_vo_vd_vd(x, y);
+  s = vsel_vd_vo_vd_vd(p, vneg_vd_vd(x), y);
+  t = vmax_vd_vd_vd(x, y);
+
+  s = vdiv_vd_vd_vd(s, t);
+  t = vmul_vd_vd_vd(s, s);
+
+  vdouble t2 = vmul_vd_vd_vd(t, t), t4 = vmul_vd_vd_vd(t2, t2), t8 = vmul_vd_vd_vd(t4, t4), t16 = vmul_vd_vd_vd(t8, t8);
+  u = vmla_vd_vd_vd_vd((t16), (vmla_vd_vd_vd_vd((t2), (vcast_vd_d(-1.88796008463073496563746e-05)), (vmla_vd_vd_vd_vd((t), (vcast_vd_d(0.000209850076645816976906797)), (vcast_vd_d(-0.00110611831486672482563471)))))), (vmla_vd_vd_vd_vd((t8), (vmla_vd_vd_vd_vd((t4), (vmla_vd_vd_vd_vd((t2), (vmla_vd_vd_vd_vd((t), (vcast_vd_d(0.00370026744188713119232403)), (vcast_vd_d(-0.00889896195887655491740809)))), (vmla_vd_vd_vd_vd((t), (vcast_vd_d(0.016599329773529201970117)), (vcast_vd_d(-0.0254517624932312641616861)))))), (vmla_vd_vd_vd_vd((t2), (vmla_vd_vd_vd_vd((t), (vcast_vd_d(0.0337852580001353069993897)), (vcast_vd_d(-0.0407629191276836500001934)))), (vmla_vd_vd_vd_vd((t), (vcast_vd_d(0.0466667150077840625632675)), (vcast_vd_d(-0.0523674852303482457616113)))))))), (vmla_vd_vd_vd_vd((t4), (vmla_vd_vd_vd_vd((t2), (vmla_vd_vd_vd_vd((t), (vcast_vd_d(0.0587666392926673580854313)), (vcast_vd_d(-0.0666573579361080525984562)))), (vmla_vd_vd_vd_vd((t), (vcast_vd_d(0.0769219538311769618355029)), (vcast_vd_d(-0.090908995008245008229153)))))), (vmla_vd_vd_vd_vd((t2), (vmla_vd_vd_vd_vd((t), (vcast_vd_d(0.111111105648261418443745)), (vcast_vd_d(-0.14285714266771329383765)))), (vmla_vd_vd_vd_vd((t), (vcast_vd_d(0.199999999996591265594148)), (vcast_vd_d(-0.333333333333311110369124)))))))))))
+
+                                  ;
+
+  t = vmla_vd_vd_vd_vd(s, vmul_vd_vd_vd(t, u), s);
+  t = vmla_vd_vd_vd_vd(vcast_vd_vi(q), vcast_vd_d(3.141592653589793238462643383279502884/2), t);
+
+  return t;
+}
+
+static SLEEF_ALWAYS_INLINE SLEEF_CONST vdouble2 atan2k_u1(vdouble2 y, vdouble2 x) {
+  vdouble u;
+  vdouble2 s, t;
+  vint q;
+  vopmask p;
+
+  q = vsel_vi_vd_vi(vd2getx_vd_vd2(x), vcast_vi_i(-2));
+  p = vlt_vo_vd_vd(vd2getx_vd_vd2(x), vcast_vd_d(0));
+  vmask b = vand_vm_vo64_vm(p, vreinterpret_vm_vd(vcast_vd_d(-0.0)));
+  x = vd2setx_vd2_vd2_vd(x, vreinterpret_vd_vm(vxor_vm_vm_vm(b, vreinterpret_vm_vd(vd2getx_vd_vd2(x)))));
+  x = vd2sety_vd2_vd2_vd(x, vreinterpret_vd_vm(vxor_vm_vm_vm(b, vreinterpret_vm_vd(vd2gety_vd_vd2(x)))));
+
+  q = vsel_vi_vd_vd_vi_vi(vd2getx_vd_vd2(x), vd2getx_vd_vd2(y), vadd_vi_vi_vi(q, vcast_vi_i(1)), q);
+  p = vlt_vo_vd_vd(vd2getx_vd_vd2(x), vd2getx_vd_vd2(y));
+  s = vsel_vd2_vo_vd2_vd2(p, ddneg_vd2_vd2(x), y);
+  t = vsel_vd2_vo_vd2_vd2(p, y, x);
+
+  s = dddiv_vd2_vd2_vd2(s, t);
+  t = ddsqu_vd2_vd2(s);
+  t = ddnormalize_vd2_vd2(t);
+
+  vdouble t2 = vmul_vd_vd_vd(vd2getx_vd_vd2(t), vd2getx_vd_vd2(t)), t4 = vmul_vd_vd_vd(t2, t2), t8 = vmul_vd_vd_vd(t4, t4);
+  u = vmla_vd_vd_vd_vd((t8), (vmla_vd_vd_vd_vd((t4), (vmla_vd_vd_vd_vd((t2), (vmla_vd_vd_vd_vd((vd2getx_vd_vd2(t)), (vcast_vd_d(1.06298484191448746607415e-05)), (vcast_vd_d(-0.000125620649967286867384336)))), (vmla_vd_vd_vd_vd((vd2getx_vd_vd2(t)), (vcast_vd_d(0.00070557664296393412389774)), (vcast_vd_d(-0.00251865614498713360352999)))))), (vmla_vd_vd_vd_vd((t2), (vmla_vd_vd_vd_vd((vd2getx_vd_vd2(t)), (vcast_vd_d(0.00646262899036991172313504)), (vcast_vd_d(-0.0128281333663399031014274)))), (vmla_vd_vd_vd_vd((vd2getx_vd_vd2(t)), (vcast_vd_d(0.0208024799924145797902497)), (vcast_vd_d(-0.0289002344784740315686289)))))))), (vmla_vd_vd_vd_vd((t4), (vmla_vd_vd_vd_vd((t2), (vmla_vd_vd_vd_vd((vd2getx_vd_vd2(t)), (vcast_vd_d(0.0359785005035104590853656)), (vcast_vd_d(-0.041848579703592507506027)))), (vmla_vd_vd_vd_vd((vd2getx_vd_vd2(t)), (vcast_vd_d(0.0470843011653283988193763)), (vcast_vd_d(-0.0524914210588448421068719)))))), (vmla_vd_vd_vd_vd((t2), (vmla_vd_vd_vd_vd((vd2getx_vd_vd2(t)), (vcast_vd_d(0.0587946590969581003860434)), (vcast_vd_d(-0.0666620884778795497194182)))), (vmla_vd_vd_vd_vd((vd2getx_vd_vd2(t)), (vcast_vd_d(0.0769225330296203768654095)), (vcast_vd_d(-0.0909090442773387574781907)))))))))
+
+                                   ;
+  u = vmla_vd_vd_vd_vd(u, vd2getx_vd_vd2(t), vcast_vd_d(0.111111108376896236538123));
+  u = vmla_vd_vd_vd_vd(u, vd2getx_vd_vd2(t), vcast_vd_d(-0.142857142756268568062339));
+  u = vmla_vd_vd_vd_vd(u, vd2getx_vd_vd2(t), vcast_vd_d(0.199999999997977351284817));
+  u = vmla_vd_vd_vd_vd(u, vd2getx_vd_vd2(t), vcast_vd_d(-0.333333333333317605173818));
+
+  t = ddadd_vd2_vd2_vd2(s, ddmul_vd2_vd2_vd(ddmul_vd2_vd2_vd2(s, t), u));
+
+  t = ddadd_vd2_vd2_vd2(ddmul_vd2_vd2_vd(vcast_vd2_d_d(1.570796326794896557998982, 6.12323399573676603586882e-17), vcast_vd_vi(q)), t);
+
+  return t;
+}
+
+static SLEEF_ALWAYS_INLINE SLEEF_CONST vdouble visinf2_vd_vd_vd(vdouble d, vdouble m) {
+  return vreinterpret_vd_vm(vand_vm_vo64_vm(visinf_vo_vd(d), vor_vm_vm_vm(vand_vm_vm_vm(vreinterpret_vm_vd(d), vreinterpret_vm_vd(vcast_vd_d(-0.0))), vreinterpret_vm_vd(m))));
+}
+
+SLEEF_INLINE SLEEF_CONST vdouble Sleef_atan2d2_u35avx2128(vdouble y, vdouble x) {
+  vdouble r = atan2k(vabs_vd_vd(y), x);
+
+  r = vmulsign_vd_vd_vd(r, x);
+  r = vsel_vd_vo_vd_vd(vor_vo_vo_vo(visinf_vo_vd(x), veq_vo_vd_vd(x, vcast_vd_d(0))), vsub_vd_vd_vd(vcast_vd_d(3.141592653589793238462643383279502884/2), visinf2_vd_vd_vd(x, vmulsign_vd_vd_vd(vcast_vd_d(3.141592653589793238462643383279502884/2), x))), r);
+  r = vsel_vd_vo_vd_vd(visinf_vo_vd(y), vsub_vd_vd_vd(vcast_vd_d(3.141592653589793238462643383279502884/2), visinf2_vd_vd_vd(x, vmulsign_vd_vd_vd(vcast_vd_d(3.141592653589793238462643383279502884/4), x))), r);
+  r = vsel_vd_vo_vd_vd(veq_vo_vd_vd(y, vcast_vd_d(0.0)), vreinterpret_vd_vm(vand_vm_vo64_vm(vsignbit_vo_vd(x), vreinterpret_vm_vd(vcast_vd_d(3.141592653589793238462643383279502884)))), r);
+
+  r = vreinterpret_vd_vm(vor_vm_vo64_vm(vor_vo_vo_vo(visnan_vo_vd(x), visnan_vo_vd(y)), vreinterpret_vm_vd(vmulsign_vd_vd_vd(r, y))));
+  return r;
+}
+
+SLEEF_INLINE SLEEF_CONST vdouble Sleef_atan2d2_u10avx2128(vdouble y, vdouble x) {
+  vopmask o = vlt_vo_vd_vd(vabs_vd_vd(x), vcast_vd_d(5.5626846462680083984e-309)); // nexttoward((1.0 / DBL_MAX), 1)
+  x = vsel_vd_vo_vd_vd(o, vmul_vd_vd_vd(x, vcast_vd_d(UINT64_C(1) << 53)), x);
+  y = vsel_vd_vo_vd_vd(o, vmul_vd_vd_vd(y, vcast_vd_d(UINT64_C(1) << 53)), y);
+
+  vdouble2 d = atan2k_u1(vcast_vd2_vd_vd(vabs_vd_vd(y), vcast_vd_d(0)), vcast_vd2_vd_vd(x, vcast_vd_d(0)));
+  vdouble r = vadd_vd_vd_vd(vd2getx_vd_vd2(d), vd2gety_vd_vd2(d));
+
+  r = vmulsign_vd_vd_vd(r, x);
+  r = vsel_vd_vo_vd_vd(vor_vo_vo_vo(visinf_vo_vd(x), veq_vo_vd_vd(x, vcast_vd_d(0))), vsub_vd_vd_vd(vcast_vd_d(3.141592653589793238462643383279502884/2), visinf2_vd_vd_vd(x, vmulsign_vd_vd_vd(vcast_vd_d(3.141592653589793238462643383279502884/2), x))), r);
+  r = vsel_vd_vo_vd_vd(visinf_vo_vd(y), vsub_vd_vd_vd(vcast_vd_d(3.141592653589793238462643383279502884/2), visinf2_vd_vd_vd(x, vmulsign_vd_vd_vd(vcast_vd_d(3.141592653589793238462643383279502884/4), x))), r);
+  r = vsel_vd_vo_vd_vd(veq_vo_vd_vd(y, vcast_vd_d(0.0)), vreinterpret_vd_vm(vand_vm_vo64_vm(vsignbit_vo_vd(x), vreinterpret_vm_vd(vcast_vd_d(3.141592653589793238462643383279502884)))), r);
+
+  r = vreinterpret_vd_vm(vor_vm_vo64_vm(vor_vo_vo_vo(visnan_vo_vd(x), visnan_vo_vd(y)), vreinterpret_vm_vd(vmulsign_vd_vd_vd(r, y))));
+  return r;
+}
+
+SLEEF_INLINE SLEEF_CONST vdouble Sleef_asind2_u35avx2128(vdouble d) {
+  vopmask o = vlt_vo_vd_vd(vabs_vd_vd(d), vcast_vd_d(0.5));
+  vdouble x2 = vsel_vd_vo_vd_vd(o, vmul_vd_vd_vd(d, d), vmul_vd_vd_vd(vsub_vd_vd_vd(vcast_vd_d(1), vabs_vd_vd(d)), vcast_vd_d(0.5)));
+  vdouble x = vsel_vd_vo_vd_vd(o, vabs_vd_vd(d), vsqrt_vd_vd(x2)), u;
+
+  vdouble x4 = vmul_vd_vd_vd(x2, x2), x8 = vmul_vd_vd_vd(x4, x4), x16 = vmul_vd_vd_vd(x8, x8);
+  u = vmla_vd_vd_vd_vd((x16), (vmla_vd_vd_vd_vd((x4), (vmla_vd_vd_vd_vd((x2), (vcast_vd_d(+0.3161587650653934628e-1)), (vcast_vd_d(-0.1581918243329996643e-1)))), (vmla_vd_vd_vd_vd((x2), (vcast_vd_d(+0.1929045477267910674e-1)), (vcast_vd_d(+0.6606077476277170610e-2)))))), (vmla_vd_vd_vd_vd((x8), (vmla_vd_vd_vd_vd((x4), (vmla_vd_vd_vd_vd((x2), (vcast_vd_d(+0.1215360525577377331e-1)), (vcast_vd_d(+0.1388715184501609218e-1)))), (vmla_vd_vd_vd_vd((x2), (vcast_vd_d(+0.1735956991223614604e-1)), (vcast_vd_d(+0.2237176181932048341e-1)))))), (vmla_vd_vd_vd_vd((x4), (vmla_vd_vd_vd_vd((x2), (vcast_vd_d(+0.3038195928038132237e-1)), (vcast_vd_d(+0.4464285681377102438e-1)))), (vmla_vd_vd_vd_vd((x2), (vcast_vd_d(+0.7500000000378581611e-1)), (vcast_vd_d(+0.1666666666666497543e+0)))))))))
+
+                                ;
+
+  u = vmla_vd_vd_vd_vd(u, vmul_vd_vd_vd(x, x2), x);
+
+  vdouble r = vsel_vd_vo_vd_vd(o, u, vmla_vd_vd_vd_vd(u, vcast_vd_d(-2), vcast_vd_d(3.141592653589793238462643383279502884/2)));
+  return vmulsign_vd_vd_vd(r, d);
+}
+
+SLEEF_INLINE SLEEF_CONST vdouble Sleef_asind2_u10avx2128(vdouble d) {
+  vopmask o = vlt_vo_vd_vd(vabs_vd_vd(d), vcast_vd_d(0.5));
+  vdouble x2 = vsel_vd_vo_vd_vd(o, vmul_vd_vd_vd(d, d), vmul_vd_vd_vd(vsub_vd_vd_vd(vcast_vd_d(1), vabs_vd_vd(d)), vcast_vd_d(0.5))), u;
+  vdouble2 x = vsel_vd2_vo_vd2_vd2(o, vcast_vd2_vd_vd(vabs_vd_vd(d), vcast_vd_d(0)), ddsqrt_vd2_vd(x2));
+  x = vsel_vd2_vo_vd2_vd2(veq_vo_vd_vd(vabs_vd_vd(d), vcast_vd_d(1.0)), vcast_vd2_d_d(0, 0), x);
+
+  vdouble x4 = vmul_vd_vd_vd(x2, x2), x8 = vmul_vd_vd_vd(x4, x4), x16 = vmul_vd_vd_vd(x8, x8);
+  u = vmla_vd_vd_vd_vd((x16), (vmla_vd_vd_vd_vd((x4), (vmla_vd_vd_vd_vd((x2), (vcast_vd_d(+0.3161587650653934628e-1)), (vcast_vd_d(-0.1581918243329996643e-1)))), (vmla_vd_vd_vd_vd((x2), (vcast_vd_d(+0.1929045477267910674e-1)), (vcast_vd_d(+0.6606077476277170610e-2)))))), (vmla_vd_vd_vd_vd((x8), (vmla_vd_vd_vd_vd((x4), (vmla_vd_vd_vd_vd((x2), (vcast_vd_d(+0.1215360525577377331e-1)), (vcast_vd_d(+0.1388715184501609218e-1)))), (vmla_vd_vd_vd_vd((x2), (vcast_vd_d(+0.1735956991223614604e-1)), (vcast_vd_d(+0.2237176181932048341e-1)))))), (vmla_vd_vd_vd_vd((x4), (vmla_vd_vd_vd_vd((x2), (vcast_vd_d(+0.3038195928038132237e-1)), (vcast_vd_d(+0.4464285681377102438e-1)))), (vmla_vd_vd_vd_vd((x2), (vcast_vd_d(+0.7500000000378581611e-1)), (vcast_vd_d(+0.1666666666666497543e+0)))))))))
+
+                                ;
+
+  u = vmul_vd_vd_vd(u, vmul_vd_vd_vd(x2, vd2getx_vd_vd2(x)));
+
+  vdouble2 y = ddsub_vd2_vd2_vd(ddsub_vd2_vd2_vd2(vcast_vd2_d_d(3.141592653589793116/4, 1.2246467991473532072e-16/4), x), u);
+
+  vdouble r = vsel_vd_vo_vd_vd(o, vadd_vd_vd_vd(u, vd2getx_vd_vd2(x)),
+          vmul_vd_vd_vd(vadd_vd_vd_vd(vd2getx_vd_vd2(y), vd2gety_vd_vd2(y)), vcast_vd_d(2)));
+  return vmulsign_vd_vd_vd(r, d);
+}
+
+SLEEF_INLINE SLEEF_CONST vdouble Sleef_acosd2_u35avx2128(vdouble d) {
+  vopmask o = vlt_vo_vd_vd(vabs_vd_vd(d), vcast_vd_d(0.5));
+  vdouble x2 = vsel_vd_vo_vd_vd(o, vmul_vd_vd_vd(d, d),
+    vmul_vd_vd_vd(vsub_vd_vd_vd(vcast_vd_d(1), vabs_vd_vd(d)), vcast_vd_d(0.5))), u;
+  vdouble x = vsel_vd_vo_vd_vd(o, vabs_vd_vd(d), vsqrt_vd_vd(x2));
+  x = vsel_vd_vo_vd_vd(veq_vo_vd_vd(vabs_vd_vd(d), vcast_vd_d(1.0)), vcast_vd_d(0), x);
+
+  vdouble x4 = vmul_vd_vd_vd(x2, x2), x8 = vmul_vd_vd_vd(x4, x4), x16 = vmul_vd_vd_vd(x8, x8);
+  u = vmla_vd_vd_vd_vd((x16), (vmla_vd_vd_vd_vd((x4), (vmla_vd_vd_vd_vd((x2), (vcast_vd_d(+0.3161587650653934628e-1)), (vcast_vd_d(-0.1581918243329996643e-1)))), (vmla_vd_vd_vd_vd((x2), (vcast_vd_d(+0.1929045477267910674e-1)), (vcast_vd_d(+0.6606077476277170610e-2)))))), (vmla_vd_vd_vd_vd((x8), (vmla_vd_vd_vd_vd((x4), (vmla_vd_vd_vd_vd((x2), (vcast_vd_d(+0.1215360525577377331e-1)), (vcast_vd_d(+0.1388715184501609218e-1)))), (vmla_vd_vd_vd_vd((x2), (vcast_vd_d(+0.1735956991223614604e-1)), (vcast_vd_d(+0.2237176181932048341e-1)))))), (vmla_vd_vd_vd_vd((x4), (vmla_vd_vd_vd_vd((x2), (vcast_vd_d(+0.3038195928038132237e-1)), (vcast_vd_d(+0.4464285681377102438e-1)))), (vmla_vd_vd_vd_vd((x2), (vcast_vd_d(+0.7500000000378581611e-1)), (vcast_vd_d(+0.1666666666666497543e+0)))))))))
+
+                                ;
+
+  u = vmul_vd_vd_vd(u, vmul_vd_vd_vd(x2, x));
+
+  vdouble y = vsub_vd_vd_vd(vcast_vd_d(3.141592653589793238462643383279502884/2), vadd_vd_vd_vd(vmulsign_vd_vd_vd(x, d), vmulsign_vd_vd_vd(u, d)));
+  x = vadd_vd_vd_vd(x, u);
+  vdouble r = vsel_vd_vo_vd_vd(o, y, vmul_vd_vd_vd(x, vcast_vd_d(2)));
+  return vsel_vd_vo_vd_vd(vandnot_vo_vo_vo(o, vlt_vo_vd_vd(d, vcast_vd_d(0))),
+     vd2getx_vd_vd2(ddadd_vd2_vd2_vd(vcast_vd2_d_d(3.141592653589793116, 1.2246467991473532072e-16),
+         vneg_vd_vd(r))), r);
+}
+
+SLEEF_INLINE SLEEF_CONST vdouble Sleef_acosd2_u10avx2128(vdouble d) {
+  vopmask o = vlt_vo_vd_vd(vabs_vd_vd(d), vcast_vd_d(0.5));
+  vdouble x2 = vsel_vd_vo_vd_vd(o, vmul_vd_vd_vd(d, d), vmul_vd_vd_vd(vsub_vd_vd_vd(vcast_vd_d(1), vabs_vd_vd(d)), vcast_vd_d(0.5))), u;
+  vdouble2 x = vsel_vd2_vo_vd2_vd2(o, vcast_vd2_vd_vd(vabs_vd_vd(d), vcast_vd_d(0)), ddsqrt_vd2_vd(x2));
+  x = vsel_vd2_vo_vd2_vd2(veq_vo_vd_vd(vabs_vd_vd(d), vcast_vd_d(1.0)), vcast_vd2_d_d(0, 0), x);
+
+  vdouble x4 = vmul_vd_vd_vd(x2, x2), x8 = vmul_vd_vd_vd(x4, x4), x16 = vmul_vd_vd_vd(x8, x8);
+  u = vmla_vd_vd_vd_vd((x16), (vmla_vd_vd_vd_vd((x4), (vmla_vd_vd_vd_vd((x2), (vcast_vd_d(+0.3161587650653934628e-1)), (vcast_vd_d(-0.1581918243329996643e-1)))), (vmla_vd_vd_vd_vd((x2), (vcast_vd_d(+0.1929045477267910674e-1)), (vcast_vd_d(+0.6606077476277170610e-2)))))), (vmla_vd_vd_vd_vd((x8), (vmla_vd_vd_vd_vd((x4), (vmla_vd_vd_vd_vd((x2), (vcast_vd_d(+0.1215360525577377331e-1)), (vcast_vd_d(+0.1388715184501609218e-1)))), (vmla_vd_vd_vd_vd((x2), (vcast_vd_d(+0.1735956991223614604e-1)), (vcast_vd_d(+0.2237176181932048341e-1)))))), (vmla_vd_vd_vd_vd((x4), (vmla_vd_vd_vd_vd((x2), (vcast_vd_d(+0.3038195928038132237e-1)), (vcast_vd_d(+0.4464285681377102438e-1)))), (vmla_vd_vd_vd_vd((x2), (vcast_vd_d(+0.7500000000378581611e-1)), (vcast_vd_d(+0.1666666666666497543e+0)))))))))
+
+                                ;
+
+  u = vmul_vd_vd_vd(u, vmul_vd_vd_vd(x2, vd2getx_vd_vd2(x)));
+
+  vdouble2 y = ddsub_vd2_vd2_vd2(vcast_vd2_d_d(3.141592653589793116/2, 1.2246467991473532072e-16/2),
+     ddadd_vd2_vd_vd(vmulsign_vd_vd_vd(vd2getx_vd_vd2(x), d), vmulsign_vd_vd_vd(u, d)));
+  x = ddadd_vd2_vd2_vd(x, u);
+
+  y = vsel_vd2_vo_vd2_vd2(o, y, ddscale_vd2_vd2_vd(x, vcast_vd_d(2)));
+
+  y = vsel_vd2_vo_vd2_vd2(vandnot_vo_vo_vo(o, vlt_vo_vd_vd(d, vcast_vd_d(0))),
+     ddsub_vd2_vd2_vd2(vcast_vd2_d_d(3.141592653589793116, 1.2246467991473532072e-16), y), y);
+
+  return vadd_vd_vd_vd(vd2getx_vd_vd2(y), vd2gety_vd_vd2(y));
+}
+
+SLEEF_INLINE SLEEF_CONST vdouble Sleef_atand2_u10avx2128(vdouble d) {
+  vdouble2 d2 = atan2k_u1(vcast_vd2_vd_vd(vabs_vd_vd(d), vcast_vd_d(0)), vcast_vd2_d_d(1, 0));
+  vdouble r = vadd_vd_vd_vd(vd2getx_vd_vd2(d2), vd2gety_vd_vd2(d2));
+  r = vsel_vd_vo_vd_vd(visinf_vo_vd(d), vcast_vd_d(1.570796326794896557998982), r);
+  return vmulsign_vd_vd_vd(r, d);
+}
+
+SLEEF_INLINE SLEEF_CONST vdouble Sleef_atand2_u35avx2128(vdouble s) {
+  vdouble t, u;
+  vint q;
+
+
+
+
+  q = vsel_vi_vd_vi(s, vcast_vi_i(2));
+  s = vabs_vd_vd(s);
+
+  q = vsel_vi_vd_vd_vi_vi(vcast_vd_d(1), s, vadd_vi_vi_vi(q, vcast_vi_i(1)), q);
+  s = vsel_vd_vo_vd_vd(vlt_vo_vd_vd(vcast_vd_d(1), s), vrec_vd_vd(s), s);
+
+  t = vmul_vd_vd_vd(s, s);
+
+  vdouble t2 = vmul_vd_vd_vd(t, t), t4 = vmul_vd_vd_vd(t2, t2), t8 = vmul_vd_vd_vd(t4, t4), t16 = vmul_vd_vd_vd(t8, t8);
+  u = vmla_vd_vd_vd_vd((t16), (vmla_vd_vd_vd_vd((t2), (vcast_vd_d(-1.88796008463073496563746e-05)), (vmla_vd_vd_vd_vd((t), (vcast_vd_d(0.000209850076645816976906797)), (vcast_vd_d(-0.00110611831486672482563471)))))), (vmla_vd_vd_vd_vd((t8), (vmla_vd_vd_vd_vd((t4), (vmla_vd_vd_vd_vd((t2), (vmla_vd_vd_vd_vd((t), (vcast_vd_d(0.00370026744188713119232403)), (vcast_vd_d(-0.00889896195887655491740809)))), (vmla_vd_vd_vd_vd((t), (vcast_vd_d(0.016599329773529201970117)), (vcast_vd_d(-0.0254517624932312641616861)))))), (vmla_vd_vd_vd_vd((t2), (vmla_vd_vd_vd_vd((t), (vcast_vd_d(0.0337852580001353069993897)), (vcast_vd_d(-0.0407629191276836500001934)))), (vmla_vd_vd_vd_vd((t), (vcast_vd_d(0.0466667150077840625632675)), (vcast_vd_d(-0.0523674852303482457616113)))))))), (vmla_vd_vd_vd_vd((t4), (vmla_vd_vd_vd_vd((t2), (vmla_vd_vd_vd_vd((t), (vcast_vd_d(0.0587666392926673580854313)), (vcast_vd_d(-0.0666573579361080525984562)))), (vmla_vd_vd_vd_vd((t), (vcast_vd_d(0.0769219538311769618355029)), (vcast_vd_d(-0.090908995008245008229153)))))), (vmla_vd_vd_vd_vd((t2), (vmla_vd_vd_vd_vd((t), (vcast_vd_d(0.111111105648261418443745)), (vcast_vd_d(-0.14285714266771329383765)))), (vmla_vd_vd_vd_vd((t), (vcast_vd_d(0.199999999996591265594148)), (vcast_vd_d(-0.333333333333311110369124)))))))))))
+
+                                  ;
+
+  t = vmla_vd_vd_vd_vd(s, vmul_vd_vd_vd(t, u), s);
+
+  t = vsel_vd_vo_vd_vd(vcast_vo64_vo32(veq_vo_vi_vi(vand_vi_vi_vi(q, vcast_vi_i(1)), vcast_vi_i(1))), vsub_vd_vd_vd(vcast_vd_d(3.141592653589793238462643383279502884/2), t), t);
+  t = vreinterpret_vd_vm(vxor_vm_vm_vm(vand_vm_vo64_vm(vcast_vo64_vo32(veq_vo_vi_vi(vand_vi_vi_vi(q, vcast_vi_i(2)), vcast_vi_i(2))), vreinterpret_vm_vd(vcast_vd_d(-0.0))), vreinterpret_vm_vd(t)));
+
+
+
+
+
+  return t;
+}
+
+
+SLEEF_INLINE SLEEF_CONST vdouble Sleef_logd2_u35avx2128(vdouble d) {
+  vdouble x, x2;
+  vdouble t, m;
+
+
+  vopmask o = vlt_vo_vd_vd(d, vcast_vd_d(0x1p-1022));
+  d = vsel_vd_vo_vd_vd(o, vmul_vd_vd_vd(d, vcast_vd_d((double)(INT64_C(1) << 32) * (double)(INT64_C(1) << 32))), d);
+  vint e = vilogb2k_vi_vd(vmul_vd_vd_vd(d, vcast_vd_d(1.0/0.75)));
+  m = vldexp3_vd_vd_vi(d, vneg_vi_vi(e));
+  e = vsel_vi_vo_vi_vi(vcast_vo32_vo64(o), vsub_vi_vi_vi(e, vcast_vi_i(64)), e);
+
+
+
+
+
+
+  x = vdiv_vd_vd_vd(vsub_vd_vd_vd(m, vcast_vd_d(1)), vadd_vd_vd_vd(vcast_vd_d(1), m));
+  x2 = vmul_vd_vd_vd(x, x);
+
+  vdouble x4 = vmul_vd_vd_vd(x2, x2), x8 = vmul_vd_vd_vd(x4, x4), x3 = vmul_vd_vd_vd(x, x2);
+  t = vmla_vd_vd_vd_vd((x8), (vmla_vd_vd_vd_vd((x4), (vcast_vd_d(0.153487338491425068243146)), (vmla_vd_vd_vd_vd((x2), (vcast_vd_d(0.152519917006351951593857)), (vcast_vd_d(0.181863266251982985677316)))))), (vmla_vd_vd_vd_vd((x4), (vmla_vd_vd_vd_vd((x2), (vcast_vd_d(0.222221366518767365905163)), (vcast_vd_d(0.285714294746548025383248)))), (vmla_vd_vd_vd_vd((x2), (vcast_vd_d(0.399999999950799600689777)), (vcast_vd_d(0.6666666666667778740063)))))))
+
+
+
+
+
+
+                              ;
+
+
+  x = vmla_vd_vd_vd_vd(x, vcast_vd_d(2), vmul_vd_vd_vd(vcast_vd_d(0.693147180559945286226764), vcast_vd_vi(e)));
+  x = vmla_vd_vd_vd_vd(x3, t, x);
+
+  x = vsel_vd_vo_vd_vd(vispinf_vo_vd(d), vcast_vd_d(__builtin_inf()), x);
+  x = vsel_vd_vo_vd_vd(vor_vo_vo_vo(vlt_vo_vd_vd(d, vcast_vd_d(0)), visnan_vo_vd(d)), vcast_vd_d(__builtin_nan("")), x);
+  x = vsel_vd_vo_vd_vd(veq_vo_vd_vd(d, vcast_vd_d(0)), vcast_vd_d(-__builtin_inf()), x);
+
+
+
+
+
+
+
+  return x;
+}
+
+
+SLEEF_INLINE SLEEF_CONST vdouble Sleef_expd2_u10avx2128(vdouble d) {
+  vdouble u = vrint_vd_vd(vmul_vd_vd_vd(d, vcast_vd_d(1.442695040888963407359924681001892137426645954152985934135449406931))), s;
+  vint q = vrint_vi_vd(u);
+
+  s = vmla_vd_vd_vd_vd(u, vcast_vd_d(-.69314718055966295651160180568695068359375), d);
+  s = vmla_vd_vd_vd_vd(u, vcast_vd_d(-.28235290563031577122588448175013436025525412068e-12), s);
+
+
+  vdouble s2 = vmul_vd_vd_vd(s, s), s4 = vmul_vd_vd_vd(s2, s2), s8 = vmul_vd_vd_vd(s4, s4);
+  u = vmla_vd_vd_vd_vd((s8), (vmla_vd_vd_vd_vd((s), (vcast_vd_d(+0.2081276378237164457e-8)), (vcast_vd_d(+0.2511210703042288022e-7)))), (vmla_vd_vd_vd_vd((s4), (vmla_vd_vd_vd_vd((s2), (vmla_vd_vd_vd_vd((s), (vcast_vd_d(+0.2755762628169491192e-6)), (vcast_vd_d(+0.2755723402025388239e-5)))), (vmla_vd_vd_vd_vd((s), (vcast_vd_d(+0.2480158687479686264e-4)), (vcast_vd_d(+0.1984126989855865850e-3)))))), (vmla_vd_vd_vd_vd((s2), (vmla_vd_vd_vd_vd((s), (vcast_vd_d(+0.1388888888914497797e-2)), (vcast_vd_d(+0.8333333333314938210e-2)))), (vmla_vd_vd_vd_vd((s), (vcast_vd_d(+0.4166666666666602598e-1)), (vcast_vd_d(+0.1666666666666669072e+0)))))))))
+
+                                ;
+  u = vfma_vd_vd_vd_vd(u, s, vcast_vd_d(+0.5000000000000000000e+0));
+  u = vfma_vd_vd_vd_vd(u, s, vcast_vd_d(+0.1000000000000000000e+1));
+  u = vfma_vd_vd_vd_vd(u, s, vcast_vd_d(+0.1000000000000000000e+1));
+
+  u = vldexp2_vd_vd_vi(u, q);
+
+  u = vsel_vd_vo_vd_vd(vgt_vo_vd_vd(d, vcast_vd_d(709.78271114955742909217217426)), vcast_vd_d(__builtin_inf()), u);
+  u = vreinterpret_vd_vm(vandnot_vm_vo64_vm(vlt_vo_vd_vd(d, vcast_vd_d(-1000)), vreinterpret_vm_vd(u)));
+
+  return u;
+}
+
+static SLEEF_ALWAYS_INLINE SLEEF_CONST vdouble expm1k(vdouble d) {
+  vdouble u = vrint_vd_vd(vmul_vd_vd_vd(d, vcast_vd_d(1.442695040888963407359924681001892137426645954152985934135449406931))), s;
+  vint q = vrint_vi_vd(u);
+
+  s = vmla_vd_vd_vd_vd(u, vcast_vd_d(-.69314718055966295651160180568695068359375), d);
+  s = vmla_vd_vd_vd_vd(u, vcast_vd_d(-.28235290563031577122588448175013436025525412068e-12), s);
+
+  vdouble s2 = vmul_vd_vd_vd(s, s), s4 = vmul_vd_vd_vd(s2, s2), s8 = vmul_vd_vd_vd(s4, s4);
+  u = vmla_vd_vd_vd_vd((s8), (vmla_vd_vd_vd_vd((s), (vcast_vd_d(2.08860621107283687536341e-09)), (vcast_vd_d(2.51112930892876518610661e-08)))), (vmla_vd_vd_vd_vd((s4), (vmla_vd_vd_vd_vd((s2), (vmla_vd_vd_vd_vd((s), (vcast_vd_d(2.75573911234900471893338e-07)), (vcast_vd_d(2.75572362911928827629423e-06)))), (vmla_vd_vd_vd_vd((s), (vcast_vd_d(2.4801587159235472998791e-05)), (vcast_vd_d(0.000198412698960509205564975)))))), (vmla_vd_vd_vd_vd((s2), (vmla_vd_vd_vd_vd((s), (vcast_vd_d(0.00138888888889774492207962)), (vcast_vd_d(0.00833333333331652721664984)))), (vmla_vd_vd_vd_vd((s), (vcast_vd_d(0.0416666666666665047591422)), (vcast_vd_d(0.166666666666666851703837)))))))))
+
+                                 ;
+
+  u = vadd_vd_vd_vd(vmla_vd_vd_vd_vd(s2, vcast_vd_d(0.5), vmul_vd_vd_vd(vmul_vd_vd_vd(s2, s), u)), s);
+
+  u = vsel_vd_vo_vd_vd(vcast_vo64_vo32(veq_vo_vi_vi(q, vcast_vi_i(0))), u,
+         vsub_vd_vd_vd(vldexp2_vd_vd_vi(vadd_vd_vd_vd(u, vcast_vd_d(1)), q), vcast_vd_d(1)));
+
+  return u;
+}
+
+static SLEEF_ALWAYS_INLINE SLEEF_CONST vdouble2 logk(vdouble d) {
+  vdouble2 x, x2, s;
+  vdouble t, m;
+
+
+  vopmask o = vlt_vo_vd_vd(d, vcast_vd_d(0x1p-1022));
+  d = vsel_vd_vo_vd_vd(o, vmul_vd_vd_vd(d, vcast_vd_d((double)(INT64_C(1) << 32) * (double)(INT64_C(1) << 32))), d);
+  vint e = vilogb2k_vi_vd(vmul_vd_vd_vd(d, vcast_vd_d(1.0/0.75)));
+  m = vldexp3_vd_vd_vi(d, vneg_vi_vi(e));
+  e = vsel_vi_vo_vi_vi(vcast_vo32_vo64(o), vsub_vi_vi_vi(e, vcast_vi_i(64)), e);
+
+
+
+
+
+
+  x = dddiv_vd2_vd2_vd2(ddadd2_vd2_vd_vd(vcast_vd_d(-1), m), ddadd2_vd2_vd_vd(vcast_vd_d(1), m));
+  x2 = ddsqu_vd2_vd2(x);
+
+  vdouble x4 = vmul_vd_vd_vd(vd2getx_vd_vd2(x2), vd2getx_vd_vd2(x2)), x8 = vmul_vd_vd_vd(x4, x4), x16 = vmul_vd_vd_vd(x8, x8);
+  t = vmla_vd_vd_vd_vd((x16), (vcast_vd_d(0.116255524079935043668677)), (vmla_vd_vd_vd_vd((x8), (vmla_vd_vd_vd_vd((x4), (vmla_vd_vd_vd_vd((vd2getx_vd_vd2(x2)), (vcast_vd_d(0.103239680901072952701192)), (vcast_vd_d(0.117754809412463995466069)))), (vmla_vd_vd_vd_vd((vd2getx_vd_vd2(x2)), (vcast_vd_d(0.13332981086846273921509)), (vcast_vd_d(0.153846227114512262845736)))))), (vmla_vd_vd_vd_vd((x4), (vmla_vd_vd_vd_vd((vd2getx_vd_vd2(x2)), (vcast_vd_d(0.181818180850050775676507)), (vcast_vd_d(0.222222222230083560345903)))), (vmla_vd_vd_vd_vd((vd2getx_vd_vd2(x2)), (vcast_vd_d(0.285714285714249172087875)), (vcast_vd_d(0.400000000000000077715612)))))))))
+
+                                ;
+
+  vdouble2 c = vcast_vd2_d_d(0.666666666666666629659233, 3.80554962542412056336616e-17);
+
+  s = ddmul_vd2_vd2_vd(vcast_vd2_d_d(0.693147180559945286226764, 2.319046813846299558417771e-17), vcast_vd_vi(e));
+
+
+
+  s = ddadd_vd2_vd2_vd2(s, ddscale_vd2_vd2_vd(x, vcast_vd_d(2)));
+  x = ddmul_vd2_vd2_vd2(x2, x);
+  s = ddadd_vd2_vd2_vd2(s, ddmul_vd2_vd2_vd2(x, c));
+  x = ddmul_vd2_vd2_vd2(x2, x);
+  s = ddadd_vd2_vd2_vd2(s, ddmul_vd2_vd2_vd(x, t));
+
+  return s;
+}
+
+
+SLEEF_INLINE SLEEF_CONST vdouble Sleef_logd2_u10avx2128(vdouble d) {
+  vdouble2 x;
+  vdouble t, m, x2;
+
+
+  vopmask o = vlt_vo_vd_vd(d, vcast_vd_d(0x1p-1022));
+  d = vsel_vd_vo_vd_vd(o, vmul_vd_vd_vd(d, vcast_vd_d((double)(INT64_C(1) << 32) * (double)(INT64_C(1) << 32))), d);
+  vint e = vilogb2k_vi_vd(vmul_vd_vd_vd(d, vcast_vd_d(1.0/0.75)));
+  m = vldexp3_vd_vd_vi(d, vneg_vi_vi(e));
+  e = vsel_vi_vo_vi_vi(vcast_vo32_vo64(o), vsub_vi_vi_vi(e, vcast_vi_i(64)), e);
+
+
+
+
+
+
+  x = dddiv_vd2_vd2_vd2(ddadd2_vd2_vd_vd(vcast_vd_d(-1), m), ddadd2_vd2_vd_vd(vcast_vd_d(1), m));
+  x2 = vmul_vd_vd_vd(vd2getx_vd_vd2(x), vd2getx_vd_vd2(x));
+
+  vdouble x4 = vmul_vd_vd_vd(x2, x2), x8 = vmul_vd_vd_vd(x4, x4);
+  t = vmla_vd_vd_vd_vd((x8), (vmla_vd_vd_vd_vd((x4), (vcast_vd_d(0.1532076988502701353e+0)), (vmla_vd_vd_vd_vd((x2), (vcast_vd_d(0.1525629051003428716e+0)), (vcast_vd_d(0.1818605932937785996e+0)))))), (vmla_vd_vd_vd_vd((x4), (vmla_vd_vd_vd_vd((x2), (vcast_vd_d(0.2222214519839380009e+0)), (vcast_vd_d(0.2857142932794299317e+0)))), (vmla_vd_vd_vd_vd((x2), (vcast_vd_d(0.3999999999635251990e+0)), (vcast_vd_d(0.6666666666667333541e+0)))))))
+
+
+
+
+
+
+                              ;
+
+
+  vdouble2 s = ddmul_vd2_vd2_vd(vcast_vd2_d_d(0.693147180559945286226764, 2.319046813846299558417771e-17), vcast_vd_vi(e));
+
+
+
+
+  s = ddadd_vd2_vd2_vd2(s, ddscale_vd2_vd2_vd(x, vcast_vd_d(2)));
+  s = ddadd_vd2_vd2_vd(s, vmul_vd_vd_vd(vmul_vd_vd_vd(x2, vd2getx_vd_vd2(x)), t));
+
+  vdouble r = vadd_vd_vd_vd(vd2getx_vd_vd2(s), vd2gety_vd_vd2(s));
+
+
+  r = vsel_vd_vo_vd_vd(vispinf_vo_vd(d), vcast_vd_d(__builtin_inf()), r);
+  r = vsel_vd_vo_vd_vd(vor_vo_vo_vo(vlt_vo_vd_vd(d, vcast_vd_d(0)), visnan_vo_vd(d)), vcast_vd_d(__builtin_nan("")), r);
+  r = vsel_vd_vo_vd_vd(veq_vo_vd_vd(d, vcast_vd_d(0)), vcast_vd_d(-__builtin_inf()), r);
+
+
+
+
+  return r;
+}
+
+
+static SLEEF_ALWAYS_INLINE SLEEF_CONST vdouble expk(vdouble2 d) {
+  vdouble u = vmul_vd_vd_vd(vadd_vd_vd_vd(vd2getx_vd_vd2(d), vd2gety_vd_vd2(d)), vcast_vd_d(1.442695040888963407359924681001892137426645954152985934135449406931));
+  vdouble dq = vrint_vd_vd(u);
+  vint q = vrint_vi_vd(dq);
+  vdouble2 s, t;
+
+  s = ddadd2_vd2_vd2_vd(d, vmul_vd_vd_vd(dq, vcast_vd_d(-.69314718055966295651160180568695068359375)));
+  s = ddadd2_vd2_vd2_vd(s, vmul_vd_vd_vd(dq, vcast_vd_d(-.28235290563031577122588448175013436025525412068e-12)));
+
+  s = ddnormalize_vd2_vd2(s);
+
+  vdouble s2 = vmul_vd_vd_vd(vd2getx_vd_vd2(s), vd2getx_vd_vd2(s)), s4 = vmul_vd_vd_vd(s2, s2), s8 = vmul_vd_vd_vd(s4, s4);
+  u = vmla_vd_vd_vd_vd((s8), (vmla_vd_vd_vd_vd((vd2getx_vd_vd2(s)), (vcast_vd_d(2.51069683420950419527139e-08)), (vcast_vd_d(2.76286166770270649116855e-07)))), (vmla_vd_vd_vd_vd((s4), (vmla_vd_vd_vd_vd((s2), (vmla_vd_vd_vd_vd((vd2getx_vd_vd2(s)), (vcast_vd_d(2.75572496725023574143864e-06)), (vcast_vd_d(2.48014973989819794114153e-05)))), (vmla_vd_vd_vd_vd((vd2getx_vd_vd2(s)), (vcast_vd_d(0.000198412698809069797676111)), (vcast_vd_d(0.0013888888939977128960529)))))), (vmla_vd_vd_vd_vd((s2), (vmla_vd_vd_vd_vd((vd2getx_vd_vd2(s)), (vcast_vd_d(0.00833333333332371417601081)), (vcast_vd_d(0.0416666666665409524128449)))), (vmla_vd_vd_vd_vd((vd2getx_vd_vd2(s)), (vcast_vd_d(0.166666666666666740681535)), (vcast_vd_d(0.500000000000000999200722)))))))))
+
+                                 ;
+
+  t = ddadd_vd2_vd_vd2(vcast_vd_d(1), s);
+  t = ddadd_vd2_vd2_vd2(t, ddmul_vd2_vd2_vd(ddsqu_vd2_vd2(s), u));
+
+  u = vadd_vd_vd_vd(vd2getx_vd_vd2(t), vd2gety_vd_vd2(t));
+  u = vldexp2_vd_vd_vi(u, q);
+
+  u = vreinterpret_vd_vm(vandnot_vm_vo64_vm(vlt_vo_vd_vd(vd2getx_vd_vd2(d), vcast_vd_d(-1000)), vreinterpret_vm_vd(u)));
+
+  return u;
+}
+
+
+SLEEF_INLINE SLEEF_CONST vdouble Sleef_powd2_u10avx2128(vdouble x, vdouble y) {
+
+  vopmask yisint = visint_vo_vd(y);
+  vopmask yisodd = vand_vo_vo_vo(visodd_vo_vd(y), yisint);
+
+  vdouble2 d = ddmul_vd2_vd2_vd(logk(vabs_vd_vd(x)), y);
+  vdouble result = expk(d);
+  result = vsel_vd_vo_vd_vd(vgt_vo_vd_vd(vd2getx_vd_vd2(d), vcast_vd_d(709.78271114955742909217217426)), vcast_vd_d(__builtin_inf()), result);
+
+  result = vmul_vd_vd_vd(result,
+    vsel_vd_vo_vd_vd(vgt_vo_vd_vd(x, vcast_vd_d(0)),
+       vcast_vd_d(1),
+       vsel_vd_vo_vd_vd(yisint, vsel_vd_vo_vd_vd(yisodd, vcast_vd_d(-1.0), vcast_vd_d(1)), vcast_vd_d(__builtin_nan("")))));
+
+  vdouble efx = vmulsign_vd_vd_vd(vsub_vd_vd_vd(vabs_vd_vd(x), vcast_vd_d(1)), y);
+
+  result = vsel_vd_vo_vd_vd(visinf_vo_vd(y),
+       vreinterpret_vd_vm(vandnot_vm_vo64_vm(vlt_vo_vd_vd(efx, vcast_vd_d(0.0)),
+          vreinterpret_vm_vd(vsel_vd_vo_vd_vd(veq_vo_vd_vd(efx, vcast_vd_d(0.0)),
+                  vcast_vd_d(1.0),
+                  vcast_vd_d(__builtin_inf()))))),
+       result);
+
+  result = vsel_vd_vo_vd_vd(vor_vo_vo_vo(visinf_vo_vd(x), veq_vo_vd_vd(x, vcast_vd_d(0.0))),
+       vmulsign_vd_vd_vd(vsel_vd_vo_vd_vd(vxor_vo_vo_vo(vsignbit_vo_vd(y), veq_vo_vd_vd(x, vcast_vd_d(0.0))),
+              vcast_vd_d(0), vcast_vd_d(__builtin_inf())),
+           vsel_vd_vo_vd_vd(yisodd, x, vcast_vd_d(1))), result);
+
+  result = vreinterpret_vd_vm(vor_vm_vo64_vm(vor_vo_vo_vo(visnan_vo_vd(x), visnan_vo_vd(y)), vreinterpret_vm_vd(result)));
+
+  result = vsel_vd_vo_vd_vd(vor_vo_vo_vo(veq_vo_vd_vd(y, vcast_vd_d(0)), veq_vo_vd_vd(x, vcast_vd_d(1))), vcast_vd_d(1), result);
+
+  return result;
+
+
+
+}
+
+
+static SLEEF_ALWAYS_INLINE SLEEF_CONST vdouble2 expk2(vdouble2 d) {
+  vdouble u = vmul_vd_vd_vd(vadd_vd_vd_vd(vd2getx_vd_vd2(d), vd2gety_vd_vd2(d)), vcast_vd_d(1.442695040888963407359924681001892137426645954152985934135449406931));
+  vdouble dq = vrint_vd_vd(u);
+  vint q = vrint_vi_vd(dq);
+  vdouble2 s, t;
+
+  s = ddadd2_vd2_vd2_vd(d, vmul_vd_vd_vd(dq, vcast_vd_d(-.69314718055966295651160180568695068359375)));
+  s = ddadd2_vd2_vd2_vd(s, vmul_vd_vd_vd(dq, vcast_vd_d(-.28235290563031577122588448175013436025525412068e-12)));
+
+  vdouble2 s2 = ddsqu_vd2_vd2(s), s4 = ddsqu_vd2_vd2(s2);
+  vdouble s8 = vmul_vd_vd_vd(vd2getx_vd_vd2(s4), vd2getx_vd_vd2(s4));
+  u = vmla_vd_vd_vd_vd((s8), (vmla_vd_vd_vd_vd((vd2getx_vd_vd2(s)), (vcast_vd_d(+0.1602472219709932072e-9)), (vcast_vd_d(+0.2092255183563157007e-8)))), (vmla_vd_vd_vd_vd((vd2getx_vd_vd2(s4)), (vmla_vd_vd_vd_vd((vd2getx_vd_vd2(s2)), (vmla_vd_vd_vd_vd((vd2getx_vd_vd2(s)), (vcast_vd_d(+0.2505230023782644465e-7)), (vcast_vd_d(+0.2755724800902135303e-6)))), (vmla_vd_vd_vd_vd((vd2getx_vd_vd2(s)), (vcast_vd_d(+0.2755731892386044373e-5)), (vcast_vd_d(+0.2480158735605815065e-4)))))), (vmla_vd_vd_vd_vd((vd2getx_vd_vd2(s2)), (vmla_vd_vd_vd_vd((vd2getx_vd_vd2(s)), (vcast_vd_d(+0.1984126984148071858e-3)), (vcast_vd_d(+0.1388888888886763255e-2)))), (vmla_vd_vd_vd_vd((vd2getx_vd_vd2(s)), (vcast_vd_d(+0.8333333333333347095e-2)), (vcast_vd_d(+0.4166666666666669905e-1)))))))))
+
+                                ;
+
+  t = ddadd_vd2_vd_vd2(vcast_vd_d(0.5), ddmul_vd2_vd2_vd(s, vcast_vd_d(+0.1666666666666666574e+0)));
+  t = ddadd_vd2_vd_vd2(vcast_vd_d(1.0), ddmul_vd2_vd2_vd2(t, s));
+  t = ddadd_vd2_vd_vd2(vcast_vd_d(1.0), ddmul_vd2_vd2_vd2(t, s));
+  t = ddadd_vd2_vd2_vd2(t, ddmul_vd2_vd2_vd(s4, u));
+
+  t = vd2setx_vd2_vd2_vd(t, vldexp2_vd_vd_vi(vd2getx_vd_vd2(t), q));
+  t = vd2sety_vd2_vd2_vd(t, vldexp2_vd_vd_vi(vd2gety_vd_vd2(t), q));
+
+  t = vd2setx_vd2_vd2_vd(t, vreinterpret_vd_vm(vandnot_vm_vo64_vm(vlt_vo_vd_vd(vd2getx_vd_vd2(d), vcast_vd_d(-1000)), vreinterpret_vm_vd(vd2getx_vd_vd2(t)))));
+  t = vd2sety_vd2_vd2_vd(t, vreinterpret_vd_vm(vandnot_vm_vo64_vm(vlt_vo_vd_vd(vd2getx_vd_vd2(d), vcast_vd_d(-1000)), vreinterpret_vm_vd(vd2gety_vd_vd2(t)))));
+
+  return t;
+}
+
+
+SLEEF_INLINE SLEEF_CONST vdouble Sleef_sinhd2_u10avx2128(vdouble x) {
+  vdouble y = vabs_vd_vd(x);
+  vdouble2 d = expk2(vcast_vd2_vd_vd(y, vcast_vd_d(0)));
+  d = ddsub_vd2_vd2_vd2(d, ddrec_vd2_vd2(d));
+  y = vmul_vd_vd_vd(vadd_vd_vd_vd(vd2getx_vd_vd2(d), vd2gety_vd_vd2(d)), vcast_vd_d(0.5));
+
+  y = vsel_vd_vo_vd_vd(vor_vo_vo_vo(vgt_vo_vd_vd(vabs_vd_vd(x), vcast_vd_d(710)), visnan_vo_vd(y)), vcast_vd_d(__builtin_inf()), y);
+  y = vmulsign_vd_vd_vd(y, x);
+  y = vreinterpret_vd_vm(vor_vm_vo64_vm(visnan_vo_vd(x), vreinterpret_vm_vd(y)));
+
+  return y;
+}
+
+SLEEF_INLINE SLEEF_CONST vdouble Sleef_coshd2_u10avx2128(vdouble x) {
+  vdouble y = vabs_vd_vd(x);
+  vdouble2 d = expk2(vcast_vd2_vd_vd(y, vcast_vd_d(0)));
+  d = ddadd_vd2_vd2_vd2(d, ddrec_vd2_vd2(d));
+  y = vmul_vd_vd_vd(vadd_vd_vd_vd(vd2getx_vd_vd2(d), vd2gety_vd_vd2(d)), vcast_vd_d(0.5));
+
+  y = vsel_vd_vo_vd_vd(vor_vo_vo_vo(vgt_vo_vd_vd(vabs_vd_vd(x), vcast_vd_d(710)), visnan_vo_vd(y)), vcast_vd_d(__builtin_inf()), y);
+  y = vreinterpret_vd_vm(vor_vm_vo64_vm(visnan_vo_vd(x), vreinterpret_vm_vd(y)));
+
+  return y;
+}
+
+SLEEF_INLINE SLEEF_CONST vdouble Sleef_tanhd2_u10avx2128(vdouble x) {
+  vdouble y = vabs_vd_vd(x);
+  vdouble2 d = expk2(vcast_vd2_vd_vd(y, vcast_vd_d(0)));
+  vdouble2 e = ddrec_vd2_vd2(d);
+  d = dddiv_vd2_vd2_vd2(ddadd2_vd2_vd2_vd2(d, ddneg_vd2_vd2(e)), ddadd2_vd2_vd2_vd2(d, e));
+  y = vadd_vd_vd_vd(vd2getx_vd_vd2(d), vd2gety_vd_vd2(d));
+
+  y = vsel_vd_vo_vd_vd(vor_vo_vo_vo(vgt_vo_vd_vd(vabs_vd_vd(x), vcast_vd_d(18.714973875)), visnan_vo_vd(y)), vcast_vd_d(1.0), y);
+  y = vmulsign_vd_vd_vd(y, x);
+  y = vreinterpret_vd_vm(vor_vm_vo64_vm(visnan_vo_vd(x), vreinterpret_vm_vd(y)));
+
+  return y;
+}
+
+SLEEF_INLINE SLEEF_CONST vdouble Sleef_sinhd2_u35avx2128(vdouble x) {
+  vdouble e = expm1k(vabs_vd_vd(x));
+
+  vdouble y = vdiv_vd_vd_vd(vadd_vd_vd_vd(e, vcast_vd_d(2)), vadd_vd_vd_vd(e, vcast_vd_d(1)));
+  y = vmul_vd_vd_vd(y, vmul_vd_vd_vd(vcast_vd_d(0.5), e));
+
+  y = vsel_vd_vo_vd_vd(vor_vo_vo_vo(vgt_vo_vd_vd(vabs_vd_vd(x), vcast_vd_d(709)), visnan_vo_vd(y)), vcast_vd_d(__builtin_inf()), y);
+  y = vmulsign_vd_vd_vd(y, x);
+  y = vreinterpret_vd_vm(vor_vm_vo64_vm(visnan_vo_vd(x), vreinterpret_vm_vd(y)));
+
+  return y;
+}
+
+SLEEF_INLINE SLEEF_CONST vdouble Sleef_coshd2_u35avx2128(vdouble x) {
+  vdouble e = Sleef_expd2_u10avx2128(vabs_vd_vd(x));
+  vdouble y = vmla_vd_vd_vd_vd(vcast_vd_d(0.5), e, vdiv_vd_vd_vd(vcast_vd_d(0.5), e));
+
+  y = vsel_vd_vo_vd_vd(vor_vo_vo_vo(vgt_vo_vd_vd(vabs_vd_vd(x), vcast_vd_d(709)), visnan_vo_vd(y)), vcast_vd_d(__builtin_inf()), y);
+  y = vreinterpret_vd_vm(vor_vm_vo64_vm(visnan_vo_vd(x), vreinterpret_vm_vd(y)));
+
+  return y;
+}
+
+SLEEF_INLINE SLEEF_CONST vdouble Sleef_tanhd2_u35avx2128(vdouble x) {
+  vdouble d = expm1k(vmul_vd_vd_vd(vcast_vd_d(2), vabs_vd_vd(x)));
+  vdouble y = vdiv_vd_vd_vd(d, vadd_vd_vd_vd(vcast_vd_d(2), d));
+
+  y = vsel_vd_vo_vd_vd(vor_vo_vo_vo(vgt_vo_vd_vd(vabs_vd_vd(x), vcast_vd_d(18.714973875)), visnan_vo_vd(y)), vcast_vd_d(1.0), y);
+  y = vmulsign_vd_vd_vd(y, x);
+  y = vreinterpret_vd_vm(vor_vm_vo64_vm(visnan_vo_vd(x), vreinterpret_vm_vd(y)));
+
+  return y;
+}
+
+static SLEEF_ALWAYS_INLINE SLEEF_CONST vdouble2 logk2(vdouble2 d) {
+  vdouble2 x, x2, m, s;
+  vdouble t;
+  vint e;
+
+  e = vilogbk_vi_vd(vmul_vd_vd_vd(vd2getx_vd_vd2(d), vcast_vd_d(1.0/0.75)));
+
+  m = vd2setxy_vd2_vd_vd(vldexp2_vd_vd_vi(vd2getx_vd_vd2(d), vneg_vi_vi(e)),
+    vldexp2_vd_vd_vi(vd2gety_vd_vd2(d), vneg_vi_vi(e)));
+
+  x = dddiv_vd2_vd2_vd2(ddadd2_vd2_vd2_vd(m, vcast_vd_d(-1)), ddadd2_vd2_vd2_vd(m, vcast_vd_d(1)));
+  x2 = ddsqu_vd2_vd2(x);
+
+  vdouble x4 = vmul_vd_vd_vd(vd2getx_vd_vd2(x2), vd2getx_vd_vd2(x2)), x8 = vmul_vd_vd_vd(x4, x4);
+  t = vmla_vd_vd_vd_vd((x8), (vmla_vd_vd_vd_vd((x4), (vcast_vd_d(0.13860436390467167910856)), (vmla_vd_vd_vd_vd((vd2getx_vd_vd2(x2)), (vcast_vd_d(0.131699838841615374240845)), (vcast_vd_d(0.153914168346271945653214)))))), (vmla_vd_vd_vd_vd((x4), (vmla_vd_vd_vd_vd((vd2getx_vd_vd2(x2)), (vcast_vd_d(0.181816523941564611721589)), (vcast_vd_d(0.22222224632662035403996)))), (vmla_vd_vd_vd_vd((vd2getx_vd_vd2(x2)), (vcast_vd_d(0.285714285511134091777308)), (vcast_vd_d(0.400000000000914013309483)))))))
+
+
+
+
+
+
+                                ;
+  t = vmla_vd_vd_vd_vd(t, vd2getx_vd_vd2(x2), vcast_vd_d(0.666666666666664853302393));
+
+  s = ddmul_vd2_vd2_vd(vcast_vd2_d_d(0.693147180559945286226764, 2.319046813846299558417771e-17), vcast_vd_vi(e));
+  s = ddadd_vd2_vd2_vd2(s, ddscale_vd2_vd2_vd(x, vcast_vd_d(2)));
+  s = ddadd_vd2_vd2_vd2(s, ddmul_vd2_vd2_vd(ddmul_vd2_vd2_vd2(x2, x), t));
+
+  return s;
+}
+
+SLEEF_INLINE SLEEF_CONST vdouble Sleef_asinhd2_u10avx2128(vdouble x) {
+  vdouble y = vabs_vd_vd(x);
+  vopmask o = vgt_vo_vd_vd(y, vcast_vd_d(1));
+  vdouble2 d;
+
+  d = vsel_vd2_vo_vd2_vd2(o, ddrec_vd2_vd(x), vcast_vd2_vd_vd(y, vcast_vd_d(0)));
+  d = ddsqrt_vd2_vd2(ddadd2_vd2_vd2_vd(ddsqu_vd2_vd2(d), vcast_vd_d(1)));
+  d = vsel_vd2_vo_vd2_vd2(o, ddmul_vd2_vd2_vd(d, y), d);
+
+  d = logk2(ddnormalize_vd2_vd2(ddadd2_vd2_vd2_vd(d, x)));
+  y = vadd_vd_vd_vd(vd2getx_vd_vd2(d), vd2gety_vd_vd2(d));
+
+  y = vsel_vd_vo_vd_vd(vor_vo_vo_vo(vgt_vo_vd_vd(vabs_vd_vd(x), vcast_vd_d(1.3407807929942596355e+154)),
+        visnan_vo_vd(y)),
+         vmulsign_vd_vd_vd(vcast_vd_d(__builtin_inf()), x), y);
+
+  y = vreinterpret_vd_vm(vor_vm_vo64_vm(visnan_vo_vd(x), vreinterpret_vm_vd(y)));
+  y = vsel_vd_vo_vd_vd(visnegzero_vo_vd(x), vcast_vd_d(-0.0), y);
+
+  return y;
+}
+
+SLEEF_INLINE SLEEF_CONST vdouble Sleef_acoshd2_u10avx2128(vdouble x) {
+  vdouble2 d = logk2(ddadd2_vd2_vd2_vd(ddmul_vd2_vd2_vd2(ddsqrt_vd2_vd2(ddadd2_vd2_vd_vd(x, vcast_vd_d(1))), ddsqrt_vd2_vd2(ddadd2_vd2_vd_vd(x, vcast_vd_d(-1)))), x));
+  vdouble y = vadd_vd_vd_vd(vd2getx_vd_vd2(d), vd2gety_vd_vd2(d));
+
+  y = vsel_vd_vo_vd_vd(vor_vo_vo_vo(vgt_vo_vd_vd(vabs_vd_vd(x), vcast_vd_d(1.3407807929942596355e+154)),
+        visnan_vo_vd(y)),
+         vcast_vd_d(__builtin_inf()), y);
+  y = vreinterpret_vd_vm(vandnot_vm_vo64_vm(veq_vo_vd_vd(x, vcast_vd_d(1.0)), vreinterpret_vm_vd(y)));
+
+  y = vreinterpret_vd_vm(vor_vm_vo64_vm(vlt_vo_vd_vd(x, vcast_vd_d(1.0)), vreinterpret_vm_vd(y)));
+  y = vreinterpret_vd_vm(vor_vm_vo64_vm(visnan_vo_vd(x), vreinterpret_vm_vd(y)));
+
+  return y;
+}
+
+SLEEF_INLINE SLEEF_CONST vdouble Sleef_atanhd2_u10avx2128(vdouble x) {
+  vdouble y = vabs_vd_vd(x);
+  vdouble2 d = logk2(dddiv_vd2_vd2_vd2(ddadd2_vd2_vd_vd(vcast_vd_d(1), y), ddadd2_vd2_vd_vd(vcast_vd_d(1), vneg_vd_vd(y))));
+  y = vreinterpret_vd_vm(vor_vm_vo64_vm(vgt_vo_vd_vd(y, vcast_vd_d(1.0)), vreinterpret_vm_vd(vsel_vd_vo_vd_vd(veq_vo_vd_vd(y, vcast_vd_d(1.0)), vcast_vd_d(__builtin_inf()), vmul_vd_vd_vd(vadd_vd_vd_vd(vd2getx_vd_vd2(d), vd2gety_vd_vd2(d)), vcast_vd_d(0.5))))));
+
+  y = vmulsign_vd_vd_vd(y, x);
+  y = vreinterpret_vd_vm(vor_vm_vo64_vm(vor_vo_vo_vo(visinf_vo_vd(x), visnan_vo_vd(y)), vreinterpret_vm_vd(y)));
+  y = vreinterpret_vd_vm(vor_vm_vo64_vm(visnan_vo_vd(x), vreinterpret_vm_vd(y)));
+
+  return y;
+}
+
+SLEEF_INLINE SLEEF_CONST vdouble Sleef_cbrtd2_u35avx2128(vdouble d) {
+  vdouble x, y, q = vcast_vd_d(1.0);
+  vint e, qu, re;
+  vdouble t;
+
+
+
+
+  e = vadd_vi_vi_vi(vilogbk_vi_vd(vabs_vd_vd(d)), vcast_vi_i(1));
+  d = vldexp2_vd_vd_vi(d, vneg_vi_vi(e));
+
+  t = vadd_vd_vd_vd(vcast_vd_vi(e), vcast_vd_d(6144));
+  qu = vtruncate_vi_vd(vmul_vd_vd_vd(t, vcast_vd_d(1.0/3.0)));
+  re = vtruncate_vi_vd(vsub_vd_vd_vd(t, vmul_vd_vd_vd(vcast_vd_vi(qu), vcast_vd_d(3))));
+
+  q = vsel_vd_vo_vd_vd(vcast_vo64_vo32(veq_vo_vi_vi(re, vcast_vi_i(1))), vcast_vd_d(1.2599210498948731647672106), q);
+  q = vsel_vd_vo_vd_vd(vcast_vo64_vo32(veq_vo_vi_vi(re, vcast_vi_i(2))), vcast_vd_d(1.5874010519681994747517056), q);
+  q = vldexp2_vd_vd_vi(q, vsub_vi_vi_vi(qu, vcast_vi_i(2048)));
+
+  q = vmulsign_vd_vd_vd(q, d);
+
+  d = vabs_vd_vd(d);
+
+  x = vcast_vd_d(-0.640245898480692909870982);
+  x = vmla_vd_vd_vd_vd(x, d, vcast_vd_d(2.96155103020039511818595));
+  x = vmla_vd_vd_vd_vd(x, d, vcast_vd_d(-5.73353060922947843636166));
+  x = vmla_vd_vd_vd_vd(x, d, vcast_vd_d(6.03990368989458747961407));
+  x = vmla_vd_vd_vd_vd(x, d, vcast_vd_d(-3.85841935510444988821632));
+  x = vmla_vd_vd_vd_vd(x, d, vcast_vd_d(2.2307275302496609725722));
+
+  y = vmul_vd_vd_vd(x, x); y = vmul_vd_vd_vd(y, y); x = vsub_vd_vd_vd(x, vmul_vd_vd_vd(vmlapn_vd_vd_vd_vd(d, y, x), vcast_vd_d(1.0 / 3.0)));
+  y = vmul_vd_vd_vd(vmul_vd_vd_vd(d, x), x);
+  y = vmul_vd_vd_vd(vsub_vd_vd_vd(y, vmul_vd_vd_vd(vmul_vd_vd_vd(vcast_vd_d(2.0 / 3.0), y), vmla_vd_vd_vd_vd(y, x, vcast_vd_d(-1.0)))), q);
+
+
+
+
+
+
+  return y;
+}
+
+SLEEF_INLINE SLEEF_CONST vdouble Sleef_cbrtd2_u10avx2128(vdouble d) {
+  vdouble x, y, z, t;
+  vdouble2 q2 = vcast_vd2_d_d(1, 0), u, v;
+  vint e, qu, re;
+
+
+
+
+  e = vadd_vi_vi_vi(vilogbk_vi_vd(vabs_vd_vd(d)), vcast_vi_i(1));
+  d = vldexp2_vd_vd_vi(d, vneg_vi_vi(e));
+
+  t = vadd_vd_vd_vd(vcast_vd_vi(e), vcast_vd_d(6144));
+  qu = vtruncate_vi_vd(vmul_vd_vd_vd(t, vcast_vd_d(1.0/3.0)));
+  re = vtruncate_vi_vd(vsub_vd_vd_vd(t, vmul_vd_vd_vd(vcast_vd_vi(qu), vcast_vd_d(3))));
+
+  q2 = vsel_vd2_vo_vd2_vd2(vcast_vo64_vo32(veq_vo_vi_vi(re, vcast_vi_i(1))), vcast_vd2_d_d(1.2599210498948731907, -2.5899333753005069177e-17), q2);
+  q2 = vsel_vd2_vo_vd2_vd2(vcast_vo64_vo32(veq_vo_vi_vi(re, vcast_vi_i(2))), vcast_vd2_d_d(1.5874010519681995834, -1.0869008194197822986e-16), q2);
+
+  q2 = vd2setxy_vd2_vd_vd(vmulsign_vd_vd_vd(vd2getx_vd_vd2(q2), d), vmulsign_vd_vd_vd(vd2gety_vd_vd2(q2), d));
+  d = vabs_vd_vd(d);
+
+  x = vcast_vd_d(-0.640245898480692909870982);
+  x = vmla_vd_vd_vd_vd(x, d, vcast_vd_d(2.96155103020039511818595));
+  x = vmla_vd_vd_vd_vd(x, d, vcast_vd_d(-5.73353060922947843636166));
+  x = vmla_vd_vd_vd_vd(x, d, vcast_vd_d(6.03990368989458747961407));
+  x = vmla_vd_vd_vd_vd(x, d, vcast_vd_d(-3.85841935510444988821632));
+  x = vmla_vd_vd_vd_vd(x, d, vcast_vd_d(2.2307275302496609725722));
+
+  y = vmul_vd_vd_vd(x, x); y = vmul_vd_vd_vd(y, y); x = vsub_vd_vd_vd(x, vmul_vd_vd_vd(vmlapn_vd_vd_vd_vd(d, y, x), vcast_vd_d(1.0 / 3.0)));
+
+  z = x;
+
+  u = ddmul_vd2_vd_vd(x, x);
+  u = ddmul_vd2_vd2_vd2(u, u);
+  u = ddmul_vd2_vd2_vd(u, d);
+  u = ddadd2_vd2_vd2_vd(u, vneg_vd_vd(x));
+  y = vadd_vd_vd_vd(vd2getx_vd_vd2(u), vd2gety_vd_vd2(u));
+
+  y = vmul_vd_vd_vd(vmul_vd_vd_vd(vcast_vd_d(-2.0 / 3.0), y), z);
+  v = ddadd2_vd2_vd2_vd(ddmul_vd2_vd_vd(z, z), y);
+  v = ddmul_vd2_vd2_vd(v, d);
+  v = ddmul_vd2_vd2_vd2(v, q2);
+  z = vldexp2_vd_vd_vi(vadd_vd_vd_vd(vd2getx_vd_vd2(v), vd2gety_vd_vd2(v)), vsub_vi_vi_vi(qu, vcast_vi_i(2048)));
+
+
+  z = vsel_vd_vo_vd_vd(visinf_vo_vd(d), vmulsign_vd_vd_vd(vcast_vd_d(__builtin_inf()), vd2getx_vd_vd2(q2)), z);
+  z = vsel_vd_vo_vd_vd(veq_vo_vd_vd(d, vcast_vd_d(0)), vreinterpret_vd_vm(vsignbit_vm_vd(vd2getx_vd_vd2(q2))), z);
+
+
+
+
+
+  return z;
+}
+
+
+SLEEF_INLINE SLEEF_CONST vdouble Sleef_exp2d2_u10avx2128(vdouble d) {
+  vdouble u = vrint_vd_vd(d), s;
+  vint q = vrint_vi_vd(u);
+
+  s = vsub_vd_vd_vd(d, u);
+
+  vdouble s2 = vmul_vd_vd_vd(s, s), s4 = vmul_vd_vd_vd(s2, s2), s8 = vmul_vd_vd_vd(s4, s4);
+  u = vmla_vd_vd_vd_vd((s8), (vmla_vd_vd_vd_vd((s), (vcast_vd_d(+0.4434359082926529454e-9)), (vcast_vd_d(+0.7073164598085707425e-8)))), (vmla_vd_vd_vd_vd((s4), (vmla_vd_vd_vd_vd((s2), (vmla_vd_vd_vd_vd((s), (vcast_vd_d(+0.1017819260921760451e-6)), (vcast_vd_d(+0.1321543872511327615e-5)))), (vmla_vd_vd_vd_vd((s), (vcast_vd_d(+0.1525273353517584730e-4)), (vcast_vd_d(+0.1540353045101147808e-3)))))), (vmla_vd_vd_vd_vd((s2), (vmla_vd_vd_vd_vd((s), (vcast_vd_d(+0.1333355814670499073e-2)), (vcast_vd_d(+0.9618129107597600536e-2)))), (vmla_vd_vd_vd_vd((s), (vcast_vd_d(+0.5550410866482046596e-1)), (vcast_vd_d(+0.2402265069591012214e+0)))))))))
+
+                                ;
+  u = vmla_vd_vd_vd_vd(u, s, vcast_vd_d(+0.6931471805599452862e+0));
+
+
+  u = vfma_vd_vd_vd_vd(u, s, vcast_vd_d(1));
+
+
+
+
+  u = vldexp2_vd_vd_vi(u, q);
+
+  u = vsel_vd_vo_vd_vd(vge_vo_vd_vd(d, vcast_vd_d(1024)), vcast_vd_d(__builtin_inf()), u);
+  u = vreinterpret_vd_vm(vandnot_vm_vo64_vm(vlt_vo_vd_vd(d, vcast_vd_d(-2000)), vreinterpret_vm_vd(u)));
+
+  return u;
+}
+
+SLEEF_INLINE SLEEF_CONST vdouble Sleef_exp2d2_u35avx2128(vdouble d) {
+  vdouble u = vrint_vd_vd(d), s;
+  vint q = vrint_vi_vd(u);
+
+  s = vsub_vd_vd_vd(d, u);
+
+  vdouble s2 = vmul_vd_vd_vd(s, s), s4 = vmul_vd_vd_vd(s2, s2), s8 = vmul_vd_vd_vd(s4, s4);
+  u = vmla_vd_vd_vd_vd((s8), (vmla_vd_vd_vd_vd((s), (vcast_vd_d(+0.4434359082926529454e-9)), (vcast_vd_d(+0.7073164598085707425e-8)))), (vmla_vd_vd_vd_vd((s4), (vmla_vd_vd_vd_vd((s2), (vmla_vd_vd_vd_vd((s), (vcast_vd_d(+0.1017819260921760451e-6)), (vcast_vd_d(+0.1321543872511327615e-5)))), (vmla_vd_vd_vd_vd((s), (vcast_vd_d(+0.1525273353517584730e-4)), (vcast_vd_d(+0.1540353045101147808e-3)))))), (vmla_vd_vd_vd_vd((s2), (vmla_vd_vd_vd_vd((s), (vcast_vd_d(+0.1333355814670499073e-2)), (vcast_vd_d(+0.9618129107597600536e-2)))), (vmla_vd_vd_vd_vd((s), (vcast_vd_d(+0.5550410866482046596e-1)), (vcast_vd_d(+0.2402265069591012214e+0)))))))))
+
+                                ;
+  u = vmla_vd_vd_vd_vd(u, s, vcast_vd_d(+0.6931471805599452862e+0));
+
+  u = vmla_vd_vd_vd_vd(u, s, vcast_vd_d(1));
+
+  u = vldexp2_vd_vd_vi(u, q);
+
+  u = vsel_vd_vo_vd_vd(vge_vo_vd_vd(d, vcast_vd_d(1024)), vcast_vd_d(__builtin_inf()), u);
+  u = vreinterpret_vd_vm(vandnot_vm_vo64_vm(vlt_vo_vd_vd(d, vcast_vd_d(-2000)), vreinterpret_vm_vd(u)));
+
+  return u;
+}
+
+SLEEF_INLINE SLEEF_CONST vdouble Sleef_exp10d2_u10avx2128(vdouble d) {
+  vdouble u = vrint_vd_vd(vmul_vd_vd_vd(d, vcast_vd_d(3.3219280948873623478703194294893901758648313930))), s;
+  vint q = vrint_vi_vd(u);
+
+  s = vmla_vd_vd_vd_vd(u, vcast_vd_d(-0.30102999566383914498), d);
+  s = vmla_vd_vd_vd_vd(u, vcast_vd_d(-1.4205023227266099418e-13), s);
+
+  u = vcast_vd_d(+0.2411463498334267652e-3);
+  u = vmla_vd_vd_vd_vd(u, s, vcast_vd_d(+0.1157488415217187375e-2));
+  u = vmla_vd_vd_vd_vd(u, s, vcast_vd_d(+0.5013975546789733659e-2));
+  u = vmla_vd_vd_vd_vd(u, s, vcast_vd_d(+0.1959762320720533080e-1));
+  u = vmla_vd_vd_vd_vd(u, s, vcast_vd_d(+0.6808936399446784138e-1));
+  u = vmla_vd_vd_vd_vd(u, s, vcast_vd_d(+0.2069958494722676234e+0));
+  u = vmla_vd_vd_vd_vd(u, s, vcast_vd_d(+0.5393829292058536229e+0));
+  u = vmla_vd_vd_vd_vd(u, s, vcast_vd_d(+0.1171255148908541655e+1));
+  u = vmla_vd_vd_vd_vd(u, s, vcast_vd_d(+0.2034678592293432953e+1));
+  u = vmla_vd_vd_vd_vd(u, s, vcast_vd_d(+0.2650949055239205876e+1));
+  u = vmla_vd_vd_vd_vd(u, s, vcast_vd_d(+0.2302585092994045901e+1));
+
+
+  u = vfma_vd_vd_vd_vd(u, s, vcast_vd_d(1));
+
+
+
+
+  u = vldexp2_vd_vd_vi(u, q);
+
+  u = vsel_vd_vo_vd_vd(vgt_vo_vd_vd(d, vcast_vd_d(308.25471555991671)), vcast_vd_d(__builtin_inf()), u);
+  u = vreinterpret_vd_vm(vandnot_vm_vo64_vm(vlt_vo_vd_vd(d, vcast_vd_d(-350)), vreinterpret_vm_vd(u)));
+
+  return u;
+}
+
+SLEEF_INLINE SLEEF_CONST vdouble Sleef_exp10d2_u35avx2128(vdouble d) {
+  vdouble u = vrint_vd_vd(vmul_vd_vd_vd(d, vcast_vd_d(3.3219280948873623478703194294893901758648313930))), s;
+  vint q = vrint_vi_vd(u);
+
+  s = vmla_vd_vd_vd_vd(u, vcast_vd_d(-0.30102999566383914498), d);
+  s = vmla_vd_vd_vd_vd(u, vcast_vd_d(-1.4205023227266099418e-13), s);
+
+  vdouble s2 = vmul_vd_vd_vd(s, s), s4 = vmul_vd_vd_vd(s2, s2), s8 = vmul_vd_vd_vd(s4, s4);
+  u = vmla_vd_vd_vd_vd((s8), (vmla_vd_vd_vd_vd((s2), (vcast_vd_d(+0.2411463498334267652e-3)), (vmla_vd_vd_vd_vd((s), (vcast_vd_d(+0.1157488415217187375e-2)), (vcast_vd_d(+0.5013975546789733659e-2)))))), (vmla_vd_vd_vd_vd((s4), (vmla_vd_vd_vd_vd((s2), (vmla_vd_vd_vd_vd((s), (vcast_vd_d(+0.1959762320720533080e-1)), (vcast_vd_d(+0.6808936399446784138e-1)))), (vmla_vd_vd_vd_vd((s), (vcast_vd_d(+0.2069958494722676234e+0)), (vcast_vd_d(+0.5393829292058536229e+0)))))), (vmla_vd_vd_vd_vd((s2), (vmla_vd_vd_vd_vd((s), (vcast_vd_d(+0.1171255148908541655e+1)), (vcast_vd_d(+0.2034678592293432953e+1)))), (vmla_vd_vd_vd_vd((s), (vcast_vd_d(+0.2650949055239205876e+1)), (vcast_vd_d(+0.2302585092994045901e+1)))))))))
+
+                                ;
+
+  u = vmla_vd_vd_vd_vd(u, s, vcast_vd_d(1));
+
+  u = vldexp2_vd_vd_vi(u, q);
+
+  u = vsel_vd_vo_vd_vd(vgt_vo_vd_vd(d, vcast_vd_d(308.25471555991671)), vcast_vd_d(__builtin_inf()), u);
+  u = vreinterpret_vd_vm(vandnot_vm_vo64_vm(vlt_vo_vd_vd(d, vcast_vd_d(-350)), vreinterpret_vm_vd(u)));
+
+  return u;
+}
+
+
+SLEEF_INLINE SLEEF_CONST vdouble Sleef_expm1d2_u10avx2128(vdouble a) {
+  vdouble2 d = ddadd2_vd2_vd2_vd(expk2(vcast_vd2_vd_vd(a, vcast_vd_d(0))), vcast_vd_d(-1.0));
+  vdouble x = vadd_vd_vd_vd(vd2getx_vd_vd2(d), vd2gety_vd_vd2(d));
+  x = vsel_vd_vo_vd_vd(vgt_vo_vd_vd(a, vcast_vd_d(709.782712893383996732223)), vcast_vd_d(__builtin_inf()), x);
+  x = vsel_vd_vo_vd_vd(vlt_vo_vd_vd(a, vcast_vd_d(-36.736800569677101399113302437)), vcast_vd_d(-1), x);
+  x = vsel_vd_vo_vd_vd(visnegzero_vo_vd(a), vcast_vd_d(-0.0), x);
+  return x;
+}
+
+SLEEF_INLINE SLEEF_CONST vdouble Sleef_log10d2_u10avx2128(vdouble d) {
+  vdouble2 x;
+  vdouble t, m, x2;
+
+
+  vopmask o = vlt_vo_vd_vd(d, vcast_vd_d(0x1p-1022));
+  d = vsel_vd_vo_vd_vd(o, vmul_vd_vd_vd(d, vcast_vd_d((double)(INT64_C(1) << 32) * (double)(INT64_C(1) << 32))), d);
+  vint e = vilogb2k_vi_vd(vmul_vd_vd_vd(d, vcast_vd_d(1.0/0.75)));
+  m = vldexp3_vd_vd_vi(d, vneg_vi_vi(e));
+  e = vsel_vi_vo_vi_vi(vcast_vo32_vo64(o), vsub_vi_vi_vi(e, vcast_vi_i(64)), e);
+
+
+
+
+
+
+  x = dddiv_vd2_vd2_vd2(ddadd2_vd2_vd_vd(vcast_vd_d(-1), m), ddadd2_vd2_vd_vd(vcast_vd_d(1), m));
+  x2 = vmul_vd_vd_vd(vd2getx_vd_vd2(x), vd2getx_vd_vd2(x));
+
+  vdouble x4 = vmul_vd_vd_vd(x2, x2), x8 = vmul_vd_vd_vd(x4, x4);
+  t = vmla_vd_vd_vd_vd((x8), (vmla_vd_vd_vd_vd((x4), (vcast_vd_d(+0.6653725819576758460e-1)), (vmla_vd_vd_vd_vd((x2), (vcast_vd_d(+0.6625722782820833712e-1)), (vcast_vd_d(+0.7898105214313944078e-1)))))), (vmla_vd_vd_vd_vd((x4), (vmla_vd_vd_vd_vd((x2), (vcast_vd_d(+0.9650955035715275132e-1)), (vcast_vd_d(+0.1240841409721444993e+0)))), (vmla_vd_vd_vd_vd((x2), (vcast_vd_d(+0.1737177927454605086e+0)), (vcast_vd_d(+0.2895296546021972617e+0)))))))
+
+
+
+
+
+
+                               ;
+
+
+  vdouble2 s = ddmul_vd2_vd2_vd(vcast_vd2_d_d(0.30102999566398119802, -2.803728127785170339e-18), vcast_vd_vi(e));
+
+
+
+
+  s = ddadd_vd2_vd2_vd2(s, ddmul_vd2_vd2_vd2(x, vcast_vd2_d_d(0.86858896380650363334, 1.1430059694096389311e-17)));
+  s = ddadd_vd2_vd2_vd(s, vmul_vd_vd_vd(vmul_vd_vd_vd(x2, vd2getx_vd_vd2(x)), t));
+
+  vdouble r = vadd_vd_vd_vd(vd2getx_vd_vd2(s), vd2gety_vd_vd2(s));
+
+
+  r = vsel_vd_vo_vd_vd(vispinf_vo_vd(d), vcast_vd_d(__builtin_inf()), r);
+  r = vsel_vd_vo_vd_vd(vor_vo_vo_vo(vlt_vo_vd_vd(d, vcast_vd_d(0)), visnan_vo_vd(d)), vcast_vd_d(__builtin_nan("")), r);
+  r = vsel_vd_vo_vd_vd(veq_vo_vd_vd(d, vcast_vd_d(0)), vcast_vd_d(-__builtin_inf()), r);
+
+
+
+
+  return r;
+}
+
+SLEEF_INLINE SLEEF_CONST vdouble Sleef_log2d2_u10avx2128(vdouble d) {
+  vdouble2 x;
+  vdouble t, m, x2;
+
+
+  vopmask o = vlt_vo_vd_vd(d, vcast_vd_d(0x1p-1022));
+  d = vsel_vd_vo_vd_vd(o, vmul_vd_vd_vd(d, vcast_vd_d((double)(INT64_C(1) << 32) * (double)(INT64_C(1) << 32))), d);
+  vint e = vilogb2k_vi_vd(vmul_vd_vd_vd(d, vcast_vd_d(1.0/0.75)));
+  m = vldexp3_vd_vd_vi(d, vneg_vi_vi(e));
+  e = vsel_vi_vo_vi_vi(vcast_vo32_vo64(o), vsub_vi_vi_vi(e, vcast_vi_i(64)), e);
+
+
+
+
+
+
+  x = dddiv_vd2_vd2_vd2(ddadd2_vd2_vd_vd(vcast_vd_d(-1), m), ddadd2_vd2_vd_vd(vcast_vd_d(1), m));
+  x2 = vmul_vd_vd_vd(vd2getx_vd_vd2(x), vd2getx_vd_vd2(x));
+
+  vdouble x4 = vmul_vd_vd_vd(x2, x2), x8 = vmul_vd_vd_vd(x4, x4);
+  t = vmla_vd_vd_vd_vd((x8), (vmla_vd_vd_vd_vd((x4), (vcast_vd_d(+0.2211941750456081490e+0)), (vmla_vd_vd_vd_vd((x2), (vcast_vd_d(+0.2200768693152277689e+0)), (vcast_vd_d(+0.2623708057488514656e+0)))))), (vmla_vd_vd_vd_vd((x4), (vmla_vd_vd_vd_vd((x2), (vcast_vd_d(+0.3205977477944495502e+0)), (vcast_vd_d(+0.4121985945485324709e+0)))), (vmla_vd_vd_vd_vd((x2), (vcast_vd_d(+0.5770780162997058982e+0)), (vcast_vd_d(+0.96179669392608091449)))))))
+
+
+
+
+
+
+                             ;
+
+
+  vdouble2 s = ddadd2_vd2_vd_vd2(vcast_vd_vi(e),
+     ddmul_vd2_vd2_vd2(x, vcast_vd2_d_d(2.885390081777926774, 6.0561604995516736434e-18)));
+
+
+
+
+
+  s = ddadd2_vd2_vd2_vd(s, vmul_vd_vd_vd(vmul_vd_vd_vd(x2, vd2getx_vd_vd2(x)), t));
+
+  vdouble r = vadd_vd_vd_vd(vd2getx_vd_vd2(s), vd2gety_vd_vd2(s));
+
+
+  r = vsel_vd_vo_vd_vd(vispinf_vo_vd(d), vcast_vd_d(__builtin_inf()), r);
+  r = vsel_vd_vo_vd_vd(vor_vo_vo_vo(vlt_vo_vd_vd(d, vcast_vd_d(0)), visnan_vo_vd(d)), vcast_vd_d(__builtin_nan("")), r);
+  r = vsel_vd_vo_vd_vd(veq_vo_vd_vd(d, vcast_vd_d(0)), vcast_vd_d(-__builtin_inf()), r);
+
+
+
+
+  return r;
+}
+
+SLEEF_INLINE SLEEF_CONST vdouble Sleef_log2d2_u35avx2128(vdouble d) {
+  vdouble m, t, x, x2;
+
+
+  vopmask o = vlt_vo_vd_vd(d, vcast_vd_d(0x1p-1022));
+  d = vsel_vd_vo_vd_vd(o, vmul_vd_vd_vd(d, vcast_vd_d((double)(INT64_C(1) << 32) * (double)(INT64_C(1) << 32))), d);
+  vint e = vilogb2k_vi_vd(vmul_vd_vd_vd(d, vcast_vd_d(1.0/0.75)));
+  m = vldexp3_vd_vd_vi(d, vneg_vi_vi(e));
+  e = vsel_vi_vo_vi_vi(vcast_vo32_vo64(o), vsub_vi_vi_vi(e, vcast_vi_i(64)), e);
+
+
+
+
+
+
+  x = vdiv_vd_vd_vd(vsub_vd_vd_vd(m, vcast_vd_d(1)), vadd_vd_vd_vd(m, vcast_vd_d(1)));
+  x2 = vmul_vd_vd_vd(x, x);
+
+  t = vcast_vd_d(+0.2211941750456081490e+0);
+  t = vmla_vd_vd_vd_vd(t, x2, vcast_vd_d(+0.2200768693152277689e+0));
+  t = vmla_vd_vd_vd_vd(t, x2, vcast_vd_d(+0.2623708057488514656e+0));
+  t = vmla_vd_vd_vd_vd(t, x2, vcast_vd_d(+0.3205977477944495502e+0));
+  t = vmla_vd_vd_vd_vd(t, x2, vcast_vd_d(+0.4121985945485324709e+0));
+  t = vmla_vd_vd_vd_vd(t, x2, vcast_vd_d(+0.5770780162997058982e+0));
+  t = vmla_vd_vd_vd_vd(t, x2, vcast_vd_d(+0.96179669392608091449 ));
+
+
+  vdouble2 s = ddadd_vd2_vd_vd2(vcast_vd_vi(e),
+    ddmul_vd2_vd_vd(x, vcast_vd_d(2.885390081777926774)));
+
+
+
+
+
+  vdouble r = vmla_vd_vd_vd_vd(t, vmul_vd_vd_vd(x, x2), vadd_vd_vd_vd(vd2getx_vd_vd2(s), vd2gety_vd_vd2(s)));
+
+
+  r = vsel_vd_vo_vd_vd(vispinf_vo_vd(d), vcast_vd_d(__builtin_inf()), r);
+  r = vsel_vd_vo_vd_vd(vor_vo_vo_vo(vlt_vo_vd_vd(d, vcast_vd_d(0)), visnan_vo_vd(d)), vcast_vd_d(__builtin_nan("")), r);
+  r = vsel_vd_vo_vd_vd(veq_vo_vd_vd(d, vcast_vd_d(0)), vcast_vd_d(-__builtin_inf()), r);
+
+
+
+
+  return r;
+}
+
+SLEEF_INLINE SLEEF_CONST vdouble Sleef_log1pd2_u10avx2128(vdouble d) {
+  vdouble2 x;
+  vdouble t, m, x2;
+
+  vdouble dp1 = vadd_vd_vd_vd(d, vcast_vd_d(1));
+
+
+  vopmask o = vlt_vo_vd_vd(dp1, vcast_vd_d(0x1p-1022));
+  dp1 = vsel_vd_vo_vd_vd(o, vmul_vd_vd_vd(dp1, vcast_vd_d((double)(INT64_C(1) << 32) * (double)(INT64_C(1) << 32))), dp1);
+  vint e = vilogb2k_vi_vd(vmul_vd_vd_vd(dp1, vcast_vd_d(1.0/0.75)));
+  t = vldexp3_vd_vd_vi(vcast_vd_d(1), vneg_vi_vi(e));
+  m = vmla_vd_vd_vd_vd(d, t, vsub_vd_vd_vd(t, vcast_vd_d(1)));
+  e = vsel_vi_vo_vi_vi(vcast_vo32_vo64(o), vsub_vi_vi_vi(e, vcast_vi_i(64)), e);
+  vdouble2 s = ddmul_vd2_vd2_vd(vcast_vd2_d_d(0.693147180559945286226764, 2.319046813846299558417771e-17), vcast_vd_vi(e));
+
+  x = dddiv_vd2_vd2_vd2(vcast_vd2_vd_vd(m, vcast_vd_d(0)), ddadd_vd2_vd_vd(vcast_vd_d(2), m));
+  x2 = vmul_vd_vd_vd(vd2getx_vd_vd2(x), vd2getx_vd_vd2(x));
+
+  vdouble x4 = vmul_vd_vd_vd(x2, x2), x8 = vmul_vd_vd_vd(x4, x4);
+  t = vmla_vd_vd_vd_vd((x8), (vmla_vd_vd_vd_vd((x4), (vcast_vd_d(0.1532076988502701353e+0)), (vmla_vd_vd_vd_vd((x2), (vcast_vd_d(0.1525629051003428716e+0)), (vcast_vd_d(0.1818605932937785996e+0)))))), (vmla_vd_vd_vd_vd((x4), (vmla_vd_vd_vd_vd((x2), (vcast_vd_d(0.2222214519839380009e+0)), (vcast_vd_d(0.2857142932794299317e+0)))), (vmla_vd_vd_vd_vd((x2), (vcast_vd_d(0.3999999999635251990e+0)), (vcast_vd_d(0.6666666666667333541e+0)))))))
+
+
+
+
+
+
+                              ;
+
+  s = ddadd_vd2_vd2_vd2(s, ddscale_vd2_vd2_vd(x, vcast_vd_d(2)));
+  s = ddadd_vd2_vd2_vd(s, vmul_vd_vd_vd(vmul_vd_vd_vd(x2, vd2getx_vd_vd2(x)), t));
+
+  vdouble r = vadd_vd_vd_vd(vd2getx_vd_vd2(s), vd2gety_vd_vd2(s));
+
+  r = vsel_vd_vo_vd_vd(vgt_vo_vd_vd(d, vcast_vd_d(1e+307)), vcast_vd_d(__builtin_inf()), r);
+  r = vsel_vd_vo_vd_vd(vor_vo_vo_vo(vlt_vo_vd_vd(d, vcast_vd_d(-1)), visnan_vo_vd(d)), vcast_vd_d(__builtin_nan("")), r);
+  r = vsel_vd_vo_vd_vd(veq_vo_vd_vd(d, vcast_vd_d(-1)), vcast_vd_d(-__builtin_inf()), r);
+  r = vsel_vd_vo_vd_vd(visnegzero_vo_vd(d), vcast_vd_d(-0.0), r);
+
+  return r;
+}
+
+//
+
+SLEEF_INLINE SLEEF_CONST vdouble Sleef_fabsd2_avx2128(vdouble x) { return vabs_vd_vd(x); }
+
+SLEEF_INLINE SLEEF_CONST vdouble Sleef_copysignd2_avx2128(vdouble x, vdouble y) { return vcopysign_vd_vd_vd(x, y); }
+
+SLEEF_INLINE SLEEF_CONST vdouble Sleef_fmaxd2_avx2128(vdouble x, vdouble y) {
+
+  return vsel_vd_vo_vd_vd(visnan_vo_vd(y), x, vmax_vd_vd_vd(x, y));
+
+
+
+}
+
+SLEEF_INLINE SLEEF_CONST vdouble Sleef_fmind2_avx2128(vdouble x, vdouble y) {
+
+  return vsel_vd_vo_vd_vd(visnan_vo_vd(y), x, vmin_vd_vd_vd(x, y));
+
+
+
+}
+
+SLEEF_INLINE SLEEF_CONST vdouble Sleef_fdimd2_avx2128(vdouble x, vdouble y) {
+  vdouble ret = vsub_vd_vd_vd(x, y);
+  ret = vsel_vd_vo_vd_vd(vor_vo_vo_vo(vlt_vo_vd_vd(ret, vcast_vd_d(0)), veq_vo_vd_vd(x, y)), vcast_vd_d(0), ret);
+  return ret;
+}
+
+SLEEF_INLINE SLEEF_CONST vdouble Sleef_truncd2_avx2128(vdouble x) { return vtruncate2_vd_vd(x); }
+SLEEF_INLINE SLEEF_CONST vdouble Sleef_floord2_avx2128(vdouble x) { return vfloor2_vd_vd(x); }
+SLEEF_INLINE SLEEF_CONST vdouble Sleef_ceild2_avx2128(vdouble x) { return vceil2_vd_vd(x); }
+SLEEF_INLINE SLEEF_CONST vdouble Sleef_roundd2_avx2128(vdouble x) { return vround2_vd_vd(x); }
+SLEEF_INLINE SLEEF_CONST vdouble Sleef_rintd2_avx2128(vdouble x) { return vrint2_vd_vd(x); }
+
+SLEEF_INLINE SLEEF_CONST vdouble Sleef_nextafterd2_avx2128(vdouble x, vdouble y) {
+  x = vsel_vd_vo_vd_vd(veq_vo_vd_vd(x, vcast_vd_d(0)), vmulsign_vd_vd_vd(vcast_vd_d(0), y), x);
+  vmask xi2 = vreinterpret_vm_vd(x);
+  vopmask c = vxor_vo_vo_vo(vsignbit_vo_vd(x), vge_vo_vd_vd(y, x));
+
+  xi2 = vsel_vm_vo64_vm_vm(c, vneg64_vm_vm(vxor_vm_vm_vm(xi2, vcast_vm_i_i((int)(1U << 31), 0))), xi2);
+
+  xi2 = vsel_vm_vo64_vm_vm(vneq_vo_vd_vd(x, y), vsub64_vm_vm_vm(xi2, vcast_vm_i_i(0, 1)), xi2);
+
+  xi2 = vsel_vm_vo64_vm_vm(c, vneg64_vm_vm(vxor_vm_vm_vm(xi2, vcast_vm_i_i((int)(1U << 31), 0))), xi2);
+
+  vdouble ret = vreinterpret_vd_vm(xi2);
+
+  ret = vsel_vd_vo_vd_vd(vand_vo_vo_vo(veq_vo_vd_vd(ret, vcast_vd_d(0)), vneq_vo_vd_vd(x, vcast_vd_d(0))),
+    vmulsign_vd_vd_vd(vcast_vd_d(0), x), ret);
+
+  ret = vsel_vd_vo_vd_vd(vand_vo_vo_vo(veq_vo_vd_vd(x, vcast_vd_d(0)), veq_vo_vd_vd(y, vcast_vd_d(0))), y, ret);
+
+  ret = vsel_vd_vo_vd_vd(vor_vo_vo_vo(visnan_vo_vd(x), visnan_vo_vd(y)), vcast_vd_d(__builtin_nan("")), ret);
+
+  return ret;
+}
+
+SLEEF_INLINE SLEEF_CONST vdouble Sleef_frfrexpd2_avx2128(vdouble x) {
+  x = vsel_vd_vo_vd_vd(vlt_vo_vd_vd(vabs_vd_vd(x), vcast_vd_d(0x1p-1022)), vmul_vd_vd_vd(x, vcast_vd_d(UINT64_C(1) << 63)), x);
+
+  vmask xm = vreinterpret_vm_vd(x);
+  xm = vand_vm_vm_vm(xm, vcast_vm_i64(~INT64_C(0x7ff0000000000000)));
+  xm = vor_vm_vm_vm (xm, vcast_vm_i64( INT64_C(0x3fe0000000000000)));
+
+  vdouble ret = vreinterpret_vd_vm(xm);
+
+  ret = vsel_vd_vo_vd_vd(visinf_vo_vd(x), vmulsign_vd_vd_vd(vcast_vd_d(__builtin_inf()), x), ret);
+  ret = vsel_vd_vo_vd_vd(veq_vo_vd_vd(x, vcast_vd_d(0)), x, ret);
+
+  return ret;
+}
+
+SLEEF_INLINE SLEEF_CONST vint Sleef_expfrexpd2_avx2128(vdouble x) {
+  x = vsel_vd_vo_vd_vd(vlt_vo_vd_vd(vabs_vd_vd(x), vcast_vd_d(0x1p-1022)), vmul_vd_vd_vd(x, vcast_vd_d(UINT64_C(1) << 63)), x);
+
+  vint ret = vcastu_vi_vm(vreinterpret_vm_vd(x));
+  ret = vsub_vi_vi_vi(vand_vi_vi_vi(vsrl_vi_vi_i(ret, 20), vcast_vi_i(0x7ff)), vcast_vi_i(0x3fe));
+
+  ret = vsel_vi_vo_vi_vi(vor_vo_vo_vo(vor_vo_vo_vo(veq_vo_vd_vd(x, vcast_vd_d(0)), visnan_vo_vd(x)), visinf_vo_vd(x)), vcast_vi_i(0), ret);
+
+  return ret;
+}
+
+SLEEF_INLINE SLEEF_CONST vdouble Sleef_fmad2_avx2128(vdouble x, vdouble y, vdouble z) {
+
+  return vfma_vd_vd_vd_vd(x, y, z);
+
+}
+
+SLEEF_INLINE SLEEF_CONST vdouble Sleef_sqrtd2_u05avx2128(vdouble d) {
+
+  vdouble q, w, x, y, z;
+
+  d = vsel_vd_vo_vd_vd(vlt_vo_vd_vd(d, vcast_vd_d(0)), vcast_vd_d(__builtin_nan("")), d);
+
+  vopmask o = vlt_vo_vd_vd(d, vcast_vd_d(8.636168555094445E-78));
+  d = vsel_vd_vo_vd_vd(o, vmul_vd_vd_vd(d, vcast_vd_d(1.157920892373162E77)), d);
+  q = vsel_vd_vo_vd_vd(o, vcast_vd_d(2.9387358770557188E-39), vcast_vd_d(1));
+
+  y = vreinterpret_vd_vm(vsub64_vm_vm_vm(vcast_vm_i_i(0x5fe6ec85, 0xe7de30da), _mm_srli_epi64(vreinterpret_vm_vd(d), 1)));
+
+  x = vmul_vd_vd_vd(d, y); w = vmul_vd_vd_vd(vcast_vd_d(0.5), y);
+  y = vfmanp_vd_vd_vd_vd(x, w, vcast_vd_d(0.5));
+  x = vfma_vd_vd_vd_vd(x, y, x); w = vfma_vd_vd_vd_vd(w, y, w);
+  y = vfmanp_vd_vd_vd_vd(x, w, vcast_vd_d(0.5));
+  x = vfma_vd_vd_vd_vd(x, y, x); w = vfma_vd_vd_vd_vd(w, y, w);
+  y = vfmanp_vd_vd_vd_vd(x, w, vcast_vd_d(0.5));
+  x = vfma_vd_vd_vd_vd(x, y, x); w = vfma_vd_vd_vd_vd(w, y, w);
+
+  y = vfmanp_vd_vd_vd_vd(x, w, vcast_vd_d(1.5)); w = vadd_vd_vd_vd(w, w);
+  w = vmul_vd_vd_vd(w, y);
+  x = vmul_vd_vd_vd(w, d);
+  y = vfmapn_vd_vd_vd_vd(w, d, x); z = vfmanp_vd_vd_vd_vd(w, x, vcast_vd_d(1));
+
+  z = vfmanp_vd_vd_vd_vd(w, y, z); w = vmul_vd_vd_vd(vcast_vd_d(0.5), x);
+  w = vfma_vd_vd_vd_vd(w, z, y);
+  w = vadd_vd_vd_vd(w, x);
+
+  w = vmul_vd_vd_vd(w, q);
+
+  w = vsel_vd_vo_vd_vd(vor_vo_vo_vo(veq_vo_vd_vd(d, vcast_vd_d(0)),
+        veq_vo_vd_vd(d, vcast_vd_d(__builtin_inf()))), d, w);
+
+  w = vsel_vd_vo_vd_vd(vlt_vo_vd_vd(d, vcast_vd_d(0)), vcast_vd_d(__builtin_nan("")), w);
+
+  return w;
+
+}
+
+SLEEF_INLINE SLEEF_CONST vdouble Sleef_sqrtd2_avx2128(vdouble d) {
+
+  return vsqrt_vd_vd(d);
+
+
+
+
+}
+
+SLEEF_INLINE SLEEF_CONST vdouble Sleef_sqrtd2_u35avx2128(vdouble d) { return Sleef_sqrtd2_u05avx2128(d); }
+
+SLEEF_INLINE SLEEF_CONST vdouble Sleef_hypotd2_u05avx2128(vdouble x, vdouble y) {
+  x = vabs_vd_vd(x);
+  y = vabs_vd_vd(y);
+  vdouble min = vmin_vd_vd_vd(x, y), n = min;
+  vdouble max = vmax_vd_vd_vd(x, y), d = max;
+
+  vopmask o = vlt_vo_vd_vd(max, vcast_vd_d(0x1p-1022));
+  n = vsel_vd_vo_vd_vd(o, vmul_vd_vd_vd(n, vcast_vd_d(UINT64_C(1) << 54)), n);
+  d = vsel_vd_vo_vd_vd(o, vmul_vd_vd_vd(d, vcast_vd_d(UINT64_C(1) << 54)), d);
+
+  vdouble2 t = dddiv_vd2_vd2_vd2(vcast_vd2_vd_vd(n, vcast_vd_d(0)), vcast_vd2_vd_vd(d, vcast_vd_d(0)));
+  t = ddmul_vd2_vd2_vd(ddsqrt_vd2_vd2(ddadd2_vd2_vd2_vd(ddsqu_vd2_vd2(t), vcast_vd_d(1))), max);
+  vdouble ret = vadd_vd_vd_vd(vd2getx_vd_vd2(t), vd2gety_vd_vd2(t));
+  ret = vsel_vd_vo_vd_vd(visnan_vo_vd(ret), vcast_vd_d(__builtin_inf()), ret);
+  ret = vsel_vd_vo_vd_vd(veq_vo_vd_vd(min, vcast_vd_d(0)), max, ret);
+  ret = vsel_vd_vo_vd_vd(vor_vo_vo_vo(visnan_vo_vd(x), visnan_vo_vd(y)), vcast_vd_d(__builtin_nan("")), ret);
+  ret = vsel_vd_vo_vd_vd(vor_vo_vo_vo(veq_vo_vd_vd(x, vcast_vd_d(__builtin_inf())), veq_vo_vd_vd(y, vcast_vd_d(__builtin_inf()))), vcast_vd_d(__builtin_inf()), ret);
+
+  return ret;
+}
+
+SLEEF_INLINE SLEEF_CONST vdouble Sleef_hypotd2_u35avx2128(vdouble x, vdouble y) {
+  x = vabs_vd_vd(x);
+  y = vabs_vd_vd(y);
+  vdouble min = vmin_vd_vd_vd(x, y);
+  vdouble max = vmax_vd_vd_vd(x, y);
+
+  vdouble t = vdiv_vd_vd_vd(min, max);
+  vdouble ret = vmul_vd_vd_vd(max, vsqrt_vd_vd(vmla_vd_vd_vd_vd(t, t, vcast_vd_d(1))));
+  ret = vsel_vd_vo_vd_vd(veq_vo_vd_vd(min, vcast_vd_d(0)), max, ret);
+  ret = vsel_vd_vo_vd_vd(vor_vo_vo_vo(visnan_vo_vd(x), visnan_vo_vd(y)), vcast_vd_d(__builtin_nan("")), ret);
+  ret = vsel_vd_vo_vd_vd(vor_vo_vo_vo(veq_vo_vd_vd(x, vcast_vd_d(__builtin_inf())), veq_vo_vd_vd(y, vcast_vd_d(__builtin_inf()))), vcast_vd_d(__builtin_inf()), ret);
+
+  return ret;
+}
+
+static SLEEF_ALWAYS_INLINE SLEEF_CONST vdouble vptrunc_vd_vd(vdouble x) { // round to integer toward 0, positive argument only
+
+  return vtruncate_vd_vd(x);
+
+
+
+
+
+}
+
+/* TODO AArch64: potential optimization by using `vfmad_lane_f64` */
+SLEEF_INLINE SLEEF_CONST vdouble Sleef_fmodd2_avx2128(vdouble x, vdouble y) {
+  vdouble n = vabs_vd_vd(x), d = vabs_vd_vd(y), s = vcast_vd_d(1), q;
+  vopmask o = vlt_vo_vd_vd(d, vcast_vd_d(0x1p-1022));
+  n = vsel_vd_vo_vd_vd(o, vmul_vd_vd_vd(n, vcast_vd_d(UINT64_C(1) << 54)), n);
+  d = vsel_vd_vo_vd_vd(o, vmul_vd_vd_vd(d, vcast_vd_d(UINT64_C(1) << 54)), d);
+  s = vsel_vd_vo_vd_vd(o, vmul_vd_vd_vd(s , vcast_vd_d(1.0 / (UINT64_C(1) << 54))), s);
+  vdouble2 r = vcast_vd2_vd_vd(n, vcast_vd_d(0));
+  vdouble rd = vtoward0_vd_vd(vrec_vd_vd(d));
+
+  for(int i=0;i<21;i++) { // ceil(log2(DBL_MAX) / 52)
+    q = vptrunc_vd_vd(vmul_vd_vd_vd(vtoward0_vd_vd(vd2getx_vd_vd2(r)), rd));
+
+
+
+    q = vsel_vd_vo_vd_vd(vand_vo_vo_vo(vgt_vo_vd_vd(vmul_vd_vd_vd(vcast_vd_d(3), d), vd2getx_vd_vd2(r)),
+           vge_vo_vd_vd(vd2getx_vd_vd2(r), d)),
+    vcast_vd_d(2), q);
+    q = vsel_vd_vo_vd_vd(vand_vo_vo_vo(vgt_vo_vd_vd(vadd_vd_vd_vd(d, d), vd2getx_vd_vd2(r)),
+           vge_vo_vd_vd(vd2getx_vd_vd2(r), d)),
+    vcast_vd_d(1), q);
+    r = ddnormalize_vd2_vd2(ddadd2_vd2_vd2_vd2(r, ddmul_vd2_vd_vd(q, vneg_vd_vd(d))));
+    if (vtestallones_i_vo64(vlt_vo_vd_vd(vd2getx_vd_vd2(r), d))) break;
+  }
+
+  vdouble ret = vmul_vd_vd_vd(vd2getx_vd_vd2(r), s);
+  ret = vsel_vd_vo_vd_vd(veq_vo_vd_vd(vadd_vd_vd_vd(vd2getx_vd_vd2(r), vd2gety_vd_vd2(r)), d), vcast_vd_d(0), ret);
+
+  ret = vmulsign_vd_vd_vd(ret, x);
+
+  ret = vsel_vd_vo_vd_vd(vlt_vo_vd_vd(n, d), x, ret);
+  ret = vsel_vd_vo_vd_vd(veq_vo_vd_vd(d, vcast_vd_d(0)), vcast_vd_d(__builtin_nan("")), ret);
+
+  return ret;
+}
+
+static SLEEF_ALWAYS_INLINE vdouble vrintk2_vd_vd(vdouble d) {
+
+  return vrint_vd_vd(d);
+
+
+
+
+
+}
+
+SLEEF_INLINE SLEEF_CONST vdouble Sleef_remainderd2_avx2128(vdouble x, vdouble y) {
+  vdouble n = vabs_vd_vd(x), d = vabs_vd_vd(y), s = vcast_vd_d(1), q;
+  vopmask o = vlt_vo_vd_vd(d, vcast_vd_d(0x1p-1022*2));
+  n = vsel_vd_vo_vd_vd(o, vmul_vd_vd_vd(n, vcast_vd_d(UINT64_C(1) << 54)), n);
+  d = vsel_vd_vo_vd_vd(o, vmul_vd_vd_vd(d, vcast_vd_d(UINT64_C(1) << 54)), d);
+  s = vsel_vd_vo_vd_vd(o, vmul_vd_vd_vd(s , vcast_vd_d(1.0 / (UINT64_C(1) << 54))), s);
+  vdouble rd = vrec_vd_vd(d);
+  vdouble2 r = vcast_vd2_vd_vd(n, vcast_vd_d(0));
+  vopmask qisodd = vneq_vo_vd_vd(vcast_vd_d(0), vcast_vd_d(0));
+
+  for(int i=0;i<21;i++) { // ceil(log2(DBL_MAX) / 52)
+    q = vrintk2_vd_vd(vmul_vd_vd_vd(vd2getx_vd_vd2(r), rd));
+
+
+
+    q = vsel_vd_vo_vd_vd(vlt_vo_vd_vd(vabs_vd_vd(vd2getx_vd_vd2(r)), vmul_vd_vd_vd(d, vcast_vd_d(1.5))), vmulsign_vd_vd_vd(vcast_vd_d(1.0), vd2getx_vd_vd2(r)), q);
+    q = vsel_vd_vo_vd_vd(vor_vo_vo_vo(vlt_vo_vd_vd(vabs_vd_vd(vd2getx_vd_vd2(r)), vmul_vd_vd_vd(d, vcast_vd_d(0.5))),
+          vandnot_vo_vo_vo(qisodd, veq_vo_vd_vd(vabs_vd_vd(vd2getx_vd_vd2(r)), vmul_vd_vd_vd(d, vcast_vd_d(0.5))))),
+    vcast_vd_d(0.0), q);
+    if (vtestallones_i_vo64(veq_vo_vd_vd(q, vcast_vd_d(0)))) break;
+    q = vsel_vd_vo_vd_vd(visinf_vo_vd(vmul_vd_vd_vd(q, vneg_vd_vd(d))), vadd_vd_vd_vd(q, vmulsign_vd_vd_vd(vcast_vd_d(-1), vd2getx_vd_vd2(r))), q);
+    qisodd = vxor_vo_vo_vo(qisodd, visodd_vo_vd(q));
+    r = ddnormalize_vd2_vd2(ddadd2_vd2_vd2_vd2(r, ddmul_vd2_vd_vd(q, vneg_vd_vd(d))));
+  }
+
+  vdouble ret = vmul_vd_vd_vd(vd2getx_vd_vd2(r), s);
+  ret = vmulsign_vd_vd_vd(ret, x);
+  ret = vsel_vd_vo_vd_vd(visinf_vo_vd(y), vsel_vd_vo_vd_vd(visinf_vo_vd(x), vcast_vd_d(__builtin_nan("")), x), ret);
+  ret = vsel_vd_vo_vd_vd(veq_vo_vd_vd(d, vcast_vd_d(0)), vcast_vd_d(__builtin_nan("")), ret);
+  return ret;
+}
+
+/* TODO AArch64: potential optimization by using `vfmad_lane_f64` */
+static SLEEF_CONST dd2 gammak(vdouble a) {
+  vdouble2 clc = vcast_vd2_d_d(0, 0), clln = vcast_vd2_d_d(1, 0), clld = vcast_vd2_d_d(1, 0);
+  vdouble2 x, y, z;
+  vdouble t, u;
+
+  vopmask otiny = vlt_vo_vd_vd(vabs_vd_vd(a), vcast_vd_d(1e-306)), oref = vlt_vo_vd_vd(a, vcast_vd_d(0.5));
+
+  x = vsel_vd2_vo_vd2_vd2(otiny, vcast_vd2_d_d(0, 0),
+     vsel_vd2_vo_vd2_vd2(oref, ddadd2_vd2_vd_vd(vcast_vd_d(1), vneg_vd_vd(a)),
+           vcast_vd2_vd_vd(a, vcast_vd_d(0))));
+
+  vopmask o0 = vand_vo_vo_vo(vle_vo_vd_vd(vcast_vd_d(0.5), vd2getx_vd_vd2(x)), vle_vo_vd_vd(vd2getx_vd_vd2(x), vcast_vd_d(1.1)));
+  vopmask o2 = vle_vo_vd_vd(vcast_vd_d(2.3), vd2getx_vd_vd2(x));
+
+  y = ddnormalize_vd2_vd2(ddmul_vd2_vd2_vd2(ddadd2_vd2_vd2_vd(x, vcast_vd_d(1)), x));
+  y = ddnormalize_vd2_vd2(ddmul_vd2_vd2_vd2(ddadd2_vd2_vd2_vd(x, vcast_vd_d(2)), y));
+  y = ddnormalize_vd2_vd2(ddmul_vd2_vd2_vd2(ddadd2_vd2_vd2_vd(x, vcast_vd_d(3)), y));
+  y = ddnormalize_vd2_vd2(ddmul_vd2_vd2_vd2(ddadd2_vd2_vd2_vd(x, vcast_vd_d(4)), y));
+
+  vopmask o = vand_vo_vo_vo(o2, vle_vo_vd_vd(vd2getx_vd_vd2(x), vcast_vd_d(7)));
+  clln = vsel_vd2_vo_vd2_vd2(o, y, clln);
+
+  x = vsel_vd2_vo_vd2_vd2(o, ddadd2_vd2_vd2_vd(x, vcast_vd_d(5)), x);
+
+  t = vsel_vd_vo_vd_vd(o2, vrec_vd_vd(vd2getx_vd_vd2(x)), vd2getx_vd_vd2(ddnormalize_vd2_vd2(ddadd2_vd2_vd2_vd(x, vsel_vd_vo_d_d(o0, -1, -2)))));
+
+  u = vsel_vd_vo_vo_d_d_d(o2, o0, -156.801412704022726379848862, +0.2947916772827614196e+2, +0.7074816000864609279e-7);
+  u = vmla_vd_vd_vd_vd(u, t, vsel_vd_vo_vo_d_d_d(o2, o0, +1.120804464289911606838558160000, +0.1281459691827820109e+3, +0.4009244333008730443e-6));
+  u = vmla_vd_vd_vd_vd(u, t, vsel_vd_vo_vo_d_d_d(o2, o0, +13.39798545514258921833306020000, +0.2617544025784515043e+3, +0.1040114641628246946e-5));
+  u = vmla_vd_vd_vd_vd(u, t, vsel_vd_vo_vo_d_d_d(o2, o0, -0.116546276599463200848033357000, +0.3287022855685790432e+3, +0.1508349150733329167e-5));
+  u = vmla_vd_vd_vd_vd(u, t, vsel_vd_vo_vo_d_d_d(o2, o0, -1.391801093265337481495562410000, +0.2818145867730348186e+3, +0.1288143074933901020e-5));
+  u = vmla_vd_vd_vd_vd(u, t, vsel_vd_vo_vo_d_d_d(o2, o0, +0.015056113040026424412918973400, +0.1728670414673559605e+3, +0.4744167749884993937e-6));
+  u = vmla_vd_vd_vd_vd(u, t, vsel_vd_vo_vo_d_d_d(o2, o0, +0.179540117061234856098844714000, +0.7748735764030416817e+2, -0.6554816306542489902e-7));
+  u = vmla_vd_vd_vd_vd(u, t, vsel_vd_vo_vo_d_d_d(o2, o0, -0.002481743600264997730942489280, +0.2512856643080930752e+2, -0.3189252471452599844e-6));
+  u = vmla_vd_vd_vd_vd(u, t, vsel_vd_vo_vo_d_d_d(o2, o0, -0.029527880945699120504851034100, +0.5766792106140076868e+1, +0.1358883821470355377e-6));
+  u = vmla_vd_vd_vd_vd(u, t, vsel_vd_vo_vo_d_d_d(o2, o0, +0.000540164767892604515196325186, +0.7270275473996180571e+0, -0.4343931277157336040e-6));
+  u = vmla_vd_vd_vd_vd(u, t, vsel_vd_vo_vo_d_d_d(o2, o0, +0.006403362833808069794787256200, +0.8396709124579147809e-1, +0.9724785897406779555e-6));
+  u = vmla_vd_vd_vd_vd(u, t, vsel_vd_vo_vo_d_d_d(o2, o0, -0.000162516262783915816896611252, -0.8211558669746804595e-1, -0.2036886057225966011e-5));
+  u = vmla_vd_vd_vd_vd(u, t, vsel_vd_vo_vo_d_d_d(o2, o0, -0.001914438498565477526465972390, +0.6828831828341884458e-1, +0.4373363141819725815e-5));
+  u = vmla_vd_vd_vd_vd(u, t, vsel_vd_vo_vo_d_d_d(o2, o0, +7.20489541602001055898311517e-05, -0.7712481339961671511e-1, -0.9439951268304008677e-5));
+  u = vmla_vd_vd_vd_vd(u, t, vsel_vd_vo_vo_d_d_d(o2, o0, +0.000839498720672087279971000786, +0.8337492023017314957e-1, +0.2050727030376389804e-4));
+  u = vmla_vd_vd_vd_vd(u, t, vsel_vd_vo_vo_d_d_d(o2, o0, -5.17179090826059219329394422e-05, -0.9094964931456242518e-1, -0.4492620183431184018e-4));
+  u = vmla_vd_vd_vd_vd(u, t, vsel_vd_vo_vo_d_d_d(o2, o0, -0.000592166437353693882857342347, +0.1000996313575929358e+0, +0.9945751236071875931e-4));
+  u = vmla_vd_vd_vd_vd(u, t, vsel_vd_vo_vo_d_d_d(o2, o0, +6.97281375836585777403743539e-05, -0.1113342861544207724e+0, -0.2231547599034983196e-3));
+  u = vmla_vd_vd_vd_vd(u, t, vsel_vd_vo_vo_d_d_d(o2, o0, +0.000784039221720066627493314301, +0.1255096673213020875e+0, +0.5096695247101967622e-3));
+  u = vmla_vd_vd_vd_vd(u, t, vsel_vd_vo_vo_d_d_d(o2, o0, -0.000229472093621399176949318732, -0.1440498967843054368e+0, -0.1192753911667886971e-2));
+  u = vmla_vd_vd_vd_vd(u, t, vsel_vd_vo_vo_d_d_d(o2, o0, -0.002681327160493827160473958490, +0.1695571770041949811e+0, +0.2890510330742210310e-2));
+  u = vmla_vd_vd_vd_vd(u, t, vsel_vd_vo_vo_d_d_d(o2, o0, +0.003472222222222222222175164840, -0.2073855510284092762e+0, -0.7385551028674461858e-2));
+  u = vmla_vd_vd_vd_vd(u, t, vsel_vd_vo_vo_d_d_d(o2, o0, +0.083333333333333333335592087900, +0.2705808084277815939e+0, +0.2058080842778455335e-1));
+
+  y = ddmul_vd2_vd2_vd2(ddadd2_vd2_vd2_vd(x, vcast_vd_d(-0.5)), logk2(x));
+  y = ddadd2_vd2_vd2_vd2(y, ddneg_vd2_vd2(x));
+  y = ddadd2_vd2_vd2_vd2(y, vcast_vd2_d_d(0.91893853320467278056, -3.8782941580672414498e-17)); // 0.5*log(2*M_PI)
+
+  z = ddadd2_vd2_vd2_vd(ddmul_vd2_vd_vd (u, t), vsel_vd_vo_d_d(o0, -0.4006856343865314862e+0, -0.6735230105319810201e-1));
+  z = ddadd2_vd2_vd2_vd(ddmul_vd2_vd2_vd(z, t), vsel_vd_vo_d_d(o0, +0.8224670334241132030e+0, +0.3224670334241132030e+0));
+  z = ddadd2_vd2_vd2_vd(ddmul_vd2_vd2_vd(z, t), vsel_vd_vo_d_d(o0, -0.5772156649015328655e+0, +0.4227843350984671345e+0));
+  z = ddmul_vd2_vd2_vd(z, t);
+
+  clc = vsel_vd2_vo_vd2_vd2(o2, y, z);
+
+  clld = vsel_vd2_vo_vd2_vd2(o2, ddadd2_vd2_vd2_vd(ddmul_vd2_vd_vd(u, t), vcast_vd_d(1)), clld);
+
+  y = clln;
+
+  clc = vsel_vd2_vo_vd2_vd2(otiny, vcast_vd2_d_d(83.1776616671934334590333, 3.67103459631568507221878e-15), // log(2^120)
+       vsel_vd2_vo_vd2_vd2(oref, ddadd2_vd2_vd2_vd2(vcast_vd2_d_d(1.1447298858494001639, 1.026595116270782638e-17), ddneg_vd2_vd2(clc)), clc)); // log(M_PI)
+  clln = vsel_vd2_vo_vd2_vd2(otiny, vcast_vd2_d_d(1, 0), vsel_vd2_vo_vd2_vd2(oref, clln, clld));
+
+  if (!vtestallones_i_vo64(vnot_vo64_vo64(oref))) {
+    t = vsub_vd_vd_vd(a, vmul_vd_vd_vd(vcast_vd_d(INT64_C(1) << 28), vcast_vd_vi(vtruncate_vi_vd(vmul_vd_vd_vd(a, vcast_vd_d(1.0 / (INT64_C(1) << 28)))))));
+    x = ddmul_vd2_vd2_vd2(clld, sinpik(t));
+  }
+
+  clld = vsel_vd2_vo_vd2_vd2(otiny, vcast_vd2_vd_vd(vmul_vd_vd_vd(a, vcast_vd_d((INT64_C(1) << 60)*(double)(INT64_C(1) << 60))), vcast_vd_d(0)),
+        vsel_vd2_vo_vd2_vd2(oref, x, y));
+
+  return dd2setab_dd2_vd2_vd2(clc, dddiv_vd2_vd2_vd2(clln, clld));
+}
+
+SLEEF_INLINE SLEEF_CONST vdouble Sleef_tgammad2_u10avx2128(vdouble a) {
+  dd2 d = gammak(a);
+  vdouble2 y = ddmul_vd2_vd2_vd2(expk2(dd2geta_vd2_dd2(d)), dd2getb_vd2_dd2(d));
+  vdouble r = vadd_vd_vd_vd(vd2getx_vd_vd2(y), vd2gety_vd_vd2(y));
+  vopmask o;
+
+  o = vor_vo_vo_vo(vor_vo_vo_vo(veq_vo_vd_vd(a, vcast_vd_d(-__builtin_inf())),
+    vand_vo_vo_vo(vlt_vo_vd_vd(a, vcast_vd_d(0)), visint_vo_vd(a))),
+     vand_vo_vo_vo(vand_vo_vo_vo(visnumber_vo_vd(a), vlt_vo_vd_vd(a, vcast_vd_d(0))), visnan_vo_vd(r)));
+  r = vsel_vd_vo_vd_vd(o, vcast_vd_d(__builtin_nan("")), r);
+
+  o = vand_vo_vo_vo(vand_vo_vo_vo(vor_vo_vo_vo(veq_vo_vd_vd(a, vcast_vd_d(__builtin_inf())), visnumber_vo_vd(a)),
+      vge_vo_vd_vd(a, vcast_vd_d(-0x1p-1022))),
+      vor_vo_vo_vo(vor_vo_vo_vo(veq_vo_vd_vd(a, vcast_vd_d(0)), vgt_vo_vd_vd(a, vcast_vd_d(200))), visnan_vo_vd(r)));
+  r = vsel_vd_vo_vd_vd(o, vmulsign_vd_vd_vd(vcast_vd_d(__builtin_inf()), a), r);
+
+  return r;
+}
+
+SLEEF_INLINE SLEEF_CONST vdouble Sleef_lgammad2_u10avx2128(vdouble a) {
+  dd2 d = gammak(a);
+  vdouble2 y = ddadd2_vd2_vd2_vd2(dd2geta_vd2_dd2(d), logk2(ddabs_vd2_vd2(dd2getb_vd2_dd2(d))));
+  vdouble r = vadd_vd_vd_vd(vd2getx_vd_vd2(y), vd2gety_vd_vd2(y));
+  vopmask o;
+
+  o = vor_vo_vo_vo(visinf_vo_vd(a),
+     vor_vo_vo_vo(vand_vo_vo_vo(vle_vo_vd_vd(a, vcast_vd_d(0)), visint_vo_vd(a)),
+    vand_vo_vo_vo(visnumber_vo_vd(a), visnan_vo_vd(r))));
+  r = vsel_vd_vo_vd_vd(o, vcast_vd_d(__builtin_inf()), r);
+
+  return r;
+}
+
+static SLEEF_ALWAYS_INLINE SLEEF_CONST vdouble2 ddmla_vd2_vd_vd2_vd2(vdouble x, vdouble2 y, vdouble2 z) {
+  return ddadd_vd2_vd2_vd2(z, ddmul_vd2_vd2_vd(y, x));
+}
+
+static SLEEF_ALWAYS_INLINE SLEEF_CONST vdouble2 poly2dd_b(vdouble x, vdouble2 c1, vdouble2 c0) { return ddmla_vd2_vd_vd2_vd2(x, c1, c0); }
+static SLEEF_ALWAYS_INLINE SLEEF_CONST vdouble2 poly2dd(vdouble x, vdouble c1, vdouble2 c0) { return ddmla_vd2_vd_vd2_vd2(x, vcast_vd2_vd_vd(c1, vcast_vd_d(0)), c0); }
+static SLEEF_ALWAYS_INLINE SLEEF_CONST vdouble2 poly4dd(vdouble x, vdouble c3, vdouble2 c2, vdouble2 c1, vdouble2 c0) {
+  return ddmla_vd2_vd_vd2_vd2(vmul_vd_vd_vd(x, x), poly2dd(x, c3, c2), poly2dd_b(x, c1, c0));
+}
+
+SLEEF_INLINE SLEEF_CONST vdouble Sleef_erfd2_u10avx2128(vdouble a) {
+  vdouble t, x = vabs_vd_vd(a);
+  vdouble2 t2;
+  vdouble x2 = vmul_vd_vd_vd(x, x), x4 = vmul_vd_vd_vd(x2, x2);
+  vdouble x8 = vmul_vd_vd_vd(x4, x4), x16 = vmul_vd_vd_vd(x8, x8);
+  vopmask o25 = vle_vo_vd_vd(x, vcast_vd_d(2.5));
+
+  if (__builtin_expect(!!(vtestallones_i_vo64(o25)), 1)) {
+    // Abramowitz and Stegun
+    t = vmla_vd_vd_vd_vd((x16), (vmla_vd_vd_vd_vd((x4), (vcast_vd_d(-0.2083271002525222097e-14)), (vmla_vd_vd_vd_vd((x2), (vmla_vd_vd_vd_vd((x), (vcast_vd_d(+0.7151909970790897009e-13)), (vcast_vd_d(-0.1162238220110999364e-11)))), (vmla_vd_vd_vd_vd((x), (vcast_vd_d(+0.1186474230821585259e-10)), (vcast_vd_d(-0.8499973178354613440e-10)))))))), (vmla_vd_vd_vd_vd((x8), (vmla_vd_vd_vd_vd((x4), (vmla_vd_vd_vd_vd((x2), (vmla_vd_vd_vd_vd((x), (vcast_vd_d(+0.4507647462598841629e-9)), (vcast_vd_d(-0.1808044474288848915e-8)))), (vmla_vd_vd_vd_vd((x), (vcast_vd_d(+0.5435081826716212389e-8)), (vcast_vd_d(-0.1143939895758628484e-7)))))), (vmla_vd_vd_vd_vd((x2), (vmla_vd_vd_vd_vd((x), (vcast_vd_d(+0.1215442362680889243e-7)), (vcast_vd_d(+0.1669878756181250355e-7)))), (vmla_vd_vd_vd_vd((x), (vcast_vd_d(-0.9808074602255194288e-7)), (vcast_vd_d(+0.1389000557865837204e-6)))))))), (vmla_vd_vd_vd_vd((x4), (vmla_vd_vd_vd_vd((x2), (vmla_vd_vd_vd_vd((x), (vcast_vd_d(+0.2945514529987331866e-6)), (vcast_vd_d(-0.1842918273003998283e-5)))), (vmla_vd_vd_vd_vd((x), (vcast_vd_d(+0.3417987836115362136e-5)), (vcast_vd_d(+0.3860236356493129101e-5)))))), (vmla_vd_vd_vd_vd((x2), (vmla_vd_vd_vd_vd((x), (vcast_vd_d(-0.3309403072749947546e-4)), (vcast_vd_d(+0.1060862922597579532e-3)))), (vmla_vd_vd_vd_vd((x), (vcast_vd_d(+0.2323253155213076174e-3)), (vcast_vd_d(+0.1490149719145544729e-3)))))))))))
+
+                                  ;
+    t2 = poly4dd(x, t,
+   vcast_vd2_d_d(0.0092877958392275604405, 7.9287559463961107493e-19),
+   vcast_vd2_d_d(0.042275531758784692937, 1.3785226620501016138e-19),
+   vcast_vd2_d_d(0.07052369794346953491, 9.5846628070792092842e-19));
+    t2 = ddadd_vd2_vd_vd2(vcast_vd_d(1), ddmul_vd2_vd2_vd(t2, x));
+    t2 = ddsqu_vd2_vd2(t2);
+    t2 = ddsqu_vd2_vd2(t2);
+    t2 = ddsqu_vd2_vd2(t2);
+    t2 = ddsqu_vd2_vd2(t2);
+    t2 = ddrec_vd2_vd2(t2);
+  } else {
+
+
+    t = vmla_vd_vd_vd_vd((x16), (vmla_vd_vd_vd_vd((x4), ((vsel_vd_vo_d_d(o25, -0.2083271002525222097e-14, -0.4024015130752621932e-18))), (vmla_vd_vd_vd_vd((x2), (vmla_vd_vd_vd_vd((x), ((vsel_vd_vo_d_d(o25, +0.7151909970790897009e-13, +0.3847193332817048172e-16))), ((vsel_vd_vo_d_d(o25, -0.1162238220110999364e-11, -0.1749316241455644088e-14))))), (vmla_vd_vd_vd_vd((x), ((vsel_vd_vo_d_d(o25, +0.1186474230821585259e-10, +0.5029618322872872715e-13))), ((vsel_vd_vo_d_d(o25, -0.8499973178354613440e-10, -0.1025221466851463164e-11))))))))), (vmla_vd_vd_vd_vd((x8), (vmla_vd_vd_vd_vd((x4), (vmla_vd_vd_vd_vd((x2), (vmla_vd_vd_vd_vd((x), ((vsel_vd_vo_d_d(o25, +0.4507647462598841629e-9, +0.1573695559331945583e-10))), ((vsel_vd_vo_d_d(o25, -0.1808044474288848915e-8, -0.1884658558040203709e-9))))), (vmla_vd_vd_vd_vd((x), ((vsel_vd_vo_d_d(o25, +0.5435081826716212389e-8, +0.1798167853032159309e-8))), ((vsel_vd_vo_d_d(o25, -0.1143939895758628484e-7, -0.1380745342355033142e-7))))))), (vmla_vd_vd_vd_vd((x2), (vmla_vd_vd_vd_vd((x), ((vsel_vd_vo_d_d(o25, +0.1215442362680889243e-7, +0.8525705726469103499e-7))), ((vsel_vd_vo_d_d(o25, +0.1669878756181250355e-7, -0.4160448058101303405e-6))))), (vmla_vd_vd_vd_vd((x), ((vsel_vd_vo_d_d(o25, -0.9808074602255194288e-7, +0.1517272660008588485e-5))), ((vsel_vd_vo_d_d(o25, +0.1389000557865837204e-6, -0.3341634127317201697e-5))))))))), (vmla_vd_vd_vd_vd((x4), (vmla_vd_vd_vd_vd((x2), (vmla_vd_vd_vd_vd((x), ((vsel_vd_vo_d_d(o25, +0.2945514529987331866e-6, -0.2515023395879724513e-5))), ((vsel_vd_vo_d_d(o25, -0.1842918273003998283e-5, +0.6539731269664907554e-4))))), (vmla_vd_vd_vd_vd((x), ((vsel_vd_vo_d_d(o25, +0.3417987836115362136e-5, -0.3551065097428388658e-3))), ((vsel_vd_vo_d_d(o25, +0.3860236356493129101e-5, +0.1210736097958368864e-2))))))), (vmla_vd_vd_vd_vd((x2), (vmla_vd_vd_vd_vd((x), ((vsel_vd_vo_d_d(o25, -0.3309403072749947546e-4, -0.2605566912579998680e-2))), ((vsel_vd_vo_d_d(o25, +0.1060862922597579532e-3, +0.1252823202436093193e-2))))), (vmla_vd_vd_vd_vd((x), ((vsel_vd_vo_d_d(o25, +0.2323253155213076174e-3, +0.1820191395263313222e-1))), ((vsel_vd_vo_d_d(o25, +0.1490149719145544729e-3, -0.1021557155453465954e+0))))))))))))
+
+                                                                                  ;
+    t2 = poly4dd(x, t,
+   vsel_vd2_vo_vd2_vd2(o25, vcast_vd2_d_d(0.0092877958392275604405, 7.9287559463961107493e-19),
+         vcast_vd2_d_d(-0.63691044383641748361, -2.4249477526539431839e-17)),
+   vsel_vd2_vo_vd2_vd2(o25, vcast_vd2_d_d(0.042275531758784692937, 1.3785226620501016138e-19),
+         vcast_vd2_d_d(-1.1282926061803961737, -6.2970338860410996505e-17)),
+   vsel_vd2_vo_vd2_vd2(o25, vcast_vd2_d_d(0.07052369794346953491, 9.5846628070792092842e-19),
+         vcast_vd2_d_d(-1.2261313785184804967e-05, -5.5329707514490107044e-22)));
+    vdouble2 s2 = ddadd_vd2_vd_vd2(vcast_vd_d(1), ddmul_vd2_vd2_vd(t2, x));
+    s2 = ddsqu_vd2_vd2(s2);
+    s2 = ddsqu_vd2_vd2(s2);
+    s2 = ddsqu_vd2_vd2(s2);
+    s2 = ddsqu_vd2_vd2(s2);
+    s2 = ddrec_vd2_vd2(s2);
+    t2 = vsel_vd2_vo_vd2_vd2(o25, s2, vcast_vd2_vd_vd(expk(t2), vcast_vd_d(0)));
+  }
+
+  t2 = ddadd2_vd2_vd2_vd(t2, vcast_vd_d(-1));
+
+  vdouble z = vneg_vd_vd(vadd_vd_vd_vd(vd2getx_vd_vd2(t2), vd2gety_vd_vd2(t2)));
+  z = vsel_vd_vo_vd_vd(vlt_vo_vd_vd(x, vcast_vd_d(1e-8)), vmul_vd_vd_vd(x, vcast_vd_d(1.12837916709551262756245475959)), z);
+  z = vsel_vd_vo_vd_vd(vge_vo_vd_vd(x, vcast_vd_d(6)), vcast_vd_d(1), z);
+  z = vsel_vd_vo_vd_vd(visinf_vo_vd(a), vcast_vd_d(1), z);
+  z = vsel_vd_vo_vd_vd(veq_vo_vd_vd(a, vcast_vd_d(0)), vcast_vd_d(0), z);
+  z = vmulsign_vd_vd_vd(z, a);
+
+  return z;
+}
+
+// Returns erfc(a) for 0 <= a < 27.3 as a double-double number. If
+// scale is nonzero, the result is multiplied by 2^64 so that the
+// tail does not lose precision to subnormal numbers.
+/* TODO AArch64: potential optimization by using `vfmad_lane_f64` */
+static SLEEF_ALWAYS_INLINE SLEEF_CONST vdouble2 erfck(vdouble2 a, int scale) {
+  vdouble t;
+  vdouble2 u, d, x;
+  vopmask o0 = vlt_vo_vd_vd(vd2getx_vd_vd2(a), vcast_vd_d(1.0));
+  vopmask o1 = vlt_vo_vd_vd(vd2getx_vd_vd2(a), vcast_vd_d(2.2));
+  vopmask o2 = vlt_vo_vd_vd(vd2getx_vd_vd2(a), vcast_vd_d(4.2));
+
+  u = vsel_vd2_vo_vd2_vd2(o0, ddsqu_vd2_vd2(a), vsel_vd2_vo_vd2_vd2(o1, a, dddiv_vd2_vd2_vd2(vcast_vd2_d_d(1, 0), a)));
+
+  t = vsel_vd_vo_vo_vo_d_d_d_d(o0, o1, o2, +0.6801072401395386139e-20, +0.3438010341362585303e-12, -0.5757819536420710449e+2, +0.2334249729638701319e+5);
+  t = vmla_vd_vd_vd_vd(t, vd2getx_vd_vd2(u), vsel_vd_vo_vo_vo_d_d_d_d(o0, o1, o2, -0.2161766247570055669e-18, -0.1237021188160598264e-10, +0.4669289654498104483e+3, -0.4695661044933107769e+5));
+  t = vmla_vd_vd_vd_vd(t, vd2getx_vd_vd2(u), vsel_vd_vo_vo_vo_d_d_d_d(o0, o1, o2, +0.4695919173301595670e-17, +0.2117985839877627852e-09, -0.1796329879461355858e+4, +0.3173403108748643353e+5));
+  t = vmla_vd_vd_vd_vd(t, vd2getx_vd_vd2(u), vsel_vd_vo_vo_vo_d_d_d_d(o0, o1, o2, -0.9049140419888007122e-16, -0.2290560929177369506e-08, +0.4355892193699575728e+4, +0.3242982786959573787e+4));
+  t = vmla_vd_vd_vd_vd(t, vd2getx_vd_vd2(u), vsel_vd_vo_vo_vo_d_d_d_d(o0, o1, o2, +0.1634018903557410728e-14, +0.1748931621698149538e-07, -0.7456258884965764992e+4, -0.2014717999760347811e+5));
+  t = vmla_vd_vd_vd_vd(t, vd2getx_vd_vd2(u), vsel_vd_vo_vo_vo_d_d_d_d(o0, o1, o2, -0.2783485786333451745e-13, -0.9956602606623249195e-07, +0.9553977358167021521e+4, +0.1554006970967118286e+5));
+  t = vmla_vd_vd_vd_vd(t, vd2getx_vd_vd2(u), vsel_vd_vo_vo_vo_d_d_d_d(o0, o1, o2, +0.4463221276786415752e-12, +0.4330010240640327080e-06, -0.9470019905444229153e+4, -0.6150874190563554293e+4));
+  t = vmla_vd_vd_vd_vd(t, vd2getx_vd_vd2(u), vsel_vd_vo_vo_vo_d_d_d_d(o0, o1, o2, -0.6711366622850136563e-11, -0.1435050600991763331e-05, +0.7387344321849855078e+4, +0.1240047765634815732e+4));
+  t = vmla_vd_vd_vd_vd(t, vd2getx_vd_vd2(u), vsel_vd_vo_vo_vo_d_d_d_d(o0, o1, o2, +0.9422759050232662223e-10, +0.3460139479650695662e-05, -0.4557713054166382790e+4, -0.8210325475752699731e+2));
+  t = vmla_vd_vd_vd_vd(t, vd2getx_vd_vd2(u), vsel_vd_vo_vo_vo_d_d_d_d(o0, o1, o2, -0.1229055530100229098e-08, -0.4988908180632898173e-05, +0.2207866967354055305e+4, +0.3242443880839930870e+2));
+  t = vmla_vd_vd_vd_vd(t, vd2getx_vd_vd2(u), vsel_vd_vo_vo_vo_d_d_d_d(o0, o1, o2, +0.1480719281585086512e-07, -0.1308775976326352012e-05, -0.8217975658621754746e+3, -0.2923418863833160586e+2));
+  t = vmla_vd_vd_vd_vd(t, vd2getx_vd_vd2(u), vsel_vd_vo_vo_vo_d_d_d_d(o0, o1, o2, -0.1636584469123399803e-06, +0.2825086540850310103e-04, +0.2268659483507917400e+3, +0.3457461732814383071e+0));
+  t = vmla_vd_vd_vd_vd(t, vd2getx_vd_vd2(u), vsel_vd_vo_vo_vo_d_d_d_d(o0, o1, o2, +0.1646211436588923575e-05, -0.6393913713069986071e-04, -0.4633361260318560682e+2, +0.5489730155952392998e+1));
+  t = vmla_vd_vd_vd_vd(t, vd2getx_vd_vd2(u), vsel_vd_vo_vo_vo_d_d_d_d(o0, o1, o2, -0.1492565035840623511e-04, -0.2566436514695078926e-04, +0.9557380123733945965e+1, +0.1559934132251294134e-2));
+  t = vmla_vd_vd_vd_vd(t, vd2getx_vd_vd2(u), vsel_vd_vo_vo_vo_d_d_d_d(o0, o1, o2, +0.1205533298178967851e-03, +0.5895792375659440364e-03, -0.2958429331939661289e+1, -0.1541741566831520638e+1));
+  t = vmla_vd_vd_vd_vd(t, vd2getx_vd_vd2(u), vsel_vd_vo_vo_vo_d_d_d_d(o0, o1, o2, -0.8548327023450850081e-03, -0.1695715579163588598e-02, +0.1670329508092765480e+0, +0.2823152230558364186e-5));
+  t = vmla_vd_vd_vd_vd(t, vd2getx_vd_vd2(u), vsel_vd_vo_vo_vo_d_d_d_d(o0, o1, o2, +0.5223977625442187932e-02, +0.2089116434918055149e-03, +0.6096615680115419211e+0, +0.6249999184195342838e+0));
+  t = vmla_vd_vd_vd_vd(t, vd2getx_vd_vd2(u), vsel_vd_vo_vo_vo_d_d_d_d(o0, o1, o2, -0.2686617064513125222e-01, +0.1912855949584917753e-01, +0.1059212443193543585e-2, +0.1741749416408701288e-8));
+
+  d = ddmul_vd2_vd2_vd(u, t);
+  d = ddadd2_vd2_vd2_vd2(d, vcast_vd2_vd_vd(vsel_vd_vo_vo_vo_d_d_d_d(o0, o1, o2, 0.11283791670955126141, -0.10277263343147646779, -0.50005180473999022439, -0.5000000000258444377),
+         vsel_vd_vo_vo_vo_d_d_d_d(o0, o1, o2, -4.0175691625932118483e-18, -6.2338714083404900225e-18, 2.6362140569041995803e-17, -4.0074044712386992281e-17)));
+  d = ddmul_vd2_vd2_vd2(d, u);
+  d = ddadd2_vd2_vd2_vd2(d, vcast_vd2_vd_vd(vsel_vd_vo_vo_vo_d_d_d_d(o0, o1, o2, -0.37612638903183753802, -0.63661976742916359662, 1.601106273924963368e-06, 2.3761973137523364792e-13),
+         vsel_vd_vo_vo_vo_d_d_d_d(o0, o1, o2, 1.3391897206042552387e-17, 7.6321019159085724662e-18, 1.1974001857764476775e-23, -1.1670076950531026582e-29)));
+  d = ddmul_vd2_vd2_vd2(d, u);
+  d = ddadd2_vd2_vd2_vd2(d, vcast_vd2_vd_vd(vsel_vd_vo_vo_vo_d_d_d_d(o0, o1, o2, 1.1283791670955125586, -1.1283791674717296161, -0.57236496645145429341, -0.57236494292470108114),
+         vsel_vd_vo_vo_vo_d_d_d_d(o0, o1, o2, 1.5335459613165822674e-17, 8.0896847755965377194e-17, 3.0704553245872027258e-17, -2.3984352208056898003e-17)));
+
+  x = ddmul_vd2_vd2_vd2(vsel_vd2_vo_vd2_vd2(o1, d, ddneg_vd2_vd2(a)), a);
+  x = vsel_vd2_vo_vd2_vd2(o1, x, ddadd2_vd2_vd2_vd2(x, d));
+  if (scale) {
+    x = vsel_vd2_vo_vd2_vd2(o0, ddscale_vd2_vd2_vd(ddsub_vd2_vd2_vd2(vcast_vd2_d_d(1, 0), x), vcast_vd_d((double)(INT64_C(1) << 32) * (double)(INT64_C(1) << 32))),
+       expk2(ddadd2_vd2_vd2_vd2(x, vcast_vd2_d_d(44.3614195558365, 1.4841899608616317e-15))));
+  } else {
+    x = vsel_vd2_vo_vd2_vd2(o0, ddsub_vd2_vd2_vd2(vcast_vd2_d_d(1, 0), x), expk2(x));
+  }
+  x = vsel_vd2_vo_vd2_vd2(o1, x, ddmul_vd2_vd2_vd2(x, u));
+
+  return x;
+}
+
+SLEEF_INLINE SLEEF_CONST vdouble Sleef_erfcd2_u15avx2128(vdouble a) {
+  vdouble s = a, r;
+  a = vabs_vd_vd(a);
+  vdouble2 x = erfck(vcast_vd2_vd_vd(a, vcast_vd_d(0)), 0);
+
+  r = vsel_vd_vo_vd_vd(vlt_vo_vd_vd(a, vcast_vd_d(27.3)), vadd_vd_vd_vd(vd2getx_vd_vd2(x), vd2gety_vd_vd2(x)), vcast_vd_d(0));
+  r = vsel_vd_vo_vd_vd(vsignbit_vo_vd(s), vsub_vd_vd_vd(vcast_vd_d(2), r), r);
+  r = vsel_vd_vo_vd_vd(visnan_vo_vd(s), vcast_vd_d(__builtin_nan("")), r);
+  return r;
+}
+
+
+// The activation functions have no counterparts in the vector ABI of glibc
+
+
+// The logistic function is evaluated as 1/(1+e) or e/(1+e) with
+// e = exp(-|d|), so that the exponential never overflows. Below -512,
+// e is scaled by 2^64, which keeps the subnormal results of the
+// callers in full precision. The callers undo the scaling with one
+// multiplication by 2^-64 at the end.
+
+static SLEEF_ALWAYS_INLINE SLEEF_CONST vdouble2 sigmoidk2(vdouble2 d) {
+  vopmask n = vlt_vo_vd_vd(vd2getx_vd_vd2(d), vcast_vd_d(0));
+  vopmask o = vlt_vo_vd_vd(vd2getx_vd_vd2(d), vcast_vd_d(-512));
+  vdouble2 a = vsel_vd2_vo_vd2_vd2(n, d, ddneg_vd2_vd2(d));
+  a = ddadd2_vd2_vd2_vd2(a, vsel_vd2_vo_vd2_vd2(o, vcast_vd2_d_d(44.3614195558365, 1.4841899608616317e-15), vcast_vd2_d_d(0, 0)));
+
+  vdouble2 e = expk2(a);
+  return dddiv_vd2_vd2_vd2(vsel_vd2_vo_vd2_vd2(n, e, vcast_vd2_d_d(1, 0)), ddadd2_vd2_vd_vd2(vcast_vd_d(1), e));
+}
+
+static SLEEF_ALWAYS_INLINE SLEEF_CONST vdouble sigmoidk(vdouble2 d) {
+  vopmask n = vlt_vo_vd_vd(vd2getx_vd_vd2(d), vcast_vd_d(0));
+  vopmask o = vlt_vo_vd_vd(vd2getx_vd_vd2(d), vcast_vd_d(-512));
+  vdouble2 a = vsel_vd2_vo_vd2_vd2(n, d, ddneg_vd2_vd2(d));
+  a = ddadd2_vd2_vd2_vd2(a, vsel_vd2_vo_vd2_vd2(o, vcast_vd2_d_d(44.3614195558365, 1.4841899608616317e-15), vcast_vd2_d_d(0, 0)));
+
+  vdouble e = expk(a);
+  return vdiv_vd_vd_vd(vsel_vd_vo_vd_vd(n, e, vcast_vd_d(1)), vadd_vd_vd_vd(vcast_vd_d(1), e));
+}
+
+static SLEEF_ALWAYS_INLINE SLEEF_CONST vdouble sigmoidscalek(vdouble d) {
+  return vsel_vd_vo_vd_vd(vlt_vo_vd_vd(d, vcast_vd_d(-512)), vcast_vd_d(5.42101086242752217003726e-20), vcast_vd_d(1));
+}
+
+// 2*sqrt(2/pi)*(x + 0.044715*x^3), the argument of the logistic
+// function in the tanh approximation of GELU
+static SLEEF_ALWAYS_INLINE SLEEF_CONST vdouble2 gelutanhk(vdouble x) {
+  vdouble2 t = ddmul_vd2_vd2_vd2(vcast_vd2_d_d(0.07135481627260025, -6.175149918155315e-19), ddmul_vd2_vd_vd(x, x));
+  t = ddadd2_vd2_vd2_vd2(vcast_vd2_d_d(1.5957691216057308, -9.96930880911092e-17), t);
+  return ddmul_vd2_vd2_vd(t, x);
+}
+
+SLEEF_INLINE SLEEF_CONST vdouble Sleef_sigmoidd2_u10avx2128(vdouble x) {
+  vdouble2 d = sigmoidk2(vcast_vd2_vd_vd(x, vcast_vd_d(0)));
+  vdouble y = vadd_vd_vd_vd(vd2getx_vd_vd2(d), vd2gety_vd_vd2(d));
+  return vmul_vd_vd_vd(y, sigmoidscalek(x));
+}
+
+SLEEF_INLINE SLEEF_CONST vdouble Sleef_sigmoidd2_u35avx2128(vdouble x) {
+  return vmul_vd_vd_vd(sigmoidk(vcast_vd2_vd_vd(x, vcast_vd_d(0))), sigmoidscalek(x));
+}
+
+SLEEF_INLINE SLEEF_CONST vdouble Sleef_softplusd2_u10avx2128(vdouble x) {
+  vdouble2 e = expk2(vcast_vd2_vd_vd(vneg_vd_vd(vabs_vd_vd(x)), vcast_vd_d(0)));
+  vdouble2 d = ddadd2_vd2_vd_vd2(vmax_vd_vd_vd(x, vcast_vd_d(0)), logk2(ddadd2_vd2_vd_vd2(vcast_vd_d(1), e)));
+  vdouble y = vadd_vd_vd_vd(vd2getx_vd_vd2(d), vd2gety_vd_vd2(d));
+
+  // log(1+e) rounds to e below -40, and logk2 would lose the subnormal e
+  y = vsel_vd_vo_vd_vd(vlt_vo_vd_vd(x, vcast_vd_d(-40)), vadd_vd_vd_vd(vd2getx_vd_vd2(e), vd2gety_vd_vd2(e)), y);
+  y = vsel_vd_vo_vd_vd(vispinf_vo_vd(x), vcast_vd_d(__builtin_inf()), y);
+
+  return y;
+}
+
+SLEEF_INLINE SLEEF_CONST vdouble Sleef_softplusd2_u35avx2128(vdouble x) {
+  return vadd_vd_vd_vd(vmax_vd_vd_vd(x, vcast_vd_d(0)), Sleef_log1pd2_u10avx2128(Sleef_expd2_u10avx2128(vneg_vd_vd(vabs_vd_vd(x)))));
+}
+
+SLEEF_INLINE SLEEF_CONST vdouble Sleef_silud2_u10avx2128(vdouble x) {
+  vdouble2 d = ddmul_vd2_vd2_vd(sigmoidk2(vcast_vd2_vd_vd(x, vcast_vd_d(0))), x);
+  vdouble y = vmul_vd_vd_vd(vadd_vd_vd_vd(vd2getx_vd_vd2(d), vd2gety_vd_vd2(d)), sigmoidscalek(x));
+
+  y = vsel_vd_vo_vd_vd(vor_vo_vo_vo(vgt_vo_vd_vd(vabs_vd_vd(x), vcast_vd_d(1000)), veq_vo_vd_vd(x, vcast_vd_d(0))),
+         vsel_vd_vo_vd_vd(vsignbit_vo_vd(x), vcast_vd_d(-0.0), x), y);
+
+  return y;
+}
+
+SLEEF_INLINE SLEEF_CONST vdouble Sleef_silud2_u35avx2128(vdouble x) {
+  vdouble y = vmul_vd_vd_vd(vmul_vd_vd_vd(sigmoidk(vcast_vd2_vd_vd(x, vcast_vd_d(0))), x), sigmoidscalek(x));
+
+  y = vsel_vd_vo_vd_vd(vor_vo_vo_vo(vgt_vo_vd_vd(vabs_vd_vd(x), vcast_vd_d(1000)), veq_vo_vd_vd(x, vcast_vd_d(0))),
+         vsel_vd_vo_vd_vd(vsignbit_vo_vd(x), vcast_vd_d(-0.0), x), y);
+
+  return y;
+}
+
+SLEEF_INLINE SLEEF_CONST vdouble Sleef_gelutanhd2_u10avx2128(vdouble x) {
+  vdouble2 t = gelutanhk(x);
+  vdouble2 d = ddmul_vd2_vd2_vd(sigmoidk2(t), x);
+  vdouble y = vmul_vd_vd_vd(vadd_vd_vd_vd(vd2getx_vd_vd2(d), vd2gety_vd_vd2(d)), sigmoidscalek(vd2getx_vd_vd2(t)));
+
+  y = vsel_vd_vo_vd_vd(vor_vo_vo_vo(vgt_vo_vd_vd(vabs_vd_vd(x), vcast_vd_d(25)), veq_vo_vd_vd(x, vcast_vd_d(0))),
+         vsel_vd_vo_vd_vd(vsignbit_vo_vd(x), vcast_vd_d(-0.0), x), y);
+
+  return y;
+}
+
+SLEEF_INLINE SLEEF_CONST vdouble Sleef_gelutanhd2_u35avx2128(vdouble x) {
+  vdouble2 t = gelutanhk(x);
+  vdouble y = vmul_vd_vd_vd(vmul_vd_vd_vd(sigmoidk(t), x), sigmoidscalek(vd2getx_vd_vd2(t)));
+
+  y = vsel_vd_vo_vd_vd(vor_vo_vo_vo(vgt_vo_vd_vd(vabs_vd_vd(x), vcast_vd_d(25)), veq_vo_vd_vd(x, vcast_vd_d(0))),
+         vsel_vd_vo_vd_vd(vsignbit_vo_vd(x), vcast_vd_d(-0.0), x), y);
+
+  return y;
+}
+
+// x * Phi(x), where Phi(x) = erfc(-x/sqrt(2))/2 is evaluated with
+// the erfc kernel scaled by 2^64. The argument of the kernel is
+// kept in double-double so that it does not dominate the error.
+SLEEF_INLINE SLEEF_CONST vdouble Sleef_gelud2_u15avx2128(vdouble x) {
+  vdouble2 d = erfck(ddmul_vd2_vd2_vd(vcast_vd2_d_d(0.7071067811865476, -4.833646656726457e-17), vabs_vd_vd(x)), 1);
+  d = vsel_vd2_vo_vd2_vd2(vlt_vo_vd_vd(x, vcast_vd_d(0)), d, ddadd2_vd2_vd_vd2(vcast_vd_d(36893488147419103232.0), ddneg_vd2_vd2(d)));
+  d = ddmul_vd2_vd2_vd(d, x);
+  vdouble y = vmul_vd_vd_vd(vadd_vd_vd_vd(vd2getx_vd_vd2(d), vd2gety_vd_vd2(d)), vcast_vd_d(2.71050543121376108501863e-20));
+
+  y = vsel_vd_vo_vd_vd(vor_vo_vo_vo(vgt_vo_vd_vd(vabs_vd_vd(x), vcast_vd_d(40)), veq_vo_vd_vd(x, vcast_vd_d(0))),
+         vsel_vd_vo_vd_vd(vsignbit_vo_vd(x), vcast_vd_d(-0.0), x), y);
+
+  return y;
+}
+
+
+
+// The fast functions evaluate only a short polynomial of the reduced
+// argument, with no double-double arithmetic. The arguments for which
+// this is not valid (NaN, infinities and the ranges where the results
+// overflow or underflow) are passed to the accurate functions, which
+// are evaluated only if such an argument is in the vector.
+
+
+
+
+static SLEEF_ALWAYS_INLINE SLEEF_CONST vdouble fastexpk(vdouble s) { // e^s - 1 for |s| <= log(2)/2
+  vdouble s2 = vmul_vd_vd_vd(s, s), s4 = vmul_vd_vd_vd(s2, s2), s8 = vmul_vd_vd_vd(s4, s4);
+  vdouble u = vmla_vd_vd_vd_vd((s8), (vcast_vd_d(2.76263619470732855250039e-07)), (vmla_vd_vd_vd_vd((s4), (vmla_vd_vd_vd_vd((s2), (vmla_vd_vd_vd_vd((s), (vcast_vd_d(2.76251033141705712125572e-06)), (vcast_vd_d(2.48015062220661968567497e-05)))), (vmla_vd_vd_vd_vd((s), (vcast_vd_d(0.00019841208754248410950187)), (vcast_vd_d(0.00138888889285321563867026)))))), (vmla_vd_vd_vd_vd((s2), (vmla_vd_vd_vd_vd((s), (vcast_vd_d(0.00833333335371880083719542)), (vcast_vd_d(0.0416666666665969284699678)))), (vmla_vd_vd_vd_vd((s), (vcast_vd_d(0.16666666666648299877096)), (vcast_vd_d(0.500000000000000222044605)))))))))
+
+                                 ;
+  return vmla_vd_vd_vd_vd(s2, u, s);
+}
+
+static SLEEF_ALWAYS_INLINE SLEEF_CONST vdouble2 fastlogk(vdouble d) { // (e, log(m)) for d = m * 2^e
+
+  vint e = vilogb2k_vi_vd(vmul_vd_vd_vd(d, vcast_vd_d(1.0/0.75)));
+  vdouble m = vldexp3_vd_vd_vi(d, vneg_vi_vi(e));
+  vdouble ef = vcast_vd_vi(e);
+
+
+
+
+
+
+  vdouble x = vdiv_vd_vd_vd(vsub_vd_vd_vd(m, vcast_vd_d(1)), vadd_vd_vd_vd(vcast_vd_d(1), m));
+  vdouble x2 = vmul_vd_vd_vd(x, x), x4 = vmul_vd_vd_vd(x2, x2), x8 = vmul_vd_vd_vd(x4, x4);
+  vdouble t = vmla_vd_vd_vd_vd((x8), (vmla_vd_vd_vd_vd((x2), (vcast_vd_d(0.170992351890257826552144)), (vcast_vd_d(0.181028386447117661806061)))), (vmla_vd_vd_vd_vd((x4), (vmla_vd_vd_vd_vd((x2), (vcast_vd_d(0.222238806758126211660098)), (vcast_vd_d(0.285714128952742008049626)))), (vmla_vd_vd_vd_vd((x2), (vcast_vd_d(0.40000000054095086188255)), (vcast_vd_d(0.666666666666364315929627)))))))
+
+
+
+
+
+                                 ;
+
+  return vcast_vd2_vd_vd(ef, vmla_vd_vd_vd_vd(vmul_vd_vd_vd(x, x2), t, vadd_vd_vd_vd(x, x)));
+}
+
+SLEEF_INLINE SLEEF_CONST vdouble Sleef_fastexpd2_u3500avx2128(vdouble d) {
+  vdouble q = vrint_vd_vd(vmul_vd_vd_vd(d, vcast_vd_d(1.442695040888963407359924681001892137426645954152985934135449406931))), s;
+
+  s = vmla_vd_vd_vd_vd(q, vcast_vd_d(-.69314718055966295651160180568695068359375), d);
+  s = vmla_vd_vd_vd_vd(q, vcast_vd_d(-.28235290563031577122588448175013436025525412068e-12), s);
+
+  vdouble u = vmul_vd_vd_vd(vadd_vd_vd_vd(fastexpk(s), vcast_vd_d(1)), vpow2i_vd_vi(vrint_vi_vd(q)));
+
+  vopmask g = vlt_vo_vd_vd(vabs_vd_vd(d), vcast_vd_d(708));
+  if (!__builtin_expect(!!(vtestallones_i_vo64(g)), 1)) return vsel_vd_vo_vd_vd(g, u, Sleef_expd2_u10avx2128(d));
+
+  return u;
+}
+
+SLEEF_INLINE SLEEF_CONST vdouble Sleef_fastexp2d2_u3500avx2128(vdouble d) {
+  vdouble q = vrint_vd_vd(d);
+  vdouble s = vmul_vd_vd_vd(vsub_vd_vd_vd(d, q), vcast_vd_d(0.693147180559945286226764));
+
+  vdouble u = vmul_vd_vd_vd(vadd_vd_vd_vd(fastexpk(s), vcast_vd_d(1)), vpow2i_vd_vi(vrint_vi_vd(q)));
+
+  vopmask g = vlt_vo_vd_vd(vabs_vd_vd(d), vcast_vd_d(1022));
+  if (!__builtin_expect(!!(vtestallones_i_vo64(g)), 1)) return vsel_vd_vo_vd_vd(g, u, Sleef_exp2d2_u35avx2128(d));
+
+  return u;
+}
+
+SLEEF_INLINE SLEEF_CONST vdouble Sleef_fastlogd2_u3500avx2128(vdouble d) {
+  vdouble2 k = fastlogk(d);
+  vdouble u = vmla_vd_vd_vd_vd(vd2getx_vd_vd2(k), vcast_vd_d(0.693147180559945286226764), vd2gety_vd_vd2(k));
+
+  vopmask g = vand_vo_vo_vo(vge_vo_vd_vd(d, vcast_vd_d(0x1p-1022)), vlt_vo_vd_vd(d, vcast_vd_d(__builtin_inf())));
+  if (!__builtin_expect(!!(vtestallones_i_vo64(g)), 1)) return vsel_vd_vo_vd_vd(g, u, Sleef_logd2_u35avx2128(d));
+
+  return u;
+}
+
+SLEEF_INLINE SLEEF_CONST vdouble Sleef_fastlog2d2_u3500avx2128(vdouble d) {
+  vdouble2 k = fastlogk(d);
+  vdouble u = vmla_vd_vd_vd_vd(vd2gety_vd_vd2(k), vcast_vd_d(1.442695040888963407359924681001892137426645954152985934135449406931), vd2getx_vd_vd2(k));
+
+  vopmask g = vand_vo_vo_vo(vge_vo_vd_vd(d, vcast_vd_d(0x1p-1022)), vlt_vo_vd_vd(d, vcast_vd_d(__builtin_inf())));
+  if (!__builtin_expect(!!(vtestallones_i_vo64(g)), 1)) return vsel_vd_vo_vd_vd(g, u, Sleef_log2d2_u35avx2128(d));
+
+  return u;
+}
+
+SLEEF_INLINE SLEEF_CONST vdouble Sleef_fasttanhd2_u3500avx2128(vdouble x) {
+  vdouble d = vmul_vd_vd_vd(vmin_vd_vd_vd(vabs_vd_vd(x), vcast_vd_d(18.714973875)), vcast_vd_d(2));
+  vdouble q = vrint_vd_vd(vmul_vd_vd_vd(d, vcast_vd_d(1.442695040888963407359924681001892137426645954152985934135449406931))), s;
+
+  s = vmla_vd_vd_vd_vd(q, vcast_vd_d(-.69314718055966295651160180568695068359375), d);
+  s = vmla_vd_vd_vd_vd(q, vcast_vd_d(-.28235290563031577122588448175013436025525412068e-12), s);
+
+  vdouble t = vpow2i_vd_vi(vrint_vi_vd(q));
+  vdouble u = vmla_vd_vd_vd_vd(fastexpk(s), t, vsub_vd_vd_vd(t, vcast_vd_d(1)));
+  u = vdiv_vd_vd_vd(u, vadd_vd_vd_vd(u, vcast_vd_d(2)));
+
+  u = vmulsign_vd_vd_vd(u, x);
+  u = vreinterpret_vd_vm(vor_vm_vo64_vm(visnan_vo_vd(x), vreinterpret_vm_vd(u)));
+
+  return u;
+}
+
+SLEEF_INLINE SLEEF_CONST vdouble Sleef_fastatan2d2_u3500avx2128(vdouble y, vdouble x) {
+  vdouble ax = vabs_vd_vd(x), ay = vabs_vd_vd(y);
+  vdouble n = vmin_vd_vd_vd(ax, ay), m = vmax_vd_vd_vd(ax, ay);
+
+  // atan(n/m) = pi/4 + atan((n-m)/(n+m)) reduces the argument to |s| <= tan(pi/8)
+  vopmask o = vgt_vo_vd_vd(n, vmul_vd_vd_vd(m, vcast_vd_d(0.414213562373095048801689)));
+  vdouble s = vdiv_vd_vd_vd(vsel_vd_vo_vd_vd(o, vsub_vd_vd_vd(n, m), n), vsel_vd_vo_vd_vd(o, vadd_vd_vd_vd(n, m), m));
+
+  vdouble s2 = vmul_vd_vd_vd(s, s), s4 = vmul_vd_vd_vd(s2, s2), s8 = vmul_vd_vd_vd(s4, s4), s16 = vmul_vd_vd_vd(s8, s8);
+  vdouble t = vmla_vd_vd_vd_vd((s16), (vcast_vd_d(-0.0273035815591597674778512)), (vmla_vd_vd_vd_vd((s8), (vmla_vd_vd_vd_vd((s4), (vmla_vd_vd_vd_vd((s2), (vcast_vd_d(0.0517369237001215689919498)), (vcast_vd_d(-0.0655226337504036387970885)))), (vmla_vd_vd_vd_vd((s2), (vcast_vd_d(0.0768124237690259864530518)), (vcast_vd_d(-0.0909027183950740919060607)))))), (vmla_vd_vd_vd_vd((s4), (vmla_vd_vd_vd_vd((s2), (vcast_vd_d(0.111110903445777148279561)), (vcast_vd_d(-0.1428571394533269534044)))), (vmla_vd_vd_vd_vd((s2), (vcast_vd_d(0.199999999978474896078495)), (vcast_vd_d(-0.333333333333310888324519)))))))))
+
+                                  ;
+
+  t = vmla_vd_vd_vd_vd(vmul_vd_vd_vd(s, s2), t, s);
+  t = vadd_vd_vd_vd(t, vsel_vd_vo_d_d(o, 3.141592653589793238462643383279502884/4, 0));
+  t = vsel_vd_vo_vd_vd(vgt_vo_vd_vd(ay, ax), vsub_vd_vd_vd(vcast_vd_d(3.141592653589793238462643383279502884/2), t), t);
+  t = vsel_vd_vo_vd_vd(vsignbit_vo_vd(x), vsub_vd_vd_vd(vcast_vd_d(3.141592653589793238462643383279502884), t), t);
+  t = vmulsign_vd_vd_vd(t, y);
+
+  vopmask g = vnot_vo64_vo64(vor_vo_vo_vo(visnan_vo_vd(t), vor_vo_vo_vo(visnan_vo_vd(x), visnan_vo_vd(y))));
+  if (!__builtin_expect(!!(vtestallones_i_vo64(g)), 1)) return vsel_vd_vo_vd_vd(g, t, Sleef_atan2d2_u35avx2128(y, x));
+
+  return t;
+}
+
+// An integer estimate refined by Newton-Raphson iterations is slower
+// than the hardware division and square root on the current
+// processors, so the following two functions simply use them.
+
+SLEEF_INLINE SLEEF_CONST vdouble Sleef_fastrsqrtd2_u3500avx2128(vdouble d) { return vrec_vd_vd(Sleef_sqrtd2_avx2128(d)); }
+SLEEF_INLINE SLEEF_CONST vdouble Sleef_fastrcpd2_u3500avx2128(vdouble d) { return vrec_vd_vd(d); }
+
+
+
+
+
+
+/* Copyright (C) 1991-2022 Free Software Foundation, Inc.
+   This file is part of the GNU C Library.
+
+   The GNU C Library is free software; you can redistribute it and/or
+   modify it under the terms of the GNU Lesser General Public
+   License as published by the Free Software Foundation; either
+   version 2.1 of the License, or (at your option) any later version.
+
+   The GNU C Library is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+   Lesser General Public License for more details.
+
+   You should have received a copy of the GNU Lesser General Public
+   License along with the GNU C Library; if not, see
+   <https://www.gnu.org/licenses/>.  */
+
+
+
+
+/* This header is separate from features.h so that the compiler can
+   include it implicitly at the start of every compilation.  It must
+   not itself include <features.h> or any other header that includes
+   <features.h> because the implicit include comes before any feature
+   test macros that may be defined in a source file before it first
+   explicitly includes a system header.  GCC knows the name of this
+   header in order to preinclude it.  */
+
+/* glibc's intent is to support the IEC 559 math functionality, real
+   and complex.  If the GCC (4.9 and later) predefined macros
+   specifying compiler intent are available, use them to determine
+   whether the overall intent is to support these features; otherwise,
+   presume an older compiler has intent to support these features and
+   define these macros by default.  */
+
+/* wchar_t uses Unicode 10.0.0.  Version 10.0 of the Unicode Standard is
+   synchronized with ISO/IEC 10646:2017, fifth edition, plus
+   the following additions from Amendment 1 to the fifth edition:
+   - 56 emoji characters
+   - 285 hentaigana
+   - 3 additional Zanabazar Square characters */
+
+
+
+
+//   Copyright Naoki Shibata and contributors 2010 - 2021.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+// Always use -ffp-contract=off option to compile SLEEF.
+
+
+//   Copyright Naoki Shibata and contributors 2010 - 2021.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+SLEEFSHARPif !defined(SLEEFXXX__NVCC__) && ((defined(SLEEFXXX__SIZEOF_FLOAT128__) && SLEEFXXX__SIZEOF_FLOAT128__ == 16) || (defined(SLEEFXXX__linux__) && defined(SLEEFXXX__GNUC__) && (defined(SLEEFXXX__i386__) || defined(SLEEFXXX__x86_64__))) || (defined(SLEEFXXX__PPC64__) && defined(SLEEFXXX__GNUC__) && !defined(SLEEFXXX__clang__) && SLEEFXXX__GNUC__ >= 8))
+SLEEFSHARPdefine SLEEFXXXSLEEF_FLOAT128_IS_IEEEQP
+SLEEFSHARPendif
+
+SLEEFSHARPif !defined(SLEEFXXXSLEEF_FLOAT128_IS_IEEEQP) && !defined(SLEEFXXX__NVCC__) && defined(SLEEFXXX__SIZEOF_LONG_DOUBLE__) && SLEEFXXX__SIZEOF_LONG_DOUBLE__ == 16 && (defined(SLEEFXXX__aarch64__) || defined(SLEEFXXX__zarch__))
+SLEEFSHARPdefine SLEEFXXXSLEEF_LONGDOUBLE_IS_IEEEQP
+SLEEFSHARPendif
+
+SLEEFSHARPif !defined(SLEEFXXXSleef_quad_DEFINED)
+SLEEFSHARPdefine SLEEFXXXSleef_quad_DEFINED
+typedef struct { uint64_t x, y; } Sleef_uint64_2t;
+SLEEFSHARPif defined(SLEEFXXXSLEEF_FLOAT128_IS_IEEEQP)
+typedef __float128 Sleef_quad;
+SLEEFSHARPdefine SLEEFXXXSLEEF_QUAD_C(x) (x ## Q)
+SLEEFSHARPelif defined(SLEEFXXXSLEEF_LONGDOUBLE_IS_IEEEQP)
+typedef long double Sleef_quad;
+SLEEFSHARPdefine SLEEFXXXSLEEF_QUAD_C(x) (x ## L)
+SLEEFSHARPelse
+typedef Sleef_uint64_2t Sleef_quad;
+SLEEFSHARPendif
+SLEEFSHARPendif
+
+
+//   Copyright Naoki Shibata and contributors 2010 - 2021.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+//
+
+//
+
+/*
+  PI_A to PI_D are constants that satisfy the following two conditions.
+
+  * For PI_A, PI_B and PI_C, the last 28 bits are zero.
+  * PI_A + PI_B + PI_C + PI_D is close to PI as much as possible.
+
+  The argument of a trig function is multiplied by 1/PI, and the
+  integral part is divided into two parts, each has at most 28
+  bits. So, the maximum argument that could be correctly reduced
+  should be 2^(28*2-1) PI = 1.1e+17. However, due to internal
+  double precision calculation, the actual maximum argument that can
+  be correctly reduced is around 2^47.
+ */
+
+
+
+
+
+
+
+/*
+  PI_A2 and PI_B2 are constants that satisfy the following two conditions.
+
+  * The last 3 bits of PI_A2 are zero.
+  * PI_A2 + PI_B2 is close to PI as much as possible.
+
+  The argument of a trig function is multiplied by 1/PI, and the
+  integral part is multiplied by PI_A2. So, the maximum argument that
+  could be correctly reduced should be 2^(3-1) PI = 12.6. By testing,
+  we confirmed that it correctly reduces the argument up to around 15.
+ */
+
+//
+
+//
+
+//
+
+//
+
+
+
+
+
+
+
+
+
+
+
+extern const float Sleef_rempitabsp[];
+
+
+
+// Intel
+
+
+
+
+
+
+
+
+// Arm
+
+// IBM
+
+// Generic
+
+//
+
+
+
+
+//   Copyright Naoki Shibata and contributors 2010 - 2021.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+// These are macros for evaluating polynomials using Estrin's method
+
+
+//
+
+
+//   Copyright Naoki Shibata and contributors 2010 - 2021.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+
+
+typedef struct {
+  vfloat x, y;
+} vfloat2;
+
+
+
+
+static SLEEF_ALWAYS_INLINE SLEEF_CONST vfloat vf2getx_vf_vf2(vfloat2 v) { return v.x; }
+static SLEEF_ALWAYS_INLINE SLEEF_CONST vfloat vf2gety_vf_vf2(vfloat2 v) { return v.y; }
+static SLEEF_ALWAYS_INLINE SLEEF_CONST vfloat2 vf2setxy_vf2_vf_vf(vfloat x, vfloat y) { vfloat2 v; v.x = x; v.y = y; return v; }
+static SLEEF_ALWAYS_INLINE SLEEF_CONST vfloat2 vf2setx_vf2_vf2_vf(vfloat2 v, vfloat d) { v.x = d; return v; }
+static SLEEF_ALWAYS_INLINE SLEEF_CONST vfloat2 vf2sety_vf2_vf2_vf(vfloat2 v, vfloat d) { v.y = d; return v; }
+
+
+static SLEEF_ALWAYS_INLINE SLEEF_CONST vfloat vupper_vf_vf(vfloat d) {
+  return vreinterpret_vf_vi2(vand_vi2_vi2_vi2(vreinterpret_vi2_vf(d), vcast_vi2_i(0xfffff000)));
+}
+
+static SLEEF_ALWAYS_INLINE SLEEF_CONST vfloat2 vcast_vf2_vf_vf(vfloat h, vfloat l) {
+  return vf2setxy_vf2_vf_vf(h, l);
+}
+
+static SLEEF_ALWAYS_INLINE SLEEF_CONST vfloat2 vcast_vf2_f_f(float h, float l) {
+  return vf2setxy_vf2_vf_vf(vcast_vf_f(h), vcast_vf_f(l));
+}
+
+static SLEEF_ALWAYS_INLINE SLEEF_CONST vfloat2 vcast_vf2_d(double d) {
+  return vf2setxy_vf2_vf_vf(vcast_vf_f(d), vcast_vf_f(d - (float)d));
+}
+
+static SLEEF_ALWAYS_INLINE SLEEF_CONST vfloat2 vsel_vf2_vo_vf2_vf2(vopmask m, vfloat2 x, vfloat2 y) {
+  return vf2setxy_vf2_vf_vf(vsel_vf_vo_vf_vf(m, vf2getx_vf_vf2(x), vf2getx_vf_vf2(y)), vsel_vf_vo_vf_vf(m, vf2gety_vf_vf2(x), vf2gety_vf_vf2(y)));
+}
+
+static SLEEF_ALWAYS_INLINE SLEEF_CONST vfloat2 vsel_vf2_vo_f_f_f_f(vopmask o, float x1, float y1, float x0, float y0) {
+  return vf2setxy_vf2_vf_vf(vsel_vf_vo_f_f(o, x1, x0), vsel_vf_vo_f_f(o, y1, y0));
+}
+
+static SLEEF_ALWAYS_INLINE SLEEF_CONST vfloat2 vsel_vf2_vo_vo_d_d_d(vopmask o0, vopmask o1, double d0, double d1, double d2) {
+  return vsel_vf2_vo_vf2_vf2(o0, vcast_vf2_d(d0), vsel_vf2_vo_vf2_vf2(o1, vcast_vf2_d(d1), vcast_vf2_d(d2)));
+}
+
+static SLEEF_ALWAYS_INLINE SLEEF_CONST vfloat2 vsel_vf2_vo_vo_vo_d_d_d_d(vopmask o0, vopmask o1, vopmask o2, double d0, double d1, double d2, double d3) {
+  return vsel_vf2_vo_vf2_vf2(o0, vcast_vf2_d(d0), vsel_vf2_vo_vf2_vf2(o1, vcast_vf2_d(d1), vsel_vf2_vo_vf2_vf2(o2, vcast_vf2_d(d2), vcast_vf2_d(d3))));
+}
+
+static SLEEF_ALWAYS_INLINE SLEEF_CONST vfloat2 vabs_vf2_vf2(vfloat2 x) {
+  return vcast_vf2_vf_vf(vreinterpret_vf_vm(vxor_vm_vm_vm(vand_vm_vm_vm(vreinterpret_vm_vf(vcast_vf_f(-0.0)), vreinterpret_vm_vf(vf2getx_vf_vf2(x))), vreinterpret_vm_vf(vf2getx_vf_vf2(x)))),
+    vreinterpret_vf_vm(vxor_vm_vm_vm(vand_vm_vm_vm(vreinterpret_vm_vf(vcast_vf_f(-0.0)), vreinterpret_vm_vf(vf2getx_vf_vf2(x))), vreinterpret_vm_vf(vf2gety_vf_vf2(x)))));
+}
+
+static SLEEF_ALWAYS_INLINE SLEEF_CONST vfloat vadd_vf_3vf(vfloat v0, vfloat v1, vfloat v2) {
+  return vadd_vf_vf_vf(vadd_vf_vf_vf(v0, v1), v2);
+}
+
+static SLEEF_ALWAYS_INLINE SLEEF_CONST vfloat vadd_vf_4vf(vfloat v0, vfloat v1, vfloat v2, vfloat v3) {
+  return vadd_vf_3vf(vadd_vf_vf_vf(v0, v1), v2, v3);
+}
+
+static SLEEF_ALWAYS_INLINE SLEEF_CONST vfloat vadd_vf_5vf(vfloat v0, vfloat v1, vfloat v2, vfloat v3, vfloat v4) {
+  return vadd_vf_4vf(vadd_vf_vf_vf(v0, v1), v2, v3, v4);
+}
+
+static SLEEF_ALWAYS_INLINE SLEEF_CONST vfloat vadd_vf_6vf(vfloat v0, vfloat v1, vfloat v2, vfloat v3, vfloat v4, vfloat v5) {
+  return vadd_vf_5vf(vadd_vf_vf_vf(v0, v1), v2, v3, v4, v5);
+}
+
+static SLEEF_ALWAYS_INLINE SLEEF_CONST vfloat vadd_vf_7vf(vfloat v0, vfloat v1, vfloat v2, vfloat v3, vfloat v4, vfloat v5, vfloat v6) {
+  return vadd_vf_6vf(vadd_vf_vf_vf(v0, v1), v2, v3, v4, v5, v6);
+}
+
+static SLEEF_ALWAYS_INLINE SLEEF_CONST vfloat vsub_vf_3vf(vfloat v0, vfloat v1, vfloat v2) {
+  return vsub_vf_vf_vf(vsub_vf_vf_vf(v0, v1), v2);
+}
+
+static SLEEF_ALWAYS_INLINE SLEEF_CONST vfloat vsub_vf_4vf(vfloat v0, vfloat v1, vfloat v2, vfloat v3) {
+  return vsub_vf_3vf(vsub_vf_vf_vf(v0, v1), v2, v3);
+}
+
+static SLEEF_ALWAYS_INLINE SLEEF_CONST vfloat vsub_vf_5vf(vfloat v0, vfloat v1, vfloat v2, vfloat v3, vfloat v4) {
+  return vsub_vf_4vf(vsub_vf_vf_vf(v0, v1), v2, v3, v4);
+}
+
+//
+
+static SLEEF_ALWAYS_INLINE SLEEF_CONST vfloat2 dfneg_vf2_vf2(vfloat2 x) {
+  return vcast_vf2_vf_vf(vneg_vf_vf(vf2getx_vf_vf2(x)), vneg_vf_vf(vf2gety_vf_vf2(x)));
+}
+
+static SLEEF_ALWAYS_INLINE SLEEF_CONST vfloat2 dfabs_vf2_vf2(vfloat2 x) {
+  return vcast_vf2_vf_vf(vabs_vf_vf(vf2getx_vf_vf2(x)),
+    vreinterpret_vf_vm(vxor_vm_vm_vm(vreinterpret_vm_vf(vf2gety_vf_vf2(x)), vand_vm_vm_vm(vreinterpret_vm_vf(vf2getx_vf_vf2(x)), vreinterpret_vm_vf(vcast_vf_f(-0.0f))))));
+}
+
+static SLEEF_ALWAYS_INLINE SLEEF_CONST vfloat2 dfnormalize_vf2_vf2(vfloat2 t) {
+  vfloat s = vadd_vf_vf_vf(vf2getx_vf_vf2(t), vf2gety_vf_vf2(t));
+  return vf2setxy_vf2_vf_vf(s, vadd_vf_vf_vf(vsub_vf_vf_vf(vf2getx_vf_vf2(t), s), vf2gety_vf_vf2(t)));
+}
+
+static SLEEF_ALWAYS_INLINE SLEEF_CONST vfloat2 dfscale_vf2_vf2_vf(vfloat2 d, vfloat s) {
+  return vf2setxy_vf2_vf_vf(vmul_vf_vf_vf(vf2getx_vf_vf2(d), s), vmul_vf_vf_vf(vf2gety_vf_vf2(d), s));
+}
+
+static SLEEF_ALWAYS_INLINE SLEEF_CONST vfloat2 dfadd_vf2_vf_vf(vfloat x, vfloat y) {
+  vfloat s = vadd_vf_vf_vf(x, y);
+  return vf2setxy_vf2_vf_vf(s, vadd_vf_vf_vf(vsub_vf_vf_vf(x, s), y));
+}
+
+static SLEEF_ALWAYS_INLINE SLEEF_CONST vfloat2 dfadd2_vf2_vf_vf(vfloat x, vfloat y) {
+  vfloat s = vadd_vf_vf_vf(x, y);
+  vfloat v = vsub_vf_vf_vf(s, x);
+  return vf2setxy_vf2_vf_vf(s, vadd_vf_vf_vf(vsub_vf_vf_vf(x, vsub_vf_vf_vf(s, v)), vsub_vf_vf_vf(y, v)));
+}
+
+static SLEEF_ALWAYS_INLINE SLEEF_CONST vfloat2 dfadd2_vf2_vf_vf2(vfloat x, vfloat2 y) {
+  vfloat s = vadd_vf_vf_vf(x, vf2getx_vf_vf2(y));
+  vfloat v = vsub_vf_vf_vf(s, x);
+  return vf2setxy_vf2_vf_vf(s, vadd_vf_vf_vf(vadd_vf_vf_vf(vsub_vf_vf_vf(x, vsub_vf_vf_vf(s, v)), vsub_vf_vf_vf(vf2getx_vf_vf2(y), v)), vf2gety_vf_vf2(y)));
+
+}
+
+static SLEEF_ALWAYS_INLINE SLEEF_CONST vfloat2 dfadd_vf2_vf2_vf(vfloat2 x, vfloat y) {
+  vfloat s = vadd_vf_vf_vf(vf2getx_vf_vf2(x), y);
+  return vf2setxy_vf2_vf_vf(s, vadd_vf_3vf(vsub_vf_vf_vf(vf2getx_vf_vf2(x), s), y, vf2gety_vf_vf2(x)));
+}
+
+static SLEEF_ALWAYS_INLINE SLEEF_CONST vfloat2 dfsub_vf2_vf2_vf(vfloat2 x, vfloat y) {
+  vfloat s = vsub_vf_vf_vf(vf2getx_vf_vf2(x), y);
+  return vf2setxy_vf2_vf_vf(s, vadd_vf_vf_vf(vsub_vf_vf_vf(vsub_vf_vf_vf(vf2getx_vf_vf2(x), s), y), vf2gety_vf_vf2(x)));
+}
+
+static SLEEF_ALWAYS_INLINE SLEEF_CONST vfloat2 dfadd2_vf2_vf2_vf(vfloat2 x, vfloat y) {
+  vfloat s = vadd_vf_vf_vf(vf2getx_vf_vf2(x), y);
+  vfloat v = vsub_vf_vf_vf(s, vf2getx_vf_vf2(x));
+  vfloat t = vadd_vf_vf_vf(vsub_vf_vf_vf(vf2getx_vf_vf2(x), vsub_vf_vf_vf(s, v)), vsub_vf_vf_vf(y, v));
+  return vf2setxy_vf2_vf_vf(s, vadd_vf_vf_vf(t, vf2gety_vf_vf2(x)));
+}
+
+static SLEEF_ALWAYS_INLINE SLEEF_CONST vfloat2 dfadd_vf2_vf_vf2(vfloat x, vfloat2 y) {
+  vfloat s = vadd_vf_vf_vf(x, vf2getx_vf_vf2(y));
+  return vf2setxy_vf2_vf_vf(s, vadd_vf_3vf(vsub_vf_vf_vf(x, s), vf2getx_vf_vf2(y), vf2gety_vf_vf2(y)));
+}
+
+static SLEEF_ALWAYS_INLINE SLEEF_CONST vfloat2 dfadd_vf2_vf2_vf2(vfloat2 x, vfloat2 y) {
+  // |x| >= |y|
+
+  vfloat s = vadd_vf_vf_vf(vf2getx_vf_vf2(x), vf2getx_vf_vf2(y));
+  return vf2setxy_vf2_vf_vf(s, vadd_vf_4vf(vsub_vf_vf_vf(vf2getx_vf_vf2(x), s), vf2getx_vf_vf2(y), vf2gety_vf_vf2(x), vf2gety_vf_vf2(y)));
+}
+
+static SLEEF_ALWAYS_INLINE SLEEF_CONST vfloat2 dfadd2_vf2_vf2_vf2(vfloat2 x, vfloat2 y) {
+  vfloat s = vadd_vf_vf_vf(vf2getx_vf_vf2(x), vf2getx_vf_vf2(y));
+  vfloat v = vsub_vf_vf_vf(s, vf2getx_vf_vf2(x));
+  vfloat t = vadd_vf_vf_vf(vsub_vf_vf_vf(vf2getx_vf_vf2(x), vsub_vf_vf_vf(s, v)), vsub_vf_vf_vf(vf2getx_vf_vf2(y), v));
+  return vf2setxy_vf2_vf_vf(s, vadd_vf_vf_vf(t, vadd_vf_vf_vf(vf2gety_vf_vf2(x), vf2gety_vf_vf2(y))));
+}
+
+static SLEEF_ALWAYS_INLINE SLEEF_CONST vfloat2 dfsub_vf2_vf_vf(vfloat x, vfloat y) {
+  // |x| >= |y|
+
+  vfloat s = vsub_vf_vf_vf(x, y);
+  return vf2setxy_vf2_vf_vf(s, vsub_vf_vf_vf(vsub_vf_vf_vf(x, s), y));
+}
+
+static SLEEF_ALWAYS_INLINE SLEEF_CONST vfloat2 dfsub_vf2_vf2_vf2(vfloat2 x, vfloat2 y) {
+  // |x| >= |y|
+
+  vfloat s = vsub_vf_vf_vf(vf2getx_vf_vf2(x), vf2getx_vf_vf2(y));
+  vfloat t = vsub_vf_vf_vf(vf2getx_vf_vf2(x), s);
+  t = vsub_vf_vf_vf(t, vf2getx_vf_vf2(y));
+  t = vadd_vf_vf_vf(t, vf2gety_vf_vf2(x));
+  return vf2setxy_vf2_vf_vf(s, vsub_vf_vf_vf(t, vf2gety_vf_vf2(y)));
+}
+
+
+static SLEEF_ALWAYS_INLINE SLEEF_CONST vfloat2 dfdiv_vf2_vf2_vf2(vfloat2 n, vfloat2 d) {
+  vfloat t = vrec_vf_vf(vf2getx_vf_vf2(d));
+  vfloat s = vmul_vf_vf_vf(vf2getx_vf_vf2(n), t);
+  vfloat u = vfmapn_vf_vf_vf_vf(t, vf2getx_vf_vf2(n), s);
+  vfloat v = vfmanp_vf_vf_vf_vf(vf2gety_vf_vf2(d), t, vfmanp_vf_vf_vf_vf(vf2getx_vf_vf2(d), t, vcast_vf_f(1)));
+  return vf2setxy_vf2_vf_vf(s, vfma_vf_vf_vf_vf(s, v, vfma_vf_vf_vf_vf(vf2gety_vf_vf2(n), t, u)));
+}
+
+static SLEEF_ALWAYS_INLINE SLEEF_CONST vfloat2 dfmul_vf2_vf_vf(vfloat x, vfloat y) {
+  vfloat s = vmul_vf_vf_vf(x, y);
+  return vf2setxy_vf2_vf_vf(s, vfmapn_vf_vf_vf_vf(x, y, s));
+}
+
+static SLEEF_ALWAYS_INLINE SLEEF_CONST vfloat2 dfsqu_vf2_vf2(vfloat2 x) {
+  vfloat s = vmul_vf_vf_vf(vf2getx_vf_vf2(x), vf2getx_vf_vf2(x));
+  return vf2setxy_vf2_vf_vf(s, vfma_vf_vf_vf_vf(vadd_vf_vf_vf(vf2getx_vf_vf2(x), vf2getx_vf_vf2(x)), vf2gety_vf_vf2(x), vfmapn_vf_vf_vf_vf(vf2getx_vf_vf2(x), vf2getx_vf_vf2(x), s)));
+}
+
+static SLEEF_ALWAYS_INLINE SLEEF_CONST vfloat dfsqu_vf_vf2(vfloat2 x) {
+  return vfma_vf_vf_vf_vf(vf2getx_vf_vf2(x), vf2getx_vf_vf2(x), vadd_vf_vf_vf(vmul_vf_vf_vf(vf2getx_vf_vf2(x), vf2gety_vf_vf2(x)), vmul_vf_vf_vf(vf2getx_vf_vf2(x), vf2gety_vf_vf2(x))));
+}
+
+static SLEEF_ALWAYS_INLINE SLEEF_CONST vfloat2 dfmul_vf2_vf2_vf2(vfloat2 x, vfloat2 y) {
+  vfloat s = vmul_vf_vf_vf(vf2getx_vf_vf2(x), vf2getx_vf_vf2(y));
+  return vf2setxy_vf2_vf_vf(s, vfma_vf_vf_vf_vf(vf2getx_vf_vf2(x), vf2gety_vf_vf2(y), vfma_vf_vf_vf_vf(vf2gety_vf_vf2(x), vf2getx_vf_vf2(y), vfmapn_vf_vf_vf_vf(vf2getx_vf_vf2(x), vf2getx_vf_vf2(y), s))));
+}
+
+static SLEEF_ALWAYS_INLINE SLEEF_CONST vfloat dfmul_vf_vf2_vf2(vfloat2 x, vfloat2 y) {
+  return vfma_vf_vf_vf_vf(vf2getx_vf_vf2(x), vf2getx_vf_vf2(y), vfma_vf_vf_vf_vf(vf2gety_vf_vf2(x), vf2getx_vf_vf2(y), vmul_vf_vf_vf(vf2getx_vf_vf2(x), vf2gety_vf_vf2(y))));
+}
+
+static SLEEF_ALWAYS_INLINE SLEEF_CONST vfloat2 dfmul_vf2_vf2_vf(vfloat2 x, vfloat y) {
+  vfloat s = vmul_vf_vf_vf(vf2getx_vf_vf2(x), y);
+  return vf2setxy_vf2_vf_vf(s, vfma_vf_vf_vf_vf(vf2gety_vf_vf2(x), y, vfmapn_vf_vf_vf_vf(vf2getx_vf_vf2(x), y, s)));
+}
+
+static SLEEF_ALWAYS_INLINE SLEEF_CONST vfloat2 dfrec_vf2_vf(vfloat d) {
+  vfloat s = vrec_vf_vf(d);
+  return vf2setxy_vf2_vf_vf(s, vmul_vf_vf_vf(s, vfmanp_vf_vf_vf_vf(d, s, vcast_vf_f(1))));
+}
+
+static SLEEF_ALWAYS_INLINE SLEEF_CONST vfloat2 dfrec_vf2_vf2(vfloat2 d) {
+  vfloat s = vrec_vf_vf(vf2getx_vf_vf2(d));
+  return vf2setxy_vf2_vf_vf(s, vmul_vf_vf_vf(s, vfmanp_vf_vf_vf_vf(vf2gety_vf_vf2(d), s, vfmanp_vf_vf_vf_vf(vf2getx_vf_vf2(d), s, vcast_vf_f(1)))));
+}
+
+static SLEEF_ALWAYS_INLINE SLEEF_CONST vfloat2 dfsqrt_vf2_vf2(vfloat2 d) {
+
+
+
+
+
+  vfloat t = vsqrt_vf_vf(vadd_vf_vf_vf(vf2getx_vf_vf2(d), vf2gety_vf_vf2(d)));
+  return dfscale_vf2_vf2_vf(dfmul_vf2_vf2_vf2(dfadd2_vf2_vf2_vf2(d, dfmul_vf2_vf_vf(t, t)), dfrec_vf2_vf(t)), vcast_vf_f(0.5));
+
+}
+
+static SLEEF_ALWAYS_INLINE SLEEF_CONST vfloat2 dfsqrt_vf2_vf(vfloat d) {
+  vfloat t = vsqrt_vf_vf(d);
+  return dfscale_vf2_vf2_vf(dfmul_vf2_vf2_vf2(dfadd2_vf2_vf_vf2(d, dfmul_vf2_vf_vf(t, t)), dfrec_vf2_vf(t)), vcast_vf_f(0.5f));
+}
+
+
+static SLEEF_ALWAYS_INLINE SLEEF_CONST vopmask visnegzero_vo_vf(vfloat d) {
+  return veq_vo_vi2_vi2(vreinterpret_vi2_vf(d), vreinterpret_vi2_vf(vcast_vf_f(-0.0)));
+}
+
+static SLEEF_ALWAYS_INLINE vopmask vnot_vo32_vo32(vopmask x) {
+  return vxor_vo_vo_vo(x, veq_vo_vi2_vi2(vcast_vi2_i(0), vcast_vi2_i(0)));
+}
+
+static SLEEF_ALWAYS_INLINE SLEEF_CONST vmask vsignbit_vm_vf(vfloat f) {
+  return vand_vm_vm_vm(vreinterpret_vm_vf(f), vreinterpret_vm_vf(vcast_vf_f(-0.0f)));
+}
+
+static SLEEF_ALWAYS_INLINE SLEEF_CONST vfloat vmulsign_vf_vf_vf(vfloat x, vfloat y) {
+  return vreinterpret_vf_vm(vxor_vm_vm_vm(vreinterpret_vm_vf(x), vsignbit_vm_vf(y)));
+}
+
+static SLEEF_ALWAYS_INLINE SLEEF_CONST vfloat vcopysign_vf_vf_vf(vfloat x, vfloat y) {
+  return vreinterpret_vf_vm(vxor_vm_vm_vm(vandnot_vm_vm_vm(vreinterpret_vm_vf(vcast_vf_f(-0.0f)), vreinterpret_vm_vf(x)),
+       vand_vm_vm_vm (vreinterpret_vm_vf(vcast_vf_f(-0.0f)), vreinterpret_vm_vf(y))));
+}
+
+static SLEEF_ALWAYS_INLINE SLEEF_CONST vfloat vsign_vf_vf(vfloat f) {
+  return vreinterpret_vf_vm(vor_vm_vm_vm(vreinterpret_vm_vf(vcast_vf_f(1.0f)), vand_vm_vm_vm(vreinterpret_vm_vf(vcast_vf_f(-0.0f)), vreinterpret_vm_vf(f))));
+}
+
+static SLEEF_ALWAYS_INLINE SLEEF_CONST vopmask vsignbit_vo_vf(vfloat d) {
+  return veq_vo_vi2_vi2(vand_vi2_vi2_vi2(vreinterpret_vi2_vf(d), vcast_vi2_i(0x80000000)), vcast_vi2_i(0x80000000));
+}
+
+static SLEEF_ALWAYS_INLINE SLEEF_CONST vint2 vsel_vi2_vf_vf_vi2_vi2(vfloat f0, vfloat f1, vint2 x, vint2 y) {
+  return vsel_vi2_vo_vi2_vi2(vlt_vo_vf_vf(f0, f1), x, y);
+}
+
+static SLEEF_ALWAYS_INLINE SLEEF_CONST vint2 vsel_vi2_vf_vi2(vfloat d, vint2 x) {
+  return vand_vi2_vo_vi2(vsignbit_vo_vf(d), x);
+}
+
+static SLEEF_ALWAYS_INLINE SLEEF_CONST vopmask visint_vo_vf(vfloat y) { return veq_vo_vf_vf(vtruncate_vf_vf(y), y); }
+
+static SLEEF_ALWAYS_INLINE SLEEF_CONST vopmask visnumber_vo_vf(vfloat x) { return vnot_vo32_vo32(vor_vo_vo_vo(visinf_vo_vf(x), visnan_vo_vf(x))); }
+
+
+static SLEEF_ALWAYS_INLINE SLEEF_CONST vint2 vilogbk_vi2_vf(vfloat d) {
+  vopmask o = vlt_vo_vf_vf(d, vcast_vf_f(5.421010862427522E-20f));
+  d = vsel_vf_vo_vf_vf(o, vmul_vf_vf_vf(vcast_vf_f(1.8446744073709552E19f), d), d);
+  vint2 q = vand_vi2_vi2_vi2(vsrl_vi2_vi2_i(vreinterpret_vi2_vf(d), 23), vcast_vi2_i(0xff));
+  q = vsub_vi2_vi2_vi2(q, vsel_vi2_vo_vi2_vi2(o, vcast_vi2_i(64 + 0x7f), vcast_vi2_i(0x7f)));
+  return q;
+}
+
+static SLEEF_ALWAYS_INLINE SLEEF_CONST vint2 vilogb2k_vi2_vf(vfloat d) {
+  vint2 q = vreinterpret_vi2_vf(d);
+  q = vsrl_vi2_vi2_i(q, 23);
+  q = vand_vi2_vi2_vi2(q, vcast_vi2_i(0xff));
+  q = vsub_vi2_vi2_vi2(q, vcast_vi2_i(0x7f));
+  return q;
+}
+
+
+//
+
+SLEEF_INLINE SLEEF_CONST vint2 Sleef_ilogbf4_avx2128(vfloat d) {
+  vint2 e = vilogbk_vi2_vf(vabs_vf_vf(d));
+  e = vsel_vi2_vo_vi2_vi2(veq_vo_vf_vf(d, vcast_vf_f(0.0f)), vcast_vi2_i(SLEEF_FP_ILOGB0), e);
+  e = vsel_vi2_vo_vi2_vi2(visnan_vo_vf(d), vcast_vi2_i(SLEEF_FP_ILOGBNAN), e);
+  e = vsel_vi2_vo_vi2_vi2(visinf_vo_vf(d), vcast_vi2_i(2147483647), e);
+  return e;
+}
+
+static SLEEF_ALWAYS_INLINE SLEEF_CONST vfloat vpow2i_vf_vi2(vint2 q) {
+  return vreinterpret_vf_vi2(vsll_vi2_vi2_i(vadd_vi2_vi2_vi2(q, vcast_vi2_i(0x7f)), 23));
+}
+
+static SLEEF_ALWAYS_INLINE SLEEF_CONST vfloat vldexp_vf_vf_vi2(vfloat x, vint2 q) {
+  vfloat u;
+  vint2 m = vsra_vi2_vi2_i(q, 31);
+  m = vsll_vi2_vi2_i(vsub_vi2_vi2_vi2(vsra_vi2_vi2_i(vadd_vi2_vi2_vi2(m, q), 6), m), 4);
+  q = vsub_vi2_vi2_vi2(q, vsll_vi2_vi2_i(m, 2));
+  m = vadd_vi2_vi2_vi2(m, vcast_vi2_i(0x7f));
+  m = vand_vi2_vi2_vi2(vgt_vi2_vi2_vi2(m, vcast_vi2_i(0)), m);
+  vint2 n = vgt_vi2_vi2_vi2(m, vcast_vi2_i(0xff));
+  m = vor_vi2_vi2_vi2(vandnot_vi2_vi2_vi2(n, m), vand_vi2_vi2_vi2(n, vcast_vi2_i(0xff)));
+  u = vreinterpret_vf_vi2(vsll_vi2_vi2_i(m, 23));
+  x = vmul_vf_vf_vf(vmul_vf_vf_vf(vmul_vf_vf_vf(vmul_vf_vf_vf(x, u), u), u), u);
+  u = vreinterpret_vf_vi2(vsll_vi2_vi2_i(vadd_vi2_vi2_vi2(q, vcast_vi2_i(0x7f)), 23));
+  return vmul_vf_vf_vf(x, u);
+}
+
+static SLEEF_ALWAYS_INLINE SLEEF_CONST vfloat vldexp2_vf_vf_vi2(vfloat d, vint2 e) {
+  return vmul_vf_vf_vf(vmul_vf_vf_vf(d, vpow2i_vf_vi2(vsra_vi2_vi2_i(e, 1))), vpow2i_vf_vi2(vsub_vi2_vi2_vi2(e, vsra_vi2_vi2_i(e, 1))));
+}
+
+static SLEEF_ALWAYS_INLINE SLEEF_CONST vfloat vldexp3_vf_vf_vi2(vfloat d, vint2 q) {
+  return vreinterpret_vf_vi2(vadd_vi2_vi2_vi2(vreinterpret_vi2_vf(d), vsll_vi2_vi2_i(q, 23)));
+}
+
+SLEEF_INLINE SLEEF_CONST vfloat Sleef_ldexpf4_avx2128(vfloat x, vint2 q) { return vldexp_vf_vf_vi2(x, q); }
+
+
+typedef struct {
+  vfloat d;
+  vint2 i;
+} fi_t;
+
+static vfloat figetd_vf_di(fi_t d) { return d.d; }
+static vint2 figeti_vi2_di(fi_t d) { return d.i; }
+static fi_t fisetdi_fi_vf_vi2(vfloat d, vint2 i) {
+  fi_t r = { d, i };
+  return r;
+}
+
+typedef struct {
+  vfloat2 df;
+  vint2 i;
+} dfi_t;
+
+static vfloat2 dfigetdf_vf2_dfi(dfi_t d) { return d.df; }
+static vint2 dfigeti_vi2_dfi(dfi_t d) { return d.i; }
+static dfi_t dfisetdfi_dfi_vf2_vi2(vfloat2 v, vint2 i) {
+  dfi_t r = { v, i };
+  return r;
+}
+static dfi_t dfisetdf_dfi_dfi_vf2(dfi_t dfi, vfloat2 v) {
+  dfi.df = v;
+  return dfi;
+}
+
+
+static SLEEF_ALWAYS_INLINE SLEEF_CONST vfloat vorsign_vf_vf_vf(vfloat x, vfloat y) {
+  return vreinterpret_vf_vm(vor_vm_vm_vm(vreinterpret_vm_vf(x), vsignbit_vm_vf(y)));
+}
+
+static SLEEF_ALWAYS_INLINE SLEEF_CONST fi_t rempisubf(vfloat x) {
+
+  vfloat y = vrint_vf_vf(vmul_vf_vf_vf(x, vcast_vf_f(4)));
+  vint2 vi = vtruncate_vi2_vf(vsub_vf_vf_vf(y, vmul_vf_vf_vf(vrint_vf_vf(x), vcast_vf_f(4))));
+  return fisetdi_fi_vf_vi2(vsub_vf_vf_vf(x, vmul_vf_vf_vf(y, vcast_vf_f(0.25))), vi);
+
+}
+
+static SLEEF_ALWAYS_INLINE SLEEF_CONST dfi_t rempif(vfloat a) {
+  vfloat2 x, y;
+  vint2 ex = vilogb2k_vi2_vf(a);
+
+
+
+
+  ex = vsub_vi2_vi2_vi2(ex, vcast_vi2_i(25));
+  vint2 q = vand_vi2_vo_vi2(vgt_vo_vi2_vi2(ex, vcast_vi2_i(90-25)), vcast_vi2_i(-64));
+  a = vldexp3_vf_vf_vi2(a, q);
+  ex = vandnot_vi2_vi2_vi2(vsra_vi2_vi2_i(ex, 31), ex);
+  ex = vsll_vi2_vi2_i(ex, 2);
+  x = dfmul_vf2_vf_vf(a, vgather_vf_p_vi2(Sleef_rempitabsp, ex));
+  fi_t di = rempisubf(vf2getx_vf_vf2(x));
+  q = figeti_vi2_di(di);
+  x = vf2setx_vf2_vf2_vf(x, figetd_vf_di(di));
+  x = dfnormalize_vf2_vf2(x);
+  y = dfmul_vf2_vf_vf(a, vgather_vf_p_vi2(Sleef_rempitabsp+1, ex));
+  x = dfadd2_vf2_vf2_vf2(x, y);
+  di = rempisubf(vf2getx_vf_vf2(x));
+  q = vadd_vi2_vi2_vi2(q, figeti_vi2_di(di));
+  x = vf2setx_vf2_vf2_vf(x, figetd_vf_di(di));
+  x = dfnormalize_vf2_vf2(x);
+  y = vcast_vf2_vf_vf(vgather_vf_p_vi2(Sleef_rempitabsp+2, ex), vgather_vf_p_vi2(Sleef_rempitabsp+3, ex));
+  y = dfmul_vf2_vf2_vf(y, a);
+  x = dfadd2_vf2_vf2_vf2(x, y);
+  x = dfnormalize_vf2_vf2(x);
+  x = dfmul_vf2_vf2_vf2(x, vcast_vf2_f_f(3.1415927410125732422f*2, -8.7422776573475857731e-08f*2));
+  x = vsel_vf2_vo_vf2_vf2(vlt_vo_vf_vf(vabs_vf_vf(a), vcast_vf_f(0.7f)), vcast_vf2_vf_vf(a, vcast_vf_f(0)), x);
+  return dfisetdfi_dfi_vf2_vi2(x, q);
+}
+
+SLEEF_INLINE SLEEF_CONST vfloat Sleef_sinf4_u35avx2128(vfloat d) {
+
+  vint2 q;
+  vfloat u, s, r = d;
+
+  if (__builtin_expect(!!(vtestallones_i_vo32(vlt_vo_vf_vf(vabs_vf_vf(d), vcast_vf_f(125.0f)))), 1)) {
+    q = vrint_vi2_vf(vmul_vf_vf_vf(d, vcast_vf_f((float)0.318309886183790671537767526745028724)));
+    u = vcast_vf_vi2(q);
+    d = vmla_vf_vf_vf_vf(u, vcast_vf_f(-3.1414794921875f), d);
+    d = vmla_vf_vf_vf_vf(u, vcast_vf_f(-0.00011315941810607910156f), d);
+    d = vmla_vf_vf_vf_vf(u, vcast_vf_f(-1.9841872589410058936e-09f), d);
+  } else if (__builtin_expect(!!(vtestallones_i_vo32(vlt_vo_vf_vf(vabs_vf_vf(d), vcast_vf_f(39000)))), 1)) {
+    q = vrint_vi2_vf(vmul_vf_vf_vf(d, vcast_vf_f((float)0.318309886183790671537767526745028724)));
+    u = vcast_vf_vi2(q);
+    d = vmla_vf_vf_vf_vf(u, vcast_vf_f(-3.140625f), d);
+    d = vmla_vf_vf_vf_vf(u, vcast_vf_f(-0.0009670257568359375f), d);
+    d = vmla_vf_vf_vf_vf(u, vcast_vf_f(-6.2771141529083251953e-07f), d);
+    d = vmla_vf_vf_vf_vf(u, vcast_vf_f(-1.2154201256553420762e-10f), d);
+  } else {
+    dfi_t dfi = rempif(d);
+    q = vand_vi2_vi2_vi2(dfigeti_vi2_dfi(dfi), vcast_vi2_i(3));
+    q = vadd_vi2_vi2_vi2(vadd_vi2_vi2_vi2(q, q), vsel_vi2_vo_vi2_vi2(vgt_vo_vf_vf(vf2getx_vf_vf2(dfigetdf_vf2_dfi(dfi)), vcast_vf_f(0)), vcast_vi2_i(2), vcast_vi2_i(1)));
+    q = vsra_vi2_vi2_i(q, 2);
+    vopmask o = veq_vo_vi2_vi2(vand_vi2_vi2_vi2(dfigeti_vi2_dfi(dfi), vcast_vi2_i(1)), vcast_vi2_i(1));
+    vfloat2 x = vcast_vf2_vf_vf(vmulsign_vf_vf_vf(vcast_vf_f(3.1415927410125732422f*-0.5), vf2getx_vf_vf2(dfigetdf_vf2_dfi(dfi))),
+    vmulsign_vf_vf_vf(vcast_vf_f(-8.7422776573475857731e-08f*-0.5), vf2getx_vf_vf2(dfigetdf_vf2_dfi(dfi))));
+    x = dfadd2_vf2_vf2_vf2(dfigetdf_vf2_dfi(dfi), x);
+    dfi = dfisetdf_dfi_dfi_vf2(dfi, vsel_vf2_vo_vf2_vf2(o, x, dfigetdf_vf2_dfi(dfi)));
+    d = vadd_vf_vf_vf(vf2getx_vf_vf2(dfigetdf_vf2_dfi(dfi)), vf2gety_vf_vf2(dfigetdf_vf2_dfi(dfi)));
+
+    d = vreinterpret_vf_vm(vor_vm_vo32_vm(vor_vo_vo_vo(visinf_vo_vf(r), visnan_vo_vf(r)), vreinterpret_vm_vf(d)));
+  }
+
+  s = vmul_vf_vf_vf(d, d);
+
+  d = vreinterpret_vf_vm(vxor_vm_vm_vm(vand_vm_vo32_vm(veq_vo_vi2_vi2(vand_vi2_vi2_vi2(q, vcast_vi2_i(1)), vcast_vi2_i(1)), vreinterpret_vm_vf(vcast_vf_f(-0.0f))), vreinterpret_vm_vf(d)));
+
+  u = vcast_vf_f(2.6083159809786593541503e-06f);
+  u = vmla_vf_vf_vf_vf(u, s, vcast_vf_f(-0.0001981069071916863322258f));
+  u = vmla_vf_vf_vf_vf(u, s, vcast_vf_f(0.00833307858556509017944336f));
+  u = vmla_vf_vf_vf_vf(u, s, vcast_vf_f(-0.166666597127914428710938f));
+
+  u = vadd_vf_vf_vf(vmul_vf_vf_vf(s, vmul_vf_vf_vf(u, d)), d);
+
+  u = vsel_vf_vo_vf_vf(visnegzero_vo_vf(r), r, u);
+
+  return u;
+
+}
+
+SLEEF_INLINE SLEEF_CONST vfloat Sleef_cosf4_u35avx2128(vfloat d) {
+
+  vint2 q;
+  vfloat u, s, r = d;
+
+  if (__builtin_expect(!!(vtestallones_i_vo32(vlt_vo_vf_vf(vabs_vf_vf(d), vcast_vf_f(125.0f)))), 1)) {
+    q = vrint_vi2_vf(vsub_vf_vf_vf(vmul_vf_vf_vf(d, vcast_vf_f((float)0.318309886183790671537767526745028724)), vcast_vf_f(0.5f)));
+    q = vadd_vi2_vi2_vi2(vadd_vi2_vi2_vi2(q, q), vcast_vi2_i(1));
+
+    u = vcast_vf_vi2(q);
+    d = vmla_vf_vf_vf_vf(u, vcast_vf_f(-3.1414794921875f*0.5f), d);
+    d = vmla_vf_vf_vf_vf(u, vcast_vf_f(-0.00011315941810607910156f*0.5f), d);
+    d = vmla_vf_vf_vf_vf(u, vcast_vf_f(-1.9841872589410058936e-09f*0.5f), d);
+  } else if (__builtin_expect(!!(vtestallones_i_vo32(vlt_vo_vf_vf(vabs_vf_vf(d), vcast_vf_f(39000)))), 1)) {
+    q = vrint_vi2_vf(vsub_vf_vf_vf(vmul_vf_vf_vf(d, vcast_vf_f((float)0.318309886183790671537767526745028724)), vcast_vf_f(0.5f)));
+    q = vadd_vi2_vi2_vi2(vadd_vi2_vi2_vi2(q, q), vcast_vi2_i(1));
+
+    u = vcast_vf_vi2(q);
+    d = vmla_vf_vf_vf_vf(u, vcast_vf_f(-3.140625f*0.5f), d);
+    d = vmla_vf_vf_vf_vf(u, vcast_vf_f(-0.0009670257568359375f*0.5f), d);
+    d = vmla_vf_vf_vf_vf(u, vcast_vf_f(-6.2771141529083251953e-07f*0.5f), d);
+    d = vmla_vf_vf_vf_vf(u, vcast_vf_f(-1.2154201256553420762e-10f*0.5f), d);
+  } else {
+    dfi_t dfi = rempif(d);
+    q = vand_vi2_vi2_vi2(dfigeti_vi2_dfi(dfi), vcast_vi2_i(3));
+    q = vadd_vi2_vi2_vi2(vadd_vi2_vi2_vi2(q, q), vsel_vi2_vo_vi2_vi2(vgt_vo_vf_vf(vf2getx_vf_vf2(dfigetdf_vf2_dfi(dfi)), vcast_vf_f(0)), vcast_vi2_i(8), vcast_vi2_i(7)));
+    q = vsra_vi2_vi2_i(q, 1);
+    vopmask o = veq_vo_vi2_vi2(vand_vi2_vi2_vi2(dfigeti_vi2_dfi(dfi), vcast_vi2_i(1)), vcast_vi2_i(0));
+    vfloat y = vsel_vf_vo_vf_vf(vgt_vo_vf_vf(vf2getx_vf_vf2(dfigetdf_vf2_dfi(dfi)), vcast_vf_f(0)), vcast_vf_f(0), vcast_vf_f(-1));
+    vfloat2 x = vcast_vf2_vf_vf(vmulsign_vf_vf_vf(vcast_vf_f(3.1415927410125732422f*-0.5), y),
+    vmulsign_vf_vf_vf(vcast_vf_f(-8.7422776573475857731e-08f*-0.5), y));
+    x = dfadd2_vf2_vf2_vf2(dfigetdf_vf2_dfi(dfi), x);
+    dfi = dfisetdf_dfi_dfi_vf2(dfi, vsel_vf2_vo_vf2_vf2(o, x, dfigetdf_vf2_dfi(dfi)));
+    d = vadd_vf_vf_vf(vf2getx_vf_vf2(dfigetdf_vf2_dfi(dfi)), vf2gety_vf_vf2(dfigetdf_vf2_dfi(dfi)));
+
+    d = vreinterpret_vf_vm(vor_vm_vo32_vm(vor_vo_vo_vo(visinf_vo_vf(r), visnan_vo_vf(r)), vreinterpret_vm_vf(d)));
+  }
+
+  s = vmul_vf_vf_vf(d, d);
+
+  d = vreinterpret_vf_vm(vxor_vm_vm_vm(vand_vm_vo32_vm(veq_vo_vi2_vi2(vand_vi2_vi2_vi2(q, vcast_vi2_i(2)), vcast_vi2_i(0)), vreinterpret_vm_vf(vcast_vf_f(-0.0f))), vreinterpret_vm_vf(d)));
+
+  u = vcast_vf_f(2.6083159809786593541503e-06f);
+  u = vmla_vf_vf_vf_vf(u, s, vcast_vf_f(-0.0001981069071916863322258f));
+  u = vmla_vf_vf_vf_vf(u, s, vcast_vf_f(0.00833307858556509017944336f));
+  u = vmla_vf_vf_vf_vf(u, s, vcast_vf_f(-0.166666597127914428710938f));
+
+  u = vadd_vf_vf_vf(vmul_vf_vf_vf(s, vmul_vf_vf_vf(u, d)), d);
+
+  return u;
+
+}
+
+SLEEF_INLINE SLEEF_CONST vfloat Sleef_tanf4_u35avx2128(vfloat d) {
+
+  vint2 q;
+  vopmask o;
+  vfloat u, s, x;
+
+  x = d;
+
+  if (__builtin_expect(!!(vtestallones_i_vo32(vlt_vo_vf_vf(vabs_vf_vf(d), vcast_vf_f(125.0f*0.5f)))), 1)) {
+    q = vrint_vi2_vf(vmul_vf_vf_vf(d, vcast_vf_f((float)(2 * 0.318309886183790671537767526745028724))));
+    u = vcast_vf_vi2(q);
+    x = vmla_vf_vf_vf_vf(u, vcast_vf_f(-3.1414794921875f*0.5f), x);
+    x = vmla_vf_vf_vf_vf(u, vcast_vf_f(-0.00011315941810607910156f*0.5f), x);
+    x = vmla_vf_vf_vf_vf(u, vcast_vf_f(-1.9841872589410058936e-09f*0.5f), x);
+  } else if (__builtin_expect(!!(vtestallones_i_vo32(vlt_vo_vf_vf(vabs_vf_vf(d), vcast_vf_f(39000)))), 1)) {
+    q = vrint_vi2_vf(vmul_vf_vf_vf(d, vcast_vf_f((float)(2 * 0.318309886183790671537767526745028724))));
+    u = vcast_vf_vi2(q);
+    x = vmla_vf_vf_vf_vf(u, vcast_vf_f(-3.140625f*0.5f), x);
+    x = vmla_vf_vf_vf_vf(u, vcast_vf_f(-0.0009670257568359375f*0.5f), x);
+    x = vmla_vf_vf_vf_vf(u, vcast_vf_f(-6.2771141529083251953e-07f*0.5f), x);
+    x = vmla_vf_vf_vf_vf(u, vcast_vf_f(-1.2154201256553420762e-10f*0.5f), x);
+  } else {
+    dfi_t dfi = rempif(d);
+    q = dfigeti_vi2_dfi(dfi);
+    x = vadd_vf_vf_vf(vf2getx_vf_vf2(dfigetdf_vf2_dfi(dfi)), vf2gety_vf_vf2(dfigetdf_vf2_dfi(dfi)));
+    x = vreinterpret_vf_vm(vor_vm_vo32_vm(vor_vo_vo_vo(visinf_vo_vf(d), visnan_vo_vf(d)), vreinterpret_vm_vf(x)));
+    x = vsel_vf_vo_vf_vf(visnegzero_vo_vf(d), d, x);
+  }
+
+  s = vmul_vf_vf_vf(x, x);
+
+  o = veq_vo_vi2_vi2(vand_vi2_vi2_vi2(q, vcast_vi2_i(1)), vcast_vi2_i(1));
+  x = vreinterpret_vf_vm(vxor_vm_vm_vm(vand_vm_vo32_vm(o, vreinterpret_vm_vf(vcast_vf_f(-0.0f))), vreinterpret_vm_vf(x)));
+
+  vfloat s2 = vmul_vf_vf_vf(s, s), s4 = vmul_vf_vf_vf(s2, s2);
+  u = vmla_vf_vf_vf_vf((s4), (vmla_vf_vf_vf_vf((s), (vcast_vf_f(0.00927245803177356719970703f)), (vcast_vf_f(0.00331984995864331722259521f)))), (vmla_vf_vf_vf_vf((s2), (vmla_vf_vf_vf_vf((s), (vcast_vf_f(0.0242998078465461730957031f)), (vcast_vf_f(0.0534495301544666290283203f)))), (vmla_vf_vf_vf_vf((s), (vcast_vf_f(0.133383005857467651367188f)), (vcast_vf_f(0.333331853151321411132812f)))))))
+
+
+
+
+
+                                 ;
+
+
+  u = vmla_vf_vf_vf_vf(s, vmul_vf_vf_vf(u, x), x);
+
+  u = vsel_vf_vo_vf_vf(o, vrec_vf_vf(u), u);
+
+  return u;
+
+}
+
+SLEEF_INLINE SLEEF_CONST vfloat Sleef_sinf4_u10avx2128(vfloat d) {
+
+  vint2 q;
+  vfloat u, v;
+  vfloat2 s, t, x;
+
+  if (__builtin_expect(!!(vtestallones_i_vo32(vlt_vo_vf_vf(vabs_vf_vf(d), vcast_vf_f(125.0f)))), 1)) {
+    u = vrint_vf_vf(vmul_vf_vf_vf(d, vcast_vf_f(0.318309886183790671537767526745028724)));
+    q = vrint_vi2_vf(u);
+    v = vmla_vf_vf_vf_vf(u, vcast_vf_f(-3.1414794921875f), d);
+    s = dfadd2_vf2_vf_vf(v, vmul_vf_vf_vf(u, vcast_vf_f(-0.00011315941810607910156f)));
+    s = dfadd_vf2_vf2_vf(s, vmul_vf_vf_vf(u, vcast_vf_f(-1.9841872589410058936e-09f)));
+  } else {
+    dfi_t dfi = rempif(d);
+    q = vand_vi2_vi2_vi2(dfigeti_vi2_dfi(dfi), vcast_vi2_i(3));
+    q = vadd_vi2_vi2_vi2(vadd_vi2_vi2_vi2(q, q), vsel_vi2_vo_vi2_vi2(vgt_vo_vf_vf(vf2getx_vf_vf2(dfigetdf_vf2_dfi(dfi)), vcast_vf_f(0)), vcast_vi2_i(2), vcast_vi2_i(1)));
+    q = vsra_vi2_vi2_i(q, 2);
+    vopmask o = veq_vo_vi2_vi2(vand_vi2_vi2_vi2(dfigeti_vi2_dfi(dfi), vcast_vi2_i(1)), vcast_vi2_i(1));
+    vfloat2 x = vcast_vf2_vf_vf(vmulsign_vf_vf_vf(vcast_vf_f(3.1415927410125732422f*-0.5), vf2getx_vf_vf2(dfigetdf_vf2_dfi(dfi))),
+    vmulsign_vf_vf_vf(vcast_vf_f(-8.7422776573475857731e-08f*-0.5), vf2getx_vf_vf2(dfigetdf_vf2_dfi(dfi))));
+    x = dfadd2_vf2_vf2_vf2(dfigetdf_vf2_dfi(dfi), x);
+    dfi = dfisetdf_dfi_dfi_vf2(dfi, vsel_vf2_vo_vf2_vf2(o, x, dfigetdf_vf2_dfi(dfi)));
+    s = dfnormalize_vf2_vf2(dfigetdf_vf2_dfi(dfi));
+
+
+    s = vf2setx_vf2_vf2_vf(s, vreinterpret_vf_vm(vor_vm_vo32_vm(vor_vo_vo_vo(visinf_vo_vf(d), visnan_vo_vf(d)), vreinterpret_vm_vf(vf2getx_vf_vf2(s)))));
+
+
+
+  }
+
+  t = s;
+  s = dfsqu_vf2_vf2(s);
+
+  u = vcast_vf_f(2.6083159809786593541503e-06f);
+  u = vmla_vf_vf_vf_vf(u, vf2getx_vf_vf2(s), vcast_vf_f(-0.0001981069071916863322258f));
+  u = vmla_vf_vf_vf_vf(u, vf2getx_vf_vf2(s), vcast_vf_f(0.00833307858556509017944336f));
+
+  x = dfadd_vf2_vf_vf2(vcast_vf_f(1), dfmul_vf2_vf2_vf2(dfadd_vf2_vf_vf(vcast_vf_f(-0.166666597127914428710938f), vmul_vf_vf_vf(u, vf2getx_vf_vf2(s))), s));
+
+  u = dfmul_vf_vf2_vf2(t, x);
+
+  u = vreinterpret_vf_vm(vxor_vm_vm_vm(vand_vm_vo32_vm(veq_vo_vi2_vi2(vand_vi2_vi2_vi2(q, vcast_vi2_i(1)), vcast_vi2_i(1)), vreinterpret_vm_vf(vcast_vf_f(-0.0))), vreinterpret_vm_vf(u)));
+
+  u = vsel_vf_vo_vf_vf(visnegzero_vo_vf(d), d, u);
+
+  return u;
+
+}
+
+SLEEF_INLINE SLEEF_CONST vfloat Sleef_cosf4_u10avx2128(vfloat d) {
+
+  vint2 q;
+  vfloat u;
+  vfloat2 s, t, x;
+
+  if (__builtin_expect(!!(vtestallones_i_vo32(vlt_vo_vf_vf(vabs_vf_vf(d), vcast_vf_f(125.0f)))), 1)) {
+    vfloat dq = vmla_vf_vf_vf_vf(vrint_vf_vf(vmla_vf_vf_vf_vf(d, vcast_vf_f(0.318309886183790671537767526745028724), vcast_vf_f(-0.5f))),
+     vcast_vf_f(2), vcast_vf_f(1));
+    q = vrint_vi2_vf(dq);
+    s = dfadd2_vf2_vf_vf (d, vmul_vf_vf_vf(dq, vcast_vf_f(-3.1414794921875f*0.5f)));
+    s = dfadd2_vf2_vf2_vf(s, vmul_vf_vf_vf(dq, vcast_vf_f(-0.00011315941810607910156f*0.5f)));
+    s = dfadd2_vf2_vf2_vf(s, vmul_vf_vf_vf(dq, vcast_vf_f(-1.9841872589410058936e-09f*0.5f)));
+  } else {
+    dfi_t dfi = rempif(d);
+    q = vand_vi2_vi2_vi2(dfigeti_vi2_dfi(dfi), vcast_vi2_i(3));
+    q = vadd_vi2_vi2_vi2(vadd_vi2_vi2_vi2(q, q), vsel_vi2_vo_vi2_vi2(vgt_vo_vf_vf(vf2getx_vf_vf2(dfigetdf_vf2_dfi(dfi)), vcast_vf_f(0)), vcast_vi2_i(8), vcast_vi2_i(7)));
+    q = vsra_vi2_vi2_i(q, 1);
+    vopmask o = veq_vo_vi2_vi2(vand_vi2_vi2_vi2(dfigeti_vi2_dfi(dfi), vcast_vi2_i(1)), vcast_vi2_i(0));
+    vfloat y = vsel_vf_vo_vf_vf(vgt_vo_vf_vf(vf2getx_vf_vf2(dfigetdf_vf2_dfi(dfi)), vcast_vf_f(0)), vcast_vf_f(0), vcast_vf_f(-1));
+    vfloat2 x = vcast_vf2_vf_vf(vmulsign_vf_vf_vf(vcast_vf_f(3.1415927410125732422f*-0.5), y),
+    vmulsign_vf_vf_vf(vcast_vf_f(-8.7422776573475857731e-08f*-0.5), y));
+    x = dfadd2_vf2_vf2_vf2(dfigetdf_vf2_dfi(dfi), x);
+    dfi = dfisetdf_dfi_dfi_vf2(dfi, vsel_vf2_vo_vf2_vf2(o, x, dfigetdf_vf2_dfi(dfi)));
+    s = dfnormalize_vf2_vf2(dfigetdf_vf2_dfi(dfi));
+
+
+    s = vf2setx_vf2_vf2_vf(s, vreinterpret_vf_vm(vor_vm_vo32_vm(vor_vo_vo_vo(visinf_vo_vf(d), visnan_vo_vf(d)), vreinterpret_vm_vf(vf2getx_vf_vf2(s)))));
+
+
+
+  }
+
+  t = s;
+  s = dfsqu_vf2_vf2(s);
+
+  u = vcast_vf_f(2.6083159809786593541503e-06f);
+  u = vmla_vf_vf_vf_vf(u, vf2getx_vf_vf2(s), vcast_vf_f(-0.0001981069071916863322258f));
+  u = vmla_vf_vf_vf_vf(u, vf2getx_vf_vf2(s), vcast_vf_f(0.00833307858556509017944336f));
+
+  x = dfadd_vf2_vf_vf2(vcast_vf_f(1), dfmul_vf2_vf2_vf2(dfadd_vf2_vf_vf(vcast_vf_f(-0.166666597127914428710938f), vmul_vf_vf_vf(u, vf2getx_vf_vf2(s))), s));
+
+  u = dfmul_vf_vf2_vf2(t, x);
+
+  u = vreinterpret_vf_vm(vxor_vm_vm_vm(vand_vm_vo32_vm(veq_vo_vi2_vi2(vand_vi2_vi2_vi2(q, vcast_vi2_i(2)), vcast_vi2_i(0)), vreinterpret_vm_vf(vcast_vf_f(-0.0))), vreinterpret_vm_vf(u)));
+
+  return u;
+
+}
+
+SLEEF_INLINE SLEEF_CONST vfloat Sleef_fastsinf4_u3500avx2128(vfloat d) {
+  vint2 q;
+  vfloat u, s, t = d;
+
+  s = vmul_vf_vf_vf(d, vcast_vf_f((float)0.318309886183790671537767526745028724));
+  u = vrint_vf_vf(s);
+  q = vrint_vi2_vf(s);
+  d = vmla_vf_vf_vf_vf(u, vcast_vf_f(-(float)3.141592653589793238462643383279502884), d);
+
+  s = vmul_vf_vf_vf(d, d);
+
+  u = vcast_vf_f(-0.1881748176e-3);
+  u = vmla_vf_vf_vf_vf(u, s, vcast_vf_f(+0.8323502727e-2));
+  u = vmla_vf_vf_vf_vf(u, s, vcast_vf_f(-0.1666651368e+0));
+  u = vmla_vf_vf_vf_vf(vmul_vf_vf_vf(s, d), u, d);
+
+  u = vreinterpret_vf_vm(vxor_vm_vm_vm(vand_vm_vo32_vm(veq_vo_vi2_vi2(vand_vi2_vi2_vi2(q, vcast_vi2_i(1)), vcast_vi2_i(1)), vreinterpret_vm_vf(vcast_vf_f(-0.0f))), vreinterpret_vm_vf(u)));
+
+  vopmask g = vlt_vo_vf_vf(vabs_vf_vf(t), vcast_vf_f(30.0f));
+  if (!__builtin_expect(!!(vtestallones_i_vo32(g)), 1)) return vsel_vf_vo_vf_vf(g, u, Sleef_sinf4_u35avx2128(t));
+
+  return u;
+}
+
+SLEEF_INLINE SLEEF_CONST vfloat Sleef_fastcosf4_u3500avx2128(vfloat d) {
+  vint2 q;
+  vfloat u, s, t = d;
+
+  s = vmla_vf_vf_vf_vf(d, vcast_vf_f((float)0.318309886183790671537767526745028724), vcast_vf_f(-0.5f));
+  u = vrint_vf_vf(s);
+  q = vrint_vi2_vf(s);
+  d = vmla_vf_vf_vf_vf(u, vcast_vf_f(-(float)3.141592653589793238462643383279502884), vsub_vf_vf_vf(d, vcast_vf_f((float)3.141592653589793238462643383279502884 * 0.5f)));
+
+  s = vmul_vf_vf_vf(d, d);
+
+  u = vcast_vf_f(-0.1881748176e-3);
+  u = vmla_vf_vf_vf_vf(u, s, vcast_vf_f(+0.8323502727e-2));
+  u = vmla_vf_vf_vf_vf(u, s, vcast_vf_f(-0.1666651368e+0));
+  u = vmla_vf_vf_vf_vf(vmul_vf_vf_vf(s, d), u, d);
+
+  u = vreinterpret_vf_vm(vxor_vm_vm_vm(vand_vm_vo32_vm(veq_vo_vi2_vi2(vand_vi2_vi2_vi2(q, vcast_vi2_i(1)), vcast_vi2_i(0)), vreinterpret_vm_vf(vcast_vf_f(-0.0f))), vreinterpret_vm_vf(u)));
+
+  vopmask g = vlt_vo_vf_vf(vabs_vf_vf(t), vcast_vf_f(30.0f));
+  if (!__builtin_expect(!!(vtestallones_i_vo32(g)), 1)) return vsel_vf_vo_vf_vf(g, u, Sleef_cosf4_u35avx2128(t));
+
+  return u;
+}
+
+SLEEF_INLINE SLEEF_CONST vfloat2 Sleef_sincosf4_u35avx2128(vfloat d) {
+
+  vint2 q;
+  vopmask o;
+  vfloat u, s, t, rx, ry;
+  vfloat2 r;
+
+  s = d;
+
+  if (__builtin_expect(!!(vtestallones_i_vo32(vlt_vo_vf_vf(vabs_vf_vf(d), vcast_vf_f(125.0f)))), 1)) {
+    q = vrint_vi2_vf(vmul_vf_vf_vf(d, vcast_vf_f((float)0.636619772367581343075535053490057448)));
+    u = vcast_vf_vi2(q);
+    s = vmla_vf_vf_vf_vf(u, vcast_vf_f(-3.1414794921875f*0.5f), s);
+    s = vmla_vf_vf_vf_vf(u, vcast_vf_f(-0.00011315941810607910156f*0.5f), s);
+    s = vmla_vf_vf_vf_vf(u, vcast_vf_f(-1.9841872589410058936e-09f*0.5f), s);
+  } else if (__builtin_expect(!!(vtestallones_i_vo32(vlt_vo_vf_vf(vabs_vf_vf(d), vcast_vf_f(39000)))), 1)) {
+    q = vrint_vi2_vf(vmul_vf_vf_vf(d, vcast_vf_f((float)0.636619772367581343075535053490057448)));
+    u = vcast_vf_vi2(q);
+    s = vmla_vf_vf_vf_vf(u, vcast_vf_f(-3.140625f*0.5f), s);
+    s = vmla_vf_vf_vf_vf(u, vcast_vf_f(-0.0009670257568359375f*0.5f), s);
+    s = vmla_vf_vf_vf_vf(u, vcast_vf_f(-6.2771141529083251953e-07f*0.5f), s);
+    s = vmla_vf_vf_vf_vf(u, vcast_vf_f(-1.2154201256553420762e-10f*0.5f), s);
+  } else {
+    dfi_t dfi = rempif(d);
+    q = dfigeti_vi2_dfi(dfi);
+    s = vadd_vf_vf_vf(vf2getx_vf_vf2(dfigetdf_vf2_dfi(dfi)), vf2gety_vf_vf2(dfigetdf_vf2_dfi(dfi)));
+    s = vreinterpret_vf_vm(vor_vm_vo32_vm(vor_vo_vo_vo(visinf_vo_vf(d), visnan_vo_vf(d)), vreinterpret_vm_vf(s)));
+  }
+
+  t = s;
+
+  s = vmul_vf_vf_vf(s, s);
+
+  u = vcast_vf_f(-0.000195169282960705459117889f);
+  u = vmla_vf_vf_vf_vf(u, s, vcast_vf_f(0.00833215750753879547119141f));
+  u = vmla_vf_vf_vf_vf(u, s, vcast_vf_f(-0.166666537523269653320312f));
+
+  rx = vmla_vf_vf_vf_vf(vmul_vf_vf_vf(u, s), t, t);
+  rx = vsel_vf_vo_vf_vf(visnegzero_vo_vf(d), vcast_vf_f(-0.0f), rx);
+
+  u = vcast_vf_f(-2.71811842367242206819355e-07f);
+  u = vmla_vf_vf_vf_vf(u, s, vcast_vf_f(2.47990446951007470488548e-05f));
+  u = vmla_vf_vf_vf_vf(u, s, vcast_vf_f(-0.00138888787478208541870117f));
+  u = vmla_vf_vf_vf_vf(u, s, vcast_vf_f(0.0416666641831398010253906f));
+  u = vmla_vf_vf_vf_vf(u, s, vcast_vf_f(-0.5));
+
+  ry = vmla_vf_vf_vf_vf(s, u, vcast_vf_f(1));
+
+  o = veq_vo_vi2_vi2(vand_vi2_vi2_vi2(q, vcast_vi2_i(1)), vcast_vi2_i(0));
+  r = vf2setxy_vf2_vf_vf(vsel_vf_vo_vf_vf(o, rx, ry), vsel_vf_vo_vf_vf(o, ry, rx));
+
+  o = veq_vo_vi2_vi2(vand_vi2_vi2_vi2(q, vcast_vi2_i(2)), vcast_vi2_i(2));
+  r = vf2setx_vf2_vf2_vf(r, vreinterpret_vf_vm(vxor_vm_vm_vm(vand_vm_vo32_vm(o, vreinterpret_vm_vf(vcast_vf_f(-0.0))), vreinterpret_vm_vf(vf2getx_vf_vf2(r)))));
+
+  o = veq_vo_vi2_vi2(vand_vi2_vi2_vi2(vadd_vi2_vi2_vi2(q, vcast_vi2_i(1)), vcast_vi2_i(2)), vcast_vi2_i(2));
+  r = vf2sety_vf2_vf2_vf(r, vreinterpret_vf_vm(vxor_vm_vm_vm(vand_vm_vo32_vm(o, vreinterpret_vm_vf(vcast_vf_f(-0.0))), vreinterpret_vm_vf(vf2gety_vf_vf2(r)))));
+
+  return r;
+
+}
+
+SLEEF_INLINE SLEEF_CONST vfloat2 Sleef_sincosf4_u10avx2128(vfloat d) {
+
+  vint2 q;
+  vopmask o;
+  vfloat u, v, rx, ry;
+  vfloat2 r, s, t, x;
+
+  if (__builtin_expect(!!(vtestallones_i_vo32(vlt_vo_vf_vf(vabs_vf_vf(d), vcast_vf_f(125.0f)))), 1)) {
+    u = vrint_vf_vf(vmul_vf_vf_vf(d, vcast_vf_f(2 * 0.318309886183790671537767526745028724)));
+    q = vrint_vi2_vf(u);
+    v = vmla_vf_vf_vf_vf(u, vcast_vf_f(-3.1414794921875f*0.5f), d);
+    s = dfadd2_vf2_vf_vf(v, vmul_vf_vf_vf(u, vcast_vf_f(-0.00011315941810607910156f*0.5f)));
+    s = dfadd_vf2_vf2_vf(s, vmul_vf_vf_vf(u, vcast_vf_f(-1.9841872589410058936e-09f*0.5f)));
+  } else {
+    dfi_t dfi = rempif(d);
+    q = dfigeti_vi2_dfi(dfi);
+    s = dfigetdf_vf2_dfi(dfi);
+    o = vor_vo_vo_vo(visinf_vo_vf(d), visnan_vo_vf(d));
+    s = vf2setx_vf2_vf2_vf(s, vreinterpret_vf_vm(vor_vm_vo32_vm(o, vreinterpret_vm_vf(vf2getx_vf_vf2(s)))));
+  }
+
+  t = s;
+
+  s = vf2setx_vf2_vf2_vf(s, dfsqu_vf_vf2(s));
+
+  u = vcast_vf_f(-0.000195169282960705459117889f);
+  u = vmla_vf_vf_vf_vf(u, vf2getx_vf_vf2(s), vcast_vf_f(0.00833215750753879547119141f));
+  u = vmla_vf_vf_vf_vf(u, vf2getx_vf_vf2(s), vcast_vf_f(-0.166666537523269653320312f));
+
+  u = vmul_vf_vf_vf(u, vmul_vf_vf_vf(vf2getx_vf_vf2(s), vf2getx_vf_vf2(t)));
+
+  x = dfadd_vf2_vf2_vf(t, u);
+  rx = vadd_vf_vf_vf(vf2getx_vf_vf2(x), vf2gety_vf_vf2(x));
+
+  rx = vsel_vf_vo_vf_vf(visnegzero_vo_vf(d), vcast_vf_f(-0.0f), rx);
+
+  u = vcast_vf_f(-2.71811842367242206819355e-07f);
+  u = vmla_vf_vf_vf_vf(u, vf2getx_vf_vf2(s), vcast_vf_f(2.47990446951007470488548e-05f));
+  u = vmla_vf_vf_vf_vf(u, vf2getx_vf_vf2(s), vcast_vf_f(-0.00138888787478208541870117f));
+  u = vmla_vf_vf_vf_vf(u, vf2getx_vf_vf2(s), vcast_vf_f(0.0416666641831398010253906f));
+  u = vmla_vf_vf_vf_vf(u, vf2getx_vf_vf2(s), vcast_vf_f(-0.5));
+
+  x = dfadd_vf2_vf_vf2(vcast_vf_f(1), dfmul_vf2_vf_vf(vf2getx_vf_vf2(s), u));
+  ry = vadd_vf_vf_vf(vf2getx_vf_vf2(x), vf2gety_vf_vf2(x));
+
+  o = veq_vo_vi2_vi2(vand_vi2_vi2_vi2(q, vcast_vi2_i(1)), vcast_vi2_i(0));
+  r = vf2setxy_vf2_vf_vf(vsel_vf_vo_vf_vf(o, rx, ry), vsel_vf_vo_vf_vf(o, ry, rx));
+
+  o = veq_vo_vi2_vi2(vand_vi2_vi2_vi2(q, vcast_vi2_i(2)), vcast_vi2_i(2));
+  r = vf2setx_vf2_vf2_vf(r, vreinterpret_vf_vm(vxor_vm_vm_vm(vand_vm_vo32_vm(o, vreinterpret_vm_vf(vcast_vf_f(-0.0))), vreinterpret_vm_vf(vf2getx_vf_vf2(r)))));
+
+  o = veq_vo_vi2_vi2(vand_vi2_vi2_vi2(vadd_vi2_vi2_vi2(q, vcast_vi2_i(1)), vcast_vi2_i(2)), vcast_vi2_i(2));
+  r = vf2sety_vf2_vf2_vf(r, vreinterpret_vf_vm(vxor_vm_vm_vm(vand_vm_vo32_vm(o, vreinterpret_vm_vf(vcast_vf_f(-0.0))), vreinterpret_vm_vf(vf2gety_vf_vf2(r)))));
+
+  return r;
+
+}
+
+
+SLEEF_INLINE SLEEF_CONST vfloat2 Sleef_sincospif4_u05avx2128(vfloat d) {
+  vopmask o;
+  vfloat u, s, t, rx, ry;
+  vfloat2 r, x, s2;
+
+  u = vmul_vf_vf_vf(d, vcast_vf_f(4));
+  vint2 q = vtruncate_vi2_vf(u);
+  q = vand_vi2_vi2_vi2(vadd_vi2_vi2_vi2(q, vxor_vi2_vi2_vi2(vsrl_vi2_vi2_i(q, 31), vcast_vi2_i(1))), vcast_vi2_i(~1));
+  s = vsub_vf_vf_vf(u, vcast_vf_vi2(q));
+
+  t = s;
+  s = vmul_vf_vf_vf(s, s);
+  s2 = dfmul_vf2_vf_vf(t, t);
+
+  //
+
+  u = vcast_vf_f(+0.3093842054e-6);
+  u = vmla_vf_vf_vf_vf(u, s, vcast_vf_f(-0.3657307388e-4));
+  u = vmla_vf_vf_vf_vf(u, s, vcast_vf_f(+0.2490393585e-2));
+  x = dfadd2_vf2_vf_vf2(vmul_vf_vf_vf(u, s), vcast_vf2_f_f(-0.080745510756969451904, -1.3373665339076936258e-09));
+  x = dfadd2_vf2_vf2_vf2(dfmul_vf2_vf2_vf2(s2, x), vcast_vf2_f_f(0.78539818525314331055, -2.1857338617566484855e-08));
+
+  x = dfmul_vf2_vf2_vf(x, t);
+  rx = vadd_vf_vf_vf(vf2getx_vf_vf2(x), vf2gety_vf_vf2(x));
+
+  rx = vsel_vf_vo_vf_vf(visnegzero_vo_vf(d), vcast_vf_f(-0.0f), rx);
+
+  //
+
+  u = vcast_vf_f(-0.2430611801e-7);
+  u = vmla_vf_vf_vf_vf(u, s, vcast_vf_f(+0.3590577080e-5));
+  u = vmla_vf_vf_vf_vf(u, s, vcast_vf_f(-0.3259917721e-3));
+  x = dfadd2_vf2_vf_vf2(vmul_vf_vf_vf(u, s), vcast_vf2_f_f(0.015854343771934509277, 4.4940051354032242811e-10));
+  x = dfadd2_vf2_vf2_vf2(dfmul_vf2_vf2_vf2(s2, x), vcast_vf2_f_f(-0.30842512845993041992, -9.0728339030733922277e-09));
+
+  x = dfadd2_vf2_vf2_vf(dfmul_vf2_vf2_vf2(x, s2), vcast_vf_f(1));
+  ry = vadd_vf_vf_vf(vf2getx_vf_vf2(x), vf2gety_vf_vf2(x));
+
+  //
+
+  o = veq_vo_vi2_vi2(vand_vi2_vi2_vi2(q, vcast_vi2_i(2)), vcast_vi2_i(0));
+  r = vf2setxy_vf2_vf_vf(vsel_vf_vo_vf_vf(o, rx, ry), vsel_vf_vo_vf_vf(o, ry, rx));
+
+  o = veq_vo_vi2_vi2(vand_vi2_vi2_vi2(q, vcast_vi2_i(4)), vcast_vi2_i(4));
+  r = vf2setx_vf2_vf2_vf(r, vreinterpret_vf_vm(vxor_vm_vm_vm(vand_vm_vo32_vm(o, vreinterpret_vm_vf(vcast_vf_f(-0.0))), vreinterpret_vm_vf(vf2getx_vf_vf2(r)))));
+
+  o = veq_vo_vi2_vi2(vand_vi2_vi2_vi2(vadd_vi2_vi2_vi2(q, vcast_vi2_i(2)), vcast_vi2_i(4)), vcast_vi2_i(4));
+  r = vf2sety_vf2_vf2_vf(r, vreinterpret_vf_vm(vxor_vm_vm_vm(vand_vm_vo32_vm(o, vreinterpret_vm_vf(vcast_vf_f(-0.0))), vreinterpret_vm_vf(vf2gety_vf_vf2(r)))));
+
+  o = vgt_vo_vf_vf(vabs_vf_vf(d), vcast_vf_f(1e+7f));
+  r = vf2setx_vf2_vf2_vf(r, vreinterpret_vf_vm(vandnot_vm_vo32_vm(o, vreinterpret_vm_vf(vf2getx_vf_vf2(r)))));
+  r = vf2sety_vf2_vf2_vf(r, vreinterpret_vf_vm(vandnot_vm_vo32_vm(o, vreinterpret_vm_vf(vf2gety_vf_vf2(r)))));
+
+  o = visinf_vo_vf(d);
+  r = vf2setx_vf2_vf2_vf(r, vreinterpret_vf_vm(vor_vm_vo32_vm(o, vreinterpret_vm_vf(vf2getx_vf_vf2(r)))));
+  r = vf2sety_vf2_vf2_vf(r, vreinterpret_vf_vm(vor_vm_vo32_vm(o, vreinterpret_vm_vf(vf2gety_vf_vf2(r)))));
+
+  return r;
+}
+
+SLEEF_INLINE SLEEF_CONST vfloat2 Sleef_sincospif4_u35avx2128(vfloat d) {
+  vopmask o;
+  vfloat u, s, t, rx, ry;
+  vfloat2 r;
+
+  u = vmul_vf_vf_vf(d, vcast_vf_f(4));
+  vint2 q = vtruncate_vi2_vf(u);
+  q = vand_vi2_vi2_vi2(vadd_vi2_vi2_vi2(q, vxor_vi2_vi2_vi2(vsrl_vi2_vi2_i(q, 31), vcast_vi2_i(1))), vcast_vi2_i(~1));
+  s = vsub_vf_vf_vf(u, vcast_vf_vi2(q));
+
+  t = s;
+  s = vmul_vf_vf_vf(s, s);
+
+  //
+
+  u = vcast_vf_f(-0.3600925265e-4);
+  u = vmla_vf_vf_vf_vf(u, s, vcast_vf_f(+0.2490088111e-2));
+  u = vmla_vf_vf_vf_vf(u, s, vcast_vf_f(-0.8074551076e-1));
+  u = vmla_vf_vf_vf_vf(u, s, vcast_vf_f(+0.7853981853e+0));
+
+  rx = vmul_vf_vf_vf(u, t);
+
+  //
+
+  u = vcast_vf_f(+0.3539815225e-5);
+  u = vmla_vf_vf_vf_vf(u, s, vcast_vf_f(-0.3259574005e-3));
+  u = vmla_vf_vf_vf_vf(u, s, vcast_vf_f(+0.1585431583e-1));
+  u = vmla_vf_vf_vf_vf(u, s, vcast_vf_f(-0.3084251285e+0));
+  u = vmla_vf_vf_vf_vf(u, s, vcast_vf_f(1));
+
+  ry = u;
+
+  //
+
+  o = veq_vo_vi2_vi2(vand_vi2_vi2_vi2(q, vcast_vi2_i(2)), vcast_vi2_i(0));
+  r = vf2setxy_vf2_vf_vf(vsel_vf_vo_vf_vf(o, rx, ry), vsel_vf_vo_vf_vf(o, ry, rx));
+
+  o = veq_vo_vi2_vi2(vand_vi2_vi2_vi2(q, vcast_vi2_i(4)), vcast_vi2_i(4));
+  r = vf2setx_vf2_vf2_vf(r, vreinterpret_vf_vm(vxor_vm_vm_vm(vand_vm_vo32_vm(o, vreinterpret_vm_vf(vcast_vf_f(-0.0))), vreinterpret_vm_vf(vf2getx_vf_vf2(r)))));
+
+  o = veq_vo_vi2_vi2(vand_vi2_vi2_vi2(vadd_vi2_vi2_vi2(q, vcast_vi2_i(2)), vcast_vi2_i(4)), vcast_vi2_i(4));
+  r = vf2sety_vf2_vf2_vf(r, vreinterpret_vf_vm(vxor_vm_vm_vm(vand_vm_vo32_vm(o, vreinterpret_vm_vf(vcast_vf_f(-0.0))), vreinterpret_vm_vf(vf2gety_vf_vf2(r)))));
+
+  o = vgt_vo_vf_vf(vabs_vf_vf(d), vcast_vf_f(1e+7f));
+  r = vf2setx_vf2_vf2_vf(r, vreinterpret_vf_vm(vandnot_vm_vo32_vm(o, vreinterpret_vm_vf(vf2getx_vf_vf2(r)))));
+  r = vf2sety_vf2_vf2_vf(r, vreinterpret_vf_vm(vandnot_vm_vo32_vm(o, vreinterpret_vm_vf(vf2gety_vf_vf2(r)))));
+
+  o = visinf_vo_vf(d);
+  r = vf2setx_vf2_vf2_vf(r, vreinterpret_vf_vm(vor_vm_vo32_vm(o, vreinterpret_vm_vf(vf2getx_vf_vf2(r)))));
+  r = vf2sety_vf2_vf2_vf(r, vreinterpret_vf_vm(vor_vm_vo32_vm(o, vreinterpret_vm_vf(vf2gety_vf_vf2(r)))));
+
+  return r;
+}
+
+SLEEF_INLINE vfloat2 Sleef_modff4_avx2128(vfloat x) {
+  vfloat fr = vsub_vf_vf_vf(x, vcast_vf_vi2(vtruncate_vi2_vf(x)));
+  fr = vsel_vf_vo_vf_vf(vgt_vo_vf_vf(vabs_vf_vf(x), vcast_vf_f(INT64_C(1) << 23)), vcast_vf_f(0), fr);
+
+  vfloat2 ret;
+
+  ret = vf2setxy_vf2_vf_vf(vcopysign_vf_vf_vf(fr, x), vcopysign_vf_vf_vf(vsub_vf_vf_vf(x, fr), x));
+
+  return ret;
+}
+
+SLEEF_INLINE SLEEF_CONST vfloat Sleef_tanf4_u10avx2128(vfloat d) {
+
+  vint2 q;
+  vfloat u, v;
+  vfloat2 s, t, x;
+  vopmask o;
+
+  if (__builtin_expect(!!(vtestallones_i_vo32(vlt_vo_vf_vf(vabs_vf_vf(d), vcast_vf_f(125.0f)))), 1)) {
+    u = vrint_vf_vf(vmul_vf_vf_vf(d, vcast_vf_f(2 * 0.318309886183790671537767526745028724)));
+    q = vrint_vi2_vf(u);
+    v = vmla_vf_vf_vf_vf(u, vcast_vf_f(-3.1414794921875f*0.5f), d);
+    s = dfadd2_vf2_vf_vf(v, vmul_vf_vf_vf(u, vcast_vf_f(-0.00011315941810607910156f*0.5f)));
+    s = dfadd_vf2_vf2_vf(s, vmul_vf_vf_vf(u, vcast_vf_f(-1.9841872589410058936e-09f*0.5f)));
+  } else {
+    dfi_t dfi = rempif(d);
+    q = dfigeti_vi2_dfi(dfi);
+    s = dfigetdf_vf2_dfi(dfi);
+    o = vor_vo_vo_vo(visinf_vo_vf(d), visnan_vo_vf(d));
+    s = vf2setx_vf2_vf2_vf(s, vreinterpret_vf_vm(vor_vm_vo32_vm(o, vreinterpret_vm_vf(vf2getx_vf_vf2(s)))));
+    s = vf2sety_vf2_vf2_vf(s, vreinterpret_vf_vm(vor_vm_vo32_vm(o, vreinterpret_vm_vf(vf2gety_vf_vf2(s)))));
+  }
+
+  o = veq_vo_vi2_vi2(vand_vi2_vi2_vi2(q, vcast_vi2_i(1)), vcast_vi2_i(1));
+  vmask n = vand_vm_vo32_vm(o, vreinterpret_vm_vf(vcast_vf_f(-0.0)));
+
+  s = vf2setx_vf2_vf2_vf(s, vreinterpret_vf_vm(vxor_vm_vm_vm(vreinterpret_vm_vf(vf2getx_vf_vf2(s)), n)));
+  s = vf2sety_vf2_vf2_vf(s, vreinterpret_vf_vm(vxor_vm_vm_vm(vreinterpret_vm_vf(vf2gety_vf_vf2(s)), n)));
+
+
+
+
+
+  t = s;
+  s = dfsqu_vf2_vf2(s);
+  s = dfnormalize_vf2_vf2(s);
+
+  u = vcast_vf_f(0.00446636462584137916564941f);
+  u = vmla_vf_vf_vf_vf(u, vf2getx_vf_vf2(s), vcast_vf_f(-8.3920182078145444393158e-05f));
+  u = vmla_vf_vf_vf_vf(u, vf2getx_vf_vf2(s), vcast_vf_f(0.0109639242291450500488281f));
+  u = vmla_vf_vf_vf_vf(u, vf2getx_vf_vf2(s), vcast_vf_f(0.0212360303848981857299805f));
+  u = vmla_vf_vf_vf_vf(u, vf2getx_vf_vf2(s), vcast_vf_f(0.0540687143802642822265625f));
+
+  x = dfadd_vf2_vf_vf(vcast_vf_f(0.133325666189193725585938f), vmul_vf_vf_vf(u, vf2getx_vf_vf2(s)));
+  x = dfadd_vf2_vf_vf2(vcast_vf_f(1), dfmul_vf2_vf2_vf2(dfadd_vf2_vf_vf2(vcast_vf_f(0.33333361148834228515625f), dfmul_vf2_vf2_vf2(s, x)), s));
+  x = dfmul_vf2_vf2_vf2(t, x);
+
+  x = vsel_vf2_vo_vf2_vf2(o, dfrec_vf2_vf2(x), x);
+
+  u = vadd_vf_vf_vf(vf2getx_vf_vf2(x), vf2gety_vf_vf2(x));
+
+  u = vsel_vf_vo_vf_vf(visnegzero_vo_vf(d), d, u);
+
+  return u;
+
+}
+
+
+// See sleefsimddp.c. The argument is assumed to be in
+// [-TRIGRANGEMAX2f/2, TRIGRANGEMAX2f/2], which is the range of the
+// first argument reduction of xtanf.
+
+SLEEF_INLINE SLEEF_CONST vfloat Sleef_sinrf4_u35avx2128(vfloat d) {
+  vfloat u, s, r = d;
+
+  vint2 q = vrint_vi2_vf(vmul_vf_vf_vf(d, vcast_vf_f((float)0.318309886183790671537767526745028724)));
+  u = vcast_vf_vi2(q);
+  d = vmla_vf_vf_vf_vf(u, vcast_vf_f(-3.1414794921875f), d);
+  d = vmla_vf_vf_vf_vf(u, vcast_vf_f(-0.00011315941810607910156f), d);
+  d = vmla_vf_vf_vf_vf(u, vcast_vf_f(-1.9841872589410058936e-09f), d);
+
+  s = vmul_vf_vf_vf(d, d);
+
+  d = vreinterpret_vf_vm(vxor_vm_vm_vm(vand_vm_vo32_vm(veq_vo_vi2_vi2(vand_vi2_vi2_vi2(q, vcast_vi2_i(1)), vcast_vi2_i(1)), vreinterpret_vm_vf(vcast_vf_f(-0.0f))), vreinterpret_vm_vf(d)));
+
+  u = vcast_vf_f(2.6083159809786593541503e-06f);
+  u = vmla_vf_vf_vf_vf(u, s, vcast_vf_f(-0.0001981069071916863322258f));
+  u = vmla_vf_vf_vf_vf(u, s, vcast_vf_f(0.00833307858556509017944336f));
+  u = vmla_vf_vf_vf_vf(u, s, vcast_vf_f(-0.166666597127914428710938f));
+
+  u = vadd_vf_vf_vf(vmul_vf_vf_vf(s, vmul_vf_vf_vf(u, d)), d);
+
+  return vsel_vf_vo_vf_vf(visnegzero_vo_vf(r), r, u);
+}
+
+SLEEF_INLINE SLEEF_CONST vfloat Sleef_cosrf4_u35avx2128(vfloat d) {
+  vfloat u, s;
+
+  vint2 q = vrint_vi2_vf(vsub_vf_vf_vf(vmul_vf_vf_vf(d, vcast_vf_f((float)0.318309886183790671537767526745028724)), vcast_vf_f(0.5f)));
+  q = vadd_vi2_vi2_vi2(vadd_vi2_vi2_vi2(q, q), vcast_vi2_i(1));
+
+  u = vcast_vf_vi2(q);
+  d = vmla_vf_vf_vf_vf(u, vcast_vf_f(-3.1414794921875f*0.5f), d);
+  d = vmla_vf_vf_vf_vf(u, vcast_vf_f(-0.00011315941810607910156f*0.5f), d);
+  d = vmla_vf_vf_vf_vf(u, vcast_vf_f(-1.9841872589410058936e-09f*0.5f), d);
+
+  s = vmul_vf_vf_vf(d, d);
+
+  d = vreinterpret_vf_vm(vxor_vm_vm_vm(vand_vm_vo32_vm(veq_vo_vi2_vi2(vand_vi2_vi2_vi2(q, vcast_vi2_i(2)), vcast_vi2_i(0)), vreinterpret_vm_vf(vcast_vf_f(-0.0f))), vreinterpret_vm_vf(d)));
+
+  u = vcast_vf_f(2.6083159809786593541503e-06f);
+  u = vmla_vf_vf_vf_vf(u, s, vcast_vf_f(-0.0001981069071916863322258f));
+  u = vmla_vf_vf_vf_vf(u, s, vcast_vf_f(0.00833307858556509017944336f));
+  u = vmla_vf_vf_vf_vf(u, s, vcast_vf_f(-0.166666597127914428710938f));
+
+  return vadd_vf_vf_vf(vmul_vf_vf_vf(s, vmul_vf_vf_vf(u, d)), d);
+}
+
+SLEEF_INLINE SLEEF_CONST vfloat2 Sleef_sincosrf4_u35avx2128(vfloat d) {
+  vopmask o;
+  vfloat u, s, t, rx, ry;
+  vfloat2 r;
+
+  vint2 q = vrint_vi2_vf(vmul_vf_vf_vf(d, vcast_vf_f((float)0.636619772367581343075535053490057448)));
+  u = vcast_vf_vi2(q);
+  s = vmla_vf_vf_vf_vf(u, vcast_vf_f(-3.1414794921875f*0.5f), d);
+  s = vmla_vf_vf_vf_vf(u, vcast_vf_f(-0.00011315941810607910156f*0.5f), s);
+  s = vmla_vf_vf_vf_vf(u, vcast_vf_f(-1.9841872589410058936e-09f*0.5f), s);
+
+  t = s;
+
+  s = vmul_vf_vf_vf(s, s);
+
+  u = vcast_vf_f(-0.000195169282960705459117889f);
+  u = vmla_vf_vf_vf_vf(u, s, vcast_vf_f(0.00833215750753879547119141f));
+  u = vmla_vf_vf_vf_vf(u, s, vcast_vf_f(-0.166666537523269653320312f));
+
+  rx = vmla_vf_vf_vf_vf(vmul_vf_vf_vf(u, s), t, t);
+  rx = vsel_vf_vo_vf_vf(visnegzero_vo_vf(d), vcast_vf_f(-0.0f), rx);
+
+  u = vcast_vf_f(-2.71811842367242206819355e-07f);
+  u = vmla_vf_vf_vf_vf(u, s, vcast_vf_f(2.47990446951007470488548e-05f));
+  u = vmla_vf_vf_vf_vf(u, s, vcast_vf_f(-0.00138888787478208541870117f));
+  u = vmla_vf_vf_vf_vf(u, s, vcast_vf_f(0.0416666641831398010253906f));
+  u = vmla_vf_vf_vf_vf(u, s, vcast_vf_f(-0.5));
+
+  ry = vmla_vf_vf_vf_vf(s, u, vcast_vf_f(1));
+
+  o = veq_vo_vi2_vi2(vand_vi2_vi2_vi2(q, vcast_vi2_i(1)), vcast_vi2_i(0));
+  r = vf2setxy_vf2_vf_vf(vsel_vf_vo_vf_vf(o, rx, ry), vsel_vf_vo_vf_vf(o, ry, rx));
+
+  o = veq_vo_vi2_vi2(vand_vi2_vi2_vi2(q, vcast_vi2_i(2)), vcast_vi2_i(2));
+  r = vf2setx_vf2_vf2_vf(r, vreinterpret_vf_vm(vxor_vm_vm_vm(vand_vm_vo32_vm(o, vreinterpret_vm_vf(vcast_vf_f(-0.0))), vreinterpret_vm_vf(vf2getx_vf_vf2(r)))));
+
+  o = veq_vo_vi2_vi2(vand_vi2_vi2_vi2(vadd_vi2_vi2_vi2(q, vcast_vi2_i(1)), vcast_vi2_i(2)), vcast_vi2_i(2));
+  r = vf2sety_vf2_vf2_vf(r, vreinterpret_vf_vm(vxor_vm_vm_vm(vand_vm_vo32_vm(o, vreinterpret_vm_vf(vcast_vf_f(-0.0))), vreinterpret_vm_vf(vf2gety_vf_vf2(r)))));
+
+  return r;
+}
+
+SLEEF_INLINE SLEEF_CONST vfloat Sleef_tanrf4_u35avx2128(vfloat d) {
+  vopmask o;
+  vfloat u, s, x;
+
+  vint2 q = vrint_vi2_vf(vmul_vf_vf_vf(d, vcast_vf_f((float)(2 * 0.318309886183790671537767526745028724))));
+  u = vcast_vf_vi2(q);
+  x = vmla_vf_vf_vf_vf(u, vcast_vf_f(-3.1414794921875f*0.5f), d);
+  x = vmla_vf_vf_vf_vf(u, vcast_vf_f(-0.00011315941810607910156f*0.5f), x);
+  x = vmla_vf_vf_vf_vf(u, vcast_vf_f(-1.9841872589410058936e-09f*0.5f), x);
+
+  s = vmul_vf_vf_vf(x, x);
+
+  o = veq_vo_vi2_vi2(vand_vi2_vi2_vi2(q, vcast_vi2_i(1)), vcast_vi2_i(1));
+  x = vreinterpret_vf_vm(vxor_vm_vm_vm(vand_vm_vo32_vm(o, vreinterpret_vm_vf(vcast_vf_f(-0.0f))), vreinterpret_vm_vf(x)));
+
+  vfloat s2 = vmul_vf_vf_vf(s, s), s4 = vmul_vf_vf_vf(s2, s2);
+  u = vmla_vf_vf_vf_vf((s4), (vmla_vf_vf_vf_vf((s), (vcast_vf_f(0.00927245803177356719970703f)), (vcast_vf_f(0.00331984995864331722259521f)))), (vmla_vf_vf_vf_vf((s2), (vmla_vf_vf_vf_vf((s), (vcast_vf_f(0.0242998078465461730957031f)), (vcast_vf_f(0.0534495301544666290283203f)))), (vmla_vf_vf_vf_vf((s), (vcast_vf_f(0.133383005857467651367188f)), (vcast_vf_f(0.333331853151321411132812f)))))))
+
+
+
+
+
+                                 ;
+
+
+  u = vmla_vf_vf_vf_vf(s, vmul_vf_vf_vf(u, x), x);
+
+  u = vsel_vf_vo_vf_vf(o, vrec_vf_vf(u), u);
+
+  return vsel_vf_vo_vf_vf(visnegzero_vo_vf(d), d, u);
+}
+
+
+
+SLEEF_INLINE SLEEF_CONST vfloat Sleef_atanf4_u35avx2128(vfloat d) {
+  vfloat s, t, u;
+  vint2 q;
+
+  q = vsel_vi2_vf_vi2(d, vcast_vi2_i(2));
+  s = vabs_vf_vf(d);
+
+  q = vsel_vi2_vf_vf_vi2_vi2(vcast_vf_f(1.0f), s, vadd_vi2_vi2_vi2(q, vcast_vi2_i(1)), q);
+  s = vsel_vf_vo_vf_vf(vlt_vo_vf_vf(vcast_vf_f(1.0f), s), vrec_vf_vf(s), s);
+
+  t = vmul_vf_vf_vf(s, s);
+
+  vfloat t2 = vmul_vf_vf_vf(t, t), t4 = vmul_vf_vf_vf(t2, t2);
+  u = vmla_vf_vf_vf_vf((t4), (vmla_vf_vf_vf_vf((t2), (vmla_vf_vf_vf_vf((t), (vcast_vf_f(0.00282363896258175373077393f)), (vcast_vf_f(-0.0159569028764963150024414f)))), (vmla_vf_vf_vf_vf((t), (vcast_vf_f(0.0425049886107444763183594f)), (vcast_vf_f(-0.0748900920152664184570312f)))))), (vmla_vf_vf_vf_vf((t2), (vmla_vf_vf_vf_vf((t), (vcast_vf_f(0.106347933411598205566406f)), (vcast_vf_f(-0.142027363181114196777344f)))), (vmla_vf_vf_vf_vf((t), (vcast_vf_f(0.199926957488059997558594f)), (vcast_vf_f(-0.333331018686294555664062f)))))))
+
+
+
+
+
+
+
+                                  ;
+
+  t = vmla_vf_vf_vf_vf(s, vmul_vf_vf_vf(t, u), s);
+
+  t = vsel_vf_vo_vf_vf(veq_vo_vi2_vi2(vand_vi2_vi2_vi2(q, vcast_vi2_i(1)), vcast_vi2_i(1)), vsub_vf_vf_vf(vcast_vf_f((float)(3.141592653589793238462643383279502884/2)), t), t);
+
+  t = vreinterpret_vf_vm(vxor_vm_vm_vm(vand_vm_vo32_vm(veq_vo_vi2_vi2(vand_vi2_vi2_vi2(q, vcast_vi2_i(2)), vcast_vi2_i(2)), vreinterpret_vm_vf(vcast_vf_f(-0.0f))), vreinterpret_vm_vf(t)));
+
+
+
+
+
+  return t;
+}
+
+
+static SLEEF_ALWAYS_INLINE SLEEF_CONST vfloat atan2kf(vfloat y, vfloat x) {
+  vfloat s, t, u;
+  vint2 q;
+  vopmask p;
+
+  q = vsel_vi2_vf_vi2(x, vcast_vi2_i(-2));
+  x = vabs_vf_vf(x);
+
+  q = vsel_vi2_vf_vf_vi2_vi2(x, y, vadd_vi2_vi2_vi2(q, vcast_vi2_i(1)), q);
+  p = vlt_vo_vf_vf(x, y);
+  s = vsel_vf_vo_vf_vf(p, vneg_vf_vf(x), y);
+  t = vmax_vf_vf_vf(x, y);
+
+  s = vdiv_vf_vf_vf(s, t);
+  t = vmul_vf_vf_vf(s, s);
+
+  vfloat t2 = vmul_vf_vf_vf(t, t), t4 = vmul_vf_vf_vf(t2, t2);
+  u = vmla_vf_vf_vf_vf((t4), (vmla_vf_vf_vf_vf((t2), (vmla_vf_vf_vf_vf((t), (vcast_vf_f(0.00282363896258175373077393f)), (vcast_vf_f(-0.0159569028764963150024414f)))), (vmla_vf_vf_vf_vf((t), (vcast_vf_f(0.0425049886107444763183594f)), (vcast_vf_f(-0.0748900920152664184570312f)))))), (vmla_vf_vf_vf_vf((t2), (vmla_vf_vf_vf_vf((t), (vcast_vf_f(0.106347933411598205566406f)), (vcast_vf_f(-0.142027363181114196777344f)))), (vmla_vf_vf_vf_vf((t), (vcast_vf_f(0.199926957488059997558594f)), (vcast_vf_f(-0.333331018686294555664062f)))))))
+
+
+
+
+
+
+
+                                  ;
+
+  t = vmla_vf_vf_vf_vf(s, vmul_vf_vf_vf(t, u), s);
+  t = vmla_vf_vf_vf_vf(vcast_vf_vi2(q), vcast_vf_f((float)(3.141592653589793238462643383279502884/2)), t);
+
+  return t;
+}
+
+static SLEEF_ALWAYS_INLINE SLEEF_CONST vfloat visinf2_vf_vf_vf(vfloat d, vfloat m) {
+  return vreinterpret_vf_vm(vand_vm_vo32_vm(visinf_vo_vf(d), vor_vm_vm_vm(vsignbit_vm_vf(d), vreinterpret_vm_vf(m))));
+}
+
+
+SLEEF_INLINE SLEEF_CONST vfloat Sleef_atan2f4_u35avx2128(vfloat y, vfloat x) {
+  vfloat r = atan2kf(vabs_vf_vf(y), x);
+
+  r = vmulsign_vf_vf_vf(r, x);
+  r = vsel_vf_vo_vf_vf(vor_vo_vo_vo(visinf_vo_vf(x), veq_vo_vf_vf(x, vcast_vf_f(0.0f))), vsub_vf_vf_vf(vcast_vf_f((float)(3.141592653589793238462643383279502884/2)), visinf2_vf_vf_vf(x, vmulsign_vf_vf_vf(vcast_vf_f((float)(3.141592653589793238462643383279502884/2)), x))), r);
+  r = vsel_vf_vo_vf_vf(visinf_vo_vf(y), vsub_vf_vf_vf(vcast_vf_f((float)(3.141592653589793238462643383279502884/2)), visinf2_vf_vf_vf(x, vmulsign_vf_vf_vf(vcast_vf_f((float)(3.141592653589793238462643383279502884/4)), x))), r);
+
+  r = vsel_vf_vo_vf_vf(veq_vo_vf_vf(y, vcast_vf_f(0.0f)), vreinterpret_vf_vm(vand_vm_vo32_vm(vsignbit_vo_vf(x), vreinterpret_vm_vf(vcast_vf_f((float)3.141592653589793238462643383279502884)))), r);
+
+  r = vreinterpret_vf_vm(vor_vm_vo32_vm(vor_vo_vo_vo(visnan_vo_vf(x), visnan_vo_vf(y)), vreinterpret_vm_vf(vmulsign_vf_vf_vf(r, y))));
+  return r;
+}
+
+SLEEF_INLINE SLEEF_CONST vfloat Sleef_asinf4_u35avx2128(vfloat d) {
+  vopmask o = vlt_vo_vf_vf(vabs_vf_vf(d), vcast_vf_f(0.5f));
+  vfloat x2 = vsel_vf_vo_vf_vf(o, vmul_vf_vf_vf(d, d), vmul_vf_vf_vf(vsub_vf_vf_vf(vcast_vf_f(1), vabs_vf_vf(d)), vcast_vf_f(0.5f)));
+  vfloat x = vsel_vf_vo_vf_vf(o, vabs_vf_vf(d), vsqrt_vf_vf(x2)), u;
+
+  u = vcast_vf_f(+0.4197454825e-1);
+  u = vmla_vf_vf_vf_vf(u, x2, vcast_vf_f(+0.2424046025e-1));
+  u = vmla_vf_vf_vf_vf(u, x2, vcast_vf_f(+0.4547423869e-1));
+  u = vmla_vf_vf_vf_vf(u, x2, vcast_vf_f(+0.7495029271e-1));
+  u = vmla_vf_vf_vf_vf(u, x2, vcast_vf_f(+0.1666677296e+0));
+  u = vmla_vf_vf_vf_vf(u, vmul_vf_vf_vf(x, x2), x);
+
+  vfloat r = vsel_vf_vo_vf_vf(o, u, vmla_vf_vf_vf_vf(u, vcast_vf_f(-2), vcast_vf_f(((float)3.141592653589793238462643383279502884)/2)));
+  return vmulsign_vf_vf_vf(r, d);
+}
+
+SLEEF_INLINE SLEEF_CONST vfloat Sleef_acosf4_u35avx2128(vfloat d) {
+  vopmask o = vlt_vo_vf_vf(vabs_vf_vf(d), vcast_vf_f(0.5f));
+  vfloat x2 = vsel_vf_vo_vf_vf(o, vmul_vf_vf_vf(d, d),
+    vmul_vf_vf_vf(vsub_vf_vf_vf(vcast_vf_f(1), vabs_vf_vf(d)), vcast_vf_f(0.5f))), u;
+  vfloat x = vsel_vf_vo_vf_vf(o, vabs_vf_vf(d), vsqrt_vf_vf(x2));
+  x = vsel_vf_vo_vf_vf(veq_vo_vf_vf(vabs_vf_vf(d), vcast_vf_f(1.0f)), vcast_vf_f(0), x);
+
+  u = vcast_vf_f(+0.4197454825e-1);
+  u = vmla_vf_vf_vf_vf(u, x2, vcast_vf_f(+0.2424046025e-1));
+  u = vmla_vf_vf_vf_vf(u, x2, vcast_vf_f(+0.4547423869e-1));
+  u = vmla_vf_vf_vf_vf(u, x2, vcast_vf_f(+0.7495029271e-1));
+  u = vmla_vf_vf_vf_vf(u, x2, vcast_vf_f(+0.1666677296e+0));
+  u = vmul_vf_vf_vf(u, vmul_vf_vf_vf(x2, x));
+
+  vfloat y = vsub_vf_vf_vf(vcast_vf_f(3.1415926535897932f/2), vadd_vf_vf_vf(vmulsign_vf_vf_vf(x, d), vmulsign_vf_vf_vf(u, d)));
+  x = vadd_vf_vf_vf(x, u);
+  vfloat r = vsel_vf_vo_vf_vf(o, y, vmul_vf_vf_vf(x, vcast_vf_f(2)));
+  return vsel_vf_vo_vf_vf(vandnot_vo_vo_vo(o, vlt_vo_vf_vf(d, vcast_vf_f(0))),
+     vf2getx_vf_vf2(dfadd_vf2_vf2_vf(vcast_vf2_f_f(3.1415927410125732422f,-8.7422776573475857731e-08f),
+         vneg_vf_vf(r))), r);
+}
+
+
+//
+
+static SLEEF_ALWAYS_INLINE SLEEF_CONST vfloat2 atan2kf_u1(vfloat2 y, vfloat2 x) {
+  vfloat u;
+  vfloat2 s, t;
+  vint2 q;
+  vopmask p;
+  vmask r;
+
+  q = vsel_vi2_vf_vf_vi2_vi2(vf2getx_vf_vf2(x), vcast_vf_f(0), vcast_vi2_i(-2), vcast_vi2_i(0));
+  p = vlt_vo_vf_vf(vf2getx_vf_vf2(x), vcast_vf_f(0));
+  r = vand_vm_vo32_vm(p, vreinterpret_vm_vf(vcast_vf_f(-0.0)));
+  x = vf2setx_vf2_vf2_vf(x, vreinterpret_vf_vm(vxor_vm_vm_vm(vreinterpret_vm_vf(vf2getx_vf_vf2(x)), r)));
+  x = vf2sety_vf2_vf2_vf(x, vreinterpret_vf_vm(vxor_vm_vm_vm(vreinterpret_vm_vf(vf2gety_vf_vf2(x)), r)));
+
+  q = vsel_vi2_vf_vf_vi2_vi2(vf2getx_vf_vf2(x), vf2getx_vf_vf2(y), vadd_vi2_vi2_vi2(q, vcast_vi2_i(1)), q);
+  p = vlt_vo_vf_vf(vf2getx_vf_vf2(x), vf2getx_vf_vf2(y));
+  s = vsel_vf2_vo_vf2_vf2(p, dfneg_vf2_vf2(x), y);
+  t = vsel_vf2_vo_vf2_vf2(p, y, x);
+
+  s = dfdiv_vf2_vf2_vf2(s, t);
+  t = dfsqu_vf2_vf2(s);
+  t = dfnormalize_vf2_vf2(t);
+
+  u = vcast_vf_f(-0.00176397908944636583328247f);
+  u = vmla_vf_vf_vf_vf(u, vf2getx_vf_vf2(t), vcast_vf_f(0.0107900900766253471374512f));
+  u = vmla_vf_vf_vf_vf(u, vf2getx_vf_vf2(t), vcast_vf_f(-0.0309564601629972457885742f));
+  u = vmla_vf_vf_vf_vf(u, vf2getx_vf_vf2(t), vcast_vf_f(0.0577365085482597351074219f));
+  u = vmla_vf_vf_vf_vf(u, vf2getx_vf_vf2(t), vcast_vf_f(-0.0838950723409652709960938f));
+  u = vmla_vf_vf_vf_vf(u, vf2getx_vf_vf2(t), vcast_vf_f(0.109463557600975036621094f));
+  u = vmla_vf_vf_vf_vf(u, vf2getx_vf_vf2(t), vcast_vf_f(-0.142626821994781494140625f));
+  u = vmla_vf_vf_vf_vf(u, vf2getx_vf_vf2(t), vcast_vf_f(0.199983194470405578613281f));
+
+  t = dfmul_vf2_vf2_vf2(t, dfadd_vf2_vf_vf(vcast_vf_f(-0.333332866430282592773438f), vmul_vf_vf_vf(u, vf2getx_vf_vf2(t))));
+  t = dfmul_vf2_vf2_vf2(s, dfadd_vf2_vf_vf2(vcast_vf_f(1), t));
+  t = dfadd_vf2_vf2_vf2(dfmul_vf2_vf2_vf(vcast_vf2_f_f(1.5707963705062866211f, -4.3711388286737928865e-08f), vcast_vf_vi2(q)), t);
+
+  return t;
+}
+
+
+SLEEF_INLINE SLEEF_CONST vfloat Sleef_atan2f4_u10avx2128(vfloat y, vfloat x) {
+  vopmask o = vlt_vo_vf_vf(vabs_vf_vf(x), vcast_vf_f(2.9387372783541830947e-39f)); // nexttowardf((1.0 / FLT_MAX), 1)
+  x = vsel_vf_vo_vf_vf(o, vmul_vf_vf_vf(x, vcast_vf_f(1 << 24)), x);
+  y = vsel_vf_vo_vf_vf(o, vmul_vf_vf_vf(y, vcast_vf_f(1 << 24)), y);
+
+  vfloat2 d = atan2kf_u1(vcast_vf2_vf_vf(vabs_vf_vf(y), vcast_vf_f(0)), vcast_vf2_vf_vf(x, vcast_vf_f(0)));
+  vfloat r = vadd_vf_vf_vf(vf2getx_vf_vf2(d), vf2gety_vf_vf2(d));
+
+  r = vmulsign_vf_vf_vf(r, x);
+  r = vsel_vf_vo_vf_vf(vor_vo_vo_vo(visinf_vo_vf(x), veq_vo_vf_vf(x, vcast_vf_f(0))), vsub_vf_vf_vf(vcast_vf_f(3.141592653589793238462643383279502884/2), visinf2_vf_vf_vf(x, vmulsign_vf_vf_vf(vcast_vf_f(3.141592653589793238462643383279502884/2), x))), r);
+  r = vsel_vf_vo_vf_vf(visinf_vo_vf(y), vsub_vf_vf_vf(vcast_vf_f(3.141592653589793238462643383279502884/2), visinf2_vf_vf_vf(x, vmulsign_vf_vf_vf(vcast_vf_f(3.141592653589793238462643383279502884/4), x))), r);
+  r = vsel_vf_vo_vf_vf(veq_vo_vf_vf(y, vcast_vf_f(0.0f)), vreinterpret_vf_vm(vand_vm_vo32_vm(vsignbit_vo_vf(x), vreinterpret_vm_vf(vcast_vf_f((float)3.141592653589793238462643383279502884)))), r);
+
+  r = vreinterpret_vf_vm(vor_vm_vo32_vm(vor_vo_vo_vo(visnan_vo_vf(x), visnan_vo_vf(y)), vreinterpret_vm_vf(vmulsign_vf_vf_vf(r, y))));
+  return r;
+}
+
+SLEEF_INLINE SLEEF_CONST vfloat Sleef_asinf4_u10avx2128(vfloat d) {
+  vopmask o = vlt_vo_vf_vf(vabs_vf_vf(d), vcast_vf_f(0.5f));
+  vfloat x2 = vsel_vf_vo_vf_vf(o, vmul_vf_vf_vf(d, d), vmul_vf_vf_vf(vsub_vf_vf_vf(vcast_vf_f(1), vabs_vf_vf(d)), vcast_vf_f(0.5f))), u;
+  vfloat2 x = vsel_vf2_vo_vf2_vf2(o, vcast_vf2_vf_vf(vabs_vf_vf(d), vcast_vf_f(0)), dfsqrt_vf2_vf(x2));
+  x = vsel_vf2_vo_vf2_vf2(veq_vo_vf_vf(vabs_vf_vf(d), vcast_vf_f(1.0f)), vcast_vf2_f_f(0, 0), x);
+
+  u = vcast_vf_f(+0.4197454825e-1);
+  u = vmla_vf_vf_vf_vf(u, x2, vcast_vf_f(+0.2424046025e-1));
+  u = vmla_vf_vf_vf_vf(u, x2, vcast_vf_f(+0.4547423869e-1));
+  u = vmla_vf_vf_vf_vf(u, x2, vcast_vf_f(+0.7495029271e-1));
+  u = vmla_vf_vf_vf_vf(u, x2, vcast_vf_f(+0.1666677296e+0));
+  u = vmul_vf_vf_vf(u, vmul_vf_vf_vf(x2, vf2getx_vf_vf2(x)));
+
+  vfloat2 y = dfsub_vf2_vf2_vf(dfsub_vf2_vf2_vf2(vcast_vf2_f_f(3.1415927410125732422f/4,-8.7422776573475857731e-08f/4), x), u);
+
+  vfloat r = vsel_vf_vo_vf_vf(o, vadd_vf_vf_vf(u, vf2getx_vf_vf2(x)),
+          vmul_vf_vf_vf(vadd_vf_vf_vf(vf2getx_vf_vf2(y), vf2gety_vf_vf2(y)), vcast_vf_f(2)));
+  return vmulsign_vf_vf_vf(r, d);
+}
+
+SLEEF_INLINE SLEEF_CONST vfloat Sleef_acosf4_u10avx2128(vfloat d) {
+  vopmask o = vlt_vo_vf_vf(vabs_vf_vf(d), vcast_vf_f(0.5f));
+  vfloat x2 = vsel_vf_vo_vf_vf(o, vmul_vf_vf_vf(d, d), vmul_vf_vf_vf(vsub_vf_vf_vf(vcast_vf_f(1), vabs_vf_vf(d)), vcast_vf_f(0.5f))), u;
+  vfloat2 x = vsel_vf2_vo_vf2_vf2(o, vcast_vf2_vf_vf(vabs_vf_vf(d), vcast_vf_f(0)), dfsqrt_vf2_vf(x2));
+  x = vsel_vf2_vo_vf2_vf2(veq_vo_vf_vf(vabs_vf_vf(d), vcast_vf_f(1.0f)), vcast_vf2_f_f(0, 0), x);
+
+  u = vcast_vf_f(+0.4197454825e-1);
+  u = vmla_vf_vf_vf_vf(u, x2, vcast_vf_f(+0.2424046025e-1));
+  u = vmla_vf_vf_vf_vf(u, x2, vcast_vf_f(+0.4547423869e-1));
+  u = vmla_vf_vf_vf_vf(u, x2, vcast_vf_f(+0.7495029271e-1));
+  u = vmla_vf_vf_vf_vf(u, x2, vcast_vf_f(+0.1666677296e+0));
+  u = vmul_vf_vf_vf(u, vmul_vf_vf_vf(x2, vf2getx_vf_vf2(x)));
+
+  vfloat2 y = dfsub_vf2_vf2_vf2(vcast_vf2_f_f(3.1415927410125732422f/2, -8.7422776573475857731e-08f/2),
+     dfadd_vf2_vf_vf(vmulsign_vf_vf_vf(vf2getx_vf_vf2(x), d), vmulsign_vf_vf_vf(u, d)));
+  x = dfadd_vf2_vf2_vf(x, u);
+
+  y = vsel_vf2_vo_vf2_vf2(o, y, dfscale_vf2_vf2_vf(x, vcast_vf_f(2)));
+
+  y = vsel_vf2_vo_vf2_vf2(vandnot_vo_vo_vo(o, vlt_vo_vf_vf(d, vcast_vf_f(0))),
+     dfsub_vf2_vf2_vf2(vcast_vf2_f_f(3.1415927410125732422f, -8.7422776573475857731e-08f), y), y);
+
+  return vadd_vf_vf_vf(vf2getx_vf_vf2(y), vf2gety_vf_vf2(y));
+}
+
+SLEEF_INLINE SLEEF_CONST vfloat Sleef_atanf4_u10avx2128(vfloat d) {
+  vfloat2 d2 = atan2kf_u1(vcast_vf2_vf_vf(vabs_vf_vf(d), vcast_vf_f(0)), vcast_vf2_f_f(1, 0));
+  vfloat r = vadd_vf_vf_vf(vf2getx_vf_vf2(d2), vf2gety_vf_vf2(d2));
+  r = vsel_vf_vo_vf_vf(visinf_vo_vf(d), vcast_vf_f(1.570796326794896557998982), r);
+  return vmulsign_vf_vf_vf(r, d);
+}
+
+
+//
+
+
+SLEEF_INLINE SLEEF_CONST vfloat Sleef_logf4_u35avx2128(vfloat d) {
+  vfloat x, x2, t, m;
+
+
+  vopmask o = vlt_vo_vf_vf(d, vcast_vf_f(0x1p-126));
+  d = vsel_vf_vo_vf_vf(o, vmul_vf_vf_vf(d, vcast_vf_f((float)(INT64_C(1) << 32) * (float)(INT64_C(1) << 32))), d);
+  vint2 e = vilogb2k_vi2_vf(vmul_vf_vf_vf(d, vcast_vf_f(1.0f/0.75f)));
+  m = vldexp3_vf_vf_vi2(d, vneg_vi2_vi2(e));
+  e = vsel_vi2_vo_vi2_vi2(o, vsub_vi2_vi2_vi2(e, vcast_vi2_i(64)), e);
+
+
+
+
+
+
+  x = vdiv_vf_vf_vf(vsub_vf_vf_vf(m, vcast_vf_f(1.0f)), vadd_vf_vf_vf(vcast_vf_f(1.0f), m));
+  x2 = vmul_vf_vf_vf(x, x);
+
+  t = vcast_vf_f(0.2392828464508056640625f);
+  t = vmla_vf_vf_vf_vf(t, x2, vcast_vf_f(0.28518211841583251953125f));
+  t = vmla_vf_vf_vf_vf(t, x2, vcast_vf_f(0.400005877017974853515625f));
+  t = vmla_vf_vf_vf_vf(t, x2, vcast_vf_f(0.666666686534881591796875f));
+  t = vmla_vf_vf_vf_vf(t, x2, vcast_vf_f(2.0f));
+
+
+  x = vmla_vf_vf_vf_vf(x, t, vmul_vf_vf_vf(vcast_vf_f(0.693147180559945286226764f), vcast_vf_vi2(e)));
+  x = vsel_vf_vo_vf_vf(vispinf_vo_vf(d), vcast_vf_f(__builtin_inff()), x);
+  x = vsel_vf_vo_vf_vf(vor_vo_vo_vo(vlt_vo_vf_vf(d, vcast_vf_f(0)), visnan_vo_vf(d)), vcast_vf_f(__builtin_nanf("")), x);
+  x = vsel_vf_vo_vf_vf(veq_vo_vf_vf(d, vcast_vf_f(0)), vcast_vf_f(-__builtin_inff()), x);
+
+
+
+
+
+  return x;
+}
+
+
+
+SLEEF_INLINE SLEEF_CONST vfloat Sleef_expf4_u10avx2128(vfloat d) {
+  vint2 q = vrint_vi2_vf(vmul_vf_vf_vf(d, vcast_vf_f(1.442695040888963407359924681001892137426645954152985934135449406931f)));
+  vfloat s, u;
+
+  s = vmla_vf_vf_vf_vf(vcast_vf_vi2(q), vcast_vf_f(-0.693145751953125f), d);
+  s = vmla_vf_vf_vf_vf(vcast_vf_vi2(q), vcast_vf_f(-1.428606765330187045e-06f), s);
+
+  u = vcast_vf_f(0.000198527617612853646278381);
+  u = vmla_vf_vf_vf_vf(u, s, vcast_vf_f(0.00139304355252534151077271));
+  u = vmla_vf_vf_vf_vf(u, s, vcast_vf_f(0.00833336077630519866943359));
+  u = vmla_vf_vf_vf_vf(u, s, vcast_vf_f(0.0416664853692054748535156));
+  u = vmla_vf_vf_vf_vf(u, s, vcast_vf_f(0.166666671633720397949219));
+  u = vmla_vf_vf_vf_vf(u, s, vcast_vf_f(0.5));
+
+  u = vadd_vf_vf_vf(vcast_vf_f(1.0f), vmla_vf_vf_vf_vf(vmul_vf_vf_vf(s, s), u, s));
+
+  u = vldexp2_vf_vf_vi2(u, q);
+
+  u = vreinterpret_vf_vm(vandnot_vm_vo32_vm(vlt_vo_vf_vf(d, vcast_vf_f(-104)), vreinterpret_vm_vf(u)));
+  u = vsel_vf_vo_vf_vf(vlt_vo_vf_vf(vcast_vf_f(100), d), vcast_vf_f(__builtin_inff()), u);
+
+  return u;
+}
+
+
+static SLEEF_ALWAYS_INLINE SLEEF_CONST vfloat expm1fk(vfloat d) {
+  vint2 q = vrint_vi2_vf(vmul_vf_vf_vf(d, vcast_vf_f(1.442695040888963407359924681001892137426645954152985934135449406931f)));
+  vfloat s, u;
+
+  s = vmla_vf_vf_vf_vf(vcast_vf_vi2(q), vcast_vf_f(-0.693145751953125f), d);
+  s = vmla_vf_vf_vf_vf(vcast_vf_vi2(q), vcast_vf_f(-1.428606765330187045e-06f), s);
+
+  vfloat s2 = vmul_vf_vf_vf(s, s), s4 = vmul_vf_vf_vf(s2, s2);
+  u = vmla_vf_vf_vf_vf((s4), (vmla_vf_vf_vf_vf((s), (vcast_vf_f(0.000198527617612853646278381)), (vcast_vf_f(0.00139304355252534151077271)))), (vmla_vf_vf_vf_vf((s2), (vmla_vf_vf_vf_vf((s), (vcast_vf_f(0.00833336077630519866943359)), (vcast_vf_f(0.0416664853692054748535156)))), (vmla_vf_vf_vf_vf((s), (vcast_vf_f(0.166666671633720397949219)), (vcast_vf_f(0.5)))))))
+
+
+
+
+
+         ;
+
+  u = vmla_vf_vf_vf_vf(vmul_vf_vf_vf(s, s), u, s);
+
+  u = vsel_vf_vo_vf_vf(veq_vo_vi2_vi2(q, vcast_vi2_i(0)), u,
+         vsub_vf_vf_vf(vldexp2_vf_vf_vi2(vadd_vf_vf_vf(u, vcast_vf_f(1)), q), vcast_vf_f(1)));
+
+  return u;
+}
+
+SLEEF_INLINE SLEEF_CONST vfloat Sleef_sqrtf4_u35avx2128(vfloat d) { return vsqrt_vf_vf(d); }
+
+
+
+SLEEF_INLINE SLEEF_CONST vfloat Sleef_cbrtf4_u35avx2128(vfloat d) {
+  vfloat x, y, q = vcast_vf_f(1.0), t;
+  vint2 e, qu, re;
+
+
+
+
+  e = vadd_vi2_vi2_vi2(vilogbk_vi2_vf(vabs_vf_vf(d)), vcast_vi2_i(1));
+  d = vldexp2_vf_vf_vi2(d, vneg_vi2_vi2(e));
+
+  t = vadd_vf_vf_vf(vcast_vf_vi2(e), vcast_vf_f(6144));
+  qu = vtruncate_vi2_vf(vmul_vf_vf_vf(t, vcast_vf_f(1.0f/3.0f)));
+  re = vtruncate_vi2_vf(vsub_vf_vf_vf(t, vmul_vf_vf_vf(vcast_vf_vi2(qu), vcast_vf_f(3))));
+
+  q = vsel_vf_vo_vf_vf(veq_vo_vi2_vi2(re, vcast_vi2_i(1)), vcast_vf_f(1.2599210498948731647672106f), q);
+  q = vsel_vf_vo_vf_vf(veq_vo_vi2_vi2(re, vcast_vi2_i(2)), vcast_vf_f(1.5874010519681994747517056f), q);
+  q = vldexp2_vf_vf_vi2(q, vsub_vi2_vi2_vi2(qu, vcast_vi2_i(2048)));
+
+  q = vmulsign_vf_vf_vf(q, d);
+  d = vabs_vf_vf(d);
+
+  x = vcast_vf_f(-0.601564466953277587890625f);
+  x = vmla_vf_vf_vf_vf(x, d, vcast_vf_f(2.8208892345428466796875f));
+  x = vmla_vf_vf_vf_vf(x, d, vcast_vf_f(-5.532182216644287109375f));
+  x = vmla_vf_vf_vf_vf(x, d, vcast_vf_f(5.898262500762939453125f));
+  x = vmla_vf_vf_vf_vf(x, d, vcast_vf_f(-3.8095417022705078125f));
+  x = vmla_vf_vf_vf_vf(x, d, vcast_vf_f(2.2241256237030029296875f));
+
+  y = vmul_vf_vf_vf(vmul_vf_vf_vf(d, x), x);
+  y = vmul_vf_vf_vf(vsub_vf_vf_vf(y, vmul_vf_vf_vf(vmul_vf_vf_vf(vcast_vf_f(2.0f / 3.0f), y), vmla_vf_vf_vf_vf(y, x, vcast_vf_f(-1.0f)))), q);
+
+
+
+
+
+
+  return y;
+}
+
+
+
+SLEEF_INLINE SLEEF_CONST vfloat Sleef_cbrtf4_u10avx2128(vfloat d) {
+  vfloat x, y, z, t;
+  vfloat2 q2 = vcast_vf2_f_f(1, 0), u, v;
+  vint2 e, qu, re;
+
+
+
+
+  e = vadd_vi2_vi2_vi2(vilogbk_vi2_vf(vabs_vf_vf(d)), vcast_vi2_i(1));
+  d = vldexp2_vf_vf_vi2(d, vneg_vi2_vi2(e));
+
+  t = vadd_vf_vf_vf(vcast_vf_vi2(e), vcast_vf_f(6144));
+  qu = vtruncate_vi2_vf(vmul_vf_vf_vf(t, vcast_vf_f(1.0/3.0)));
+  re = vtruncate_vi2_vf(vsub_vf_vf_vf(t, vmul_vf_vf_vf(vcast_vf_vi2(qu), vcast_vf_f(3))));
+
+  q2 = vsel_vf2_vo_vf2_vf2(veq_vo_vi2_vi2(re, vcast_vi2_i(1)), vcast_vf2_f_f(1.2599210739135742188f, -2.4018701694217270415e-08), q2);
+  q2 = vsel_vf2_vo_vf2_vf2(veq_vo_vi2_vi2(re, vcast_vi2_i(2)), vcast_vf2_f_f(1.5874010324478149414f, 1.9520385308169352356e-08), q2);
+
+  q2 = vf2setx_vf2_vf2_vf(q2, vmulsign_vf_vf_vf(vf2getx_vf_vf2(q2), d));
+  q2 = vf2sety_vf2_vf2_vf(q2, vmulsign_vf_vf_vf(vf2gety_vf_vf2(q2), d));
+  d = vabs_vf_vf(d);
+
+  x = vcast_vf_f(-0.601564466953277587890625f);
+  x = vmla_vf_vf_vf_vf(x, d, vcast_vf_f(2.8208892345428466796875f));
+  x = vmla_vf_vf_vf_vf(x, d, vcast_vf_f(-5.532182216644287109375f));
+  x = vmla_vf_vf_vf_vf(x, d, vcast_vf_f(5.898262500762939453125f));
+  x = vmla_vf_vf_vf_vf(x, d, vcast_vf_f(-3.8095417022705078125f));
+  x = vmla_vf_vf_vf_vf(x, d, vcast_vf_f(2.2241256237030029296875f));
+
+  y = vmul_vf_vf_vf(x, x); y = vmul_vf_vf_vf(y, y); x = vsub_vf_vf_vf(x, vmul_vf_vf_vf(vmlanp_vf_vf_vf_vf(d, y, x), vcast_vf_f(-1.0 / 3.0)));
+
+  z = x;
+
+  u = dfmul_vf2_vf_vf(x, x);
+  u = dfmul_vf2_vf2_vf2(u, u);
+  u = dfmul_vf2_vf2_vf(u, d);
+  u = dfadd2_vf2_vf2_vf(u, vneg_vf_vf(x));
+  y = vadd_vf_vf_vf(vf2getx_vf_vf2(u), vf2gety_vf_vf2(u));
+
+  y = vmul_vf_vf_vf(vmul_vf_vf_vf(vcast_vf_f(-2.0 / 3.0), y), z);
+  v = dfadd2_vf2_vf2_vf(dfmul_vf2_vf_vf(z, z), y);
+  v = dfmul_vf2_vf2_vf(v, d);
+  v = dfmul_vf2_vf2_vf2(v, q2);
+  z = vldexp2_vf_vf_vi2(vadd_vf_vf_vf(vf2getx_vf_vf2(v), vf2gety_vf_vf2(v)), vsub_vi2_vi2_vi2(qu, vcast_vi2_i(2048)));
+
+  z = vsel_vf_vo_vf_vf(visinf_vo_vf(d), vmulsign_vf_vf_vf(vcast_vf_f(__builtin_inff()), vf2getx_vf_vf2(q2)), z);
+  z = vsel_vf_vo_vf_vf(veq_vo_vf_vf(d, vcast_vf_f(0)), vreinterpret_vf_vm(vsignbit_vm_vf(vf2getx_vf_vf2(q2))), z);
+
+
+
+
+
+
+  return z;
+}
+
+
+static SLEEF_ALWAYS_INLINE SLEEF_CONST vfloat2 logkf(vfloat d) {
+  vfloat2 x, x2;
+  vfloat t, m;
+
+
+  vopmask o = vlt_vo_vf_vf(d, vcast_vf_f(0x1p-126));
+  d = vsel_vf_vo_vf_vf(o, vmul_vf_vf_vf(d, vcast_vf_f((float)(INT64_C(1) << 32) * (float)(INT64_C(1) << 32))), d);
+  vint2 e = vilogb2k_vi2_vf(vmul_vf_vf_vf(d, vcast_vf_f(1.0f/0.75f)));
+  m = vldexp3_vf_vf_vi2(d, vneg_vi2_vi2(e));
+  e = vsel_vi2_vo_vi2_vi2(o, vsub_vi2_vi2_vi2(e, vcast_vi2_i(64)), e);
+
+
+
+
+
+
+  x = dfdiv_vf2_vf2_vf2(dfadd2_vf2_vf_vf(vcast_vf_f(-1), m), dfadd2_vf2_vf_vf(vcast_vf_f(1), m));
+  x2 = dfsqu_vf2_vf2(x);
+
+  t = vcast_vf_f(0.240320354700088500976562);
+  t = vmla_vf_vf_vf_vf(t, vf2getx_vf_vf2(x2), vcast_vf_f(0.285112679004669189453125));
+  t = vmla_vf_vf_vf_vf(t, vf2getx_vf_vf2(x2), vcast_vf_f(0.400007992982864379882812));
+  vfloat2 c = vcast_vf2_f_f(0.66666662693023681640625f, 3.69183861259614332084311e-09f);
+
+
+  vfloat2 s = dfmul_vf2_vf2_vf(vcast_vf2_f_f(0.69314718246459960938f, -1.904654323148236017e-09f), vcast_vf_vi2(e));
+
+
+
+
+  s = dfadd_vf2_vf2_vf2(s, dfscale_vf2_vf2_vf(x, vcast_vf_f(2)));
+  s = dfadd_vf2_vf2_vf2(s, dfmul_vf2_vf2_vf2(dfmul_vf2_vf2_vf2(x2, x),
+          dfadd2_vf2_vf2_vf2(dfmul_vf2_vf2_vf(x2, t), c)));
+  return s;
+}
+
+static SLEEF_ALWAYS_INLINE SLEEF_CONST vfloat logk3f(vfloat d) {
+  vfloat x, x2, t, m;
+
+
+  vopmask o = vlt_vo_vf_vf(d, vcast_vf_f(0x1p-126));
+  d = vsel_vf_vo_vf_vf(o, vmul_vf_vf_vf(d, vcast_vf_f((float)(INT64_C(1) << 32) * (float)(INT64_C(1) << 32))), d);
+  vint2 e = vilogb2k_vi2_vf(vmul_vf_vf_vf(d, vcast_vf_f(1.0f/0.75f)));
+  m = vldexp3_vf_vf_vi2(d, vneg_vi2_vi2(e));
+  e = vsel_vi2_vo_vi2_vi2(o, vsub_vi2_vi2_vi2(e, vcast_vi2_i(64)), e);
+
+
+
+
+
+
+  x = vdiv_vf_vf_vf(vsub_vf_vf_vf(m, vcast_vf_f(1.0f)), vadd_vf_vf_vf(vcast_vf_f(1.0f), m));
+  x2 = vmul_vf_vf_vf(x, x);
+
+  t = vcast_vf_f(0.2392828464508056640625f);
+  t = vmla_vf_vf_vf_vf(t, x2, vcast_vf_f(0.28518211841583251953125f));
+  t = vmla_vf_vf_vf_vf(t, x2, vcast_vf_f(0.400005877017974853515625f));
+  t = vmla_vf_vf_vf_vf(t, x2, vcast_vf_f(0.666666686534881591796875f));
+  t = vmla_vf_vf_vf_vf(t, x2, vcast_vf_f(2.0f));
+
+
+  x = vmla_vf_vf_vf_vf(x, t, vmul_vf_vf_vf(vcast_vf_f(0.693147180559945286226764f), vcast_vf_vi2(e)));
+
+
+
+
+  return x;
+}
+
+
+SLEEF_INLINE SLEEF_CONST vfloat Sleef_logf4_u10avx2128(vfloat d) {
+  vfloat2 x;
+  vfloat t, m, x2;
+
+
+  vopmask o = vlt_vo_vf_vf(d, vcast_vf_f(0x1p-126));
+  d = vsel_vf_vo_vf_vf(o, vmul_vf_vf_vf(d, vcast_vf_f((float)(INT64_C(1) << 32) * (float)(INT64_C(1) << 32))), d);
+  vint2 e = vilogb2k_vi2_vf(vmul_vf_vf_vf(d, vcast_vf_f(1.0f/0.75f)));
+  m = vldexp3_vf_vf_vi2(d, vneg_vi2_vi2(e));
+  e = vsel_vi2_vo_vi2_vi2(o, vsub_vi2_vi2_vi2(e, vcast_vi2_i(64)), e);
+  vfloat2 s = dfmul_vf2_vf2_vf(vcast_vf2_f_f(0.69314718246459960938f, -1.904654323148236017e-09f), vcast_vf_vi2(e));
+
+
+
+
+
+
+
+  x = dfdiv_vf2_vf2_vf2(dfadd2_vf2_vf_vf(vcast_vf_f(-1), m), dfadd2_vf2_vf_vf(vcast_vf_f(1), m));
+  x2 = vmul_vf_vf_vf(vf2getx_vf_vf2(x), vf2getx_vf_vf2(x));
+
+  t = vcast_vf_f(+0.3027294874e+0f);
+  t = vmla_vf_vf_vf_vf(t, x2, vcast_vf_f(+0.3996108174e+0f));
+  t = vmla_vf_vf_vf_vf(t, x2, vcast_vf_f(+0.6666694880e+0f));
+
+  s = dfadd_vf2_vf2_vf2(s, dfscale_vf2_vf2_vf(x, vcast_vf_f(2)));
+  s = dfadd_vf2_vf2_vf(s, vmul_vf_vf_vf(vmul_vf_vf_vf(x2, vf2getx_vf_vf2(x)), t));
+
+  vfloat r = vadd_vf_vf_vf(vf2getx_vf_vf2(s), vf2gety_vf_vf2(s));
+
+
+  r = vsel_vf_vo_vf_vf(vispinf_vo_vf(d), vcast_vf_f(__builtin_inff()), r);
+  r = vsel_vf_vo_vf_vf(vor_vo_vo_vo(vlt_vo_vf_vf(d, vcast_vf_f(0)), visnan_vo_vf(d)), vcast_vf_f(__builtin_nanf("")), r);
+  r = vsel_vf_vo_vf_vf(veq_vo_vf_vf(d, vcast_vf_f(0)), vcast_vf_f(-__builtin_inff()), r);
+
+
+
+
+  return r;
+}
+
+
+static SLEEF_ALWAYS_INLINE SLEEF_CONST vfloat expkf(vfloat2 d) {
+  vfloat u = vmul_vf_vf_vf(vadd_vf_vf_vf(vf2getx_vf_vf2(d), vf2gety_vf_vf2(d)), vcast_vf_f(1.442695040888963407359924681001892137426645954152985934135449406931f));
+  vint2 q = vrint_vi2_vf(u);
+  vfloat2 s, t;
+
+  s = dfadd2_vf2_vf2_vf(d, vmul_vf_vf_vf(vcast_vf_vi2(q), vcast_vf_f(-0.693145751953125f)));
+  s = dfadd2_vf2_vf2_vf(s, vmul_vf_vf_vf(vcast_vf_vi2(q), vcast_vf_f(-1.428606765330187045e-06f)));
+
+  s = dfnormalize_vf2_vf2(s);
+
+  u = vcast_vf_f(0.00136324646882712841033936f);
+  u = vmla_vf_vf_vf_vf(u, vf2getx_vf_vf2(s), vcast_vf_f(0.00836596917361021041870117f));
+  u = vmla_vf_vf_vf_vf(u, vf2getx_vf_vf2(s), vcast_vf_f(0.0416710823774337768554688f));
+  u = vmla_vf_vf_vf_vf(u, vf2getx_vf_vf2(s), vcast_vf_f(0.166665524244308471679688f));
+  u = vmla_vf_vf_vf_vf(u, vf2getx_vf_vf2(s), vcast_vf_f(0.499999850988388061523438f));
+
+  t = dfadd_vf2_vf2_vf2(s, dfmul_vf2_vf2_vf(dfsqu_vf2_vf2(s), u));
+
+  t = dfadd_vf2_vf_vf2(vcast_vf_f(1), t);
+  u = vadd_vf_vf_vf(vf2getx_vf_vf2(t), vf2gety_vf_vf2(t));
+  u = vldexp_vf_vf_vi2(u, q);
+
+  u = vreinterpret_vf_vm(vandnot_vm_vo32_vm(vlt_vo_vf_vf(vf2getx_vf_vf2(d), vcast_vf_f(-104)), vreinterpret_vm_vf(u)));
+
+  return u;
+}
+
+static SLEEF_ALWAYS_INLINE SLEEF_CONST vfloat expk3f(vfloat d) {
+  vint2 q = vrint_vi2_vf(vmul_vf_vf_vf(d, vcast_vf_f(1.442695040888963407359924681001892137426645954152985934135449406931f)));
+  vfloat s, u;
+
+  s = vmla_vf_vf_vf_vf(vcast_vf_vi2(q), vcast_vf_f(-0.693145751953125f), d);
+  s = vmla_vf_vf_vf_vf(vcast_vf_vi2(q), vcast_vf_f(-1.428606765330187045e-06f), s);
+
+  u = vcast_vf_f(0.000198527617612853646278381);
+  u = vmla_vf_vf_vf_vf(u, s, vcast_vf_f(0.00139304355252534151077271));
+  u = vmla_vf_vf_vf_vf(u, s, vcast_vf_f(0.00833336077630519866943359));
+  u = vmla_vf_vf_vf_vf(u, s, vcast_vf_f(0.0416664853692054748535156));
+  u = vmla_vf_vf_vf_vf(u, s, vcast_vf_f(0.166666671633720397949219));
+  u = vmla_vf_vf_vf_vf(u, s, vcast_vf_f(0.5));
+
+  u = vmla_vf_vf_vf_vf(vmul_vf_vf_vf(s, s), u, vadd_vf_vf_vf(s, vcast_vf_f(1.0f)));
+  u = vldexp2_vf_vf_vi2(u, q);
+
+  u = vreinterpret_vf_vm(vandnot_vm_vo32_vm(vlt_vo_vf_vf(d, vcast_vf_f(-104)), vreinterpret_vm_vf(u)));
+
+  return u;
+}
+
+
+SLEEF_INLINE SLEEF_CONST vfloat Sleef_powf4_u10avx2128(vfloat x, vfloat y) {
+
+  vopmask yisint = vor_vo_vo_vo(veq_vo_vf_vf(vtruncate_vf_vf(y), y), vgt_vo_vf_vf(vabs_vf_vf(y), vcast_vf_f(1 << 24)));
+  vopmask yisodd = vand_vo_vo_vo(vand_vo_vo_vo(veq_vo_vi2_vi2(vand_vi2_vi2_vi2(vtruncate_vi2_vf(y), vcast_vi2_i(1)), vcast_vi2_i(1)), yisint),
+     vlt_vo_vf_vf(vabs_vf_vf(y), vcast_vf_f(1 << 24)));
+
+
+
+
+
+  vfloat result = expkf(dfmul_vf2_vf2_vf(logkf(vabs_vf_vf(x)), y));
+
+  result = vsel_vf_vo_vf_vf(visnan_vo_vf(result), vcast_vf_f(__builtin_inff()), result);
+
+  result = vmul_vf_vf_vf(result,
+    vsel_vf_vo_vf_vf(vgt_vo_vf_vf(x, vcast_vf_f(0)),
+       vcast_vf_f(1),
+       vsel_vf_vo_vf_vf(yisint, vsel_vf_vo_vf_vf(yisodd, vcast_vf_f(-1.0f), vcast_vf_f(1)), vcast_vf_f(__builtin_nanf("")))));
+
+  vfloat efx = vmulsign_vf_vf_vf(vsub_vf_vf_vf(vabs_vf_vf(x), vcast_vf_f(1)), y);
+
+  result = vsel_vf_vo_vf_vf(visinf_vo_vf(y),
+       vreinterpret_vf_vm(vandnot_vm_vo32_vm(vlt_vo_vf_vf(efx, vcast_vf_f(0.0f)),
+          vreinterpret_vm_vf(vsel_vf_vo_vf_vf(veq_vo_vf_vf(efx, vcast_vf_f(0.0f)),
+                  vcast_vf_f(1.0f),
+                  vcast_vf_f(__builtin_inff()))))),
+       result);
+
+  result = vsel_vf_vo_vf_vf(vor_vo_vo_vo(visinf_vo_vf(x), veq_vo_vf_vf(x, vcast_vf_f(0.0))),
+       vmulsign_vf_vf_vf(vsel_vf_vo_vf_vf(vxor_vo_vo_vo(vsignbit_vo_vf(y), veq_vo_vf_vf(x, vcast_vf_f(0.0f))),
+              vcast_vf_f(0), vcast_vf_f(__builtin_inff())),
+           vsel_vf_vo_vf_vf(yisodd, x, vcast_vf_f(1))), result);
+
+  result = vreinterpret_vf_vm(vor_vm_vo32_vm(vor_vo_vo_vo(visnan_vo_vf(x), visnan_vo_vf(y)), vreinterpret_vm_vf(result)));
+
+  result = vsel_vf_vo_vf_vf(vor_vo_vo_vo(veq_vo_vf_vf(y, vcast_vf_f(0)), veq_vo_vf_vf(x, vcast_vf_f(1))), vcast_vf_f(1), result);
+
+  return result;
+
+
+
+}
+
+SLEEF_INLINE SLEEF_CONST vfloat Sleef_fastpowf4_u3500avx2128(vfloat x, vfloat y) {
+  vfloat result = expk3f(vmul_vf_vf_vf(logk3f(vabs_vf_vf(x)), y));
+  vopmask yisint = vor_vo_vo_vo(veq_vo_vf_vf(vtruncate_vf_vf(y), y), vgt_vo_vf_vf(vabs_vf_vf(y), vcast_vf_f(1 << 24)));
+  vopmask yisodd = vand_vo_vo_vo(vand_vo_vo_vo(veq_vo_vi2_vi2(vand_vi2_vi2_vi2(vtruncate_vi2_vf(y), vcast_vi2_i(1)), vcast_vi2_i(1)), yisint),
+     vlt_vo_vf_vf(vabs_vf_vf(y), vcast_vf_f(1 << 24)));
+
+  result = vsel_vf_vo_vf_vf(vand_vo_vo_vo(vsignbit_vo_vf(x), yisodd), vneg_vf_vf(result), result);
+
+  result = vsel_vf_vo_vf_vf(veq_vo_vf_vf(x, vcast_vf_f(0)), vcast_vf_f(0), result);
+  result = vsel_vf_vo_vf_vf(veq_vo_vf_vf(y, vcast_vf_f(0)), vcast_vf_f(1), result);
+
+  return result;
+}
+
+
+static SLEEF_ALWAYS_INLINE SLEEF_CONST vfloat2 expk2f(vfloat2 d) {
+  vfloat u = vmul_vf_vf_vf(vadd_vf_vf_vf(vf2getx_vf_vf2(d), vf2gety_vf_vf2(d)), vcast_vf_f(1.442695040888963407359924681001892137426645954152985934135449406931f));
+  vint2 q = vrint_vi2_vf(u);
+  vfloat2 s, t;
+
+  s = dfadd2_vf2_vf2_vf(d, vmul_vf_vf_vf(vcast_vf_vi2(q), vcast_vf_f(-0.693145751953125f)));
+  s = dfadd2_vf2_vf2_vf(s, vmul_vf_vf_vf(vcast_vf_vi2(q), vcast_vf_f(-1.428606765330187045e-06f)));
+
+  u = vcast_vf_f(+0.1980960224e-3f);
+  u = vmla_vf_vf_vf_vf(u, vf2getx_vf_vf2(s), vcast_vf_f(+0.1394256484e-2f));
+  u = vmla_vf_vf_vf_vf(u, vf2getx_vf_vf2(s), vcast_vf_f(+0.8333456703e-2f));
+  u = vmla_vf_vf_vf_vf(u, vf2getx_vf_vf2(s), vcast_vf_f(+0.4166637361e-1f));
+
+  t = dfadd2_vf2_vf2_vf(dfmul_vf2_vf2_vf(s, u), vcast_vf_f(+0.166666659414234244790680580464e+0f));
+  t = dfadd2_vf2_vf2_vf(dfmul_vf2_vf2_vf2(s, t), vcast_vf_f(0.5));
+  t = dfadd2_vf2_vf2_vf2(s, dfmul_vf2_vf2_vf2(dfsqu_vf2_vf2(s), t));
+
+  t = dfadd_vf2_vf_vf2(vcast_vf_f(1), t);
+
+  t = vf2setx_vf2_vf2_vf(t, vldexp2_vf_vf_vi2(vf2getx_vf_vf2(t), q));
+  t = vf2sety_vf2_vf2_vf(t, vldexp2_vf_vf_vi2(vf2gety_vf_vf2(t), q));
+
+  t = vf2setx_vf2_vf2_vf(t, vreinterpret_vf_vm(vandnot_vm_vo32_vm(vlt_vo_vf_vf(vf2getx_vf_vf2(d), vcast_vf_f(-104)), vreinterpret_vm_vf(vf2getx_vf_vf2(t)))));
+  t = vf2sety_vf2_vf2_vf(t, vreinterpret_vf_vm(vandnot_vm_vo32_vm(vlt_vo_vf_vf(vf2getx_vf_vf2(d), vcast_vf_f(-104)), vreinterpret_vm_vf(vf2gety_vf_vf2(t)))));
+
+  return t;
+}
+
+
+SLEEF_INLINE SLEEF_CONST vfloat Sleef_sinhf4_u10avx2128(vfloat x) {
+  vfloat y = vabs_vf_vf(x);
+  vfloat2 d = expk2f(vcast_vf2_vf_vf(y, vcast_vf_f(0)));
+  d = dfsub_vf2_vf2_vf2(d, dfrec_vf2_vf2(d));
+  y = vmul_vf_vf_vf(vadd_vf_vf_vf(vf2getx_vf_vf2(d), vf2gety_vf_vf2(d)), vcast_vf_f(0.5));
+
+  y = vsel_vf_vo_vf_vf(vor_vo_vo_vo(vgt_vo_vf_vf(vabs_vf_vf(x), vcast_vf_f(89)),
+        visnan_vo_vf(y)), vcast_vf_f(__builtin_inff()), y);
+  y = vmulsign_vf_vf_vf(y, x);
+  y = vreinterpret_vf_vm(vor_vm_vo32_vm(visnan_vo_vf(x), vreinterpret_vm_vf(y)));
+
+  return y;
+}
+
+SLEEF_INLINE SLEEF_CONST vfloat Sleef_coshf4_u10avx2128(vfloat x) {
+  vfloat y = vabs_vf_vf(x);
+  vfloat2 d = expk2f(vcast_vf2_vf_vf(y, vcast_vf_f(0)));
+  d = dfadd_vf2_vf2_vf2(d, dfrec_vf2_vf2(d));
+  y = vmul_vf_vf_vf(vadd_vf_vf_vf(vf2getx_vf_vf2(d), vf2gety_vf_vf2(d)), vcast_vf_f(0.5));
+
+  y = vsel_vf_vo_vf_vf(vor_vo_vo_vo(vgt_vo_vf_vf(vabs_vf_vf(x), vcast_vf_f(89)),
+        visnan_vo_vf(y)), vcast_vf_f(__builtin_inff()), y);
+  y = vreinterpret_vf_vm(vor_vm_vo32_vm(visnan_vo_vf(x), vreinterpret_vm_vf(y)));
+
+  return y;
+}
+
+SLEEF_INLINE SLEEF_CONST vfloat Sleef_tanhf4_u10avx2128(vfloat x) {
+  vfloat y = vabs_vf_vf(x);
+  vfloat2 d = expk2f(vcast_vf2_vf_vf(y, vcast_vf_f(0)));
+  vfloat2 e = dfrec_vf2_vf2(d);
+  d = dfdiv_vf2_vf2_vf2(dfadd_vf2_vf2_vf2(d, dfneg_vf2_vf2(e)), dfadd_vf2_vf2_vf2(d, e));
+  y = vadd_vf_vf_vf(vf2getx_vf_vf2(d), vf2gety_vf_vf2(d));
+
+  y = vsel_vf_vo_vf_vf(vor_vo_vo_vo(vgt_vo_vf_vf(vabs_vf_vf(x), vcast_vf_f(8.664339742f)),
+        visnan_vo_vf(y)), vcast_vf_f(1.0f), y);
+  y = vmulsign_vf_vf_vf(y, x);
+  y = vreinterpret_vf_vm(vor_vm_vo32_vm(visnan_vo_vf(x), vreinterpret_vm_vf(y)));
+
+  return y;
+}
+
+SLEEF_INLINE SLEEF_CONST vfloat Sleef_sinhf4_u35avx2128(vfloat x) {
+  vfloat e = expm1fk(vabs_vf_vf(x));
+  vfloat y = vdiv_vf_vf_vf(vadd_vf_vf_vf(e, vcast_vf_f(2)), vadd_vf_vf_vf(e, vcast_vf_f(1)));
+  y = vmul_vf_vf_vf(y, vmul_vf_vf_vf(vcast_vf_f(0.5f), e));
+
+  y = vsel_vf_vo_vf_vf(vor_vo_vo_vo(vgt_vo_vf_vf(vabs_vf_vf(x), vcast_vf_f(88)),
+        visnan_vo_vf(y)), vcast_vf_f(__builtin_inff()), y);
+  y = vmulsign_vf_vf_vf(y, x);
+  y = vreinterpret_vf_vm(vor_vm_vo32_vm(visnan_vo_vf(x), vreinterpret_vm_vf(y)));
+
+  return y;
+}
+
+SLEEF_INLINE SLEEF_CONST vfloat Sleef_coshf4_u35avx2128(vfloat x) {
+  vfloat e = Sleef_expf4_u10avx2128(vabs_vf_vf(x));
+  vfloat y = vmla_vf_vf_vf_vf(vcast_vf_f(0.5f), e, vdiv_vf_vf_vf(vcast_vf_f(0.5), e));
+
+  y = vsel_vf_vo_vf_vf(vor_vo_vo_vo(vgt_vo_vf_vf(vabs_vf_vf(x), vcast_vf_f(88)),
+        visnan_vo_vf(y)), vcast_vf_f(__builtin_inff()), y);
+  y = vreinterpret_vf_vm(vor_vm_vo32_vm(visnan_vo_vf(x), vreinterpret_vm_vf(y)));
+
+  return y;
+}
+
+SLEEF_INLINE SLEEF_CONST vfloat Sleef_tanhf4_u35avx2128(vfloat x) {
+  vfloat d = expm1fk(vmul_vf_vf_vf(vcast_vf_f(2), vabs_vf_vf(x)));
+  vfloat y = vdiv_vf_vf_vf(d, vadd_vf_vf_vf(vcast_vf_f(2), d));
+
+  y = vsel_vf_vo_vf_vf(vor_vo_vo_vo(vgt_vo_vf_vf(vabs_vf_vf(x), vcast_vf_f(8.664339742f)),
+        visnan_vo_vf(y)), vcast_vf_f(1.0f), y);
+  y = vmulsign_vf_vf_vf(y, x);
+  y = vreinterpret_vf_vm(vor_vm_vo32_vm(visnan_vo_vf(x), vreinterpret_vm_vf(y)));
+
+  return y;
+}
+
+
+static SLEEF_ALWAYS_INLINE SLEEF_CONST vfloat2 logk2f(vfloat2 d) {
+  vfloat2 x, x2, m, s;
+  vfloat t;
+  vint2 e;
+
+
+  e = vilogbk_vi2_vf(vmul_vf_vf_vf(vf2getx_vf_vf2(d), vcast_vf_f(1.0f/0.75f)));
+
+
+
+  m = dfscale_vf2_vf2_vf(d, vpow2i_vf_vi2(vneg_vi2_vi2(e)));
+
+  x = dfdiv_vf2_vf2_vf2(dfadd2_vf2_vf2_vf(m, vcast_vf_f(-1)), dfadd2_vf2_vf2_vf(m, vcast_vf_f(1)));
+  x2 = dfsqu_vf2_vf2(x);
+
+  t = vcast_vf_f(0.2392828464508056640625f);
+  t = vmla_vf_vf_vf_vf(t, vf2getx_vf_vf2(x2), vcast_vf_f(0.28518211841583251953125f));
+  t = vmla_vf_vf_vf_vf(t, vf2getx_vf_vf2(x2), vcast_vf_f(0.400005877017974853515625f));
+  t = vmla_vf_vf_vf_vf(t, vf2getx_vf_vf2(x2), vcast_vf_f(0.666666686534881591796875f));
+
+  s = dfmul_vf2_vf2_vf(vcast_vf2_vf_vf(vcast_vf_f(0.69314718246459960938f), vcast_vf_f(-1.904654323148236017e-09f)), vcast_vf_vi2(e));
+  s = dfadd_vf2_vf2_vf2(s, dfscale_vf2_vf2_vf(x, vcast_vf_f(2)));
+  s = dfadd_vf2_vf2_vf2(s, dfmul_vf2_vf2_vf(dfmul_vf2_vf2_vf2(x2, x), t));
+
+  return s;
+}
+
+
+SLEEF_INLINE SLEEF_CONST vfloat Sleef_asinhf4_u10avx2128(vfloat x) {
+  vfloat y = vabs_vf_vf(x);
+  vopmask o = vgt_vo_vf_vf(y, vcast_vf_f(1));
+  vfloat2 d;
+
+  d = vsel_vf2_vo_vf2_vf2(o, dfrec_vf2_vf(x), vcast_vf2_vf_vf(y, vcast_vf_f(0)));
+  d = dfsqrt_vf2_vf2(dfadd2_vf2_vf2_vf(dfsqu_vf2_vf2(d), vcast_vf_f(1)));
+  d = vsel_vf2_vo_vf2_vf2(o, dfmul_vf2_vf2_vf(d, y), d);
+
+  d = logk2f(dfnormalize_vf2_vf2(dfadd2_vf2_vf2_vf(d, x)));
+  y = vadd_vf_vf_vf(vf2getx_vf_vf2(d), vf2gety_vf_vf2(d));
+
+  y = vsel_vf_vo_vf_vf(vor_vo_vo_vo(vgt_vo_vf_vf(vabs_vf_vf(x), vcast_vf_f(18446743523953729536.0)),
+        visnan_vo_vf(y)),
+         vmulsign_vf_vf_vf(vcast_vf_f(__builtin_inff()), x), y);
+  y = vreinterpret_vf_vm(vor_vm_vo32_vm(visnan_vo_vf(x), vreinterpret_vm_vf(y)));
+  y = vsel_vf_vo_vf_vf(visnegzero_vo_vf(x), vcast_vf_f(-0.0), y);
+
+  return y;
+}
+
+SLEEF_INLINE SLEEF_CONST vfloat Sleef_acoshf4_u10avx2128(vfloat x) {
+  vfloat2 d = logk2f(dfadd2_vf2_vf2_vf(dfmul_vf2_vf2_vf2(dfsqrt_vf2_vf2(dfadd2_vf2_vf_vf(x, vcast_vf_f(1))), dfsqrt_vf2_vf2(dfadd2_vf2_vf_vf(x, vcast_vf_f(-1)))), x));
+  vfloat y = vadd_vf_vf_vf(vf2getx_vf_vf2(d), vf2gety_vf_vf2(d));
+
+  y = vsel_vf_vo_vf_vf(vor_vo_vo_vo(vgt_vo_vf_vf(vabs_vf_vf(x), vcast_vf_f(18446743523953729536.0)),
+        visnan_vo_vf(y)),
+         vcast_vf_f(__builtin_inff()), y);
+
+  y = vreinterpret_vf_vm(vandnot_vm_vo32_vm(veq_vo_vf_vf(x, vcast_vf_f(1.0f)), vreinterpret_vm_vf(y)));
+
+  y = vreinterpret_vf_vm(vor_vm_vo32_vm(vlt_vo_vf_vf(x, vcast_vf_f(1.0f)), vreinterpret_vm_vf(y)));
+  y = vreinterpret_vf_vm(vor_vm_vo32_vm(visnan_vo_vf(x), vreinterpret_vm_vf(y)));
+
+  return y;
+}
+
+SLEEF_INLINE SLEEF_CONST vfloat Sleef_atanhf4_u10avx2128(vfloat x) {
+  vfloat y = vabs_vf_vf(x);
+  vfloat2 d = logk2f(dfdiv_vf2_vf2_vf2(dfadd2_vf2_vf_vf(vcast_vf_f(1), y), dfadd2_vf2_vf_vf(vcast_vf_f(1), vneg_vf_vf(y))));
+  y = vreinterpret_vf_vm(vor_vm_vo32_vm(vgt_vo_vf_vf(y, vcast_vf_f(1.0)), vreinterpret_vm_vf(vsel_vf_vo_vf_vf(veq_vo_vf_vf(y, vcast_vf_f(1.0)), vcast_vf_f(__builtin_inff()), vmul_vf_vf_vf(vadd_vf_vf_vf(vf2getx_vf_vf2(d), vf2gety_vf_vf2(d)), vcast_vf_f(0.5))))));
+
+  y = vreinterpret_vf_vm(vor_vm_vo32_vm(vor_vo_vo_vo(visinf_vo_vf(x), visnan_vo_vf(y)), vreinterpret_vm_vf(y)));
+  y = vmulsign_vf_vf_vf(y, x);
+  y = vreinterpret_vf_vm(vor_vm_vo32_vm(visnan_vo_vf(x), vreinterpret_vm_vf(y)));
+
+  return y;
+}
+
+
+
+SLEEF_INLINE SLEEF_CONST vfloat Sleef_exp2f4_u10avx2128(vfloat d) {
+  vfloat u = vrint_vf_vf(d), s;
+  vint2 q = vrint_vi2_vf(u);
+
+  s = vsub_vf_vf_vf(d, u);
+
+  u = vcast_vf_f(+0.1535920892e-3);
+  u = vmla_vf_vf_vf_vf(u, s, vcast_vf_f(+0.1339262701e-2));
+  u = vmla_vf_vf_vf_vf(u, s, vcast_vf_f(+0.9618384764e-2));
+  u = vmla_vf_vf_vf_vf(u, s, vcast_vf_f(+0.5550347269e-1));
+  u = vmla_vf_vf_vf_vf(u, s, vcast_vf_f(+0.2402264476e+0));
+  u = vmla_vf_vf_vf_vf(u, s, vcast_vf_f(+0.6931471825e+0));
+
+
+  u = vfma_vf_vf_vf_vf(u, s, vcast_vf_f(1));
+
+
+
+
+  u = vldexp2_vf_vf_vi2(u, q);
+
+  u = vsel_vf_vo_vf_vf(vge_vo_vf_vf(d, vcast_vf_f(128)), vcast_vf_f(__builtin_inf()), u);
+  u = vreinterpret_vf_vm(vandnot_vm_vo32_vm(vlt_vo_vf_vf(d, vcast_vf_f(-150)), vreinterpret_vm_vf(u)));
+
+  return u;
+}
+
+SLEEF_INLINE SLEEF_CONST vfloat Sleef_exp2f4_u35avx2128(vfloat d) {
+  vfloat u = vrint_vf_vf(d), s;
+  vint2 q = vrint_vi2_vf(u);
+
+  s = vsub_vf_vf_vf(d, u);
+
+  u = vcast_vf_f(+0.1535920892e-3);
+  u = vmla_vf_vf_vf_vf(u, s, vcast_vf_f(+0.1339262701e-2));
+  u = vmla_vf_vf_vf_vf(u, s, vcast_vf_f(+0.9618384764e-2));
+  u = vmla_vf_vf_vf_vf(u, s, vcast_vf_f(+0.5550347269e-1));
+  u = vmla_vf_vf_vf_vf(u, s, vcast_vf_f(+0.2402264476e+0));
+  u = vmla_vf_vf_vf_vf(u, s, vcast_vf_f(+0.6931471825e+0));
+  u = vmla_vf_vf_vf_vf(u, s, vcast_vf_f(+0.1000000000e+1));
+
+  u = vldexp2_vf_vf_vi2(u, q);
+
+  u = vsel_vf_vo_vf_vf(vge_vo_vf_vf(d, vcast_vf_f(128)), vcast_vf_f(__builtin_inf()), u);
+  u = vreinterpret_vf_vm(vandnot_vm_vo32_vm(vlt_vo_vf_vf(d, vcast_vf_f(-150)), vreinterpret_vm_vf(u)));
+
+  return u;
+}
+
+SLEEF_INLINE SLEEF_CONST vfloat Sleef_exp10f4_u10avx2128(vfloat d) {
+  vfloat u = vrint_vf_vf(vmul_vf_vf_vf(d, vcast_vf_f(3.3219280948873623478703194294893901758648313930))), s;
+  vint2 q = vrint_vi2_vf(u);
+
+  s = vmla_vf_vf_vf_vf(u, vcast_vf_f(-0.3010253906f), d);
+  s = vmla_vf_vf_vf_vf(u, vcast_vf_f(-4.605038981e-06f), s);
+
+  u = vcast_vf_f(+0.6802555919e-1);
+  u = vmla_vf_vf_vf_vf(u, s, vcast_vf_f(+0.2078080326e+0));
+  u = vmla_vf_vf_vf_vf(u, s, vcast_vf_f(+0.5393903852e+0));
+  u = vmla_vf_vf_vf_vf(u, s, vcast_vf_f(+0.1171245337e+1));
+  u = vmla_vf_vf_vf_vf(u, s, vcast_vf_f(+0.2034678698e+1));
+  u = vmla_vf_vf_vf_vf(u, s, vcast_vf_f(+0.2650949001e+1));
+  vfloat2 x = dfadd_vf2_vf2_vf(vcast_vf2_f_f(2.3025851249694824219, -3.1705172516493593157e-08), vmul_vf_vf_vf(u, s));
+  u = vf2getx_vf_vf2(dfnormalize_vf2_vf2(dfadd_vf2_vf_vf2(vcast_vf_f(1), dfmul_vf2_vf2_vf(x, s))));
+
+  u = vldexp2_vf_vf_vi2(u, q);
+
+  u = vsel_vf_vo_vf_vf(vgt_vo_vf_vf(d, vcast_vf_f(38.5318394191036238941387f)), vcast_vf_f(__builtin_inff()), u);
+  u = vreinterpret_vf_vm(vandnot_vm_vo32_vm(vlt_vo_vf_vf(d, vcast_vf_f(-50)), vreinterpret_vm_vf(u)));
+
+  return u;
+}
+
+SLEEF_INLINE SLEEF_CONST vfloat Sleef_exp10f4_u35avx2128(vfloat d) {
+  vfloat u = vrint_vf_vf(vmul_vf_vf_vf(d, vcast_vf_f(3.3219280948873623478703194294893901758648313930))), s;
+  vint2 q = vrint_vi2_vf(u);
+
+  s = vmla_vf_vf_vf_vf(u, vcast_vf_f(-0.3010253906f), d);
+  s = vmla_vf_vf_vf_vf(u, vcast_vf_f(-4.605038981e-06f), s);
+
+  u = vcast_vf_f(+0.2064004987e+0);
+  u = vmla_vf_vf_vf_vf(u, s, vcast_vf_f(+0.5417877436e+0));
+  u = vmla_vf_vf_vf_vf(u, s, vcast_vf_f(+0.1171286821e+1));
+  u = vmla_vf_vf_vf_vf(u, s, vcast_vf_f(+0.2034656048e+1));
+  u = vmla_vf_vf_vf_vf(u, s, vcast_vf_f(+0.2650948763e+1));
+  u = vmla_vf_vf_vf_vf(u, s, vcast_vf_f(+0.2302585125e+1));
+  u = vmla_vf_vf_vf_vf(u, s, vcast_vf_f(+0.1000000000e+1));
+
+  u = vldexp2_vf_vf_vi2(u, q);
+
+  u = vsel_vf_vo_vf_vf(vgt_vo_vf_vf(d, vcast_vf_f(38.5318394191036238941387f)), vcast_vf_f(__builtin_inff()), u);
+  u = vreinterpret_vf_vm(vandnot_vm_vo32_vm(vlt_vo_vf_vf(d, vcast_vf_f(-50)), vreinterpret_vm_vf(u)));
+
+  return u;
+}
+
+SLEEF_INLINE SLEEF_CONST vfloat Sleef_expm1f4_u10avx2128(vfloat a) {
+  vfloat2 d = dfadd2_vf2_vf2_vf(expk2f(vcast_vf2_vf_vf(a, vcast_vf_f(0))), vcast_vf_f(-1.0));
+  vfloat x = vadd_vf_vf_vf(vf2getx_vf_vf2(d), vf2gety_vf_vf2(d));
+  x = vsel_vf_vo_vf_vf(vgt_vo_vf_vf(a, vcast_vf_f(88.72283172607421875f)), vcast_vf_f(__builtin_inff()), x);
+  x = vsel_vf_vo_vf_vf(vlt_vo_vf_vf(a, vcast_vf_f(-16.635532333438687426013570f)), vcast_vf_f(-1), x);
+  x = vsel_vf_vo_vf_vf(visnegzero_vo_vf(a), vcast_vf_f(-0.0f), x);
+  return x;
+}
+
+
+
+SLEEF_INLINE SLEEF_CONST vfloat Sleef_log10f4_u10avx2128(vfloat d) {
+  vfloat2 x;
+  vfloat t, m, x2;
+
+
+  vopmask o = vlt_vo_vf_vf(d, vcast_vf_f(0x1p-126));
+  d = vsel_vf_vo_vf_vf(o, vmul_vf_vf_vf(d, vcast_vf_f((float)(INT64_C(1) << 32) * (float)(INT64_C(1) << 32))), d);
+  vint2 e = vilogb2k_vi2_vf(vmul_vf_vf_vf(d, vcast_vf_f(1.0/0.75)));
+  m = vldexp3_vf_vf_vi2(d, vneg_vi2_vi2(e));
+  e = vsel_vi2_vo_vi2_vi2(o, vsub_vi2_vi2_vi2(e, vcast_vi2_i(64)), e);
+
+
+
+
+
+
+  x = dfdiv_vf2_vf2_vf2(dfadd2_vf2_vf_vf(vcast_vf_f(-1), m), dfadd2_vf2_vf_vf(vcast_vf_f(1), m));
+  x2 = vmul_vf_vf_vf(vf2getx_vf_vf2(x), vf2getx_vf_vf2(x));
+
+  t = vcast_vf_f(+0.1314289868e+0);
+  t = vmla_vf_vf_vf_vf(t, x2, vcast_vf_f( +0.1735493541e+0));
+  t = vmla_vf_vf_vf_vf(t, x2, vcast_vf_f( +0.2895309627e+0));
+
+
+  vfloat2 s = dfmul_vf2_vf2_vf(vcast_vf2_f_f(0.30103001, -1.432098889e-08), vcast_vf_vi2(e));
+
+
+
+
+  s = dfadd_vf2_vf2_vf2(s, dfmul_vf2_vf2_vf2(x, vcast_vf2_f_f(0.868588984, -2.170757285e-08)));
+  s = dfadd_vf2_vf2_vf(s, vmul_vf_vf_vf(vmul_vf_vf_vf(x2, vf2getx_vf_vf2(x)), t));
+
+  vfloat r = vadd_vf_vf_vf(vf2getx_vf_vf2(s), vf2gety_vf_vf2(s));
+
+
+  r = vsel_vf_vo_vf_vf(vispinf_vo_vf(d), vcast_vf_f(__builtin_inf()), r);
+  r = vsel_vf_vo_vf_vf(vor_vo_vo_vo(vlt_vo_vf_vf(d, vcast_vf_f(0)), visnan_vo_vf(d)), vcast_vf_f(__builtin_nan("")), r);
+  r = vsel_vf_vo_vf_vf(veq_vo_vf_vf(d, vcast_vf_f(0)), vcast_vf_f(-__builtin_inf()), r);
+
+
+
+
+  return r;
+}
+
+SLEEF_INLINE SLEEF_CONST vfloat Sleef_log2f4_u10avx2128(vfloat d) {
+  vfloat2 x;
+  vfloat t, m, x2;
+
+
+  vopmask o = vlt_vo_vf_vf(d, vcast_vf_f(0x1p-126));
+  d = vsel_vf_vo_vf_vf(o, vmul_vf_vf_vf(d, vcast_vf_f((float)(INT64_C(1) << 32) * (float)(INT64_C(1) << 32))), d);
+  vint2 e = vilogb2k_vi2_vf(vmul_vf_vf_vf(d, vcast_vf_f(1.0/0.75)));
+  m = vldexp3_vf_vf_vi2(d, vneg_vi2_vi2(e));
+  e = vsel_vi2_vo_vi2_vi2(o, vsub_vi2_vi2_vi2(e, vcast_vi2_i(64)), e);
+
+
+
+
+
+
+  x = dfdiv_vf2_vf2_vf2(dfadd2_vf2_vf_vf(vcast_vf_f(-1), m), dfadd2_vf2_vf_vf(vcast_vf_f(1), m));
+  x2 = vmul_vf_vf_vf(vf2getx_vf_vf2(x), vf2getx_vf_vf2(x));
+
+  t = vcast_vf_f(+0.4374550283e+0f);
+  t = vmla_vf_vf_vf_vf(t, x2, vcast_vf_f(+0.5764790177e+0f));
+  t = vmla_vf_vf_vf_vf(t, x2, vcast_vf_f(+0.9618012905120f));
+
+
+  vfloat2 s = dfadd2_vf2_vf_vf2(vcast_vf_vi2(e),
+    dfmul_vf2_vf2_vf2(x, vcast_vf2_f_f(2.8853900432586669922, 3.2734474483568488616e-08)));
+
+
+
+
+
+  s = dfadd2_vf2_vf2_vf(s, vmul_vf_vf_vf(vmul_vf_vf_vf(x2, vf2getx_vf_vf2(x)), t));
+
+  vfloat r = vadd_vf_vf_vf(vf2getx_vf_vf2(s), vf2gety_vf_vf2(s));
+
+
+  r = vsel_vf_vo_vf_vf(vispinf_vo_vf(d), vcast_vf_f(__builtin_inf()), r);
+  r = vsel_vf_vo_vf_vf(vor_vo_vo_vo(vlt_vo_vf_vf(d, vcast_vf_f(0)), visnan_vo_vf(d)), vcast_vf_f(__builtin_nan("")), r);
+  r = vsel_vf_vo_vf_vf(veq_vo_vf_vf(d, vcast_vf_f(0)), vcast_vf_f(-__builtin_inf()), r);
+
+
+
+
+  return r;
+}
+
+SLEEF_INLINE SLEEF_CONST vfloat Sleef_log2f4_u35avx2128(vfloat d) {
+  vfloat m, t, x, x2;
+
+
+  vopmask o = vlt_vo_vf_vf(d, vcast_vf_f(0x1p-126));
+  d = vsel_vf_vo_vf_vf(o, vmul_vf_vf_vf(d, vcast_vf_f((float)(INT64_C(1) << 32) * (float)(INT64_C(1) << 32))), d);
+  vint2 e = vilogb2k_vi2_vf(vmul_vf_vf_vf(d, vcast_vf_f(1.0/0.75)));
+  m = vldexp3_vf_vf_vi2(d, vneg_vi2_vi2(e));
+  e = vsel_vi2_vo_vi2_vi2(o, vsub_vi2_vi2_vi2(e, vcast_vi2_i(64)), e);
+
+
+
+
+
+
+  x = vdiv_vf_vf_vf(vsub_vf_vf_vf(m, vcast_vf_f(1)), vadd_vf_vf_vf(m, vcast_vf_f(1)));
+  x2 = vmul_vf_vf_vf(x, x);
+
+  t = vcast_vf_f(+0.4374088347e+0);
+  t = vmla_vf_vf_vf_vf(t, x2, vcast_vf_f(+0.5764843822e+0));
+  t = vmla_vf_vf_vf_vf(t, x2, vcast_vf_f(+0.9618024230e+0));
+
+
+  vfloat r = vmla_vf_vf_vf_vf(vmul_vf_vf_vf(x2, x), t,
+         vmla_vf_vf_vf_vf(x, vcast_vf_f(+0.2885390043e+1), vcast_vf_vi2(e)));
+
+  r = vsel_vf_vo_vf_vf(vispinf_vo_vf(d), vcast_vf_f(__builtin_inf()), r);
+  r = vsel_vf_vo_vf_vf(vor_vo_vo_vo(vlt_vo_vf_vf(d, vcast_vf_f(0)), visnan_vo_vf(d)), vcast_vf_f(__builtin_nan("")), r);
+  r = vsel_vf_vo_vf_vf(veq_vo_vf_vf(d, vcast_vf_f(0)), vcast_vf_f(-__builtin_inf()), r);
+
+
+
+
+
+
+
+  return r;
+}
+
+SLEEF_INLINE SLEEF_CONST vfloat Sleef_log1pf4_u10avx2128(vfloat d) {
+  vfloat2 x;
+  vfloat t, m, x2;
+
+  vfloat dp1 = vadd_vf_vf_vf(d, vcast_vf_f(1));
+
+
+  vopmask o = vlt_vo_vf_vf(dp1, vcast_vf_f(0x1p-126));
+  dp1 = vsel_vf_vo_vf_vf(o, vmul_vf_vf_vf(dp1, vcast_vf_f((float)(INT64_C(1) << 32) * (float)(INT64_C(1) << 32))), dp1);
+  vint2 e = vilogb2k_vi2_vf(vmul_vf_vf_vf(dp1, vcast_vf_f(1.0f/0.75f)));
+  t = vldexp3_vf_vf_vi2(vcast_vf_f(1), vneg_vi2_vi2(e));
+  m = vmla_vf_vf_vf_vf(d, t, vsub_vf_vf_vf(t, vcast_vf_f(1)));
+  e = vsel_vi2_vo_vi2_vi2(o, vsub_vi2_vi2_vi2(e, vcast_vi2_i(64)), e);
+  vfloat2 s = dfmul_vf2_vf2_vf(vcast_vf2_f_f(0.69314718246459960938f, -1.904654323148236017e-09f), vcast_vf_vi2(e));
+
+  x = dfdiv_vf2_vf2_vf2(vcast_vf2_vf_vf(m, vcast_vf_f(0)), dfadd_vf2_vf_vf(vcast_vf_f(2), m));
+  x2 = vmul_vf_vf_vf(vf2getx_vf_vf2(x), vf2getx_vf_vf2(x));
+
+  t = vcast_vf_f(+0.3027294874e+0f);
+  t = vmla_vf_vf_vf_vf(t, x2, vcast_vf_f(+0.3996108174e+0f));
+  t = vmla_vf_vf_vf_vf(t, x2, vcast_vf_f(+0.6666694880e+0f));
+
+  s = dfadd_vf2_vf2_vf2(s, dfscale_vf2_vf2_vf(x, vcast_vf_f(2)));
+  s = dfadd_vf2_vf2_vf(s, vmul_vf_vf_vf(vmul_vf_vf_vf(x2, vf2getx_vf_vf2(x)), t));
+
+  vfloat r = vadd_vf_vf_vf(vf2getx_vf_vf2(s), vf2gety_vf_vf2(s));
+
+  r = vsel_vf_vo_vf_vf(vgt_vo_vf_vf(d, vcast_vf_f(1e+38)), vcast_vf_f(__builtin_inff()), r);
+  r = vreinterpret_vf_vm(vor_vm_vo32_vm(vgt_vo_vf_vf(vcast_vf_f(-1), d), vreinterpret_vm_vf(r)));
+  r = vsel_vf_vo_vf_vf(veq_vo_vf_vf(d, vcast_vf_f(-1)), vcast_vf_f(-__builtin_inff()), r);
+  r = vsel_vf_vo_vf_vf(visnegzero_vo_vf(d), vcast_vf_f(-0.0f), r);
+
+  return r;
+}
+
+
+//
+
+
+SLEEF_INLINE SLEEF_CONST vfloat Sleef_fabsf4_avx2128(vfloat x) { return vabs_vf_vf(x); }
+
+SLEEF_INLINE SLEEF_CONST vfloat Sleef_copysignf4_avx2128(vfloat x, vfloat y) { return vcopysign_vf_vf_vf(x, y); }
+
+SLEEF_INLINE SLEEF_CONST vfloat Sleef_fmaxf4_avx2128(vfloat x, vfloat y) {
+
+  return vsel_vf_vo_vf_vf(visnan_vo_vf(y), x, vmax_vf_vf_vf(x, y));
+
+
+
+}
+
+SLEEF_INLINE SLEEF_CONST vfloat Sleef_fminf4_avx2128(vfloat x, vfloat y) {
+
+  return vsel_vf_vo_vf_vf(visnan_vo_vf(y), x, vmin_vf_vf_vf(x, y));
+
+
+
+}
+
+SLEEF_INLINE SLEEF_CONST vfloat Sleef_fdimf4_avx2128(vfloat x, vfloat y) {
+  vfloat ret = vsub_vf_vf_vf(x, y);
+  ret = vsel_vf_vo_vf_vf(vor_vo_vo_vo(vlt_vo_vf_vf(ret, vcast_vf_f(0)), veq_vo_vf_vf(x, y)), vcast_vf_f(0), ret);
+  return ret;
+}
+
+SLEEF_INLINE SLEEF_CONST vfloat Sleef_truncf4_avx2128(vfloat x) {
+
+  return vtruncate_vf_vf(x);
+
+
+
+
+}
+
+SLEEF_INLINE SLEEF_CONST vfloat Sleef_floorf4_avx2128(vfloat x) {
+  vfloat fr = vsub_vf_vf_vf(x, vcast_vf_vi2(vtruncate_vi2_vf(x)));
+  fr = vsel_vf_vo_vf_vf(vlt_vo_vf_vf(fr, vcast_vf_f(0)), vadd_vf_vf_vf(fr, vcast_vf_f(1.0f)), fr);
+  return vsel_vf_vo_vf_vf(vor_vo_vo_vo(visinf_vo_vf(x), vge_vo_vf_vf(vabs_vf_vf(x), vcast_vf_f(INT64_C(1) << 23))), x, vcopysign_vf_vf_vf(vsub_vf_vf_vf(x, fr), x));
+}
+
+SLEEF_INLINE SLEEF_CONST vfloat Sleef_ceilf4_avx2128(vfloat x) {
+  vfloat fr = vsub_vf_vf_vf(x, vcast_vf_vi2(vtruncate_vi2_vf(x)));
+  fr = vsel_vf_vo_vf_vf(vle_vo_vf_vf(fr, vcast_vf_f(0)), fr, vsub_vf_vf_vf(fr, vcast_vf_f(1.0f)));
+  return vsel_vf_vo_vf_vf(vor_vo_vo_vo(visinf_vo_vf(x), vge_vo_vf_vf(vabs_vf_vf(x), vcast_vf_f(INT64_C(1) << 23))), x, vcopysign_vf_vf_vf(vsub_vf_vf_vf(x, fr), x));
+}
+
+SLEEF_INLINE SLEEF_CONST vfloat Sleef_roundf4_avx2128(vfloat d) {
+  vfloat x = vadd_vf_vf_vf(d, vcast_vf_f(0.5f));
+  vfloat fr = vsub_vf_vf_vf(x, vcast_vf_vi2(vtruncate_vi2_vf(x)));
+  x = vsel_vf_vo_vf_vf(vand_vo_vo_vo(vle_vo_vf_vf(x, vcast_vf_f(0)), veq_vo_vf_vf(fr, vcast_vf_f(0))), vsub_vf_vf_vf(x, vcast_vf_f(1.0f)), x);
+  fr = vsel_vf_vo_vf_vf(vlt_vo_vf_vf(fr, vcast_vf_f(0)), vadd_vf_vf_vf(fr, vcast_vf_f(1.0f)), fr);
+  x = vsel_vf_vo_vf_vf(veq_vo_vf_vf(d, vcast_vf_f(0.4999999701976776123f)), vcast_vf_f(0), x);
+  return vsel_vf_vo_vf_vf(vor_vo_vo_vo(visinf_vo_vf(d), vge_vo_vf_vf(vabs_vf_vf(d), vcast_vf_f(INT64_C(1) << 23))), d, vcopysign_vf_vf_vf(vsub_vf_vf_vf(x, fr), d));
+}
+
+SLEEF_INLINE SLEEF_CONST vfloat Sleef_rintf4_avx2128(vfloat d) {
+
+  return vrint_vf_vf(d);
+
+
+
+
+
+}
+
+SLEEF_INLINE SLEEF_CONST vfloat Sleef_fmaf4_avx2128(vfloat x, vfloat y, vfloat z) {
+
+  return vfma_vf_vf_vf_vf(x, y, z);
+
+}
+
+
+SLEEF_INLINE vfloat Sleef_sqrtf4_u05avx2128(vfloat d) {
+
+  vfloat q, w, x, y, z;
+
+  d = vsel_vf_vo_vf_vf(vlt_vo_vf_vf(d, vcast_vf_f(0)), vcast_vf_f(__builtin_nanf("")), d);
+
+  vopmask o = vlt_vo_vf_vf(d, vcast_vf_f(5.2939559203393770e-23f));
+  d = vsel_vf_vo_vf_vf(o, vmul_vf_vf_vf(d, vcast_vf_f(1.8889465931478580e+22f)), d);
+  q = vsel_vf_vo_vf_vf(o, vcast_vf_f(7.2759576141834260e-12f), vcast_vf_f(1.0f));
+
+  y = vreinterpret_vf_vi2(vsub_vi2_vi2_vi2(vcast_vi2_i(0x5f3759df), vsrl_vi2_vi2_i(vreinterpret_vi2_vf(d), 1)));
+
+  x = vmul_vf_vf_vf(d, y); w = vmul_vf_vf_vf(vcast_vf_f(0.5), y);
+  y = vfmanp_vf_vf_vf_vf(x, w, vcast_vf_f(0.5));
+  x = vfma_vf_vf_vf_vf(x, y, x); w = vfma_vf_vf_vf_vf(w, y, w);
+  y = vfmanp_vf_vf_vf_vf(x, w, vcast_vf_f(0.5));
+  x = vfma_vf_vf_vf_vf(x, y, x); w = vfma_vf_vf_vf_vf(w, y, w);
+
+  y = vfmanp_vf_vf_vf_vf(x, w, vcast_vf_f(1.5)); w = vadd_vf_vf_vf(w, w);
+  w = vmul_vf_vf_vf(w, y);
+  x = vmul_vf_vf_vf(w, d);
+  y = vfmapn_vf_vf_vf_vf(w, d, x); z = vfmanp_vf_vf_vf_vf(w, x, vcast_vf_f(1));
+
+  z = vfmanp_vf_vf_vf_vf(w, y, z); w = vmul_vf_vf_vf(vcast_vf_f(0.5), x);
+  w = vfma_vf_vf_vf_vf(w, z, y);
+  w = vadd_vf_vf_vf(w, x);
+
+  w = vmul_vf_vf_vf(w, q);
+
+  w = vsel_vf_vo_vf_vf(vor_vo_vo_vo(veq_vo_vf_vf(d, vcast_vf_f(0)),
+        veq_vo_vf_vf(d, vcast_vf_f(__builtin_inff()))), d, w);
+
+  w = vsel_vf_vo_vf_vf(vlt_vo_vf_vf(d, vcast_vf_f(0)), vcast_vf_f(__builtin_nanf("")), w);
+
+  return w;
+
+}
+
+SLEEF_INLINE SLEEF_CONST vfloat Sleef_sqrtf4_avx2128(vfloat d) {
+
+  return vsqrt_vf_vf(d);
+
+
+
+
+}
+
+
+SLEEF_INLINE SLEEF_CONST vfloat Sleef_hypotf4_u05avx2128(vfloat x, vfloat y) {
+  x = vabs_vf_vf(x);
+  y = vabs_vf_vf(y);
+  vfloat min = vmin_vf_vf_vf(x, y), n = min;
+  vfloat max = vmax_vf_vf_vf(x, y), d = max;
+
+  vopmask o = vlt_vo_vf_vf(max, vcast_vf_f(0x1p-126));
+  n = vsel_vf_vo_vf_vf(o, vmul_vf_vf_vf(n, vcast_vf_f(UINT64_C(1) << 24)), n);
+  d = vsel_vf_vo_vf_vf(o, vmul_vf_vf_vf(d, vcast_vf_f(UINT64_C(1) << 24)), d);
+
+  vfloat2 t = dfdiv_vf2_vf2_vf2(vcast_vf2_vf_vf(n, vcast_vf_f(0)), vcast_vf2_vf_vf(d, vcast_vf_f(0)));
+  t = dfmul_vf2_vf2_vf(dfsqrt_vf2_vf2(dfadd2_vf2_vf2_vf(dfsqu_vf2_vf2(t), vcast_vf_f(1))), max);
+  vfloat ret = vadd_vf_vf_vf(vf2getx_vf_vf2(t), vf2gety_vf_vf2(t));
+  ret = vsel_vf_vo_vf_vf(visnan_vo_vf(ret), vcast_vf_f(__builtin_inff()), ret);
+  ret = vsel_vf_vo_vf_vf(veq_vo_vf_vf(min, vcast_vf_f(0)), max, ret);
+  ret = vsel_vf_vo_vf_vf(vor_vo_vo_vo(visnan_vo_vf(x), visnan_vo_vf(y)), vcast_vf_f(__builtin_nanf("")), ret);
+  ret = vsel_vf_vo_vf_vf(vor_vo_vo_vo(veq_vo_vf_vf(x, vcast_vf_f(__builtin_inff())), veq_vo_vf_vf(y, vcast_vf_f(__builtin_inff()))), vcast_vf_f(__builtin_inff()), ret);
+
+  return ret;
+}
+
+SLEEF_INLINE SLEEF_CONST vfloat Sleef_hypotf4_u35avx2128(vfloat x, vfloat y) {
+  x = vabs_vf_vf(x);
+  y = vabs_vf_vf(y);
+  vfloat min = vmin_vf_vf_vf(x, y);
+  vfloat max = vmax_vf_vf_vf(x, y);
+
+  vfloat t = vdiv_vf_vf_vf(min, max);
+  vfloat ret = vmul_vf_vf_vf(max, vsqrt_vf_vf(vmla_vf_vf_vf_vf(t, t, vcast_vf_f(1))));
+  ret = vsel_vf_vo_vf_vf(veq_vo_vf_vf(min, vcast_vf_f(0)), max, ret);
+  ret = vsel_vf_vo_vf_vf(vor_vo_vo_vo(visnan_vo_vf(x), visnan_vo_vf(y)), vcast_vf_f(__builtin_nanf("")), ret);
+  ret = vsel_vf_vo_vf_vf(vor_vo_vo_vo(veq_vo_vf_vf(x, vcast_vf_f(__builtin_inff())), veq_vo_vf_vf(y, vcast_vf_f(__builtin_inff()))), vcast_vf_f(__builtin_inff()), ret);
+
+  return ret;
+}
+
+SLEEF_INLINE SLEEF_CONST vfloat Sleef_nextafterf4_avx2128(vfloat x, vfloat y) {
+  x = vsel_vf_vo_vf_vf(veq_vo_vf_vf(x, vcast_vf_f(0)), vmulsign_vf_vf_vf(vcast_vf_f(0), y), x);
+  vint2 xi2 = vreinterpret_vi2_vf(x);
+  vopmask c = vxor_vo_vo_vo(vsignbit_vo_vf(x), vge_vo_vf_vf(y, x));
+
+  xi2 = vsel_vi2_vo_vi2_vi2(c, vsub_vi2_vi2_vi2(vcast_vi2_i(0), vxor_vi2_vi2_vi2(xi2, vcast_vi2_i((int)(1U << 31)))), xi2);
+
+  xi2 = vsel_vi2_vo_vi2_vi2(vneq_vo_vf_vf(x, y), vsub_vi2_vi2_vi2(xi2, vcast_vi2_i(1)), xi2);
+
+  xi2 = vsel_vi2_vo_vi2_vi2(c, vsub_vi2_vi2_vi2(vcast_vi2_i(0), vxor_vi2_vi2_vi2(xi2, vcast_vi2_i((int)(1U << 31)))), xi2);
+
+  vfloat ret = vreinterpret_vf_vi2(xi2);
+
+  ret = vsel_vf_vo_vf_vf(vand_vo_vo_vo(veq_vo_vf_vf(ret, vcast_vf_f(0)), vneq_vo_vf_vf(x, vcast_vf_f(0))),
+    vmulsign_vf_vf_vf(vcast_vf_f(0), x), ret);
+
+  ret = vsel_vf_vo_vf_vf(vand_vo_vo_vo(veq_vo_vf_vf(x, vcast_vf_f(0)), veq_vo_vf_vf(y, vcast_vf_f(0))), y, ret);
+
+  ret = vsel_vf_vo_vf_vf(vor_vo_vo_vo(visnan_vo_vf(x), visnan_vo_vf(y)), vcast_vf_f(__builtin_nanf("")), ret);
+
+  return ret;
+}
+
+SLEEF_INLINE SLEEF_CONST vfloat Sleef_frfrexpf4_avx2128(vfloat x) {
+  x = vsel_vf_vo_vf_vf(vlt_vo_vf_vf(vabs_vf_vf(x), vcast_vf_f(0x1p-126)), vmul_vf_vf_vf(x, vcast_vf_f(UINT64_C(1) << 30)), x);
+
+  vmask xm = vreinterpret_vm_vf(x);
+  xm = vand_vm_vm_vm(xm, vcast_vm_i_i(~0x7f800000U, ~0x7f800000U));
+  xm = vor_vm_vm_vm (xm, vcast_vm_i_i( 0x3f000000U, 0x3f000000U));
+
+  vfloat ret = vreinterpret_vf_vm(xm);
+
+  ret = vsel_vf_vo_vf_vf(visinf_vo_vf(x), vmulsign_vf_vf_vf(vcast_vf_f(__builtin_inff()), x), ret);
+  ret = vsel_vf_vo_vf_vf(veq_vo_vf_vf(x, vcast_vf_f(0)), x, ret);
+
+  return ret;
+}
+
+
+SLEEF_INLINE SLEEF_CONST vint2 Sleef_expfrexpf4_avx2128(vfloat x) {
+  /*
+  x = vsel_vf_vo_vf_vf(vlt_vo_vf_vf(vabs_vf_vf(x), vcast_vf_f(SLEEF_FLT_MIN)), vmul_vf_vf_vf(x, vcast_vf_f(UINT64_C(1) << 63)), x);
+
+  vint ret = vcastu_vi_vi2(vreinterpret_vi2_vf(x));
+  ret = vsub_vi_vi_vi(vand_vi_vi_vi(vsrl_vi_vi_i(ret, 20), vcast_vi_i(0x7ff)), vcast_vi_i(0x3fe));
+
+  ret = vsel_vi_vo_vi_vi(vor_vo_vo_vo(vor_vo_vo_vo(veq_vo_vf_vf(x, vcast_vf_f(0)), visnan_vo_vf(x)), visinf_vo_vf(x)), vcast_vi_i(0), ret);
+  
+  return ret;
+  */
+  return vcast_vi2_i(0);
+}
+
+static SLEEF_ALWAYS_INLINE SLEEF_CONST vfloat vtoward0_vf_vf(vfloat x) {
+  vfloat t = vreinterpret_vf_vi2(vsub_vi2_vi2_vi2(vreinterpret_vi2_vf(x), vcast_vi2_i(1)));
+  return vsel_vf_vo_vf_vf(veq_vo_vf_vf(x, vcast_vf_f(0)), vcast_vf_f(0), t);
+}
+
+static SLEEF_ALWAYS_INLINE SLEEF_CONST vfloat vptrunc_vf_vf(vfloat x) {
+
+  return vtruncate_vf_vf(x);
+
+
+
+
+}
+
+
+SLEEF_INLINE SLEEF_CONST vfloat Sleef_fmodf4_avx2128(vfloat x, vfloat y) {
+  vfloat nu = vabs_vf_vf(x), de = vabs_vf_vf(y), s = vcast_vf_f(1), q;
+  vopmask o = vlt_vo_vf_vf(de, vcast_vf_f(0x1p-126));
+  nu = vsel_vf_vo_vf_vf(o, vmul_vf_vf_vf(nu, vcast_vf_f(UINT64_C(1) << 25)), nu);
+  de = vsel_vf_vo_vf_vf(o, vmul_vf_vf_vf(de, vcast_vf_f(UINT64_C(1) << 25)), de);
+  s = vsel_vf_vo_vf_vf(o, vmul_vf_vf_vf(s , vcast_vf_f(1.0f / (UINT64_C(1) << 25))), s);
+  vfloat rde = vtoward0_vf_vf(vrec_vf_vf(de));
+
+
+
+  vfloat2 r = vcast_vf2_vf_vf(nu, vcast_vf_f(0));
+
+  for(int i=0;i<8;i++) { // ceil(log2(FLT_MAX) / 22)+1
+    q = vptrunc_vf_vf(vmul_vf_vf_vf(vtoward0_vf_vf(vf2getx_vf_vf2(r)), rde));
+    q = vsel_vf_vo_vf_vf(vand_vo_vo_vo(vgt_vo_vf_vf(vmul_vf_vf_vf(vcast_vf_f(3), de), vf2getx_vf_vf2(r)),
+           vge_vo_vf_vf(vf2getx_vf_vf2(r), de)),
+    vcast_vf_f(2), q);
+    q = vsel_vf_vo_vf_vf(vand_vo_vo_vo(vgt_vo_vf_vf(vmul_vf_vf_vf(vcast_vf_f(2), de), vf2getx_vf_vf2(r)),
+           vge_vo_vf_vf(vf2getx_vf_vf2(r), de)),
+    vcast_vf_f(1), q);
+    r = dfnormalize_vf2_vf2(dfadd2_vf2_vf2_vf2(r, dfmul_vf2_vf_vf(vptrunc_vf_vf(q), vneg_vf_vf(de))));
+    if (vtestallones_i_vo32(vlt_vo_vf_vf(vf2getx_vf_vf2(r), de))) break;
+  }
+
+  vfloat ret = vmul_vf_vf_vf(vadd_vf_vf_vf(vf2getx_vf_vf2(r), vf2gety_vf_vf2(r)), s);
+  ret = vsel_vf_vo_vf_vf(veq_vo_vf_vf(vadd_vf_vf_vf(vf2getx_vf_vf2(r), vf2gety_vf_vf2(r)), de), vcast_vf_f(0), ret);
+
+  ret = vmulsign_vf_vf_vf(ret, x);
+
+  ret = vsel_vf_vo_vf_vf(vlt_vo_vf_vf(nu, de), x, ret);
+  ret = vsel_vf_vo_vf_vf(veq_vo_vf_vf(de, vcast_vf_f(0)), vcast_vf_f(__builtin_nanf("")), ret);
+
+  return ret;
+}
+
+static SLEEF_ALWAYS_INLINE SLEEF_CONST vfloat vrintfk2_vf_vf(vfloat d) {
+
+  return vrint_vf_vf(d);
+
+
+
+
+
+}
+
+SLEEF_INLINE SLEEF_CONST vfloat Sleef_remainderf4_avx2128(vfloat x, vfloat y) {
+  vfloat n = vabs_vf_vf(x), d = vabs_vf_vf(y), s = vcast_vf_f(1), q;
+  vopmask o = vlt_vo_vf_vf(d, vcast_vf_f(0x1p-126*2));
+  n = vsel_vf_vo_vf_vf(o, vmul_vf_vf_vf(n, vcast_vf_f(UINT64_C(1) << 25)), n);
+  d = vsel_vf_vo_vf_vf(o, vmul_vf_vf_vf(d, vcast_vf_f(UINT64_C(1) << 25)), d);
+  s = vsel_vf_vo_vf_vf(o, vmul_vf_vf_vf(s , vcast_vf_f(1.0f / (UINT64_C(1) << 25))), s);
+  vfloat2 r = vcast_vf2_vf_vf(n, vcast_vf_f(0));
+  vfloat rd = vrec_vf_vf(d);
+  vopmask qisodd = vneq_vo_vf_vf(vcast_vf_f(0), vcast_vf_f(0));
+
+  for(int i=0;i<8;i++) { // ceil(log2(FLT_MAX) / 22)+1
+    q = vrintfk2_vf_vf(vmul_vf_vf_vf(vf2getx_vf_vf2(r), rd));
+    q = vsel_vf_vo_vf_vf(vlt_vo_vf_vf(vabs_vf_vf(vf2getx_vf_vf2(r)), vmul_vf_vf_vf(d, vcast_vf_f(1.5f))), vmulsign_vf_vf_vf(vcast_vf_f(1.0f), vf2getx_vf_vf2(r)), q);
+    q = vsel_vf_vo_vf_vf(vor_vo_vo_vo(vlt_vo_vf_vf(vabs_vf_vf(vf2getx_vf_vf2(r)), vmul_vf_vf_vf(d, vcast_vf_f(0.5f))),
+          vandnot_vo_vo_vo(qisodd, veq_vo_vf_vf(vabs_vf_vf(vf2getx_vf_vf2(r)), vmul_vf_vf_vf(d, vcast_vf_f(0.5f))))),
+    vcast_vf_f(0.0), q);
+    if (vtestallones_i_vo32(veq_vo_vf_vf(q, vcast_vf_f(0)))) break;
+    q = vsel_vf_vo_vf_vf(visinf_vo_vf(vmul_vf_vf_vf(q, vneg_vf_vf(d))), vadd_vf_vf_vf(q, vmulsign_vf_vf_vf(vcast_vf_f(-1), vf2getx_vf_vf2(r))), q);
+    qisodd = vxor_vo_vo_vo(qisodd, vand_vo_vo_vo(veq_vo_vi2_vi2(vand_vi2_vi2_vi2(vtruncate_vi2_vf(q), vcast_vi2_i(1)), vcast_vi2_i(1)),
+       vlt_vo_vf_vf(vabs_vf_vf(q), vcast_vf_f(1 << 24))));
+    r = dfnormalize_vf2_vf2(dfadd2_vf2_vf2_vf2(r, dfmul_vf2_vf_vf(q, vneg_vf_vf(d))));
+  }
+
+  vfloat ret = vmul_vf_vf_vf(vadd_vf_vf_vf(vf2getx_vf_vf2(r), vf2gety_vf_vf2(r)), s);
+  ret = vmulsign_vf_vf_vf(ret, x);
+  ret = vsel_vf_vo_vf_vf(visinf_vo_vf(y), vsel_vf_vo_vf_vf(visinf_vo_vf(x), vcast_vf_f(__builtin_nanf("")), x), ret);
+  ret = vsel_vf_vo_vf_vf(veq_vo_vf_vf(d, vcast_vf_f(0)), vcast_vf_f(__builtin_nanf("")), ret);
+  return ret;
+}
+
+
+//
+
+static SLEEF_ALWAYS_INLINE SLEEF_CONST vfloat2 sinpifk(vfloat d) {
+  vopmask o;
+  vfloat u, s, t;
+  vfloat2 x, s2;
+
+  u = vmul_vf_vf_vf(d, vcast_vf_f(4.0));
+  vint2 q = vtruncate_vi2_vf(u);
+  q = vand_vi2_vi2_vi2(vadd_vi2_vi2_vi2(q, vxor_vi2_vi2_vi2(vsrl_vi2_vi2_i(q, 31), vcast_vi2_i(1))), vcast_vi2_i(~1));
+  o = veq_vo_vi2_vi2(vand_vi2_vi2_vi2(q, vcast_vi2_i(2)), vcast_vi2_i(2));
+
+  s = vsub_vf_vf_vf(u, vcast_vf_vi2(q));
+  t = s;
+  s = vmul_vf_vf_vf(s, s);
+  s2 = dfmul_vf2_vf_vf(t, t);
+
+  //
+
+  u = vsel_vf_vo_f_f(o, -0.2430611801e-7f, +0.3093842054e-6f);
+  u = vmla_vf_vf_vf_vf(u, s, vsel_vf_vo_f_f(o, +0.3590577080e-5f, -0.3657307388e-4f));
+  u = vmla_vf_vf_vf_vf(u, s, vsel_vf_vo_f_f(o, -0.3259917721e-3f, +0.2490393585e-2f));
+  x = dfadd2_vf2_vf_vf2(vmul_vf_vf_vf(u, s),
+   vsel_vf2_vo_f_f_f_f(o, 0.015854343771934509277, 4.4940051354032242811e-10,
+         -0.080745510756969451904, -1.3373665339076936258e-09));
+  x = dfadd2_vf2_vf2_vf2(dfmul_vf2_vf2_vf2(s2, x),
+    vsel_vf2_vo_f_f_f_f(o, -0.30842512845993041992, -9.0728339030733922277e-09,
+          0.78539818525314331055, -2.1857338617566484855e-08));
+
+  x = dfmul_vf2_vf2_vf2(x, vsel_vf2_vo_vf2_vf2(o, s2, vcast_vf2_vf_vf(t, vcast_vf_f(0))));
+  x = vsel_vf2_vo_vf2_vf2(o, dfadd2_vf2_vf2_vf(x, vcast_vf_f(1)), x);
+
+  o = veq_vo_vi2_vi2(vand_vi2_vi2_vi2(q, vcast_vi2_i(4)), vcast_vi2_i(4));
+  x = vf2setx_vf2_vf2_vf(x, vreinterpret_vf_vm(vxor_vm_vm_vm(vand_vm_vo32_vm(o, vreinterpret_vm_vf(vcast_vf_f(-0.0))), vreinterpret_vm_vf(vf2getx_vf_vf2(x)))));
+  x = vf2sety_vf2_vf2_vf(x, vreinterpret_vf_vm(vxor_vm_vm_vm(vand_vm_vo32_vm(o, vreinterpret_vm_vf(vcast_vf_f(-0.0))), vreinterpret_vm_vf(vf2gety_vf_vf2(x)))));
+
+  return x;
+}
+
+
+SLEEF_INLINE SLEEF_CONST vfloat Sleef_sinpif4_u05avx2128(vfloat d) {
+  vfloat2 x = sinpifk(d);
+  vfloat r = vadd_vf_vf_vf(vf2getx_vf_vf2(x), vf2gety_vf_vf2(x));
+
+  r = vsel_vf_vo_vf_vf(visnegzero_vo_vf(d), vcast_vf_f(-0.0), r);
+  r = vreinterpret_vf_vm(vandnot_vm_vo32_vm(vgt_vo_vf_vf(vabs_vf_vf(d), vcast_vf_f(8e+6f)), vreinterpret_vm_vf(r)));
+  r = vreinterpret_vf_vm(vor_vm_vo32_vm(visinf_vo_vf(d), vreinterpret_vm_vf(r)));
+
+  return r;
+}
+
+
+static SLEEF_ALWAYS_INLINE SLEEF_CONST vfloat2 cospifk(vfloat d) {
+  vopmask o;
+  vfloat u, s, t;
+  vfloat2 x, s2;
+
+  u = vmul_vf_vf_vf(d, vcast_vf_f(4.0));
+  vint2 q = vtruncate_vi2_vf(u);
+  q = vand_vi2_vi2_vi2(vadd_vi2_vi2_vi2(q, vxor_vi2_vi2_vi2(vsrl_vi2_vi2_i(q, 31), vcast_vi2_i(1))), vcast_vi2_i(~1));
+  o = veq_vo_vi2_vi2(vand_vi2_vi2_vi2(q, vcast_vi2_i(2)), vcast_vi2_i(0));
+
+  s = vsub_vf_vf_vf(u, vcast_vf_vi2(q));
+  t = s;
+  s = vmul_vf_vf_vf(s, s);
+  s2 = dfmul_vf2_vf_vf(t, t);
+
+  //
+
+  u = vsel_vf_vo_f_f(o, -0.2430611801e-7f, +0.3093842054e-6f);
+  u = vmla_vf_vf_vf_vf(u, s, vsel_vf_vo_f_f(o, +0.3590577080e-5f, -0.3657307388e-4f));
+  u = vmla_vf_vf_vf_vf(u, s, vsel_vf_vo_f_f(o, -0.3259917721e-3f, +0.2490393585e-2f));
+  x = dfadd2_vf2_vf_vf2(vmul_vf_vf_vf(u, s),
+   vsel_vf2_vo_f_f_f_f(o, 0.015854343771934509277, 4.4940051354032242811e-10,
+         -0.080745510756969451904, -1.3373665339076936258e-09));
+  x = dfadd2_vf2_vf2_vf2(dfmul_vf2_vf2_vf2(s2, x),
+    vsel_vf2_vo_f_f_f_f(o, -0.30842512845993041992, -9.0728339030733922277e-09,
+          0.78539818525314331055, -2.1857338617566484855e-08));
+
+  x = dfmul_vf2_vf2_vf2(x, vsel_vf2_vo_vf2_vf2(o, s2, vcast_vf2_vf_vf(t, vcast_vf_f(0))));
+  x = vsel_vf2_vo_vf2_vf2(o, dfadd2_vf2_vf2_vf(x, vcast_vf_f(1)), x);
+
+  o = veq_vo_vi2_vi2(vand_vi2_vi2_vi2(vadd_vi2_vi2_vi2(q, vcast_vi2_i(2)), vcast_vi2_i(4)), vcast_vi2_i(4));
+  x = vf2setx_vf2_vf2_vf(x, vreinterpret_vf_vm(vxor_vm_vm_vm(vand_vm_vo32_vm(o, vreinterpret_vm_vf(vcast_vf_f(-0.0))), vreinterpret_vm_vf(vf2getx_vf_vf2(x)))));
+  x = vf2sety_vf2_vf2_vf(x, vreinterpret_vf_vm(vxor_vm_vm_vm(vand_vm_vo32_vm(o, vreinterpret_vm_vf(vcast_vf_f(-0.0))), vreinterpret_vm_vf(vf2gety_vf_vf2(x)))));
+
+  return x;
+}
+
+
+SLEEF_INLINE SLEEF_CONST vfloat Sleef_cospif4_u05avx2128(vfloat d) {
+  vfloat2 x = cospifk(d);
+  vfloat r = vadd_vf_vf_vf(vf2getx_vf_vf2(x), vf2gety_vf_vf2(x));
+
+  r = vsel_vf_vo_vf_vf(vgt_vo_vf_vf(vabs_vf_vf(d), vcast_vf_f(8e+6f)), vcast_vf_f(1), r);
+  r = vreinterpret_vf_vm(vor_vm_vo32_vm(visinf_vo_vf(d), vreinterpret_vm_vf(r)));
+
+  return r;
+}
+
+
+
+  typedef struct {
+    vfloat2 a, b;
+  } df2;
+
+static df2 df2setab_df2_vf2_vf2(vfloat2 a, vfloat2 b) {
+  df2 r = { a, b };
+  return r;
+}
+static vfloat2 df2geta_vf2_df2(df2 d) { return d.a; }
+static vfloat2 df2getb_vf2_df2(df2 d) { return d.b; }
+
+
+/* TODO AArch64: potential optimization by using `vfmad_lane_f64` */
+static SLEEF_CONST df2 gammafk(vfloat a) {
+  vfloat2 clc = vcast_vf2_f_f(0, 0), clln = vcast_vf2_f_f(1, 0), clld = vcast_vf2_f_f(1, 0);
+  vfloat2 x, y, z;
+  vfloat t, u;
+
+  vopmask otiny = vlt_vo_vf_vf(vabs_vf_vf(a), vcast_vf_f(1e-30f)), oref = vlt_vo_vf_vf(a, vcast_vf_f(0.5));
+
+  x = vsel_vf2_vo_vf2_vf2(otiny, vcast_vf2_f_f(0, 0),
+     vsel_vf2_vo_vf2_vf2(oref, dfadd2_vf2_vf_vf(vcast_vf_f(1), vneg_vf_vf(a)),
+           vcast_vf2_vf_vf(a, vcast_vf_f(0))));
+
+  vopmask o0 = vand_vo_vo_vo(vle_vo_vf_vf(vcast_vf_f(0.5), vf2getx_vf_vf2(x)), vle_vo_vf_vf(vf2getx_vf_vf2(x), vcast_vf_f(1.2)));
+  vopmask o2 = vle_vo_vf_vf(vcast_vf_f(2.3), vf2getx_vf_vf2(x));
+
+  y = dfnormalize_vf2_vf2(dfmul_vf2_vf2_vf2(dfadd2_vf2_vf2_vf(x, vcast_vf_f(1)), x));
+  y = dfnormalize_vf2_vf2(dfmul_vf2_vf2_vf2(dfadd2_vf2_vf2_vf(x, vcast_vf_f(2)), y));
+
+  vopmask o = vand_vo_vo_vo(o2, vle_vo_vf_vf(vf2getx_vf_vf2(x), vcast_vf_f(7)));
+  clln = vsel_vf2_vo_vf2_vf2(o, y, clln);
+
+  x = vsel_vf2_vo_vf2_vf2(o, dfadd2_vf2_vf2_vf(x, vcast_vf_f(3)), x);
+  t = vsel_vf_vo_vf_vf(o2, vrec_vf_vf(vf2getx_vf_vf2(x)), vf2getx_vf_vf2(dfnormalize_vf2_vf2(dfadd2_vf2_vf2_vf(x, vsel_vf_vo_f_f(o0, -1, -2)))));
+
+  u = vsel_vf_vo_vo_f_f_f(o2, o0, +0.000839498720672087279971000786, +0.9435157776e+0f, +0.1102489550e-3f);
+  u = vmla_vf_vf_vf_vf(u, t, vsel_vf_vo_vo_f_f_f(o2, o0, -5.17179090826059219329394422e-05, +0.8670063615e+0f, +0.8160019934e-4f));
+  u = vmla_vf_vf_vf_vf(u, t, vsel_vf_vo_vo_f_f_f(o2, o0, -0.000592166437353693882857342347, +0.4826702476e+0f, +0.1528468856e-3f));
+  u = vmla_vf_vf_vf_vf(u, t, vsel_vf_vo_vo_f_f_f(o2, o0, +6.97281375836585777403743539e-05, -0.8855129778e-1f, -0.2355068718e-3f));
+  u = vmla_vf_vf_vf_vf(u, t, vsel_vf_vo_vo_f_f_f(o2, o0, +0.000784039221720066627493314301, +0.1013825238e+0f, +0.4962242092e-3f));
+  u = vmla_vf_vf_vf_vf(u, t, vsel_vf_vo_vo_f_f_f(o2, o0, -0.000229472093621399176949318732, -0.1493408978e+0f, -0.1193488017e-2f));
+  u = vmla_vf_vf_vf_vf(u, t, vsel_vf_vo_vo_f_f_f(o2, o0, -0.002681327160493827160473958490, +0.1697509140e+0f, +0.2891599433e-2f));
+  u = vmla_vf_vf_vf_vf(u, t, vsel_vf_vo_vo_f_f_f(o2, o0, +0.003472222222222222222175164840, -0.2072454542e+0f, -0.7385451812e-2f));
+  u = vmla_vf_vf_vf_vf(u, t, vsel_vf_vo_vo_f_f_f(o2, o0, +0.083333333333333333335592087900, +0.2705872357e+0f, +0.2058077045e-1f));
+
+  y = dfmul_vf2_vf2_vf2(dfadd2_vf2_vf2_vf(x, vcast_vf_f(-0.5)), logk2f(x));
+  y = dfadd2_vf2_vf2_vf2(y, dfneg_vf2_vf2(x));
+  y = dfadd2_vf2_vf2_vf2(y, vcast_vf2_d(0.91893853320467278056)); // 0.5*log(2*M_PI)
+
+  z = dfadd2_vf2_vf2_vf(dfmul_vf2_vf_vf (u, t), vsel_vf_vo_f_f(o0, -0.400686534596170958447352690395e+0f, -0.673523028297382446749257758235e-1f));
+  z = dfadd2_vf2_vf2_vf(dfmul_vf2_vf2_vf(z, t), vsel_vf_vo_f_f(o0, +0.822466960142643054450325495997e+0f, +0.322467033928981157743538726901e+0f));
+  z = dfadd2_vf2_vf2_vf(dfmul_vf2_vf2_vf(z, t), vsel_vf_vo_f_f(o0, -0.577215665946766039837398973297e+0f, +0.422784335087484338986941629852e+0f));
+  z = dfmul_vf2_vf2_vf(z, t);
+
+  clc = vsel_vf2_vo_vf2_vf2(o2, y, z);
+
+  clld = vsel_vf2_vo_vf2_vf2(o2, dfadd2_vf2_vf2_vf(dfmul_vf2_vf_vf(u, t), vcast_vf_f(1)), clld);
+
+  y = clln;
+
+  clc = vsel_vf2_vo_vf2_vf2(otiny, vcast_vf2_d(41.58883083359671856503), // log(2^60)
+       vsel_vf2_vo_vf2_vf2(oref, dfadd2_vf2_vf2_vf2(vcast_vf2_d(1.1447298858494001639), dfneg_vf2_vf2(clc)), clc)); // log(M_PI)
+  clln = vsel_vf2_vo_vf2_vf2(otiny, vcast_vf2_f_f(1, 0), vsel_vf2_vo_vf2_vf2(oref, clln, clld));
+
+  if (!vtestallones_i_vo32(vnot_vo32_vo32(oref))) {
+    t = vsub_vf_vf_vf(a, vmul_vf_vf_vf(vcast_vf_f(INT64_C(1) << 12), vcast_vf_vi2(vtruncate_vi2_vf(vmul_vf_vf_vf(a, vcast_vf_f(1.0 / (INT64_C(1) << 12)))))));
+    x = dfmul_vf2_vf2_vf2(clld, sinpifk(t));
+  }
+
+  clld = vsel_vf2_vo_vf2_vf2(otiny, vcast_vf2_vf_vf(vmul_vf_vf_vf(a, vcast_vf_f((INT64_C(1) << 30)*(float)(INT64_C(1) << 30))), vcast_vf_f(0)),
+        vsel_vf2_vo_vf2_vf2(oref, x, y));
+
+  return df2setab_df2_vf2_vf2(clc, dfdiv_vf2_vf2_vf2(clln, clld));
+}
+
+
+SLEEF_INLINE SLEEF_CONST vfloat Sleef_tgammaf4_u10avx2128(vfloat a) {
+  df2 d = gammafk(a);
+  vfloat2 y = dfmul_vf2_vf2_vf2(expk2f(df2geta_vf2_df2(d)), df2getb_vf2_df2(d));
+  vfloat r = vadd_vf_vf_vf(vf2getx_vf_vf2(y), vf2gety_vf_vf2(y));
+  vopmask o;
+
+  o = vor_vo_vo_vo(vor_vo_vo_vo(veq_vo_vf_vf(a, vcast_vf_f(-__builtin_inff())),
+    vand_vo_vo_vo(vlt_vo_vf_vf(a, vcast_vf_f(0)), visint_vo_vf(a))),
+     vand_vo_vo_vo(vand_vo_vo_vo(visnumber_vo_vf(a), vlt_vo_vf_vf(a, vcast_vf_f(0))), visnan_vo_vf(r)));
+  r = vsel_vf_vo_vf_vf(o, vcast_vf_f(__builtin_nanf("")), r);
+
+  o = vand_vo_vo_vo(vand_vo_vo_vo(vor_vo_vo_vo(veq_vo_vf_vf(a, vcast_vf_f(__builtin_inff())), visnumber_vo_vf(a)),
+      vge_vo_vf_vf(a, vcast_vf_f(-0x1p-126))),
+      vor_vo_vo_vo(vor_vo_vo_vo(veq_vo_vf_vf(a, vcast_vf_f(0)), vgt_vo_vf_vf(a, vcast_vf_f(36))), visnan_vo_vf(r)));
+  r = vsel_vf_vo_vf_vf(o, vmulsign_vf_vf_vf(vcast_vf_f(__builtin_inff()), a), r);
+
+  return r;
+}
+
+SLEEF_INLINE SLEEF_CONST vfloat Sleef_lgammaf4_u10avx2128(vfloat a) {
+  df2 d = gammafk(a);
+  vfloat2 y = dfadd2_vf2_vf2_vf2(df2geta_vf2_df2(d), logk2f(dfabs_vf2_vf2(df2getb_vf2_df2(d))));
+  vfloat r = vadd_vf_vf_vf(vf2getx_vf_vf2(y), vf2gety_vf_vf2(y));
+  vopmask o;
+
+  o = vor_vo_vo_vo(visinf_vo_vf(a),
+     vor_vo_vo_vo(vand_vo_vo_vo(vle_vo_vf_vf(a, vcast_vf_f(0)), visint_vo_vf(a)),
+    vand_vo_vo_vo(visnumber_vo_vf(a), visnan_vo_vf(r))));
+  r = vsel_vf_vo_vf_vf(o, vcast_vf_f(__builtin_inff()), r);
+
+  return r;
+}
+
+static SLEEF_ALWAYS_INLINE SLEEF_CONST vfloat2 dfmla_vf2_vf_vf2_vf2(vfloat x, vfloat2 y, vfloat2 z) {
+  return dfadd_vf2_vf2_vf2(z, dfmul_vf2_vf2_vf(y, x));
+}
+
+static SLEEF_ALWAYS_INLINE SLEEF_CONST vfloat2 poly2df_b(vfloat x, vfloat2 c1, vfloat2 c0) { return dfmla_vf2_vf_vf2_vf2(x, c1, c0); }
+static SLEEF_ALWAYS_INLINE SLEEF_CONST vfloat2 poly2df(vfloat x, vfloat c1, vfloat2 c0) { return dfmla_vf2_vf_vf2_vf2(x, vcast_vf2_vf_vf(c1, vcast_vf_f(0)), c0); }
+static SLEEF_ALWAYS_INLINE SLEEF_CONST vfloat2 poly4df(vfloat x, vfloat c3, vfloat2 c2, vfloat2 c1, vfloat2 c0) {
+  return dfmla_vf2_vf_vf2_vf2(vmul_vf_vf_vf(x, x), poly2df(x, c3, c2), poly2df_b(x, c1, c0));
+}
+
+SLEEF_INLINE SLEEF_CONST vfloat Sleef_erff4_u10avx2128(vfloat a) {
+  vfloat t, x = vabs_vf_vf(a);
+  vfloat2 t2;
+  vfloat x2 = vmul_vf_vf_vf(x, x), x4 = vmul_vf_vf_vf(x2, x2);
+  vopmask o25 = vle_vo_vf_vf(x, vcast_vf_f(2.5));
+
+  if (__builtin_expect(!!(vtestallones_i_vo32(o25)), 1)) {
+    // Abramowitz and Stegun
+    t = vmla_vf_vf_vf_vf((x4), (vmla_vf_vf_vf_vf((x), (vcast_vf_f(-0.4360447008e-6)), (vcast_vf_f(+0.6867515367e-5)))), (vmla_vf_vf_vf_vf((x2), (vmla_vf_vf_vf_vf((x), (vcast_vf_f(-0.3045156700e-4)), (vcast_vf_f(+0.9808536561e-4)))), (vmla_vf_vf_vf_vf((x), (vcast_vf_f(+0.2395523916e-3)), (vcast_vf_f(+0.1459901541e-3)))))))
+
+
+
+
+
+                        ;
+    t2 = poly4df(x, t,
+   vcast_vf2_f_f(0.0092883445322513580322, -2.7863745897025330755e-11),
+   vcast_vf2_f_f(0.042275499552488327026, 1.3461399289988106057e-09),
+   vcast_vf2_f_f(0.070523701608180999756, -3.6616309318707365163e-09));
+    t2 = dfadd_vf2_vf_vf2(vcast_vf_f(1), dfmul_vf2_vf2_vf(t2, x));
+    t2 = dfsqu_vf2_vf2(t2);
+    t2 = dfsqu_vf2_vf2(t2);
+    t2 = dfsqu_vf2_vf2(t2);
+    t2 = dfsqu_vf2_vf2(t2);
+    t2 = dfrec_vf2_vf2(t2);
+  } else {
+
+
+    t = vmla_vf_vf_vf_vf((x4), (vmla_vf_vf_vf_vf((x), ((vsel_vf_vo_f_f(o25, -0.4360447008e-6, -0.1130012848e-6))), ((vsel_vf_vo_f_f(o25, +0.6867515367e-5, +0.4115272986e-5))))), (vmla_vf_vf_vf_vf((x2), (vmla_vf_vf_vf_vf((x), ((vsel_vf_vo_f_f(o25, -0.3045156700e-4, -0.6928304356e-4))), ((vsel_vf_vo_f_f(o25, +0.9808536561e-4, +0.7172692567e-3))))), (vmla_vf_vf_vf_vf((x), ((vsel_vf_vo_f_f(o25, +0.2395523916e-3, -0.5131045356e-2))), ((vsel_vf_vo_f_f(o25, +0.1459901541e-3, +0.2708637156e-1))))))))
+
+
+
+
+
+                                                                ;
+    t2 = poly4df(x, t,
+   vsel_vf2_vo_vf2_vf2(o25, vcast_vf2_f_f(0.0092883445322513580322, -2.7863745897025330755e-11),
+         vcast_vf2_f_f(-0.11064319312572479248, 3.7050452777225283007e-09)),
+   vsel_vf2_vo_vf2_vf2(o25, vcast_vf2_f_f(0.042275499552488327026, 1.3461399289988106057e-09),
+         vcast_vf2_f_f(-0.63192230463027954102, -2.0200432585073177859e-08)),
+   vsel_vf2_vo_vf2_vf2(o25, vcast_vf2_f_f(0.070523701608180999756, -3.6616309318707365163e-09),
+         vcast_vf2_f_f(-1.1296638250350952148, 2.5515120196453259252e-08)));
+    t2 = dfmul_vf2_vf2_vf(t2, x);
+    vfloat2 s2 = dfadd_vf2_vf_vf2(vcast_vf_f(1), t2);
+    s2 = dfsqu_vf2_vf2(s2);
+    s2 = dfsqu_vf2_vf2(s2);
+    s2 = dfsqu_vf2_vf2(s2);
+    s2 = dfsqu_vf2_vf2(s2);
+    s2 = dfrec_vf2_vf2(s2);
+    t2 = vsel_vf2_vo_vf2_vf2(o25, s2, vcast_vf2_vf_vf(expkf(t2), vcast_vf_f(0)));
+  }
+
+  t2 = dfadd2_vf2_vf2_vf(t2, vcast_vf_f(-1));
+  t2 = vsel_vf2_vo_vf2_vf2(vlt_vo_vf_vf(x, vcast_vf_f(1e-4)), dfmul_vf2_vf2_vf(vcast_vf2_f_f(-1.1283792257308959961, 5.8635383422197591097e-08), x), t2);
+
+  vfloat z = vneg_vf_vf(vadd_vf_vf_vf(vf2getx_vf_vf2(t2), vf2gety_vf_vf2(t2)));
+  z = vsel_vf_vo_vf_vf(vge_vo_vf_vf(x, vcast_vf_f(6)), vcast_vf_f(1), z);
+  z = vsel_vf_vo_vf_vf(visinf_vo_vf(a), vcast_vf_f(1), z);
+  z = vsel_vf_vo_vf_vf(veq_vo_vf_vf(a, vcast_vf_f(0)), vcast_vf_f(0), z);
+  z = vmulsign_vf_vf_vf(z, a);
+
+  return z;
+}
+
+// Returns erfc(a) for 0 <= a < 10.1 as a float-float number. If
+// scale is nonzero, the result is multiplied by 2^64 so that the
+// tail does not lose precision to subnormal numbers.
+/* TODO AArch64: potential optimization by using `vfmad_lane_f64` */
+static SLEEF_ALWAYS_INLINE SLEEF_CONST vfloat2 erfckf(vfloat2 a, int scale) {
+  vfloat t;
+  vfloat2 u, d, x;
+  vopmask o0 = vlt_vo_vf_vf(vf2getx_vf_vf2(a), vcast_vf_f(1.0));
+  vopmask o1 = vlt_vo_vf_vf(vf2getx_vf_vf2(a), vcast_vf_f(2.2));
+  vopmask o2 = vlt_vo_vf_vf(vf2getx_vf_vf2(a), vcast_vf_f(4.3));
+
+  u = vsel_vf2_vo_vf2_vf2(o1, a, dfdiv_vf2_vf2_vf2(vcast_vf2_f_f(1, 0), a));
+
+  t = vsel_vf_vo_vo_vo_f_f_f_f(o0, o1, o2, -0.8638041618e-4f, -0.6236977242e-5f, -0.3869504035e+0f, +0.1115344167e+1f);
+  t = vmla_vf_vf_vf_vf(t, vf2getx_vf_vf2(u), vsel_vf_vo_vo_vo_f_f_f_f(o0, o1, o2, +0.6000166177e-3f, +0.5749821503e-4f, +0.1288077235e+1f, -0.9454904199e+0f));
+  t = vmla_vf_vf_vf_vf(t, vf2getx_vf_vf2(u), vsel_vf_vo_vo_vo_f_f_f_f(o0, o1, o2, -0.1665703603e-2f, +0.6002851478e-5f, -0.1816803217e+1f, -0.3667259514e+0f));
+  t = vmla_vf_vf_vf_vf(t, vf2getx_vf_vf2(u), vsel_vf_vo_vo_vo_f_f_f_f(o0, o1, o2, +0.1795156277e-3f, -0.2851036377e-2f, +0.1249150872e+1f, +0.7155663371e+0f));
+  t = vmla_vf_vf_vf_vf(t, vf2getx_vf_vf2(u), vsel_vf_vo_vo_vo_f_f_f_f(o0, o1, o2, +0.1914106123e-1f, +0.2260518074e-1f, -0.1328857988e+0f, -0.1262947265e-1f));
+
+  d = dfmul_vf2_vf2_vf(u, t);
+  d = dfadd2_vf2_vf2_vf2(d, vsel_vf2_vo_vo_vo_d_d_d_d(o0, o1, o2, -0.102775359343930288081655368891e+0, -0.105247583459338632253369014063e+0, -0.482365310333045318680618892669e+0, -0.498961546254537647970305302739e+0));
+  d = dfmul_vf2_vf2_vf2(d, u);
+  d = dfadd2_vf2_vf2_vf2(d, vsel_vf2_vo_vo_vo_d_d_d_d(o0, o1, o2, -0.636619483208481931303752546439e+0, -0.635609463574589034216723775292e+0, -0.134450203224533979217859332703e-2, -0.471199543422848492080722832666e-4));
+  d = dfmul_vf2_vf2_vf2(d, u);
+  d = dfadd2_vf2_vf2_vf2(d, vsel_vf2_vo_vo_vo_d_d_d_d(o0, o1, o2, -0.112837917790537404939545770596e+1, -0.112855987376668622084547028949e+1, -0.572319781150472949561786101080e+0, -0.572364030327966044425932623525e+0));
+
+  x = dfmul_vf2_vf2_vf2(vsel_vf2_vo_vf2_vf2(o1, d, dfneg_vf2_vf2(a)), a);
+  x = vsel_vf2_vo_vf2_vf2(o1, x, dfadd2_vf2_vf2_vf2(x, d));
+
+  if (scale) x = dfadd2_vf2_vf2_vf2(x, vcast_vf2_f_f(44.361419677734375f, -1.2189786957605975e-07f));
+  x = expk2f(x);
+  x = vsel_vf2_vo_vf2_vf2(o1, x, dfmul_vf2_vf2_vf2(x, u));
+
+  return x;
+}
+
+SLEEF_INLINE SLEEF_CONST vfloat Sleef_erfcf4_u15avx2128(vfloat a) {
+  vfloat s = a, r;
+  a = vabs_vf_vf(a);
+  vfloat2 x = erfckf(vcast_vf2_vf_vf(a, vcast_vf_f(0)), 0);
+
+  r = vsel_vf_vo_vf_vf(vlt_vo_vf_vf(a, vcast_vf_f(10.1)), vadd_vf_vf_vf(vf2getx_vf_vf2(x), vf2gety_vf_vf2(x)), vcast_vf_f(0));
+  r = vsel_vf_vo_vf_vf(vsignbit_vo_vf(s), vsub_vf_vf_vf(vcast_vf_f(2), r), r);
+  r = vsel_vf_vo_vf_vf(visnan_vo_vf(s), vcast_vf_f(__builtin_nanf("")), r);
+  return r;
+}
+
+
+// The activation functions have no counterparts in the vector ABI of glibc
+
+
+// See sleefsimddp.c for the scaling in these kernels. Below -80, e is
+// scaled by 2^64.
+
+static SLEEF_ALWAYS_INLINE SLEEF_CONST vfloat2 sigmoidk2f(vfloat2 d) {
+  vopmask n = vlt_vo_vf_vf(vf2getx_vf_vf2(d), vcast_vf_f(0));
+  vopmask o = vlt_vo_vf_vf(vf2getx_vf_vf2(d), vcast_vf_f(-80));
+  vfloat2 a = vsel_vf2_vo_vf2_vf2(n, d, dfneg_vf2_vf2(d));
+  a = dfadd2_vf2_vf2_vf2(a, vsel_vf2_vo_vf2_vf2(o, vcast_vf2_f_f(44.361419677734375f, -1.2189786957605975e-07f), vcast_vf2_f_f(0, 0)));
+
+  vfloat2 e = expk2f(a);
+  return dfdiv_vf2_vf2_vf2(vsel_vf2_vo_vf2_vf2(n, e, vcast_vf2_f_f(1, 0)), dfadd2_vf2_vf_vf2(vcast_vf_f(1), e));
+}
+
+static SLEEF_ALWAYS_INLINE SLEEF_CONST vfloat sigmoidkf(vfloat2 d) {
+  vopmask n = vlt_vo_vf_vf(vf2getx_vf_vf2(d), vcast_vf_f(0));
+  vopmask o = vlt_vo_vf_vf(vf2getx_vf_vf2(d), vcast_vf_f(-80));
+  vfloat2 a = vsel_vf2_vo_vf2_vf2(n, d, dfneg_vf2_vf2(d));
+  a = dfadd2_vf2_vf2_vf2(a, vsel_vf2_vo_vf2_vf2(o, vcast_vf2_f_f(44.361419677734375f, -1.2189786957605975e-07f), vcast_vf2_f_f(0, 0)));
+
+  vfloat e = expkf(a);
+  return vdiv_vf_vf_vf(vsel_vf_vo_vf_vf(n, e, vcast_vf_f(1)), vadd_vf_vf_vf(vcast_vf_f(1), e));
+}
+
+static SLEEF_ALWAYS_INLINE SLEEF_CONST vfloat sigmoidscalekf(vfloat d) {
+  return vsel_vf_vo_vf_vf(vlt_vo_vf_vf(d, vcast_vf_f(-80)), vcast_vf_f(5.42101086242752217003726e-20f), vcast_vf_f(1));
+}
+
+static SLEEF_ALWAYS_INLINE SLEEF_CONST vfloat2 gelutanhkf(vfloat x) {
+  vfloat2 t = dfmul_vf2_vf2_vf2(vcast_vf2_f_f(0.07135481387376785f, 2.3988324659995897e-09f), dfmul_vf2_vf_vf(x, x));
+  t = dfadd2_vf2_vf2_vf2(vcast_vf2_f_f(1.5957691669464111f, -4.534068054340423e-08f), t);
+  return dfmul_vf2_vf2_vf(t, x);
+}
+
+SLEEF_INLINE SLEEF_CONST vfloat Sleef_sigmoidf4_u10avx2128(vfloat x) {
+  vfloat2 d = sigmoidk2f(vcast_vf2_vf_vf(x, vcast_vf_f(0)));
+  vfloat y = vadd_vf_vf_vf(vf2getx_vf_vf2(d), vf2gety_vf_vf2(d));
+  return vmul_vf_vf_vf(y, sigmoidscalekf(x));
+}
+
+SLEEF_INLINE SLEEF_CONST vfloat Sleef_sigmoidf4_u35avx2128(vfloat x) {
+  return vmul_vf_vf_vf(sigmoidkf(vcast_vf2_vf_vf(x, vcast_vf_f(0))), sigmoidscalekf(x));
+}
+
+SLEEF_INLINE SLEEF_CONST vfloat Sleef_softplusf4_u10avx2128(vfloat x) {
+  vfloat2 e = expk2f(vcast_vf2_vf_vf(vneg_vf_vf(vabs_vf_vf(x)), vcast_vf_f(0)));
+  vfloat2 d = dfadd2_vf2_vf_vf2(vmax_vf_vf_vf(x, vcast_vf_f(0)), logk2f(dfadd2_vf2_vf_vf2(vcast_vf_f(1), e)));
+  vfloat y = vadd_vf_vf_vf(vf2getx_vf_vf2(d), vf2gety_vf_vf2(d));
+
+  y = vsel_vf_vo_vf_vf(vlt_vo_vf_vf(x, vcast_vf_f(-20)), vadd_vf_vf_vf(vf2getx_vf_vf2(e), vf2gety_vf_vf2(e)), y);
+  y = vsel_vf_vo_vf_vf(vispinf_vo_vf(x), vcast_vf_f(__builtin_inff()), y);
+
+  return y;
+}
+
+SLEEF_INLINE SLEEF_CONST vfloat Sleef_softplusf4_u35avx2128(vfloat x) {
+  return vadd_vf_vf_vf(vmax_vf_vf_vf(x, vcast_vf_f(0)), Sleef_log1pf4_u10avx2128(Sleef_expf4_u10avx2128(vneg_vf_vf(vabs_vf_vf(x)))));
+}
+
+SLEEF_INLINE SLEEF_CONST vfloat Sleef_siluf4_u10avx2128(vfloat x) {
+  vfloat2 d = dfmul_vf2_vf2_vf(sigmoidk2f(vcast_vf2_vf_vf(x, vcast_vf_f(0))), x);
+  vfloat y = vmul_vf_vf_vf(vadd_vf_vf_vf(vf2getx_vf_vf2(d), vf2gety_vf_vf2(d)), sigmoidscalekf(x));
+
+  y = vsel_vf_vo_vf_vf(vor_vo_vo_vo(vgt_vo_vf_vf(vabs_vf_vf(x), vcast_vf_f(150)), veq_vo_vf_vf(x, vcast_vf_f(0))),
+         vsel_vf_vo_vf_vf(vsignbit_vo_vf(x), vcast_vf_f(-0.0f), x), y);
+
+  return y;
+}
+
+SLEEF_INLINE SLEEF_CONST vfloat Sleef_siluf4_u35avx2128(vfloat x) {
+  vfloat y = vmul_vf_vf_vf(vmul_vf_vf_vf(sigmoidkf(vcast_vf2_vf_vf(x, vcast_vf_f(0))), x), sigmoidscalekf(x));
+
+  y = vsel_vf_vo_vf_vf(vor_vo_vo_vo(vgt_vo_vf_vf(vabs_vf_vf(x), vcast_vf_f(150)), veq_vo_vf_vf(x, vcast_vf_f(0))),
+         vsel_vf_vo_vf_vf(vsignbit_vo_vf(x), vcast_vf_f(-0.0f), x), y);
+
+  return y;
+}
+
+SLEEF_INLINE SLEEF_CONST vfloat Sleef_gelutanhf4_u10avx2128(vfloat x) {
+  vfloat2 t = gelutanhkf(x);
+  vfloat2 d = dfmul_vf2_vf2_vf(sigmoidk2f(t), x);
+  vfloat y = vmul_vf_vf_vf(vadd_vf_vf_vf(vf2getx_vf_vf2(d), vf2gety_vf_vf2(d)), sigmoidscalekf(vf2getx_vf_vf2(t)));
+
+  y = vsel_vf_vo_vf_vf(vor_vo_vo_vo(vgt_vo_vf_vf(vabs_vf_vf(x), vcast_vf_f(12)), veq_vo_vf_vf(x, vcast_vf_f(0))),
+         vsel_vf_vo_vf_vf(vsignbit_vo_vf(x), vcast_vf_f(-0.0f), x), y);
+
+  return y;
+}
+
+SLEEF_INLINE SLEEF_CONST vfloat Sleef_gelutanhf4_u35avx2128(vfloat x) {
+  vfloat2 t = gelutanhkf(x);
+  vfloat y = vmul_vf_vf_vf(vmul_vf_vf_vf(sigmoidkf(t), x), sigmoidscalekf(vf2getx_vf_vf2(t)));
+
+  y = vsel_vf_vo_vf_vf(vor_vo_vo_vo(vgt_vo_vf_vf(vabs_vf_vf(x), vcast_vf_f(12)), veq_vo_vf_vf(x, vcast_vf_f(0))),
+         vsel_vf_vo_vf_vf(vsignbit_vo_vf(x), vcast_vf_f(-0.0f), x), y);
+
+  return y;
+}
+
+SLEEF_INLINE SLEEF_CONST vfloat Sleef_geluf4_u15avx2128(vfloat x) {
+  vfloat2 d = erfckf(dfmul_vf2_vf2_vf(vcast_vf2_f_f(0.7071067690849304f, 1.2101617485882343e-08f), vabs_vf_vf(x)), 1);
+  d = vsel_vf2_vo_vf2_vf2(vlt_vo_vf_vf(x, vcast_vf_f(0)), d, dfadd2_vf2_vf_vf2(vcast_vf_f(36893488147419103232.0f), dfneg_vf2_vf2(d)));
+  d = dfmul_vf2_vf2_vf(d, x);
+  vfloat y = vmul_vf_vf_vf(vadd_vf_vf_vf(vf2getx_vf_vf2(d), vf2gety_vf_vf2(d)), vcast_vf_f(2.71050543121376108501863e-20f));
+
+  y = vsel_vf_vo_vf_vf(vor_vo_vo_vo(vgt_vo_vf_vf(vabs_vf_vf(x), vcast_vf_f(15)), veq_vo_vf_vf(x, vcast_vf_f(0))),
+         vsel_vf_vo_vf_vf(vsignbit_vo_vf(x), vcast_vf_f(-0.0f), x), y);
+
+  return y;
+}
+
+
+
+// See sleefsimddp.c for the structure of the fast functions
+
+
+
+
+static SLEEF_ALWAYS_INLINE SLEEF_CONST vfloat fastexpkf(vfloat s) { // e^s - 1 for |s| <= log(2)/2
+  vfloat s2 = vmul_vf_vf_vf(s, s);
+  vfloat u = vmla_vf_vf_vf_vf((s2), (vmla_vf_vf_vf_vf((s), (vcast_vf_f(0.00836915337f)), (vcast_vf_f(0.0418338217f)))), (vmla_vf_vf_vf_vf((s), (vcast_vf_f(0.166665226f)), (vcast_vf_f(0.499997497f)))))
+
+
+
+                  ;
+  return vmla_vf_vf_vf_vf(s2, u, s);
+}
+
+static SLEEF_ALWAYS_INLINE SLEEF_CONST vfloat2 fastlogkf(vfloat d) { // (e, log(m)) for d = m * 2^e
+
+  vint2 e = vilogb2k_vi2_vf(vmul_vf_vf_vf(d, vcast_vf_f(1.0f/0.75f)));
+  vfloat m = vldexp3_vf_vf_vi2(d, vneg_vi2_vi2(e));
+  vfloat ef = vcast_vf_vi2(e);
+
+
+
+
+
+
+  vfloat x = vdiv_vf_vf_vf(vsub_vf_vf_vf(m, vcast_vf_f(1.0f)), vadd_vf_vf_vf(vcast_vf_f(1.0f), m));
+  vfloat x2 = vmul_vf_vf_vf(x, x);
+  vfloat t = vmla_vf_vf_vf_vf((x2), (vcast_vf_f(0.411796182f)), (vcast_vf_f(0.666606724f)));
+
+  return vcast_vf2_vf_vf(ef, vmla_vf_vf_vf_vf(vmul_vf_vf_vf(x, x2), t, vadd_vf_vf_vf(x, x)));
+}
+
+SLEEF_INLINE SLEEF_CONST vfloat Sleef_fastexpf4_u3500avx2128(vfloat d) {
+  vfloat q = vrint_vf_vf(vmul_vf_vf_vf(d, vcast_vf_f(1.442695040888963407359924681001892137426645954152985934135449406931f))), s;
+
+  s = vmla_vf_vf_vf_vf(q, vcast_vf_f(-0.693145751953125f), d);
+  s = vmla_vf_vf_vf_vf(q, vcast_vf_f(-1.428606765330187045e-06f), s);
+
+  vfloat u = vmul_vf_vf_vf(vadd_vf_vf_vf(fastexpkf(s), vcast_vf_f(1.0f)), vpow2i_vf_vi2(vrint_vi2_vf(q)));
+
+  vopmask g = vlt_vo_vf_vf(vabs_vf_vf(d), vcast_vf_f(87.0f));
+  if (!__builtin_expect(!!(vtestallones_i_vo32(g)), 1)) return vsel_vf_vo_vf_vf(g, u, Sleef_expf4_u10avx2128(d));
+
+  return u;
+}
+
+SLEEF_INLINE SLEEF_CONST vfloat Sleef_fastexp2f4_u3500avx2128(vfloat d) {
+  vfloat q = vrint_vf_vf(d);
+  vfloat s = vmul_vf_vf_vf(vsub_vf_vf_vf(d, q), vcast_vf_f(0.693147180559945286226764f));
+
+  vfloat u = vmul_vf_vf_vf(vadd_vf_vf_vf(fastexpkf(s), vcast_vf_f(1.0f)), vpow2i_vf_vi2(vrint_vi2_vf(q)));
+
+  vopmask g = vlt_vo_vf_vf(vabs_vf_vf(d), vcast_vf_f(126.0f));
+  if (!__builtin_expect(!!(vtestallones_i_vo32(g)), 1)) return vsel_vf_vo_vf_vf(g, u, Sleef_exp2f4_u35avx2128(d));
+
+  return u;
+}
+
+SLEEF_INLINE SLEEF_CONST vfloat Sleef_fastlogf4_u3500avx2128(vfloat d) {
+  vfloat2 k = fastlogkf(d);
+  vfloat u = vmla_vf_vf_vf_vf(vf2getx_vf_vf2(k), vcast_vf_f(0.693147180559945286226764f), vf2gety_vf_vf2(k));
+
+  vopmask g = vand_vo_vo_vo(vge_vo_vf_vf(d, vcast_vf_f(0x1p-126)), vlt_vo_vf_vf(d, vcast_vf_f(__builtin_inff())));
+  if (!__builtin_expect(!!(vtestallones_i_vo32(g)), 1)) return vsel_vf_vo_vf_vf(g, u, Sleef_logf4_u35avx2128(d));
+
+  return u;
+}
+
+SLEEF_INLINE SLEEF_CONST vfloat Sleef_fastlog2f4_u3500avx2128(vfloat d) {
+  vfloat2 k = fastlogkf(d);
+  vfloat u = vmla_vf_vf_vf_vf(vf2gety_vf_vf2(k), vcast_vf_f(1.442695040888963407359924681001892137426645954152985934135449406931f), vf2getx_vf_vf2(k));
+
+  vopmask g = vand_vo_vo_vo(vge_vo_vf_vf(d, vcast_vf_f(0x1p-126)), vlt_vo_vf_vf(d, vcast_vf_f(__builtin_inff())));
+  if (!__builtin_expect(!!(vtestallones_i_vo32(g)), 1)) return vsel_vf_vo_vf_vf(g, u, Sleef_log2f4_u35avx2128(d));
+
+  return u;
+}
+
+SLEEF_INLINE SLEEF_CONST vfloat Sleef_fasttanhf4_u3500avx2128(vfloat x) {
+  vfloat d = vmul_vf_vf_vf(vmin_vf_vf_vf(vabs_vf_vf(x), vcast_vf_f(8.664339742f)), vcast_vf_f(2.0f));
+  vfloat q = vrint_vf_vf(vmul_vf_vf_vf(d, vcast_vf_f(1.442695040888963407359924681001892137426645954152985934135449406931f))), s;
+
+  s = vmla_vf_vf_vf_vf(q, vcast_vf_f(-0.693145751953125f), d);
+  s = vmla_vf_vf_vf_vf(q, vcast_vf_f(-1.428606765330187045e-06f), s);
+
+  vfloat t = vpow2i_vf_vi2(vrint_vi2_vf(q));
+  vfloat u = vmla_vf_vf_vf_vf(fastexpkf(s), t, vsub_vf_vf_vf(t, vcast_vf_f(1.0f)));
+  u = vdiv_vf_vf_vf(u, vadd_vf_vf_vf(u, vcast_vf_f(2.0f)));
+
+  u = vmulsign_vf_vf_vf(u, x);
+  u = vreinterpret_vf_vm(vor_vm_vo32_vm(visnan_vo_vf(x), vreinterpret_vm_vf(u)));
+
+  return u;
+}
+
+SLEEF_INLINE SLEEF_CONST vfloat Sleef_fastatan2f4_u3500avx2128(vfloat y, vfloat x) {
+  vfloat ax = vabs_vf_vf(x), ay = vabs_vf_vf(y);
+  vfloat n = vmin_vf_vf_vf(ax, ay), m = vmax_vf_vf_vf(ax, ay);
+
+  vopmask o = vgt_vo_vf_vf(n, vmul_vf_vf_vf(m, vcast_vf_f(0.414213562373095048801689f)));
+  vfloat s = vdiv_vf_vf_vf(vsel_vf_vo_vf_vf(o, vsub_vf_vf_vf(n, m), n), vsel_vf_vo_vf_vf(o, vadd_vf_vf_vf(n, m), m));
+
+  vfloat s2 = vmul_vf_vf_vf(s, s), s4 = vmul_vf_vf_vf(s2, s2);
+  vfloat t = vmla_vf_vf_vf_vf((s4), (vmla_vf_vf_vf_vf((s2), (vcast_vf_f(0.0853910074f)), (vcast_vf_f(-0.140289456f)))), (vmla_vf_vf_vf_vf((s2), (vcast_vf_f(0.199915484f)), (vcast_vf_f(-0.333332896f)))))
+
+
+
+                   ;
+
+  t = vmla_vf_vf_vf_vf(vmul_vf_vf_vf(s, s2), t, s);
+  t = vadd_vf_vf_vf(t, vsel_vf_vo_f_f(o, (float)(3.141592653589793238462643383279502884/4), 0));
+  t = vsel_vf_vo_vf_vf(vgt_vo_vf_vf(ay, ax), vsub_vf_vf_vf(vcast_vf_f((float)(3.141592653589793238462643383279502884/2)), t), t);
+  t = vsel_vf_vo_vf_vf(vsignbit_vo_vf(x), vsub_vf_vf_vf(vcast_vf_f((float)3.141592653589793238462643383279502884), t), t);
+  t = vmulsign_vf_vf_vf(t, y);
+
+  vopmask g = vnot_vo32_vo32(vor_vo_vo_vo(visnan_vo_vf(t), vor_vo_vo_vo(visnan_vo_vf(x), visnan_vo_vf(y))));
+  if (!__builtin_expect(!!(vtestallones_i_vo32(g)), 1)) return vsel_vf_vo_vf_vf(g, t, Sleef_atan2f4_u35avx2128(y, x));
+
+  return t;
+}
+
+SLEEF_INLINE SLEEF_CONST vfloat Sleef_fastrsqrtf4_u3500avx2128(vfloat d) { return vrec_vf_vf(Sleef_sqrtf4_avx2128(d)); }
+SLEEF_INLINE SLEEF_CONST vfloat Sleef_fastrcpf4_u3500avx2128(vfloat d) { return vrec_vf_vf(d); }